@@ -1,4 +1,5 @@
 #include "ADMMTrajOptimizer.hpp"
+#include "GaussNewtonMultipleShootingADMM.hpp"
 #include "robot_dynamics.hpp"
 #include "eigenmvn.hpp"
 #include "cnpy.h"
@@ -9,7 +10,7 @@ ADMMTrajOptimizer::ADMMTrajOptimizer(unsigned int N_, double dt_) : N(N_), dt(dt
 ADMMTrajOptimizer::~ADMMTrajOptimizer() = default;
 
 void ADMMTrajOptimizer::run(const std::shared_ptr<RobotAbstract>& kukaRobot, stateVec_t init_state, optimizer::IterativeLinearQuadraticRegulatorADMM::OptSet& solverOptions, ADMMopt& ADMM_OPTS, IKTrajectory<IK_FIRST_ORDER>::IKopt& IK_OPT, \
- Saturation& LIMITS, ContactModel::ContactParams<double>& cp, std::vector<Eigen::MatrixXd>& cartesianPoses)
+ Saturation& LIMITS, ContactModel::ContactParams<double>& cp, std::vector<Eigen::MatrixXd>& cartesianPoses, bool multipleShooting)
 {
   // parameters for ADMM, penelty terms. initial
   Eigen::VectorXd rho_init(5);
@@ -26,16 +27,9 @@ void ADMMTrajOptimizer::run(const std::shared_ptr<RobotAbstract>& kukaRobot, sta
   // dynamic model of the manipulator and the contact model
   using Dynamics = admm::Dynamics<RobotAbstract, stateSize, commandSize>;
   std::shared_ptr<Dynamics> KukaDynModel = std::shared_ptr<Dynamics>(new RobotDynamics(dt, N, kukaRobot, contactModel));
+  KukaDynModel->setNumThreads(std::thread::hardware_concurrency()); // split the linearization over the horizon
   // std::shared_ptr<RobotDynamics> KukaDynModel = std::make_shared<RobotDynamics>(dt, N, kukaRobot, contactModel);
 
-  // TODO: make this updatable, for speed
-  using Optimizer = optimizer::IterativeLinearQuadraticRegulatorADMM;
-  std::shared_ptr<Optimizer> solverDDP = std::make_shared<Optimizer>(KukaDynModel, costFunction_admm, solverOptions, N, ADMM_OPTS.dt, ENABLE_FULLDDP, ENABLE_QPBOX);
-
-
-  // admm optimizer
-  ADMMMultiBlock<RobotAbstract, RobotAbstract, stateSize, commandSize> optimizerADMM(kukaRobot, costFunction_admm, solverDDP, ADMM_OPTS, IK_OPT, N);
-
   stateVec_t xinit;
   stateVecTab_t xtrack;
   xtrack.resize(stateSize, NumberofKnotPt + 1);
@@ -71,11 +65,36 @@ void ADMMTrajOptimizer::run(const std::shared_ptr<RobotAbstract>& kukaRobot, sta
   u_0.resize(commandSize, N);
   u_0.setZero();
 
-  std::cout << "Running the Optimizer..." << std::endl;
-  optimizerADMM.solve(xinit, u_0, xtrack, cartesianPoses, rho, LIMITS);
+  // TODO: make this updatable, for speed
+  if (multipleShooting)
+  {
+    using Optimizer = optimizer::GaussNewtonMultipleShootingADMM;
+    Optimizer::OptSet multipleShootingOptions;
+    static_cast<optimizer::IterativeLinearQuadraticRegulatorADMM::OptSet&>(multipleShootingOptions) = solverOptions;
+    std::shared_ptr<Optimizer> solverGNMS = std::make_shared<Optimizer>(KukaDynModel, costFunction_admm, multipleShootingOptions, N, ADMM_OPTS.dt, ENABLE_FULLDDP, ENABLE_QPBOX);
+    solverGNMS->setNumThreads(std::thread::hardware_concurrency()); // shoot the segments in parallel
+
+    // admm optimizer, the states of the shooting segments are seeded from the IK trajectory
+    ADMMMultiBlock<RobotAbstract, RobotAbstract, stateSize, commandSize, Optimizer> optimizerADMM(kukaRobot, costFunction_admm, solverGNMS, ADMM_OPTS, IK_OPT, N);
 
+    std::cout << "Running the Optimizer (multiple shooting)..." << std::endl;
+    optimizerADMM.solve(xinit, u_0, xtrack, cartesianPoses, rho, LIMITS);
 
-  resultTrajectory = optimizerADMM.getLastSolvedTrajectory();
+    resultTrajectory = optimizerADMM.getLastSolvedTrajectory();
+  }
+  else
+  {
+    using Optimizer = optimizer::IterativeLinearQuadraticRegulatorADMM;
+    std::shared_ptr<Optimizer> solverDDP = std::make_shared<Optimizer>(KukaDynModel, costFunction_admm, solverOptions, N, ADMM_OPTS.dt, ENABLE_FULLDDP, ENABLE_QPBOX);
+
+    // admm optimizer
+    ADMMMultiBlock<RobotAbstract, RobotAbstract, stateSize, commandSize> optimizerADMM(kukaRobot, costFunction_admm, solverDDP, ADMM_OPTS, IK_OPT, N);
+
+    std::cout << "Running the Optimizer..." << std::endl;
+    optimizerADMM.solve(xinit, u_0, xtrack, cartesianPoses, rho, LIMITS);
+
+    resultTrajectory = optimizerADMM.getLastSolvedTrajectory();
+  }
 
   using State             = stateVec_t;
   using Scalar            = double;
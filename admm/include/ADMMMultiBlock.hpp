@@ -6,10 +6,14 @@
 #include <cmath>
 #include <utility>
 #include <vector>
+#include <array>
+#include <algorithm>
+#include <type_traits>
 #include <cstdio>
 
 #include "config.h"
 #include "IterativeLinearQuadraticRegulatorADMM.hpp"
+#include "GaussNewtonMultipleShootingADMM.hpp"
 #include "robot_dynamics.hpp"
 #include "cost_function_admm.hpp"
 
@@ -26,7 +30,7 @@
 
 #include <unsupported/Eigen/CXX11/Tensor>
 
-template<typename RobotModelOptimizer, typename RobotModel, int StateSize, int ControlSize>
+template<typename RobotModelOptimizer, typename RobotModel, int StateSize, int ControlSize, typename Solver = optimizer::IterativeLinearQuadraticRegulatorADMM>
 class ADMMMultiBlock
 {
 
@@ -34,7 +38,7 @@ public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   
   ADMMMultiBlock(const std::shared_ptr<RobotModelOptimizer>& kukaRobot, std::shared_ptr<CostFunctionADMM>  costFunction,
-    std::shared_ptr<optimizer::IterativeLinearQuadraticRegulatorADMM>  solver, const ADMMopt& ADMM_opt, const IKTrajectory<IK_FIRST_ORDER>::IKopt& IK_opt, unsigned int Time_steps) :
+    std::shared_ptr<Solver>  solver, const ADMMopt& ADMM_opt, const IKTrajectory<IK_FIRST_ORDER>::IKopt& IK_opt, unsigned int Time_steps) :
     N(Time_steps), kukaRobot_(kukaRobot), ADMM_OPTS(ADMM_opt), IK_OPT(IK_opt), costFunction_(std::move(costFunction)), solver_(std::move(solver))
   {
     /* Initialize Primal and Dual variables */
@@ -116,6 +120,8 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
   const stateVecTab_t& xtrack, const std::vector<Eigen::MatrixXd>& cartesianTrack,
    const Eigen::VectorXd& rho, const Saturation& L) 
 {
+    // the DDP block enforces the control limits directly through its box QP
+    solver_->setControlLimits(L.controlLimits.row(0).transpose(), L.controlLimits.row(1).transpose());
 
     // Initial Trajectory 
     // Initialize Trajectory to get xnew with u_0 
@@ -172,11 +178,14 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
     qbar = joint_positions_IK;
 
     // calculates contact terms 
-    contact_update(kukaRobot_, xnew, &cnew);
+    contact_update(xnew, &cnew);
     cbar = cnew;
     xbar.block(0, 0, 7, N + 1) = joint_positions_IK;
     ubar.setZero();
 
+    // a multiple shooting solver starts from the IK joint positions instead of the rollout of u_0
+    seedStatesFromIK(*solver_, std::integral_constant<bool, Solver::multipleShooting>());
+
     x_lambda.setZero();
     c_lambda.setZero();
     u_lambda.setZero();
@@ -194,8 +203,11 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
 
     double cost = 0.0;
 
+    rhoAdmm = rho;
+    for (auto& snapshot : spectral) { snapshot.valid = false; }
+    admmIterations = ADMM_OPTS.ADMMiterMax;
+
     Eigen::VectorXd rho_ddp(5);
-    rho_ddp << rho(0), rho(1), rho(2), 0, 0;
 
     /* ------------------------------------------------ Run ADMM ---------------------------------------------- */
     std::cout << "begin ADMM..." << std::endl;
@@ -204,9 +216,14 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
 
     for (unsigned int i = 0; i < ADMM_OPTS.ADMMiterMax; i++) {
 
-        // TODO: Stopping criterion is needed
         std::cout << "in ADMM iteration " << i + 1 << std::endl;
 
+        rho_ddp << rhoAdmm(0), rhoAdmm(1), rhoAdmm(2), 0, 0;
+
+        xbar_old = xbar;
+        cbar_old = cbar;
+        ubar_old = ubar;
+
        /* ---------------------------------------- iLQRADMM solver block ----------------------------------------   */
         start = std::chrono::high_resolution_clock::now();
         solver_->solve(xinit, unew, xtrack, cbar - c_lambda, xbar - x_lambda, ubar - u_lambda, qbar - q_lambda, rho_ddp, R_c);
@@ -247,13 +264,13 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
         
         start = std::chrono::high_resolution_clock::now();
         /* ----------------------------- update cnew. TODO: variable path curves -----------------------------  */
-        contact_update(kukaRobot_, xnew, &cnew);
+        contact_update(xnew, &cnew);
         
 
         /* ------------------------------------------- IK block update -----------------------------------------   */ 
         std::cout << "begin differential IK..." << std::endl;
         joint_positions_IK.setZero();
-        IK_solve.getTrajectory(cartesianTrack, xnew.col(0).head(7), xnew.col(0).segment(7, 7), xbar.block(0, 0, 7, N + 1) - q_lambda, xbar.block(7, 0, 7, N + 1), rho,  &joint_positions_IK);
+        IK_solve.getTrajectory(cartesianTrack, xnew.col(0).head(7), xnew.col(0).segment(7, 7), xbar.block(0, 0, 7, N + 1) - q_lambda, xbar.block(7, 0, 7, N + 1), rhoAdmm,  &joint_positions_IK);
         std::cout << "end differential IK..." << std::endl;
         
         /* ----------------------------------------------- TESTING ----------------------------------------------- */
@@ -299,23 +316,30 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
             x_lambda.col(j) += (xnew.col(j) - xbar.col(j)).eval();
             u_lambda.col(j) += (unew.col(j) - ubar.col(j)).eval();
             q_lambda.col(j) += (joint_positions_IK.col(j) - xbar.col(j).head(7)).eval();
-
-            // Save residuals for all iterations
-            res_c[i] = (cnew.col(j) - cbar.col(j)).norm();
-            res_x[i] = (xnew.col(j) - xbar.col(j)).norm();
-            res_u[i] = (unew.col(j) - ubar.col(j)).norm();
-            res_q[i] = (joint_positions_IK.col(j) - xbar.col(j).head(7)).norm();
-
         }
 
         // xbar.col(N) = xubar.col(N - 1).head(stateSize); // 
         xbar.col(N) = x_temp.col(N);
         x_lambda.col(N) += (xnew.col(N) - xbar.col(N)).eval();
         q_lambda.col(N) += (joint_positions_IK.col(N) - xbar.col(N).head(7)).eval();
-        
-        res_x[i] = (xnew.col(N) - xbar.col(N)).norm();
-        res_c[i] = (cnew.col(N) - cbar.col(N)).norm();
-        res_q[i] = (joint_positions_IK.col(N) - xbar.col(N).head(7)).norm();
+
+        /* ----------------------------------------- Residuals over the horizon ----------------------------------------- */
+        const bool updateRho = ADMM_OPTS.rhoUpdate != RhoUpdate::Fixed && (i + 1) % std::max(1u, ADMM_OPTS.rhoInterval) == 0;
+
+        updateBlock(0, xnew, xbar, xbar_old, x_lambda, updateRho);
+        updateBlock(1, unew, ubar, ubar_old, u_lambda, updateRho);
+        updateBlock(2, cnew, cbar, cbar_old, c_lambda, updateRho);
+        updateBlock(3, joint_positions_IK, xbar.topRows(7), xbar_old.topRows(7), q_lambda, updateRho);
+
+        res_x[i] = primalRes[0];
+        res_u[i] = primalRes[1];
+        res_c[i] = primalRes[2];
+        res_q[i] = primalRes[3];
+
+        res_xlambda[i] = dualRes[0];
+        res_ulambda[i] = dualRes[1];
+        res_clambda[i] = dualRes[2];
+        res_qlambda[i] = dualRes[3];
 
 
 
@@ -329,10 +353,26 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
 
         final_cost[i + 1] = cost;
 
+        /* ---------------------------------------- Stopping criterion ---------------------------------------- */
+        if (converged())
+        {
+            admmIterations = i + 1;
+            std::cout << "ADMM converged in " << admmIterations << " iterations" << std::endl;
+            break;
+        }
+
+        /* ---------------------------------------- Penalty update ---------------------------------------- */
+        if (updateRho)
+        {
+            rescalePenalty(0, x_lambda);
+            rescalePenalty(1, u_lambda);
+            rescalePenalty(2, c_lambda);
+            rescalePenalty(3, q_lambda);
+        }
     }
 
 
-    solver_->initializeTrajectory(xinit, unew, xtrack, cbar, xbar, ubar, qbar, rho, R_c);
+    solver_->initializeTrajectory(xinit, unew, xtrack, cbar, xbar, ubar, qbar, rhoAdmm, R_c);
 
     lastTraj = solver_->getLastSolvedTrajectory();
     xnew = lastTraj.xList;
@@ -352,7 +392,7 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
     std::cout << "ADMM Trajectory Generation Finished!..." << std::endl;
 
 
-    for (unsigned int i = 0; i < ADMM_OPTS.ADMMiterMax; i++) {
+    for (unsigned int i = 0; i < admmIterations; i++) {
       std::cout << "res_x[" << i << "]:" << res_x[i] << std::endl;
       std::cout << "res_u[" << i << "]:" << res_u[i] << std::endl;
       std::cout << "res_c[" << i << "]:" << res_c[i] << std::endl;
@@ -364,41 +404,61 @@ void solve(const stateVec_t& xinit, const commandVecTab_t& u_0,
 
   }
 
-  void contact_update(std::shared_ptr<RobotModelOptimizer>& kukaRobot, const stateVecTab_t& xnew, Eigen::MatrixXd* cnew)
+  /* contact terms of the trajectory, from the kinematics cache it shares with the cost function */
+  void contact_update(const stateVecTab_t& xnew, Eigen::MatrixXd* cnew)
   {
     double vel = 0.0;
     double m = 0.3; 
     double R = 0.4;
 
-    Eigen::MatrixXd jacobian(6, 7);
-
     curve.curvature(X_curve.transpose(), L, R_c, k);
     R_c = Eigen::VectorXd::Constant(N+1, 1);
 
+    admm::KinematicsCache& kinematics = *costFunction_->getKinematicsCache();
+    kinematics.update(xnew);
 
     for (int i = 0; i < xnew.cols(); i++) {
-        kukaRobot->getSpatialJacobian(const_cast<double*>(xnew.col(i).head(7).data()), jacobian);
-
-        vel = (jacobian * xnew.col(i).segment(6, 7)).norm();
+        vel = (kinematics[i].J * kinematics[i].qd).norm();
         (*cnew)(0,i) = m * vel * vel / R_c(i);
         // std::cout << 1/R_c(i) << " " << std::endl;
-        (*cnew)(1,i) = *(const_cast<double*>(xnew.col(i).tail(1).data()));
+        (*cnew)(1,i) = xnew(16, i);
     }
   }
 
-  optimizer::IterativeLinearQuadraticRegulatorADMM::traj getLastSolvedTrajectory()
+  typename Solver::traj getLastSolvedTrajectory()
   {
     return lastTraj;
   }
 
-  struct optimizer::IterativeLinearQuadraticRegulatorADMM::traj lastTraj;
+  /* IK joint positions, finite-difference velocities, contact states of the rollout */
+  template<typename MultipleShootingSolver>
+  void seedStatesFromIK(MultipleShootingSolver& solver, std::true_type)
+  {
+    stateVecTab_t xGuess = xnew;
+    xGuess.topRows(7) = joint_positions_IK;
+
+    for (unsigned int i = 1; i < N; i++) {
+      xGuess.col(i).segment(7, 7) = (joint_positions_IK.col(i + 1) - joint_positions_IK.col(i - 1)) / (2 * ADMM_OPTS.dt);
+    }
+    xGuess.col(0) = xnew.col(0);
+
+    solver.setStateGuess(xGuess);
+  }
+
+  void seedStatesFromIK(Solver&, std::false_type) {}
+
+  /* ADMM iterations run by the last solve and the penalty it ended with */
+  unsigned int getADMMIterations() const { return admmIterations; }
+  const Eigen::VectorXd& getPenalty() const { return rhoAdmm; }
+
+  typename Solver::traj lastTraj;
 
 
 protected:
   models::KUKA robotIK;
   std::shared_ptr<RobotModelOptimizer> kukaRobot_;
   std::shared_ptr<CostFunctionADMM> costFunction_;
-  std::shared_ptr<optimizer::IterativeLinearQuadraticRegulatorADMM> solver_;
+  std::shared_ptr<Solver> solver_;
   ProjectionOperator m_projectionOperator{};
 
   Curvature curve;
@@ -467,6 +527,128 @@ protected:
 
   Eigen::Tensor<double, 3> data_store;
 
+  /* consensus blocks primal = bar: 0 state, 1 control, 2 contact, 3 IK joint positions, with their index in rho */
+  static constexpr int numBlocks = 4;
+  static int rhoIndex(int b) { return (b == 3) ? 4 : b; }
+
+  Eigen::VectorXd rhoAdmm; // penalty of the current solve, adapted according to ADMM_OPTS.rhoUpdate
+  unsigned int admmIterations{0};
+
+  // horizon-wide residual norms of the last iteration and the scales of the relative tolerances
+  std::array<double, numBlocks> primalRes, dualRes, primalScale, dualScale, rhoNext;
+  std::array<long, numBlocks> blockSize;
+
+  // primal, bar and (unscaled) dual variables at the last spectral update
+  struct SpectralSnapshot
+  {
+    Eigen::MatrixXd primal, bar, dual, dualHat;
+    bool valid = false;
+  };
+  std::array<SpectralSnapshot, numBlocks> spectral;
+
+  /* 
+   * residuals of one block, primal r = primal - bar and dual s = rho (bar - bar_old), and its next penalty.
+   * lambda is the scaled dual, already updated in this iteration.
+   */
+  void updateBlock(int b, const Eigen::Ref<const Eigen::MatrixXd>& primal, const Eigen::Ref<const Eigen::MatrixXd>& bar,
+    const Eigen::Ref<const Eigen::MatrixXd>& bar_old, const Eigen::Ref<const Eigen::MatrixXd>& lambda, bool updateRho)
+  {
+    const double rho_b = rhoAdmm(rhoIndex(b));
+
+    primalRes[b]   = (primal - bar).norm();
+    dualRes[b]     = rho_b * (bar - bar_old).norm();
+    primalScale[b] = std::max(primal.norm(), bar.norm());
+    dualScale[b]   = rho_b * lambda.norm();
+    blockSize[b]   = primal.size();
+    rhoNext[b]     = rho_b;
+
+    // an uncoupled block keeps its zero penalty
+    if (!updateRho || rho_b == 0) return;
+
+    if (ADMM_OPTS.rhoUpdate == RhoUpdate::ResidualBalancing)
+    {
+      if (primalRes[b] > ADMM_OPTS.rhoBalance * dualRes[b])       rhoNext[b] = rho_b * ADMM_OPTS.rhoScale;
+      else if (dualRes[b] > ADMM_OPTS.rhoBalance * primalRes[b])  rhoNext[b] = rho_b / ADMM_OPTS.rhoScale;
+    }
+    else if (ADMM_OPTS.rhoUpdate == RhoUpdate::Spectral)
+    {
+      // dual y = rho lambda, and y_hat = rho (lambda_old + primal - bar_old) the dual right after the primal update
+      Eigen::MatrixXd dual    = rho_b * lambda;
+      Eigen::MatrixXd dualHat = rho_b * (lambda + bar - bar_old);
+
+      SpectralSnapshot& snapshot = spectral[b];
+      if (snapshot.valid)
+      {
+        // curvatures of the DDP/IK block (from -grad f = y_hat) and of the projection (from y in the normal cone)
+        const double alpha = spectralCurvature(dualHat - snapshot.dualHat, snapshot.primal - primal);
+        const double beta  = spectralCurvature(dual - snapshot.dual, bar - snapshot.bar);
+
+        if (alpha > 0 && beta > 0)  rhoNext[b] = std::sqrt(alpha * beta);
+        else if (alpha > 0)         rhoNext[b] = alpha;
+        else if (beta > 0)          rhoNext[b] = beta;
+      }
+
+      snapshot.primal  = primal;
+      snapshot.bar     = bar;
+      snapshot.dual    = std::move(dual);
+      snapshot.dualHat = std::move(dualHat);
+      snapshot.valid   = true;
+    }
+
+    rhoNext[b] = std::min(std::max(rhoNext[b], ADMM_OPTS.rhoMin), ADMM_OPTS.rhoMax);
+  }
+
+  /* hybrid steepest-descent / minimum-gradient Barzilai-Borwein estimate, negative when the secant is not trusted */
+  double spectralCurvature(const Eigen::MatrixXd& dy, const Eigen::MatrixXd& dx) const
+  {
+    const double yx = (dy.array() * dx.array()).sum();
+    const double yy = dy.squaredNorm();
+    const double xx = dx.squaredNorm();
+
+    if (yx <= 0 || yx < ADMM_OPTS.rhoCorrelation * std::sqrt(yy * xx)) return -1;
+
+    const double sd = yy / yx;
+    const double mg = yx / xx;
+    return (2 * mg > sd) ? mg : sd - 0.5 * mg;
+  }
+
+  /* switch block b to its next penalty, the scaled dual is rescaled so that rho * lambda is unchanged */
+  void rescalePenalty(int b, Eigen::Ref<Eigen::MatrixXd> lambda)
+  {
+    double& rho_b = rhoAdmm(rhoIndex(b));
+    if (rhoNext[b] == rho_b || rho_b == 0) return;
+
+    lambda *= rho_b / rhoNext[b];
+    rho_b   = rhoNext[b];
+  }
+
+  /* ||r|| <= sqrt(p) absTol + relTol max(||primal||, ||bar||) and ||s|| <= sqrt(n) absTol + relTol ||y|| over the coupled blocks */
+  bool converged() const
+  {
+    if (ADMM_OPTS.absTol <= 0 && ADMM_OPTS.relTol <= 0) return false;
+
+    double r = 0, s = 0, primalNorm = 0, dualNorm = 0;
+    long size = 0;
+
+    for (int b = 0; b < numBlocks; b++)
+    {
+      if (rhoAdmm(rhoIndex(b)) == 0) continue;
+
+      r          += primalRes[b] * primalRes[b];
+      s          += dualRes[b] * dualRes[b];
+      primalNorm += primalScale[b] * primalScale[b];
+      dualNorm   += dualScale[b] * dualScale[b];
+      size       += blockSize[b];
+    }
+
+    const double epsPrimal = std::sqrt(static_cast<double>(size)) * ADMM_OPTS.absTol + ADMM_OPTS.relTol * std::sqrt(primalNorm);
+    const double epsDual   = std::sqrt(static_cast<double>(size)) * ADMM_OPTS.absTol + ADMM_OPTS.relTol * std::sqrt(dualNorm);
+
+    std::cout << "primal residual " << std::sqrt(r) << " (" << epsPrimal << "), dual residual " << std::sqrt(s) << " (" << epsDual << ")" << std::endl;
+
+    return size > 0 && std::sqrt(r) <= epsPrimal && std::sqrt(s) <= epsDual;
+  }
+
   std::chrono::time_point<std::chrono::high_resolution_clock> start, end;
   std::chrono::duration<float, std::milli> elapsed{};
 
@@ -16,7 +16,7 @@ public:
     ~ADMMTrajOptimizer();
 
     void run(const std::shared_ptr<RobotAbstract>& kukaRobot, stateVec_t init_state, optimizer::IterativeLinearQuadraticRegulatorADMM::OptSet& solverOptions, ADMMopt& ADMM_OPTS, IKTrajectory<IK_FIRST_ORDER>::IKopt& IK_OPT, \
-    	Saturation& LIMITS, ContactModel::ContactParams<double>& cp, std::vector<Eigen::MatrixXd>& cartesianPoses); 
+    	Saturation& LIMITS, ContactModel::ContactParams<double>& cp, std::vector<Eigen::MatrixXd>& cartesianPoses, bool multipleShooting = false); 
     optimizer::IterativeLinearQuadraticRegulatorADMM::traj getOptimizerResult(); 
 
 
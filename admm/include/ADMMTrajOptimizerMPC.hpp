@@ -61,9 +61,11 @@ public:
 
         // Initialize Robot Model
         std::shared_ptr<DynamicsOptimizer> KukaDynModel = std::shared_ptr<DynamicsOptimizer>(new RobotDynamics(dt, horizon_mpc, kuka_model_optimizer, contact_model));
+        KukaDynModel->setNumThreads(std::thread::hardware_concurrency());
 
         // Initialize Cost Function 
         std::shared_ptr<CostFunctionADMM> costFunction_admm = std::make_shared<CostFunctionADMM>(horizon_mpc, kuka_model_optimizer);
+        costFunction_admm->setNumThreads(std::thread::hardware_concurrency());
 
         // Optimizer Params 
         optimizer::IterativeLinearQuadraticRegulatorADMM::OptSet solverOptions;
@@ -71,6 +73,7 @@ public:
         solverOptions.tolFun   = ADMM_OPTS.tolFun;
         solverOptions.tolGrad  = ADMM_OPTS.tolGrad;
         solverOptions.max_iter = iterMax;
+        solverOptions.warmStart = true; // consecutive ADMM iterations share the nominal trajectory
 
         using OptimizerDDP = optimizer::IterativeLinearQuadraticRegulatorADMM;
         std::shared_ptr<OptimizerDDP> solver = std::make_shared<OptimizerDDP>(KukaDynModel, costFunction_admm, solverOptions, horizon_mpc, dt, ENABLE_FULLDDP, ENABLE_QPBOX);
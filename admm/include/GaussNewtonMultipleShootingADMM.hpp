@@ -0,0 +1,495 @@
+#ifndef GNMSSOLVER_H
+#define GNMSSOLVER_H
+
+#include "config.h"
+#include "robot_dynamics.hpp"
+#include "cost_function_admm.hpp"
+#include "parallel.hpp"
+#include "box_qp.hpp"
+#include "riccati_kernels.hpp"
+#include "IterativeLinearQuadraticRegulatorADMM.hpp"
+
+#include <numeric>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <Eigen/StdVector>
+#include <Eigen/Cholesky>
+
+namespace optimizer {
+
+/*
+ * Gauss-Newton multiple shooting (GNMS, Giftthaler et al. 2018) variant of IterativeLinearQuadraticRegulatorADMM.
+ *
+ * Every knot keeps its own state, the defects d_i = f(x_i, u_i) - x_{i+1} between the shooting segments are closed by the
+ * Riccati recursion and a linear forward sweep. Shooting the segments, evaluating the cost and the defects are independent
+ * per knot and run on a thread pool. The line-search accepts steps that decrease cost + defectPenalty * sum |d_i|_1.
+ *
+ * Same solve / initializeTrajectory / getLastSolvedTrajectory interface as the single shooting solver, so it plugs into
+ * ADMMMultiBlock. States can be seeded with setStateGuess, e.g. from the IK trajectory.
+ */
+class GaussNewtonMultipleShootingADMM {
+    using State             = stateVec_t;
+    using Control           = commandVec_t;
+    using StateTrajectory   = stateVecTab_t;
+    using ControlTrajectory = commandVecTab_t;
+    using ControlStateGains = commandR_stateC_tab_t;
+
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static constexpr bool multipleShooting = true;
+
+    using traj = IterativeLinearQuadraticRegulatorADMM::traj;
+
+    struct OptSet : IterativeLinearQuadraticRegulatorADMM::OptSet {
+        double defectPenalty;    // weight of the l1 norm of the defects in the merit function
+        double tolDefect;        // largest summed defect norm of a converged trajectory
+
+        OptSet() : defectPenalty(1e3), tolDefect(1e-6) {}
+    };
+
+private:
+    using Dynamics = admm::Dynamics<RobotAbstract, stateSize, commandSize>;
+
+    std::shared_ptr<Dynamics> dynamicModel;
+    std::shared_ptr<CostFunctionADMM> costFunction;
+    unsigned int N;
+    unsigned int iter;
+    double dt;
+
+    stateVecTab_t xList;
+    commandVecTab_t uList;
+    commandVecTab_t uListFull;
+    stateVecTab_t defects;    // d_i = f(x_i, u_i) - x_{i+1}, column N unused
+    costVecTab_t costList;
+    double defectNorm;
+    bool initialized{false};
+    traj lastTraj;
+
+    // linear update of a full step and the candidate of the line-search
+    stateVecTab_t dxList;
+    commandVecTab_t duList;
+    stateVecTab_t xCandidate, defectsCandidate;
+    commandVecTab_t uCandidate;
+    costVecTab_t costCandidate;
+
+    stateVecTab_t Vx;
+    stateMatTab_t Vxx;
+
+    stateVec_t Qx, Vnext;
+    stateMat_t Qxx;
+    commandVec_t Qu;
+    commandMat_t Quu, QuuF;
+    Eigen::LLT<commandMat_t> lltOfQuuF;
+    commandR_stateC_t Qux;
+    commandVec_t k;
+    commandR_stateC_t K;
+    commandVecTab_t kList;
+    commandR_stateC_tab_t KList;
+
+    int backPassDone, fwdPassDone, diverge;
+
+    /* QP variables */
+    bool enableQPBox;
+    bool enableFullDDP;
+    commandVec_t lowerCommandBounds, upperCommandBounds, lb, ub;
+    admm::BoxQP<commandSize> boxQP;
+
+    Control u_NAN_loc;
+
+    /* one dynamics and cost workspace per thread of the shooting pool */
+    admm::ThreadPool pool;
+    std::vector<std::unique_ptr<Dynamics::Workspace>> dynamicsWs;
+    std::vector<std::unique_ptr<RobotAbstractWorkspace>> costWs;
+    std::vector<double> threadDefectNorm;
+
+    OptSet Op;
+
+    // backward-pass kernels, structured if the Jacobian pattern and the discretization of the dynamics allow it. picked in solve
+    admm::RiccatiKernel riccati;
+
+    Eigen::Vector2d dV;
+    double g_norm_i, g_norm_max, g_norm_sum;
+
+public:
+    GaussNewtonMultipleShootingADMM(const std::shared_ptr<Dynamics>& DynamicModel, const std::shared_ptr<CostFunctionADMM>& CostFunction,
+        const OptSet& solverOptions, int time_steps, double dt_, bool fullDDP, bool QPBox) :
+        dynamicModel(DynamicModel), costFunction(CostFunction), N(time_steps), dt(dt_), Op(solverOptions)
+    {
+        enableQPBox   = QPBox;
+        enableFullDDP = fullDDP;
+
+        if(enableQPBox) TRACE("Box QP is enabled\n");
+        else TRACE("Box QP is disabled\n");
+
+        lowerCommandBounds.setConstant(-std::numeric_limits<double>::infinity());
+        upperCommandBounds.setConstant( std::numeric_limits<double>::infinity());
+
+        xList.setZero(stateSize, N + 1);
+        uList.setZero(commandSize, N);
+        uListFull.setZero(commandSize, N + 1);
+        defects.setZero(stateSize, N + 1);
+        costList.assign(N + 1, 0.0);
+
+        dxList.setZero(stateSize, N + 1);
+        duList.setZero(commandSize, N);
+        xCandidate.setZero(stateSize, N + 1);
+        defectsCandidate.setZero(stateSize, N + 1);
+        uCandidate.setZero(commandSize, N);
+        costCandidate.assign(N + 1, 0.0);
+
+        kList.setZero(commandSize, N);
+        KList.resize(N);
+        Vx.setZero(stateSize, N + 1);
+        Vxx.resize(N + 1);
+
+        for (unsigned int i = 0; i < N; i++) KList[i].setZero();
+        for (unsigned int i = 0; i <= N; i++) Vxx[i].setZero();
+
+        k.setZero();
+        K.setZero();
+        dV.setZero();
+
+        Op.alphaList.resize(4);
+        Op.alphaList << 1.0, 0.5012, 0.2512, 0.1259;
+
+        u_NAN_loc.setConstant(sqrt(-1.0));
+
+        setNumThreads(1);
+    }
+
+    /* number of threads the shooting segments are split across, 1 by default */
+    void setNumThreads(unsigned int numThreads)
+    {
+        pool.resize(numThreads);
+
+        dynamicsWs.clear();
+        costWs.clear();
+        for (unsigned int t = 0; t < pool.size(); t++)
+        {
+            dynamicsWs.push_back(dynamicModel->createWorkspace());
+            costWs.push_back(costFunction->createWorkspace());
+        }
+        threadDefectNorm.assign(pool.size(), 0.0);
+    }
+
+    /* control limits enforced by the box QP of the backward pass, unbounded by default */
+    void setControlLimits(const commandVec_t& lower, const commandVec_t& upper)
+    {
+        lowerCommandBounds = lower;
+        upperCommandBounds = upper;
+    }
+
+    /* initial guess of the shooting states, used as they are instead of the rollout of the controls */
+    void setStateGuess(const stateVecTab_t& xGuess)
+    {
+        xList       = xGuess;
+        initialized = true;
+    }
+
+    void solve(const stateVec_t& x_0, const commandVecTab_t& u_0, const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar,
+               const stateVecTab_t& xList_bar, const commandVecTab_t& uList_bar, const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
+    {
+        if(Op.debug_level > 0) {TRACE("begin Gauss-Newton multiple shooting...");}
+
+        // setLinearization / setIntegrator may have changed the discretization since the last solve
+        riccati = admm::RiccatiKernel(dynamicModel->getJacobianPattern(), dynamicModel->hasEulerJacobians());
+
+        // multiple shooting: the states of the last solve (or the guess) stay valid decision variables for any controls
+        if (initialized && u_0.cols() == uList.cols())
+        {
+            uList        = u_0;
+            xList.col(0) = x_0;
+            evaluate(xList, uList, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, costList, defects, defectNorm);
+        }
+        else
+        {
+            initializeTrajectory(x_0, u_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
+        }
+
+        Op.lambda  = Op.lambdaInit;
+        Op.dlambda = Op.dlambdaInit;
+
+        double merit = accumulate(costList.begin(), costList.end(), 0.0) + Op.defectPenalty * defectNorm;
+        bool newDeriv = true;
+
+        if (Op.debug_level > 1) TRACE("iteration,\t cost, \t reduction, \t defects, \t gradient, \t log10(lambda) \n");
+
+        for (iter = 0; iter < Op.max_iter; iter++)
+        {
+            if (newDeriv)
+            {
+                uListFull.leftCols(N) = uList;
+                uListFull.col(N).setConstant(sqrt(-1.0));
+
+                dynamicModel->fx(xList, uListFull);
+                costFunction->computeDerivatives(xList, uListFull, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
+                newDeriv = false;
+            }
+
+            // STEP 2: backward pass with the defects, then the linear forward sweep closing them
+            doBackwardPass();
+            if (diverge)
+            {
+                if (Op.debug_level > 1) printf("Cholesky failed at timestep %d.\n", diverge - 1);
+                Op.dlambda = max(Op.dlambda * Op.lambdaFactor, Op.lambdaFactor);
+                Op.lambda  = max(Op.lambda * Op.dlambda, Op.lambdaMin);
+                if (Op.lambda > Op.lambdaMax) { break; }
+                continue;
+            }
+
+            if (Op.g_norm < Op.tolGrad && Op.lambda < 1e-5 && defectNorm < Op.tolDefect)
+            {
+                if (Op.debug_level >= 1) TRACE(("\nSUCCESS: gradient norm < tolGrad\n"));
+                break;
+            }
+
+            doLinearForwardPass();
+
+            // STEP 3: line-search on the merit function, each candidate is shot in parallel
+            fwdPassDone = 0;
+            double meritNew = merit, defectNormNew = defectNorm;
+
+            for (int alpha_index = 0; alpha_index < Op.alphaList.size(); alpha_index++)
+            {
+                const double alpha = Op.alphaList[alpha_index];
+
+                xCandidate = xList + alpha * dxList;
+                uCandidate = uList + alpha * duList;
+                if (enableQPBox)
+                {
+                    for (unsigned int i = 0; i < N; i++) uCandidate.col(i) = uCandidate.col(i).cwiseMax(lowerCommandBounds).cwiseMin(upperCommandBounds);
+                }
+
+                evaluate(xCandidate, uCandidate, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, costCandidate, defectsCandidate, defectNormNew);
+                meritNew = accumulate(costCandidate.begin(), costCandidate.end(), 0.0) + Op.defectPenalty * defectNormNew;
+
+                if (meritNew < merit)
+                {
+                    fwdPassDone = 1;
+                    break;
+                }
+            }
+
+            // STEP 4: accept step (or not)
+            if (fwdPassDone)
+            {
+                Op.dcost    = merit - meritNew;
+                Op.expected = -(dV(0) + dV(1));
+
+                if (Op.debug_level > 1)
+                {
+                    printf("%-14d%-12.6g%-15.3g%-15.3g%-19.3g%-17.1f\n", iter + 1, accumulate(costCandidate.begin(), costCandidate.end(), 0.0), Op.dcost, defectNormNew, Op.g_norm, log10(Op.lambda));
+                }
+
+                Op.dlambda = min(Op.dlambda / Op.lambdaFactor, 1.0/Op.lambdaFactor);
+                Op.lambda  = Op.lambda * Op.dlambda * (Op.lambda > Op.lambdaMin);
+
+                xList.swap(xCandidate);
+                uList.swap(uCandidate);
+                defects.swap(defectsCandidate);
+                costList.swap(costCandidate);
+                defectNorm = defectNormNew;
+                merit      = meritNew;
+                newDeriv   = true;
+
+                if (Op.dcost < Op.tolFun && defectNorm < Op.tolDefect)
+                {
+                    if (Op.debug_level >= 1) TRACE(("\nSUCCESS: cost change < tolFun\n"));
+                    break;
+                }
+            }
+            else
+            {
+                Op.dlambda = max(Op.dlambda * Op.lambdaFactor, Op.lambdaFactor);
+                Op.lambda  = max(Op.lambda * Op.dlambda, Op.lambdaMin);
+
+                if (Op.debug_level >= 1)
+                {
+                    printf("%-14d%-12.9s%-15.3g%-15.3g%-19.3g%-17.1f\n", iter + 1, "No STEP", Op.dcost, defectNorm, Op.g_norm, log10(Op.lambda));
+                }
+
+                if (Op.lambda > Op.lambdaMax)
+                {
+                    if (Op.debug_level >= 1) TRACE(("\nEXIT: lambda > lambdaMax\n"));
+                    break;
+                }
+            }
+        }
+
+        Op.iterations = iter;
+    }
+
+    /* single shooting rollout of u_0 from x_0, leaves a trajectory without defects */
+    void initializeTrajectory(const State& x_0, const ControlTrajectory& u_0, const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar, const StateTrajectory& xList_bar,
+    const ControlTrajectory& uList_bar, const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
+    {
+        uList        = u_0;
+        xList.col(0) = x_0;
+
+        for (unsigned int i = 0; i < N; i++)
+        {
+            xList.col(i + 1) = forward_integration(xList.col(i), uList.col(i), *dynamicsWs[0]);
+        }
+
+        evaluate(xList, uList, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, costList, defects, defectNorm);
+
+        initialized = true;
+        Op.lambda   = Op.lambdaInit;
+        Op.dcost    = 0;
+        Op.expected = 0;
+    }
+
+    const traj& getLastSolvedTrajectory()
+    {
+        lastTraj.xList       = xList;
+        lastTraj.uList       = uList;
+        lastTraj.KList       = KList;
+        lastTraj.kList       = kList;
+        lastTraj.iter        = iter;
+        lastTraj.finalCost   = accumulate(costList.begin(), costList.end(), 0.0);
+        lastTraj.finalGrad   = Op.g_norm;
+        lastTraj.finalLambda = log10(Op.lambda);
+        return lastTraj;
+    }
+
+    const ControlStateGains& getStateGains() const
+    {
+        return KList;
+    }
+
+    /* summed l1 norm of the defects of the current trajectory */
+    double getDefectNorm() const
+    {
+        return defectNorm;
+    }
+
+private:
+    inline State forward_integration(const State& x, const Control& u, Dynamics::Workspace& ws) const
+    {
+        // RK4 unless the dynamics provide their own step, e.g. the generated one
+        return dynamicModel->step(x, u, ws);
+    }
+
+    /* shoot every segment of (xs, us) in parallel: per knot cost and defect, and the summed l1 defect norm */
+    void evaluate(const stateVecTab_t& xs, const commandVecTab_t& us, const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar, const StateTrajectory& xList_bar,
+        const ControlTrajectory& uList_bar, const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c,
+        costVecTab_t& costs, stateVecTab_t& ds, double& dsNorm)
+    {
+        std::fill(threadDefectNorm.begin(), threadDefectNorm.end(), 0.0);
+
+        pool.parallel_for(N + 1, [&](unsigned int threadId, int begin, int end)
+        {
+            for (int i = begin; i < end; i++)
+            {
+                if (i == static_cast<int>(N))
+                {
+                    costs[N] = costFunction->cost_func_expre_admm(*costWs[threadId], N, xs.col(N), u_NAN_loc, x_track.col(N), cList_bar.col(N), xList_bar.col(N),
+                                                                  u_NAN_loc, thetaList_bar.col(N), rho, R_c);
+                    continue;
+                }
+
+                costs[i]  = costFunction->cost_func_expre_admm(*costWs[threadId], i, xs.col(i), us.col(i), x_track.col(i), cList_bar.col(i), xList_bar.col(i),
+                                                               uList_bar.col(i), thetaList_bar.col(i), rho, R_c);
+                ds.col(i) = forward_integration(xs.col(i), us.col(i), *dynamicsWs[threadId]) - xs.col(i + 1);
+                threadDefectNorm[threadId] += ds.col(i).lpNorm<1>();
+            }
+        });
+
+        dsNorm = accumulate(threadDefectNorm.begin(), threadDefectNorm.end(), 0.0);
+    }
+
+    void doBackwardPass()
+    {
+        diverge = 0;
+
+        g_norm_sum = 0.0;
+        Vx.col(N)  = costFunction->getcx().col(N);
+        Vxx[N]     = costFunction->getcxx()[N];
+        dV.setZero();
+
+        for (int i = N-1; i >= 0; i--) {
+
+            // the value function is expanded around f(x_i, u_i) = x_{i+1} + d_i
+            Vnext = Vx.col(i + 1) + Vxx[i + 1] * defects.col(i);
+
+            riccati.expand(dt, costFunction->getcx().col(i), costFunction->getcu().col(i), costFunction->getcxx()[i], costFunction->getcuu()[i], costFunction->getcux()[i],
+                           dynamicModel->getfxList()[i], dynamicModel->getfuList()[i], Vnext, Vxx[i + 1], Qx, Qu, Qxx, Quu, Qux);
+
+            if (Op.regType == 1)
+            {
+                QuuF = Quu + Op.lambda * commandMat_t::Identity();
+            } else {
+                QuuF = Quu;
+            }
+
+            if (!enableQPBox)
+            {
+                lltOfQuuF.compute(QuuF);
+
+                if (lltOfQuuF.info() == Eigen::NumericalIssue)
+                {
+                    diverge = i + 1; // non-zero at the first knot too
+                    TRACE("Possibly non semi-positive definitie matrix!");
+                    return;
+                }
+
+                k = - lltOfQuuF.solve(Qu);
+                K = - lltOfQuuF.solve(Qux);
+            }
+            else
+            {
+                lb = lowerCommandBounds - uList.col(i);
+                ub = upperCommandBounds - uList.col(i);
+
+                if (boxQP.solve(QuuF, Qu, lb, ub, kList.col(i)) < admm::BoxQP<commandSize>::MaxIterations)
+                {
+                    diverge = i + 1;
+                    TRACE("Box QP failed!");
+                    return;
+                }
+
+                k = boxQP.x();
+                K = - boxQP.solveFree(Qux);
+            }
+
+            dV(0) += k.transpose() * Qu;
+            dV(1) += 0.5 * k.transpose() * Quu * k;
+
+            riccati.value(Qx, Qu, Qxx, Quu, Qux, k, K, Vx.col(i), Vxx[i]);
+
+            kList.col(i) = k;
+            KList[i]     = K;
+
+            g_norm_max = 0.0;
+            for (int j = 0; j < commandSize; j++)
+            {
+                g_norm_i = fabs(kList.col(i)(j)) / (fabs(uList.col(i)(j)) + 1.0);
+                if(g_norm_i > g_norm_max) g_norm_max = g_norm_i;
+            }
+            g_norm_sum += g_norm_max;
+        }
+
+        Op.g_norm = g_norm_sum / (static_cast<double>(Op.n_hor));
+    }
+
+    /* full step of the linearized problem: the feedback law applied along the linear dynamics, which absorb the defects */
+    void doLinearForwardPass()
+    {
+        dxList.col(0).setZero();
+
+        for (unsigned int i = 0; i < N; i++)
+        {
+            duList.col(i)     = kList.col(i) + KList[i] * dxList.col(i);
+            dxList.col(i + 1) = dynamicModel->getfxList()[i] * dxList.col(i) + dynamicModel->getfuList()[i] * duList.col(i) + defects.col(i);
+        }
+    }
+};
+
+} // namespace
+
+#endif // GNMSSOLVER_H
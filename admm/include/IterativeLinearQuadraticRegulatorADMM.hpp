@@ -4,10 +4,16 @@
 #include "config.h"
 #include "robot_dynamics.hpp"
 #include "cost_function_admm.hpp"
+#include "parallel.hpp"
+#include "box_qp.hpp"
+#include "riccati_kernels.hpp"
 
 #include <numeric>
+#include <limits>
 #include <sys/time.h>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <Eigen/StdVector>
@@ -22,11 +28,6 @@ using namespace std;
 using namespace Eigen;
 using Eigen::VectorXd;
 
-#define ENABLE_QPBOX 0
-#define DISABLE_QPBOX 1
-#define ENABLE_FULLDDP 0
-#define DISABLE_FULLDDP 1
-
 #ifndef DEBUG_ILQR
 #define DEBUG_ILQR 1
 #else
@@ -49,6 +50,8 @@ class IterativeLinearQuadraticRegulatorADMM {
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
+    static constexpr bool multipleShooting = false;
+
     struct traj
     {
         stateVecTab_t xList;
@@ -87,9 +90,13 @@ public:
         double print_head; // print headings every print_head lines
         double last_head;
         Eigen::VectorXd alphaList;
+        bool parallelLineSearch; // roll out every alpha concurrently and keep the best accepted one
+        bool warmStart;          // keep lambda, the nominal rollout and the linearization of the previous solve when still valid
+        bool warmStartGains;     // seed the box QP of the first backward pass with the previous feedforward gains
 
         OptSet() : debug_level(2), n_alpha(3), lambdaMin(1e-6), lambdaMax(1e10), lambdaInit(1), dlambdaInit(1), lambdaFactor(1.3), max_iter(500), 
-                    tolGrad(1e-4), tolFun(1e-4), tolConstraint(1e-7), zMin(0.0), regType(1), print(2) {}
+                    tolGrad(1e-4), tolFun(1e-4), tolConstraint(1e-7), zMin(0.0), regType(1), print(2), parallelLineSearch(false), 
+                    warmStart(false), warmStartGains(false) {}
 
     };
 
@@ -98,7 +105,9 @@ private:
     using Dynamics = admm::Dynamics<RobotAbstract, stateSize, commandSize>;
 
     std::shared_ptr<Dynamics> dynamicModel;
+    std::unique_ptr<Dynamics::Workspace> dynamicsWs; // scratch for the rollout, keeps f() off the shared path
     std::shared_ptr<CostFunctionADMM> costFunction;
+    std::unique_ptr<RobotAbstractWorkspace> costWs;
     unsigned int stateNb, commandNb;
 
     unsigned int N;
@@ -108,8 +117,6 @@ private:
     stateVecTab_t xList; // vector/array of stateVec_t = basically knot config over entire time horizon
     commandVecTab_t uList;
 
-    stateVec_t x_dot1, x_dot2, x_dot3, x_dot4;
-
     commandVecTab_t uListFull;
     commandVec_t u_NAN; 
     stateVecTab_t updatedxList;
@@ -124,7 +131,8 @@ private:
     stateVec_t Qx;
     stateMat_t Qxx;
     commandVec_t Qu;
-    commandMat_t Quu, QuuF, QuuInv;
+    commandMat_t Quu, QuuF;
+    Eigen::LLT<commandMat_t> lltOfQuuF; // fixed-size, reused every knot and iteration
     commandR_stateC_t Qux;
     commandVec_t k;
     commandR_stateC_t K;
@@ -134,16 +142,40 @@ private:
 
     int backPassDone, fwdPassDone, initFwdPassDone, diverge;
 
+    /* warm start */
+    bool hasSolved{false};          // lambda and the nominal trajectory were left behind by a previous solve
+    bool linearizationValid{false}; // fxList/fuList of the dynamics belong to the current xList/uList
+    admm::Linearization linearization{admm::Linearization::Euler};  // and were computed in this discretization
+    admm::Integrator integrator{admm::Integrator::RK4};
+
     /* QP variables */
     bool enableQPBox;
     bool enableFullDDP;
     commandMat_t H;
     commandVec_t g;
     commandVec_t lowerCommandBounds, upperCommandBounds, lb, ub;
+    admm::BoxQP<commandSize> boxQP;
 
     Control u_NAN_loc;
 
+    /* parallel line-search: one rollout buffer per alpha, one workspace per thread */
+    struct LineSearchCandidate
+    {
+        StateTrajectory xList;
+        ControlTrajectory uList;
+        costVecTab_t costList;
+        double dcost, expected, z;
+    };
+    std::vector<LineSearchCandidate> lineSearchCandidates;
+    std::vector<std::unique_ptr<Dynamics::Workspace>> lineSearchDynamicsWs;
+    std::vector<std::unique_ptr<RobotAbstractWorkspace>> lineSearchCostWs;
+    admm::ThreadPool lineSearchPool;
+
     OptSet Op;
+
+    // backward-pass kernels, structured if the Jacobian pattern and the discretization of the dynamics allow it. picked in solve
+    admm::RiccatiKernel riccati;
+
     Eigen::Vector2d dV;
     bool debugging_print;    
     int newDeriv;
@@ -166,6 +198,8 @@ public:
     {
         // dynamicModel  = &DynamicModel;
         // costFunction  = &CostFunction;
+        dynamicsWs = dynamicModel->createWorkspace();
+        costWs     = costFunction->createWorkspace();
 
         enableQPBox   = QPBox;
         enableFullDDP = fullDDP;
@@ -173,6 +207,9 @@ public:
         if(enableQPBox) TRACE("Box QP is enabled\n");
         else TRACE("Box QP is disabled\n");
 
+        lowerCommandBounds.setConstant(-std::numeric_limits<double>::infinity());
+        upperCommandBounds.setConstant( std::numeric_limits<double>::infinity());
+
 
         xList.resize(stateSize, N + 1);
         uList.resize(commandSize, N);
@@ -215,8 +252,18 @@ public:
         dV.setZero();
 
         // parameters for line search
-        Op.alphaList.resize(2);
-        Op.alphaList << 1.0, 0.5012;//, 0.2512;//, 0.1259, 0.0631, 0.0316;//, 0.0158, 0.0079, 0.0040, 0.0020, 0.0010;
+        if (Op.parallelLineSearch)
+        {
+            // all candidates cost one rollout's latency, so the full list is affordable
+            Op.alphaList.resize(11);
+            Op.alphaList << 1.0, 0.5012, 0.2512, 0.1259, 0.0631, 0.0316, 0.0158, 0.0079, 0.0040, 0.0020, 0.0010;
+            initializeParallelLineSearch();
+        }
+        else
+        {
+            Op.alphaList.resize(2);
+            Op.alphaList << 1.0, 0.5012;//, 0.2512;//, 0.1259, 0.0631, 0.0316;//, 0.0158, 0.0079, 0.0040, 0.0020, 0.0010;
+        }
 
         debugging_print = 0;
 
@@ -229,10 +276,38 @@ public:
     {
 
         if(Op.debug_level > 0) {TRACE("begin iterative LQR...");}
-        initializeTrajectory(x_0, u_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
 
-        Op.lambda = Op.lambdaInit;
-        Op.dlambda = Op.dlambdaInit;
+        const bool warm = Op.warmStart && hasSolved;
+
+        // setLinearization / setIntegrator may have changed the discretization since the last solve
+        riccati = admm::RiccatiKernel(dynamicModel->getJacobianPattern(), dynamicModel->hasEulerJacobians());
+        if (dynamicModel->getLinearization() != linearization || dynamicModel->getIntegrator() != integrator) linearizationValid = false;
+        const double lambda = Op.lambda, dlambda = Op.dlambda;
+        bool reuseLinearization = false;
+
+        if (warm && x_0 == xList.col(0) && u_0.cols() == uList.cols() && u_0 == uList)
+        {
+            // same nominal trajectory as the last solve (next ADMM iteration): only the augmented Lagrangian terms changed
+            updateNominalCost(x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
+            reuseLinearization = linearizationValid;
+        }
+        else
+        {
+            initializeTrajectory(x_0, u_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
+        }
+
+        if (warm)
+        {
+            Op.lambda  = lambda;
+            Op.dlambda = dlambda;
+        }
+        else
+        {
+            Op.lambda  = Op.lambdaInit;
+            Op.dlambda = Op.dlambdaInit;
+        }
+
+        if (!Op.warmStartGains) kList.setZero();
         
         for (iter = 0; iter < Op.max_iter; iter++)
         {
@@ -252,7 +327,11 @@ public:
 
                 /* ---------------- forwad pass ----------------------- */
                 /* -------------- compute fx, fu ---------------------- */
-                dynamicModel->fx(xList, uListFull);
+                if (!reuseLinearization) dynamicModel->fx(xList, uListFull);
+                reuseLinearization = false;
+                linearizationValid = true;
+                linearization      = dynamicModel->getLinearization();
+                integrator         = dynamicModel->getIntegrator();
                 
                 /* -------------- compute cx, cu, cxx, cuu ------------ */
                 costFunction->computeDerivatives(xList, uListFull, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
@@ -291,9 +370,35 @@ public:
 
             // STEP 3: line-search to find new control sequence, trajectory, cost
             fwdPassDone = 0;
-            if (backPassDone)
+            if (backPassDone && Op.parallelLineSearch)
             {
-                // only implement serial backtracking line-search
+                doParallelForwardPass(x_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
+
+                // among the candidates passing the Armijo test, keep the one with the lowest cost
+                int best = -1;
+                for (int alpha_index = 0; alpha_index < Op.alphaList.size(); alpha_index++)
+                {
+                    const LineSearchCandidate& candidate = lineSearchCandidates[alpha_index];
+                    if (candidate.z > Op.zMin && (best < 0 || candidate.dcost > lineSearchCandidates[best].dcost)) { best = alpha_index; }
+                }
+
+                const int chosen = (best < 0) ? Op.alphaList.size() - 1 : best;
+                Op.dcost    = lineSearchCandidates[chosen].dcost;
+                Op.expected = lineSearchCandidates[chosen].expected;
+
+                if (best >= 0)
+                {
+                    alpha = Op.alphaList[best];
+                    updatedxList.swap(lineSearchCandidates[best].xList);
+                    updateduList.swap(lineSearchCandidates[best].uList);
+                    costListNew.swap(lineSearchCandidates[best].costList);
+                    fwdPassDone = 1;
+                }
+                else alpha = sqrt(-1.0);
+            }
+            else if (backPassDone)
+            {
+                // serial backtracking line-search
                 for (int alpha_index = 0; alpha_index < Op.alphaList.size(); alpha_index++)
                 {
                     alpha = Op.alphaList[alpha_index];
@@ -302,15 +407,7 @@ public:
                     Op.dcost = accumulate(costList.begin(), costList.end(), 0.0) - accumulate(costListNew.begin(), costListNew.end(), 0.0);
                     Op.expected = -alpha*(dV(0) + alpha*dV(1));
 
-                    double z;
-                    if (Op.expected > 0) {
-                        z = Op.dcost / Op.expected;
-                    } else {
-                        z = static_cast<double>(-signbit(Op.dcost)); // [TODO:doublecheck]
-                        TRACE("non-positive expected reduction: should not occur \n"); 
-                    }
-
-                    if(z > Op.zMin) { 
+                    if(reductionRatio(Op.dcost, Op.expected) > Op.zMin) { 
                         fwdPassDone = 1;
                         break;
                     }
@@ -342,6 +439,7 @@ public:
                 uList = updateduList;
                 costList = costListNew;
                 newDeriv = 1;
+                linearizationValid = false;
 
                 // TODO: add constraint tolerance check
                 if(Op.dcost < Op.tolFun) 
@@ -377,6 +475,7 @@ public:
         }
 
         Op.iterations = iter;
+        hasSolved     = true;
 
         if(!backPassDone) {
             if(Op.debug_level >= 1)
@@ -407,12 +506,10 @@ public:
 
         for (int i = 0; i < N; i++) 
         {
-            costList[i]             = costFunction->cost_func_expre_admm(i, updatedxList.col(i), u_0.col(i), x_track.col(i), cList_bar.col(i), xList_bar.col(i), uList_bar.col(i), thetaList_bar.col(i), rho, R_c);
-            updatedxList.col(i + 1) = forward_integration(updatedxList.col(i), u_0.col(i));
+            updatedxList.col(i + 1) = forward_integration(updatedxList.col(i), u_0.col(i), *dynamicsWs);
         }
 
-
-        costList[N]  = costFunction->cost_func_expre_admm(N, updatedxList.col(N), u_NAN_loc, x_track.col(N), cList_bar.col(N), xList_bar.col(N), u_NAN_loc, thetaList_bar.col(N), rho, R_c);
+        costFunction->cost_func_expre_admm(updatedxList, u_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, costList);
 
 
         /* simplistic divergence test, check for the last time step if it has diverged. */
@@ -427,6 +524,7 @@ public:
         
         initFwdPassDone = 1;
         xList = updatedxList;
+        linearizationValid = false;
 
         newDeriv      = 1; 
         Op.lambda     = Op.lambdaInit;
@@ -454,16 +552,54 @@ public:
         return KList;
     }
 
+    /* control limits enforced by the box QP of the backward pass, unbounded by default */
+    void setControlLimits(const commandVec_t& lower, const commandVec_t& upper)
+    {
+        lowerCommandBounds = lower;
+        upperCommandBounds = upper;
+    }
+
 
 private:
-    inline State forward_integration(const State& x, const Control& u)
+    inline State forward_integration(const State& x, const Control& u, Dynamics::Workspace& ws) const
     {
-        x_dot1 = dynamicModel->f(x, u);
-        x_dot2 = dynamicModel->f(x + 0.5 * dt * x_dot1, u);
-        x_dot3 = dynamicModel->f(x + 0.5 * dt * x_dot2, u);
-        x_dot4 = dynamicModel->f(x + dt * x_dot3, u);
+        // RK4 unless the dynamics provide their own step, e.g. the generated one
+        return dynamicModel->step(x, u, ws);
+    }
+
+    /* ratio of the actual to the expected cost reduction (Armijo test) */
+    inline double reductionRatio(double dcost, double expected) const
+    {
+        if (expected > 0) {
+            return dcost / expected;
+        }
 
-        return x + (dt/6) * (x_dot1 + 2 * x_dot2 + 2 * x_dot3 + x_dot4);
+        TRACE("non-positive expected reduction: should not occur \n");
+        return static_cast<double>(-signbit(dcost)); // [TODO:doublecheck]
+    }
+
+    void initializeParallelLineSearch()
+    {
+        const unsigned int n_alpha = Op.alphaList.size();
+        const unsigned int threads = std::max(1u, std::min(n_alpha, std::thread::hardware_concurrency()));
+
+        lineSearchPool.resize(threads);
+        lineSearchCandidates.resize(n_alpha);
+
+        for (auto& candidate : lineSearchCandidates)
+        {
+            candidate.xList.setZero(stateSize, N + 1);
+            candidate.uList.setZero(commandSize, N);
+            candidate.costList.assign(N + 1, 0.0);
+        }
+
+        lineSearchDynamicsWs.clear();
+        lineSearchCostWs.clear();
+        for (unsigned int t = 0; t < threads; t++)
+        {
+            lineSearchDynamicsWs.push_back(dynamicModel->createWorkspace());
+            lineSearchCostWs.push_back(costFunction->createWorkspace());
+        }
     }
 
     void doBackwardPass()
@@ -483,11 +619,8 @@ private:
 
         for (int i = N-1; i >= 0; i--) {
 
-            Qx  = costFunction->getcx().col(i)  + dynamicModel->getfxList()[i].transpose() *  Vx.col(i + 1);
-            Qu  = costFunction->getcu().col(i)  + dynamicModel->getfuList()[i].transpose() *  Vx.col(i + 1);
-            Qxx = costFunction->getcxx()[i]     + dynamicModel->getfxList()[i].transpose() * Vxx[i + 1]  * dynamicModel->getfxList()[i];
-            Quu = costFunction->getcuu()[i]     + dynamicModel->getfuList()[i].transpose() * Vxx[i + 1]  * dynamicModel->getfuList()[i];
-            Qux = costFunction->getcux()[i]     + dynamicModel->getfuList()[i].transpose() * Vxx[i + 1]  * dynamicModel->getfxList()[i];
+            riccati.expand(dt, costFunction->getcx().col(i), costFunction->getcu().col(i), costFunction->getcxx()[i], costFunction->getcuu()[i], costFunction->getcux()[i],
+                           dynamicModel->getfxList()[i], dynamicModel->getfuList()[i], Vx.col(i + 1), Vxx[i + 1], Qx, Qu, Qxx, Quu, Qux);
 
             if (Op.regType == 1) 
             {
@@ -496,27 +629,11 @@ private:
                 QuuF = Quu;
             }
             
-            QuuInv = QuuF.inverse();
-
-            if (!isPositiveDefinite(Quu)) {
-                // To be Implemented : Regularization (is Quu definite positive ?)
-                TRACE("Quu is not positive definite ");
-                if (Op.lambda==0.0) {
-                    Op.lambda += 1e-4;
-                } else {   
-                    Op.lambda *= 10;
-                }
-                backPassDone = 0;
-                break;
-            }
-
             if (!enableQPBox)
             {
-                // Cholesky decomposition by using upper triangular matrix
-                Eigen::LLT<MatrixXd> lltOfQuuF(QuuF);
-                Eigen::MatrixXd L = lltOfQuuF.matrixU(); 
-                // assume QuuF is positive definite
-                
+                // a single Cholesky factorization of the regularized Quu gives both k and K
+                lltOfQuuF.compute(QuuF);
+
                 // A temporary solution: check the non-PD case. TODO: double check here.
                 if (lltOfQuuF.info() == Eigen::NumericalIssue)
                 {
@@ -525,9 +642,26 @@ private:
                     return;
                 }
 
-                Eigen::MatrixXd L_inverse = L.inverse();
-                k = - L_inverse * L.transpose().inverse() * Qu;
-                K = - L_inverse * L.transpose().inverse() * Qux;
+                k = - lltOfQuuF.solve(Qu);
+                K = - lltOfQuuF.solve(Qux);
+            }
+            else
+            {
+                // control-limited DDP: k from the box QP on the control deviation, K only acts on the free controls
+                lb = lowerCommandBounds - uList.col(i);
+                ub = upperCommandBounds - uList.col(i);
+
+                const auto result = boxQP.solve(QuuF, Qu, lb, ub, kList.col(i));
+
+                if (result < admm::BoxQP<commandSize>::MaxIterations)
+                {
+                    diverge = i;
+                    TRACE("Box QP failed!");
+                    return;
+                }
+
+                k = boxQP.x();
+                K = - boxQP.solveFree(Qux);
             }
 
             // update cost-to-go approximation
@@ -535,9 +669,7 @@ private:
 
             dV(1) += 0.5 * k.transpose() * Quu * k;
 
-            Vx.col(i)    = Qx  + K.transpose() * Quu * k + K.transpose() * Qu  + Qux.transpose() * k;
-            Vxx[i]       = Qxx + K.transpose() * Quu * K + K.transpose() * Qux + Qux.transpose() * K;
-            Vxx[i]       = 0.5 * (Vxx[i] + Vxx[i].transpose());
+            riccati.value(Qx, Qu, Qxx, Quu, Qux, k, K, Vx.col(i), Vxx[i]);
 
             kList.col(i) = k;
             KList[i]     = K;
@@ -559,32 +691,63 @@ private:
     void doForwardPass(const stateVec_t& x_0, const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar, const stateVecTab_t& xList_bar, const commandVecTab_t& uList_bar, 
         const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
     {
-        updatedxList.col(0) = x_0;
+        rollout(alpha, x_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, updatedxList, updateduList, costListNew, *dynamicsWs, *costWs);
+    }
 
-        for (unsigned int i = 0; i < N; i++) 
+    /* roll out every alpha of the line-search at once, each into its own candidate buffers */
+    void doParallelForwardPass(const stateVec_t& x_0, const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar, const stateVecTab_t& xList_bar, const commandVecTab_t& uList_bar, 
+        const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
+    {
+        const double cost = accumulate(costList.begin(), costList.end(), 0.0);
+
+        lineSearchPool.parallel_for(Op.alphaList.size(), [&](unsigned int threadId, int begin, int end)
         {
-            updateduList.col(i)     = uList.col(i) + alpha * kList.col(i) + KList[i] * (updatedxList.col(i) - xList.col(i));
-            costListNew[i]          = costFunction->cost_func_expre_admm(i, updatedxList.col(i), updateduList.col(i), x_track.col(i), 
-                                                                            cList_bar.col(i), xList_bar.col(i), uList_bar.col(i), thetaList_bar.col(i), rho, R_c);
-            updatedxList.col(i + 1) = forward_integration(updatedxList.col(i), updateduList.col(i));
+            for (int alpha_index = begin; alpha_index < end; alpha_index++)
+            {
+                const double a = Op.alphaList[alpha_index];
+                LineSearchCandidate& candidate = lineSearchCandidates[alpha_index];
 
-        }
+                rollout(a, x_0, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, candidate.xList, candidate.uList, candidate.costList, 
+                        *lineSearchDynamicsWs[threadId], *lineSearchCostWs[threadId]);
 
-        costListNew[N] = costFunction->cost_func_expre_admm(N, updatedxList.col(N), u_NAN_loc, x_track.col(N), cList_bar.col(N), xList_bar.col(N), uList_bar.col(N-1), thetaList_bar.col(N-1), rho, R_c);
+                candidate.dcost    = cost - accumulate(candidate.costList.begin(), candidate.costList.end(), 0.0);
+                candidate.expected = -a*(dV(0) + a*dV(1));
+                candidate.z        = reductionRatio(candidate.dcost, candidate.expected);
+            }
+        });
     }
 
-    inline bool isPositiveDefinite(const ControlHessian& Quu_p)
+    /* apply the feedback policy with step size a. Only touches the given buffers and workspaces, so rollouts can run concurrently */
+    void rollout(double a, const stateVec_t& x_0, const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar, const stateVecTab_t& xList_bar, const commandVecTab_t& uList_bar, 
+        const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c,
+        StateTrajectory& xNew, ControlTrajectory& uNew, costVecTab_t& costNew, Dynamics::Workspace& dynWs, RobotAbstractWorkspace& robotWs) const
     {
+        xNew.col(0) = x_0;
 
-        Eigen::LLT<Eigen::MatrixXd> lltOfA(Quu_p); // compute the Cholesky decomposition of A
-        if(lltOfA.info() == Eigen::NumericalIssue)
+        for (unsigned int i = 0; i < N; i++) 
         {
-            // throw std::runtime_error("Possibly non semi-positive definitie matrix!");
-            TRACE("Matrix is not PSD");
-            return false;
-        }  
+            uNew.col(i)     = uList.col(i) + a * kList.col(i) + KList[i] * (xNew.col(i) - xList.col(i));
+            if (enableQPBox) uNew.col(i) = uNew.col(i).cwiseMax(lowerCommandBounds).cwiseMin(upperCommandBounds);
+            costNew[i]      = costFunction->cost_func_expre_admm(robotWs, i, xNew.col(i), uNew.col(i), x_track.col(i), 
+                                                                    cList_bar.col(i), xList_bar.col(i), uList_bar.col(i), thetaList_bar.col(i), rho, R_c);
+            xNew.col(i + 1) = forward_integration(xNew.col(i), uNew.col(i), dynWs);
+        }
+
+        costNew[N] = costFunction->cost_func_expre_admm(robotWs, N, xNew.col(N), u_NAN_loc, x_track.col(N), cList_bar.col(N), xList_bar.col(N), uList_bar.col(N-1), thetaList_bar.col(N-1), rho, R_c);
+    }
 
-        return true;
+    /* re-evaluate the cost of the current nominal trajectory without rolling it out again */
+    void updateNominalCost(const stateVecTab_t &x_track, const Eigen::MatrixXd& cList_bar, const StateTrajectory& xList_bar, const ControlTrajectory& uList_bar, 
+        const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
+    {
+        // the nominal states are unchanged, so are their cached kinematics (already up to date if the ADMM blocks refreshed them)
+        costFunction->cost_func_expre_admm(xList, uList, x_track, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c, costList);
+
+        newDeriv      = 1;
+        Op.dcost      = 0;
+        Op.expected   = 0;
+        Op.print_head = 6;
+        Op.last_head  = Op.print_head;
     }
 };
 
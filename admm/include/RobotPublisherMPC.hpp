@@ -7,6 +7,7 @@
 #include <iostream>
 #include <thread>       
 #include <math.h>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 
@@ -52,6 +53,7 @@ public:
 
     // storing variable
     std::shared_ptr<Plant> m_robotPlant{};
+    std::unique_ptr<typename Plant::DynamicsModel::Workspace> m_predictWs{}; // prediction runs next to the plant thread
 
     commandVec_t u_scratch;
     stateVec_t  x_scratch;
@@ -89,6 +91,8 @@ public:
 
         for (auto& it : StateGainsK) {it.setZero();}
         stateTrajectory.resize(StateSize, N_commands + 1); stateTrajectory.setZero();
+
+        m_predictWs = m_robotPlant->m_plantDynamics->createWorkspace();
     }
     virtual ~RobotPublisherMPC() = default;
 
@@ -118,19 +122,14 @@ public:
       return isTerminate();
     }
 
-    // predicts the future state by simulating the dynamics
+    // predicts the future state by simulating the dynamics, with the integrator the plant and the solvers step with
     const State& predictState(const State& currState, const ControlTrajectory& controlSequence, int time_steps_ahead) 
     {
       predictedState = currState;
 
       for (int i=0;i < time_steps_ahead;i++)
       {
-        State f1 = m_robotPlant->m_plantDynamics->f(currState, controlSequence.col(i));
-        State f2 = m_robotPlant->m_plantDynamics->f(currState + 0.5 * dt * f1, controlSequence.col(i));
-        State f3 = m_robotPlant->m_plantDynamics->f(currState + 0.5 * dt * f2, controlSequence.col(i));
-        State f4 = m_robotPlant->m_plantDynamics->f(currState + dt * f3, controlSequence.col(i));
-
-        predictedState = predictedState + (dt/6) * (f1 + 2 * f2 + 2 * f3 + f4);
+        predictedState = m_robotPlant->m_plantDynamics->step(predictedState, controlSequence.col(i), *m_predictWs);
       }
 
       return predictedState;
@@ -14,6 +14,15 @@
   };
 
 
+  // penalty (rho) adaptation between ADMM iterations
+  enum class RhoUpdate 
+  {
+    Fixed,              // keep the rho passed to solve
+    ResidualBalancing,  // scale rho by tau when one residual exceeds the other by mu (Boyd et al. 2011)
+    Spectral            // Barzilai-Borwein estimate of the block curvatures (Xu et al. 2017)
+  };
+
+
   // data structure for admm options
   struct ADMMopt {
     ADMMopt() = default;
@@ -25,6 +34,19 @@
     unsigned int iterMax; // DDP iteration max
     int ADMMiterMax;
 
+    // stopping criterion on the horizon-wide primal and dual residuals, zero tolerances run all ADMMiterMax iterations
+    double absTol = 1e-4;
+    double relTol = 1e-3;
+
+    // penalty adaptation
+    RhoUpdate rhoUpdate = RhoUpdate::Fixed;
+    unsigned int rhoInterval = 2;  // iterations between two updates
+    double rhoBalance = 10;        // mu, residual balancing
+    double rhoScale = 2;           // tau, residual balancing
+    double rhoCorrelation = 0.2;   // minimum secant correlation, spectral
+    double rhoMin = 1e-6;
+    double rhoMax = 1e6;
+
   };
 
 
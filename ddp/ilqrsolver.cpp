@@ -18,6 +18,7 @@ ILQRSolver::ILQRSolver(RobotDynamics& iiwaDynamicModel, CostFunction& iiwaCostFu
 
     dynamicModel  = &iiwaDynamicModel;
     costFunction  = &iiwaCostFunction;
+    dynamicsWs    = dynamicModel->createWorkspace();
 
     enableQPBox   = QPBox;
     enableFullDDP = fullDDP;
@@ -25,6 +26,9 @@ ILQRSolver::ILQRSolver(RobotDynamics& iiwaDynamicModel, CostFunction& iiwaCostFu
     if(enableQPBox) TRACE("Box QP is enabled\n");
     else TRACE("Box QP is disabled\n");
 
+    lowerCommandBounds.setConstant(-std::numeric_limits<double>::infinity());
+    upperCommandBounds.setConstant( std::numeric_limits<double>::infinity());
+
     if(enableFullDDP) TRACE("Full DDP is enabled\n");
     else TRACE("Full DDP is disabled\n");
 
@@ -79,6 +83,8 @@ ILQRSolver::ILQRSolver(RobotDynamics& iiwaDynamicModel, CostFunction& iiwaCostFu
     Op.alphaList.resize(11);
     Op.alphaList << 1.0, 0.5012, 0.2512, 0.1259, 0.0631, 0.0316, 0.0158, 0.0079, 0.0040, 0.0020, 0.0010;
 
+    if (Op.parallelLineSearch) initializeParallelLineSearch();
+
     debugging_print = 0;
 
 
@@ -179,26 +185,41 @@ void ILQRSolver::solve(const stateVec_t& x_0, const commandVecTab_t& u_0, const
         fwdPassDone = 0;
         if (backPassDone) {
             gettimeofday(&tbegin_time_fwd,NULL);
-            //only implement serial backtracking line-search
-            for (int alpha_index = 0; alpha_index < Op.alphaList.size(); alpha_index++) {
-
-                alpha = Op.alphaList[alpha_index];
-                doForwardPass(x_0, xtrack);
-                Op.dcost = accumulate(costList.begin(), costList.end(), 0.0) - accumulate(costListNew.begin(), costListNew.end(), 0.0);
-                Op.expected = -alpha*(dV(0) + alpha*dV(1));
 
+            if (Op.parallelLineSearch) {
+                doParallelForwardPass(x_0, xtrack);
 
-                double z;
-                if (Op.expected > 0) {
-                    z = Op.dcost / Op.expected;
-                } else {
-                    z = static_cast<double>(-signbit(Op.dcost)); //[TODO:doublecheck]
-                    TRACE("non-positive expected reduction: should not occur \n"); //warning
+                // among the candidates passing the Armijo test, keep the one with the lowest cost
+                int best = -1;
+                for (int alpha_index = 0; alpha_index < Op.alphaList.size(); alpha_index++) {
+                    const LineSearchCandidate& candidate = lineSearchCandidates[alpha_index];
+                    if (candidate.z > Op.zMin && (best < 0 || candidate.dcost > lineSearchCandidates[best].dcost)) { best = alpha_index; }
                 }
 
-                if(z > Op.zMin) { 
+                const int chosen = (best < 0) ? Op.alphaList.size() - 1 : best;
+                Op.dcost    = lineSearchCandidates[chosen].dcost;
+                Op.expected = lineSearchCandidates[chosen].expected;
+
+                if (best >= 0) {
+                    alpha = Op.alphaList[best];
+                    updatedxList.swap(lineSearchCandidates[best].xList);
+                    updateduList.swap(lineSearchCandidates[best].uList);
+                    costListNew.swap(lineSearchCandidates[best].costList);
                     fwdPassDone = 1;
-                    break;
+                }
+            } else {
+                // serial backtracking line-search
+                for (int alpha_index = 0; alpha_index < Op.alphaList.size(); alpha_index++) {
+
+                    alpha = Op.alphaList[alpha_index];
+                    doForwardPass(x_0, xtrack);
+                    Op.dcost = accumulate(costList.begin(), costList.end(), 0.0) - accumulate(costListNew.begin(), costListNew.end(), 0.0);
+                    Op.expected = -alpha*(dV(0) + alpha*dV(1));
+
+                    if(reductionRatio(Op.dcost, Op.expected) > Op.zMin) { 
+                        fwdPassDone = 1;
+                        break;
+                    }
                 }
             }
             if(!fwdPassDone) alpha = sqrt(-1.0);
@@ -307,7 +328,7 @@ void ILQRSolver::initializeTraj(const stateVec_t& x_0, const commandVecTab_t& u_
     for (unsigned int i = 0; i < N; i++) {
         updateduList.col(i)     = uList.col(i);
         costList[i]             = costFunction->cost_func_expre(i, updatedxList.col(i), updateduList.col(i), x_track.col(i));
-        updatedxList.col(i + 1) = forward_integration(updatedxList.col(i), updateduList.col(i));
+        updatedxList.col(i + 1) = forward_integration(updatedxList.col(i), updateduList.col(i), *dynamicsWs);
 
     }
     // getting final cost, state, input=NaN
@@ -351,40 +372,90 @@ void ILQRSolver::initializeTraj(const stateVec_t& x_0, const commandVecTab_t& u_
  */
 void ILQRSolver::doForwardPass(const stateVec_t& x_0, const stateVecTab_t &x_track)
 {
+    isUNan = 0;
+
+    rollout(alpha, x_0, x_track, updatedxList, updateduList, costListNew, *dynamicsWs);
+}
+
+/* roll out every alpha of the line-search at once, each into its own candidate buffers */
+void ILQRSolver::doParallelForwardPass(const stateVec_t& x_0, const stateVecTab_t &x_track)
+{
+    isUNan = 0;
 
-    updatedxList.col(0) = x_0;
+    const double cost = accumulate(costList.begin(), costList.end(), 0.0);
+
+    lineSearchPool.parallel_for(Op.alphaList.size(), [&](unsigned int threadId, int begin, int end)
+    {
+        for (int alpha_index = begin; alpha_index < end; alpha_index++)
+        {
+            const double a = Op.alphaList[alpha_index];
+            LineSearchCandidate& candidate = lineSearchCandidates[alpha_index];
+
+            rollout(a, x_0, x_track, candidate.xList, candidate.uList, candidate.costList, *lineSearchDynamicsWs[threadId]);
+
+            candidate.dcost    = cost - accumulate(candidate.costList.begin(), candidate.costList.end(), 0.0);
+            candidate.expected = -a*(dV(0) + a*dV(1));
+            candidate.z        = reductionRatio(candidate.dcost, candidate.expected);
+        }
+    });
+}
+
+/* apply the feedback policy with step size a. Only touches the given buffers and workspace, so rollouts can run concurrently */
+void ILQRSolver::rollout(double a, const stateVec_t& x_0, const stateVecTab_t &x_track, stateVecTab_t& xNew, commandVecTab_t& uNew, costVecTab_t& costNew, RobotDynamics::Workspace& ws)
+{
+    xNew.col(0) = x_0;
 
     commandVec_t u_NAN_loc;
     u_NAN_loc(0) = sqrt(-1.0);
 
-    isUNan = 0;
-
     for (unsigned int i = 0; i < N; i++) 
     {
-        updateduList.col(i)     = uList.col(i) + alpha * kList.col(i) + KList[i] * (updatedxList.col(i) - xList.col(i));
-        costListNew[i]          = costFunction->cost_func_expre(i, updatedxList.col(i), updateduList.col(i), x_track.col(i));
-        updatedxList.col(i + 1) = forward_integration(updatedxList.col(i), updateduList.col(i));
+        uNew.col(i)     = uList.col(i) + a * kList.col(i) + KList[i] * (xNew.col(i) - xList.col(i));
+        if (enableQPBox) uNew.col(i) = uNew.col(i).cwiseMax(lowerCommandBounds).cwiseMin(upperCommandBounds);
+        costNew[i]      = costFunction->cost_func_expre(i, xNew.col(i), uNew.col(i), x_track.col(i));
+        xNew.col(i + 1) = forward_integration(xNew.col(i), uNew.col(i), ws);
     }
 
-    costListNew[N] = costFunction->cost_func_expre(N, updatedxList.col(N), u_NAN_loc, x_track.col(N));
+    costNew[N] = costFunction->cost_func_expre(N, xNew.col(N), u_NAN_loc, x_track.col(N));
 }
 
-/* 4th-order Runge-Kutta step */
-inline stateVec_t ILQRSolver::forward_integration(const stateVec_t& x, const commandVec_t& u)
+void ILQRSolver::initializeParallelLineSearch()
 {
-    // if(debugging_print) TRACE_KUKA_ARM("update: 4th-order Runge-Kutta step\n");
+    const unsigned int n_alpha = Op.alphaList.size();
+    const unsigned int threads = std::max(1u, std::min(n_alpha, std::thread::hardware_concurrency()));
+
+    lineSearchPool.resize(threads);
+    lineSearchCandidates.resize(n_alpha);
 
-    // gettimeofday(&tbegin_period4, NULL);
+    for (auto& candidate : lineSearchCandidates)
+    {
+        candidate.xList.setZero(stateSize, N + 1);
+        candidate.uList.setZero(commandSize, N);
+        candidate.costList.assign(N + 1, 0.0);
+    }
+
+    lineSearchDynamicsWs.clear();
+    for (unsigned int t = 0; t < threads; t++)
+    {
+        lineSearchDynamicsWs.push_back(dynamicModel->createWorkspace());
+    }
+}
 
-    stateVec_t x_dot1 = dynamicModel->f(x, u);
-    stateVec_t x_dot2 = dynamicModel->f(x + 0.5 * dt * x_dot1, u);
-    stateVec_t x_dot3 = dynamicModel->f(x + 0.5 * dt * x_dot2, u);
-    stateVec_t x_dot4 = dynamicModel->f(x + dt * x_dot3, u);
+/* ratio of the actual to the expected cost reduction (Armijo test) */
+double ILQRSolver::reductionRatio(double dcost, double expected) const
+{
+    if (expected > 0) {
+        return dcost / expected;
+    }
 
-    stateVec_t x_new;
-    x_new = x + (dt/6) * (x_dot1 + 2 * x_dot2 + 2 * x_dot3 + x_dot4);
+    TRACE("non-positive expected reduction: should not occur \n"); //warning
+    return static_cast<double>(-signbit(dcost)); //[TODO:doublecheck]
+}
 
-    return x_new;
+/* one integration step of the dynamics, 4th-order Runge-Kutta unless the model provides its own */
+inline stateVec_t ILQRSolver::forward_integration(const stateVec_t& x, const commandVec_t& u, RobotDynamics::Workspace& ws)
+{
+    return dynamicModel->step(x, u, ws);
 }
 
 void ILQRSolver::doBackwardPass()
@@ -441,27 +512,6 @@ void ILQRSolver::doBackwardPass()
             break;
         }
 
-        // if(enableQPBox)
-        // {
-        //     //TRACE("Use Box QP");
-        //     nWSR = 10; //[to be checked]
-        //     H = Quu;
-        //     g = Qu;
-        //     lb = lowerCommandBounds - uList[i];
-        //     ub = upperCommandBounds - uList[i];
-        //     qp->init(H.data(),g.data(),lb.data(),ub.data(),nWSR);
-        //     qp->getPrimalSolution(xOpt);
-        //     k = Map<commandVec_t>(xOpt);
-        //     K = -QuuInv*Qux;
-        //     for(unsigned int i_cmd=0;i_cmd<commandNb;i_cmd++)
-        //     {
-        //         if((k[i_cmd] == lowerCommandBounds[i_cmd]) | (k[i_cmd] == upperCommandBounds[i_cmd]))
-        //         {
-        //             K.row(i_cmd).setZero();
-        //         }
-        //     }
-        // }
-
         if (!enableQPBox)
         {
             // Cholesky decomposition by using upper triangular matrix
@@ -481,6 +531,26 @@ void ILQRSolver::doBackwardPass()
             k = - L_inverse * L.transpose().inverse() * Qu;
             K = - L_inverse * L.transpose().inverse() * Qux;
         }
+        else
+        {
+            // control-limited DDP: k from the box QP on the control deviation, K only acts on the free controls
+            H  = QuuF;
+            g  = Qu;
+            lb = lowerCommandBounds - uList.col(i);
+            ub = upperCommandBounds - uList.col(i);
+
+            const auto result = boxQP.solve(H, g, lb, ub, kList.col(i));
+
+            if (result < admm::BoxQP<commandSize>::MaxIterations)
+            {
+                diverge = i;
+                TRACE("Box QP failed!");
+                return;
+            }
+
+            k = boxQP.x();
+            K = - boxQP.solveFree(Qux);
+        }
 
         // update cost-to-go approximation
         dV(0) += k.transpose() * Qu;
@@ -522,6 +592,13 @@ ILQRSolver::traj ILQRSolver::getLastSolvedTrajectory()
     return lastTraj;
 }
 
+/* control limits enforced by the box QP of the backward pass, unbounded by default */
+void ILQRSolver::setControlLimits(const commandVec_t& lower, const commandVec_t& upper)
+{
+    lowerCommandBounds = lower;
+    upperCommandBounds = upper;
+}
+
 bool ILQRSolver::isPositiveDefinite(const commandMat_t & Quu_p)
 {
     //Eigen::JacobiSVD<commandMat_t> svd_Quu (Quu, ComputeThinU | ComputeThinV);
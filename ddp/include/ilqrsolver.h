@@ -6,20 +6,20 @@
 #include "config.h"
 #include "robot_dynamics.hpp"
 #include "CostFunction.hpp"
+#include "parallel.hpp"
+#include "box_qp.hpp"
 
 
 #include <numeric>
+#include <limits>
 #include <sys/time.h>
+#include <memory>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <Eigen/StdVector>
 #include <Eigen/Cholesky>
 
-#define ENABLE_QPBOX 0
-#define DISABLE_QPBOX 1
-#define ENABLE_FULLDDP 0
-#define DISABLE_FULLDDP 1
-
 #ifndef DEBUG_ILQR
 #define DEBUG_ILQR 1
 #else
@@ -78,15 +78,17 @@ public:
         double last_head;
         Eigen::VectorXd time_backward, time_forward, time_derivative;
         Eigen::VectorXd alphaList;
+        bool parallelLineSearch; // roll out every alpha concurrently and keep the best accepted one
 
         OptSet() : debug_level(2), n_alpha(11), lambdaMin(1e-6), lambdaMax(1e10), lambdaInit(1), dlambdaInit(1), lambdaFactor(1.6), max_iter(500), 
-                    tolGrad(1e-4), tolFun(1e-4), tolConstraint(1e-7), zMin(0.0), regType(1), print(2) {}
+                    tolGrad(1e-4), tolFun(1e-4), tolConstraint(1e-7), zMin(0.0), regType(1), print(2), parallelLineSearch(false) {}
 
     };
 
 
 private:
     RobotDynamics* dynamicModel;
+    std::unique_ptr<RobotDynamics::Workspace> dynamicsWs;
     CostFunction* costFunction;
     unsigned int stateNb;
     unsigned int commandNb;
@@ -140,7 +142,7 @@ private:
     commandVec_t upperCommandBounds;
     commandVec_t lb;
     commandVec_t ub;
-    //real_t* xOpt;
+    admm::BoxQP<commandSize> boxQP;
 
     OptSet Op;
     Eigen::Vector2d dV;
@@ -149,16 +151,33 @@ private:
     double g_norm_i, g_norm_max, g_norm_sum;
     bool isUNan;
 
+    /* parallel line-search: one rollout buffer per alpha, one dynamics workspace per thread */
+    struct LineSearchCandidate
+    {
+        stateVecTab_t xList;
+        commandVecTab_t uList;
+        costVecTab_t costList;
+        double dcost, expected, z;
+    };
+    std::vector<LineSearchCandidate> lineSearchCandidates;
+    std::vector<std::unique_ptr<RobotDynamics::Workspace>> lineSearchDynamicsWs;
+    admm::ThreadPool lineSearchPool;
+
 public:
     ILQRSolver(RobotDynamics& DynamicModel, CostFunction& Cost, const OptSet& solverOptions, const int& time_steps, const double& dt_, bool fullDDP, bool QPBox);
     void solve(const stateVec_t& x_0, const commandVecTab_t& u_0, const stateVecTab_t &x_track);
     void initializeTraj(const stateVec_t& x_0, const commandVecTab_t& u_0, const stateVecTab_t &x_track);
     struct traj getLastSolvedTrajectory();
+    void setControlLimits(const commandVec_t& lower, const commandVec_t& upper);
 
 private:
-    inline stateVec_t forward_integration(const stateVec_t& X, const commandVec_t& U);
+    inline stateVec_t forward_integration(const stateVec_t& X, const commandVec_t& U, RobotDynamics::Workspace& ws);
     void doBackwardPass();
     void doForwardPass(const stateVec_t& x_0, const stateVecTab_t &x_track);
+    void doParallelForwardPass(const stateVec_t& x_0, const stateVecTab_t &x_track);
+    void rollout(double a, const stateVec_t& x_0, const stateVecTab_t &x_track, stateVecTab_t& xNew, commandVecTab_t& uNew, costVecTab_t& costNew, RobotDynamics::Workspace& ws);
+    void initializeParallelLineSearch();
+    double reductionRatio(double dcost, double expected) const;
     bool isPositiveDefinite(const commandMat_t & Quu); 
 };
 
@@ -2,10 +2,20 @@
 #define ROBOT_ABSTRACT_H
 
 #include <Eigen/Dense>
+#include <memory>
+#include <mutex>
+
+#include "rigid_body_chain.hpp"
 
 // structure for the active robot 
 struct RobotAbstractInternalData {};
 
+// caller owned scratch for the reentrant interface. one per thread evaluating the model
+struct RobotAbstractWorkspace 
+{
+	virtual ~RobotAbstractWorkspace() {}
+};
+
 // abstract class for a serial robot 
 class RobotAbstract
 {	
@@ -28,5 +38,80 @@ public:
 	virtual void getSpatialJacobianDot(double* q, double* qd, Eigen::MatrixXd& jacobianDot) {};
 	virtual void setJointTorque(Eigen::VectorXd, Eigen::VectorXd) {};
 	void ik();
+
+	/* 
+	 * Reentrant interface. All the mutable state lives in the workspace, so calls with distinct workspaces can run concurrently.
+	 * Models that do not provide their own workspace fall back to the interface above under a lock.
+	 */
+	virtual std::unique_ptr<RobotAbstractWorkspace> createWorkspace() { return std::unique_ptr<RobotAbstractWorkspace>(new RobotAbstractWorkspace()); }
+
+	virtual void getForwardKinematics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const double* qdd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther)
+	{
+		std::lock_guard<std::mutex> lk(m_fallbackMutex);
+		getForwardKinematics(const_cast<double*>(q), const_cast<double*>(qd), const_cast<double*>(qdd), poseM, poseP, vel, accel, computeOther);
+	}
+
+	virtual void getForwardDynamics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const Eigen::Ref<const Eigen::VectorXd>& force_ext, Eigen::Ref<Eigen::VectorXd> qdd)
+	{
+		std::lock_guard<std::mutex> lk(m_fallbackMutex);
+		Eigen::VectorXd qdd_(qdd.size());
+		getForwardDynamics(const_cast<double*>(q), const_cast<double*>(qd), force_ext, qdd_);
+		qdd = qdd_;
+	}
+
+	virtual void getSpatialJacobian(RobotAbstractWorkspace& ws, const double* q, Eigen::Ref<Eigen::MatrixXd> jacobian)
+	{
+		std::lock_guard<std::mutex> lk(m_fallbackMutex);
+		Eigen::MatrixXd jacobian_(jacobian.rows(), jacobian.cols());
+		getSpatialJacobian(const_cast<double*>(q), jacobian_);
+		jacobian = jacobian_;
+	}
+
+	virtual void getSpatialJacobianDot(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> jacobianDot)
+	{
+		std::lock_guard<std::mutex> lk(m_fallbackMutex);
+		Eigen::MatrixXd jacobianDot_ = Eigen::MatrixXd::Zero(jacobianDot.rows(), jacobianDot.cols());
+		getSpatialJacobianDot(const_cast<double*>(q), const_cast<double*>(qd), jacobianDot_);
+		jacobianDot = jacobianDot_;
+	}
+
+	/*
+	 * pose, linear velocity, spatial Jacobian and, if computeJacobianDot, its time derivative at (q, qd) in one query.
+	 * The default composes the queries above, models override it with a single sweep over the chain.
+	 */
+	virtual void getKinematics(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Ref<Eigen::MatrixXd> jacobian, Eigen::Ref<Eigen::MatrixXd> jacobianDot, bool computeJacobianDot)
+	{
+		const Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 16, 1> qdd = Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 16, 1>::Zero(jacobian.cols());
+		Eigen::Vector3d accel;
+
+		getForwardKinematics(ws, q, qd, qdd.data(), poseM, poseP, vel, accel, false);
+		getSpatialJacobian(ws, q, jacobian);
+		if (computeJacobianDot) { getSpatialJacobianDot(ws, q, qd, jacobianDot); }
+	}
+
+	/*
+	 * derivative of the end-effector linear velocity v = J(q) qd with respect to (q, qd), 3 x 2 NDOF.
+	 * The default only has the qd part, the linear rows of the spatial Jacobian, and leaves dv/dq zero.
+	 * Returns true if dv/dq is exact.
+	 */
+	virtual bool getEEVelocityJacobian(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> dvdx)
+	{
+		const int n = dvdx.cols() / 2;
+		Eigen::Matrix<double, 6, Eigen::Dynamic, 0, 6, 16> jacobian(6, n);
+		getSpatialJacobian(ws, q, jacobian);
+
+		dvdx.leftCols(n).setZero();
+		dvdx.rightCols(n) = jacobian.topRows(3);
+		return false;
+	}
+
+	/*
+	 * the model as a serial chain of rigid bodies, for backends that evaluate its dynamics on their own scalar type
+	 * (AutoDiffRobotDynamics). Returns false if the model cannot describe itself that way.
+	 */
+	virtual bool getRigidBodyChain(admm::RigidBodyChain& chain) const { return false; }
+
+private:
+	std::mutex m_fallbackMutex;
 };
 #endif  //ROBOT_ABSTRACT_H
@@ -0,0 +1,167 @@
+#ifndef BOX_QP_H
+#define BOX_QP_H
+
+#include <cmath>
+#include <Eigen/Dense>
+
+namespace admm {
+
+/*
+ * Projected-Newton solver for the box-constrained QP of control-limited DDP (Tassa, Mansard, Todorov 2014)
+ *
+ *      min 0.5 * x'Hx + g'x    s.t.  lower <= x <= upper
+ *
+ * Fixed-size, does not allocate. The Cholesky factor of H restricted to the free set of the last iteration is kept,
+ * so the caller can compute the feedback gains of the free controls with solveFree.
+ */
+template<int N>
+class BoxQP
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Vector = Eigen::Matrix<double, N, 1>;
+    using Matrix = Eigen::Matrix<double, N, N>;
+    using Mask   = Eigen::Array<bool, N, 1>;
+
+    // values below MaxIterations mean the solve failed
+    enum Result { HessianNotPD = -1, NoDescent = 0, MaxIterations = 1, MaxLineSearch = 2, SmallImprovement = 3, SmallGradient = 4, AllClamped = 5 };
+
+    struct Options
+    {
+        int maxIter{100};
+        double minGrad{1e-8};           // minimum norm of the free gradient
+        double minRelImprove{1e-8};     // minimum relative improvement of the objective
+        double stepDec{0.6};            // line-search backtracking factor
+        double minStep{1e-22};
+        double armijo{0.1};             // sufficient decrease of the projected line-search
+    };
+
+    BoxQP() { x_.setZero(); free_.setConstant(true); }
+    explicit BoxQP(const Options& options) : BoxQP() { options_ = options; }
+
+    Result solve(const Matrix& H, const Vector& g, const Vector& lower, const Vector& upper, const Vector& x0)
+    {
+        x_ = x0.cwiseMax(lower).cwiseMin(upper);
+        x_ = x_.array().isFinite().select(x_, Vector::Zero());
+
+        double value = objective(H, g, x_);
+        double oldValue = 0.0;
+
+        Mask clamped, oldClamped;
+        bool factorized = false;
+        Result result = MaxIterations;
+
+        for (int iter = 0; iter < options_.maxIter; iter++)
+        {
+            if (iter > 0 && (oldValue - value) < options_.minRelImprove * std::abs(oldValue))
+            {
+                result = SmallImprovement;
+                break;
+            }
+            oldValue = value;
+
+            // active set: at a bound with the gradient pushing outwards
+            grad_   = g + H * x_;
+            clamped = ((x_.array() == lower.array()) && (grad_.array() > 0)) || ((x_.array() == upper.array()) && (grad_.array() < 0));
+            free_   = !clamped;
+
+            if (clamped.all())
+            {
+                result = AllClamped;
+                break;
+            }
+
+            // refactorize only when the active set changes
+            if (!factorized || (clamped != oldClamped).any())
+            {
+                // H on the free block, identity on the clamped one
+                const Vector f = free_.template cast<double>().matrix();
+                Hfree_ = f.asDiagonal() * H * f.asDiagonal();
+                Hfree_.diagonal() += (Vector::Ones() - f);
+
+                llt_.compute(Hfree_);
+                if (llt_.info() != Eigen::Success)
+                {
+                    result = HessianNotPD;
+                    break;
+                }
+                factorized = true;
+            }
+            oldClamped = clamped;
+
+            if (free_.select(grad_.array(), 0.0).matrix().norm() < options_.minGrad)
+            {
+                result = SmallGradient;
+                break;
+            }
+
+            // Newton step over the free variables, the clamped ones held at their bound
+            const Vector gradClamped = g + H * clamped.select(x_.array(), 0.0).matrix();
+            search_ = free_.select((-llt_.solve(free_.select(gradClamped.array(), 0.0).matrix()) - x_).array(), 0.0).matrix();
+
+            const double sdotg = search_.dot(grad_);
+            if (sdotg >= 0)
+            {
+                result = NoDescent;
+                break;
+            }
+
+            // projected backtracking line-search
+            double step = 1.0;
+            Vector xc = (x_ + step * search_).cwiseMax(lower).cwiseMin(upper);
+            double vc = objective(H, g, xc);
+
+            while ((vc - value) / (step * sdotg) < options_.armijo)
+            {
+                step *= options_.stepDec;
+                if (step < options_.minStep)
+                {
+                    result = MaxLineSearch;
+                    break;
+                }
+
+                xc = (x_ + step * search_).cwiseMax(lower).cwiseMin(upper);
+                vc = objective(H, g, xc);
+            }
+            if (result == MaxLineSearch) break;
+
+            x_ = xc;
+            value = vc;
+        }
+
+        return result;
+    }
+
+    /* solution of the last solve */
+    const Vector& x() const { return x_; }
+
+    /* free (not clamped) variables of the last iteration */
+    const Mask& freeSet() const { return free_; }
+
+    /* solve H_ff X_f = B_f on the free subspace, the clamped rows of X are zero. all zero if every variable is clamped,
+     * H is not factorized then */
+    template<int Cols>
+    Eigen::Matrix<double, N, Cols> solveFree(const Eigen::Matrix<double, N, Cols>& B) const
+    {
+        if (!free_.any()) return Eigen::Matrix<double, N, Cols>::Zero();
+        return llt_.solve(free_.template cast<double>().matrix().asDiagonal() * B);
+    }
+
+private:
+    static double objective(const Matrix& H, const Vector& g, const Vector& x)
+    {
+        return x.dot(g) + 0.5 * x.dot(H * x);
+    }
+
+    Options options_;
+
+    Vector x_, grad_, search_;
+    Mask free_;
+    Matrix Hfree_;
+    Eigen::LLT<Matrix> llt_;
+};
+
+}
+
+#endif // BOX_QP_H
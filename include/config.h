@@ -4,11 +4,32 @@
 #include <Eigen/StdVector>
 #include <sys/time.h>
 
-#define ENABLE_QPBOX 0
-#define DISABLE_QPBOX 1
+#define ENABLE_QPBOX 1
+#define DISABLE_QPBOX 0
 #define ENABLE_FULLDDP 0
 #define DISABLE_FULLDDP 1
 
+// exploit the sparsity of the forward Euler linearization of the soft-contact model in the backward pass (riccati_kernels.hpp)
+#define STRUCTURED_RICCATI 1
+
+// exact Gauss-Newton derivatives of the contact cost from the generated end-effector velocity Jacobian (CMake option CODEGEN_CONTACT_COST)
+#ifndef CODEGEN_CONTACT_COST
+#define CODEGEN_CONTACT_COST 0
+#endif
+
+// generated forward dynamics and RK4 step available as a dynamics backend, robot_dynamics_codegen.hpp (CMake option CODEGEN_DYNAMICS)
+#ifndef CODEGEN_DYNAMICS
+#define CODEGEN_DYNAMICS 0
+#endif
+
+// linearization code in RobotDynamics::fx: 0 the generated getDerivativeState / getDerivativeControl pair, 1 the fused
+// forward mode sweep, 2 the fused reverse mode sweep (FusedLinearizationCodegen.h, CMake cache variable FUSED_LINEARIZATION).
+// The fused code takes the contact parameters as inputs, 0 has the defaults of KUKASoftContactFDSystem built in and
+// differences f for any other parameters
+#ifndef FUSED_LINEARIZATION
+#define FUSED_LINEARIZATION 1
+#endif
+
 #define SOFT_CONTACT
 #define CONTACT_EN 1
 #define DEBUG 
@@ -20,7 +41,7 @@ const int fullstatecommandSize = 24;
 const int NDOF = 7;
 
 const double TimeHorizon = 50;
-const double TimeStep = 0.01; // 0.01s works for soft contact dynamics
+const double TimeStep = 0.01; // 0.01s works for soft contact dynamics with RK4, admm::Integrator::Rosenbrock stays stable at larger steps
 
 const unsigned int NumberofKnotPt = TimeHorizon / TimeStep;
 const int32_t kNumJoints = 7;
@@ -3,10 +3,16 @@
 
 #include "config.h"
 #include "cost_function_contact.hpp"
+#include "cost_weights.hpp"
+#include <algorithm>
 #include <memory>
 
-// template <class DynamicsT, class PlantT, class costFunctionT, class OptimizerT, class OptimizerResultT>
-class CostFunctionADMM
+/*
+ * Tracking cost with the augmented Lagrangian terms of the ADMM blocks.
+ * StateWeight and ControlWeight set the structure of Q, Qf and R (see cost_weights.hpp), diagonal by default.
+ */
+template<class StateWeight, class ControlWeight>
+class CostFunctionADMMT
 {
     using Scalar               = scalar_t;
     using State                = stateVec_t;
@@ -19,10 +25,18 @@ class CostFunctionADMM
     using StateWeights         = stateMat_t;
     using ControlWeights       = commandMat_t;
 
+public:
+    struct Weights
+    {
+        StateWeight Q;
+        StateWeight Qf;
+        ControlWeight R;
+    };
+
 protected:
-    StateWeights Q;
-    StateWeights Qf;
-    ControlWeights R;
+    StateWeight Q;
+    StateWeight Qf;
+    ControlWeight R;
 
     StateTrajectory cx_new;
     ControlTrajectory cu_new; 
@@ -40,36 +54,30 @@ protected:
     // std::shared_ptr<ContactTerms<double, stateSize, commandSize>> m_contactCost;
     ContactTerms<double, stateSize, commandSize>* m_contactCost{};
 
-    Eigen::Matrix<double, stateSize, 1> m_;
-    Eigen::Matrix<double, stateSize, 1> n_;
+    // end-effector kinematics of the trajectory the derivatives were last computed on, shared with the ADMM blocks
+    std::shared_ptr<admm::KinematicsCache> kinematics;
 
-    Eigen::Matrix<double, stateSize, stateSize> c_xx;
-    Eigen::Matrix<double, stateSize, 1> c_x;
+    // scratch of the whole-trajectory evaluations, one column per knot
+    StateTrajectory ex_, wx_;
+    ControlTrajectory wu_;
+    Eigen::RowVectorXd costRow_;
+    StateHessian cxxBase, cxxBaseFinal;
+    ControlHessian cuuBase;
 
 public:
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
-    CostFunctionADMM() = default;
-    ~CostFunctionADMM() 
+    CostFunctionADMMT() = default;
+    ~CostFunctionADMMT() 
     {
         delete m_contactCost;
     }
 
-    CostFunctionADMM(int time_steps,  const std::shared_ptr<RobotAbstract>& robotModel) : N(time_steps), plant(robotModel) {
+    CostFunctionADMMT(int time_steps, const std::shared_ptr<RobotAbstract>& robotModel) : CostFunctionADMMT(time_steps, robotModel, defaultWeights()) {}
 
-        Eigen::VectorXd xW(stateSize);
-        Eigen::VectorXd xfW(stateSize);
-        Eigen::VectorXd uW(commandSize);
+    CostFunctionADMMT(int time_steps, const std::shared_ptr<RobotAbstract>& robotModel, const Weights& weights) : N(time_steps), plant(robotModel) {
 
-        /* for consensus admm. read it from te main file as a dynamic parameters passing */
-        xW << 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.0, 0.0, 0.5;
-        xfW << 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.0, 0.0, 0.5;
-        uW << 1E-4, 1E-4, 1E-4, 1E-4, 1E-4, 1E-4, 1E-4;
-
-        
-        Q  = xW.asDiagonal();
-        Qf = xfW.asDiagonal();
-        R  = uW.asDiagonal();
+        setWeights(weights);
         
         cx_new.resize(stateSize, N + 1);
         cu_new.resize(commandSize, N + 1);
@@ -77,15 +85,39 @@ public:
         cux_new.resize(N + 1);
         cuu_new.resize(N + 1);
 
-        Eigen::VectorXd temp(stateSize);
+        ex_.resize(stateSize, N + 1);
+        wx_.resize(stateSize, N + 1);
+        wu_.resize(commandSize, N);
+        costRow_.resize(N + 1);
 
         m_contactCost = new ContactTerms<double, stateSize, commandSize>(robotModel);
+        kinematics = std::make_shared<admm::KinematicsCache>(robotModel, N, false, CODEGEN_CONTACT_COST);
 
     }
 
-    CostFunctionADMM(const CostFunctionADMM& other) {}
+    CostFunctionADMMT(const CostFunctionADMMT& other) {}
+
+    CostFunctionADMMT& operator = (const CostFunctionADMMT& other) {}
+
+    /* weights of the consensus ADMM tracking cost used so far */
+    static Weights defaultWeights()
+    {
+        stateVec_t xW, xfW;
+        commandVec_t uW;
+
+        xW  << 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.0, 0.0, 0.5;
+        xfW << 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.0, 0.0, 0.5;
+        uW  << 1E-4, 1E-4, 1E-4, 1E-4, 1E-4, 1E-4, 1E-4;
+
+        return Weights{StateWeight(StateWeights(xW.asDiagonal())), StateWeight(StateWeights(xfW.asDiagonal())), ControlWeight(ControlWeights(uW.asDiagonal()))};
+    }
 
-    CostFunctionADMM& operator = (const CostFunctionADMM& other) {}
+    void setWeights(const Weights& weights)
+    {
+        Q  = weights.Q;
+        Qf = weights.Qf;
+        R  = weights.R;
+    }
 
 
     /* return the cost without admm terms */
@@ -95,12 +127,12 @@ public:
 
         if (k == N)
         {
-            cost = 0.5 * (x_k.transpose() - x_track.transpose()) * Qf * (x_k - x_track);
+            cost = 0.5 * Qf.quadratic(x_k - x_track);
         }
         else
         {
-            cost  = 0.5 * (x_k.transpose() - x_track.transpose()) * Q * (x_k - x_track);
-            cost += 0.5 * u_k.transpose() * R * u_k;
+            cost  = 0.5 * Q.quadratic(x_k - x_track);
+            cost += 0.5 * R.quadratic(u_k);
         }
         return cost;
     }
@@ -109,115 +141,216 @@ public:
 
     // return the cost with admm 
     Scalar cost_func_expre_admm(unsigned int k, const State& x_k, const Control& u_k, const State &x_track,
-                                const Eigen::MatrixXd& c_bar, const State& x_bar, const Control& u_bar, 
-                                const Eigen::VectorXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
+                                const Eigen::Ref<const Eigen::VectorXd>& c_bar, const State& x_bar, const Control& u_bar, 
+                                const Eigen::Ref<const Eigen::VectorXd>& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
     {
-        Scalar cost;
-
         // compute the contact terms.
         Eigen::Vector2d contact_terms = m_contactCost->computeContactTerms(x_k, R_c(k));
 
-        if (k == N) 
-        {
-            cost  = 0.5 * (x_k.transpose() - x_track.transpose()) * Qf * (x_k - x_track); 
-            cost += 0.5 * rho(4) * (x_k.head(7).transpose() - thetaList_bar.transpose()) * (x_k.head(7) - thetaList_bar);
+        return admmCost(k, x_k, u_k, x_track, c_bar, x_bar, u_bar, thetaList_bar, rho, contact_terms);
+    }
 
-            if (CONTACT_EN)
-            {
-                cost += 0.5 * rho(2) * (contact_terms.head(2).transpose() - c_bar.transpose()) * (contact_terms.head(2) - c_bar); // temp
-            }
-            cost += 0.5 * rho(0) * (x_k.head(7).transpose() - x_bar.head(7).transpose()) * (x_k - x_bar).head(7);
+    // same cost, but reentrant: the kinematics run on the caller's workspace (see createWorkspace)
+    Scalar cost_func_expre_admm(RobotAbstractWorkspace& ws, unsigned int k, const State& x_k, const Control& u_k, const State &x_track,
+                                const Eigen::Ref<const Eigen::VectorXd>& c_bar, const State& x_bar, const Control& u_bar, 
+                                const Eigen::Ref<const Eigen::VectorXd>& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c) const
+    {
+        Eigen::Vector2d contact_terms = m_contactCost->computeContactTerms(ws, x_k, R_c(k));
 
-        } else {
+        return admmCost(k, x_k, u_k, x_track, c_bar, x_bar, u_bar, thetaList_bar, rho, contact_terms);
+    }
 
-            cost  = 0.5 * (x_k.transpose() - x_track.transpose()) * Q * (x_k - x_track);
-            cost += 0.5 * u_k.transpose() * R * u_k; 
+    // same cost, with the kinematics of the knot taken from the cache (see getKinematicsCache)
+    Scalar cost_func_expre_admm(const admm::KinematicsEntry& kin, unsigned int k, const State& x_k, const Control& u_k, const State &x_track,
+                                const Eigen::Ref<const Eigen::VectorXd>& c_bar, const State& x_bar, const Control& u_bar, 
+                                const Eigen::Ref<const Eigen::VectorXd>& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c) const
+    {
+        Eigen::Vector2d contact_terms = m_contactCost->computeContactTerms(kin, x_k, R_c(k));
 
-            cost += 0.5 * rho(0) * (x_k.head(7).transpose() - x_bar.head(7).transpose()) * (x_k - x_bar).head(7);
-            cost += 0.5 * rho(1) * (u_k.transpose() - u_bar.transpose()) * (u_k - u_bar);
+        return admmCost(k, x_k, u_k, x_track, c_bar, x_bar, u_bar, thetaList_bar, rho, contact_terms);
+    }
 
+    std::unique_ptr<RobotAbstractWorkspace> createWorkspace() const {return plant->createWorkspace();}
 
-            // compute the contact term
-            if (CONTACT_EN)
-            {
-                cost += 0.5 * rho(2) * (contact_terms.head(2).transpose() - c_bar.transpose()) * (contact_terms.head(2) - c_bar); // temp
-            }
+    const std::shared_ptr<admm::KinematicsCache>& getKinematicsCache() const {return kinematics;}
 
-            cost += 0.5 * rho(4) * (x_k.head(7).transpose() - thetaList_bar.transpose()) * (x_k.head(7) - thetaList_bar);
+    /* number of worker threads the kinematics, costs and derivatives of the horizon are split across */
+    void setNumThreads(unsigned int numThreads) {kinematics->setNumThreads(numThreads);}
 
-        }
 
-        return cost;
-    }
+    /*
+     * cost of every knot of the trajectory in one call. The horizon is split in chunks across the threads of the kinematics cache,
+     * the quadratic terms of a chunk are matrix products over its columns, the contact terms come from the cached kinematics.
+     */
+    void cost_func_expre_admm(const StateTrajectory& xList, const ControlTrajectory& uList, const StateTrajectory &x_track,
+                              const Eigen::MatrixXd& cList_bar, const StateTrajectory& xList_bar, const ControlTrajectory& uList_bar, 
+                              const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c, costVecTab_t& costs)
+    {
+        if (CONTACT_EN) {kinematics->update(xList);}
 
+        kinematics->threadPool().parallel_for(N + 1, [&](unsigned int, int begin, int end)
+        {
+            const int m = end - begin;
+            const int n = std::min(end, N) - begin; // knots of the chunk with a control
+
+            auto ex  = ex_.middleCols(begin, m);
+            auto wx  = wx_.middleCols(begin, m);
+            auto row = costRow_.middleCols(begin, m);
+
+            ex = xList.middleCols(begin, m) - x_track.middleCols(begin, m);
+            if (n > 0)  {Q.applyCols(ex.leftCols(n), wx.leftCols(n));}
+            if (n < m)  {Qf.applyCols(ex.rightCols(1), wx.rightCols(1));}
+
+            row  = 0.5 * wx.cwiseProduct(ex).colwise().sum();
+            row += 0.5 * rho(0) * (xList.middleCols(begin, m) - xList_bar.middleCols(begin, m)).template topRows<NDOF>().colwise().squaredNorm();
+            row += 0.5 * rho(4) * (xList.middleCols(begin, m).template topRows<NDOF>() - thetaList_bar.middleCols(begin, m)).colwise().squaredNorm();
+
+            if (n > 0)
+            {
+                auto wu = wu_.middleCols(begin, n);
+                R.applyCols(uList.middleCols(begin, n), wu);
 
+                row.leftCols(n) += 0.5 * wu.cwiseProduct(uList.middleCols(begin, n)).colwise().sum();
+                row.leftCols(n) += 0.5 * rho(1) * (uList.middleCols(begin, n) - uList_bar.middleCols(begin, n)).colwise().squaredNorm();
+            }
 
-    /* compute analytical derivatives */
+            for (int k = begin; k < end; k++)
+            {
+                if (CONTACT_EN)
+                {
+                    const Eigen::Vector2d contact_terms = m_contactCost->computeContactTerms((*kinematics)[k], xList.col(k), R_c(k));
+                    costRow_(k) += 0.5 * rho(2) * (contact_terms - cList_bar.col(k)).squaredNorm();
+                }
+                costs[k] = costRow_(k);
+            }
+        });
+    }
+
+
+    /* compute analytical derivatives over the whole trajectory, in the same chunks as the cost above */
     void computeDerivatives(const StateTrajectory& xList, const ControlTrajectory& uList, const StateTrajectory &x_track,
                             const Eigen::MatrixXd& cList_bar, const StateTrajectory& xList_bar, const ControlTrajectory& uList_bar, 
                             const Eigen::MatrixXd& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::VectorXd& R_c)
     {
         // TODO : get the state size from the dynamics class
 
-        m_ << rho(0), rho(0), rho(0), rho(0), rho(0), rho(0), rho(0), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0;
-        n_ << rho(4), rho(4), rho(4), rho(4), rho(4), rho(4), rho(4), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0;
+        if (CONTACT_EN) {kinematics->update(xList);}
+
+        // the Hessians are the same at every knot up to the contact terms. ignore the second term of te second derivative.
+        // the consensus (rho(0)) and IK (rho(4)) terms only act on the joint positions
+        cxxBase.setZero();
+        Q.addTo(cxxBase);
+        cxxBase.diagonal().template head<NDOF>().array() += rho(0) + rho(4);
 
-        Eigen::VectorXd temp(stateSize);
+        cxxBaseFinal.setZero();
+        Qf.addTo(cxxBaseFinal);
+        cxxBaseFinal.diagonal().template head<NDOF>().array() += rho(0) + rho(4);
 
-        for (unsigned int k = 0; k < N; k++)
+        cuuBase.setZero();
+        R.addTo(cuuBase);
+        cuuBase.diagonal().array() += rho(1);
+
+        kinematics->threadPool().parallel_for(N + 1, [&](unsigned int, int begin, int end)
         {
-            if (CONTACT_EN)
-            {
-                c_x  = m_contactCost->contact_x(xList.col(k), cList_bar.col(k), R_c(k), rho(2));
-                c_xx = m_contactCost->contact_xx(xList.col(k), cList_bar.col(k), R_c(k), rho(2));
-                cx_new.col(k) = Q * (xList.col(k) - x_track.col(k)) + m_.asDiagonal() * (xList.col(k) - xList_bar.col(k)) + n_.asDiagonal() *  temp + c_x;
-            } else
-            {
-                cx_new.col(k) = Q * (xList.col(k) - x_track.col(k)) + m_.asDiagonal() * (xList.col(k) - xList_bar.col(k)) + n_.asDiagonal() *  temp;
-            }
+            const int m = end - begin;
+            const int n = std::min(end, N) - begin; // knots of the chunk with a control
 
             // Analytical derivatives given quadratic cost
-            temp.head(7)  = (xList.col(k).head(7) - thetaList_bar.col(k));
-            cu_new.col(k) = R * uList.col(k) + rho(1) * (uList.col(k) - uList_bar.col(k));
-            
+            auto ex = ex_.middleCols(begin, m);
+            auto cx = cx_new.middleCols(begin, m);
 
-            // compute the first derivative. ignore the second term of te second derivative.
-            cxx_new[k]    = Q;
-            cxx_new[k]   += m_.asDiagonal();
-            cxx_new[k]   += n_.asDiagonal();
+            ex = xList.middleCols(begin, m) - x_track.middleCols(begin, m);
+            if (n > 0)  {Q.applyCols(ex.leftCols(n), cx.leftCols(n));}
+            if (n < m)  {Qf.applyCols(ex.rightCols(1), cx.rightCols(1));}
 
-            if (CONTACT_EN) {cxx_new[k] += c_xx;}
-            cuu_new[k]    = R + rho(1) * Eigen::MatrixXd::Identity(7, 7); 
+            cx.template topRows<NDOF>() += rho(0) * (xList.middleCols(begin, m) - xList_bar.middleCols(begin, m)).template topRows<NDOF>();
+            cx.template topRows<NDOF>() += rho(4) * (xList.middleCols(begin, m).template topRows<NDOF>() - thetaList_bar.middleCols(begin, m));
 
-            // Note that cu , cux and cuu at the final time step will never be used (see ilqrsolver::doBackwardPass)
-            cux_new[k].setZero();
-        } 
+            if (n > 0)
+            {
+                R.applyCols(uList.middleCols(begin, n), cu_new.middleCols(begin, n));
+                cu_new.middleCols(begin, n) += rho(1) * (uList.middleCols(begin, n) - uList_bar.middleCols(begin, n));
+            }
 
-        temp.head(7)  = (xList.col(N).head(7) - thetaList_bar.col(N));
+            for (int k = begin; k < begin + n; k++)
+            {
+                cxx_new[k] = cxxBase;
+                cuu_new[k] = cuuBase;
 
-        if (CONTACT_EN)
-        {
-            c_x = m_contactCost->contact_x(xList.col(N), cList_bar.col(N), R_c(N), rho(2));
-            cx_new.col(N) = Q * (xList.col(N) - x_track.col(N)) + m_.asDiagonal() * (xList.col(N) - xList_bar.col(N)) + n_.asDiagonal() *  temp + c_x; // + rho(0) * (xList.col(N) - xList_bar.col(N));
-        } else 
-        {
-            cx_new.col(N) = Q * (xList.col(N) - x_track.col(N)) + m_.asDiagonal() * (xList.col(N) - xList_bar.col(N)) + n_.asDiagonal() *  temp;
-        }
+                // Note that cu , cux and cuu at the final time step will never be used (see ilqrsolver::doBackwardPass)
+                cux_new[k].setZero();
+
+                if (CONTACT_EN) {addContactDerivatives((*kinematics)[k], xList.col(k), cList_bar.col(k), R_c(k), rho(2), cx_new.col(k), cxx_new[k]);}
+            }
 
-        cxx_new[N]    = Q;
-        cxx_new[N]   += m_.asDiagonal();
-        cxx_new[N]   += n_.asDiagonal();
+            if (n < m)
+            {
+                // only the gradient of the contact term at the final knot
+                stateMat_t contactHessian = stateMat_t::Zero();
+                cxx_new[N] = cxxBaseFinal;
+
+                if (CONTACT_EN) {addContactDerivatives((*kinematics)[N], xList.col(N), cList_bar.col(N), R_c(N), rho(2), cx_new.col(N), contactHessian);}
+            }
+        });
     }
 
-	const StateWeights& getQ() const {return Q;};
-	const StateWeights& getQf() const {return Qf;};
-	const ControlWeights& getR() const {return R;};
+	StateWeights getQ() const {return Q.dense();};
+	StateWeights getQf() const {return Qf.dense();};
+	ControlWeights getR() const {return R.dense();};
 	const StateTrajectory& getcx() const {return cx_new;};
 	const ControlTrajectory& getcu() const {return cu_new;};
 	const stateMatTab_t& getcxx() const {return cxx_new;};
 	const ControlStateJacobian& getcux() const {return cux_new;};
 	const commandMatTab_t& getcuu() const {return cuu_new;};
 
+private:
+    /*
+     * exact Gauss-Newton contact derivatives where the model has the full velocity Jacobian (generated code of
+     * RobCodGenModel), the hand-derived ones otherwise, e.g. for the KDL model whose dv/dq is left zero
+     */
+    void addContactDerivatives(const admm::KinematicsEntry& kin, const State& x, const Eigen::Ref<const Eigen::VectorXd>& c_bar, double R_c, double rho_c,
+                               Eigen::Ref<State> cx, StateHessian& cxx) const
+    {
+#if CODEGEN_CONTACT_COST
+        if (kin.dvdxExact)
+        {
+            m_contactCost->addContactDerivativesExact(kin, x, c_bar, R_c, rho_c, cx, cxx);
+            return;
+        }
+#endif
+        m_contactCost->addContactDerivatives(kin, x, c_bar, R_c, rho_c, cx, cxx);
+    }
+
+    Scalar admmCost(unsigned int k, const State& x_k, const Control& u_k, const State &x_track,
+                    const Eigen::Ref<const Eigen::VectorXd>& c_bar, const State& x_bar, const Control& u_bar, 
+                    const Eigen::Ref<const Eigen::VectorXd>& thetaList_bar, const Eigen::VectorXd& rho, const Eigen::Vector2d& contact_terms) const
+    {
+        Scalar cost;
+
+        if (k == N) 
+        {
+            cost  = 0.5 * Qf.quadratic(x_k - x_track); 
+        } else {
+            cost  = 0.5 * Q.quadratic(x_k - x_track);
+            cost += 0.5 * R.quadratic(u_k); 
+            cost += 0.5 * rho(1) * (u_k - u_bar).squaredNorm();
+        }
+
+        cost += 0.5 * rho(0) * (x_k - x_bar).template head<NDOF>().squaredNorm();
+        cost += 0.5 * rho(4) * (x_k.template head<NDOF>() - thetaList_bar).squaredNorm();
+
+        // compute the contact term
+        if (CONTACT_EN)
+        {
+            cost += 0.5 * rho(2) * (contact_terms - c_bar).squaredNorm();
+        }
+
+        return cost;
+    }
+
 };
 
+// diagonal Q, Qf and R
+using CostFunctionADMM = CostFunctionADMMT<admm::DiagonalWeight<stateSize>, admm::DiagonalWeight<commandSize>>;
+
 #endif
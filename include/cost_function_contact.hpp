@@ -3,6 +3,7 @@
 
 #include "config.h"
 #include "RobotAbstract.h"
+#include "kinematics_cache.hpp"
 
 using Jacobian = Eigen::Matrix<double, 1, stateSize + commandSize>;
 using Hessian = Eigen::Matrix<double, 1, stateSize + commandSize>;
@@ -12,19 +13,17 @@ using Hessian = Eigen::Matrix<double, 1, stateSize + commandSize>;
 template <class T, int S, int C>
 struct ContactTerms
 {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
     /* --------------------------------------- calculate forward kinematics --------------------------------------------- */
-    double* q;
-    double* qd;
-    double* qdd;
+    // fixed-size scratch, the legacy (non-workspace) calls below do not allocate
+    stateVec_half_t q;
+    stateVec_half_t qd;
+    stateVec_half_t qdd;
 
     Eigen::Matrix<double, 3, 3> poseM;
     Eigen::Matrix<double, 3, 3> massMatrix;
-    Eigen::MatrixXd Jac;
-    Eigen::MatrixXd JacDot;
 
-    Eigen::VectorXd CX; 
-    Eigen::MatrixXd CXX;
     Eigen::Vector3d poseP;
     Eigen::Vector3d vel;
     Eigen::Vector3d accel;
@@ -32,30 +31,13 @@ struct ContactTerms
     double mass;
 
     std::shared_ptr<RobotAbstract> plant;
-
-    Eigen::Vector2d scratch;
+    std::unique_ptr<RobotAbstractWorkspace> ws;
 
     ContactTerms() = default;
-    ~ContactTerms() 
-    {
-        delete[] q;
-        delete[] qd;
-        delete[] qdd;
-    }
 
-    ContactTerms(const std::shared_ptr<RobotAbstract>& robotModel) : plant(robotModel)
+    ContactTerms(const std::shared_ptr<RobotAbstract>& robotModel) : plant(robotModel), ws(robotModel->createWorkspace())
     {
-        q   = new double[7];
-        qd  = new double[7];
-        qdd = new double[7];
-        Jac.resize(6, NDOF);
-        JacDot.resize(6, NDOF);
-        CX.resize(stateSize);
-        CXX.resize(stateSize, stateSize);
-        CXX.setZero();
-        CX.setZero();
-
-        for (int i=0;i<7;i++) {qdd[i] = 0.0;}
+        qdd.setZero();
         mass = 0.3;
     }
 
@@ -63,9 +45,9 @@ struct ContactTerms
     const Eigen::Vector2d& computeContactTerms(const stateVec_t& x, double R_c)
     {
         // get the path parameters. K on top of R_c
-        memcpy(q, x.head(7).data(), 7 * sizeof(double));
-        memcpy(qd, x.segment(7,7).data(), 7 * sizeof(double));
-        plant->getForwardKinematics(q, qd, qdd, poseM, poseP, vel, accel, true);
+        q  = x.head(7);
+        qd = x.segment(7,7);
+        plant->getForwardKinematics(*ws, q.data(), qd.data(), qdd.data(), poseM, poseP, vel, accel, false);
 
         contactTerms(0) = mass * (vel.transpose() * vel)(0) / R_c;
         contactTerms(1) = x(16);
@@ -73,75 +55,76 @@ struct ContactTerms
         return contactTerms;
     }
 
+    /* reentrant version of computeContactTerms, all scratch lives in the caller's workspace */
+    Eigen::Vector2d computeContactTerms(RobotAbstractWorkspace& ws_, const stateVec_t& x, double R_c) const
+    {
+        const double qdd_zero[NDOF] = {0.0};
+        stateVec_half_t q_  = x.head(7);
+        stateVec_half_t qd_ = x.segment(7,7);
+
+        Eigen::Matrix3d poseM_;
+        Eigen::Vector3d poseP_, vel_, accel_;
+        plant->getForwardKinematics(ws_, q_.data(), qd_.data(), qdd_zero, poseM_, poseP_, vel_, accel_, false);
+
+        Eigen::Vector2d terms;
+        terms(0) = mass * vel_.squaredNorm() / R_c;
+        terms(1) = x(16);
+
+        return terms;
+    }
+
     /* compute the mass matrix at the end-effector. */
     inline Eigen::Matrix3d CartesianMassMatrix()
     {
         return massMatrix;
     }   
 
-    /* get the contact jabobian */
-    inline Eigen::MatrixXd getContactJacobian(double* q)
+    /* contact terms from the cached kinematics of the knot */
+    Eigen::Vector2d computeContactTerms(const admm::KinematicsEntry& kin, const stateVec_t& x, double R_c) const
     {
-        plant->getSpatialJacobian(q, Jac); 
-        return Jac;
-    }
-
+        Eigen::Vector2d terms;
+        terms(0) = mass * kin.vel.squaredNorm() / R_c;
+        terms(1) = x(16);
 
-    /* get the contact jabobian dot */
-    inline Eigen::MatrixXd getContactJacobianDot(double* q, double* qd)
-    {
-        plant->getSpatialJacobianDot(q, q, JacDot); 
-        return JacDot;
+        return terms;
     }
 
 
-    /* compute the jacobian, assuming contact terms are calculated first */
-    const Eigen::VectorXd& contact_x(const stateVec_t& x, const Eigen::VectorXd& cList_bar, double R_c, double rho_c) 
+    /* gradient and Hessian of the contact terms from the cached kinematics, added to the caller's cx and cxx */
+    void addContactDerivatives(const admm::KinematicsEntry& kin, const stateVec_t& x, const Eigen::Ref<const Eigen::VectorXd>& cList_bar, double R_c, double rho_c,
+                               Eigen::Ref<stateVec_t> cx, stateMat_t& cxx) const
     {
-        // TODO: optimize this part
-        memcpy(q, x.head(7).data(), 7 * sizeof(double));
-        memcpy(qd, x.segment(7,7).data(), 7 * sizeof(double));
-
-        plant->getForwardKinematics(q, qd, qdd, poseM, poseP, vel, accel, true);
-
-        // Eigen::Vector2d w;
-        scratch = (computeContactTerms(x, R_c) - cList_bar);
+        const Eigen::Vector2d w = computeContactTerms(kin, x, R_c) - cList_bar;
+        const auto Jv = kin.J.template topRows<3>();
+        const double scale = rho_c * 2 * mass * (1.0/R_c);
 
-        // CX.head(7)      = rho_c * 2 * mass * (w(0) + w(1)) * (1/R_c) * vel.transpose() * getContactJacobianDot(q, qd).block(0,0,3,NDOF);
-        CX.segment(7,7) = rho_c * 2 * mass * (scratch(0) + scratch(1)) * (1/R_c) * vel.transpose() * getContactJacobian(q).block(0,0,3,NDOF);
+        cx.segment<7>(7).noalias() += (scale * (w(0) + w(1))) * (Jv.transpose() * kin.vel);
 
-        return CX;
+        cxx.template block<7,7>(7,7).noalias() += (scale * (w(0) + w(1))) * Jv.transpose() * Jv;
+        cxx.template block<7,7>(7,7).noalias() += scale * (Jv.transpose() * kin.vel) * (kin.vel.transpose() * Jv);
+        cxx(16,16) += rho_c;
     }
 
 
-    /* compute the hessian */
-    const Eigen::MatrixXd& contact_xx(const stateVec_t& x, const Eigen::VectorXd& cList_bar, double R_c, double rho_c) 
+    /*
+     * exact gradient and Gauss-Newton Hessian of 0.5 rho_c ||c(x) - c_bar||^2, added to the caller's cx and cxx.
+     * c_0 = m |v|^2 / R_c depends on (q, qd) through the end-effector velocity, whose derivative dv/d(q, qd) comes from
+     * the cache (computed with computeVelocityJacobian, generated code for RobCodGenModel), c_1 is the contact force x(16).
+     */
+    void addContactDerivativesExact(const admm::KinematicsEntry& kin, const stateVec_t& x, const Eigen::Ref<const Eigen::VectorXd>& cList_bar, double R_c, double rho_c,
+                                    Eigen::Ref<stateVec_t> cx, stateMat_t& cxx) const
     {
-        // TODO: optimize this part
-        // Assumption: 
-        // memcpy(q, x.head(7).data(), 7 * sizeof(double));
-        // memcpy(qd, x.segment(7,7).data(), 7 * sizeof(double));
-
-        // plant->getForwardKinematics(q, qd, qdd, poseM, poseP, vel, accel, true);
-
-        // Eigen::Vector2d w;
-        // w = (computeContactTerms(x, R_c) - cList_bar);
-
-        // CXX.block(0,0,7,7) = rho_c * 2 * mass * (1.0/R_c) * (w(0) + w(1)) * getContactJacobianDot(q, qd).block(0,0,3,NDOF).transpose() * getContactJacobianDot(q, qd).block(0,0,3,NDOF) + \
-        //                         rho_c * 2 * getContactJacobianDot(q, qd).block(0,0,3,NDOF).transpose() * vel * mass * (1/R_c) * vel.transpose() * getContactJacobianDot(q, qd).block(0,0,3,NDOF);
-
-        CXX.block(7,7,7,7) = rho_c * 2 * mass  * (1.0/R_c) * (scratch(0) + scratch(1)) * getContactJacobian(q).block(0,0,3,NDOF).transpose() * getContactJacobian(q).block(0,0,3,NDOF) + \
-                                rho_c * 2 * getContactJacobian(q).block(0,0,3,NDOF).transpose() * vel * mass * (1/R_c) * vel.transpose() * getContactJacobian(q).block(0,0,3,NDOF);
+        const Eigen::Vector2d w = computeContactTerms(kin, x, R_c) - cList_bar;
 
-        // CXX.block(0,7,7,7) = rho_c * 2 * mass * (1.0/R_c) * (w(0) + w(1)) * getContactJacobian(q).block(0,0,3,NDOF).transpose() * getContactJacobianDot(q, qd).block(0,0,3,NDOF) + \
-        //                         rho_c * 2 * mass * getContactJacobian(q).block(0,0,3,NDOF).transpose() * vel * (1/R_c) * vel.transpose() * getContactJacobian(q).block(0,0,3,NDOF);
-        
-        CXX.block(7,0,7,7) = CXX.block(0,7,7,7).transpose();
+        // dc_0/d(q, qd)
+        Eigen::Matrix<double, 2 * NDOF, 1> g;
+        g.noalias() = (2 * mass / R_c) * (kin.dvdx.transpose() * kin.vel);
 
-        Eigen::DiagonalMatrix<double, 3> fxx(0,0,rho_c);
+        cx.head<2 * NDOF>() += (rho_c * w(0)) * g;
+        cx(16) += rho_c * w(1);
 
-        CXX.block(14,14,3,3) = fxx;
-        return CXX;
+        cxx.template topLeftCorner<2 * NDOF, 2 * NDOF>().noalias() += rho_c * g * g.transpose();
+        cxx(16,16) += rho_c;
     }
 
 };
@@ -0,0 +1,176 @@
+#ifndef COST_WEIGHTS_H
+#define COST_WEIGHTS_H
+
+#include <type_traits>
+#include <Eigen/Dense>
+
+namespace admm {
+
+/*
+ * Weight matrices of the quadratic cost terms, specialized on their structure.
+ * Every policy provides
+ *   quadratic(e)   e' W e
+ *   apply(e)       W e
+ *   addTo(H)       H += W
+ *   applyCols(E)   W E for a block of knots, one column per knot
+ *   dense()        W as a dense matrix
+ * and can be built from a dense matrix, of which only its structural non-zeros are read.
+ */
+
+/* W = diag(w), evaluated element-wise */
+template<int N>
+struct DiagonalWeight
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Vector  = Eigen::Matrix<double, N, 1>;
+    using Matrix  = Eigen::Matrix<double, N, N>;
+    using Columns = Eigen::Matrix<double, N, Eigen::Dynamic>;
+
+    Vector w;
+
+    DiagonalWeight() : w(Vector::Zero()) {}
+    explicit DiagonalWeight(const Vector& diagonal) : w(diagonal) {}
+    explicit DiagonalWeight(const Matrix& W) : w(W.diagonal()) {}
+
+    template<class Derived>
+    double quadratic(const Eigen::MatrixBase<Derived>& e) const { return e.cwiseProduct(w).dot(e); }
+
+    template<class Derived>
+    Vector apply(const Eigen::MatrixBase<Derived>& e) const { return w.cwiseProduct(e); }
+
+    void addTo(Matrix& H) const { H.diagonal() += w; }
+
+    void applyCols(const Eigen::Ref<const Columns>& E, Eigen::Ref<Columns> WE) const { WE = w.asDiagonal() * E; }
+
+    Matrix dense() const { return w.asDiagonal(); }
+};
+
+namespace detail {
+
+constexpr int sumOf() { return 0; }
+
+template<class... Rest>
+constexpr int sumOf(int size, Rest... rest) { return size + sumOf(rest...); }
+
+/* calls f(offset, size) on every block, with both as integral constants */
+template<int Offset, int... Sizes>
+struct ForEachBlock
+{
+    template<class Function>
+    static void run(Function&&) {}
+};
+
+template<int Offset, int Size, int... Rest>
+struct ForEachBlock<Offset, Size, Rest...>
+{
+    template<class Function>
+    static void run(Function&& f)
+    {
+        f(std::integral_constant<int, Offset>(), std::integral_constant<int, Size>());
+        ForEachBlock<Offset + Size, Rest...>::run(f);
+    }
+};
+
+}
+
+/* W = blkdiag(W_1, ..., W_n) with fixed block sizes, e.g. BlockDiagonalWeight<NDOF, NDOF, 3> for (q, qd, f) */
+template<int... Sizes>
+struct BlockDiagonalWeight
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static constexpr int N = detail::sumOf(Sizes...);
+
+    using Vector  = Eigen::Matrix<double, N, 1>;
+    using Matrix  = Eigen::Matrix<double, N, N>;
+    using Columns = Eigen::Matrix<double, N, Eigen::Dynamic>;
+
+    Matrix W; // zero outside the diagonal blocks
+
+    BlockDiagonalWeight() : W(Matrix::Zero()) {}
+    explicit BlockDiagonalWeight(const Matrix& full) : W(Matrix::Zero())
+    {
+        detail::ForEachBlock<0, Sizes...>::run([&](auto offset, auto size)
+        {
+            constexpr int o = decltype(offset)::value, s = decltype(size)::value;
+            W.template block<s, s>(o, o) = full.template block<s, s>(o, o);
+        });
+    }
+
+    template<class Derived>
+    double quadratic(const Eigen::MatrixBase<Derived>& e) const
+    {
+        double value = 0.0;
+        detail::ForEachBlock<0, Sizes...>::run([&](auto offset, auto size)
+        {
+            constexpr int o = decltype(offset)::value, s = decltype(size)::value;
+            value += e.template segment<s>(o).dot(W.template block<s, s>(o, o) * e.template segment<s>(o));
+        });
+        return value;
+    }
+
+    template<class Derived>
+    Vector apply(const Eigen::MatrixBase<Derived>& e) const
+    {
+        Vector We;
+        detail::ForEachBlock<0, Sizes...>::run([&](auto offset, auto size)
+        {
+            constexpr int o = decltype(offset)::value, s = decltype(size)::value;
+            We.template segment<s>(o).noalias() = W.template block<s, s>(o, o) * e.template segment<s>(o);
+        });
+        return We;
+    }
+
+    void addTo(Matrix& H) const
+    {
+        detail::ForEachBlock<0, Sizes...>::run([&](auto offset, auto size)
+        {
+            constexpr int o = decltype(offset)::value, s = decltype(size)::value;
+            H.template block<s, s>(o, o) += W.template block<s, s>(o, o);
+        });
+    }
+
+    void applyCols(const Eigen::Ref<const Columns>& E, Eigen::Ref<Columns> WE) const
+    {
+        detail::ForEachBlock<0, Sizes...>::run([&](auto offset, auto size)
+        {
+            constexpr int o = decltype(offset)::value, s = decltype(size)::value;
+            WE.template middleRows<s>(o).noalias() = W.template block<s, s>(o, o) * E.template middleRows<s>(o);
+        });
+    }
+
+    const Matrix& dense() const { return W; }
+};
+
+/* general symmetric W */
+template<int N>
+struct DenseWeight
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Vector  = Eigen::Matrix<double, N, 1>;
+    using Matrix  = Eigen::Matrix<double, N, N>;
+    using Columns = Eigen::Matrix<double, N, Eigen::Dynamic>;
+
+    Matrix W;
+
+    DenseWeight() : W(Matrix::Zero()) {}
+    explicit DenseWeight(const Matrix& full) : W(full) {}
+
+    template<class Derived>
+    double quadratic(const Eigen::MatrixBase<Derived>& e) const { return e.dot(W * e); }
+
+    template<class Derived>
+    Vector apply(const Eigen::MatrixBase<Derived>& e) const { return W * e; }
+
+    void addTo(Matrix& H) const { H += W; }
+
+    void applyCols(const Eigen::Ref<const Columns>& E, Eigen::Ref<Columns> WE) const { WE.noalias() = W * E; }
+
+    const Matrix& dense() const { return W; }
+};
+
+}
+
+#endif // COST_WEIGHTS_H
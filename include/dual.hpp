@@ -0,0 +1,121 @@
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <Eigen/Core>
+#include <cmath>
+
+namespace admm {
+
+/*
+ * Forward mode dual number with N directional derivatives, v + d eps. The derivatives are a fixed size Eigen vector,
+ * so every operation updates all N directions with vectorized loops. Seeding the inputs with the unit directions gives
+ * the value and a whole Jacobian row per output from one evaluation.
+ */
+template<int N>
+struct Dual
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Derivatives = Eigen::Matrix<double, N, 1>;
+
+    double v;
+    Derivatives d;
+
+    // uninitialized like a double, the temporaries of the Eigen expressions are not zeroed
+    Dual() {}
+    Dual(double value) : v(value), d(Derivatives::Zero()) {}
+    template<typename Derived>
+    Dual(double value, const Eigen::MatrixBase<Derived>& derivatives) : v(value), d(derivatives) {}
+
+    /* the independent variable of direction i */
+    static Dual variable(double value, int i)
+    {
+        Dual x(value);
+        x.d(i) = 1.0;
+        return x;
+    }
+
+    Dual& operator+=(const Dual& b) { v += b.v; d += b.d; return *this; }
+    Dual& operator-=(const Dual& b) { v -= b.v; d -= b.d; return *this; }
+    Dual& operator*=(const Dual& b) { d = b.v * d + v * b.d; v *= b.v; return *this; }
+    Dual& operator/=(const Dual& b) { *this = *this / b; return *this; }
+
+    friend Dual operator+(const Dual& a, const Dual& b) { return Dual(a.v + b.v, a.d + b.d); }
+    friend Dual operator-(const Dual& a, const Dual& b) { return Dual(a.v - b.v, a.d - b.d); }
+    friend Dual operator-(const Dual& a) { return Dual(-a.v, -a.d); }
+    friend Dual operator*(const Dual& a, const Dual& b) { return Dual(a.v * b.v, b.v * a.d + a.v * b.d); }
+    friend Dual operator/(const Dual& a, const Dual& b) { return Dual(a.v / b.v, (b.v * a.d - a.v * b.d) / (b.v * b.v)); }
+
+    friend Dual operator+(const Dual& a, double b) { return Dual(a.v + b, a.d); }
+    friend Dual operator+(double a, const Dual& b) { return Dual(a + b.v, b.d); }
+    friend Dual operator-(const Dual& a, double b) { return Dual(a.v - b, a.d); }
+    friend Dual operator-(double a, const Dual& b) { return Dual(a - b.v, -b.d); }
+    friend Dual operator*(const Dual& a, double b) { return Dual(a.v * b, b * a.d); }
+    friend Dual operator*(double a, const Dual& b) { return Dual(a * b.v, a * b.d); }
+    friend Dual operator/(const Dual& a, double b) { return Dual(a.v / b, a.d / b); }
+
+    friend bool operator<(const Dual& a, const Dual& b) { return a.v < b.v; }
+    friend bool operator>(const Dual& a, const Dual& b) { return a.v > b.v; }
+    friend bool operator<=(const Dual& a, const Dual& b) { return a.v <= b.v; }
+    friend bool operator>=(const Dual& a, const Dual& b) { return a.v >= b.v; }
+    friend bool operator==(const Dual& a, const Dual& b) { return a.v == b.v; }
+    friend bool operator!=(const Dual& a, const Dual& b) { return a.v != b.v; }
+
+    friend Dual sin(const Dual& a) { return Dual(std::sin(a.v), std::cos(a.v) * a.d); }
+    friend Dual cos(const Dual& a) { return Dual(std::cos(a.v), -std::sin(a.v) * a.d); }
+    friend Dual abs(const Dual& a) { return a.v < 0 ? -a : a; }
+    friend Dual sqrt(const Dual& a)
+    {
+        const double s = std::sqrt(a.v);
+        return Dual(s, (0.5 / s) * a.d);
+    }
+
+    /* constant exponent, x^0 has no derivative even where x^-1 does not exist */
+    friend Dual pow(const Dual& a, double b)
+    {
+        if (b == 0.0) return Dual(1.0);
+        return Dual(std::pow(a.v, b), b * std::pow(a.v, b - 1.0) * a.d);
+    }
+
+    friend Dual pow(const Dual& a, const Dual& b)
+    {
+        if (b.d.isZero(0.0)) return pow(a, b.v);
+        const double p = std::pow(a.v, b.v);
+        return Dual(p, b.v * std::pow(a.v, b.v - 1.0) * a.d + p * std::log(a.v) * b.d);
+    }
+};
+
+}
+
+namespace Eigen {
+
+template<int N>
+struct NumTraits<admm::Dual<N>> : NumTraits<double>
+{
+    typedef admm::Dual<N> Real;
+    typedef admm::Dual<N> NonInteger;
+    typedef admm::Dual<N> Nested;
+    typedef admm::Dual<N> Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = N + 1,
+        AddCost = N + 1,
+        MulCost = 2 * N + 1
+    };
+};
+
+// double coefficients, e.g. the inertias of a model, multiply duals without being promoted first
+template<int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<admm::Dual<N>, double, BinaryOp> { typedef admm::Dual<N> ReturnType; };
+
+template<int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, admm::Dual<N>, BinaryOp> { typedef admm::Dual<N> ReturnType; };
+
+}
+
+#endif // DUAL_H
@@ -5,16 +5,37 @@
 #include <iostream>
 #include <unsupported/Eigen/NumericalDiff>
 #include <Eigen/Geometry>
+#include <Eigen/LU>
 
 #include <math.h>
+#include <cmath>
+#include <algorithm>
 #include <memory>
 #include <functional>
 #include <thread>
 
 #include <mutex>
+#include <vector>
+
+#include "parallel.hpp"
+#include "jacobian_pattern.hpp"
 
 namespace admm {
 
+/*
+ * discrete Jacobians fx, fu of Dynamics::fx with the RK4 integrator: the forward Euler approximation I + A dt, B dt of the
+ * continuous A, B, or the exact sensitivities of the RK4 step the rollouts integrate with. The structured Riccati kernel
+ * assumes Euler.
+ */
+enum class Linearization { Euler, RK4 };
+
+/*
+ * integrator of Dynamics::step. Rosenbrock is the linearly implicit Euler step x+ = x + dt (I - dt A)^-1 f(x, u), A = df/dx,
+ * which stays stable on the stiff contact force at time steps where RK4 diverges. fx then linearizes that step, at the
+ * cost of a second evaluation of A per knot, two more with the finite differences of the default linearize.
+ */
+enum class Integrator { RK4, Rosenbrock };
+
 template<typename System, int StateDim, int ControlDim>
 class Dynamics
 {
@@ -57,53 +78,296 @@ protected:
     using State    = Eigen::Matrix<Scalar, StateDim, 1>;
     using Control  = Eigen::Matrix<Scalar, ControlDim, 1>;
 
+    using StateMatrix   = Eigen::Matrix<Scalar, StateDim, StateDim>;
+    using ControlMatrix = Eigen::Matrix<Scalar, StateDim, ControlDim>;
+
     using JacobianState   = stateMatTab_t;
     using JacobianControl = stateR_commandC_tab_t;
+    using Pattern         = JacobianPattern<StateDim, ControlDim>;
 
     Scalar dt;
     int N;
+    Linearization linearization_ = Linearization::Euler;
+    Integrator integrator_ = Integrator::RK4;
 
     JacobianState fxList;
     JacobianControl fuList;
 
+    // structural non-zeros of [dF/dx, dF/du], models that know their structure narrow it down
+    Pattern pattern_ = Pattern::dense();
+
+public:
+    /* caller owned scratch for the reentrant f. models extend it with their own buffers */
+    struct Workspace
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        virtual ~Workspace() {}
+        State xdot;
+    };
+
+protected:
+    using NumDiff = Eigen::NumericalDiff<Differentiable<double, stateSize, commandSize>, Eigen::Forward>;
+
+    /* workers used to split the horizon in fx, each with its own jacobian buffer, workspace and differentiator */
+    std::shared_ptr<ThreadPool> pool_ = std::make_shared<ThreadPool>(1);
+    std::vector<Jacobian, Eigen::aligned_allocator<Jacobian>> jacobianThreads_;
+    std::vector<std::unique_ptr<Workspace>> workspaceThreads_;
+    std::vector<std::unique_ptr<NumDiff>> numDiffThreads_;
+
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
     std::shared_ptr<System> m_system;
     
     Jacobian jacobian;
     Differentiable<double, stateSize, commandSize> diff_;
-    Eigen::NumericalDiff<Differentiable<double, stateSize, commandSize>, Eigen::Forward> num_diff_;
+    NumDiff num_diff_;
 
     Dynamics() = default;
     Dynamics(double timeStep, unsigned int Nsteps, const std::shared_ptr<System>& system) 
                     : m_system(system), 
                       diff_([this](const stateVec_t& x, const commandVec_t& u) -> stateVec_t{ return this->f(x, u); }), 
-                      num_diff_(diff_), dt(timeStep), N(Nsteps) {}
+                      num_diff_(diff_), dt(timeStep), N(Nsteps)
+    {
+        fxList.resize(N + 1), fuList.resize(N);
+    }
 
     ~Dynamics() = default;
-    Dynamics(const Dynamics &other) = default;
+    Dynamics(const Dynamics &other) = delete;
 
-    Dynamics& operator=(const Dynamics &other) = default;
+    Dynamics& operator=(const Dynamics &other) = delete;
 
     virtual const State& f(const stateVec_t& x, const commandVec_t& tau) = 0;
+
+    /* reentrant dynamics, all scratch lives in ws. by default fall back to f above */
+    virtual const State& f(const stateVec_t& x, const commandVec_t& tau, Workspace& ws)
+    {
+        ws.xdot = f(x, tau);
+        return ws.xdot;
+    }
+
+    /*
+     * f on each column of (X, U) into Xdot. one call of the reentrant f per column by default, backends with a lane
+     * parallel f evaluate several columns per call
+     */
+    virtual void f_batch(const Eigen::Ref<const stateVecTab_t>& X, const Eigen::Ref<const commandVecTab_t>& U, Eigen::Ref<stateVecTab_t> Xdot, Workspace& ws)
+    {
+        for (int j = 0; j < X.cols(); j++) { Xdot.col(j) = f(X.col(j), U.col(j), ws); }
+    }
+
+    /* continuous A = df/dx and B = df/du at (x, u), forward differences of f by default, the points in one batch */
+    virtual void linearize(const State& x, const Control& u, Workspace& ws, StateMatrix& A, ControlMatrix& B)
+    {
+        Eigen::Matrix<Scalar, StateDim, StateDim + ControlDim + 1> X, Xdot;
+        Eigen::Matrix<Scalar, ControlDim, StateDim + ControlDim + 1> U;
+        Eigen::Matrix<Scalar, StateDim + ControlDim, 1> h;
+
+        // column 0 is (x, u), column j + 1 steps input j
+        X.colwise() = x;
+        U.colwise() = u;
+        for (int j = 0; j < StateDim; j++)
+        {
+            h(j) = std::sqrt(Eigen::NumTraits<Scalar>::epsilon()) * std::max(Scalar(1), std::abs(x(j)));
+            X(j, j + 1) += h(j);
+        }
+        for (int j = 0; j < ControlDim; j++)
+        {
+            h(StateDim + j) = std::sqrt(Eigen::NumTraits<Scalar>::epsilon()) * std::max(Scalar(1), std::abs(u(j)));
+            U(j, StateDim + j + 1) += h(StateDim + j);
+        }
+
+        f_batch(X, U, Xdot, ws);
+
+        for (int j = 0; j < StateDim; j++) { A.col(j) = (Xdot.col(j + 1) - Xdot.col(0)) / h(j); }
+        for (int j = 0; j < ControlDim; j++) { B.col(j) = (Xdot.col(StateDim + j + 1) - Xdot.col(0)) / h(StateDim + j); }
+    }
+
+    /* true if linearize is exact up to rounding (generated or forward mode code), not the finite differences above */
+    virtual bool hasExactLinearization() const {return false;}
+
+    /* one integration step of length dt from x, classical RK4 on the reentrant f by default */
+    virtual State step(const State& x, const Control& u, Workspace& ws)
+    {
+        if (integrator_ == Integrator::Rosenbrock)
+        {
+            StateMatrix A;
+            ControlMatrix B;
+            const State x_dot = f(x, u, ws);
+            linearize(x, u, ws, A, B);
+
+            return x + dt * (StateMatrix::Identity() - dt * A).partialPivLu().solve(x_dot);
+        }
+
+        const State x_dot1 = f(x, u, ws);
+        const State x_dot2 = f(x + 0.5 * dt * x_dot1, u, ws);
+        const State x_dot3 = f(x + 0.5 * dt * x_dot2, u, ws);
+        const State x_dot4 = f(x + dt * x_dot3, u, ws);
+
+        return x + (dt/6) * (x_dot1 + 2 * x_dot2 + 2 * x_dot3 + x_dot4);
+    }
+
+    virtual std::unique_ptr<Workspace> createWorkspace() {return std::unique_ptr<Workspace>(new Workspace());}
+
+    Scalar getTimeStep() const {return dt;}
     
-    /* by default call the numerical differentiation*/
+    /* number of worker threads the horizon is split across in fx */
+    virtual void setNumThreads(unsigned int numThreads)
+    {
+        pool_ = std::make_shared<ThreadPool>(numThreads);
+    }
+
+    unsigned int getNumThreads() const {return pool_->size();}
+
+    /* discretization of the Jacobians computed by fx. the solvers pick their Riccati kernel from it at the start of each solve */
+    virtual void setLinearization(Linearization linearization) {linearization_ = linearization;}
+    Linearization getLinearization() const {return linearization_;}
+
+    /* integrator of step, fx follows it */
+    virtual void setIntegrator(Integrator integrator) {integrator_ = integrator;}
+    Integrator getIntegrator() const {return integrator_;}
+
+    /* true if fx is the forward Euler approximation I + A dt, B dt */
+    bool hasEulerJacobians() const {return integrator_ == Integrator::RK4 && linearization_ == Linearization::Euler;}
+
+    /* by default call the numerical differentiation, each worker evaluates f in its own workspace */
     virtual void fx(const stateVecTab_t& xList, const commandVecTab_t& uList)
     {
-        // TODO parallalize here
-        for (unsigned int k=0; k < N; k++) 
+        if (numDiffThreads_.size() != pool_->size()) {createThreadData();}
+
+        pool_->parallel_for(N, [&](unsigned int threadId, int begin, int end)
         {
-            /* Numdiff Eigen */
-            num_diff_.df((typename Differentiable<double, stateSize, commandSize>::InputType() << xList.col(k), uList.col(k)).finished(), jacobian);
-            fxList[k] = jacobian.leftCols(stateSize) * dt + Eigen::Matrix<double, stateSize, stateSize>::Identity();
-            fuList[k] = jacobian.rightCols(commandSize) * dt;
-        }
+            Jacobian& jac = jacobianThreads_[threadId];
 
+            for (int k = begin; k < end; k++) 
+            {
+                if (!hasEulerJacobians())
+                {
+                    discretize(xList.col(k), uList.col(k), *workspaceThreads_[threadId], fxList[k], fuList[k]);
+                    continue;
+                }
+
+                /* Numdiff Eigen */
+                numDiffThreads_[threadId]->df((typename Differentiable<double, stateSize, commandSize>::InputType() << xList.col(k), uList.col(k)).finished(), jac);
+                fxList[k] = jac.leftCols(stateSize) * dt + Eigen::Matrix<double, stateSize, stateSize>::Identity();
+                fuList[k] = jac.rightCols(commandSize) * dt;
+            }
+        });
     }
 
     const std::shared_ptr<System>& getSystem() {return m_system;}
+    const Pattern& getJacobianPattern() const {return pattern_;}
     virtual const JacobianState& getfxList() const {return fxList;}
     virtual const JacobianControl& getfuList() const {return fuList;}
+
+protected:
+    /* fx and fu of step for the current integrator and linearization, from the continuous Jacobians of linearize */
+    void discretize(const State& x, const Control& u, Workspace& ws, StateMatrix& fx, ControlMatrix& fu)
+    {
+        StateMatrix A;
+        ControlMatrix B;
+
+        if (integrator_ == Integrator::Rosenbrock)
+        {
+            // x+ = x + dt g, g = W^-1 f, W = I - dt A. W moves with (x, u) too: dg = W^-1 (dF + dt (dA) g), with dA g
+            // the derivative of [A, B] along g, taken by differencing linearize along g
+            const State x_dot = f(x, u, ws);
+            linearize(x, u, ws, A, B);
+            const Eigen::PartialPivLU<StateMatrix> W(StateMatrix::Identity() - dt * A);
+            const State g = W.solve(x_dot);
+
+            StateMatrix Ag = A;
+            ControlMatrix Bg = B;
+            if (g.norm() > 0)
+            {
+                StateMatrix Ah, Al;
+                ControlMatrix Bh, Bl;
+                const Scalar eps = Eigen::NumTraits<Scalar>::epsilon();
+                const Scalar scale = std::max(Scalar(1), x.norm()) / g.norm();
+                if (hasExactLinearization())
+                {
+                    const Scalar h = std::sqrt(eps) * scale;
+                    linearize(x + h * g, u, ws, Ah, Bh);
+                    Ag += (dt / h) * (Ah - A);
+                    Bg += (dt / h) * (Bh - B);
+                }
+                else
+                {
+                    // A already carries the O(sqrt(eps)) error of the forward differences, a second forward difference at
+                    // a sqrt(eps) step would amplify it to O(1). Central differences at a step of eps^(1/4) instead
+                    const Scalar h = std::sqrt(std::sqrt(eps)) * scale;
+                    linearize(x + h * g, u, ws, Ah, Bh);
+                    linearize(x - h * g, u, ws, Al, Bl);
+                    Ag += (dt / (2 * h)) * (Ah - Al);
+                    Bg += (dt / (2 * h)) * (Bh - Bl);
+                }
+            }
+
+            fx = dt * W.solve(Ag);
+            fx.diagonal().array() += 1.0;
+            fu = dt * W.solve(Bg);
+        }
+        else if (linearization_ == Linearization::RK4)
+        {
+            linearizeRK4(x, u, ws, fx, fu);
+        }
+        else
+        {
+            linearize(x, u, ws, A, B);
+            fx = dt * A;
+            fx.diagonal().array() += 1.0;
+            fu = dt * B;
+        }
+    }
+
+    /*
+     * exact fx = dx+/dx and fu = dx+/du of the RK4 step: the continuous Jacobians at the four stage points
+     * x_i = x + c_i dt k_{i-1}, k_i = f(x_i, u), carried through the stages by the chain rule
+     */
+    void linearizeRK4(const State& x, const Control& u, Workspace& ws, StateMatrix& fx, ControlMatrix& fu)
+    {
+        static const double c[4] = {0.0, 0.5, 0.5, 1.0};
+        static const double w[4] = {1.0, 2.0, 2.0, 1.0};
+
+        State xs = x, k;
+        StateMatrix A, dxs_dx = StateMatrix::Identity(), dk_dx;
+        ControlMatrix B, dxs_du = ControlMatrix::Zero(), dk_du;
+
+        fx.setIdentity();
+        fu.setZero();
+        for (int i = 0; i < 4; i++)
+        {
+            k = f(xs, u, ws);
+            linearize(xs, u, ws, A, B);
+
+            dk_dx.noalias() = A * dxs_dx;
+            dk_du.noalias() = A * dxs_du;
+            dk_du += B;
+            fx += (w[i] * dt / 6) * dk_dx;
+            fu += (w[i] * dt / 6) * dk_du;
+
+            if (i < 3)
+            {
+                xs = x + c[i + 1] * dt * k;
+                dxs_dx = c[i + 1] * dt * dk_dx;
+                dxs_dx.diagonal().array() += 1.0;
+                dxs_du = c[i + 1] * dt * dk_du;
+            }
+        }
+    }
+
+    void createThreadData()
+    {
+        jacobianThreads_.resize(pool_->size());
+        workspaceThreads_.clear();
+        numDiffThreads_.clear();
+
+        for (unsigned int t = 0; t < pool_->size(); t++)
+        {
+            workspaceThreads_.push_back(createWorkspace());
+            Workspace* ws = workspaceThreads_.back().get();
+            numDiffThreads_.emplace_back(new NumDiff(Differentiable<double, stateSize, commandSize>(
+                [this, ws](const stateVec_t& x, const commandVec_t& u) -> stateVec_t{ return this->f(x, u, *ws); })));
+        }
+    }
 };
 
 }
@@ -0,0 +1,68 @@
+#ifndef JACOBIAN_DERIVATIVE_H
+#define JACOBIAN_DERIVATIVE_H
+
+#include <Eigen/Dense>
+
+namespace admm {
+
+/*
+ * Time derivative of the linear rows Jv of a geometric end-effector Jacobian of a revolute serial chain, from the angular
+ * rows Jw (the joint axes) and Jv alone. With w_i = sum_{j <= i} qd_j Jw_j the angular velocity of body i, column i is
+ *
+ *     dJv_i/dt = w_i x Jv_i + Jw_i x sum_{j > i} qd_j Jv_j
+ *
+ * which is the double loop over joint pairs of d(Jv_i)/dq_j qd_j summed once. The scalar is templated, so the same code
+ * runs in double and on the AD / codegen scalars of the ct systems.
+ */
+
+/* end-effector velocity Jv qd and bias acceleration dJv/dt qd, in one sweep base to tip */
+template<typename DerivedW, typename DerivedV, typename DerivedQd, typename Vector3>
+void endEffectorVelocityAndBias(const Eigen::MatrixBase<DerivedW>& Jw, const Eigen::MatrixBase<DerivedV>& Jv, const Eigen::MatrixBase<DerivedQd>& qd,
+                                Vector3& vel, Vector3& bias)
+{
+    typedef typename DerivedV::Scalar Scalar;
+    typedef Eigen::Matrix<Scalar, 3, 1> Vec3;
+
+    // summed over i, the second term above is sum_j qd_j w_{j-1} x Jv_j
+    Vec3 w = Vec3::Zero(), w_next;
+    vel.setZero();
+    bias.setZero();
+    for (int j = 0; j < Jv.cols(); j++)
+    {
+        const Vec3 Jv_j = Jv.col(j);
+        w_next = w + qd(j) * Jw.col(j);
+        vel += qd(j) * Jv_j;
+        bias += qd(j) * (w + w_next).cross(Jv_j);
+        w = w_next;
+    }
+}
+
+/* every column of dJv/dt, a sweep base to tip for w_i and one back for the sum over the outer joints */
+template<typename DerivedW, typename DerivedV, typename DerivedQd, typename DerivedOut>
+void linearJacobianDerivative(const Eigen::MatrixBase<DerivedW>& Jw, const Eigen::MatrixBase<DerivedV>& Jv, const Eigen::MatrixBase<DerivedQd>& qd,
+                              const Eigen::MatrixBase<DerivedOut>& JvDot_)
+{
+    typedef typename DerivedV::Scalar Scalar;
+    typedef Eigen::Matrix<Scalar, 3, 1> Vec3;
+    Eigen::MatrixBase<DerivedOut>& JvDot = const_cast<Eigen::MatrixBase<DerivedOut>&>(JvDot_);
+
+    // w_i, kept in the output until the column is finished
+    Vec3 w = Vec3::Zero();
+    for (int j = 0; j < Jv.cols(); j++)
+    {
+        w += qd(j) * Jw.col(j);
+        JvDot.col(j) = w;
+    }
+
+    Vec3 outer = Vec3::Zero();
+    for (int j = Jv.cols() - 1; j >= 0; j--)
+    {
+        const Vec3 w_j = JvDot.col(j), Jv_j = Jv.col(j);
+        JvDot.col(j) = w_j.cross(Jv_j) + Vec3(Jw.col(j)).cross(outer);
+        outer += qd(j) * Jv_j;
+    }
+}
+
+}
+
+#endif // JACOBIAN_DERIVATIVE_H
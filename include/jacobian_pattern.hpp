@@ -0,0 +1,90 @@
+#ifndef JACOBIAN_PATTERN_H
+#define JACOBIAN_PATTERN_H
+
+#include <Eigen/Dense>
+
+namespace admm {
+
+/*
+ * Structural non-zeros of the continuous time Jacobian F = [dF/dx, dF/du] of a model, as emitted by the sparse codegen
+ * (FusedLinearizationCodegen.h) or known from the model. Entries outside the pattern are zero at every (x, u), so
+ * consumers can skip those blocks: scatterDiscrete writes only the non-zeros, the backward pass picks its Riccati kernel
+ * from it (riccati_kernels.hpp).
+ */
+template<int StateDim, int ControlDim>
+struct JacobianPattern
+{
+    using Mask          = Eigen::Array<bool, StateDim, StateDim + ControlDim>;
+    using StateMatrix   = Eigen::Matrix<double, StateDim, StateDim>;
+    using ControlMatrix = Eigen::Matrix<double, StateDim, ControlDim>;
+
+    Mask nonzero;
+
+    /* no structure known, every entry may be non-zero */
+    static JacobianPattern dense()
+    {
+        JacobianPattern pattern;
+        pattern.nonzero.setConstant(true);
+        return pattern;
+    }
+
+    /* from the (row, column) list of a compressed Jacobian, columns counted over (x, u) */
+    static JacobianPattern fromTriplets(const int* rows, const int* cols, int nnz)
+    {
+        JacobianPattern pattern;
+        pattern.nonzero.setConstant(false);
+        for (int i = 0; i < nnz; i++) { pattern.nonzero(rows[i], cols[i]) = true; }
+        return pattern;
+    }
+
+    /* true if every entry of the block is a structural zero */
+    bool zero(int row, int col, int rows, int cols) const { return !nonzero.block(row, col, rows, cols).any(); }
+
+    /* true if the first n rows are x_dot_i = x_{n+i}, i.e. the position rows of a second order system with velocity states */
+    bool hasKinematicRows(int n) const
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (nonzero.row(i).count() != 1 || !nonzero(i, n + i)) return false;
+        }
+        return true;
+    }
+
+    int nonZeros() const { return nonzero.count(); }
+
+    /*
+     * forward Euler fx = I + A dt and fu = B dt from the compressed values of the non-zeros in (rows, cols) order.
+     * Only the non-zeros are written, the structural zeros of fx and fu are set once by the caller (see clearDiscrete).
+     */
+    static void scatterDiscrete(const int* rows, const int* cols, int nnz, const double* values, double dt, StateMatrix& fx, ControlMatrix& fu)
+    {
+        for (int i = 0; i < nnz; i++)
+        {
+            if (cols[i] < StateDim) { fx(rows[i], cols[i]) = (rows[i] == cols[i] ? 1.0 : 0.0) + dt * values[i]; }
+            else { fu(rows[i], cols[i] - StateDim) = dt * values[i]; }
+        }
+    }
+
+    /* the entries of fx and fu that scatterDiscrete never writes: identity on the diagonal of fx, zero elsewhere */
+    static void clearDiscrete(StateMatrix& fx, ControlMatrix& fu)
+    {
+        fx.setIdentity();
+        fu.setZero();
+    }
+
+    /* dense A and B from the compressed values, the adapter for consumers of the dense types */
+    static void scatter(const int* rows, const int* cols, int nnz, const double* values, StateMatrix& A, ControlMatrix& B)
+    {
+        A.setZero();
+        B.setZero();
+        for (int i = 0; i < nnz; i++)
+        {
+            if (cols[i] < StateDim) { A(rows[i], cols[i]) = values[i]; }
+            else { B(rows[i], cols[i] - StateDim) = values[i]; }
+        }
+    }
+};
+
+}
+
+#endif // JACOBIAN_PATTERN_H
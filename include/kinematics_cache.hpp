@@ -0,0 +1,141 @@
+#ifndef KINEMATICS_CACHE_H
+#define KINEMATICS_CACHE_H
+
+#include "config.h"
+#include "RobotAbstract.h"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <Eigen/Dense>
+#include <Eigen/StdVector>
+
+namespace admm {
+
+/* end-effector kinematics of one knot, at the joint state (q, qd) it was computed for */
+struct KinematicsEntry
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    stateVec_half_t q;
+    stateVec_half_t qd;
+
+    Eigen::Matrix3d poseM;
+    Eigen::Vector3d poseP;
+    Eigen::Vector3d vel;                    // end-effector linear velocity
+    Eigen::Matrix<double, 6, NDOF> J;       // spatial Jacobian, linear rows first
+    Eigen::Matrix<double, 6, NDOF> Jdot;    // only filled when the cache computes it, zero otherwise
+    Eigen::Matrix<double, 3, 2 * NDOF> dvdx;  // dvel/d(q, qd), likewise
+    bool dvdxExact{false};                  // false if the model has no dvel/dq, see RobotAbstract::getEEVelocityJacobian
+
+    unsigned long version{0};               // cache version the entry was last computed in
+    bool valid{false};
+};
+
+/*
+ * Per-knot end-effector kinematics of a state trajectory, shared by the cost, the contact terms and the ADMM contact block.
+ * update() recomputes, in parallel, only the knots whose joint state changed since they were cached,
+ * so calling it again on the same trajectory (e.g. the accepted rollout) costs a comparison per knot.
+ */
+class KinematicsCache
+{
+public:
+    using Entries = std::vector<KinematicsEntry, Eigen::aligned_allocator<KinematicsEntry>>;
+
+    KinematicsCache(const std::shared_ptr<RobotAbstract>& robotModel, unsigned int Nsteps, bool computeJacobianDot = false, bool computeVelocityJacobian = false)
+        : plant(robotModel), entries(Nsteps + 1), withJacobianDot(computeJacobianDot), withVelocityJacobian(computeVelocityJacobian)
+    {
+        setNumThreads(1);
+    }
+
+    KinematicsCache(const KinematicsCache& other) = delete;
+    KinematicsCache& operator=(const KinematicsCache& other) = delete;
+
+    /* number of worker threads the horizon is split across in update */
+    void setNumThreads(unsigned int numThreads)
+    {
+        pool.resize(numThreads);
+
+        workspaces.clear();
+        for (unsigned int t = 0; t < pool.size(); t++) { workspaces.push_back(plant->createWorkspace()); }
+        recomputed.assign(pool.size(), 0);
+    }
+
+    /* bring every knot in line with xList, returns the number of knots recomputed */
+    int update(const stateVecTab_t& xList)
+    {
+        const int n = std::min<int>(xList.cols(), entries.size());
+        const unsigned long next = version_ + 1;
+
+        pool.parallel_for(n, [&](unsigned int threadId, int begin, int end)
+        {
+            int computed = 0;
+            for (int k = begin; k < end; k++)
+            {
+                if (matches(k, xList.col(k))) continue;
+                compute(*workspaces[threadId], xList.col(k), entries[k]);
+                entries[k].version = next;
+                computed++;
+            }
+            recomputed[threadId] = computed;
+        });
+
+        int total = 0;
+        for (int& r : recomputed) { total += r; r = 0; }
+        if (total > 0) version_ = next;
+
+        return total;
+    }
+
+    /* true if knot k is cached for the joint state of x */
+    bool matches(int k, const Eigen::Ref<const stateVec_t>& x) const
+    {
+        const KinematicsEntry& e = entries[k];
+        return e.valid && e.q == x.head<NDOF>() && e.qd == x.segment<NDOF>(NDOF);
+    }
+
+    void invalidate()
+    {
+        for (auto& e : entries) { e.valid = false; }
+    }
+
+    const KinematicsEntry& operator[](int k) const { return entries[k]; }
+
+    /* incremented by every update that recomputed a knot */
+    unsigned long version() const { return version_; }
+
+    int size() const { return entries.size(); }
+
+    /* workers of update, also used by the consumers to sweep the horizon in the same chunks */
+    ThreadPool& threadPool() { return pool; }
+
+private:
+    void compute(RobotAbstractWorkspace& ws, const Eigen::Ref<const stateVec_t>& x, KinematicsEntry& e) const
+    {
+        e.q  = x.head<NDOF>();
+        e.qd = x.segment<NDOF>(NDOF);
+
+        plant->getKinematics(ws, e.q.data(), e.qd.data(), e.poseM, e.poseP, e.vel, e.J, e.Jdot, withJacobianDot);
+        if (!withJacobianDot) { e.Jdot.setZero(); }
+
+        if (withVelocityJacobian) { e.dvdxExact = plant->getEEVelocityJacobian(ws, e.q.data(), e.qd.data(), e.dvdx); }
+        else { e.dvdx.setZero(); e.dvdxExact = false; }
+
+        e.valid = true;
+    }
+
+    std::shared_ptr<RobotAbstract> plant;
+    Entries entries;
+    bool withJacobianDot;
+    bool withVelocityJacobian;
+    unsigned long version_{0};
+
+    ThreadPool pool;
+    std::vector<std::unique_ptr<RobotAbstractWorkspace>> workspaces;
+    std::vector<int> recomputed;        // knots recomputed by each thread in the last update
+};
+
+}
+
+#endif // KINEMATICS_CACHE_H
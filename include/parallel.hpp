@@ -0,0 +1,137 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace admm {
+
+/*
+ * Persistent pool of worker threads for splitting a horizon of knot points.
+ * The calling thread takes part as thread 0, so a pool of size one runs everything inline.
+ * Dispatching a job does not allocate. parallel_for is not reentrant: do not call it from inside a job.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned int numThreads = 1) { resize(numThreads); }
+    ~ThreadPool() { stop(); }
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    unsigned int size() const { return numThreads_; }
+
+    void resize(unsigned int numThreads)
+    {
+        stop();
+
+        numThreads_ = std::max(1u, numThreads);
+        shutdown_   = false;
+        generation_ = 0;
+
+        for (unsigned int t = 1; t < numThreads_; t++)
+        {
+            workers_.emplace_back(&ThreadPool::workerLoop, this, t);
+        }
+    }
+
+    /* first index of the contiguous chunk of [0, n) owned by threadId */
+    int chunkBegin(int n, unsigned int threadId) const
+    {
+        return static_cast<int>((static_cast<long>(n) * threadId) / numThreads_);
+    }
+
+    /* split [0, n) into one contiguous chunk per thread and call fn(threadId, begin, end) on each */
+    template<class Function>
+    void parallel_for(int n, Function&& fn)
+    {
+        using F = typename std::remove_reference<Function>::type;
+
+        if (numThreads_ == 1 || n < 2)
+        {
+            fn(0u, 0, n);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            task_    = &ThreadPool::invoke<F>;
+            context_ = const_cast<void*>(static_cast<const void*>(&fn));
+            n_       = n;
+            pending_ = numThreads_ - 1;
+            generation_++;
+        }
+        wake_.notify_all();
+
+        fn(0u, chunkBegin(n, 0), chunkBegin(n, 1));
+
+        std::unique_lock<std::mutex> lk(mu_);
+        done_.wait(lk, [this] { return pending_ == 0; });
+    }
+
+private:
+    using Task = void (*)(void*, unsigned int, int, int);
+
+    template<class F>
+    static void invoke(void* context, unsigned int threadId, int begin, int end)
+    {
+        (*static_cast<F*>(context))(threadId, begin, end);
+    }
+
+    void workerLoop(unsigned int threadId)
+    {
+        unsigned long seen = 0;
+
+        for (;;)
+        {
+            std::unique_lock<std::mutex> lk(mu_);
+            wake_.wait(lk, [&] { return shutdown_ || generation_ != seen; });
+            if (shutdown_) return;
+
+            seen = generation_;
+            Task task     = task_;
+            void* context = context_;
+            int n         = n_;
+            lk.unlock();
+
+            task(context, threadId, chunkBegin(n, threadId), chunkBegin(n, threadId + 1));
+
+            lk.lock();
+            if (--pending_ == 0) done_.notify_one();
+        }
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            shutdown_ = true;
+        }
+        wake_.notify_all();
+
+        for (auto& worker : workers_) worker.join();
+        workers_.clear();
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mu_;
+    std::condition_variable wake_, done_;
+
+    unsigned int numThreads_{1};
+    unsigned int pending_{0};
+    unsigned long generation_{0};
+    bool shutdown_{false};
+
+    Task task_{nullptr};
+    void* context_{nullptr};
+    int n_{0};
+};
+
+}
+
+#endif // PARALLEL_H
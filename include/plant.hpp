@@ -13,6 +13,7 @@ public:
     using Scalar   = double;
     using State    = Eigen::Matrix<Scalar, StateSize, 1>;
     using Control  = Eigen::Matrix<Scalar, ControlSize, 1>;
+    using DynamicsModel = Dynamics;
 
     std::shared_ptr<Dynamics> m_plantDynamics;
     Scalar dt;
@@ -0,0 +1,146 @@
+#ifndef RICCATI_KERNELS_H
+#define RICCATI_KERNELS_H
+
+#include "config.h"
+#include "jacobian_pattern.hpp"
+#include <Eigen/Dense>
+
+namespace admm {
+
+// columns of the stateVecTab_t / commandVecTab_t horizons, passed without copies
+using StateVecRef        = Eigen::Ref<stateVec_t>;
+using ConstStateVecRef   = Eigen::Ref<const stateVec_t>;
+using ConstCommandVecRef = Eigen::Ref<const commandVec_t>;
+
+/*
+ * Per-knot kernels of the iLQR backward pass:
+ *   expand:  Q-function expansion around the knot, given the cost derivatives, the discrete Jacobians and V' of the next knot
+ *   value:   cost-to-go V of the knot for the control law du = k + K dx
+ * The solvers call them through RiccatiKernel, which picks one from STRUCTURED_RICCATI in config.h, the Jacobian pattern of the dynamics
+ * and whether their fx is the forward Euler approximation (admm::Dynamics::hasEulerJacobians).
+ */
+
+/* dense reference implementation, valid for any fx, fu and cux */
+struct GenericRiccati
+{
+    static void expand(double /*dt*/, const ConstStateVecRef& cx, const ConstCommandVecRef& cu, const stateMat_t& cxx, const commandMat_t& cuu, const commandR_stateC_t& cux,
+                       const stateMat_t& fx, const stateR_commandC_t& fu, const ConstStateVecRef& Vx, const stateMat_t& Vxx,
+                       stateVec_t& Qx, commandVec_t& Qu, stateMat_t& Qxx, commandMat_t& Quu, commandR_stateC_t& Qux)
+    {
+        Qx  = cx  + fx.transpose() * Vx;
+        Qu  = cu  + fu.transpose() * Vx;
+        Qxx = cxx + fx.transpose() * Vxx * fx;
+        Quu = cuu + fu.transpose() * Vxx * fu;
+        Qux = cux + fu.transpose() * Vxx * fx;
+    }
+
+    static void value(const stateVec_t& Qx, const commandVec_t& Qu, const stateMat_t& Qxx, const commandMat_t& Quu, const commandR_stateC_t& Qux,
+                      const commandVec_t& k, const commandR_stateC_t& K, StateVecRef Vx, stateMat_t& Vxx)
+    {
+        Vx  = Qx  + K.transpose() * Quu * k + K.transpose() * Qu  + Qux.transpose() * k;
+        Vxx = Qxx + K.transpose() * Quu * K + K.transpose() * Qux + Qux.transpose() * K;
+        Vxx = 0.5 * (Vxx + Vxx.transpose()).eval();
+    }
+};
+
+/*
+ * Soft-contact model with state (q, qd, f) and the forward Euler discretization fx = I + A dt, fu = B dt:
+ *   - the q rows of fx are [I, dt I, 0] and the q rows of fu are zero, only the (qd, f) rows are dense
+ *   - cux is zero for the ADMM cost
+ *   - Vxx is symmetrized by copying its lower triangle instead of averaging
+ * Products are small fixed-size, evaluated lazily. About half the flops of GenericRiccati.
+ * Not valid for other discretizations (e.g. exact RK4 sensitivities).
+ */
+struct SoftContactRiccati
+{
+    static const int nq = NDOF;               // rows of fx that are [I, dt I, 0]
+    static const int nd = stateSize - NDOF;   // dense rows (qd, f)
+
+    using DenseRows = Eigen::Matrix<double, nd, stateSize>;
+    using Coupling  = Eigen::Matrix<double, nq, stateSize>;
+
+    static void expand(double dt, const ConstStateVecRef& cx, const ConstCommandVecRef& cu, const stateMat_t& cxx, const commandMat_t& cuu, const commandR_stateC_t& /*cux*/,
+                       const stateMat_t& fx, const stateR_commandC_t& fu, const ConstStateVecRef& Vx, const stateMat_t& Vxx,
+                       stateVec_t& Qx, commandVec_t& Qu, stateMat_t& Qxx, commandMat_t& Quu, commandR_stateC_t& Qux)
+    {
+        const auto M  = fx.bottomRows<nd>();
+        const auto Mu = fu.bottomRows<nd>();
+
+        // W = Vxx fx, with the q rows of fx applied as column shifts of Vxx
+        Coupling Wq;
+        DenseRows Wd;
+        Wq.noalias() = Vxx.topRightCorner<nq, nd>().lazyProduct(M);
+        Wd.noalias() = Vxx.bottomRightCorner<nd, nd>().lazyProduct(M);
+
+        Wq.leftCols<nq>()     += Vxx.topLeftCorner<nq, nq>();
+        Wq.middleCols<nq>(nq) += dt * Vxx.topLeftCorner<nq, nq>();
+        Wd.leftCols<nq>()     += Vxx.bottomLeftCorner<nd, nq>();
+        Wd.middleCols<nq>(nq) += dt * Vxx.bottomLeftCorner<nd, nq>();
+
+        // Qxx = cxx + fx' W
+        Qxx = cxx;
+        Qxx.noalias() += M.transpose().lazyProduct(Wd);
+        Qxx.topRows<nq>()      += Wq;
+        Qxx.middleRows<nq>(nq) += dt * Wq;
+
+        // the zero q rows of fu drop out of Quu, Qux and Qu
+        Qux.noalias() = Mu.transpose().lazyProduct(Wd);
+        Eigen::Matrix<double, nd, commandSize> VMu;
+        VMu.noalias() = Vxx.bottomRightCorner<nd, nd>().lazyProduct(Mu);
+        Quu = cuu;
+        Quu.noalias() += Mu.transpose().lazyProduct(VMu);
+
+        Qx  = cx + M.transpose() * Vx.tail<nd>();
+        Qx.head<nq>()      += Vx.head<nq>();
+        Qx.segment<nq>(nq) += dt * Vx.head<nq>();
+        Qu  = cu + Mu.transpose() * Vx.tail<nd>();
+    }
+
+    static void value(const stateVec_t& Qx, const commandVec_t& Qu, const stateMat_t& Qxx, const commandMat_t& Quu, const commandR_stateC_t& Qux,
+                      const commandVec_t& k, const commandR_stateC_t& K, StateVecRef Vx, stateMat_t& Vxx)
+    {
+        // Vxx = Qxx + K'(Quu K + Qux) + Qux' K, symmetrized from the lower triangle
+        commandR_stateC_t P = Qux;
+        P.noalias() += Quu.lazyProduct(K);
+
+        Vx  = Qx + K.transpose() * (Quu * k + Qu) + Qux.transpose() * k;
+        Vxx = Qxx;
+        Vxx.noalias() += K.transpose().lazyProduct(P);
+        Vxx.noalias() += Qux.transpose().lazyProduct(K);
+        Vxx.triangularView<Eigen::StrictlyUpper>() = Vxx.transpose();
+    }
+};
+
+/* SoftContactRiccati if enabled and the dynamics have kinematic q rows linearized by forward Euler, GenericRiccati otherwise */
+class RiccatiKernel
+{
+public:
+    RiccatiKernel() : structured(false) {}
+
+    template<int S, int C>
+    explicit RiccatiKernel(const JacobianPattern<S, C>& pattern, bool euler = true) : structured(STRUCTURED_RICCATI && euler && pattern.hasKinematicRows(NDOF)) {}
+
+    void expand(double dt, const ConstStateVecRef& cx, const ConstCommandVecRef& cu, const stateMat_t& cxx, const commandMat_t& cuu, const commandR_stateC_t& cux,
+                const stateMat_t& fx, const stateR_commandC_t& fu, const ConstStateVecRef& Vx, const stateMat_t& Vxx,
+                stateVec_t& Qx, commandVec_t& Qu, stateMat_t& Qxx, commandMat_t& Quu, commandR_stateC_t& Qux) const
+    {
+        if (structured) { SoftContactRiccati::expand(dt, cx, cu, cxx, cuu, cux, fx, fu, Vx, Vxx, Qx, Qu, Qxx, Quu, Qux); }
+        else { GenericRiccati::expand(dt, cx, cu, cxx, cuu, cux, fx, fu, Vx, Vxx, Qx, Qu, Qxx, Quu, Qux); }
+    }
+
+    void value(const stateVec_t& Qx, const commandVec_t& Qu, const stateMat_t& Qxx, const commandMat_t& Quu, const commandR_stateC_t& Qux,
+               const commandVec_t& k, const commandR_stateC_t& K, StateVecRef Vx, stateMat_t& Vxx) const
+    {
+        if (structured) { SoftContactRiccati::value(Qx, Qu, Qxx, Quu, Qux, k, K, Vx, Vxx); }
+        else { GenericRiccati::value(Qx, Qu, Qxx, Quu, Qux, k, K, Vx, Vxx); }
+    }
+
+    bool isStructured() const {return structured;}
+
+private:
+    bool structured;
+};
+
+}
+
+#endif // RICCATI_KERNELS_H
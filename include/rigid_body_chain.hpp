@@ -0,0 +1,417 @@
+#ifndef RIGID_BODY_CHAIN_H
+#define RIGID_BODY_CHAIN_H
+
+#include <Eigen/Dense>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace admm {
+
+/*
+ * Serial chain of rigid bodies with revolute z or fixed joints, in the convention of KDL segments: body b sits at
+ * Rz(q_j) * tip_b in the frame of body b - 1 and its inertia is given about the origin of its own frame.
+ * The recursions are templated on the scalar, the same description evaluates in double or in admm::Dual for forward
+ * mode derivatives (robot_dynamics_autodiff.hpp). Models describe themselves with RobotAbstract::getRigidBodyChain.
+ *
+ * Spatial vectors are [angular; linear] in body coordinates, the linear part at the body frame origin.
+ */
+class RigidBodyChain
+{
+public:
+    static const int MaxBodies = 16;
+
+    template<typename T> using Vec3   = Eigen::Matrix<T, 3, 1>;
+    template<typename T> using Mat3   = Eigen::Matrix<T, 3, 3>;
+    template<typename T> using Motion = Eigen::Matrix<T, 6, 1>;
+    template<typename T> using Inertia = Eigen::Matrix<T, 6, 6>;
+
+    struct Body
+    {
+        bool revolute;
+        Eigen::Matrix3d R;   // rotation of the tip frame
+        Eigen::Vector3d p;   // origin of the tip frame
+        double mass;
+        Eigen::Vector3d h;   // first moment of mass, mass * center of mass
+        Eigen::Matrix3d I;   // rotational inertia about the body frame origin
+        double armature;     // rotor inertia added to the joint
+        Eigen::Matrix<double, 6, 1> S;  // joint axis in body coordinates, constant for a z rotation
+    };
+
+    Eigen::Vector3d gravity = Eigen::Vector3d(0, 0, -9.81);
+    Eigen::VectorXd damping;                                  // viscous joint friction of the forward dynamics
+    Eigen::Matrix3d eeRotation = Eigen::Matrix3d::Identity(); // applied on the right of the end-effector rotation
+
+    void addBody(bool revolute, const Eigen::Matrix3d& R, const Eigen::Vector3d& p, double mass, const Eigen::Vector3d& h, const Eigen::Matrix3d& I, double armature = 0)
+    {
+        if (bodies_.size() == MaxBodies) throw std::length_error("RigidBodyChain: too many bodies");
+
+        const Eigen::Vector3d z = Eigen::Vector3d::UnitZ();
+        Eigen::Matrix<double, 6, 1> S;
+        S << R.transpose() * z, R.transpose() * z.cross(p);
+        bodies_.push_back(Body{revolute, R, p, mass, h, I, armature, S});
+
+        if (revolute)
+        {
+            joints_++;
+            damping.conservativeResize(joints_);
+            damping(joints_ - 1) = 0;
+        }
+    }
+
+    int joints() const {return joints_;}
+    const std::vector<Body>& bodies() const {return bodies_;}
+
+    /* joint torques of the motion (q, qd, qdd) under gravity, with qdd = 0 the bias forces */
+    template<typename T, int NJ>
+    void inverseDynamics(const Eigen::Matrix<T, NJ, 1>& q, const Eigen::Matrix<T, NJ, 1>& qd, const Eigen::Matrix<T, NJ, 1>& qdd, Eigen::Matrix<T, NJ, 1>& tau) const
+    {
+        Transforms<T> X;
+        transforms(q, X);
+
+        std::array<Motion<T>, MaxBodies> f;
+        Motion<T> v = Motion<T>::Zero(), a;
+        a << Vec3<T>::Zero(), -gravity.cast<T>();
+
+        for (size_t b = 0, j = 0; b < bodies_.size(); b++)
+        {
+            const Body& body = bodies_[b];
+            v = X[b].apply(v);
+            a = X[b].apply(a);
+            if (body.revolute)
+            {
+                const Motion<T> vJ = body.S * qd(j);
+                v += vJ;
+                a += body.S * qdd(j) + crossMotion(v, vJ);
+                j++;
+            }
+            f[b] = inertia(body, a) + crossForce(v, inertia(body, v));
+        }
+
+        for (int b = bodies_.size() - 1, j = joints_ - 1; b >= 0; b--)
+        {
+            const Body& body = bodies_[b];
+            if (body.revolute)
+            {
+                tau(j) = body.S.dot(f[b]) + body.armature * qdd(j);
+                j--;
+            }
+            if (b > 0) f[b - 1] += X[b].applyTransposed(f[b]);
+        }
+    }
+
+    /* joint space inertia matrix, composite rigid body algorithm */
+    template<typename T, int NJ>
+    void massMatrix(const Eigen::Matrix<T, NJ, 1>& q, Eigen::Matrix<T, NJ, NJ>& M) const
+    {
+        Transforms<T> X;
+        transforms(q, X);
+
+        // inertia of the bodies b..end, in the frame of b
+        T m = T(0.0);
+        Vec3<T> h = Vec3<T>::Zero();
+        Mat3<T> I = Mat3<T>::Zero();
+
+        for (int b = bodies_.size() - 1, j = joints_ - 1; b >= 0; b--)
+        {
+            const Body& body = bodies_[b];
+            m += body.mass;
+            h += body.h;
+            I += body.I;
+
+            if (body.revolute)
+            {
+                Motion<T> F;
+                F << I * body.S.template head<3>() + h.cross(body.S.template tail<3>().template cast<T>()),
+                     m * body.S.template tail<3>() - h.cross(body.S.template head<3>().template cast<T>());
+                M(j, j) = body.S.dot(F) + body.armature;
+
+                // walk the force up to the joints carrying body b
+                for (int a = b, i = j; a > 0; )
+                {
+                    F = X[a].applyTransposed(F);
+                    a--;
+                    if (bodies_[a].revolute)
+                    {
+                        i--;
+                        M(i, j) = bodies_[a].S.dot(F);
+                        M(j, i) = M(i, j);
+                    }
+                }
+                j--;
+            }
+
+            if (b > 0) X[b].transformInertia(m, h, I);
+        }
+    }
+
+    /* qdd of M(q) qdd + c(q, qd) = tau - damping qd */
+    template<typename T, int NJ>
+    void forwardDynamics(const Eigen::Matrix<T, NJ, 1>& q, const Eigen::Matrix<T, NJ, 1>& qd, const Eigen::Matrix<T, NJ, 1>& tau, Eigen::Matrix<T, NJ, 1>& qdd) const
+    {
+        Eigen::Matrix<T, NJ, NJ> M;
+        Eigen::Matrix<T, NJ, 1> bias;
+        const Eigen::Matrix<T, NJ, 1> zero = Eigen::Matrix<T, NJ, 1>::Zero();
+
+        massMatrix(q, M);
+        inverseDynamics(q, qd, zero, bias);
+
+        for (int i = 0; i < NJ; i++) { qdd(i) = tau(i) - damping(i) * qd(i) - bias(i); }
+        solveCholesky(M, qdd);
+    }
+
+    /* same qdd as forwardDynamics from the articulated body algorithm, O(n) and without forming or factoring M */
+    template<typename T, int NJ>
+    void articulatedBodyDynamics(const Eigen::Matrix<T, NJ, 1>& q, const Eigen::Matrix<T, NJ, 1>& qd, const Eigen::Matrix<T, NJ, 1>& tau, Eigen::Matrix<T, NJ, 1>& qdd) const
+    {
+        Transforms<T> X;
+        transforms(q, X);
+
+        std::array<Motion<T>, MaxBodies> c, pA;
+        std::array<Inertia<T>, MaxBodies> IA;
+        std::array<Motion<T>, MaxBodies> U;
+        std::array<T, MaxBodies> D, u;
+
+        // velocities, velocity product accelerations and bias forces, base to tip
+        Motion<T> v = Motion<T>::Zero();
+        for (size_t b = 0, j = 0; b < bodies_.size(); b++)
+        {
+            const Body& body = bodies_[b];
+            v = X[b].apply(v);
+            c[b].setZero();
+            if (body.revolute)
+            {
+                const Motion<T> vJ = body.S * qd(j);
+                v += vJ;
+                c[b] = crossMotion(v, vJ);
+                j++;
+            }
+            IA[b] = spatialInertia<T>(body);
+            pA[b] = crossForce(v, inertia(body, v));
+        }
+
+        // articulated inertias and bias forces, tip to base
+        for (int b = bodies_.size() - 1, j = joints_ - 1; b >= 0; b--)
+        {
+            const Body& body = bodies_[b];
+            Inertia<T> Ia = IA[b];
+            Motion<T> pa = pA[b];
+            if (body.revolute)
+            {
+                U[b] = IA[b] * body.S;
+                D[b] = body.S.dot(U[b]) + body.armature;
+                u[b] = tau(j) - damping(j) * qd(j) - body.S.dot(pA[b]);
+                Ia -= U[b] * U[b].transpose() / D[b];
+                pa += U[b] * (u[b] / D[b]);
+                j--;
+            }
+            pa += Ia * c[b];
+            if (b > 0)
+            {
+                const Inertia<T> Xm = X[b].matrix();
+                IA[b - 1] += Xm.transpose() * Ia * Xm;
+                pA[b - 1] += X[b].applyTransposed(pa);
+            }
+        }
+
+        // accelerations, base to tip
+        Motion<T> a;
+        a << Vec3<T>::Zero(), -gravity.cast<T>();
+        for (size_t b = 0, j = 0; b < bodies_.size(); b++)
+        {
+            const Body& body = bodies_[b];
+            a = X[b].apply(a) + c[b];
+            if (body.revolute)
+            {
+                qdd(j) = (u[b] - U[b].dot(a)) / D[b];
+                a += body.S * qdd(j);
+                j++;
+            }
+        }
+    }
+
+    /* pose of the last body in the base, velocity and classical acceleration of its origin */
+    template<typename T, int NJ>
+    void endEffector(const Eigen::Matrix<T, NJ, 1>& q, const Eigen::Matrix<T, NJ, 1>& qd, const Eigen::Matrix<T, NJ, 1>& qdd,
+                     Mat3<T>& poseM, Vec3<T>& poseP, Vec3<T>& vel, Vec3<T>& accel) const
+    {
+        Transforms<T> X;
+        transforms(q, X);
+
+        Motion<T> v = Motion<T>::Zero(), a = Motion<T>::Zero();
+        poseM.setIdentity();
+        poseP.setZero();
+
+        for (size_t b = 0, j = 0; b < bodies_.size(); b++)
+        {
+            v = X[b].apply(v);
+            a = X[b].apply(a);
+            if (bodies_[b].revolute)
+            {
+                const Motion<T> vJ = bodies_[b].S * qd(j);
+                v += vJ;
+                a += bodies_[b].S * qdd(j) + crossMotion(v, vJ);
+                j++;
+            }
+            poseP += poseM * X[b].r;
+            poseM = (poseM * X[b].E.transpose()).eval();
+        }
+
+        vel   = poseM * v.template tail<3>();
+        accel = poseM * (a.template tail<3>() + v.template head<3>().cross(v.template tail<3>()));
+        poseM = (poseM * eeRotation).eval();
+    }
+
+private:
+    /* from the frame of the parent to the frame of the body: rotation E and origin r of the body in the parent */
+    template<typename T>
+    struct Transform
+    {
+        Mat3<T> E;
+        Vec3<T> r;
+
+        Motion<T> apply(const Motion<T>& m) const
+        {
+            Motion<T> out;
+            out << E * m.template head<3>(), E * (m.template tail<3>() + m.template head<3>().cross(r));
+            return out;
+        }
+
+        /* force of the body expressed in the parent */
+        Motion<T> applyTransposed(const Motion<T>& f) const
+        {
+            Motion<T> out;
+            out.template tail<3>() = E.transpose() * f.template tail<3>();
+            out.template head<3>() = E.transpose() * f.template head<3>() + r.cross(out.template tail<3>());
+            return out;
+        }
+
+        /* apply as a matrix */
+        Inertia<T> matrix() const
+        {
+            Inertia<T> Xm;
+            Xm << E, Mat3<T>::Zero(), -E * skew(r), E;
+            return Xm;
+        }
+
+        /* rigid body inertia (m, h, I) of the body frame into the parent frame */
+        void transformInertia(const T& m, Vec3<T>& h, Mat3<T>& I) const
+        {
+            const Vec3<T> hr = E.transpose() * h;
+            const Mat3<T> rx = skew(r), hx = skew(hr);
+            I = E.transpose() * I * E - rx * hx - hx * rx - m * rx * rx;
+            h = hr + m * r;
+        }
+    };
+
+    template<typename T> using Transforms = std::array<Transform<T>, MaxBodies>;
+
+    template<typename T, int NJ>
+    void transforms(const Eigen::Matrix<T, NJ, 1>& q, Transforms<T>& X) const
+    {
+        for (size_t b = 0, j = 0; b < bodies_.size(); b++)
+        {
+            const Body& body = bodies_[b];
+            if (body.revolute)
+            {
+                using std::cos;
+                using std::sin;
+                const T c = cos(q(j)), s = sin(q(j));
+                Mat3<T> Rz;
+                Rz << c, -s, T(0.0),
+                      s,  c, T(0.0),
+                      T(0.0), T(0.0), T(1.0);
+                X[b].E = body.R.transpose() * Rz.transpose();
+                X[b].r = Rz * body.p;
+                j++;
+            }
+            else
+            {
+                X[b].E = body.R.transpose().template cast<T>();
+                X[b].r = body.p.template cast<T>();
+            }
+        }
+    }
+
+    template<typename T>
+    static Mat3<T> skew(const Vec3<T>& w)
+    {
+        Mat3<T> W;
+        W << T(0.0), -w(2), w(1),
+             w(2), T(0.0), -w(0),
+             -w(1), w(0), T(0.0);
+        return W;
+    }
+
+    template<typename T>
+    static Motion<T> crossMotion(const Motion<T>& v, const Motion<T>& m)
+    {
+        Motion<T> out;
+        out << v.template head<3>().cross(m.template head<3>()),
+               v.template head<3>().cross(m.template tail<3>()) + v.template tail<3>().cross(m.template head<3>());
+        return out;
+    }
+
+    template<typename T>
+    static Motion<T> crossForce(const Motion<T>& v, const Motion<T>& f)
+    {
+        Motion<T> out;
+        out << v.template head<3>().cross(f.template head<3>()) + v.template tail<3>().cross(f.template tail<3>()),
+               v.template head<3>().cross(f.template tail<3>());
+        return out;
+    }
+
+    template<typename T>
+    static Motion<T> inertia(const Body& body, const Motion<T>& m)
+    {
+        Motion<T> out;
+        out << body.I * m.template head<3>() + body.h.template cast<T>().cross(m.template tail<3>()),
+               body.mass * m.template tail<3>() - body.h.template cast<T>().cross(m.template head<3>());
+        return out;
+    }
+
+    /* 6 x 6 spatial inertia of the body, maps a motion to the force of inertia */
+    template<typename T>
+    static Inertia<T> spatialInertia(const Body& body)
+    {
+        const Mat3<T> hx = skew<T>(body.h.template cast<T>());
+        Inertia<T> I;
+        I << body.I.template cast<T>(), hx, hx.transpose(), body.mass * Mat3<T>::Identity();
+        return I;
+    }
+
+    /* M x = b in place on b, M symmetric positive definite */
+    template<typename T, int NJ>
+    static void solveCholesky(Eigen::Matrix<T, NJ, NJ>& M, Eigen::Matrix<T, NJ, 1>& b)
+    {
+        using std::sqrt;
+        for (int j = 0; j < NJ; j++)
+        {
+            for (int k = 0; k < j; k++) { M(j, j) -= M(j, k) * M(j, k); }
+            M(j, j) = sqrt(M(j, j));
+            for (int i = j + 1; i < NJ; i++)
+            {
+                for (int k = 0; k < j; k++) { M(i, j) -= M(i, k) * M(j, k); }
+                M(i, j) = M(i, j) / M(j, j);
+            }
+        }
+        for (int i = 0; i < NJ; i++)
+        {
+            for (int k = 0; k < i; k++) { b(i) -= M(i, k) * b(k); }
+            b(i) = b(i) / M(i, i);
+        }
+        for (int i = NJ - 1; i >= 0; i--)
+        {
+            for (int k = i + 1; k < NJ; k++) { b(i) -= M(k, i) * b(k); }
+            b(i) = b(i) / M(i, i);
+        }
+    }
+
+    std::vector<Body> bodies_;
+    int joints_ = 0;
+};
+
+}
+
+#endif // RIGID_BODY_CHAIN_H
@@ -14,6 +14,11 @@
 #include "KUKA.h"
 #include "KUKASoftContactFDSystem.h"
 #include "RobCodGen/codegen/KUKASoftContactSystemLinearizedForward.h"
+#if FUSED_LINEARIZATION == 1
+#include "RobCodGen/codegen/KUKASoftContactSystemLinearizedFusedForward.h"
+#elif FUSED_LINEARIZATION == 2
+#include "RobCodGen/codegen/KUKASoftContactSystemLinearizedFusedReverse.h"
+#endif
 
 #include "dynamics.hpp"
 
@@ -40,24 +45,57 @@ private:
     Control upperCommandBounds;
 
 public:
+    using Workspace = admm::Dynamics<RobotAbstract, stateSize, commandSize>::Workspace;
+
+    // generated linearization used in fx, see FUSED_LINEARIZATION in config.h
+#if FUSED_LINEARIZATION == 1
+    typedef ct::models::KUKA::KUKASoftContactSystemLinearizedFusedForward Linearizer;
+#elif FUSED_LINEARIZATION == 2
+    typedef ct::models::KUKA::KUKASoftContactSystemLinearizedFusedReverse Linearizer;
+#else
+    typedef ct::models::KUKA::KUKASoftContactSystemLinearizedForward Linearizer;
+#endif
+
+    /* scratch of one caller of f, including the workspace of the robot model */
+    struct RobotWorkspace : public Workspace
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        std::unique_ptr<RobotAbstractWorkspace> robot;
+
+        stateVec_half_t q, qd, qdd, tau_ext;
+        Eigen::Vector3d force_current, accel, vel, poseP, force_dot;
+        Eigen::Matrix<double, 3, 3> poseM;
+        Eigen::Matrix<double, 6, NDOF> manip_jacobian;
+        Eigen::Matrix<double, 6, NDOF> manip_jacobianDot;
+
+        // generated linearization of this caller, used by linearize
+        std::unique_ptr<Linearizer> linearizer;
+        ct::core::StateVector<stateSize> x_lin;
+        ct::core::ControlVector<commandSize> u_lin;
+#if FUSED_LINEARIZATION
+        stateVec_t xdot_lin;
+        Linearizer::values_t values;
+#endif
+    };
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
     std::mutex mu;
     std::shared_ptr<RobotAbstract> m_kukaRobot;
     ContactModel::SoftContactModel<Scalar> m_contact_model;
-    ct::models::KUKA::KUKASoftContactSystemLinearizedForward kukaLinear;
-    ct::core::StateVector<KUKASystem::STATE_DIM> x;
-    ct::core::ControlVector<KUKASystem::CONTROL_DIM> u; 
+
+    // one code generated linearization per worker thread, they keep internal scratch
+    std::vector<std::unique_ptr<Linearizer>> kukaLinear;
+
+    // false if the generated linearization does not match the contact parameters of f, linearize then differentiates f
+    bool generatedParams_ = true;
     
     stateVec_t xdot_new;
 
-    Eigen::VectorXd q, qd, qdd, tau_ext;
-    Eigen::Vector3d force_current, accel, vel, poseP;
-    Eigen::Matrix<double,3,3> poseM;
     Eigen::Matrix3d H_c;
-    Eigen::MatrixXd manip_jacobian;
     Control Kv;
-    Control dynamic_friction;
-    Eigen::Vector3d force_dot;
+
+    // workspace of the legacy, locking f
+    std::unique_ptr<Workspace> m_workspace;
 
 
     std::chrono::time_point<std::chrono::high_resolution_clock> start, end;
@@ -66,83 +104,209 @@ public:
 public:
     RobotDynamics() 
     {
+        RobotDynamics::setNumThreads(1);
         std::cout << "Initilized the Robot Dynamic Model..." << std::endl;
     }
     RobotDynamics(double timeStep, unsigned int Nsteps, const std::shared_ptr<RobotAbstract>& kukaRobot, const ContactModel::SoftContactModel<double>& contact_model) 
                     : admm::Dynamics<RobotAbstract, stateSize, commandSize>(timeStep, Nsteps, kukaRobot), m_kukaRobot(kukaRobot), m_contact_model(contact_model)
                       
     {
-        q.resize(NDOF), qd.resize(NDOF);
-        qdd.resize(NDOF);
         fxList.resize(N + 1), fuList.resize(N);
-        tau_ext.resize(NDOF);
-        manip_jacobian.resize(6, NDOF);
-        poseM.setZero();
+
+#if FUSED_LINEARIZATION
+        // the generated code only evaluates the non-zeros, fx writes them over the structural zeros set here
+        pattern_ = Pattern::fromTriplets(Linearizer::ROWS, Linearizer::COLS, Linearizer::NNZ);
+        for (int k = 0; k < N; k++) { Pattern::clearDiscrete(fxList[k], fuList[k]); }
+#else
+        // q_dot = qd, the rest of the soft contact dynamics is treated as dense
+        pattern_.nonzero.topRows(NDOF).setConstant(false);
+        for (int i = 0; i < NDOF; i++) { pattern_.nonzero(i, NDOF + i) = true; }
+#endif
         H_c << 1, 0, 0, 0, 1, 0, 0, 0, 1;
 
         xdot_new.setZero();
-        Kv << 0.5, 0.5, 0.5, 0.7, 1, 0.5, 0.2;
-        RobotDynamics();
-   
+        // joint damping of KUKASoftContactFDSystem, the system all the generated code is built from
+        Kv << 0.5, 0.5, 0.5, 0.3, 1, 0.5, 0.2;
+        RobotDynamics::setNumThreads(1);
     }
 
     ~RobotDynamics() = default;
     RobotDynamics(const RobotDynamics &other) {};
     RobotDynamics& operator=(const RobotDynamics &other) {};
 
+    std::unique_ptr<Workspace> createWorkspace() override
+    {
+        std::unique_ptr<RobotWorkspace> ws(new RobotWorkspace());
+        ws->robot = m_kukaRobot->createWorkspace();
+        ws->linearizer.reset(new Linearizer());
+        ws->xdot.setZero();
+        return ws;
+    }
+
+    /* serialized on the internal workspace. use the workspace overload to evaluate from several threads */
     const State& f(const stateVec_t& x, const commandVec_t& tau) override
     {
         std::lock_guard<std::mutex> lk(mu);
-        q  = x.head(NDOF);
-        qd = x.segment(NDOF, NDOF);
-        force_current = x.tail(3);
+        if (!m_workspace) {m_workspace = createWorkspace();}
 
-        // compute manipualator dynamics
-        m_kukaRobot->getSpatialJacobian(q.data(), manip_jacobian);
+        xdot_new = f(x, tau, *m_workspace);
+        return xdot_new;
+    }
 
-        dynamic_friction = (-1) * Kv.asDiagonal() * qd;
+    const State& f(const stateVec_t& x, const commandVec_t& tau, Workspace& workspace) override
+    {
+        RobotWorkspace& ws = static_cast<RobotWorkspace&>(workspace);
+
+        ws.q  = x.head(NDOF);
+        ws.qd = x.segment(NDOF, NDOF);
+        ws.force_current = x.tail(3);
+
+        // pose, velocity, Jacobian and its derivative in one query, the acceleration follows once qdd is known
+        m_kukaRobot->getKinematics(*ws.robot, ws.q.data(), ws.qd.data(), ws.poseM, ws.poseP, ws.vel, ws.manip_jacobian, ws.manip_jacobianDot, CONTACT_EN);
 
-        tau_ext = tau + dynamic_friction - 0 * manip_jacobian.transpose().block(0, 0, NDOF, 3) * force_current;
-        m_kukaRobot->getForwardDynamics(q.data(), qd.data(), tau_ext, qdd);
+        // compute manipualator dynamics
+        ws.tau_ext = tau - Kv.asDiagonal() * ws.qd - 0 * ws.manip_jacobian.transpose().block(0, 0, NDOF, 3) * ws.force_current;
+        m_kukaRobot->getForwardDynamics(*ws.robot, ws.q.data(), ws.qd.data(), ws.tau_ext, ws.qdd);
 
         // contact model dynamics
         if (CONTACT_EN)
         {
-            // compute forward kinematics, velocity and accleration
-            m_kukaRobot->getForwardKinematics(q.data(), qd.data(), qdd.data(), poseM, poseP, vel, accel, true);
+            ws.accel = ws.manip_jacobian.topRows(3) * ws.qdd + ws.manip_jacobianDot.topRows(3) * ws.qd;
 
             // contact model dynamics
-            m_contact_model.df(H_c, poseP, poseM, vel, accel, force_current, force_dot);
+            m_contact_model.df(H_c, ws.poseP, ws.poseM, ws.vel, ws.accel, ws.force_current, ws.force_dot);
 
         } else {   
-            force_dot.setZero();
-            force_current.setZero();
+            ws.force_dot.setZero();
+            ws.force_current.setZero();
         }
 
-        xdot_new << qd, qdd, force_dot;
-        return xdot_new;
+        ws.xdot << ws.qd, ws.qdd, ws.force_dot;
+        return ws.xdot;
     }
 
-    void fx(const stateVecTab_t& xList, const commandVecTab_t& uList) override
+    void setNumThreads(unsigned int numThreads) override
     {
-        // TODO parallalize here
-        for (unsigned int k=0; k < N; k++) 
+        admm::Dynamics<RobotAbstract, stateSize, commandSize>::setNumThreads(numThreads);
+
+        kukaLinear.resize(this->pool_->size());
+        for (auto& linearizer : kukaLinear)
         {
-            x = xList.col(k); u = uList.col(k);
-            x(16) += 0.000000001;
+            if (!linearizer) linearizer.reset(new Linearizer());
+        }
+        setContactParams(m_contact_model.getParams());
+    }
 
-            auto A_gen = kukaLinear.getDerivativeState(x, u, 0.0);
-            auto B_gen = kukaLinear.getDerivativeControl(x, u, 0.0);
+    /*
+     * contact parameters of f and of the generated linearization. with FUSED_LINEARIZATION they are runtime inputs of
+     * the generated code, otherwise it has the defaults of KUKASoftContactFDSystem built in and other parameters are
+     * linearized by differencing f
+     */
+    void setContactParams(const ContactModel::ContactParams<double>& cp)
+    {
+        m_contact_model.setParams(cp);
+#if FUSED_LINEARIZATION
+        for (auto& linearizer : kukaLinear) { linearizer->setParameters(cp.toVector()); }
+#else
+        generatedParams_ = (cp.toVector() == KUKASystem::defaultContactParams().toVector());
+#endif
+    }
 
-            this->fxList[k] = A_gen * this->dt + Eigen::Matrix<double, stateSize, stateSize>::Identity();
-            this->fuList[k] = B_gen * this->dt;
+    /* continuous A and B at (x, u) with the generated linearization of the workspace */
+    void linearize(const State& x, const Control& u, Workspace& workspace, stateMat_t& A, stateR_commandC_t& B) override
+    {
+        if (!generatedParams_)
+        {
+            admm::Dynamics<RobotAbstract, stateSize, commandSize>::linearize(x, u, workspace, A, B);
+            return;
+        }
+
+        RobotWorkspace& ws = static_cast<RobotWorkspace&>(workspace);
+
+        ws.x_lin = x; ws.u_lin = u;
+        ws.x_lin(16) += 0.000000001;
+#if FUSED_LINEARIZATION
+        ws.linearizer->setParameters(m_contact_model.getParams().toVector());
+        ws.linearizer->linearizeSparse(ws.x_lin, ws.u_lin, ws.xdot_lin, ws.values);
+        Pattern::scatter(Linearizer::ROWS, Linearizer::COLS, Linearizer::NNZ, ws.values.data(), A, B);
+#else
+        A = ws.linearizer->getDerivativeState(ws.x_lin, ws.u_lin, 0.0);
+        B = ws.linearizer->getDerivativeControl(ws.x_lin, ws.u_lin, 0.0);
+#endif
+    }
+
+    bool hasExactLinearization() const override {return generatedParams_;}
+
+    void setLinearization(admm::Linearization linearization) override
+    {
+        admm::Dynamics<RobotAbstract, stateSize, commandSize>::setLinearization(linearization);
+        clearDiscrete();
+    }
+
+    void setIntegrator(admm::Integrator integrator) override
+    {
+        admm::Dynamics<RobotAbstract, stateSize, commandSize>::setIntegrator(integrator);
+        clearDiscrete();
+    }
+
+    /* linearize each knot with the generated code. the horizon is split in contiguous chunks, one per worker */
+    void fx(const stateVecTab_t& xList, const commandVecTab_t& uList) override
+    {
+        if (!this->hasEulerJacobians() || !generatedParams_)
+        {
+            // RK4 sensitivities, the Rosenbrock step or differences of f, see admm::Dynamics::discretize
+            if (this->workspaceThreads_.size() != this->pool_->size()) {this->createThreadData();}
+
+            this->pool_->parallel_for(N, [&](unsigned int threadId, int begin, int end)
+            {
+                for (int k = begin; k < end; k++) 
+                {
+                    this->discretize(xList.col(k), uList.col(k), *this->workspaceThreads_[threadId], this->fxList[k], this->fuList[k]);
+                }
+            });
+            return;
         }
+
+        this->pool_->parallel_for(N, [&](unsigned int threadId, int begin, int end)
+        {
+            Linearizer& linearizer = *kukaLinear[threadId];
+            ct::core::StateVector<KUKASystem::STATE_DIM> x;
+            ct::core::ControlVector<KUKASystem::CONTROL_DIM> u;
+#if FUSED_LINEARIZATION
+            stateVec_t xdot;
+            Linearizer::values_t values;
+#endif
+
+            for (int k = begin; k < end; k++) 
+            {
+                x = xList.col(k); u = uList.col(k);
+                x(16) += 0.000000001;
+
+#if FUSED_LINEARIZATION
+                // value and the non-zeros of dF/dx and dF/du from one sweep of the generated code
+                linearizer.linearizeSparse(x, u, xdot, values);
+                Pattern::scatterDiscrete(Linearizer::ROWS, Linearizer::COLS, Linearizer::NNZ, values.data(), this->dt, this->fxList[k], this->fuList[k]);
+#else
+                this->fxList[k] = linearizer.getDerivativeState(x, u, 0.0) * this->dt + Eigen::Matrix<double, stateSize, stateSize>::Identity();
+                this->fuList[k] = linearizer.getDerivativeControl(x, u, 0.0) * this->dt;
+#endif
+            }
+        });
     }
 
     const Control& getLowerCommandBounds() const {return lowerCommandBounds;}
     const Control& getUpperCommandBounds() const {return upperCommandBounds;}
     const JacobianState& getfxList() const override {return this->fxList;}
     const JacobianControl& getfuList() const override {return this->fuList;}
+
+private:
+    /* the other discretizations write dense fx, fu, the Euler scatter expects the structural zeros in place */
+    void clearDiscrete()
+    {
+#if FUSED_LINEARIZATION
+        for (int k = 0; k < N; k++) { Pattern::clearDiscrete(fxList[k], fuList[k]); }
+#endif
+    }
 };
 
 
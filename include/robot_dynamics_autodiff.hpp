@@ -0,0 +1,146 @@
+#ifndef ROBOTDYNAMICS_AUTODIFF_H
+#define ROBOTDYNAMICS_AUTODIFF_H
+
+#include "robot_dynamics.hpp"
+#include "rigid_body_chain.hpp"
+#include "dual.hpp"
+#include "simd_pack.hpp"
+
+#include <stdexcept>
+
+
+/*
+ * Dynamics backend linearizing RobotDynamics::f with forward mode dual numbers, for robot models without generated code.
+ * The model describes itself as a RigidBodyChain (RobotAbstract::getRigidBodyChain), fx evaluates f once per knot on
+ * Dual<24> seeded with the unit directions of (x, u) and reads the exact Jacobian off the result, where the default
+ * admm::Dynamics::fx takes 25 evaluations of forward differences. f itself still runs on the robot model, f_batch runs
+ * the chain on Pack<SimdLanes>, one state per SIMD lane.
+ */
+class AutoDiffRobotDynamics : public RobotDynamics
+{
+public:
+    using ADScalar = admm::Dual<stateSize + commandSize>;
+    using Lanes    = admm::Pack<admm::SimdLanes>;
+
+    template<typename T> using StateT   = Eigen::Matrix<T, stateSize, 1>;
+    template<typename T> using ControlT = Eigen::Matrix<T, commandSize, 1>;
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    AutoDiffRobotDynamics(double timeStep, unsigned int Nsteps, const std::shared_ptr<RobotAbstract>& kukaRobot, const ContactModel::SoftContactModel<double>& contact_model)
+                    : RobotDynamics(timeStep, Nsteps, kukaRobot, contact_model), m_contactDual(castParams<ADScalar>(contact_model.getParams())),
+                      m_contactLanes(castParams<Lanes>(contact_model.getParams()))
+    {
+        if (!kukaRobot->getRigidBodyChain(m_chain) || m_chain.joints() != NDOF)
+        {
+            throw std::invalid_argument("AutoDiffRobotDynamics: the robot model is not described by a rigid body chain of NDOF joints");
+        }
+    }
+
+    /* x_dot = f(x, u) of RobotDynamics on any scalar type, with the model given by the chain */
+    template<typename T>
+    void evaluate(const StateT<T>& x, const ControlT<T>& tau, const ContactModel::SoftContactModel<T>& contact, StateT<T>& xdot) const
+    {
+        using Joints = Eigen::Matrix<T, NDOF, 1>;
+        const Joints q  = x.template head<NDOF>();
+        const Joints qd = x.template segment<NDOF>(NDOF);
+        const Eigen::Matrix<T, 3, 1> force = x.template tail<3>();
+
+        Joints qdd, tau_ext;
+        for (int i = 0; i < NDOF; i++) { tau_ext(i) = tau(i) - Kv(i) * qd(i); }
+        m_chain.forwardDynamics(q, qd, tau_ext, qdd);
+
+        Eigen::Matrix<T, 3, 1> force_dot = Eigen::Matrix<T, 3, 1>::Zero();
+        if (CONTACT_EN)
+        {
+            Eigen::Matrix<T, 3, 3> poseM;
+            Eigen::Matrix<T, 3, 1> poseP, vel, accel;
+            m_chain.endEffector(q, qd, qdd, poseM, poseP, vel, accel);
+
+            contact.df(H_c.template cast<T>(), poseP, poseM, vel, accel, force, force_dot);
+        }
+
+        xdot << qd, qdd, force_dot;
+    }
+
+    /* A and B from one dual evaluation at (x, u) */
+    void linearize(const stateVec_t& xs, const commandVec_t& us, Workspace& /*ws*/, stateMat_t& A, stateR_commandC_t& B) override
+    {
+        StateT<ADScalar> x, xdot;
+        ControlT<ADScalar> u;
+
+        for (int i = 0; i < stateSize; i++) { x(i) = ADScalar::variable(xs(i), i); }
+        for (int i = 0; i < commandSize; i++) { u(i) = ADScalar::variable(us(i), stateSize + i); }
+        x(16).v += 0.000000001;
+
+        evaluate(x, u, m_contactDual, xdot);
+
+        for (int i = 0; i < stateSize; i++)
+        {
+            A.row(i) = xdot(i).d.template head<stateSize>().transpose();
+            B.row(i) = xdot(i).d.template tail<commandSize>().transpose();
+        }
+    }
+
+    bool hasExactLinearization() const override {return true;}
+
+    /* one dual evaluation per knot, four for the RK4 sensitivities. the horizon is split in contiguous chunks, one per worker */
+    void fx(const stateVecTab_t& xList, const commandVecTab_t& uList) override
+    {
+        m_contactDual.setParams(castParams<ADScalar>(m_contact_model.getParams()));
+        if (this->workspaceThreads_.size() != this->pool_->size()) {this->createThreadData();}
+
+        this->pool_->parallel_for(N, [&](unsigned int threadId, int begin, int end)
+        {
+            for (int k = begin; k < end; k++)
+            {
+                this->discretize(xList.col(k), uList.col(k), *this->workspaceThreads_[threadId], this->fxList[k], this->fuList[k]);
+            }
+        });
+    }
+
+    /* the chain on SimdLanes columns per call, the remaining columns one by one. reentrant, ws is not used */
+    void f_batch(const Eigen::Ref<const stateVecTab_t>& X, const Eigen::Ref<const commandVecTab_t>& U, Eigen::Ref<stateVecTab_t> Xdot, Workspace& /*ws*/) override
+    {
+        ContactModel::SoftContactModel<Lanes> contact(m_contactLanes);
+        contact.setParams(castParams<Lanes>(m_contact_model.getParams()));
+
+        StateT<Lanes> x, xdot;
+        ControlT<Lanes> u;
+        int j = 0;
+        for (; j + admm::SimdLanes <= X.cols(); j += admm::SimdLanes)
+        {
+            for (int i = 0; i < stateSize; i++) { for (int l = 0; l < admm::SimdLanes; l++) { x(i)[l] = X(i, j + l); } }
+            for (int i = 0; i < commandSize; i++) { for (int l = 0; l < admm::SimdLanes; l++) { u(i)[l] = U(i, j + l); } }
+
+            evaluate(x, u, contact, xdot);
+
+            for (int i = 0; i < stateSize; i++) { for (int l = 0; l < admm::SimdLanes; l++) { Xdot(i, j + l) = xdot(i)[l]; } }
+        }
+
+        StateT<double> xs, xsdot;
+        for (; j < X.cols(); j++)
+        {
+            xs = X.col(j);
+            evaluate<double>(xs, U.col(j), m_contact_model, xsdot);
+            Xdot.col(j) = xsdot;
+        }
+    }
+
+    const admm::RigidBodyChain& getRigidBodyChain() const {return m_chain;}
+
+private:
+    template<typename T>
+    static ContactModel::ContactParams<T> castParams(const ContactModel::ContactParams<double>& cp)
+    {
+        ContactModel::ContactParams<T> params;
+        params.E = cp.E; params.mu = cp.mu; params.nu = cp.nu; params.R = cp.R; params.R_path = cp.R_path; params.Kd = cp.Kd;
+        return params;
+    }
+
+    admm::RigidBodyChain m_chain;
+    ContactModel::SoftContactModel<ADScalar> m_contactDual;
+    ContactModel::SoftContactModel<Lanes> m_contactLanes;
+};
+
+#endif // ROBOTDYNAMICS_AUTODIFF_H
@@ -0,0 +1,71 @@
+#ifndef ROBOTDYNAMICS_CODEGEN_H
+#define ROBOTDYNAMICS_CODEGEN_H
+
+#include "robot_dynamics.hpp"
+
+#include "RobCodGen/codegen/KUKASoftContactSystemForwardDynamics.h"
+#include "RobCodGen/codegen/KUKASoftContactSystemRK4Step.h"
+
+
+/*
+ * Dynamics backend evaluating the soft contact system with the code generated by KUKASoftContactSystemCodGenLinearizer.cpp,
+ * the same KUKASoftContactFDSystem the linearization is generated from. f is one flat function of (x, u) instead of the
+ * Jacobian, forward dynamics, forward kinematics and contact model calls through RobotAbstract, and step is the whole RK4
+ * step in one call. The contact parameters are inputs of the generated code, taken from the contact model on every call.
+ * Needs the CMake option CODEGEN_DYNAMICS, which compiles the generated sources.
+ */
+class GeneratedRobotDynamics : public RobotDynamics
+{
+    using State   = stateVec_t;
+    using Control = commandVec_t;
+
+public:
+    /* generated evaluators and their inputs, the evaluators keep internal scratch */
+    struct GeneratedWorkspace : public RobotWorkspace
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        ct::models::KUKA::KUKASoftContactSystemForwardDynamics dynamics;
+        ct::models::KUKA::KUKASoftContactSystemRK4Step rk4;
+
+        Eigen::VectorXd xup{stateSize + commandSize + ContactModel::ContactParams<double>::SIZE};
+        Eigen::VectorXd xupdt{stateSize + commandSize + ContactModel::ContactParams<double>::SIZE + 1};
+    };
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    GeneratedRobotDynamics(double timeStep, unsigned int Nsteps, const std::shared_ptr<RobotAbstract>& kukaRobot, const ContactModel::SoftContactModel<double>& contact_model)
+                    : RobotDynamics(timeStep, Nsteps, kukaRobot, contact_model) {}
+
+    std::unique_ptr<Workspace> createWorkspace() override
+    {
+        std::unique_ptr<GeneratedWorkspace> ws(new GeneratedWorkspace());
+        ws->robot = m_kukaRobot->createWorkspace();
+        ws->linearizer.reset(new Linearizer());
+        ws->xdot.setZero();
+        return ws;
+    }
+
+    using RobotDynamics::f;
+
+    const State& f(const stateVec_t& x, const commandVec_t& tau, Workspace& workspace) override
+    {
+        GeneratedWorkspace& ws = static_cast<GeneratedWorkspace&>(workspace);
+
+        ws.xup << x, tau, m_contact_model.getParams().toVector();
+        ws.xdot = ws.dynamics.forwardZero(ws.xup);
+        return ws.xdot;
+    }
+
+    /* the generated RK4 step, the Rosenbrock step of RobotDynamics on the generated f otherwise */
+    State step(const State& x, const Control& u, Workspace& workspace) override
+    {
+        if (this->integrator_ != admm::Integrator::RK4) {return RobotDynamics::step(x, u, workspace);}
+
+        GeneratedWorkspace& ws = static_cast<GeneratedWorkspace&>(workspace);
+
+        ws.xupdt << x, u, m_contact_model.getParams().toVector(), this->dt;
+        return ws.rk4.forwardZero(ws.xupdt);
+    }
+};
+
+#endif // ROBOTDYNAMICS_CODEGEN_H
@@ -29,7 +29,7 @@ public:
 
     RobotPlant(const std::shared_ptr<Dynamics>& robotDynamics, Scalar timeStep, Scalar state_var, Scalar control_var) 
     : Plant<Dynamics, S, C>(robotDynamics, timeStep), sdist_(State::Zero(), state_var * StateNoiseVariance::Identity()),
-      cdist_(Control::Zero(), control_var * ControlNoiseVariance::Identity()) {}
+      cdist_(Control::Zero(), control_var * ControlNoiseVariance::Identity()), ws_(robotDynamics->createWorkspace()) {}
     
 
     RobotPlant() = default;
@@ -45,12 +45,8 @@ public:
         std::lock_guard<std::mutex> locker(mu);
         Control u_noisy = u + 0*cdist_.samples(1);
 
-        State f1 = this->m_plantDynamics->f(currentState, u_noisy);
-        State f2 = this->m_plantDynamics->f(currentState + 0.5 * dt * f1, u_noisy);
-        State f3 = this->m_plantDynamics->f(currentState + 0.5 * dt * f2, u_noisy);
-        State f4 = this->m_plantDynamics->f(currentState + dt * f3, u_noisy);
-
-        currentState = currentState + (dt/6) * (f1 + 2 * f2 + 2 * f3 + f4) + sdist_.samples(1);
+        // the integrator of the dynamics (RK4 or Rosenbrock), over their time step, which the plant is built with
+        currentState = this->m_plantDynamics->step(currentState, u_noisy, *ws_) + sdist_.samples(1);
         return true;
     }
 
@@ -70,6 +66,7 @@ private:
     // Scalar dt;
     Eigen::EigenMultivariateNormal<double, StateSize> sdist_;
     Eigen::EigenMultivariateNormal<double, ControlSize> cdist_;
+    std::unique_ptr<typename Dynamics::Workspace> ws_;
 
     std::mutex mu;
 
@@ -0,0 +1,105 @@
+#ifndef SIMD_PACK_H
+#define SIMD_PACK_H
+
+#include <Eigen/Core>
+#include <cmath>
+
+namespace admm {
+
+// lanes of the widest double vector the build targets, see the DDP_NATIVE_ARCH option
+#if defined(__AVX512F__)
+const int SimdLanes = 8;
+#elif defined(__AVX__)
+const int SimdLanes = 4;
+#else
+const int SimdLanes = 2;
+#endif
+
+// vector of N doubles with unaligned loads and stores, GCC does not take a template dependent vector_size
+template<int N> struct PackVector;
+template<> struct PackVector<2> { typedef double type __attribute__((vector_size(16), aligned(8))); };
+template<> struct PackVector<4> { typedef double type __attribute__((vector_size(32), aligned(8))); };
+template<> struct PackVector<8> { typedef double type __attribute__((vector_size(64), aligned(8))); };
+
+/*
+ * N doubles evaluated in lockstep, one independent state per lane. The arithmetic maps to single vector instructions
+ * (GCC vector extensions), the transcendental functions run lane by lane. Code templated on its scalar, like
+ * RigidBodyChain or the soft contact model, evaluates N states per call on Pack<N>, as long as it does not branch on
+ * values. N is 2, 4 or 8. Loads and stores are unaligned, so packs may live in Eigen matrices and on the heap.
+ */
+template<int N>
+struct Pack
+{
+    typedef typename PackVector<N>::type Vector;
+
+    Vector v;
+
+    // uninitialized like a double, the temporaries of the Eigen expressions are not zeroed
+    Pack() {}
+    Pack(double value) { for (int i = 0; i < N; i++) { v[i] = value; } }
+
+    static Pack fromVector(const Vector& value) { Pack p; p.v = value; return p; }
+
+    double& operator[](int i) { return reinterpret_cast<double*>(&v)[i]; }
+    double operator[](int i) const { return v[i]; }
+
+    Pack& operator+=(const Pack& b) { v += b.v; return *this; }
+    Pack& operator-=(const Pack& b) { v -= b.v; return *this; }
+    Pack& operator*=(const Pack& b) { v *= b.v; return *this; }
+    Pack& operator/=(const Pack& b) { v /= b.v; return *this; }
+
+    friend Pack operator+(const Pack& a, const Pack& b) { return fromVector(a.v + b.v); }
+    friend Pack operator-(const Pack& a, const Pack& b) { return fromVector(a.v - b.v); }
+    friend Pack operator-(const Pack& a) { return fromVector(-a.v); }
+    friend Pack operator*(const Pack& a, const Pack& b) { return fromVector(a.v * b.v); }
+    friend Pack operator/(const Pack& a, const Pack& b) { return fromVector(a.v / b.v); }
+
+    friend Pack operator+(const Pack& a, double b) { return fromVector(a.v + b); }
+    friend Pack operator+(double a, const Pack& b) { return fromVector(a + b.v); }
+    friend Pack operator-(const Pack& a, double b) { return fromVector(a.v - b); }
+    friend Pack operator-(double a, const Pack& b) { return fromVector(a - b.v); }
+    friend Pack operator*(const Pack& a, double b) { return fromVector(a.v * b); }
+    friend Pack operator*(double a, const Pack& b) { return fromVector(a * b.v); }
+    friend Pack operator/(const Pack& a, double b) { return fromVector(a.v / b); }
+
+    friend Pack sin(const Pack& a) { Pack r; for (int i = 0; i < N; i++) { r.v[i] = std::sin(a.v[i]); } return r; }
+    friend Pack cos(const Pack& a) { Pack r; for (int i = 0; i < N; i++) { r.v[i] = std::cos(a.v[i]); } return r; }
+    friend Pack sqrt(const Pack& a) { Pack r; for (int i = 0; i < N; i++) { r.v[i] = std::sqrt(a.v[i]); } return r; }
+    friend Pack abs(const Pack& a) { Pack r; for (int i = 0; i < N; i++) { r.v[i] = std::abs(a.v[i]); } return r; }
+    friend Pack pow(const Pack& a, const Pack& b) { Pack r; for (int i = 0; i < N; i++) { r.v[i] = std::pow(a.v[i], b.v[i]); } return r; }
+};
+
+}
+
+namespace Eigen {
+
+template<int N>
+struct NumTraits<admm::Pack<N>> : NumTraits<double>
+{
+    typedef admm::Pack<N> Real;
+    typedef admm::Pack<N> NonInteger;
+    typedef admm::Pack<N> Nested;
+    typedef admm::Pack<N> Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = 1,
+        AddCost = 1,
+        MulCost = 1
+    };
+};
+
+// double coefficients, e.g. the inertias of a model, are broadcast to every lane
+template<int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<admm::Pack<N>, double, BinaryOp> { typedef admm::Pack<N> ReturnType; };
+
+template<int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, admm::Pack<N>, BinaryOp> { typedef admm::Pack<N> ReturnType; };
+
+}
+
+#endif // SIMD_PACK_H
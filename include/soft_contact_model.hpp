@@ -4,7 +4,6 @@
 #include <Eigen/Dense>
 #include <iostream>
 #include <math.h>      
-#include <mutex>
 
 namespace ContactModel {
 
@@ -16,6 +15,23 @@ struct ContactParams {
    SCALAR R;      // contact tool radius
    SCALAR R_path; // radius of the tracking path
    SCALAR Kd;     // dampning of the surface
+
+   // flat parameter vector, the order of the parameter inputs of the generated code
+   static const int SIZE = 6;
+
+   Eigen::Matrix<SCALAR, SIZE, 1> toVector() const
+   {
+      Eigen::Matrix<SCALAR, SIZE, 1> p;
+      p << E, mu, nu, R, R_path, Kd;
+      return p;
+   }
+
+   static ContactParams fromVector(const Eigen::Matrix<SCALAR, SIZE, 1>& p)
+   {
+      ContactParams cp;
+      cp.E = p(0); cp.mu = p(1); cp.nu = p(2); cp.R = p(3); cp.R_path = p(4); cp.Kd = p(5);
+      return cp;
+   }
 };
 
 template<typename SCALAR>
@@ -28,7 +44,6 @@ public:
 
    typedef typename Eigen::Matrix<SCALAR, 3, 1> Vector3s;
    typedef typename Eigen::Matrix<SCALAR, 3, 3> Matrix3s;
-   std::mutex mu;
 
 
 SoftContactModel() {
@@ -53,6 +68,9 @@ SoftContactModel& operator=(const SoftContactModel<SCALAR>& other)
   return *this;
 }
 
+const ContactParams<SCALAR>& getParams() const { return m_cp; }
+void setParams(const ContactParams<SCALAR>& cp) { m_cp = cp; }
+
  /*
   * Soft Contact Modelling Based off Contact Mechanics
   * - states (STATE_DIM parameters)
@@ -60,12 +78,11 @@ SoftContactModel& operator=(const SoftContactModel<SCALAR>& other)
   * - desired end-effector positions (3 parameters)
   * - desired end-effector orientation (9 parameters)
   * - time (1 parameter)
+  * Only reads the contact parameters, safe to call concurrently.
   */
 void df(const Eigen::Matrix<SCALAR, 3, 3>& mass_matrix_cart, const Eigen::Matrix<SCALAR, 3, 1>& position, const Eigen::Matrix<SCALAR, 3, 3>& orientation,
-   const Eigen::Matrix<SCALAR, 3, 1>& velocity_, const Eigen::Matrix<SCALAR, 3, 1>& acceleration, const Eigen::Matrix<SCALAR, 3, 1>& force_current, Eigen::Matrix<SCALAR, 3, 1>& df_)
+   const Eigen::Matrix<SCALAR, 3, 1>& velocity_, const Eigen::Matrix<SCALAR, 3, 1>& acceleration, const Eigen::Matrix<SCALAR, 3, 1>& force_current, Eigen::Matrix<SCALAR, 3, 1>& df_) const
 {
-
-   std::lock_guard<std::mutex> lk(mu);
    Eigen::Matrix<SCALAR, 3, 1> velDir;
 
    /* -------------- Normal force calculation -------------- */
@@ -106,7 +123,7 @@ void df(const Eigen::Matrix<SCALAR, 3, 3>& mass_matrix_cart, const Eigen::Matrix
 
 
 /* implement a way to estimate the surface normal from state data. */
-inline Eigen::Matrix<SCALAR, 3, 1> surfaceNormal(const Eigen::Matrix<SCALAR, 3, 1>& force)
+inline Eigen::Matrix<SCALAR, 3, 1> surfaceNormal(const Eigen::Matrix<SCALAR, 3, 1>& force) const
 {
    Eigen::Matrix<SCALAR, 3, 1> surf(SCALAR(0), SCALAR(0), SCALAR(1));
    return surf;
@@ -0,0 +1,259 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <ct/core/core.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+ * Generates one entry point returning f(x, u), dF/dx and dF/du of a system from a single subexpression sweep.
+ * ADCodegenLinearizer emits getDerivativeState and getDerivativeControl as two functions, each with its own
+ * temporaries, so the trigonometry and the rigid body recursions they share are evaluated twice per knot.
+ * Here the value and every Jacobian direction are traced into one CodeHandler, so CppADCodeGen eliminates the common
+ * subexpressions across all of them. The Jacobian is taken in forward (one sweep per input) or reverse (one sweep per
+ * output) mode.
+ *
+ * Only the structural non-zeros of the Jacobian are evaluated, from the sparsity pattern CppAD propagates through f
+ * (e.g. the position rows d(q)/dt = qd are a single 1 each, and do not depend on u).
+ *
+ * PARAM_DIM > 0 adds model parameters p as runtime inputs, f(x, u; p), so the generated code does not bake in the
+ * values the system was constructed with. They are not differentiated, the class keeps them between calls.
+ *
+ * The generated class NAME in ct::models::NS has
+ *   NNZ, ROWS[NNZ], COLS[NNZ]   the pattern, row-major, columns counted over (x, u)
+ *   void setParameters(const param_vector_t& p)   if PARAM_DIM > 0, initialized to the defaults given to the generator
+ *   void linearizeSparse(const state_vector_t& x, const control_vector_t& u, state_vector_t& f, values_t& values)
+ *   void linearize(const state_vector_t& x, const control_vector_t& u, state_vector_t& f, state_matrix_t& A, state_control_matrix_t& B)
+ * with A and B the derivatives of the continuous time dynamics, like getDerivativeState and getDerivativeControl,
+ * scattered from the compressed values (see also admm::JacobianPattern).
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t PARAM_DIM = 0>
+class FusedLinearizationCodegen
+{
+public:
+    typedef CppAD::cg::CG<double> CGScalar;
+    typedef CppAD::AD<CGScalar> ADCGScalar;
+    typedef ct::core::ControlledSystem<STATE_DIM, CONTROL_DIM, ADCGScalar> System;
+    typedef Eigen::Matrix<ADCGScalar, PARAM_DIM, 1> ADParameters;
+    typedef Eigen::Matrix<double, PARAM_DIM, 1> Parameters;
+
+    static const size_t LIN_DIM = STATE_DIM + CONTROL_DIM;  // the Jacobian columns
+    static const size_t IN_DIM = LIN_DIM + PARAM_DIM;
+
+    FusedLinearizationCodegen(std::shared_ptr<System> system) : system_(system)
+    {
+        static_assert(PARAM_DIM == 0, "parameters need setParameters and their defaults");
+    }
+
+    // setParameters writes the taped parameters into the system before f is recorded
+    FusedLinearizationCodegen(std::shared_ptr<System> system, std::function<void(const ADParameters&)> setParameters, const Parameters& defaults)
+        : system_(system), setParameters_(setParameters), defaults_(defaults)
+    {
+    }
+
+    void generateCode(const std::string& name, const std::string& outputDir, const std::string& ns, bool useReverse)
+    {
+        // record f(x, u; p)
+        CppAD::vector<ADCGScalar> xu(IN_DIM);
+        for (size_t i = 0; i < LIN_DIM; i++) { xu[i] = ADCGScalar(0.0); }
+        for (size_t i = 0; i < PARAM_DIM; i++) { xu[LIN_DIM + i] = ADCGScalar(defaults_(i)); }
+        CppAD::Independent(xu);
+
+        ct::core::StateVector<STATE_DIM, ADCGScalar> x;
+        ct::core::ControlVector<CONTROL_DIM, ADCGScalar> u;
+        ct::core::StateVector<STATE_DIM, ADCGScalar> xdot;
+        for (size_t i = 0; i < STATE_DIM; i++) { x(i) = xu[i]; }
+        for (size_t i = 0; i < CONTROL_DIM; i++) { u(i) = xu[STATE_DIM + i]; }
+
+        if (PARAM_DIM > 0)
+        {
+            ADParameters p;
+            for (size_t i = 0; i < PARAM_DIM; i++) { p(i) = xu[LIN_DIM + i]; }
+            setParameters_(p);
+        }
+
+        system_->computeControlledDynamics(x, ADCGScalar(0.0), u, xdot);
+
+        CppAD::vector<ADCGScalar> y(STATE_DIM);
+        for (size_t i = 0; i < STATE_DIM; i++) { y[i] = xdot(i); }
+
+        CppAD::ADFun<CGScalar> fun(xu, y);
+        fun.optimize();
+
+        // structural non-zeros of the Jacobian wrt (x, u), row-major
+        std::vector<std::set<size_t>> identity(IN_DIM);
+        for (size_t j = 0; j < IN_DIM; j++) { identity[j].insert(j); }
+        std::vector<std::set<size_t>> sparsity = fun.ForSparseJac(IN_DIM, identity);
+
+        rows_.clear();
+        cols_.clear();
+        for (size_t i = 0; i < STATE_DIM; i++)
+        {
+            for (size_t j : sparsity[i])
+            {
+                if (j < LIN_DIM) { rows_.push_back(i); cols_.push_back(j); }
+            }
+        }
+        const size_t nnz = rows_.size();
+
+        // value and non-zeros in one code handler: y = [f; values]
+        CppAD::cg::CodeHandler<double> handler;
+        CppAD::vector<CGScalar> in(IN_DIM);
+        handler.makeVariables(in);
+
+        CppAD::vector<CGScalar> jac(STATE_DIM * LIN_DIM);
+        CppAD::vector<CGScalar> value = fun.Forward(0, in);
+
+        if (useReverse)
+        {
+            CppAD::vector<CGScalar> w(STATE_DIM);
+            for (size_t i = 0; i < STATE_DIM; i++)
+            {
+                if (sparsity[i].empty()) continue;
+                for (size_t k = 0; k < STATE_DIM; k++) { w[k] = CGScalar(k == i ? 1.0 : 0.0); }
+                CppAD::vector<CGScalar> row = fun.Reverse(1, w);
+                for (size_t j = 0; j < LIN_DIM; j++) { jac[i * LIN_DIM + j] = row[j]; }
+            }
+        }
+        else
+        {
+            CppAD::vector<CGScalar> dxu(IN_DIM);
+            for (size_t j = 0; j < LIN_DIM; j++)
+            {
+                for (size_t k = 0; k < IN_DIM; k++) { dxu[k] = CGScalar(k == j ? 1.0 : 0.0); }
+                CppAD::vector<CGScalar> column = fun.Forward(1, dxu);
+                for (size_t i = 0; i < STATE_DIM; i++) { jac[i * LIN_DIM + j] = column[i]; }
+            }
+        }
+
+        // the structural zeros are not outputs, the code handler drops what only they depend on
+        CppAD::vector<CGScalar> out(STATE_DIM + nnz);
+        for (size_t i = 0; i < STATE_DIM; i++) { out[i] = value[i]; }
+        for (size_t n = 0; n < nnz; n++) { out[STATE_DIM + n] = jac[rows_[n] * LIN_DIM + cols_[n]]; }
+
+        CppAD::cg::LanguageC<double> langC("double");
+        CppAD::cg::LangCDefaultVariableNameGenerator<double> nameGen("y", "x", "v");
+        std::ostringstream body;
+        handler.generateCode(body, langC, out, nameGen);
+
+        writeHeader(name, outputDir, ns, handler.getTemporaryVariableCount());
+        writeSource(name, outputDir, ns, body.str());
+    }
+
+private:
+    void writeHeader(const std::string& name, const std::string& outputDir, const std::string& ns, size_t temporaries) const
+    {
+        std::ostringstream params, paramsType, paramsApi;
+        if (PARAM_DIM > 0)
+        {
+            params << "    static const size_t PARAM_DIM = " << PARAM_DIM << ";\n";
+            paramsType << "    typedef Eigen::Matrix<double, PARAM_DIM, 1> param_vector_t;\n";
+            paramsApi << "    // starts with the parameters the code was generated with\n"
+                      << "    " << name << "();\n\n"
+                      << "    // parameters of f(x, u; p), kept for the following calls\n"
+                      << "    void setParameters(const param_vector_t& p);\n\n";
+        }
+
+        std::ofstream file(outputDir + "/" + name + ".h");
+        file << "// generated by FusedLinearizationCodegen, do not edit\n\n"
+             << "#pragma once\n\n#include <array>\n#include <Eigen/Core>\n\n"
+             << "namespace ct {\nnamespace models {\nnamespace " << ns << " {\n\n"
+             << "class " << name << "\n{\npublic:\n"
+             << "    EIGEN_MAKE_ALIGNED_OPERATOR_NEW\n\n"
+             << "    static const size_t STATE_DIM = " << STATE_DIM << ";\n"
+             << "    static const size_t CONTROL_DIM = " << CONTROL_DIM << ";\n"
+             << params.str()
+             << "    static const int NNZ = " << rows_.size() << ";\n\n"
+             << "    // structural non-zeros of [dF/dx, dF/du], row-major\n"
+             << "    static const int ROWS[NNZ];\n"
+             << "    static const int COLS[NNZ];\n\n"
+             << "    typedef Eigen::Matrix<double, STATE_DIM, 1> state_vector_t;\n"
+             << "    typedef Eigen::Matrix<double, CONTROL_DIM, 1> control_vector_t;\n"
+             << "    typedef Eigen::Matrix<double, STATE_DIM, STATE_DIM> state_matrix_t;\n"
+             << "    typedef Eigen::Matrix<double, STATE_DIM, CONTROL_DIM> state_control_matrix_t;\n"
+             << "    typedef Eigen::Matrix<double, NNZ, 1> values_t;\n"
+             << paramsType.str() << "\n"
+             << paramsApi.str()
+             << "    // f(x, u) and the non-zeros of dF/d(x, u) from one subexpression sweep\n"
+             << "    void linearizeSparse(const state_vector_t& x, const control_vector_t& u, state_vector_t& f, values_t& values);\n\n"
+             << "    // same, scattered into dense dF/dx and dF/du\n"
+             << "    void linearize(const state_vector_t& x, const control_vector_t& u, state_vector_t& f, state_matrix_t& A, state_control_matrix_t& B);\n\n"
+             << "private:\n"
+             << "    std::array<double, " << IN_DIM << "> in_;\n"
+             << "    std::array<double, " << STATE_DIM + rows_.size() << "> out_;\n"
+             << "    std::array<double, " << std::max<size_t>(temporaries, 1) << "> v_;\n"
+             << "    values_t values_;\n"
+             << "};\n\n"
+             << "}  // namespace " << ns << "\n}  // namespace models\n}  // namespace ct\n";
+    }
+
+    void writeSource(const std::string& name, const std::string& outputDir, const std::string& ns, const std::string& body) const
+    {
+        std::ostringstream params;
+        if (PARAM_DIM > 0)
+        {
+            params << name << "::" << name << "()\n{\n"
+                   << "    const double defaults[PARAM_DIM] = {" << join(std::vector<double>(defaults_.data(), defaults_.data() + PARAM_DIM)) << "};\n"
+                   << "    std::copy(defaults, defaults + PARAM_DIM, in_.begin() + STATE_DIM + CONTROL_DIM);\n"
+                   << "}\n\n"
+                   << "void " << name << "::setParameters(const param_vector_t& p)\n{\n"
+                   << "    Eigen::Map<param_vector_t>(in_.data() + STATE_DIM + CONTROL_DIM) = p;\n"
+                   << "}\n\n";
+        }
+
+        std::ofstream file(outputDir + "/" + name + ".cpp");
+        file << "// generated by FusedLinearizationCodegen, do not edit\n\n"
+             << "// clang-format off\n\n"
+             << "#include <algorithm>\n#include <cmath>\n#include \"" << name << ".h\"\n\n"
+             << "namespace ct {\nnamespace models {\nnamespace " << ns << " {\n\n"
+             << "const int " << name << "::ROWS[" << name << "::NNZ] = {" << join(rows_) << "};\n"
+             << "const int " << name << "::COLS[" << name << "::NNZ] = {" << join(cols_) << "};\n\n"
+             << params.str()
+             << "void " << name << "::linearizeSparse(const state_vector_t& state, const control_vector_t& control, state_vector_t& f, values_t& values)\n{\n"
+             << "    Eigen::Map<state_vector_t>(in_.data()) = state;\n"
+             << "    Eigen::Map<control_vector_t>(in_.data() + STATE_DIM) = control;\n\n"
+             << "    const double* x = in_.data();\n"
+             << "    double* y = out_.data();\n"
+             << "    double* v = v_.data();\n\n"
+             << body << "\n"
+             << "    f = Eigen::Map<const state_vector_t>(y);\n"
+             << "    values = Eigen::Map<const values_t>(y + STATE_DIM);\n"
+             << "}\n\n"
+             << "void " << name << "::linearize(const state_vector_t& state, const control_vector_t& control, state_vector_t& f, state_matrix_t& A, state_control_matrix_t& B)\n{\n"
+             << "    linearizeSparse(state, control, f, values_);\n\n"
+             << "    A.setZero();\n"
+             << "    B.setZero();\n"
+             << "    for (int n = 0; n < NNZ; n++)\n"
+             << "    {\n"
+             << "        if (COLS[n] < (int)STATE_DIM) A(ROWS[n], COLS[n]) = values_[n];\n"
+             << "        else B(ROWS[n], COLS[n] - STATE_DIM) = values_[n];\n"
+             << "    }\n"
+             << "}\n\n"
+             << "}  // namespace " << ns << "\n}  // namespace models\n}  // namespace ct\n\n"
+             << "// clang-format on\n";
+    }
+
+    template <typename T>
+    static std::string join(const std::vector<T>& list)
+    {
+        std::ostringstream out;
+        out.precision(17);
+        for (size_t n = 0; n < list.size(); n++) { out << (n ? ", " : "") << list[n]; }
+        return out.str();
+    }
+
+    std::shared_ptr<System> system_;
+    std::function<void(const ADParameters&)> setParameters_;
+    Parameters defaults_;
+    std::vector<size_t> rows_, cols_;   // pattern of the last generateCode
+};
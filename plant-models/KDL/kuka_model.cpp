@@ -4,77 +4,35 @@
 
 KUKAModelKDL::KUKAModelKDL(const KDL::Chain& robotChain, const KUKAModelKDLInternalData& robotParams) : robotChain_(robotChain), robotParams_(robotParams) 
 {
-    dynamicsChain_ = new KDL::ChainDynParam(robotChain_, KDL::Vector(0,0,-9.8));
+    revoluteChain_ = true;
+    for (unsigned int i = 0; i < robotChain_.getNrOfSegments(); i++)
+    {
+        const KDL::Joint::JointType type = robotChain_.getSegment(i).getJoint().getType();
+        if (type != KDL::Joint::None && type != KDL::Joint::RotAxis && type != KDL::Joint::RotX && type != KDL::Joint::RotY && type != KDL::Joint::RotZ)
+        {
+            revoluteChain_ = false;
+        }
+    }
+
+    m_ws.reset(new KUKAModelKDLWorkspace(robotChain_));
 } 
 
-KUKAModelKDL::~KUKAModelKDL()
-{
-    delete dynamicsChain_;
-}
+KUKAModelKDL::~KUKAModelKDL() = default;
 
 int KUKAModelKDL::initRobot() 
 {
-    q_.resize(7);
-    qd_.resize(7);
-    qdd_.resize(7);
-    inertia_mat_.resize(7);
-    coriolis_.resize(7);
-    gravity_.resize(7);
-    jacobian_.resize(7);
-
     robotParams_.Kv = Eigen::MatrixXd::Zero(7, 7);
     robotParams_.Kv.diagonal() << 3.7, 1.5, 1.7, 1.9, 2, 2, 2;
 
+    if (fdAlgorithm_ == ForwardDynamicsAlgorithm::ArticulatedBody) {getRigidBodyChain(chain_);}
 
     return true;
 }
 
+/* ------------------------------------ legacy interface, runs on the model's own workspace ------------------------------------ */
 void KUKAModelKDL::getForwardKinematics(double* q, double* qd, double *qdd, Eigen::Matrix<double,3,3>& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther)
 {
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    memcpy(qd_.data.data(), qd, 7 * sizeof(double));
-    memcpy(qdd_.data.data(), qdd, 7 * sizeof(double));
-
-    // TODO: make it updatable
-    Eigen::MatrixXd T(3,3);
-    T << -1, 0, 0, 0, -1, 0, 0, 0, 1;
-
-    if (computeOther)
-    {
-        // compute pose, vel
-        KDL::ChainFkSolverVel_recursive fksolver_vel(robotChain_);
-        KDL::JntArrayVel jntVel(q_, qd_);
-        fksolver_vel.JntToCart(jntVel, frame_vel_, -1);
-        memcpy(poseM.data(), frame_vel_.M.R.data, 9 * sizeof(double));
-        memcpy(poseP.data(), frame_vel_.p.p.data, 3 * sizeof(double));
-        memcpy(vel.data(), frame_vel_.p.v.data, 3 * sizeof(double));
-        poseM.transposeInPlace();
-
-        poseM = poseM.eval() * T; 
-        // poseP = T * poseP.eval();
-
-        // compute accel
-        KDL::ChainJntToJacSolver jacSolver(robotChain_);
-        jacSolver.JntToJac(q_, jacobian_);
-        // accel = std::move(jacobian_.data * qdd_.data);
-        
-        KDL::ChainJntToJacDotSolver jacDotSolver(robotChain_);
-        jacDotSolver.JntToJacDot(jntVel, jacobian_, -1);
-        // accel += jacobian_.data * qd_.data;
-
-
-    } else 
-    {
-        // compute pose
-        KDL::ChainFkSolverPos_recursive fksolver_pos(robotChain_);
-        fksolver_pos.JntToCart(q_, frame_, -1); 
-        memcpy(poseM.data(), frame_.M.data, 9 * sizeof(double));
-        memcpy(poseP.data(), frame_.p.data, 3 * sizeof(double));
-        poseM.transposeInPlace();
-
-        poseM = poseM.eval() * T; 
-        // poseP = T * poseP.eval();
-    }
+    getForwardKinematics(*m_ws, q, qd, qdd, poseM, poseP, vel, accel, computeOther);
 }
 
 /* given q, qdot, qddot, outputs torque output*/
@@ -85,67 +43,225 @@ void KUKAModelKDL::getInverseDynamics(double* q, double* qd, double* qdd, Eigen:
 
 void KUKAModelKDL::getForwardDynamics(double* q, double* qd, const Eigen::VectorXd& force_ext, Eigen::VectorXd& qdd)
 {
-
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    memcpy(qd_.data.data(), qd, 7 * sizeof(double));
-    
-    dynamicsChain_->JntToMass(q_, inertia_mat_);
-    dynamicsChain_->JntToCoriolis(q_, qd_, coriolis_);
-    dynamicsChain_->JntToGravity(q_, gravity_);
-
-    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd> > llt(inertia_mat_.data); // Do LU decomposition. This is faster than the SVD approach.
-
-
-    qdd = std::move(llt.solve(force_ext - robotParams_.Kv * qd_.data - coriolis_.data + 0 * gravity_.data)); 
+    qdd.resize(7);
+    getForwardDynamics(*m_ws, q, qd, force_ext, qdd);
 }
 
 void KUKAModelKDL::getMassMatrix(double* q, Eigen::MatrixXd& massMatrix)
 {
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    dynamicsChain_->JntToMass(q_, inertia_mat_);
-    massMatrix = std::move(inertia_mat_.data);
+    memcpy(m_ws->jntVel.q.data.data(), q, 7 * sizeof(double));
+    m_ws->dynamicsChain.JntToMass(m_ws->jntVel.q, m_ws->inertia_mat);
+    massMatrix = m_ws->inertia_mat.data;
 }
 
 void KUKAModelKDL::getCoriolisMatrix(double* q, double* qd, Eigen::VectorXd& coriolis) // change
 {
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    memcpy(qd_.data.data(), qd, 7 * sizeof(double));
-    dynamicsChain_->JntToCoriolis(q_, qd_, coriolis_);
-    coriolis = std::move(coriolis_.data);
+    memcpy(m_ws->jntVel.q.data.data(), q, 7 * sizeof(double));
+    memcpy(m_ws->jntVel.qdot.data.data(), qd, 7 * sizeof(double));
+    m_ws->dynamicsChain.JntToCoriolis(m_ws->jntVel.q, m_ws->jntVel.qdot, m_ws->coriolis);
+    coriolis = m_ws->coriolis.data;
 }
 
 void KUKAModelKDL::getGravityVector(double* q, Eigen::VectorXd& gravityTorque)
 {
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    dynamicsChain_->JntToGravity(q_, gravity_);
-    gravityTorque = std::move(gravity_.data);
+    memcpy(m_ws->jntVel.q.data.data(), q, 7 * sizeof(double));
+    m_ws->dynamicsChain.JntToGravity(m_ws->jntVel.q, m_ws->coriolis);
+    gravityTorque = m_ws->coriolis.data;
 }
 
 void KUKAModelKDL::getSpatialJacobian(double* q, Eigen::MatrixXd& jacobian)
 {   
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    KDL::ChainJntToJacSolver jacSolver(robotChain_);
-    jacSolver.JntToJac(q_, jacobian_);
-    jacobian = std::move(jacobian_.data);
+    jacobian.resize(6, 7);
+    getSpatialJacobian(*m_ws, q, jacobian);
 }
 
 void KUKAModelKDL::getSpatialJacobianDot(double* q, double* qd, Eigen::MatrixXd& jacobianDot)
 {   
-    memcpy(q_.data.data(), q, 7 * sizeof(double));
-    memcpy(qd_.data.data(), qd, 7 * sizeof(double));
-    KDL::ChainJntToJacDotSolver jacDotSolver(robotChain_);
+    jacobianDot.resize(6, 7);
+    getSpatialJacobianDot(*m_ws, q, qd, jacobianDot);
+}
+
+void KUKAModelKDL::ik()
+{
+    
+}
+
+/* ------------------------------------ reentrant interface ------------------------------------ */
+std::unique_ptr<RobotAbstractWorkspace> KUKAModelKDL::createWorkspace()
+{
+    return std::unique_ptr<RobotAbstractWorkspace>(new KUKAModelKDLWorkspace(robotChain_));
+}
 
-    KDL::JntArrayVel jntVel(q_, qd_);
+void KUKAModelKDL::getForwardKinematics(RobotAbstractWorkspace& workspace, const double* q, const double* qd, const double* qdd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther)
+{
+    KUKAModelKDLWorkspace& ws = static_cast<KUKAModelKDLWorkspace&>(workspace);
 
-    jacDotSolver.JntToJacDot(jntVel, jacobian_, -1);
-    jacobianDot = std::move(jacobian_.data);
+    memcpy(ws.jntVel.q.data.data(), q, 7 * sizeof(double));
+    memcpy(ws.jntVel.qdot.data.data(), qd, 7 * sizeof(double));
+    memcpy(ws.qdd.data.data(), qdd, 7 * sizeof(double));
+
+    // compute pose, vel, and the Jacobian and its derivative for the accel in the same sweep
+    if (computeOther)
+    {
+        getKinematics(ws, q, qd, poseM, poseP, vel, ws.jacobian.data, ws.jacobianDot.data, true);
+
+        accel = ws.jacobian.data.topRows(3) * ws.qdd.data + ws.jacobianDot.data.topRows(3) * ws.jntVel.qdot.data;
+        return;
+    }
+
+    ws.fksolver_vel.JntToCart(ws.jntVel, ws.frame_vel, -1);
+    memcpy(poseM.data(), ws.frame_vel.M.R.data, 9 * sizeof(double));
+    memcpy(poseP.data(), ws.frame_vel.p.p.data, 3 * sizeof(double));
+    memcpy(vel.data(), ws.frame_vel.p.v.data, 3 * sizeof(double));
+    poseM.transposeInPlace();
+
+    poseM = poseM.eval() * eeRotation(); 
 }
 
-void KUKAModelKDL::ik()
+void KUKAModelKDL::getForwardDynamics(RobotAbstractWorkspace& workspace, const double* q, const double* qd, const Eigen::Ref<const Eigen::VectorXd>& force_ext, Eigen::Ref<Eigen::VectorXd> qdd)
 {
+    KUKAModelKDLWorkspace& ws = static_cast<KUKAModelKDLWorkspace&>(workspace);
+
+    if (fdAlgorithm_ == ForwardDynamicsAlgorithm::ArticulatedBody)
+    {
+        const Eigen::Matrix<double, 7, 1> q_ = Eigen::Map<const Eigen::Matrix<double, 7, 1> >(q);
+        const Eigen::Matrix<double, 7, 1> qd_ = Eigen::Map<const Eigen::Matrix<double, 7, 1> >(qd);
+        const Eigen::Matrix<double, 7, 1> tau = force_ext;
+
+        chain_.articulatedBodyDynamics(q_, qd_, tau, ws.rhs);
+        qdd = ws.rhs;
+        return;
+    }
+
+    memcpy(ws.jntVel.q.data.data(), q, 7 * sizeof(double));
+    memcpy(ws.jntVel.qdot.data.data(), qd, 7 * sizeof(double));
     
+    ws.dynamicsChain.JntToMass(ws.jntVel.q, ws.inertia_mat);
+    ws.dynamicsChain.JntToCoriolis(ws.jntVel.q, ws.jntVel.qdot, ws.coriolis);
+
+    // gravity is not applied, the arm is gravity compensated
+    ws.rhs.noalias() = force_ext - robotParams_.Kv * ws.jntVel.qdot.data - ws.coriolis.data;
+
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd> > llt(ws.inertia_mat.data); // in place on the workspace
+    llt.solveInPlace(ws.rhs);
+    qdd = ws.rhs;
+}
+
+void KUKAModelKDL::getSpatialJacobian(RobotAbstractWorkspace& workspace, const double* q, Eigen::Ref<Eigen::MatrixXd> jacobian)
+{
+    KUKAModelKDLWorkspace& ws = static_cast<KUKAModelKDLWorkspace&>(workspace);
+
+    memcpy(ws.jntVel.q.data.data(), q, 7 * sizeof(double));
+    ws.jacSolver.JntToJac(ws.jntVel.q, ws.jacobian);
+    jacobian = ws.jacobian.data;
+}
+
+void KUKAModelKDL::getSpatialJacobianDot(RobotAbstractWorkspace& workspace, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> jacobianDot)
+{
+    KUKAModelKDLWorkspace& ws = static_cast<KUKAModelKDLWorkspace&>(workspace);
+
+    memcpy(ws.jntVel.q.data.data(), q, 7 * sizeof(double));
+    memcpy(ws.jntVel.qdot.data.data(), qd, 7 * sizeof(double));
+    ws.jacDotSolver.JntToJacDot(ws.jntVel, ws.jacobianDot, -1);
+    jacobianDot = ws.jacobianDot.data;
+}
+
+/*
+ * One sweep base to tip collects the joint axes z_i, points o_i on them, and their rates zdot_i = w x z_i and odot_i,
+ * with w the angular velocity of the body carrying joint i. Column i of the Jacobian is then [z_i x (p - o_i); z_i] and its
+ * derivative [zdot_i x (p - o_i) + z_i x (pdot - odot_i); zdot_i], the reference point and base frame of ChainJntToJacSolver
+ * and of the hybrid ChainJntToJacDotSolver. Chains with prismatic joints take the composed default.
+ */
+void KUKAModelKDL::getKinematics(RobotAbstractWorkspace& workspace, const double* q, const double* qd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Ref<Eigen::MatrixXd> jacobian, Eigen::Ref<Eigen::MatrixXd> jacobianDot, bool computeJacobianDot)
+{
+    if (!revoluteChain_)
+    {
+        RobotAbstract::getKinematics(workspace, q, qd, poseM, poseP, vel, jacobian, jacobianDot, computeJacobianDot);
+        return;
+    }
+
+    KUKAModelKDLWorkspace& ws = static_cast<KUKAModelKDLWorkspace&>(workspace);
+
+    KDL::Frame T = KDL::Frame::Identity();
+    Eigen::Vector3d w = Eigen::Vector3d::Zero();
+    Eigen::Vector3d v = Eigen::Vector3d::Zero();     // velocity of the last joint point
+    Eigen::Vector3d o = Eigen::Vector3d::Zero();
+
+    unsigned int j = 0;
+    for (unsigned int i = 0; i < robotChain_.getNrOfSegments(); i++)
+    {
+        const KDL::Segment& segment = robotChain_.getSegment(i);
+        const KDL::Joint& joint = segment.getJoint();
+        if (joint.getType() == KDL::Joint::None)
+        {
+            T = T * segment.pose(0.0);
+            continue;
+        }
+
+        const KDL::Vector axis = T.M * joint.JointAxis();
+        const KDL::Vector origin = T * joint.JointOrigin();
+        ws.axes.col(j) << axis.x(), axis.y(), axis.z();
+        ws.origins.col(j) << origin.x(), origin.y(), origin.z();
+
+        v += w.cross(ws.origins.col(j) - o);
+        o = ws.origins.col(j);
+        ws.originsVel.col(j) = v;
+        ws.axesDot.col(j) = w.cross(ws.axes.col(j));
+
+        w += qd[j] * ws.axes.col(j);
+        T = T * segment.pose(q[j]);
+        j++;
+    }
+
+    poseP << T.p.x(), T.p.y(), T.p.z();
+    vel = v + w.cross(poseP - o);
+    poseM = Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> >(T.M.data) * eeRotation();
+
+    for (j = 0; j < 7; j++)
+    {
+        const Eigen::Vector3d r = poseP - ws.origins.col(j);
+        jacobian.col(j) << ws.axes.col(j).cross(r), ws.axes.col(j);
+
+        if (computeJacobianDot)
+        {
+            jacobianDot.col(j) << ws.axesDot.col(j).cross(r) + ws.axes.col(j).cross(vel - ws.originsVel.col(j)), ws.axesDot.col(j);
+        }
+    }
 }
 
+void KUKAModelKDL::setForwardDynamicsAlgorithm(ForwardDynamicsAlgorithm algorithm)
+{
+    // rebuilt on every switch, so the damping follows robotParams_.Kv
+    if (algorithm == ForwardDynamicsAlgorithm::ArticulatedBody && !getRigidBodyChain(chain_))
+    {
+        throw std::invalid_argument("KUKAModelKDL: the articulated body algorithm takes a chain of revolute z joints");
+    }
+    fdAlgorithm_ = algorithm;
+}
 
+bool KUKAModelKDL::getRigidBodyChain(admm::RigidBodyChain& chain) const
+{
+    typedef Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> > RowMajorMap;
+
+    chain = admm::RigidBodyChain();
+    for (unsigned int i = 0; i < robotChain_.getNrOfSegments(); i++)
+    {
+        const KDL::Segment& segment = robotChain_.getSegment(i);
+        const KDL::Joint& joint = segment.getJoint();
+        if (joint.getType() != KDL::Joint::RotZ && joint.getType() != KDL::Joint::None) return false;
 
+        const KDL::Frame& tip = segment.getFrameToTip();
+        const KDL::RigidBodyInertia& inertia = segment.getInertia();
+        const KDL::Vector cog = inertia.getCOG();
 
+        chain.addBody(joint.getType() == KDL::Joint::RotZ, RowMajorMap(tip.M.data), Eigen::Vector3d(tip.p.x(), tip.p.y(), tip.p.z()),
+                      inertia.getMass(), inertia.getMass() * Eigen::Vector3d(cog.x(), cog.y(), cog.z()),
+                      RowMajorMap(inertia.getRotationalInertia().data), joint.getInertia());
+    }
+
+    // getForwardDynamics applies the joint damping but not gravity, getForwardKinematics rotates the end-effector by T
+    chain.gravity.setZero();
+    chain.damping = robotParams_.Kv.diagonal();
+    chain.eeRotation = eeRotation();
+    return true;
+}
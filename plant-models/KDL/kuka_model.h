@@ -20,6 +20,7 @@
 #include <string.h>
 #include <iostream>
 #include <algorithm>
+#include <stdexcept>
 
 #include "models.h"
 #include "RobotAbstract.h"
@@ -32,10 +33,40 @@ struct KUKAModelKDLInternalData : RobotAbstractInternalData
     Eigen::MatrixXd Kp;
 };
 
+/* scratch of one caller of the model, the KDL solvers keep internal buffers. must not outlive the model */
+struct KUKAModelKDLWorkspace : RobotAbstractWorkspace
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    KUKAModelKDLWorkspace(const KDL::Chain& robotChain) : fksolver_vel(robotChain), jacSolver(robotChain), jacDotSolver(robotChain), 
+        dynamicsChain(robotChain, KDL::Vector(0,0,-9.8)), jntVel(7), qdd(7), inertia_mat(7), coriolis(7), jacobian(7), jacobianDot(7) {}
+
+    KDL::ChainFkSolverVel_recursive fksolver_vel;
+    KDL::ChainJntToJacSolver jacSolver;
+    KDL::ChainJntToJacDotSolver jacDotSolver;
+    KDL::ChainDynParam dynamicsChain;
+
+    KDL::JntArrayVel jntVel;
+    KDL::JntArray qdd;
+    KDL::JntSpaceInertiaMatrix inertia_mat;
+    KDL::JntArray coriolis;
+    KDL::Jacobian jacobian;
+    KDL::Jacobian jacobianDot;
+    KDL::FrameVel frame_vel;
+    Eigen::Matrix<double, 7, 1> rhs;
+
+    // joint axes and points on them in the base frame, with their time derivatives, of the getKinematics sweep
+    Eigen::Matrix<double, 3, 7> axes, axesDot, origins, originsVel;
+};
+
 class KUKAModelKDL : public RobotAbstract
 {
 
 public:
+    /* getForwardDynamics: joint space inertia matrix, Coriolis and an LLT (ChainDynParam), or the O(n) articulated body
+       algorithm on the chain of getRigidBodyChain, which neither forms nor factors M */
+    enum class ForwardDynamicsAlgorithm { CompositeRigidBody, ArticulatedBody };
+
     KUKAModelKDL(const KDL::Chain& robotChain, const KUKAModelKDLInternalData& robotParams);
 
     ~KUKAModelKDL();
@@ -67,24 +98,35 @@ public:
 
     void ik();
 
+    // reentrant interface
+    std::unique_ptr<RobotAbstractWorkspace> createWorkspace();
+    void getForwardKinematics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const double* qdd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther);
+    void getForwardDynamics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const Eigen::Ref<const Eigen::VectorXd>& force_ext, Eigen::Ref<Eigen::VectorXd> qdd);
+    void getSpatialJacobian(RobotAbstractWorkspace& ws, const double* q, Eigen::Ref<Eigen::MatrixXd> jacobian);
+    void getSpatialJacobianDot(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> jacobianDot);
+    void getKinematics(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Ref<Eigen::MatrixXd> jacobian, Eigen::Ref<Eigen::MatrixXd> jacobianDot, bool computeJacobianDot);
+
+    // the KDL chain with the conventions of the functions above, valid after initRobot
+    bool getRigidBodyChain(admm::RigidBodyChain& chain) const;
+
+    // CompositeRigidBody by default. switch between solves, not while the model is evaluated
+    void setForwardDynamicsAlgorithm(ForwardDynamicsAlgorithm algorithm);
+    ForwardDynamicsAlgorithm getForwardDynamicsAlgorithm() const {return fdAlgorithm_;}
+
     KUKAModelKDLInternalData robotParams_;
 
 private:
-    // patch variables for speed
-    KDL::JntArray q_;   
-    KDL::JntArray qd_;   
-    KDL::JntArray qdd_;
-    KDL::JntSpaceInertiaMatrix inertia_mat_;     // Interia Matrix
-    KDL::JntArray coriolis_;                     // CoriolisVector
-    KDL::JntArray gravity_;                      // GravityVector
-    KDL::Jacobian jacobian_;
-    KDL::Frame frame_;
-    KDL::FrameVel frame_vel_;
-
-    Eigen::Matrix<double, 7, 7> Kv_;
-    KDL::ChainDynParam* dynamicsChain_;
     KDL::Chain robotChain_;
+    bool revoluteChain_;    // every joint of the chain is revolute, getKinematics sweeps it itself
+
+    // end-effector frame relative to the tip of the chain
+    static Eigen::Matrix3d eeRotation() { return (Eigen::Matrix3d() << -1, 0, 0, 0, -1, 0, 0, 0, 1).finished(); }
+
+    ForwardDynamicsAlgorithm fdAlgorithm_ = ForwardDynamicsAlgorithm::CompositeRigidBody;
+    admm::RigidBodyChain chain_;     // of the articulated body algorithm, with the joint damping of robotParams_.Kv
 
+    // workspace of the legacy interface, the solvers and KDL arrays are built once with the model
+    std::unique_ptr<KUKAModelKDLWorkspace> m_ws;
 };
 
 #endif // KUKA_MODEL_HPP
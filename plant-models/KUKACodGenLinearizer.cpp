@@ -13,6 +13,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #include "RobCodGen/KUKA.h"
 #include <ct/rbd/systems/FixBaseFDSystem.h>
+#include "FusedLinearizationCodegen.h"
 
 #include <ct/models/CodegenOutputDirs.h>
 
@@ -69,6 +70,12 @@ int main(int argc, char** argv)
         adLinearizer.generateCode("KUKALinearizedReverse", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
             ct::core::CODEGEN_TEMPLATE_DIR, "models", "KUKA", true);
 
+        FusedLinearizationCodegen<state_dim, control_dim> fusedCodegen(kuka);
+
+        std::cout << "generating the fused linearization, forward and reverse mode" << std::endl;
+        fusedCodegen.generateCode("KUKALinearizedFusedForward", ct::models::KUKA_CODEGEN_OUTPUT_DIR, "KUKA", false);
+        fusedCodegen.generateCode("KUKALinearizedFusedReverse", ct::models::KUKA_CODEGEN_OUTPUT_DIR, "KUKA", true);
+
         // std::cout << "Generating Jacobian of Inverse Dynamics wrt state using forward mode... " << std::endl;
         // jacCG.generateJacobianSource("KUKAInverseDynJacForward", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
         //     ct::core::CODEGEN_TEMPLATE_DIR, "models", "HyA", JacCG::Sparsity::Ones(), false);
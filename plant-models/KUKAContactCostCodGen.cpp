@@ -0,0 +1,66 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+
+#include <ct/core/core.h>
+#include <ct/rbd/rbd.h>
+
+#include <cmath>
+#include <memory>
+
+#include "RobCodGen/KUKA.h"
+
+#include <ct/models/CodegenOutputDirs.h>
+
+/*
+ * Generates the exact derivatives of the end-effector velocity used by the contact term of the ADMM cost,
+ *   v(q, qd) = getEEVelocityInBase(ee, (q, qd))
+ * The contact term 0.5 rho_c ||(m |v|^2 / R_c, f_z) - c_bar||^2 only depends on the state through v and f_z,
+ * so its exact gradient and Gauss-Newton Hessian follow from dv/d(q, qd) (see ContactTerms::addContactDerivativesExact).
+ * The consensus terms of the cost are quadratic, their derivatives are exact already.
+ */
+
+const size_t njoints = ct::rbd::KUKA::Dynamics::NJOINTS;
+const size_t in_dim = 2 * njoints;  // (q, qd)
+const size_t out_dim = 3;           // end-effector linear velocity
+
+typedef ct::core::DerivativesCppadCG<in_dim, out_dim> JacCG;
+typedef typename JacCG::CG_SCALAR Scalar;
+
+// end-effector velocity in the base frame, as computed by RobCodGenModel::getForwardKinematics
+template <typename SCALAR>
+Eigen::Matrix<SCALAR, out_dim, 1> kukaEEVelocity(const Eigen::Matrix<SCALAR, in_dim, 1>& x)
+{
+    ct::rbd::KUKA::tpl::Kinematics<SCALAR> kukaKinematics;
+
+    ct::rbd::RBDState<njoints, SCALAR> rbdState;
+    rbdState.setZero();
+    rbdState.joints().getPositions()  = x.template head<njoints>();
+    rbdState.joints().getVelocities() = x.template tail<njoints>();
+
+    size_t ee_id = 0;
+    return kukaKinematics.getEEVelocityInBase(ee_id, rbdState).vector();
+}
+
+int main(int argc, char** argv)
+{
+    typename JacCG::FUN_TYPE_CG f = kukaEEVelocity<Scalar>;
+    JacCG jacCG(f);
+
+    try
+    {
+        std::cout << "Generating Jacobian of the end-effector velocity wrt (q, qd) using forward mode... " << std::endl;
+        jacCG.generateJacobianSource("KUKAContactVelocityJacobian", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
+            ct::core::CODEGEN_TEMPLATE_DIR, "models", "KUKA", JacCG::Sparsity::Ones(), false);
+
+        std::cout << "... done!" << std::endl;
+
+    } catch (const std::runtime_error& e)
+    {
+        std::cout << "code generation failed: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -9,6 +9,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include <ct/rbd/robot/actuator/ActuatorDynamics.h>
 #include <ct/rbd/state/FixBaseRobotState.h>
 #include "soft_contact_model.hpp"
+#include "jacobian_derivative.hpp"
 
 namespace ct {
 namespace rbd {
@@ -68,17 +69,16 @@ public:
      * @brief constructor
      * \warning when using actuator dynamics, the system looses its second order characteristics
      */
-    KUKASoftContactFDSystem(const RigidBodyPose_t& basePose = RigidBodyPose_t()) : BASE(basePose), actuatorDynamics_(nullptr) {
-
-        // contact model initilizatioon
-        ContactModel::ContactParams<SCALAR> cp_;
-        cp_.E = SCALAR(1000);
-        cp_.mu = SCALAR(0.5);
-        cp_.nu = SCALAR(0.4);
-        cp_.R  = SCALAR(0.005);
-        cp_.R_path = SCALAR(1000);
-        cp_.Kd = SCALAR(10);
-        contactModel_ = std::shared_ptr<SoftContactModel_t>(new SoftContactModel_t(cp_));
+    KUKASoftContactFDSystem(const RigidBodyPose_t& basePose = RigidBodyPose_t()) : KUKASoftContactFDSystem(defaultContactParams(), basePose) {}
+
+    /*!
+     * @brief constructor with the contact parameters
+     *
+     * For code generation the parameters can be AD variables, they become runtime inputs of the generated code.
+     */
+    KUKASoftContactFDSystem(const ContactModel::ContactParams<SCALAR>& cp, const RigidBodyPose_t& basePose = RigidBodyPose_t())
+        : BASE(basePose), actuatorDynamics_(nullptr), contactModel_(new SoftContactModel_t(cp))
+    {
     }
     /*!
      * @brief constructor including actuator dynamics
@@ -86,7 +86,7 @@ public:
      */
     KUKASoftContactFDSystem(std::shared_ptr<ActuatorDynamics_t> actuatorDynamics,
         const RigidBodyPose_t& basePose = RigidBodyPose_t())
-        : BASE(basePose), actuatorDynamics_(actuatorDynamics)
+        : BASE(basePose), actuatorDynamics_(actuatorDynamics), contactModel_(new SoftContactModel_t(defaultContactParams()))
     {
     }
 
@@ -99,6 +99,11 @@ public:
 	 */
     KUKASoftContactFDSystem(const KUKASoftContactFDSystem& arg) : BASE(arg)
     {
+        if (arg.contactModel_)
+        {
+            contactModel_ = std::shared_ptr<SoftContactModel_t>(new SoftContactModel_t(*arg.contactModel_));
+        }
+
         if (arg.actuatorDynamics_)
         {
             actuatorDynamics_ = std::shared_ptr<ActuatorDynamics_t>(arg.actuatorDynamics_->clone());
@@ -157,21 +162,35 @@ public:
         }
 
         typename RBDDynamics::JointAcceleration_t jAcc;
-        // typename RBDDynamics::JointAcceleration_t jAcc_id;
-        control_vector_t torque_grav;
-        // jAcc_id.setZero();
-
-        // compute robot dynamics 
-        Eigen::Matrix<SCALAR, 2*BASE::NJOINTS, 1> robotState_id(state.template topRows<2 * BASE::NJOINTS>());
-        Eigen::Matrix<SCALAR, BASE::NJOINTS, 1> jAcc_id;
-        jAcc_id.setZero();
-        robotState_id.template segment<7>(7).setZero();
 
-        this->dynamics_.FixBaseID(robotState_id, jAcc_id, torque_grav);
-        control += torque_grav;
-
-        this->dynamics_.FixBaseForwardDynamics(
-            robotState.joints(), control.template head<BASE::NJOINTS>(), linkForces, jAcc);
+        // compute robot dynamics, gravity compensated
+        if (EE_ARE_CONTROL_INPUTS == true)
+        {
+            // the end-effector forces go through ct, the compensation takes an inverse dynamics pass
+            control_vector_t torque_grav;
+            Eigen::Matrix<SCALAR, 2*BASE::NJOINTS, 1> robotState_id(state.template topRows<2 * BASE::NJOINTS>());
+            Eigen::Matrix<SCALAR, BASE::NJOINTS, 1> jAcc_id;
+            jAcc_id.setZero();
+            robotState_id.template segment<7>(7).setZero();
+
+            this->dynamics_.FixBaseID(robotState_id, jAcc_id, torque_grav);
+            control += torque_grav;
+
+            this->dynamics_.FixBaseForwardDynamics(
+                robotState.joints(), control.template head<BASE::NJOINTS>(), linkForces, jAcc);
+        }
+        else
+        {
+            // one articulated body pass with gravity cancelled at the source
+            using JointState = iit::Kuka::tpl::JointState<SCALAR>;
+            JointState qdd;
+            const JointState q = robotState.joints().getPositions();
+            const JointState qd = robotState.joints().getVelocities();
+            const JointState tau = control.template head<BASE::NJOINTS>();
+
+            this->dynamics_.kinematicsPtr()->robcogen().forwardDynamics().fd_gravity_compensated(qdd, q, qd, tau);
+            jAcc.getAcceleration() = qdd;
+        }
 
         // jAcc.setZero();
         
@@ -183,39 +202,11 @@ public:
         Eigen::Matrix<SCALAR, 3, 3> pose_EE_rot = this->dynamics_.kinematicsPtr()->getEERotInWorld(ee_id, this->basePose_, robotState.joints().getPositions());
 
         
-        // Kinematics, velocity
-        Eigen::Matrix<SCALAR, 3, 1> velocity_ee = this->dynamics_.kinematicsPtr()->getEEVelocityInBase(ee_id, robotState.toRBDState()).vector();
+        // Kinematics, velocity and acceleration. dJ/dt qd, the bias acceleration, comes with the velocity from one sweep over J
         Eigen::Matrix<SCALAR, 6, 7> jac = this->dynamics_.kinematicsPtr()->getJacobianBaseEEbyId(ee_id, robotState.toRBDState());
-        Eigen::Matrix<SCALAR, 3, 1> accel_ee = jac.template bottomRows<3>() * jAcc.getAcceleration();
-
-        Eigen::Matrix<SCALAR, 3, RBDDynamics::NJOINTS> Jc_Rotational, Jc_Translational, dJdt;
-        Eigen::Matrix<SCALAR, 3, 1> dJidqj;
-        dJdt.setZero();
-
-        // Collect current contact Jacobians
-        Jc_Rotational = jac.template topRows<3>();
-        Jc_Translational = jac.template bottomRows<3>();
-
-        // Compute dJdt for the joint columns
-        for (size_t i = 0; i < RBDDynamics::NJOINTS; i++)
-        {  // Loop over columns i of dJdt_joints
-         for (size_t j = 0; j < RBDDynamics::NJOINTS; j++)
-         {  // Loop over derivative w.r.t each joint j and sum
-             if (i >= j)
-             {
-                 dJidqj = (Jc_Rotational.template block<3, 1>(0, j))
-                              .template cross(Jc_Translational.template block<3, 1>(0, i));
-             }
-             else
-             {  // i < j
-                 dJidqj = (Jc_Rotational.template block<3, 1>(0, i))
-                              .template cross(Jc_Translational.template block<3, 1>(0, j));
-             }
-             dJdt.template block<3, 1>(0, i) += dJidqj * robotState.joints().getVelocities()(j);
-         }
-        }
-        // Fill in the rows of the full dJdt
-        accel_ee += dJdt * robotState.joints().getVelocities();
+        Eigen::Matrix<SCALAR, 3, 1> velocity_ee, accel_ee;
+        admm::endEffectorVelocityAndBias(jac.template topRows<3>(), jac.template bottomRows<3>(), robotState.joints().getVelocities(), velocity_ee, accel_ee);
+        accel_ee += jac.template bottomRows<3>() * jAcc.getAcceleration();
 
         // compute the cartesian space mass matrix
         Eigen::Matrix<SCALAR, 3, 3> massMatrix;
@@ -274,6 +265,22 @@ public:
         return new KUKASoftContactFDSystem<RBDDynamics, ACT_STATE_DIM, EE_ARE_CONTROL_INPUTS>(*this);
     }
 
+    //! contact parameters the code is generated with when they are not runtime inputs
+    static ContactModel::ContactParams<SCALAR> defaultContactParams()
+    {
+        ContactModel::ContactParams<SCALAR> cp;
+        cp.E = SCALAR(1000);
+        cp.mu = SCALAR(0.5);
+        cp.nu = SCALAR(0.4);
+        cp.R  = SCALAR(0.005);
+        cp.R_path = SCALAR(1000);
+        cp.Kd = SCALAR(10);
+        return cp;
+    }
+
+    //! set the parameters of the soft contact model
+    void setContactParams(const ContactModel::ContactParams<SCALAR>& cp) { contactModel_->setParams(cp); }
+
     //! get pointer to actuator dynamics
     std::shared_ptr<ActuatorDynamics_t> getActuatorDynamics() { return actuatorDynamics_; }
     //! if actuator dynamics enabled, this method allows to design a consistent actuator state
@@ -13,6 +13,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #include "RobCodGen/KUKA.h"
 #include "KUKASoftContactFDSystem.h"
+#include "FusedLinearizationCodegen.h"
 
 #include <ct/models/CodegenOutputDirs.h>
 
@@ -20,11 +21,15 @@ const size_t force_dim = 0;
 const size_t state_dim = ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::Dynamics>::STATE_DIM + force_dim;
 const size_t control_dim = ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::Dynamics>::CONTROL_DIM;
 const size_t njoints = ct::rbd::KUKA::Dynamics::NJOINTS;
+const size_t param_dim = ContactModel::ContactParams<double>::SIZE;  // contact parameters, runtime inputs of the generated code
 
 typedef ct::core::ADCodegenLinearizer<state_dim, control_dim>::ADCGScalar Scalar;
 typedef ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::tpl::Dynamics<Scalar>> KUKASoftContactNonLinearSystem;
 typedef ct::core::DerivativesCppadCG<state_dim, control_dim> JacCG;
 
+typedef ct::core::DerivativesCppadCG<state_dim + control_dim + param_dim, state_dim> DynamicsCG;
+typedef ct::core::DerivativesCppadCG<state_dim + control_dim + param_dim + 1, state_dim> StepCG;
+
 template <typename SCALAR>
 using control_vector_t = typename ct::rbd::KUKA::tpl::Dynamics<SCALAR>::control_vector_t;
 
@@ -45,6 +50,39 @@ Eigen::Matrix<SCALAR, control_dim, 1> kukaInverseDynamics(const Eigen::Matrix<SC
     return y;
 }
 
+// forward dynamics x_dot = f(x, u; p) of the soft contact system, input (x, u, p)
+template <typename SCALAR>
+Eigen::Matrix<SCALAR, state_dim, 1> kukaSoftContactDynamics(const Eigen::Matrix<SCALAR, state_dim + control_dim + param_dim, 1>& xup)
+{
+    const Eigen::Matrix<SCALAR, param_dim, 1> p = xup.template tail<param_dim>();
+    ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::tpl::Dynamics<SCALAR>> kukaSystem(ContactModel::ContactParams<SCALAR>::fromVector(p));
+    ct::core::StateVector<state_dim, SCALAR> x = xup.template head<state_dim>();
+    ct::core::ControlVector<control_dim, SCALAR> u = xup.template segment<control_dim>(state_dim);
+    ct::core::StateVector<state_dim, SCALAR> xdot;
+
+    kukaSystem.computeControlledDynamics(x, SCALAR(0.0), u, xdot);
+    return xdot;
+}
+
+// one RK4 step of the soft contact system with zero order hold on u, input (x, u, p, dt)
+template <typename SCALAR>
+Eigen::Matrix<SCALAR, state_dim, 1> kukaSoftContactRK4Step(const Eigen::Matrix<SCALAR, state_dim + control_dim + param_dim + 1, 1>& xupdt)
+{
+    const SCALAR dt = xupdt(state_dim + control_dim + param_dim);
+    const Eigen::Matrix<SCALAR, state_dim, 1> x = xupdt.template head<state_dim>();
+    Eigen::Matrix<SCALAR, state_dim + control_dim + param_dim, 1> xu = xupdt.template head<state_dim + control_dim + param_dim>();
+
+    const Eigen::Matrix<SCALAR, state_dim, 1> k1 = kukaSoftContactDynamics<SCALAR>(xu);
+    xu.template head<state_dim>() = x + SCALAR(0.5) * dt * k1;
+    const Eigen::Matrix<SCALAR, state_dim, 1> k2 = kukaSoftContactDynamics<SCALAR>(xu);
+    xu.template head<state_dim>() = x + SCALAR(0.5) * dt * k2;
+    const Eigen::Matrix<SCALAR, state_dim, 1> k3 = kukaSoftContactDynamics<SCALAR>(xu);
+    xu.template head<state_dim>() = x + dt * k3;
+    const Eigen::Matrix<SCALAR, state_dim, 1> k4 = kukaSoftContactDynamics<SCALAR>(xu);
+
+    return x + (dt / SCALAR(6.0)) * (k1 + SCALAR(2.0) * k2 + SCALAR(2.0) * k3 + k4);
+}
+
 int main(int argc, char** argv)
 {
     std::shared_ptr<KUKASoftContactNonLinearSystem> kuka(new KUKASoftContactNonLinearSystem());
@@ -66,6 +104,32 @@ int main(int argc, char** argv)
         adLinearizer.generateCode("KUKASoftContactSystemLinearizedForward", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
             ct::core::CODEGEN_TEMPLATE_DIR, "models", "KUKA", false);
 
+        // value and linearization from one sweep for RobotDynamics::fx, both modes to benchmark against each other.
+        // The contact parameters are inputs, RobotDynamics sets them from its contact model
+        std::shared_ptr<KUKASoftContactNonLinearSystem> kukaParametric(new KUKASoftContactNonLinearSystem());
+        FusedLinearizationCodegen<state_dim, control_dim, param_dim> fusedCodegen(kukaParametric,
+            [&](const Eigen::Matrix<Scalar, param_dim, 1>& p) { kukaParametric->setContactParams(ContactModel::ContactParams<Scalar>::fromVector(p)); },
+            ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::Dynamics>::defaultContactParams().toVector());
+
+        std::cout << "generating the fused linearization, forward and reverse mode" << std::endl;
+        fusedCodegen.generateCode("KUKASoftContactSystemLinearizedFusedForward", ct::models::KUKA_CODEGEN_OUTPUT_DIR, "KUKA", false);
+        fusedCodegen.generateCode("KUKASoftContactSystemLinearizedFusedReverse", ct::models::KUKA_CODEGEN_OUTPUT_DIR, "KUKA", true);
+
+        // flat forward dynamics and fused RK4 step for the rollouts (GeneratedRobotDynamics)
+        typename DynamicsCG::FUN_TYPE_CG fDyn = kukaSoftContactDynamics<Scalar>;
+        DynamicsCG dynamicsCG(fDyn);
+
+        std::cout << "generating the forward dynamics" << std::endl;
+        dynamicsCG.generateForwardZeroSource("KUKASoftContactSystemForwardDynamics", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
+            ct::core::CODEGEN_TEMPLATE_DIR, "models", "KUKA", false);
+
+        typename StepCG::FUN_TYPE_CG fStep = kukaSoftContactRK4Step<Scalar>;
+        StepCG stepCG(fStep);
+
+        std::cout << "generating the RK4 step" << std::endl;
+        stepCG.generateForwardZeroSource("KUKASoftContactSystemRK4Step", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
+            ct::core::CODEGEN_TEMPLATE_DIR, "models", "KUKA", false);
+
         // std::cout << "generating using reverse mode" << std::endl;
         // adLinearizer.generateCode("KUKALinearizedReverse", ct::models::KUKA_CODEGEN_OUTPUT_DIR,
         //     ct::core::CODEGEN_TEMPLATE_DIR, "models", "KUKA", true);
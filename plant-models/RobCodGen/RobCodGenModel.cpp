@@ -3,7 +3,7 @@
 
 
 
-RobCodGenModel::RobCodGenModel() : robot_state(joint_state.toImplementation())
+RobCodGenModel::RobCodGenModel()
 {
     // initRobot();
 }
@@ -21,88 +21,39 @@ RobCodGenModel::~RobCodGenModel() = default;
 
 int RobCodGenModel::initRobot() 
 {
-    base_pose.setIdentity();
-    base_state.setIdentity();
-    RBD = RBDState<KUKA::Kinematics::NJOINTS>(base_state, joint_state);
-    robot_ee = m_kyn.getEndEffector(0);
-
-    kyn_ptr = std::make_shared<KUKA::Kinematics>(m_kyn);
-    m_dyn = KUKA::Dynamics(kyn_ptr);
-
-    id_qdd.setZero();
-
-    gravity_u.resize(KUKA::Kinematics::NJOINTS);
-
-
+    m_ws.reset(new RobCodGenModelWorkspace());
     return 0;
     
 }
 
-void RobCodGenModel::getForwardKinematics(double* q, double* qd, double *qdd, Eigen::Matrix<double,3,3>& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther)
+std::unique_ptr<RobotAbstractWorkspace> RobCodGenModel::createWorkspace()
 {
-    // set the states
-    // std::lock_guard<std::mutex> lk(mu);
-    memcpy(robot_state.head(7).data(), q, 7*sizeof(double));
-    memcpy(robot_state.tail(7).data(), qd, 7*sizeof(double));
-
-    // Kinematics, position
-    size_t ind = 0;
-    ee_pos = m_kyn.getEEPositionInWorld(ind, base_pose, joint_state.getPositions());
-    // poseM = ee_pose.getRotationMatrix().matrix();
-
-    poseP = ee_pos.vector();
-
-    Jc_t.ee_indices_.push_back(0);
-    Jc_t.eeInContact_[0] = true;
-
-    RBD.joints() = joint_state;
-
-    // Kinematics, velocity
-    vel = m_kyn.getEEVelocityInBase(ind, RBD).vector();
-
-    // Kinematics, acceleration
-    if (computeOther == true) {
-        Eigen::MatrixXd temp(6,7);
-        Eigen::VectorXd temp_qdd(7);
-        memcpy(temp_qdd.data(), qdd, 7 * sizeof(double));
+    return std::unique_ptr<RobotAbstractWorkspace>(new RobCodGenModelWorkspace());
+}
 
-        getSpatialJacobian(q, temp);
-        accel = temp.block(0,0,3,7) * temp_qdd;
+void RobCodGenModel::setJointState(RobCodGenModelWorkspace& ws, const double* q, const double* qd)
+{
+    memcpy(ws.joint_state.toImplementation().head(7).data(), q, 7*sizeof(double));
+    memcpy(ws.joint_state.toImplementation().tail(7).data(), qd, 7*sizeof(double));
+}
 
-        getSpatialJacobianDot(q, qd, temp);
-        accel += temp.block(0,0,3,7) * joint_state.getVelocities();
-    }
+/* ------------------------------------ legacy interface, runs on the model's own workspace ------------------------------------ */
+void RobCodGenModel::getForwardKinematics(double* q, double* qd, double *qdd, Eigen::Matrix<double,3,3>& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther)
+{
+    getForwardKinematics(*m_ws, q, qd, qdd, poseM, poseP, vel, accel, computeOther);
 }
 
 /* given q, qdot, qddot, outputs torque output*/
 void RobCodGenModel::getInverseDynamics(double* q, double* qd, double* qdd, Eigen::VectorXd& torque)
 {
-    // set the states
-    // std::lock_guard<std::mutex> lk(mu);
-    memcpy(robot_state.head(7).data(), q, 7*sizeof(double));
-    memcpy(robot_state.tail(7).data(), qd, 7*sizeof(double));
-
-    // testdynamics.FixBaseID(irb_state, qdd, ext_forces, torque_u);
-    m_dyn.FixBaseID(robot_state, id_qdd, torque_u);
-    memcpy(torque.data(), torque_u.data(), 7*sizeof(double));
-
+    torque.resize(7);
+    getInverseDynamics(*m_ws, q, qd, qdd, torque);
 }
 
 void RobCodGenModel::getForwardDynamics(double* q, double* qd, const Eigen::VectorXd& torque_ext, Eigen::VectorXd& xd)
 {
-    // set the states
-    // std::lock_guard<std::mutex> lk(mu);
-    memcpy(robot_state.head(7).data(), q, 7*sizeof(double));
-    memcpy(robot_state.tail(7).data(), qd, 7*sizeof(double));
-
-    // do gravity compensation
-    getGravityVector(q, gravity_u);
-    gravity_u = torque_ext + gravity_u.eval();
-    memcpy(torque_u.data(), gravity_u.data(), 7*sizeof(double));
-    
-    m_dyn.FixBaseForwardDynamics(joint_state, torque_u, qdd);
-    memcpy(xd.data(), qdd.getAcceleration().data(), 7*sizeof(double));
-
+    xd.resize(7);
+    getForwardDynamics(*m_ws, q, qd, torque_ext, xd);
 }
 
 void RobCodGenModel::getMassMatrix(double* q, Eigen::MatrixXd& massMatrix)
@@ -120,72 +71,121 @@ void RobCodGenModel::getCoriolisMatrix(double* q, double* qd, Eigen::VectorXd& c
 
 void RobCodGenModel::getGravityVector(double* q, Eigen::VectorXd& gravityTorque)
 {
-    // std::lock_guard<std::mutex> lk(mu);
-    double qd[7] = {0, 0, 0, 0, 0, 0, 0};
-    getInverseDynamics(q, qd, qd, gravityTorque);
+    gravityTorque.resize(7);
+    getGravityVector(*m_ws, q, gravityTorque);
 }
  
 
 void RobCodGenModel::getSpatialJacobian(double* q, Eigen::MatrixXd& jacobian)
 {
-    // std::lock_guard<std::mutex> lk(mu);
-    memcpy(robot_state.head(7).data(), q, 7*sizeof(double));
-    size_t ee_id = 0;
-    RBD.joints() = joint_state;
+    jacobian.resize(6, 7);
+    getSpatialJacobian(*m_ws, q, jacobian);
+} 
+
+void RobCodGenModel::getSpatialJacobianDot(double* q, double* qd, Eigen::MatrixXd& jacobianDot)
+{   
+    jacobianDot.resize(6, 7);
+    getSpatialJacobianDot(*m_ws, q, qd, jacobianDot);
+}
+
+/* ------------------------------------ reentrant interface ------------------------------------ */
+void RobCodGenModel::getForwardKinematics(RobotAbstractWorkspace& workspace, const double* q, const double* qd, const double* qdd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther)
+{
+    RobCodGenModelWorkspace& ws = static_cast<RobCodGenModelWorkspace&>(workspace);
+
+    // set the states
+    setJointState(ws, q, qd);
+
+    // Kinematics, position
+    size_t ind = 0;
+    poseP = ws.kyn->getEEPositionInWorld(ind, ws.base_pose, ws.joint_state.getPositions()).vector();
+
+    ws.RBD.joints() = ws.joint_state;
+
+    // Kinematics, velocity and acceleration. the bias acceleration dJ/dt qd comes with the velocity from one sweep over J
+    if (computeOther == true) {
+        ws.jac = ws.kyn->getJacobianBaseEEbyId(ind, ws.RBD);
+        admm::endEffectorVelocityAndBias(ws.jac.template topRows<3>(), ws.jac.template bottomRows<3>(), ws.joint_state.getVelocities(), vel, accel);
+        accel += ws.jac.template bottomRows<3>() * Eigen::Map<const Eigen::Matrix<double, 7, 1>>(qdd);
+    } else {
+        vel = ws.kyn->getEEVelocityInBase(ind, ws.RBD).vector();
+    }
+}
 
-    jac = m_kyn.getJacobianBaseEEbyId(ee_id, RBD);
+void RobCodGenModel::getInverseDynamics(RobotAbstractWorkspace& workspace, const double* q, const double* qd, const double* qdd, Eigen::Ref<Eigen::VectorXd> torque)
+{
+    RobCodGenModelWorkspace& ws = static_cast<RobCodGenModelWorkspace&>(workspace);
 
-    jacobian.block(0,0,3,7) = jac.template bottomRows<3>();
-    jacobian.block(3,0,3,7) = jac.template topRows<3>();
+    // set the states
+    setJointState(ws, q, qd);
 
+    ws.dyn.FixBaseID(ws.joint_state.toImplementation(), ws.id_qdd, ws.torque_u);
+    torque = ws.torque_u;
+}
 
+void RobCodGenModel::getForwardDynamics(RobotAbstractWorkspace& workspace, const double* q, const double* qd, const Eigen::Ref<const Eigen::VectorXd>& torque_ext, Eigen::Ref<Eigen::VectorXd> xd)
+{
+    RobCodGenModelWorkspace& ws = static_cast<RobCodGenModelWorkspace&>(workspace);
+
+    memcpy(ws.fd_q.data(), q, 7*sizeof(double));
+    memcpy(ws.fd_qd.data(), qd, 7*sizeof(double));
+    ws.fd_tau = torque_ext;
+
+    // gravity compensated forward dynamics in one articulated body pass, g(q) is never computed
+    ws.kyn->robcogen().forwardDynamics().fd_gravity_compensated(ws.fd_qdd, ws.fd_q, ws.fd_qd, ws.fd_tau);
+    xd = ws.fd_qdd;
+}
+
+void RobCodGenModel::getGravityVector(RobotAbstractWorkspace& workspace, const double* q, Eigen::Ref<Eigen::VectorXd> gravityTorque)
+{
+    const double qd[7] = {0, 0, 0, 0, 0, 0, 0};
+    getInverseDynamics(workspace, q, qd, qd, gravityTorque);
+}
+
+void RobCodGenModel::getSpatialJacobian(RobotAbstractWorkspace& workspace, const double* q, Eigen::Ref<Eigen::MatrixXd> jacobian)
+{
+    RobCodGenModelWorkspace& ws = static_cast<RobCodGenModelWorkspace&>(workspace);
+
+    memcpy(ws.joint_state.toImplementation().head(7).data(), q, 7*sizeof(double));
+    size_t ee_id = 0;
+    ws.RBD.joints() = ws.joint_state;
+
+    ws.jac = ws.kyn->getJacobianBaseEEbyId(ee_id, ws.RBD);
+
+    jacobian.block(0,0,3,7) = ws.jac.template bottomRows<3>();
+    jacobian.block(3,0,3,7) = ws.jac.template topRows<3>();
 } 
 
-void RobCodGenModel::getSpatialJacobianDot(double* q, double* qd, Eigen::MatrixXd& jacobianDot)
+void RobCodGenModel::getSpatialJacobianDot(RobotAbstractWorkspace& workspace, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> jacobianDot)
 {   
-    // std::lock_guard<std::mutex> lk(mu);
-    memcpy(robot_state.head(7).data(), q, 7*sizeof(double));
-    memcpy(robot_state.tail(7).data(), qd, 7*sizeof(double));
-    RBD.joints() = joint_state;
-
+    RobCodGenModelWorkspace& ws = static_cast<RobCodGenModelWorkspace&>(workspace);
 
-    Eigen::Matrix<double, 3, KUKA::Kinematics::NJOINTS> Jc_Rotational, Jc_Translational, dJdt;
-    Eigen::Matrix<double, 3, 1> dJidqj;
+    setJointState(ws, q, qd);
+    ws.RBD.joints() = ws.joint_state;
 
-    dJdt.setZero();
     size_t ee_id = 0;
+    ws.jac = ws.kyn->getJacobianBaseEEbyId(ee_id, ws.RBD);
 
-    jac = m_kyn.getJacobianBaseEEbyId(ee_id, RBD);
-
-    // Collect current contact Jacobians
-    // Jc_geometric  = m_dyn.robcogen().getJacobianBaseEEbyId(ee_indices_[0], state.joints().getPositions());
-    Jc_Rotational = jac.template topRows<3>();
-    Jc_Translational = jac.template bottomRows<3>();
-
-    // Compute dJdt for the joint columns
-    for (size_t i = 0; i < KUKA::Kinematics::NJOINTS; i++)
-    {  // Loop over columns i of dJdt_joints
-     for (size_t j = 0; j < KUKA::Kinematics::NJOINTS; j++)
-     {  // Loop over derivative w.r.t each joint j and sum
-         if (i >= j)
-         {
-             dJidqj = (Jc_Rotational.template block<3, 1>(0, j))
-                          .template cross(Jc_Translational.template block<3, 1>(0, i));
-         }
-         else
-         {  // i < j
-             dJidqj = (Jc_Rotational.template block<3, 1>(0, i))
-                          .template cross(Jc_Translational.template block<3, 1>(0, j));
-         }
-         dJdt.template block<3, 1>(0, i) += dJidqj * joint_state.getVelocities()(j);
-     }
-    }
+    // O(n) in the joints, see jacobian_derivative.hpp
+    admm::linearJacobianDerivative(ws.jac.template topRows<3>(), ws.jac.template bottomRows<3>(), ws.joint_state.getVelocities(), jacobianDot.block(0,0,3,7));
+    jacobianDot.block(3,0,3,7).setZero();
+}
 
-    // Fill in the rows of the full dJdt
-    jacobianDot.block(0,0,3,7) = dJdt;
+#if CODEGEN_CONTACT_COST
+/* exact dv/d(q, qd) of the end-effector velocity, generated by KUKAContactCostCodGen.cpp */
+bool RobCodGenModel::getEEVelocityJacobian(RobotAbstractWorkspace& workspace, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> dvdx)
+{
+    RobCodGenModelWorkspace& ws = static_cast<RobCodGenModelWorkspace&>(workspace);
+
+    memcpy(ws.velocityJacobianIn.data(), q, 7*sizeof(double));
+    memcpy(ws.velocityJacobianIn.data() + 7, qd, 7*sizeof(double));
+
+    dvdx = ws.velocityJacobian.jacobian(ws.velocityJacobianIn);
+    return true;
 }
+#endif
 
 void RobCodGenModel::ik()
 {
     
-}
+}
\ No newline at end of file
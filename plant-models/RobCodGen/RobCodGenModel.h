@@ -10,6 +10,7 @@
 
 #include "models.h"
 #include "RobotAbstract.h"
+#include "jacobian_derivative.hpp"
 
 #include <ct/rbd/rbd.h>
 
@@ -26,6 +27,10 @@
 #include "ct/rbd/robot/Dynamics.h"
 #include "ct/rbd/robot/Kinematics.h"
 
+#if CODEGEN_CONTACT_COST
+#include "codegen/KUKAContactVelocityJacobian.h"
+#endif
+
 using namespace ct::rbd;
 
 
@@ -36,6 +41,41 @@ struct RobCodGenModelInternalData : RobotAbstractInternalData
     Eigen::MatrixXd Kp;
 };
 
+/* scratch of one caller of the model. RobCoGen keeps its intermediate transforms in the kinematics and dynamics objects */
+struct RobCodGenModelWorkspace : RobotAbstractWorkspace
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    RobCodGenModelWorkspace() : kyn(std::make_shared<KUKA::Kinematics>()), dyn(kyn)
+    {
+        base_pose.setIdentity();
+        base_state.setIdentity();
+        RBD = RBDState<KUKA::Kinematics::NJOINTS>(base_state, joint_state);
+        id_qdd.setZero();
+    }
+
+    std::shared_ptr<KUKA::Kinematics> kyn;
+    KUKA::Dynamics dyn;
+
+    JointState<KUKA::Kinematics::NJOINTS> joint_state;
+    RBDState<KUKA::Kinematics::NJOINTS> RBD;
+    RigidBodyState base_state;
+    RigidBodyPose base_pose;
+
+    typename KUKA::Dynamics::control_vector_t torque_u;
+    typename KUKA::Dynamics::JointAcceleration_t id_qdd;
+
+    // arguments of the generated forward dynamics
+    iit::Kuka::JointState fd_q, fd_qd, fd_tau, fd_qdd;
+
+    KUKA::Kinematics::Jacobian jac;
+
+#if CODEGEN_CONTACT_COST
+    ct::models::KUKA::KUKAContactVelocityJacobian velocityJacobian;
+    Eigen::Matrix<double, 2 * KUKA::Kinematics::NJOINTS, 1> velocityJacobianIn;
+#endif
+};
+
 class RobCodGenModel : public RobotAbstract
 {
 
@@ -64,41 +104,25 @@ public:
     void getSpatialJacobianDot(double* q, double* qd, Eigen::MatrixXd& jacobianDot);
     void ik();
 
+    // reentrant interface
+    std::unique_ptr<RobotAbstractWorkspace> createWorkspace();
+    void getForwardKinematics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const double* qdd, Eigen::Matrix3d& poseM, Eigen::Vector3d& poseP, Eigen::Vector3d& vel, Eigen::Vector3d& accel, bool computeOther);
+    void getInverseDynamics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const double* qdd, Eigen::Ref<Eigen::VectorXd> torque);
+    void getForwardDynamics(RobotAbstractWorkspace& ws, const double* q, const double* qd, const Eigen::Ref<const Eigen::VectorXd>& force_ext, Eigen::Ref<Eigen::VectorXd> qdd);
+    void getGravityVector(RobotAbstractWorkspace& ws, const double* q, Eigen::Ref<Eigen::VectorXd> gravityTorque);
+    void getSpatialJacobian(RobotAbstractWorkspace& ws, const double* q, Eigen::Ref<Eigen::MatrixXd> jacobian);
+    void getSpatialJacobianDot(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> jacobianDot);
+#if CODEGEN_CONTACT_COST
+    bool getEEVelocityJacobian(RobotAbstractWorkspace& ws, const double* q, const double* qd, Eigen::Ref<Eigen::MatrixXd> dvdx);
+#endif
+
     RobCodGenModelInternalData robotParams_;
 
 private:
-    KUKA::Kinematics m_kyn;
-    KUKA::Dynamics m_dyn;
-    std::shared_ptr<KUKA::Kinematics> kyn_ptr;
-
-    Eigen::Matrix<double, 2*KUKA::Kinematics::NJOINTS, 1>& robot_state;
-
-    // fd
-    control_vector_t torque_u;
-    ExtLinkForces_t ext_forces;
-    JointAcceleration_t id_qdd;
-    JointAcceleration_t qdd;
-
-    // velocities and position
-    JointState<KUKA::Kinematics::NJOINTS> joint_state;
-    EndEffector<KUKA::Kinematics::NJOINTS> robot_ee;
-    RBDState<KUKA::Kinematics::NJOINTS> RBD;
-    RigidBodyState base_state;
-    RigidBodyPose base_pose;
-    RigidBodyPose ee_pose;
-    kindr::Position3D ee_pos;
-    kindr::Velocity3D vel;
-
-    // jacobian
-    KUKA::Kinematics::Jacobian jac;
-    KUKA::Kinematics::Jacobian jacDot;
-    ConstraintJacobian<KUKA::Kinematics, 3, KUKA::Kinematics::NJOINTS>::jacobian_t dJdt;
-    ConstraintJacobian<KUKA::Kinematics, 3, KUKA::Kinematics::NJOINTS> Jc_t;
-
-    // gravity
-    Eigen::VectorXd gravity_u;
-
+    void setJointState(RobCodGenModelWorkspace& ws, const double* q, const double* qd);
 
+    // workspace of the legacy interface
+    std::unique_ptr<RobCodGenModelWorkspace> m_ws;
 };
 
 #endif // KUKA_MODEL_HPP
@@ -0,0 +1,320 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaEEVelocity in
+// plant-models/KUKAContactCostCodGen.cpp, in the output format of the KUKAContactCostCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against RobotAbstract::getForwardKinematics by test_models (src/main_test_models.cpp).
+
+// clang-format off
+
+#include "KUKAContactVelocityJacobian.h"
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+
+const KUKAContactVelocityJacobian::JAC_TYPE& KUKAContactVelocityJacobian::jacobian(const IN_TYPE& x_in)
+{
+    double* jac = jac_.data();
+
+    v_[0] = sin(x_in[0]);
+    v_[1] = sin(x_in[1]);
+    v_[2] = sin(x_in[2]);
+    v_[3] = sin(x_in[3]);
+    v_[4] = sin(x_in[4]);
+    v_[5] = sin(x_in[5]);
+    v_[6] = cos(x_in[0]);
+    v_[7] = cos(x_in[1]);
+    v_[8] = cos(x_in[2]);
+    v_[9] = cos(x_in[3]);
+    v_[10] = cos(x_in[4]);
+    v_[11] = cos(x_in[5]);
+    v_[12] = v_[0] * 0.42;
+    v_[13] = v_[1] * v_[12];
+    v_[14] = v_[0] * 0.4;
+    v_[15] = v_[1] * v_[14];
+    v_[16] = v_[9] * v_[15];
+    v_[17] = v_[6] * 0.4;
+    v_[18] = v_[2] * v_[17];
+    v_[19] = v_[7] * v_[14];
+    v_[20] = v_[8] * v_[19];
+    v_[21] = v_[18] + v_[20];
+    v_[22] = v_[3] * v_[21];
+    v_[23] = v_[0] * 0.241;
+    v_[24] = v_[1] * v_[23];
+    v_[25] = v_[9] * v_[24];
+    v_[26] = v_[7] * v_[23];
+    v_[27] = v_[8] * v_[26];
+    v_[28] = v_[6] * 0.241;
+    v_[29] = v_[2] * v_[28];
+    v_[30] = v_[27] + v_[29];
+    v_[31] = v_[3] * v_[30];
+    v_[32] = v_[31] - v_[25];
+    v_[33] = v_[11] * v_[32];
+    v_[34] = v_[8] * v_[28];
+    v_[35] = v_[2] * v_[26];
+    v_[36] = v_[35] - v_[34];
+    v_[37] = v_[3] * v_[24];
+    v_[38] = v_[0] * -0.241;
+    v_[39] = v_[7] * v_[38];
+    v_[40] = v_[8] * v_[39] - v_[29];
+    v_[41] = v_[9] * v_[40] - v_[37];
+    v_[42] = v_[4] * v_[36] + v_[10] * v_[41];
+    jac[21] = v_[22] + (v_[33] + v_[5] * v_[42]) - v_[16] - v_[13];
+    v_[43] = v_[6] * 0.42;
+    v_[44] = v_[7] * v_[43];
+    v_[45] = v_[7] * v_[17];
+    v_[46] = v_[9] * v_[45];
+    v_[47] = v_[1] * v_[17];
+    v_[48] = v_[8] * v_[47];
+    v_[49] = v_[3] * v_[48];
+    v_[50] = v_[1] * v_[28];
+    v_[51] = v_[8] * v_[50];
+    v_[52] = v_[3] * v_[51];
+    v_[28] = v_[7] * v_[28];
+    v_[53] = v_[9] * v_[28];
+    v_[54] = v_[52] + v_[53];
+    v_[55] = v_[11] * v_[54];
+    v_[56] = v_[2] * v_[50];
+    v_[57] = v_[9] * v_[51];
+    v_[58] = v_[3] * v_[28];
+    v_[59] = v_[58] - v_[57];
+    v_[60] = v_[10] * v_[59];
+    v_[61] = v_[4] * v_[56] + v_[60];
+    v_[62] = v_[44] + (v_[46] + (v_[49] + (v_[55] + v_[5] * v_[61])));
+    jac[24] = v_[62];
+    v_[63] = v_[2] * v_[45] + v_[8] * v_[14];
+    v_[64] = v_[3] * v_[63];
+    v_[65] = v_[2] * v_[28];
+    v_[66] = v_[8] * v_[23];
+    v_[67] = v_[65] + v_[66];
+    v_[68] = v_[3] * v_[67];
+    v_[69] = v_[11] * v_[68];
+    v_[28] = v_[8] * v_[28];
+    v_[23] = v_[2] * v_[23];
+    v_[70] = v_[23] - v_[28];
+    v_[71] = v_[6] * -0.241;
+    v_[72] = v_[7] * v_[71];
+    v_[73] = v_[2] * v_[72] - v_[66];
+    v_[74] = v_[9] * v_[73];
+    v_[75] = v_[4] * v_[70] + v_[10] * v_[74];
+    jac[27] = v_[64] + (v_[69] + v_[5] * v_[75]);
+    v_[76] = v_[8] * v_[45];
+    v_[14] = v_[2] * v_[14];
+    v_[77] = v_[14] - v_[76];
+    v_[78] = v_[9] * v_[77];
+    v_[79] = v_[3] * v_[47];
+    v_[80] = v_[3] * v_[50];
+    v_[81] = v_[9] * v_[70] - v_[80];
+    v_[82] = v_[11] * v_[81];
+    v_[83] = v_[3] * v_[70];
+    v_[50] = v_[9] * v_[50];
+    v_[84] = v_[83] + v_[50];
+    v_[85] = v_[10] * v_[84];
+    jac[30] = v_[78] + (v_[82] + v_[5] * v_[85] - v_[79]);
+    v_[86] = v_[8] * v_[38] - v_[65];
+    v_[87] = v_[10] * v_[86] + v_[4] * v_[81];
+    jac[33] = v_[5] * v_[87];
+    v_[88] = v_[28] - v_[23];
+    v_[89] = v_[80] + v_[9] * v_[88];
+    v_[90] = v_[10] * v_[89];
+    v_[91] = v_[4] * v_[73] + v_[90];
+    v_[92] = v_[11] * v_[91];
+    v_[88] = v_[3] * v_[88];
+    v_[93] = v_[88] - v_[50];
+    v_[94] = v_[5] * v_[93];
+    jac[36] = v_[92] + v_[94];
+    v_[43] = v_[1] * v_[43];
+    v_[95] = v_[9] * v_[47];
+    v_[77] = v_[3] * v_[77];
+    v_[91] = v_[5] * v_[91];
+    jac[22] = v_[43] + (v_[95] + (v_[77] + (v_[11] * v_[84] + v_[91])));
+    v_[12] = v_[7] * v_[12];
+    v_[96] = v_[9] * v_[19];
+    v_[97] = v_[8] * v_[15];
+    v_[98] = v_[3] * v_[97];
+    v_[99] = v_[8] * v_[24];
+    v_[100] = v_[3] * v_[99];
+    v_[101] = v_[9] * v_[26];
+    v_[102] = v_[100] + v_[101];
+    v_[24] = v_[2] * v_[24];
+    v_[103] = v_[4] * v_[24];
+    v_[104] = v_[9] * v_[99];
+    v_[26] = v_[3] * v_[26];
+    v_[105] = v_[26] - v_[104];
+    v_[106] = v_[103] + v_[10] * v_[105];
+    jac[25] = v_[12] + (v_[96] + (v_[98] + (v_[11] * v_[102] + v_[5] * v_[106])));
+    v_[17] = v_[8] * v_[17];
+    v_[107] = v_[2] * v_[19];
+    v_[108] = v_[107] - v_[17];
+    v_[109] = v_[3] * v_[36];
+    v_[110] = v_[2] * v_[71] - v_[27];
+    v_[111] = v_[34] - v_[35];
+    v_[112] = v_[9] * v_[111];
+    v_[113] = v_[10] * v_[112];
+    v_[114] = v_[4] * v_[110] + v_[113];
+    jac[28] = v_[3] * v_[108] + (v_[11] * v_[109] + v_[5] * v_[114]);
+    v_[0] = v_[0] * -0.4;
+    v_[115] = v_[7] * v_[0];
+    v_[18] = v_[8] * v_[115] - v_[18];
+    v_[116] = v_[3] * v_[15];
+    v_[117] = v_[9] * v_[110] - v_[37];
+    v_[118] = v_[3] * v_[110];
+    v_[119] = v_[25] + v_[118];
+    v_[120] = v_[10] * v_[119];
+    jac[31] = v_[9] * v_[18] + (v_[11] * v_[117] + v_[5] * v_[120] - v_[116]);
+    v_[121] = v_[10] * v_[111];
+    v_[122] = v_[121] + v_[4] * v_[117];
+    jac[34] = v_[5] * v_[122];
+    v_[123] = v_[4] * v_[111];
+    v_[124] = v_[37] + v_[9] * v_[30];
+    v_[125] = v_[123] + v_[10] * v_[124];
+    v_[126] = v_[5] * v_[32];
+    jac[37] = v_[11] * v_[125] + v_[126];
+    v_[127] = v_[1] * 0.4;
+    v_[128] = v_[7] * 0.4;
+    v_[129] = v_[8] * v_[128];
+    v_[130] = v_[1] * 0.241;
+    v_[131] = v_[7] * 0.241;
+    v_[132] = v_[8] * v_[131];
+    v_[133] = v_[3] * v_[132];
+    v_[134] = v_[133] - v_[9] * v_[130];
+    v_[135] = v_[2] * v_[131];
+    v_[136] = v_[4] * v_[135];
+    v_[137] = v_[9] * v_[132];
+    v_[138] = v_[1] * -0.241;
+    v_[139] = v_[3] * v_[138] - v_[137];
+    v_[140] = v_[136] + v_[10] * v_[139];
+    jac[26] = v_[3] * v_[129] + (v_[11] * v_[134] + v_[5] * v_[140]) - v_[9] * v_[127] - v_[1] * 0.42;
+    v_[141] = v_[2] * v_[127];
+    v_[142] = v_[2] * v_[130];
+    v_[143] = v_[3] * v_[142];
+    v_[144] = v_[8] * v_[130];
+    v_[145] = v_[9] * v_[142];
+    v_[146] = v_[4] * v_[144] + v_[10] * v_[145];
+    jac[29] = v_[5] * v_[146] - v_[11] * v_[143] - v_[3] * v_[141];
+    v_[147] = v_[8] * v_[127];
+    v_[148] = v_[3] * v_[131];
+    v_[149] = v_[9] * v_[144];
+    v_[150] = v_[149] - v_[148];
+    v_[151] = v_[3] * v_[144];
+    v_[131] = v_[9] * v_[131];
+    v_[152] = v_[151] + v_[131];
+    v_[153] = v_[10] * v_[152];
+    jac[32] = v_[9] * v_[147] + (v_[11] * v_[150] + v_[5] * v_[153] - v_[3] * v_[128]);
+    v_[154] = v_[10] * v_[142];
+    v_[155] = v_[154] + v_[4] * v_[150];
+    jac[35] = v_[5] * v_[155];
+    v_[142] = v_[4] * v_[142];
+    v_[148] = v_[148] - v_[149];
+    v_[156] = v_[142] + v_[10] * v_[148];
+    v_[157] = v_[7] * -0.241;
+    v_[158] = v_[9] * v_[157] - v_[151];
+    jac[38] = v_[11] * v_[156] + v_[5] * v_[158];
+    v_[159] = v_[3] * (v_[76] - v_[14]);
+    v_[21] = v_[9] * v_[21];
+    v_[111] = v_[3] * v_[111];
+    v_[100] = -v_[100] - v_[101];
+    v_[93] = v_[11] * v_[93];
+    v_[101] = v_[11] * v_[100];
+    v_[160] = v_[11] * v_[124];
+    v_[161] = v_[4] * v_[67];
+    v_[23] = v_[23] + v_[8] * v_[72];
+    v_[34] = -(v_[2] * v_[39]) - v_[34];
+    v_[39] = v_[9] * v_[23];
+    v_[30] = v_[3] * (v_[17] - v_[107]) + (v_[11] * v_[111] + v_[5] * (v_[4] * v_[30] + v_[10] * (v_[9] * v_[34])));
+    v_[45] = v_[3] * v_[45];
+    v_[47] = v_[3] * (v_[2] * v_[47]);
+    v_[48] = v_[9] * v_[48];
+    v_[57] = v_[57] - v_[58];
+    v_[58] = v_[11] * (v_[3] * v_[56]);
+    v_[51] = v_[4] * v_[51];
+    v_[72] = v_[10] * v_[56];
+    v_[104] = v_[104] - v_[26];
+    v_[107] = v_[11] * v_[57] + v_[5] * (v_[10] * v_[54]);
+    v_[63] = v_[9] * v_[63];
+    v_[67] = v_[9] * v_[67];
+    v_[162] = v_[11] * v_[67];
+    v_[163] = v_[2] * (v_[1] * v_[71]);
+    v_[83] = -v_[83] - v_[50];
+    v_[164] = v_[10] * v_[81];
+    v_[71] = v_[35] + v_[8] * v_[71];
+    v_[165] = -(v_[2] * v_[38]) - v_[28];
+    v_[166] = v_[4] * v_[124];
+    v_[167] = -v_[27] - v_[29];
+    v_[168] = -v_[65] - v_[66];
+    v_[169] = v_[10] * (v_[50] - v_[88]);
+    v_[34] = v_[4] * v_[34] + v_[10] * (v_[9] * v_[167] - v_[37]);
+    v_[60] = v_[60] - v_[4] * v_[163];
+    v_[23] = v_[4] * v_[23] + v_[10] * (v_[9] * v_[168]);
+    v_[170] = v_[10] * v_[73] - v_[4] * v_[89];
+    v_[19] = v_[3] * v_[19];
+    v_[171] = v_[10] * v_[24];
+    v_[106] = v_[11] * v_[106];
+    v_[172] = v_[11] * v_[104] + v_[5] * (v_[10] * v_[102]);
+    v_[15] = v_[5] * (v_[4] * v_[99] + v_[10] * (v_[9] * v_[24])) - v_[11] * (v_[3] * v_[24]) - v_[3] * (v_[2] * v_[15]);
+    v_[24] = -v_[66] - v_[65];
+    v_[29] = -v_[29] - v_[27];
+    v_[66] = v_[9] * v_[71];
+    v_[99] = v_[9] * v_[165] - v_[80];
+    v_[118] = -v_[118] - v_[25];
+    v_[173] = v_[10] * v_[117];
+    v_[174] = v_[9] * v_[128];
+    v_[127] = v_[3] * v_[127];
+    v_[147] = v_[3] * v_[147];
+    v_[129] = v_[9] * v_[129];
+    v_[130] = v_[3] * v_[130];
+    v_[131] = -v_[151] - v_[131];
+    v_[175] = v_[137] + v_[130];
+    v_[176] = v_[11] * v_[131];
+    v_[177] = v_[11] * v_[175];
+    v_[178] = v_[10] * v_[135];
+    v_[157] = v_[3] * v_[157];
+    v_[138] = v_[9] * v_[138];
+    v_[128] = v_[5] * (v_[4] * v_[132] + v_[10] * (v_[9] * v_[135])) - v_[11] * (v_[3] * v_[135]) - v_[3] * (v_[2] * v_[128]);
+    v_[132] = v_[9] * v_[141];
+    v_[135] = v_[11] * v_[145];
+    v_[141] = v_[5] * (v_[10] * v_[143]);
+    v_[144] = v_[5] * (v_[10] * v_[144] - v_[4] * v_[145]);
+    v_[143] = v_[5] * v_[143] + v_[11] * v_[146];
+    v_[145] = v_[10] * v_[150];
+    v_[146] = v_[11] * v_[153];
+    jac[0] = x_in[12] * (v_[11] * v_[34] + v_[5] * (v_[25] + v_[3] * v_[167])) + (x_in[11] * (v_[5] * (v_[10] * v_[71] + v_[166])) + x_in[10] * (v_[21] + (v_[116] + (v_[160] + v_[5] * (v_[10] * v_[32]))))) + (x_in[9] * v_[30] + x_in[8] * (v_[101] + v_[5] * (v_[10] * v_[104] - v_[103]) - v_[98] - v_[96] - v_[12]) + x_in[7] * (v_[159] + (v_[93] + v_[5] * (v_[161] + v_[10] * (v_[39] - v_[80]))) - v_[95] - v_[43]));
+    jac[3] = x_in[12] * (v_[11] * v_[60] + v_[5] * (-v_[52] - v_[53])) + (x_in[11] * (v_[5] * (v_[72] + v_[4] * v_[57])) + x_in[10] * (v_[48] + (v_[107] - v_[45]))) + (x_in[9] * (v_[5] * (v_[51] - v_[10] * (v_[9] * v_[163])) - v_[58] - v_[47]) + x_in[8] * (v_[3] * v_[76] + (v_[11] * (v_[3] * v_[28] - v_[50]) + v_[5] * (v_[4] * v_[65] + v_[10] * (-v_[80] - v_[9] * v_[28]))) - v_[95] - v_[43]) + x_in[7] * (v_[101] + v_[5] * (v_[10] * (-(v_[9] * (v_[8] * (v_[1] * v_[38]))) - v_[26]) - v_[103]) - v_[98] - v_[96] - v_[12]));
+    jac[6] = x_in[12] * (v_[11] * v_[23] + v_[5] * (v_[3] * v_[168])) + (x_in[11] * (v_[5] * (v_[10] * v_[165] + v_[4] * v_[67])) + x_in[10] * (v_[63] + (v_[162] + v_[5] * (v_[10] * v_[68])))) + (x_in[9] * (v_[159] + (v_[11] * v_[88] + v_[5] * (v_[161] + v_[10] * v_[39]))) + x_in[8] * (v_[5] * (v_[51] + v_[10] * (v_[9] * v_[56])) - v_[58] - v_[47]) + x_in[7] * v_[30]);
+    jac[9] = x_in[12] * (v_[11] * v_[169] + v_[5] * v_[89]) + (x_in[11] * (v_[5] * (v_[4] * v_[83])) + x_in[10] * (v_[11] * v_[83] + v_[5] * v_[164] - v_[95] - v_[77])) + (x_in[9] * (v_[63] + (v_[162] - v_[5] * (v_[10] * (v_[3] * v_[73])))) + x_in[8] * (v_[48] + v_[107] - v_[45]) + x_in[7] * (v_[116] + (v_[21] + (v_[160] + v_[5] * (v_[10] * (-(v_[3] * v_[40]) - v_[25]))))));
+    jac[12] = x_in[12] * (v_[11] * v_[170]) + (x_in[11] * (v_[5] * (v_[164] - v_[4] * v_[86])) - x_in[10] * (v_[5] * (v_[4] * v_[84]))) + (x_in[9] * (v_[5] * (v_[10] * v_[70] - v_[4] * v_[74])) + x_in[8] * (v_[5] * (v_[72] - v_[4] * v_[59])) + x_in[7] * (v_[5] * (v_[10] * v_[36] - v_[4] * v_[41])));
+    jac[15] = x_in[12] * (v_[93] - v_[91]) + (x_in[11] * (v_[11] * v_[87]) + x_in[10] * (v_[11] * v_[85] - v_[5] * v_[81])) + (x_in[9] * (v_[11] * v_[75] - v_[5] * v_[68]) + x_in[8] * (v_[11] * v_[61] - v_[5] * v_[54]) + x_in[7] * (v_[11] * v_[42] - v_[126]));
+    jac[1] = x_in[12] * (v_[94] + v_[11] * (v_[90] + v_[4] * v_[24])) + (x_in[11] * (v_[5] * (v_[10] * v_[24] + v_[4] * v_[99])) + x_in[10] * (v_[9] * (v_[14] + v_[8] * (v_[7] * (v_[6] * -0.4))) + (v_[11] * v_[99] + v_[5] * (v_[10] * (v_[50] + v_[3] * v_[165])) - v_[79]))) + (x_in[8] * v_[62] + x_in[9] * (v_[64] + (v_[69] + v_[5] * (v_[4] * v_[165] + v_[10] * (v_[9] * v_[24])))) + x_in[7] * (v_[22] + (v_[33] + v_[5] * v_[34]) - v_[16] - v_[13]));
+    jac[4] = x_in[12] * (v_[106] + v_[5] * v_[100]) + (x_in[11] * (v_[5] * (v_[171] + v_[4] * v_[104])) + x_in[10] * (v_[172] - v_[19] - v_[9] * (v_[8] * (v_[1] * v_[0])))) + (x_in[9] * v_[15] + x_in[8] * (v_[3] * v_[20] + (v_[11] * (v_[3] * v_[27] - v_[25]) + v_[5] * (v_[4] * v_[35] + v_[10] * (-v_[37] - v_[9] * v_[27]))) - v_[16] - v_[13]) + x_in[7] * (v_[44] + (v_[46] + (v_[49] + (v_[55] + v_[5] * v_[60])))));
+    jac[7] = x_in[12] * (v_[11] * (v_[113] + v_[4] * v_[29]) + v_[5] * v_[111]) + (x_in[11] * (v_[5] * (v_[10] * v_[29] + v_[4] * v_[66])) + x_in[10] * (v_[9] * (-(v_[2] * v_[115]) - v_[17]) + (v_[11] * v_[66] + v_[5] * (v_[10] * (v_[3] * v_[71]))))) + (x_in[9] * (v_[22] + (v_[11] * v_[31] + v_[5] * (v_[4] * v_[71] + v_[10] * (v_[9] * v_[29])))) + x_in[8] * v_[15] + x_in[7] * (v_[64] + (v_[69] + v_[5] * v_[23])));
+    jac[10] = x_in[12] * (v_[11] * (v_[10] * (v_[25] - v_[31])) + v_[5] * v_[124]) + (x_in[11] * (v_[5] * (v_[4] * v_[118])) + x_in[10] * (v_[11] * v_[118] + v_[5] * v_[173] - v_[16] - v_[3] * v_[18])) + (x_in[9] * (v_[9] * v_[108] + (v_[11] * (v_[9] * v_[36]) - v_[5] * (v_[10] * v_[111]))) + x_in[8] * (v_[9] * v_[97] + v_[172] - v_[19]) + x_in[7] * (v_[78] + (v_[82] + v_[5] * v_[169]) - v_[79]));
+    jac[13] = x_in[12] * (v_[11] * (v_[121] - v_[166])) + (x_in[11] * (v_[5] * (v_[173] - v_[123])) - x_in[10] * (v_[5] * (v_[4] * v_[119]))) + (x_in[9] * (v_[5] * (v_[10] * v_[110] - v_[4] * v_[112])) + x_in[8] * (v_[5] * (v_[171] - v_[4] * v_[105])) + x_in[7] * (v_[5] * v_[170]));
+    jac[16] = x_in[12] * (v_[33] - v_[5] * v_[125]) + (x_in[11] * (v_[11] * v_[122]) + x_in[10] * (v_[11] * v_[120] - v_[5] * v_[117])) + (x_in[9] * (v_[11] * v_[114] - v_[5] * v_[109]) + x_in[8] * (v_[106] - v_[5] * v_[102]) + x_in[7] * (v_[92] - v_[5] * v_[84]));
+    jac[5] = x_in[12] * (v_[11] * (v_[136] + v_[10] * (-v_[130] - v_[137])) + v_[5] * (-v_[138] - v_[133])) + (x_in[11] * (v_[5] * (v_[178] + v_[4] * v_[175])) + x_in[10] * (v_[129] + (v_[127] + (v_[177] + v_[5] * (v_[10] * v_[134]))))) + (x_in[9] * v_[128] + x_in[8] * (v_[176] + v_[5] * (v_[10] * (v_[149] + v_[157]) - v_[142]) - v_[147] - v_[174] - v_[7] * 0.42));
+    jac[8] = x_in[12] * v_[143] + (x_in[11] * v_[144] + x_in[10] * (-v_[135] - v_[141] - v_[132])) + (x_in[9] * (v_[5] * (v_[10] * v_[149] - v_[142]) - v_[11] * v_[151] - v_[147]) + x_in[8] * v_[128]);
+    jac[11] = x_in[12] * (v_[146] + v_[5] * (-v_[157] - v_[149])) + (x_in[11] * (v_[5] * (v_[4] * v_[131])) + x_in[10] * (v_[176] + v_[5] * v_[145] - v_[174] - v_[147])) + (x_in[9] * (-v_[141] - v_[135] - v_[132]) + x_in[8] * (v_[127] + (v_[129] + (v_[177] + v_[5] * (v_[10] * (v_[133] + v_[138]))))));
+    jac[14] = x_in[12] * (v_[11] * (v_[154] - v_[4] * v_[148])) + (x_in[11] * (v_[5] * (v_[145] - v_[142])) - x_in[10] * (v_[5] * (v_[4] * v_[152]))) + (x_in[9] * v_[144] + x_in[8] * (v_[5] * (v_[178] - v_[4] * v_[139])));
+    jac[17] = x_in[12] * (v_[11] * v_[158] - v_[5] * v_[156]) + (x_in[11] * (v_[11] * v_[155]) + x_in[10] * (v_[146] - v_[5] * v_[150])) + (x_in[9] * v_[143] + x_in[8] * (v_[11] * v_[140] - v_[5] * v_[134]));
+    jac[2] = 0.;
+    jac[18] = 0.;
+    jac[19] = 0.;
+    jac[20] = 0.;
+    jac[23] = 0.;
+    jac[39] = 0.;
+    jac[40] = 0.;
+    jac[41] = 0.;
+
+
+    return jac_;
+}
+
+} // namespace KUKA
+} // namespace models
+} // namespace ct
+
+// clang-format on
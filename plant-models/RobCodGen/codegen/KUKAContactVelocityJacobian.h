@@ -0,0 +1,47 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaEEVelocity in
+// plant-models/KUKAContactCostCodGen.cpp, in the output format of the KUKAContactCostCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against RobotAbstract::getForwardKinematics by test_models (src/main_test_models.cpp).
+
+#pragma once
+
+#include <ct/core/core.h>
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+class KUKAContactVelocityJacobian
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const size_t IN_DIM = 14;
+    static const size_t OUT_DIM = 3;
+
+    typedef Eigen::Matrix<double, IN_DIM, 1> IN_TYPE;
+    typedef Eigen::Matrix<double, OUT_DIM, IN_DIM> JAC_TYPE;
+
+    KUKAContactVelocityJacobian() { initialize(); }
+
+    const JAC_TYPE& jacobian(const IN_TYPE& x_in);
+
+private:
+    void initialize()
+    {
+        jac_.setZero();
+        v_.fill(0.0);
+    }
+
+    JAC_TYPE jac_;
+    std::array<double, 179> v_;
+};
+
+}  // namespace KUKA
+}  // namespace models
+}  // namespace ct
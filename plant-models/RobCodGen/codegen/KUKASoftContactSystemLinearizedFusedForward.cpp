@@ -0,0 +1,3681 @@
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaSoftContactDynamics in
+// plant-models/KUKASoftContactSystemCodGenLinearizer.cpp, in the output format of the KUKASoftContactLinearizationCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against KUKASoftContactFDSystem by test_models (src/main_test_models.cpp).
+
+// clang-format off
+
+#include <algorithm>
+#include <cmath>
+#include "KUKASoftContactSystemLinearizedFusedForward.h"
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+const int KUKASoftContactSystemLinearizedFusedForward::ROWS[KUKASoftContactSystemLinearizedFusedForward::NNZ] = {0, 1, 2, 3, 4, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16};
+const int KUKASoftContactSystemLinearizedFusedForward::COLS[KUKASoftContactSystemLinearizedFusedForward::NNZ] = {7, 8, 9, 10, 11, 12, 13, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 16, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 16, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 16, 17, 18, 19, 20, 21, 22, 23};
+
+KUKASoftContactSystemLinearizedFusedForward::KUKASoftContactSystemLinearizedFusedForward()
+{
+    const double defaults[PARAM_DIM] = {1000, 0.5, 0.40000000000000002, 0.0050000000000000001, 1000, 10};
+    std::copy(defaults, defaults + PARAM_DIM, in_.begin() + STATE_DIM + CONTROL_DIM);
+}
+
+void KUKASoftContactSystemLinearizedFusedForward::setParameters(const param_vector_t& p)
+{
+    Eigen::Map<param_vector_t>(in_.data() + STATE_DIM + CONTROL_DIM) = p;
+}
+
+void KUKASoftContactSystemLinearizedFusedForward::linearizeSparse(const state_vector_t& state, const control_vector_t& control, state_vector_t& f, values_t& values)
+{
+    Eigen::Map<state_vector_t>(in_.data()) = state;
+    Eigen::Map<control_vector_t>(in_.data() + STATE_DIM) = control;
+
+    const double* x = in_.data();
+    double* y = out_.data();
+    double* v = v_.data();
+
+    v[0] = sin(x[0]);
+    v[1] = cos(x[0]);
+    v[2] = sin(x[1]);
+    v[3] = cos(x[1]);
+    v[4] = sin(x[2]);
+    v[5] = cos(x[2]);
+    v[6] = 0.2045 * v[4];
+    v[7] = 0.2045 * v[5];
+    v[8] = -0.2045 * v[4];
+    v[9] = sin(x[3]);
+    v[10] = cos(x[3]);
+    v[11] = 0.2155 * v[10];
+    v[12] = v[9] * -0.2155;
+    v[13] = sin(x[4]);
+    v[14] = cos(x[4]);
+    v[15] = 0.1845 * v[13];
+    v[16] = 0.1845 * v[14];
+    v[17] = -0.1845 * v[13];
+    v[18] = sin(x[5]);
+    v[19] = cos(x[5]);
+    v[20] = 0.2155 * v[19];
+    v[21] = -0.2155 * v[18];
+    v[22] = sin(x[6]);
+    v[23] = cos(x[6]);
+    v[24] = 0.081 * v[22];
+    v[25] = 0.081 * v[23];
+    v[26] = -0.081 * v[22];
+    v[27] = x[7] * v[2];
+    v[28] = x[7] * v[3];
+    v[29] = x[8] * v[28];
+    v[30] = x[8] * v[27];
+    v[31] = 0.071 * v[27];
+    v[32] = 0.025 * v[28];
+    v[33] = x[8] * 0.0579;
+    v[34] = v[27] * v[33];
+    v[35] = v[28] * v[33];
+    v[36] = x[8] * v[4];
+    v[37] = v[5] * v[27];
+    v[38] = v[36] - v[37];
+    v[39] = x[8] * v[5] + v[4] * v[27];
+    v[40] = v[6] * v[27];
+    v[41] = x[8] * v[7] + v[40];
+    v[42] = v[7] * v[27];
+    v[43] = x[8] * v[8] + v[42];
+    v[44] = x[9] + v[28];
+    v[45] = x[9] * v[39];
+    v[46] = x[9] * v[38];
+    v[47] = x[9] * v[43];
+    v[48] = x[9] * v[41];
+    v[49] = -0.39 * v[43] + 0.1334 * v[38];
+    v[50] = -0.0117 * v[44];
+    v[51] = 0.39 * v[41] + (v[50] + 0.1257 * v[39]);
+    v[52] = -0.09 * v[41] + (0.0127 * v[44] + -0.0117 * v[39]);
+    v[53] = -0.09 * v[44];
+    v[54] = 3. * v[41] + (v[53] + 0.39 * v[39]);
+    v[55] = 3. * v[43] + -0.39 * v[38];
+    v[56] = 0.09 * v[38];
+    v[57] = v[39] * v[52];
+    v[58] = v[39] * v[56];
+    v[59] = v[9] * v[44];
+    v[60] = v[10] * v[38];
+    v[61] = v[59] + v[60];
+    v[62] = v[10] * v[44] - v[9] * v[38];
+    v[63] = v[10] * v[41];
+    v[64] = v[63] + v[11] * v[39];
+    v[65] = v[9] * v[41];
+    v[66] = v[12] * v[39] - v[65];
+    v[67] = 0.2155 * v[38] - v[43];
+    v[68] = x[10] - v[39];
+    v[69] = x[10] * v[62];
+    v[70] = x[10] * v[61];
+    v[71] = x[10] * v[66];
+    v[72] = x[10] * v[64];
+    v[73] = 0.1809 * v[67] + -0.0918 * v[66] + 0.0452 * v[61];
+    v[74] = -0.0061 * v[68];
+    v[75] = 0.0918 * v[64] + (v[74] + 0.0131 * v[62]);
+    v[76] = -0.1809 * v[64] + (0.0411 * v[68] + -0.0061 * v[62]);
+    v[77] = -0.1809 * v[68];
+    v[78] = 2.7 * v[64] + (v[77] + 0.0918 * v[62]);
+    v[79] = 2.7 * v[66] + -0.0918 * v[61];
+    v[80] = 2.7 * v[67] + 0.1809 * v[61];
+    v[81] = v[62] * v[76];
+    v[82] = v[62] * v[80];
+    v[83] = v[13] * v[68];
+    v[84] = v[14] * v[61];
+    v[85] = v[83] - v[84];
+    v[86] = v[14] * v[68] + v[13] * v[61];
+    v[87] = v[13] * v[67];
+    v[88] = v[14] * v[64];
+    v[89] = v[15] * v[61];
+    v[90] = v[87] - v[88] + (v[16] * v[68] + v[89]);
+    v[91] = v[14] * v[67] + v[13] * v[64];
+    v[92] = v[16] * v[61];
+    v[93] = v[91] + (v[17] * v[68] + v[92]);
+    v[94] = x[11] + v[62];
+    v[95] = x[11] * v[86];
+    v[96] = x[11] * v[85];
+    v[97] = x[11] * v[93];
+    v[98] = x[11] * v[90];
+    v[99] = 0.0357 * v[66] + -0.1292 * v[93] + 0.0306 * v[85];
+    v[100] = -0.0027 * v[94];
+    v[101] = -0.00017 * v[66] + 0.1292 * v[90] + (v[100] + 0.0279 * v[86]);
+    v[102] = 0.00017 * v[93] + -0.0357 * v[90] + (0.0058 * v[94] + -0.0027 * v[86]);
+    v[103] = -0.0357 * v[94];
+    v[104] = 1.7 * v[90] + (v[103] + 0.1292 * v[86]);
+    v[105] = 0.00017 * v[94];
+    v[106] = 1.7 * v[93] + (v[105] + -0.1292 * v[85]);
+    v[107] = 1.7 * v[66] + (-0.00017 * v[86] + 0.0357 * v[85]);
+    v[108] = v[86] * v[102];
+    v[109] = v[86] * v[107];
+    v[110] = v[18] * v[94];
+    v[111] = v[19] * v[85];
+    v[112] = v[110] + v[111];
+    v[113] = v[19] * v[94] - v[18] * v[85];
+    v[114] = v[18] * v[66];
+    v[115] = v[19] * v[90];
+    v[116] = v[114] + v[115] + v[20] * v[86];
+    v[117] = v[19] * v[66] - v[18] * v[90];
+    v[118] = v[117] + v[21] * v[86];
+    v[119] = 0.2155 * v[85] - v[93];
+    v[120] = x[12] - v[86];
+    v[121] = x[12] * v[113];
+    v[122] = x[12] * v[112];
+    v[123] = x[12] * v[118];
+    v[124] = x[12] * v[116];
+    v[125] = 0.00108 * v[119] + -0.00072 * v[118] + 0.0005 * v[112];
+    v[126] = 0.00072 * v[116] + 0.0036 * v[113];
+    v[127] = -0.00108 * v[116] + 0.0047 * v[120];
+    v[128] = -0.00108 * v[120];
+    v[129] = 1.8 * v[116] + (v[128] + 0.00072 * v[113]);
+    v[130] = 1.8 * v[118] + -0.00072 * v[112];
+    v[131] = 1.8 * v[119] + 0.00108 * v[112];
+    v[132] = v[113] * v[127];
+    v[133] = v[113] * v[131];
+    v[134] = v[22] * v[120];
+    v[135] = v[23] * v[112];
+    v[136] = v[134] - v[135];
+    v[137] = v[23] * v[120] + v[22] * v[112];
+    v[138] = v[22] * v[119];
+    v[139] = v[23] * v[116];
+    v[140] = v[24] * v[112];
+    v[141] = v[138] - v[139] + (v[25] * v[120] + v[140]);
+    v[142] = v[23] * v[119] + v[22] * v[116];
+    v[143] = v[25] * v[112];
+    v[144] = v[142] + (v[26] * v[120] + v[143]);
+    v[145] = x[13] + v[113];
+    v[146] = x[13] * v[137];
+    v[147] = x[13] * v[136];
+    v[148] = x[13] * v[144];
+    v[149] = x[13] * v[141];
+    v[150] = 0.001 * v[136];
+    v[151] = -0.006 * v[144] + v[150];
+    v[152] = 0.001 * v[137];
+    v[153] = 0.006 * v[141] + v[152];
+    v[154] = 0.001 * v[145];
+    v[155] = 0.3 * v[141];
+    v[156] = v[155] + 0.006 * v[137];
+    v[157] = 0.3 * v[144];
+    v[158] = v[157] + -0.006 * v[136];
+    v[159] = 0.3 * v[118];
+    v[160] = v[137] * v[154];
+    v[161] = v[141] * v[158] - v[144] * v[156] + (v[136] * v[153] - v[137] * v[151]);
+    v[162] = v[137] * v[159];
+    v[163] = x[23] + x[13] * -0.2 - v[161];
+    v[164] = 0.001 * v[146];
+    v[165] = v[144] * v[159] - v[118] * v[158] + (v[160] - v[145] * v[153]) + (v[164] - -0.006 * v[149]);
+    v[166] = v[118] * v[156] - v[141] * v[159] + (v[145] * v[151] - v[136] * v[154]) + (0.006 * v[148] - 0.001 * v[147]);
+    v[147] = v[162] - v[145] * v[158] + (0.3 * v[148] - 0.006 * v[147]);
+    v[148] = v[145] * v[156] - v[136] * v[159] + (-0.006 * v[146] - 0.3 * v[149]);
+    v[149] = 0.001 * v[23];
+    v[167] = -0.006 * v[25] - v[149];
+    v[168] = 0.001 * v[22];
+    v[169] = -0.006 * v[26] + v[168];
+    v[170] = -0.006 * v[22];
+    v[171] = -0.006 * v[23];
+    v[172] = 0.006 * v[24];
+    v[173] = v[168] + v[172];
+    v[174] = v[149] + 0.006 * v[25];
+    v[175] = 0.006 * v[23];
+    v[176] = 0.006 * v[22];
+    v[177] = 0.3 * v[24];
+    v[178] = v[176] + v[177];
+    v[179] = 0.3 * v[25];
+    v[180] = v[175] + v[179];
+    v[181] = 0.3 * v[23];
+    v[182] = 0.3 * v[22];
+    v[179] = v[179] - v[171];
+    v[183] = v[170] + 0.3 * v[26];
+    v[184] = v[24] * v[178];
+    v[185] = v[22] * v[173];
+    v[186] = v[23] * v[167];
+    v[187] = v[24] * v[180];
+    v[188] = v[22] * v[174];
+    v[189] = v[23] * v[169];
+    v[190] = v[25] * v[182];
+    v[191] = v[24] * v[181];
+    v[192] = v[22] * v[175];
+    v[193] = v[23] * v[170];
+    v[194] = v[25] * v[181];
+    v[195] = v[24] * v[182];
+    v[196] = v[22] * v[176];
+    v[197] = v[23] * v[171];
+    v[198] = v[25] * v[178];
+    v[173] = v[23] * v[173];
+    v[167] = v[22] * v[167];
+    v[199] = v[26] * v[179] + v[198] + (v[173] + v[167]);
+    v[200] = v[25] * v[180];
+    v[201] = v[23] * v[174];
+    v[202] = v[22] * v[169];
+    v[203] = v[26] * v[182];
+    v[175] = v[23] * v[175];
+    v[204] = v[22] * v[170];
+    v[205] = v[26] * v[181];
+    v[206] = v[23] * v[176];
+    v[207] = v[22] * v[171];
+    v[208] = v[190] + v[205] + (v[206] + v[207]);
+    v[209] = v[22] * v[179];
+    v[210] = v[23] * v[178];
+    v[211] = v[22] * v[183];
+    v[212] = v[23] * v[180];
+    v[213] = v[22] * v[181];
+    v[214] = v[23] * v[182];
+    v[215] = v[23] * v[179];
+    v[178] = v[22] * v[178];
+    v[216] = v[23] * v[183];
+    v[217] = v[22] * v[180];
+    v[218] = 0.0047 + (v[26] * v[183] + v[200] + (v[201] + v[202]));
+    v[219] = -0.00108 + (v[203] - v[194] + (v[204] - v[175]));
+    v[220] = 1.8 + (v[22] * v[182] + v[23] * v[181]);
+    v[221] = v[24] * v[147];
+    v[222] = v[22] * v[166];
+    v[223] = v[23] * v[165];
+    v[224] = v[25] * v[147];
+    v[166] = v[23] * v[166];
+    v[165] = v[22] * v[165];
+    v[225] = v[22] * v[148];
+    v[226] = v[23] * v[147];
+    v[227] = v[23] * v[148];
+    v[147] = v[22] * v[147];
+    v[228] = v[116] * v[130] - v[118] * v[129] + (v[112] * v[126] - v[113] * v[125]) + (v[26] * v[148] + v[224] + (v[166] + v[165]));
+    v[229] = x[22] + x[12] * -0.5 - v[228];
+    v[230] = v[199] / v[218];
+    v[231] = v[218] / v[218];
+    v[232] = v[219] / v[218];
+    v[233] = v[208] / v[218];
+    v[234] = 0.0005 + (v[25] * v[179] + v[184] + (v[185] - v[186])) - v[199] * v[230];
+    v[235] = v[25] * v[183] + v[187] + (v[188] - v[189]) - v[218] * v[230];
+    v[236] = v[190] - v[191] + (-v[193] - v[192]) - v[219] * v[230];
+    v[237] = 0.00108 + (v[194] + v[195] + (v[196] - v[197])) - v[208] * v[230];
+    v[238] = v[199] - v[199] * v[231];
+    v[239] = v[219] - v[219] * v[231];
+    v[240] = v[208] - v[208] * v[231];
+    v[241] = v[209] - v[210] - v[199] * v[232];
+    v[242] = -0.00108 + (v[211] - v[212]) - v[218] * v[232];
+    v[243] = v[220] - v[219] * v[232];
+    v[244] = v[213] - v[214] - v[208] * v[232];
+    v[245] = 0.00108 + (v[215] + v[178]) - v[199] * v[233];
+    v[246] = v[214] - v[213] - v[219] * v[233];
+    v[220] = v[220] - v[208] * v[233];
+    v[247] = v[199] * v[229] / v[218];
+    v[248] = v[247] + (v[118] * v[131] - v[119] * v[130] + (v[132] - v[120] * v[126]) + (v[25] * v[148] + v[221] + (v[222] - v[223])) + (v[123] * v[241] - -0.00072 * v[124] + v[121] * v[234]));
+    v[161] = v[119] * v[129] - v[116] * v[131] + (v[120] * v[125] - v[112] * v[127]) + (v[161] + 0.001 * v[163] / 0.001) + (0.00072 * v[123] - 0.0036 * v[122]);
+    v[249] = v[218] * v[229] / v[218];
+    v[250] = v[219] * v[229] / v[218];
+    v[251] = v[250] + (v[133] - v[120] * v[130] + (v[225] - v[226]) + (v[123] * v[243] + (v[121] * v[236] - 0.00072 * v[122])));
+    v[124] = v[120] * v[129] - v[112] * v[131] + (v[136] * v[158] - v[137] * v[156]) + (-0.00072 * v[121] - v[124] * 2.1);
+    v[252] = v[208] * v[229] / v[218];
+    v[253] = v[252] + (v[112] * v[130] - v[113] * v[129] + (v[227] + v[147]) + (v[123] * v[244] + v[121] * v[237]));
+    v[254] = v[19] * v[234];
+    v[255] = 0.2155 * v[237] + v[254];
+    v[256] = -0.00072 * v[21] + v[20] * v[236] - v[235];
+    v[257] = v[18] * v[234];
+    v[258] = -0.00072 * v[18];
+    v[259] = v[19] * v[236] - v[258];
+    v[260] = -0.00072 * v[19];
+    v[261] = v[18] * v[236];
+    v[262] = v[260] + v[261];
+    v[263] = 0.0036 * v[18];
+    v[264] = 0.00072 * v[20];
+    v[265] = 0.0036 * v[19];
+    v[266] = 0.00072 * v[19];
+    v[267] = 0.00072 * v[18];
+    v[268] = v[19] * v[238];
+    v[238] = v[18] * v[238];
+    v[269] = v[19] * v[239];
+    v[270] = v[18] * v[239];
+    v[271] = v[19] * v[241] - v[267];
+    v[272] = 0.2155 * v[244] + v[271];
+    v[273] = v[20] * v[243] - v[242];
+    v[274] = v[18] * v[241];
+    v[275] = v[266] + v[274];
+    v[276] = v[19] * v[243];
+    v[277] = v[18] * v[243];
+    v[278] = v[21] * 2.1;
+    v[279] = v[18] * 2.1;
+    v[280] = v[19] * 2.1;
+    v[281] = 0.2155 * v[220];
+    v[282] = v[19] * v[245];
+    v[283] = v[281] + v[282];
+    v[284] = v[20] * v[246] - (v[216] + v[217] - v[218] * v[233]);
+    v[245] = v[18] * v[245];
+    v[285] = v[19] * v[246];
+    v[286] = v[18] * v[246];
+    v[287] = v[18] * v[263];
+    v[288] = v[19] * v[255];
+    v[289] = v[18] * v[264];
+    v[290] = v[19] * v[256];
+    v[291] = 0.2155 * v[245];
+    v[292] = v[18] * v[265];
+    v[293] = v[19] * v[257];
+    v[294] = 0.2155 * v[285];
+    v[295] = v[18] * v[266];
+    v[296] = v[19] * v[259];
+    v[297] = v[19] * v[237];
+    v[298] = -v[297];
+    v[299] = 0.2155 * v[286];
+    v[300] = v[18] * v[267];
+    v[301] = v[19] * v[262];
+    v[302] = v[21] * v[260];
+    v[303] = v[21] * v[258];
+    v[304] = v[21] * v[279];
+    v[305] = v[20] * v[276];
+    v[306] = v[21] * v[280];
+    v[307] = v[20] * v[277];
+    v[263] = v[19] * v[263];
+    v[255] = v[18] * v[255];
+    v[308] = v[255] - v[263];
+    v[264] = v[19] * v[264];
+    v[256] = v[18] * v[256];
+    v[309] = v[19] * v[265];
+    v[257] = v[18] * v[257];
+    v[310] = v[19] * v[266];
+    v[259] = v[18] * v[259];
+    v[311] = v[18] * v[237];
+    v[267] = v[19] * v[267];
+    v[262] = v[18] * v[262];
+    v[312] = v[267] + v[262];
+    v[313] = v[18] * v[260];
+    v[314] = v[19] * v[272];
+    v[315] = v[18] * v[278];
+    v[316] = v[19] * v[273];
+    v[317] = v[18] * v[258];
+    v[318] = v[19] * v[275];
+    v[319] = v[18] * v[279];
+    v[320] = v[19] * v[276];
+    v[321] = -(v[19] * v[244]);
+    v[322] = v[18] * v[280];
+    v[323] = v[19] * v[277];
+    v[285] = -v[285];
+    v[324] = v[19] * v[260];
+    v[325] = v[18] * v[272];
+    v[326] = v[19] * v[278];
+    v[327] = v[18] * v[273];
+    v[328] = v[19] * v[258];
+    v[329] = v[18] * v[275];
+    v[330] = v[19] * v[279];
+    v[331] = v[18] * v[276];
+    v[332] = v[18] * v[244];
+    v[333] = v[19] * v[280];
+    v[334] = v[18] * v[277];
+    v[335] = -0.0027 + (v[264] + v[256]);
+    v[336] = 0.0058 + (v[309] + v[257]);
+    v[337] = -0.0357 + (v[310] + v[259]);
+    v[338] = 0.00017 - v[311];
+    v[339] = v[18] * v[161];
+    v[340] = v[19] * v[248];
+    v[161] = v[19] * v[161];
+    v[248] = v[18] * v[248];
+    v[341] = v[18] * v[124];
+    v[342] = v[19] * v[251];
+    v[343] = v[19] * v[124];
+    v[344] = v[18] * v[251];
+    v[345] = v[90] * v[106] - v[93] * v[104] + (v[85] * v[101] - v[86] * v[99]) + (v[161] + v[248]);
+    v[346] = x[21] - x[11] - v[345];
+    v[347] = v[308] / v[336];
+    v[348] = v[335] / v[336];
+    v[349] = v[336] / v[336];
+    v[350] = v[337] / v[336];
+    v[351] = v[338] / v[336];
+    v[352] = v[312] / v[336];
+    v[353] = 0.0306 + (0.2155 * v[283] + (v[287] + v[288])) - v[308] * v[347];
+    v[354] = 0.2155 * v[284] + (v[290] - v[289]) - v[335] * v[347];
+    v[355] = v[291] + (v[293] - v[292]) - v[336] * v[347];
+    v[356] = v[294] + (v[296] - v[295]) - v[337] * v[347];
+    v[281] = -0.1292 + (v[298] - v[281]) - v[338] * v[347];
+    v[357] = 0.0357 + (v[299] + (v[301] - v[300])) - v[312] * v[347];
+    v[358] = v[302] + v[20] * v[272] - (0.2155 * v[240] + v[268]) - v[308] * v[348];
+    v[359] = 0.0279 + (v[21] * v[278] + v[20] * v[273] - (v[20] * v[239] - (v[218] - v[218] * v[231]))) - v[335] * v[348];
+    v[360] = -0.0027 + (v[303] + v[20] * v[275] - v[238]) - v[336] * v[348];
+    v[361] = 0.1292 + (v[305] - v[304] - v[269]) - v[337] * v[348];
+    v[240] = v[240] - v[20] * v[244] - v[338] * v[348];
+    v[362] = -0.00017 + (v[306] + v[307] - v[270]) - v[312] * v[348];
+    v[363] = v[308] - v[308] * v[349];
+    v[364] = v[335] - v[335] * v[349];
+    v[365] = v[337] - v[337] * v[349];
+    v[366] = v[338] - v[338] * v[349];
+    v[367] = v[314] - v[313] - v[308] * v[350];
+    v[368] = 0.1292 + (v[316] - v[315]) - v[335] * v[350];
+    v[369] = -0.0357 + (v[318] - v[317]) - v[336] * v[350];
+    v[370] = 1.7 + (v[319] + v[320]) - v[337] * v[350];
+    v[371] = v[321] - v[338] * v[350];
+    v[372] = v[323] - v[322] - v[312] * v[350];
+    v[283] = -0.1292 - v[283] - v[308] * v[351];
+    v[284] = -v[284] - v[335] * v[351];
+    v[373] = 0.00017 - v[245] - v[336] * v[351];
+    v[374] = v[285] - v[337] * v[351];
+    v[220] = 1.7 + v[220] - v[338] * v[351];
+    v[375] = -v[286] - v[312] * v[351];
+    v[376] = 0.0357 + (v[324] + v[325]) - v[308] * v[352];
+    v[377] = -0.00017 + (v[326] + v[327]) - v[335] * v[352];
+    v[378] = v[331] - v[330] - v[337] * v[352];
+    v[379] = -v[332] - v[338] * v[352];
+    v[380] = v[308] * v[346] / v[336];
+    v[381] = v[380] + (v[93] * v[107] - v[66] * v[106] + (v[108] - v[94] * v[101]) + (0.2155 * v[253] + (v[340] - v[339])) + (v[97] * v[367] - v[98] * v[283] + (v[95] * v[353] - v[96] * v[358])));
+    v[382] = v[335] * v[346] / v[336];
+    v[228] = v[382] + (v[66] * v[104] - v[90] * v[107] + (v[94] * v[99] - v[85] * v[102]) + (v[21] * v[124] + v[20] * v[251] - (v[249] + (v[228] + (v[123] * v[242] + v[121] * v[235])))) + (v[97] * v[368] - v[98] * v[284] + (v[95] * v[354] - v[96] * v[359])));
+    v[383] = v[336] * v[346] / v[336];
+    v[384] = v[337] * v[346] / v[336];
+    v[385] = v[384] + (v[109] - v[94] * v[106] + (v[342] - v[341]) + (v[97] * v[370] - v[98] * v[374] + (v[95] * v[356] - v[96] * v[361])));
+    v[386] = v[338] * v[346] / v[336];
+    v[253] = v[386] + (v[94] * v[104] - v[85] * v[107] - v[253] + (v[97] * v[371] - v[98] * v[220] + (v[95] * v[281] - v[96] * v[240])));
+    v[387] = v[312] * v[346] / v[336];
+    v[388] = v[15] * v[356];
+    v[389] = v[13] * v[354];
+    v[390] = v[14] * v[353];
+    v[391] = v[16] * v[281] + v[388] + (v[389] - v[390]);
+    v[392] = v[16] * v[356];
+    v[393] = v[14] * v[354] + v[13] * v[353];
+    v[394] = v[17] * v[281] + v[392] + v[393];
+    v[395] = v[13] * v[281];
+    v[396] = v[14] * v[356];
+    v[397] = v[395] - v[396];
+    v[398] = v[14] * v[281] + v[13] * v[356];
+    v[399] = v[15] * v[361];
+    v[400] = v[13] * v[359];
+    v[401] = v[14] * v[358];
+    v[402] = v[16] * v[240] + v[399] + (v[400] - v[401]);
+    v[403] = v[16] * v[361];
+    v[404] = v[14] * v[359] + v[13] * v[358];
+    v[405] = v[17] * v[240] + v[403] + v[404];
+    v[406] = v[13] * v[240];
+    v[407] = v[14] * v[361];
+    v[408] = v[406] - v[407];
+    v[409] = v[14] * v[240] + v[13] * v[361];
+    v[410] = v[15] * v[365];
+    v[411] = v[13] * v[364];
+    v[412] = v[14] * v[363];
+    v[413] = v[16] * v[365];
+    v[363] = v[14] * v[364] + v[13] * v[363];
+    v[364] = v[13] * v[366];
+    v[414] = v[14] * v[365];
+    v[365] = v[14] * v[366] + v[13] * v[365];
+    v[415] = v[15] * v[370];
+    v[416] = v[13] * v[368];
+    v[417] = v[14] * v[367];
+    v[418] = v[16] * v[371] + v[415] + (v[416] - v[417]);
+    v[419] = v[16] * v[370];
+    v[420] = v[14] * v[368] + v[13] * v[367];
+    v[421] = v[17] * v[371] + v[419] + v[420];
+    v[422] = v[13] * v[371];
+    v[423] = v[14] * v[370];
+    v[424] = v[422] - v[423];
+    v[425] = v[14] * v[371] + v[13] * v[370];
+    v[426] = v[15] * v[374];
+    v[427] = v[13] * v[284];
+    v[428] = v[14] * v[283];
+    v[429] = v[16] * v[220] + v[426] + (v[427] - v[428]);
+    v[430] = v[16] * v[374];
+    v[431] = v[14] * v[284] + v[13] * v[283];
+    v[432] = v[17] * v[220] + v[430] + v[431];
+    v[433] = v[13] * v[220];
+    v[434] = v[14] * v[374];
+    v[435] = v[433] - v[434];
+    v[436] = v[14] * v[220] + v[13] * v[374];
+    v[437] = v[15] * v[378];
+    v[438] = v[13] * v[377];
+    v[439] = v[14] * v[376];
+    v[440] = v[16] * v[378];
+    v[376] = v[14] * v[377] + v[13] * v[376];
+    v[377] = v[13] * v[379];
+    v[441] = v[14] * v[378];
+    v[378] = v[14] * v[379] + v[13] * v[378];
+    v[442] = v[15] * v[418];
+    v[443] = v[13] * v[402];
+    v[444] = v[14] * v[391];
+    v[445] = v[15] * v[369];
+    v[446] = v[13] * v[360];
+    v[447] = v[14] * v[355];
+    v[448] = v[15] * v[421];
+    v[449] = v[13] * v[405];
+    v[450] = v[14] * v[394];
+    v[451] = v[15] * v[424];
+    v[452] = v[13] * v[408];
+    v[453] = v[14] * v[397];
+    v[454] = v[15] * v[372];
+    v[455] = v[13] * v[362];
+    v[456] = v[14] * v[357];
+    v[457] = v[16] * v[436];
+    v[458] = v[15] * v[425];
+    v[459] = v[13] * v[409];
+    v[460] = v[14] * v[398];
+    v[461] = v[16] * v[418];
+    v[402] = v[14] * v[402];
+    v[391] = v[13] * v[391];
+    v[462] = v[17] * v[429] + v[461] + (v[402] + v[391]);
+    v[463] = v[16] * v[369];
+    v[464] = v[14] * v[360] + v[13] * v[355];
+    v[465] = v[16] * v[421];
+    v[405] = v[14] * v[405];
+    v[394] = v[13] * v[394];
+    v[466] = v[16] * v[424];
+    v[408] = v[14] * v[408];
+    v[397] = v[13] * v[397];
+    v[467] = v[16] * v[372];
+    v[468] = v[14] * v[362] + v[13] * v[357];
+    v[469] = v[17] * v[375] + v[467] + v[468];
+    v[470] = v[17] * v[436];
+    v[471] = v[16] * v[425];
+    v[409] = v[14] * v[409];
+    v[398] = v[13] * v[398];
+    v[472] = v[470] + v[471] + (v[409] + v[398]);
+    v[473] = v[13] * v[429];
+    v[474] = v[14] * v[418];
+    v[475] = v[13] * v[373];
+    v[476] = v[14] * v[369];
+    v[477] = v[13] * v[432];
+    v[478] = v[14] * v[421];
+    v[479] = v[13] * v[435];
+    v[480] = v[14] * v[424];
+    v[481] = v[13] * v[375];
+    v[482] = v[14] * v[372];
+    v[483] = v[13] * v[436];
+    v[484] = v[14] * v[425];
+    v[485] = v[14] * v[429];
+    v[418] = v[13] * v[418];
+    v[486] = v[14] * v[373] + v[13] * v[369];
+    v[487] = v[14] * v[432];
+    v[421] = v[13] * v[421];
+    v[488] = v[14] * v[435];
+    v[424] = v[13] * v[424];
+    v[489] = v[14] * v[375] + v[13] * v[372];
+    v[490] = v[14] * v[436];
+    v[425] = v[13] * v[425];
+    v[491] = -0.0061 + (v[17] * v[373] + v[463] + v[464]);
+    v[492] = 0.0411 + (v[17] * v[432] + v[465] + (v[405] + v[394]));
+    v[493] = -0.1809 + (v[17] * v[435] + v[466] + (v[408] + v[397]));
+    v[494] = v[15] * v[385];
+    v[495] = v[13] * v[228];
+    v[496] = v[14] * v[381];
+    v[497] = v[16] * v[385];
+    v[228] = v[14] * v[228];
+    v[381] = v[13] * v[381];
+    v[498] = v[13] * v[253];
+    v[499] = v[14] * v[385];
+    v[500] = v[14] * v[253];
+    v[385] = v[13] * v[385];
+    v[501] = v[64] * v[79] - v[66] * v[78] + (v[61] * v[75] - v[62] * v[73]) + (v[17] * v[253] + v[497] + (v[228] + v[381]));
+    v[502] = x[20] + x[10] * -0.3 - v[501];
+    v[503] = v[462] / v[492];
+    v[504] = v[491] / v[492];
+    v[505] = v[492] / v[492];
+    v[506] = v[493] / v[492];
+    v[507] = v[469] / v[492];
+    v[508] = v[472] / v[492];
+    v[509] = 0.0452 + (v[16] * v[429] + v[442] + (v[443] - v[444])) - v[462] * v[503];
+    v[510] = v[16] * v[373] + v[445] + (v[446] - v[447]) - v[491] * v[503];
+    v[511] = v[16] * v[432] + v[448] + (v[449] - v[450]) - v[492] * v[503];
+    v[512] = v[16] * v[435] + v[451] + (v[452] - v[453]) - v[493] * v[503];
+    v[513] = -0.0918 + (v[16] * v[375] + v[454] + (v[455] - v[456])) - v[469] * v[503];
+    v[514] = 0.1809 + (v[457] + v[458] + (v[459] - v[460])) - v[472] * v[503];
+    v[515] = v[16] * v[366] + v[410] + (v[411] - v[412]) - v[462] * v[504];
+    v[516] = 0.0131 + (v[336] - v[336] * v[349]) - v[491] * v[504];
+    v[517] = -0.0061 + (v[17] * v[366] + v[413] + v[363]) - v[492] * v[504];
+    v[518] = 0.0918 + (v[364] - v[414]) - v[493] * v[504];
+    v[519] = v[312] - v[312] * v[349] - v[469] * v[504];
+    v[520] = v[365] - v[472] * v[504];
+    v[521] = v[462] - v[462] * v[505];
+    v[522] = v[491] - v[491] * v[505];
+    v[523] = v[493] - v[493] * v[505];
+    v[524] = v[469] - v[469] * v[505];
+    v[525] = v[472] - v[472] * v[505];
+    v[526] = v[473] - v[474] - v[462] * v[506];
+    v[527] = 0.0918 + (v[475] - v[476]) - v[491] * v[506];
+    v[528] = -0.1809 + (v[477] - v[478]) - v[492] * v[506];
+    v[529] = 2.7 + (v[479] - v[480]) - v[493] * v[506];
+    v[530] = v[481] - v[482] - v[469] * v[506];
+    v[531] = v[483] - v[484] - v[472] * v[506];
+    v[532] = -0.0918 + (v[16] * v[379] + v[437] + (v[438] - v[439])) - v[462] * v[507];
+    v[533] = v[328] + v[329] - v[336] * v[352] - v[491] * v[507];
+    v[534] = v[17] * v[379] + v[440] + v[376] - v[492] * v[507];
+    v[535] = v[377] - v[441] - v[493] * v[507];
+    v[536] = 2.7 + (1.7 + (v[333] + v[334]) - v[312] * v[352]) - v[469] * v[507];
+    v[537] = v[378] - v[472] * v[507];
+    v[538] = 0.1809 + (v[485] + v[418]) - v[462] * v[508];
+    v[539] = v[486] - v[491] * v[508];
+    v[540] = v[488] + v[424] - v[493] * v[508];
+    v[541] = v[489] - v[469] * v[508];
+    v[542] = 2.7 + (v[490] + v[425]) - v[472] * v[508];
+    v[543] = v[462] * v[502] / v[492];
+    v[544] = v[543] + (v[66] * v[80] - v[67] * v[79] + (v[81] - v[68] * v[75]) + (v[16] * v[253] + v[494] + (v[495] - v[496])) + (v[71] * v[526] - v[72] * v[532] + (v[69] * v[509] - v[70] * v[515])));
+    v[545] = v[491] * v[502] / v[492];
+    v[345] = v[545] + (v[67] * v[78] - v[64] * v[80] + (v[68] * v[73] - v[61] * v[76]) + (v[383] + (v[345] + (v[97] * v[369] - v[98] * v[373] + (v[95] * v[355] - v[96] * v[360])))) + (v[71] * v[527] - v[72] * v[533] + (v[69] * v[510] - v[70] * v[516])));
+    v[546] = v[492] * v[502] / v[492];
+    v[547] = v[493] * v[502] / v[492];
+    v[548] = v[547] + (v[82] - v[68] * v[79] + (v[498] - v[499]) + (v[71] * v[529] - v[72] * v[535] + (v[69] * v[512] - v[70] * v[518])));
+    v[549] = v[469] * v[502] / v[492];
+    v[550] = v[549] + (v[68] * v[78] - v[61] * v[80] + (v[387] + (v[85] * v[106] - v[86] * v[104] + (v[343] + v[344]) + (v[97] * v[372] - v[98] * v[375] + (v[95] * v[357] - v[96] * v[362])))) + (v[71] * v[530] - v[72] * v[536] + (v[69] * v[513] - v[70] * v[519])));
+    v[551] = v[472] * v[502] / v[492];
+    v[552] = v[551] + (v[61] * v[79] - v[62] * v[78] + (v[500] + v[385]) + (v[71] * v[531] - v[72] * v[537] + (v[69] * v[514] - v[70] * v[520])));
+    v[553] = v[10] * v[509] - v[9] * v[510];
+    v[554] = 0.2155 * v[514] + v[553];
+    v[555] = v[12] * v[513] + v[11] * v[512] - v[511];
+    v[556] = v[10] * v[510];
+    v[557] = v[9] * v[509];
+    v[558] = v[556] + v[557];
+    v[559] = v[10] * v[512] - v[9] * v[513];
+    v[560] = v[10] * v[515] - v[9] * v[516];
+    v[561] = 0.2155 * v[520] + v[560];
+    v[562] = v[12] * v[519] + v[11] * v[518] - v[517];
+    v[563] = v[10] * v[516];
+    v[564] = v[9] * v[515];
+    v[565] = v[563] + v[564];
+    v[566] = v[10] * v[518] - v[9] * v[519];
+    v[567] = v[10] * v[521] - v[9] * v[522];
+    v[522] = v[10] * v[522];
+    v[521] = v[9] * v[521];
+    v[568] = v[10] * v[526] - v[9] * v[527];
+    v[569] = 0.2155 * v[531] + v[568];
+    v[570] = v[12] * v[530] + v[11] * v[529] - v[528];
+    v[571] = v[10] * v[527];
+    v[572] = v[9] * v[526];
+    v[573] = v[571] + v[572];
+    v[574] = v[10] * v[529] - v[9] * v[530];
+    v[575] = v[10] * v[532] - v[9] * v[533];
+    v[576] = 0.2155 * v[537] + v[575];
+    v[577] = v[12] * v[536] + v[11] * v[535] - v[534];
+    v[578] = v[10] * v[533];
+    v[579] = v[9] * v[532];
+    v[580] = v[578] + v[579];
+    v[581] = v[10] * v[535] - v[9] * v[536];
+    v[582] = 0.2155 * v[542];
+    v[583] = v[10] * v[538] - v[9] * v[539];
+    v[584] = v[582] + v[583];
+    v[585] = v[12] * v[541] + v[11] * v[540] - (v[487] + v[421] - v[492] * v[508]);
+    v[539] = v[10] * v[539];
+    v[538] = v[9] * v[538];
+    v[586] = v[539] + v[538];
+    v[587] = v[10] * v[540] - v[9] * v[541];
+    v[588] = v[9] * v[561];
+    v[589] = v[10] * v[554];
+    v[590] = v[9] * v[562];
+    v[591] = v[10] * v[555];
+    v[592] = v[9] * v[565];
+    v[593] = v[10] * v[558];
+    v[594] = v[9] * v[566];
+    v[595] = v[10] * v[559];
+    v[596] = v[9] * v[520] - v[10] * v[514];
+    v[561] = v[10] * v[561];
+    v[554] = v[9] * v[554];
+    v[597] = v[561] + v[554];
+    v[562] = v[10] * v[562];
+    v[555] = v[9] * v[555];
+    v[565] = v[10] * v[565];
+    v[558] = v[9] * v[558];
+    v[566] = v[10] * v[566];
+    v[559] = v[9] * v[559];
+    v[598] = v[10] * v[520];
+    v[599] = v[9] * v[514];
+    v[600] = -v[599] - v[598];
+    v[601] = -0.0117 + (v[562] + v[555]);
+    v[602] = 0.0127 + (v[565] + v[558]);
+    v[603] = -0.09 + (v[566] + v[559]);
+    v[604] = v[9] * v[345];
+    v[605] = v[10] * v[544];
+    v[345] = v[10] * v[345];
+    v[544] = v[9] * v[544];
+    v[606] = v[41] * v[55] - v[43] * v[54] + (v[38] * v[51] - v[39] * v[49]) + (v[345] + v[544]);
+    v[607] = x[19] + x[9] * -0.5 - v[606];
+    v[608] = v[597] / v[602];
+    v[609] = v[601] / v[602];
+    v[610] = v[602] / v[602];
+    v[611] = v[603] / v[602];
+    v[612] = v[600] / v[602];
+    v[613] = 0.1334 + (0.2155 * v[584] + (v[589] - v[588])) - v[597] * v[608];
+    v[614] = 0.2155 * v[585] + (v[591] - v[590]) - v[601] * v[608];
+    v[615] = 0.2155 * v[586] + (v[593] - v[592]) - v[602] * v[608];
+    v[616] = 0.2155 * v[587] + (v[595] - v[594]) - v[603] * v[608];
+    v[582] = -0.39 + (v[596] - v[582]) - v[600] * v[608];
+    v[617] = v[12] * v[576] + v[11] * v[569] - (0.2155 * v[525] + v[567]) - v[597] * v[609];
+    v[618] = 0.1257 + (v[12] * v[577] + v[11] * v[570] - (v[12] * v[524] + v[11] * v[523] - (v[492] - v[492] * v[505]))) - v[601] * v[609];
+    v[619] = -0.0117 + (v[12] * v[580] + v[11] * v[573] - (v[522] + v[521])) - v[602] * v[609];
+    v[620] = 0.39 + (v[12] * v[581] + v[11] * v[574] - (v[10] * v[523] - v[9] * v[524])) - v[603] * v[609];
+    v[525] = v[525] + (-(v[11] * v[531]) - v[12] * v[537]) - v[600] * v[609];
+    v[621] = v[597] - v[597] * v[610];
+    v[622] = v[601] - v[601] * v[610];
+    v[623] = v[603] - v[603] * v[610];
+    v[624] = v[600] - v[600] * v[610];
+    v[625] = v[10] * v[569] - v[9] * v[576] - v[597] * v[611];
+    v[626] = 0.39 + (v[10] * v[570] - v[9] * v[577]) - v[601] * v[611];
+    v[627] = -0.09 + (v[10] * v[573] - v[9] * v[580]) - v[602] * v[611];
+    v[628] = 3. + (v[10] * v[574] - v[9] * v[581]) - v[603] * v[611];
+    v[629] = v[9] * v[537] - v[10] * v[531] - v[600] * v[611];
+    v[584] = -0.39 - v[584] - v[597] * v[612];
+    v[585] = -v[585] - v[601] * v[612];
+    v[586] = -v[586] - v[602] * v[612];
+    v[587] = -v[587] - v[603] * v[612];
+    v[542] = 3. + v[542] - v[600] * v[612];
+    v[630] = v[597] * v[607] / v[602];
+    v[631] = v[630] + (v[43] * v[56] + (v[57] - v[44] * v[51]) + (0.2155 * v[552] + (v[605] - v[604])) + (v[47] * v[625] - v[48] * v[584] + (v[45] * v[613] - v[46] * v[617])));
+    v[632] = v[601] * v[607] / v[602];
+    v[501] = v[632] + (v[44] * v[49] - v[38] * v[52] - v[41] * v[56] + (v[12] * v[550] + v[11] * v[548] - (v[546] + (v[501] + (v[71] * v[528] - v[72] * v[534] + (v[69] * v[511] - v[70] * v[517]))))) + (v[47] * v[626] - v[48] * v[585] + (v[45] * v[614] - v[46] * v[618])));
+    v[633] = v[602] * v[607] / v[602];
+    v[634] = v[603] * v[607] / v[602];
+    v[635] = v[634] + (v[58] - v[44] * v[55] + (v[10] * v[548] - v[9] * v[550]) + (v[47] * v[628] - v[48] * v[587] + (v[45] * v[616] - v[46] * v[620])));
+    v[636] = v[600] * v[607] / v[602];
+    v[552] = v[636] + (v[44] * v[54] - v[38] * v[56] - v[552] + (v[47] * v[629] - v[48] * v[542] + (v[45] * v[582] - v[46] * v[525])));
+    v[637] = v[6] * v[616];
+    v[638] = v[4] * v[614];
+    v[639] = v[5] * v[613];
+    v[640] = v[7] * v[582] + v[637] + (v[638] - v[639]);
+    v[641] = v[7] * v[616];
+    v[642] = v[5] * v[614] + v[4] * v[613];
+    v[643] = v[8] * v[582] + v[641] + v[642];
+    v[644] = v[6] * v[620];
+    v[645] = v[4] * v[618];
+    v[646] = v[5] * v[617];
+    v[647] = v[7] * v[525] + v[644] + (v[645] - v[646]);
+    v[648] = v[7] * v[620];
+    v[649] = v[5] * v[618] + v[4] * v[617];
+    v[650] = v[8] * v[525] + v[648] + v[649];
+    v[651] = v[6] * v[628];
+    v[652] = v[4] * v[626];
+    v[653] = v[5] * v[625];
+    v[654] = v[7] * v[629] + v[651] + (v[652] - v[653]);
+    v[655] = v[7] * v[628];
+    v[656] = v[5] * v[626] + v[4] * v[625];
+    v[657] = v[8] * v[629] + v[655] + v[656];
+    v[658] = v[6] * v[587];
+    v[659] = v[4] * v[585];
+    v[660] = v[5] * v[584];
+    v[661] = v[7] * v[542] + v[658] + (v[659] - v[660]);
+    v[662] = v[7] * v[587];
+    v[663] = v[5] * v[585] + v[4] * v[584];
+    v[664] = v[8] * v[542] + v[662] + v[663];
+    v[665] = v[6] * v[654];
+    v[666] = v[4] * v[647];
+    v[667] = v[5] * v[640];
+    v[668] = v[6] * v[627];
+    v[669] = v[4] * v[619];
+    v[670] = v[5] * v[615];
+    v[654] = v[7] * v[654];
+    v[647] = v[5] * v[647];
+    v[640] = v[4] * v[640];
+    v[671] = v[8] * v[661] + v[654] + (v[647] + v[640]);
+    v[672] = v[7] * v[627];
+    v[673] = v[5] * v[619] + v[4] * v[615];
+    v[674] = v[8] * v[586] + v[672] + v[673];
+    v[675] = 0.0579 + (v[8] * v[664] + v[7] * v[657] + (v[5] * v[650] + v[4] * v[643]));
+    v[676] = v[6] * v[635];
+    v[677] = v[4] * v[501];
+    v[678] = v[5] * v[631];
+    v[635] = v[7] * v[635];
+    v[501] = v[5] * v[501];
+    v[631] = v[4] * v[631];
+    v[679] = x[18] + x[8] * -0.5 - (v[27] * v[32] - v[28] * v[31] + (v[8] * v[552] + v[635] + (v[501] + v[631])));
+    v[680] = v[671] / v[675];
+    v[681] = v[674] / v[675];
+    v[682] = 0.071 + (v[7] * v[661] + v[665] + (v[666] - v[667])) - v[671] * v[680];
+    v[683] = v[7] * v[586] + v[668] + (v[669] - v[670]) - v[674] * v[680];
+    v[684] = v[7] * v[624] + v[6] * v[623] + (v[4] * v[622] - v[5] * v[621]) - v[671] * v[681];
+    v[685] = 0.025 + (v[602] - v[602] * v[610]) - v[674] * v[681];
+    v[686] = v[671] * v[679] / v[675];
+    v[687] = v[686] + (v[35] - x[8] * v[32] + (v[7] * v[552] + v[676] + (v[677] - v[678])) + (v[29] * v[682] - v[30] * v[684]));
+    v[688] = v[674] * v[679] / v[675];
+    v[606] = v[688] + (x[8] * v[31] - v[34] + (v[633] + (v[606] + (v[47] * v[627] - v[48] * v[586] + (v[45] * v[615] - v[46] * v[619])))) + (v[29] * v[683] - v[30] * v[685]));
+    v[689] = v[3] * v[683] + v[2] * v[682];
+    v[690] = v[3] * v[685] + v[2] * v[684];
+    v[691] = 0.0236 + (v[3] * v[690] + v[2] * v[689]);
+    v[692] = (x[17] + x[7] * -0.5 - (v[3] * v[606] + v[2] * v[687])) / v[691];
+    y[7] = v[692];
+    v[693] = v[2] * v[692];
+    v[694] = v[3] * v[692];
+    v[695] = v[29] + v[693];
+    v[696] = v[694] - v[30];
+    v[697] = (v[679] - (v[674] * v[696] + v[671] * v[695])) / v[675];
+    y[8] = v[697];
+    v[698] = v[4] * v[697];
+    v[699] = v[5] * v[695];
+    v[700] = v[5] * v[697];
+    v[701] = v[4] * v[695];
+    v[702] = v[6] * v[695];
+    v[703] = v[7] * v[695];
+    v[704] = v[45] + (v[698] - v[699]);
+    v[705] = v[700] + v[701] - v[46];
+    v[706] = v[47] + (v[7] * v[697] + v[702]);
+    v[707] = v[8] * v[697] + v[703] - v[48];
+    v[708] = (v[607] - (v[600] * v[707] + v[603] * v[706] + (v[602] * v[696] + v[601] * v[705] + v[597] * v[704]))) / v[602];
+    y[9] = v[708];
+    v[709] = v[696] + v[708];
+    v[710] = v[9] * v[709];
+    v[711] = v[10] * v[704];
+    v[709] = v[10] * v[709];
+    v[712] = v[9] * v[704];
+    v[713] = v[10] * v[706];
+    v[714] = v[9] * v[706];
+    v[715] = 0.2155 * v[704] - v[707];
+    v[716] = v[69] + (v[710] + v[711]);
+    v[717] = v[709] - v[712] - v[70];
+    v[718] = v[71] + (v[713] + v[11] * v[705]);
+    v[719] = v[12] * v[705] - v[714] - v[72];
+    v[720] = (v[502] - (v[472] * v[715] + v[469] * v[719] + v[493] * v[718] + (v[491] * v[717] - v[492] * v[705] + v[462] * v[716]))) / v[492];
+    y[10] = v[720];
+    v[721] = v[720] - v[705];
+    v[722] = v[13] * v[721];
+    v[723] = v[14] * v[716];
+    v[724] = v[14] * v[721];
+    v[725] = v[13] * v[716];
+    v[726] = v[13] * v[715];
+    v[727] = v[14] * v[718];
+    v[728] = v[15] * v[716];
+    v[729] = v[14] * v[715];
+    v[730] = v[13] * v[718];
+    v[731] = v[16] * v[716];
+    v[732] = v[95] + (v[722] - v[723]);
+    v[733] = v[724] + v[725] - v[96];
+    v[734] = v[97] + (v[726] - v[727] + (v[16] * v[721] + v[728]));
+    v[735] = v[729] + v[730] + (v[17] * v[721] + v[731]) - v[98];
+    v[736] = (v[346] - (v[312] * v[719] + v[338] * v[735] + v[337] * v[734] + (v[336] * v[717] + v[335] * v[733] + v[308] * v[732]))) / v[336];
+    y[11] = v[736];
+    v[737] = v[717] + v[736];
+    v[738] = v[18] * v[737];
+    v[739] = v[19] * v[732];
+    v[737] = v[19] * v[737];
+    v[740] = v[18] * v[732];
+    v[741] = 0.2155 * v[732] - v[735];
+    v[742] = v[121] + (v[738] + v[739]);
+    v[743] = v[123] + (v[18] * v[719] + v[19] * v[734] + v[20] * v[733]);
+    v[744] = (v[229] - (v[208] * v[741] + v[219] * v[743] + (v[199] * v[742] - v[218] * v[733]))) / v[218];
+    y[12] = v[744];
+    y[13] = (v[163] - 0.001 * (v[737] - v[740] - v[122])) / 0.001;
+    v[122] = v[1] * v[2];
+    v[163] = v[10] * v[122];
+    v[745] = v[0] * v[4];
+    v[746] = v[1] * v[3];
+    v[747] = v[5] * v[746];
+    v[748] = v[4] * v[746];
+    v[749] = v[0] * v[5];
+    v[750] = -v[749] - v[748];
+    v[751] = v[745] - v[747];
+    v[752] = v[10] * v[751] - v[9] * v[122];
+    v[753] = v[9] * v[751];
+    v[754] = v[163] + v[753];
+    v[748] = v[748] + v[749];
+    v[749] = v[1] * 0.42;
+    v[755] = v[2] * v[749];
+    v[756] = v[1] * 0.4;
+    v[757] = v[2] * v[756];
+    v[758] = v[10] * v[757];
+    v[759] = v[3] * v[756];
+    v[760] = v[5] * v[759];
+    v[761] = v[0] * 0.4;
+    v[762] = v[4] * v[761];
+    v[763] = v[762] - v[760];
+    v[764] = v[9] * v[763];
+    v[765] = v[1] * 0.241;
+    v[766] = v[3] * v[765];
+    v[767] = v[5] * v[766];
+    v[768] = v[0] * 0.241;
+    v[769] = v[4] * v[768];
+    v[770] = v[769] - v[767];
+    v[771] = v[9] * v[770];
+    v[772] = v[2] * v[765];
+    v[773] = v[10] * v[772];
+    v[774] = v[771] + v[773];
+    v[775] = v[5] * v[768];
+    v[776] = v[1] * -0.241;
+    v[777] = v[3] * v[776];
+    v[778] = v[4] * v[777] - v[775];
+    v[779] = v[767] - v[769];
+    v[780] = v[9] * v[772];
+    v[781] = v[10] * v[779] + v[780];
+    v[782] = v[14] * v[781];
+    v[783] = v[13] * v[778] + v[782];
+    v[784] = v[18] * v[783];
+    v[785] = v[755] + (v[758] + (v[764] + (v[19] * v[774] + v[784])));
+    v[786] = v[0] * v[2];
+    v[787] = v[10] * v[786];
+    v[788] = v[1] * v[4];
+    v[789] = v[0] * v[3];
+    v[790] = v[5] * v[789];
+    v[791] = v[788] + v[790];
+    v[792] = v[9] * v[786];
+    v[793] = v[4] * v[789];
+    v[794] = v[1] * v[5];
+    v[795] = v[794] - v[793];
+    v[796] = -v[790] - v[788];
+    v[797] = v[787] + v[9] * v[796];
+    v[788] = -v[788] - v[790];
+    v[790] = v[10] * v[788] - v[792];
+    v[793] = v[793] - v[794];
+    v[794] = v[0] * 0.42;
+    v[798] = v[2] * v[794];
+    v[799] = v[2] * v[761];
+    v[800] = v[10] * v[799];
+    v[801] = v[4] * v[756];
+    v[802] = v[0] * -0.4;
+    v[803] = v[3] * v[802];
+    v[804] = v[5] * v[803] - v[801];
+    v[805] = v[3] * v[768];
+    v[806] = v[5] * v[805];
+    v[807] = v[4] * v[776] - v[806];
+    v[808] = v[9] * v[807];
+    v[768] = v[2] * v[768];
+    v[809] = v[10] * v[768];
+    v[810] = v[808] + v[809];
+    v[811] = v[4] * v[805];
+    v[812] = v[5] * v[765];
+    v[813] = v[812] - v[811];
+    v[814] = v[13] * v[813];
+    v[765] = v[4] * v[765];
+    v[815] = v[806] + v[765];
+    v[816] = v[9] * v[768];
+    v[817] = v[10] * v[815] + v[816];
+    v[818] = v[814] + v[14] * v[817];
+    v[819] = v[2] * v[5];
+    v[820] = v[3] * v[9] - v[10] * v[819];
+    v[821] = v[2] * v[4];
+    v[822] = v[3] * v[10] + v[9] * v[819];
+    v[823] = v[3] * 0.4;
+    v[824] = v[10] * v[823];
+    v[825] = v[2] * 0.4;
+    v[826] = v[5] * v[825];
+    v[827] = v[9] * v[826];
+    v[828] = v[2] * 0.241;
+    v[829] = v[5] * v[828];
+    v[830] = v[9] * v[829];
+    v[831] = v[3] * 0.241;
+    v[832] = v[10] * v[831];
+    v[833] = v[830] + v[832];
+    v[834] = v[4] * v[828];
+    v[835] = v[13] * v[834];
+    v[836] = v[10] * v[829];
+    v[837] = v[9] * v[831];
+    v[838] = v[837] - v[836];
+    v[839] = v[835] + v[14] * v[838];
+    v[840] = v[13] * v[752] + v[14] * v[750];
+    v[841] = v[14] * v[795] + v[13] * v[790];
+    v[842] = v[3] * v[761];
+    v[843] = v[5] * v[842];
+    v[801] = v[801] + v[843];
+    v[844] = v[9] * v[801];
+    v[845] = v[9] * v[815];
+    v[846] = v[845] - v[809];
+    v[847] = v[19] * v[846];
+    v[848] = v[811] - v[812];
+    v[849] = v[0] * -0.241;
+    v[850] = v[3] * v[849];
+    v[851] = v[5] * v[850] - v[765];
+    v[852] = v[10] * v[851] - v[816];
+    v[853] = v[13] * v[848] + v[14] * v[852];
+    v[854] = v[844] + (v[847] + v[18] * v[853]) - v[800] - v[798];
+    v[749] = v[3] * v[749];
+    v[855] = v[10] * v[759];
+    v[856] = v[5] * v[757];
+    v[857] = v[9] * v[856];
+    v[858] = v[5] * v[772];
+    v[859] = v[9] * v[858];
+    v[860] = v[10] * v[766];
+    v[861] = v[859] + v[860];
+    v[862] = v[19] * v[861];
+    v[772] = v[4] * v[772];
+    v[863] = v[10] * v[858];
+    v[864] = v[9] * v[766];
+    v[865] = v[864] - v[863];
+    v[866] = v[14] * v[865];
+    v[867] = v[13] * v[772] + v[866];
+    v[868] = v[749] + (v[855] + (v[857] + (v[862] + v[18] * v[867])));
+    v[761] = v[4] * v[759] + v[5] * v[761];
+    v[869] = v[9] * v[761];
+    v[766] = v[4] * v[766];
+    v[870] = v[775] + v[766];
+    v[871] = v[9] * v[870];
+    v[872] = v[19] * v[871];
+    v[873] = v[10] * v[778];
+    v[874] = v[13] * v[770] + v[14] * v[873];
+    v[875] = v[869] + (v[872] + v[18] * v[874]);
+    v[763] = v[10] * v[763];
+    v[876] = v[9] * v[757];
+    v[877] = v[10] * v[770] - v[780];
+    v[878] = v[19] * v[877];
+    v[879] = v[14] * v[774];
+    v[880] = v[763] + (v[878] + v[18] * v[879] - v[876]);
+    v[881] = v[5] * v[849] - v[766];
+    v[882] = v[14] * v[881] + v[13] * v[877];
+    v[883] = v[18] * v[882];
+    v[783] = v[19] * v[783];
+    v[779] = v[9] * v[779];
+    v[884] = v[779] - v[773];
+    v[885] = v[18] * v[884];
+    v[886] = v[783] + v[885];
+    v[794] = v[3] * v[794];
+    v[887] = v[10] * v[842];
+    v[888] = v[5] * v[799];
+    v[889] = v[9] * v[888];
+    v[890] = v[5] * v[768];
+    v[891] = v[9] * v[890];
+    v[892] = v[10] * v[805];
+    v[893] = v[891] + v[892];
+    v[768] = v[4] * v[768];
+    v[894] = v[13] * v[768];
+    v[895] = v[10] * v[890];
+    v[805] = v[9] * v[805];
+    v[896] = v[805] - v[895];
+    v[897] = v[894] + v[14] * v[896];
+    v[898] = v[794] + (v[887] + (v[889] + (v[19] * v[893] + v[18] * v[897])));
+    v[756] = v[5] * v[756];
+    v[899] = v[4] * v[842];
+    v[900] = v[899] - v[756];
+    v[901] = v[9] * v[848];
+    v[902] = v[10] * v[813];
+    v[903] = v[14] * v[902];
+    v[904] = v[13] * v[807] + v[903];
+    v[905] = v[9] * v[900] + (v[19] * v[901] + v[18] * v[904]);
+    v[906] = v[9] * v[799];
+    v[907] = v[10] * v[807] - v[816];
+    v[908] = v[14] * v[810];
+    v[909] = v[10] * v[804] + (v[19] * v[907] + v[18] * v[908] - v[906]);
+    v[910] = v[14] * v[813];
+    v[911] = v[910] + v[13] * v[907];
+    v[912] = v[18] * v[911];
+    v[913] = v[18] * v[846];
+    v[914] = v[19] * v[818] + v[913];
+    v[915] = v[5] * v[823];
+    v[916] = v[5] * v[831];
+    v[917] = v[9] * v[916];
+    v[918] = v[917] - v[10] * v[828];
+    v[831] = v[4] * v[831];
+    v[919] = v[13] * v[831];
+    v[920] = v[10] * v[916];
+    v[921] = v[2] * -0.241;
+    v[922] = v[9] * v[921] - v[920];
+    v[923] = v[919] + v[14] * v[922];
+    v[924] = v[9] * v[915] + (v[19] * v[918] + v[18] * v[923]) - v[10] * v[825] - v[2] * 0.42;
+    v[925] = v[4] * v[825];
+    v[926] = v[9] * v[834];
+    v[927] = v[10] * v[834];
+    v[928] = v[13] * v[829] + v[14] * v[927];
+    v[929] = v[18] * v[928] - v[19] * v[926] - v[9] * v[925];
+    v[837] = v[836] - v[837];
+    v[930] = v[14] * v[833];
+    v[826] = v[10] * v[826] + (v[19] * v[837] + v[18] * v[930] - v[9] * v[823]);
+    v[834] = v[14] * v[834];
+    v[931] = v[834] + v[13] * v[837];
+    v[932] = v[18] * v[931];
+    v[933] = v[3] * -0.241;
+    v[934] = v[10] * v[933] - v[830];
+    v[935] = v[19] * v[839] + v[18] * v[934];
+    v[936] = x[8] * v[0];
+    v[937] = x[8] * v[1];
+    v[938] = x[8] * v[868];
+    v[939] = -(v[898] * v[936]) - v[868] * v[937];
+    v[940] = x[9] * v[122] - v[936];
+    v[941] = x[9] * v[786];
+    v[942] = v[937] + v[941];
+    v[943] = v[937] + v[942];
+    v[944] = v[940] - v[936];
+    v[945] = v[905] * v[944] - v[875] * v[943];
+    v[946] = v[940] + x[10] * v[748];
+    v[947] = v[942] + x[10] * v[793];
+    v[942] = v[942] + v[947];
+    v[940] = v[940] + v[946];
+    v[948] = v[909] * v[940] - v[880] * v[942];
+    v[949] = v[946] + x[11] * v[754];
+    v[950] = v[947] + x[11] * v[797];
+    v[947] = v[947] + v[950];
+    v[946] = v[946] + v[949];
+    v[951] = v[912] * v[946] - v[883] * v[947];
+    v[952] = x[7] * v[854] + v[938] + x[9] * v[875] + x[10] * v[880] + x[11] * v[883] + x[12] * v[886];
+    v[953] = x[7] * v[785] + x[8] * v[898] + x[9] * v[905] + x[10] * v[909] + x[11] * v[912] + x[12] * v[914];
+    v[950] = v[950] + (v[950] + x[12] * v[841]);
+    v[949] = v[949] + (v[949] + x[12] * v[840]);
+    v[954] = v[914] * v[949] - v[886] * v[950];
+    v[955] = x[8] * v[924] + x[9] * v[929] + x[10] * v[826] + x[11] * v[932] + x[12] * v[935] + 1e-10;
+    v[956] = sqrt(v[955] * v[955] + v[953] * v[953] + v[952] * v[952]);
+    v[957] = v[952] / v[956];
+    v[958] = v[953] / v[956];
+    v[959] = v[955] / v[956];
+    v[960] = sqrt(x[16] * x[16]);
+    v[961] = x[27] * 10.;
+    v[962] = (x[26] * 2. - 1.) * (x[25] * 3.);
+    v[963] = x[25] * 601.;
+    v[964] = v[955] * v[963];
+    y[14] = v[962] * (v[952] * v[960]) / v[961] + v[957] * v[964];
+    y[15] = v[962] * (v[953] * v[960]) / v[961] + v[958] * v[964];
+    y[16] = (x[8] * v[939] + x[9] * v[945] + x[10] * v[948] + x[11] * v[951] + x[12] * v[954] + (v[744] * v[935] + (v[736] * v[932] + v[720] * v[826]) + (v[708] * v[929] + v[697] * v[924]))) * 10. + v[955] * 601. + (v[962] * (v[955] * v[960]) / v[961] + v[959] * v[964]);
+    v[965] = -0.2045 * v[5];
+    v[966] = 0.2155 * v[9];
+    v[967] = v[10] * -0.2155;
+    v[968] = -0.1845 * v[14];
+    v[969] = 0.2155 * v[18];
+    v[970] = -0.2155 * v[19];
+    v[971] = -0.081 * v[23];
+    v[972] = x[8] * v[3];
+    v[973] = x[8] * v[2];
+    v[974] = 0.071 * v[28];
+    v[975] = 0.071 * v[2];
+    v[976] = 0.025 * v[27];
+    v[977] = 0.025 * v[3];
+    v[978] = v[5] * v[28];
+    v[979] = v[4] * v[28];
+    v[36] = v[37] - v[36];
+    v[37] = v[6] * v[28];
+    v[980] = v[2] * v[6];
+    v[42] = v[42] - x[8] * v[6];
+    v[981] = v[7] * v[28];
+    v[982] = v[2] * v[7];
+    v[40] = x[8] * v[965] - v[40];
+    v[983] = x[9] * v[979];
+    v[984] = x[9] * v[36];
+    v[985] = x[9] * v[821];
+    v[986] = x[9] * v[5];
+    v[987] = x[9] * v[978];
+    v[988] = x[9] * v[819];
+    v[989] = x[9] * v[4];
+    v[990] = x[9] * v[981];
+    v[991] = x[9] * v[40];
+    v[992] = x[9] * v[982];
+    v[993] = x[9] * v[8];
+    v[994] = x[9] * v[37];
+    v[995] = x[9] * v[42];
+    v[996] = x[9] * v[980];
+    v[997] = x[9] * v[7];
+    v[998] = -0.39 * v[981] - 0.1334 * v[978];
+    v[999] = -0.39 * v[40] + 0.1334 * v[39];
+    v[1000] = -0.39 * v[982] - 0.1334 * v[819];
+    v[1001] = -0.39 * v[8] + 0.1334 * v[4];
+    v[1002] = 0.39 * v[37] + (0.1257 * v[979] - -0.0117 * v[27]);
+    v[1003] = 0.39 * v[42] + 0.1257 * v[36];
+    v[1004] = 0.39 * v[980] + (-0.0117 * v[3] + 0.1257 * v[821]);
+    v[1005] = 0.39 * v[7] + 0.1257 * v[5];
+    v[1006] = -0.09 * v[37] + (-0.0117 * v[979] - 0.0127 * v[27]);
+    v[1007] = -0.09 * v[42] + -0.0117 * v[36];
+    v[1008] = -0.09 * v[980] + (0.0127 * v[3] + -0.0117 * v[821]);
+    v[1009] = -0.09 * v[7] + -0.0117 * v[5];
+    v[1010] = 3. * v[37] + (0.39 * v[979] - -0.09 * v[27]);
+    v[1011] = 3. * v[42] + 0.39 * v[36];
+    v[1012] = 3. * v[980] + (-0.09 * v[3] + 0.39 * v[821]);
+    v[1013] = 3. * v[7] + 0.39 * v[5];
+    v[1014] = 3. * v[981] - -0.39 * v[978];
+    v[1015] = 3. * v[40] + -0.39 * v[39];
+    v[1016] = 3. * v[982] - -0.39 * v[819];
+    v[1017] = 3. * v[8] + -0.39 * v[4];
+    v[1018] = 0.09 * v[978];
+    v[1019] = 0.09 * v[39];
+    v[1020] = 0.09 * v[819];
+    v[1021] = 0.09 * v[4];
+    v[1022] = v[10] * v[39];
+    v[1023] = v[4] * v[10];
+    v[1024] = -(v[9] * v[27]) - v[10] * v[978];
+    v[1025] = v[9] * v[39];
+    v[1026] = v[4] * v[9];
+    v[1027] = v[9] * v[978] - v[10] * v[27];
+    v[59] = -v[59] - v[60];
+    v[60] = v[10] * v[37] + v[11] * v[979];
+    v[1028] = v[10] * v[42] + v[11] * v[36];
+    v[65] = -v[65] - v[39] * v[966];
+    v[1029] = v[10] * v[980] + v[11] * v[821];
+    v[1030] = v[7] * v[10] + v[5] * v[11];
+    v[1031] = v[12] * v[979] - v[9] * v[37];
+    v[1032] = v[12] * v[36] - v[9] * v[42];
+    v[63] = v[39] * v[967] - v[63];
+    v[1033] = v[12] * v[821] - v[9] * v[980];
+    v[1034] = v[5] * v[12] - v[7] * v[9];
+    v[1035] = -(0.2155 * v[978]) - v[981];
+    v[1036] = 0.2155 * v[39] - v[40];
+    v[1037] = -(0.2155 * v[819]) - v[982];
+    v[1038] = 0.2155 * v[4] - v[8];
+    v[1039] = x[10] * v[1027];
+    v[1040] = x[10] * v[1025];
+    v[1041] = x[10] * v[59];
+    v[1042] = x[10] * v[822];
+    v[1043] = x[10] * v[1026];
+    v[1044] = x[10] * v[10];
+    v[1045] = x[10] * v[1024];
+    v[1046] = x[10] * v[1022];
+    v[1047] = x[10] * v[820];
+    v[1048] = x[10] * v[1023];
+    v[1049] = x[10] * v[9];
+    v[1050] = x[10] * v[1031];
+    v[1051] = x[10] * v[1032];
+    v[1052] = x[10] * v[63];
+    v[1053] = x[10] * v[1033];
+    v[1054] = x[10] * v[1034];
+    v[1055] = x[10] * v[60];
+    v[1056] = x[10] * v[1028];
+    v[1057] = x[10] * v[65];
+    v[1058] = x[10] * v[1029];
+    v[1059] = x[10] * v[1030];
+    v[1060] = 0.0452 * v[9];
+    v[1061] = 0.1809 * v[1035] + -0.0918 * v[1031] + 0.0452 * v[1024];
+    v[1062] = 0.1809 * v[1036] + -0.0918 * v[1032] + 0.0452 * v[1022];
+    v[1063] = -0.0918 * v[63] + 0.0452 * v[62];
+    v[1064] = 0.1809 * v[1037] + -0.0918 * v[1033] + 0.0452 * v[820];
+    v[1065] = 0.1809 * v[1038] + -0.0918 * v[1034] + 0.0452 * v[1023];
+    v[1066] = 0.0131 * v[10];
+    v[1067] = 0.0918 * v[60] + (0.0131 * v[1027] - -0.0061 * v[979]);
+    v[1068] = 0.0918 * v[1028] + (-(-0.0061 * v[36]) - 0.0131 * v[1025]);
+    v[1069] = 0.0918 * v[65] + 0.0131 * v[59];
+    v[1070] = 0.0918 * v[1029] + (0.0131 * v[822] - -0.0061 * v[821]);
+    v[1071] = 0.0918 * v[1030] + (-(-0.0061 * v[5]) - 0.0131 * v[1026]);
+    v[1072] = -0.0061 * v[10];
+    v[1073] = -0.1809 * v[60] + (-0.0061 * v[1027] - 0.0411 * v[979]);
+    v[1074] = -0.1809 * v[1028] + (-(0.0411 * v[36]) - -0.0061 * v[1025]);
+    v[1075] = -0.1809 * v[65] + -0.0061 * v[59];
+    v[1076] = -0.1809 * v[1029] + (-0.0061 * v[822] - 0.0411 * v[821]);
+    v[1077] = -0.1809 * v[1030] + (-(0.0411 * v[5]) - -0.0061 * v[1026]);
+    v[1078] = 0.0918 * v[10];
+    v[1079] = 2.7 * v[60] + (0.0918 * v[1027] - -0.1809 * v[979]);
+    v[1080] = 2.7 * v[1028] + (-(-0.1809 * v[36]) - 0.0918 * v[1025]);
+    v[1081] = 2.7 * v[65] + 0.0918 * v[59];
+    v[1082] = 2.7 * v[1029] + (0.0918 * v[822] - -0.1809 * v[821]);
+    v[1083] = 2.7 * v[1030] + (-(-0.1809 * v[5]) - 0.0918 * v[1026]);
+    v[1084] = -0.0918 * v[9];
+    v[1085] = 2.7 * v[1031] + -0.0918 * v[1024];
+    v[1086] = 2.7 * v[1032] + -0.0918 * v[1022];
+    v[1087] = 2.7 * v[63] + -0.0918 * v[62];
+    v[1088] = 2.7 * v[1033] + -0.0918 * v[820];
+    v[1089] = 2.7 * v[1034] + -0.0918 * v[1023];
+    v[1090] = 0.1809 * v[62];
+    v[1091] = 0.1809 * v[9];
+    v[1092] = 2.7 * v[1035] + 0.1809 * v[1024];
+    v[1093] = 2.7 * v[1036] + 0.1809 * v[1022];
+    v[1094] = 2.7 * v[1037] + 0.1809 * v[820];
+    v[1095] = 2.7 * v[1038] + 0.1809 * v[1023];
+    v[1096] = v[14] * v[62];
+    v[1097] = v[9] * v[14];
+    v[1098] = -(v[13] * v[979]) - v[14] * v[1024];
+    v[1099] = -(v[13] * v[36]) - v[14] * v[1022];
+    v[1100] = -(v[13] * v[821]) - v[14] * v[820];
+    v[1101] = -(v[5] * v[13]) - v[14] * v[1023];
+    v[1102] = v[13] * v[62];
+    v[1103] = v[9] * v[13];
+    v[1104] = v[13] * v[1024] - v[14] * v[979];
+    v[1105] = v[13] * v[1022] - v[14] * v[36];
+    v[83] = v[84] - v[83];
+    v[84] = v[13] * v[820] - v[14] * v[821];
+    v[1106] = v[13] * v[1023] - v[5] * v[14];
+    v[1107] = v[9] * v[15];
+    v[1108] = v[13] * v[1035] - v[14] * v[60] + (v[15] * v[1024] - v[16] * v[979]);
+    v[1109] = v[13] * v[1036] - v[14] * v[1028] + (v[15] * v[1022] - v[16] * v[36]);
+    v[1110] = v[15] * v[62] - v[14] * v[65];
+    v[91] = v[91] + (v[92] - v[15] * v[68]);
+    v[92] = v[13] * v[1037] - v[14] * v[1029] + (v[15] * v[820] - v[16] * v[821]);
+    v[1111] = v[13] * v[1038] - v[14] * v[1030] + (v[15] * v[1023] - v[5] * v[16]);
+    v[1112] = v[9] * v[16];
+    v[1113] = v[14] * v[1035] + v[13] * v[60] + (v[16] * v[1024] - v[17] * v[979]);
+    v[1114] = v[14] * v[1036] + v[13] * v[1028] + (v[16] * v[1022] - v[17] * v[36]);
+    v[1115] = v[13] * v[65] + v[16] * v[62];
+    v[87] = v[88] - v[87] + (v[68] * v[968] - v[89]);
+    v[88] = v[14] * v[1037] + v[13] * v[1029] + (v[16] * v[820] - v[17] * v[821]);
+    v[89] = v[14] * v[1038] + v[13] * v[1030] + (v[16] * v[1023] - v[5] * v[17]);
+    v[1116] = x[11] * v[1104];
+    v[1117] = x[11] * v[1105];
+    v[1118] = x[11] * v[1102];
+    v[1119] = x[11] * v[83];
+    v[1120] = x[11] * v[84];
+    v[1121] = x[11] * v[1106];
+    v[1122] = x[11] * v[1103];
+    v[1123] = x[11] * v[14];
+    v[1124] = x[11] * v[1098];
+    v[1125] = x[11] * v[1099];
+    v[1126] = x[11] * v[1096];
+    v[1127] = x[11] * v[1100];
+    v[1128] = x[11] * v[1101];
+    v[1129] = x[11] * v[1097];
+    v[1130] = x[11] * v[13];
+    v[1131] = x[11] * v[1113];
+    v[1132] = x[11] * v[1114];
+    v[1133] = x[11] * v[1115];
+    v[1134] = x[11] * v[87];
+    v[1135] = x[11] * v[88];
+    v[1136] = x[11] * v[89];
+    v[1137] = x[11] * v[1112];
+    v[1138] = x[11] * v[17];
+    v[1139] = x[11] * v[1108];
+    v[1140] = x[11] * v[1109];
+    v[1141] = x[11] * v[1110];
+    v[1142] = x[11] * v[91];
+    v[1143] = x[11] * v[92];
+    v[1144] = x[11] * v[1111];
+    v[1145] = x[11] * v[1107];
+    v[1146] = x[11] * v[16];
+    v[1147] = 0.0357 * v[1031] + -0.1292 * v[1113] + 0.0306 * v[1098];
+    v[1148] = 0.0357 * v[1032] + -0.1292 * v[1114] + 0.0306 * v[1099];
+    v[1149] = 0.0357 * v[63] + -0.1292 * v[1115] - 0.0306 * v[1096];
+    v[1150] = -0.1292 * v[87] + 0.0306 * v[86];
+    v[1151] = 0.0357 * v[1033] + -0.1292 * v[88] + 0.0306 * v[1100];
+    v[1152] = 0.0357 * v[1034] + -0.1292 * v[89] + 0.0306 * v[1101];
+    v[1153] = -0.1292 * v[1112] - 0.0306 * v[1097];
+    v[1154] = -0.1292 * v[17] + 0.0306 * v[13];
+    v[1155] = -0.00017 * v[1031] + 0.1292 * v[1108] + (-0.0027 * v[1027] + 0.0279 * v[1104]);
+    v[1156] = -0.00017 * v[1032] + 0.1292 * v[1109] + (0.0279 * v[1105] - -0.0027 * v[1025]);
+    v[1157] = -0.00017 * v[63] + 0.1292 * v[1110] + (-0.0027 * v[59] + 0.0279 * v[1102]);
+    v[1158] = 0.1292 * v[91] + 0.0279 * v[83];
+    v[1159] = -0.00017 * v[1033] + 0.1292 * v[92] + (-0.0027 * v[822] + 0.0279 * v[84]);
+    v[1160] = -0.00017 * v[1034] + 0.1292 * v[1111] + (0.0279 * v[1106] - -0.0027 * v[1026]);
+    v[1161] = 0.1292 * v[1107] + (-0.0027 * v[10] + 0.0279 * v[1103]);
+    v[1162] = 0.1292 * v[16] + 0.0279 * v[14];
+    v[1163] = 0.00017 * v[1113] + -0.0357 * v[1108] + (0.0058 * v[1027] + -0.0027 * v[1104]);
+    v[1164] = 0.00017 * v[1114] + -0.0357 * v[1109] + (-0.0027 * v[1105] - 0.0058 * v[1025]);
+    v[1165] = 0.00017 * v[1115] + -0.0357 * v[1110] + (0.0058 * v[59] + -0.0027 * v[1102]);
+    v[1166] = 0.00017 * v[87] + -0.0357 * v[91] + -0.0027 * v[83];
+    v[1167] = 0.00017 * v[88] + -0.0357 * v[92] + (0.0058 * v[822] + -0.0027 * v[84]);
+    v[1168] = 0.00017 * v[89] + -0.0357 * v[1111] + (-0.0027 * v[1106] - 0.0058 * v[1026]);
+    v[1169] = 0.00017 * v[1112] + -0.0357 * v[1107] + (0.0058 * v[10] + -0.0027 * v[1103]);
+    v[1170] = 0.00017 * v[17] + -0.0357 * v[16] + -0.0027 * v[14];
+    v[1171] = 1.7 * v[1108] + (-0.0357 * v[1027] + 0.1292 * v[1104]);
+    v[1172] = 1.7 * v[1109] + (0.1292 * v[1105] - -0.0357 * v[1025]);
+    v[1173] = 1.7 * v[1110] + (-0.0357 * v[59] + 0.1292 * v[1102]);
+    v[1174] = 1.7 * v[91] + 0.1292 * v[83];
+    v[1175] = 1.7 * v[92] + (-0.0357 * v[822] + 0.1292 * v[84]);
+    v[1176] = 1.7 * v[1111] + (0.1292 * v[1106] - -0.0357 * v[1026]);
+    v[1177] = 1.7 * v[1107] + (-0.0357 * v[10] + 0.1292 * v[1103]);
+    v[1178] = 1.7 * v[16] + 0.1292 * v[14];
+    v[1179] = 1.7 * v[1113] + (0.00017 * v[1027] + -0.1292 * v[1098]);
+    v[1180] = 1.7 * v[1114] + (-0.1292 * v[1099] - 0.00017 * v[1025]);
+    v[1181] = 1.7 * v[1115] + (0.00017 * v[59] - -0.1292 * v[1096]);
+    v[1182] = 1.7 * v[87] + -0.1292 * v[86];
+    v[1183] = 1.7 * v[88] + (0.00017 * v[822] + -0.1292 * v[1100]);
+    v[1184] = 1.7 * v[89] + (-0.1292 * v[1101] - 0.00017 * v[1026]);
+    v[1185] = 1.7 * v[1112] + (0.00017 * v[10] - -0.1292 * v[1097]);
+    v[1186] = 1.7 * v[17] + -0.1292 * v[13];
+    v[1187] = -0.00017 * v[83] + 0.0357 * v[86];
+    v[1188] = -0.00017 * v[1103] - 0.0357 * v[1097];
+    v[1189] = -0.00017 * v[14] + 0.0357 * v[13];
+    v[1190] = 1.7 * v[1031] + (-0.00017 * v[1104] + 0.0357 * v[1098]);
+    v[1191] = 1.7 * v[1032] + (-0.00017 * v[1105] + 0.0357 * v[1099]);
+    v[1192] = 1.7 * v[63] + (-0.00017 * v[1102] - 0.0357 * v[1096]);
+    v[1193] = 1.7 * v[1033] + (-0.00017 * v[84] + 0.0357 * v[1100]);
+    v[1194] = 1.7 * v[1034] + (-0.00017 * v[1106] + 0.0357 * v[1101]);
+    v[1195] = v[19] * v[86];
+    v[1196] = v[13] * v[19];
+    v[1197] = v[18] * v[1027] + v[19] * v[1098];
+    v[1198] = v[19] * v[1099] - v[18] * v[1025];
+    v[1199] = v[18] * v[59] - v[19] * v[1096];
+    v[1200] = v[18] * v[822] + v[19] * v[1100];
+    v[1201] = v[19] * v[1101] - v[18] * v[1026];
+    v[1202] = v[10] * v[18] - v[19] * v[1097];
+    v[1203] = v[18] * v[86];
+    v[1204] = v[13] * v[18];
+    v[1205] = v[19] * v[1027] - v[18] * v[1098];
+    v[1206] = -(v[19] * v[1025]) - v[18] * v[1099];
+    v[1207] = v[19] * v[59] + v[18] * v[1096];
+    v[110] = -v[110] - v[111];
+    v[111] = v[19] * v[822] - v[18] * v[1100];
+    v[1208] = -(v[19] * v[1026]) - v[18] * v[1101];
+    v[1209] = v[10] * v[19] + v[18] * v[1097];
+    v[1210] = v[18] * v[1031] + v[19] * v[1108] + v[20] * v[1104];
+    v[1211] = v[18] * v[1032] + v[19] * v[1109] + v[20] * v[1105];
+    v[1212] = v[18] * v[63] + v[19] * v[1110] + v[20] * v[1102];
+    v[1213] = v[19] * v[91] + v[20] * v[83];
+    v[117] = v[117] - v[86] * v[969];
+    v[1214] = v[18] * v[1033] + v[19] * v[92] + v[20] * v[84];
+    v[1215] = v[18] * v[1034] + v[19] * v[1111] + v[20] * v[1106];
+    v[1216] = v[19] * v[1107] + v[20] * v[1103];
+    v[1217] = v[16] * v[19] + v[14] * v[20];
+    v[1218] = v[19] * v[1031] - v[18] * v[1108] + v[21] * v[1104];
+    v[1219] = v[19] * v[1032] - v[18] * v[1109] + v[21] * v[1105];
+    v[1220] = v[19] * v[63] - v[18] * v[1110] + v[21] * v[1102];
+    v[1221] = v[21] * v[83] - v[18] * v[91];
+    v[114] = -v[114] - v[115] + v[86] * v[970];
+    v[115] = v[19] * v[1033] - v[18] * v[92] + v[21] * v[84];
+    v[1222] = v[19] * v[1034] - v[18] * v[1111] + v[21] * v[1106];
+    v[1223] = v[21] * v[1103] - v[18] * v[1107];
+    v[1224] = v[14] * v[21] - v[16] * v[18];
+    v[1225] = 0.2155 * v[1098] - v[1113];
+    v[1226] = 0.2155 * v[1099] - v[1114];
+    v[1227] = -(0.2155 * v[1096]) - v[1115];
+    v[1228] = 0.2155 * v[86] - v[87];
+    v[1229] = 0.2155 * v[1100] - v[88];
+    v[1230] = 0.2155 * v[1101] - v[89];
+    v[1231] = -(0.2155 * v[1097]) - v[1112];
+    v[1232] = 0.2155 * v[13] - v[17];
+    v[1233] = x[12] * v[1205];
+    v[1234] = x[12] * v[1206];
+    v[1235] = x[12] * v[1207];
+    v[1236] = x[12] * v[1203];
+    v[1237] = x[12] * v[110];
+    v[1238] = x[12] * v[111];
+    v[1239] = x[12] * v[1208];
+    v[1240] = x[12] * v[1209];
+    v[1241] = x[12] * v[1204];
+    v[1242] = x[12] * v[19];
+    v[1243] = x[12] * v[1197];
+    v[1244] = x[12] * v[1198];
+    v[1245] = x[12] * v[1199];
+    v[1246] = x[12] * v[1195];
+    v[1247] = x[12] * v[1200];
+    v[1248] = x[12] * v[1201];
+    v[1249] = x[12] * v[1202];
+    v[1250] = x[12] * v[1196];
+    v[1251] = x[12] * v[18];
+    v[1252] = x[12] * v[1218];
+    v[1253] = x[12] * v[1219];
+    v[1254] = x[12] * v[1220];
+    v[1255] = x[12] * v[1221];
+    v[1256] = x[12] * v[114];
+    v[1257] = x[12] * v[115];
+    v[1258] = x[12] * v[1222];
+    v[1259] = x[12] * v[1223];
+    v[1260] = x[12] * v[1224];
+    v[1261] = x[12] * v[1210];
+    v[1262] = x[12] * v[1211];
+    v[1263] = x[12] * v[1212];
+    v[1264] = x[12] * v[1213];
+    v[1265] = x[12] * v[117];
+    v[1266] = x[12] * v[1214];
+    v[1267] = x[12] * v[1215];
+    v[1268] = x[12] * v[1216];
+    v[1269] = x[12] * v[1217];
+    v[1270] = 0.0005 * v[18];
+    v[1271] = 0.00108 * v[1225] + -0.00072 * v[1218] + 0.0005 * v[1197];
+    v[1272] = 0.00108 * v[1226] + -0.00072 * v[1219] + 0.0005 * v[1198];
+    v[1273] = 0.00108 * v[1227] + -0.00072 * v[1220] + 0.0005 * v[1199];
+    v[1274] = 0.00108 * v[1228] + -0.00072 * v[1221] + 0.0005 * v[1195];
+    v[1275] = -0.00072 * v[114] + 0.0005 * v[113];
+    v[1276] = 0.00108 * v[1229] + -0.00072 * v[115] + 0.0005 * v[1200];
+    v[1277] = 0.00108 * v[1230] + -0.00072 * v[1222] + 0.0005 * v[1201];
+    v[1278] = 0.00108 * v[1231] + -0.00072 * v[1223] + 0.0005 * v[1202];
+    v[1279] = 0.00108 * v[1232] + -0.00072 * v[1224] + 0.0005 * v[1196];
+    v[1280] = 0.00072 * v[1210] + 0.0036 * v[1205];
+    v[1281] = 0.00072 * v[1211] + 0.0036 * v[1206];
+    v[1282] = 0.00072 * v[1212] + 0.0036 * v[1207];
+    v[1283] = 0.00072 * v[1213] - 0.0036 * v[1203];
+    v[1284] = 0.00072 * v[117] + 0.0036 * v[110];
+    v[1285] = 0.00072 * v[1214] + 0.0036 * v[111];
+    v[1286] = 0.00072 * v[1215] + 0.0036 * v[1208];
+    v[1287] = 0.00072 * v[1216] + 0.0036 * v[1209];
+    v[1288] = 0.00072 * v[1217] - 0.0036 * v[1204];
+    v[1289] = -0.00108 * v[117];
+    v[1290] = -0.00108 * v[1210] - 0.0047 * v[1104];
+    v[1291] = -0.00108 * v[1211] - 0.0047 * v[1105];
+    v[1292] = -0.00108 * v[1212] - 0.0047 * v[1102];
+    v[1293] = -0.00108 * v[1213] - 0.0047 * v[83];
+    v[1294] = -0.00108 * v[1214] - 0.0047 * v[84];
+    v[1295] = -0.00108 * v[1215] - 0.0047 * v[1106];
+    v[1296] = -0.00108 * v[1216] - 0.0047 * v[1103];
+    v[1297] = -0.00108 * v[1217] - 0.0047 * v[14];
+    v[1298] = 1.8 * v[1210] + (0.00072 * v[1205] - -0.00108 * v[1104]);
+    v[1299] = 1.8 * v[1211] + (0.00072 * v[1206] - -0.00108 * v[1105]);
+    v[1300] = 1.8 * v[1212] + (0.00072 * v[1207] - -0.00108 * v[1102]);
+    v[1301] = 1.8 * v[1213] + (-(-0.00108 * v[83]) - 0.00072 * v[1203]);
+    v[1302] = 1.8 * v[117] + 0.00072 * v[110];
+    v[1303] = 1.8 * v[1214] + (0.00072 * v[111] - -0.00108 * v[84]);
+    v[1304] = 1.8 * v[1215] + (0.00072 * v[1208] - -0.00108 * v[1106]);
+    v[1305] = 1.8 * v[1216] + (0.00072 * v[1209] - -0.00108 * v[1103]);
+    v[1306] = 1.8 * v[1217] + (-(-0.00108 * v[14]) - 0.00072 * v[1204]);
+    v[1307] = -0.00072 * v[113];
+    v[1308] = 1.8 * v[1218] + -0.00072 * v[1197];
+    v[1309] = 1.8 * v[1219] + -0.00072 * v[1198];
+    v[1310] = 1.8 * v[1220] + -0.00072 * v[1199];
+    v[1311] = 1.8 * v[1221] + -0.00072 * v[1195];
+    v[1312] = 1.8 * v[114] + v[1307];
+    v[1313] = 1.8 * v[115] + -0.00072 * v[1200];
+    v[1314] = 1.8 * v[1222] + -0.00072 * v[1201];
+    v[1315] = 1.8 * v[1223] + -0.00072 * v[1202];
+    v[1316] = 1.8 * v[1224] + -0.00072 * v[1196];
+    v[1317] = 0.00108 * v[113];
+    v[1318] = 0.00108 * v[18];
+    v[1319] = 1.8 * v[1225] + 0.00108 * v[1197];
+    v[1320] = 1.8 * v[1226] + 0.00108 * v[1198];
+    v[1321] = 1.8 * v[1227] + 0.00108 * v[1199];
+    v[1322] = 1.8 * v[1228] + 0.00108 * v[1195];
+    v[1323] = 1.8 * v[1229] + 0.00108 * v[1200];
+    v[1324] = 1.8 * v[1230] + 0.00108 * v[1201];
+    v[1325] = 1.8 * v[1231] + 0.00108 * v[1202];
+    v[1326] = 1.8 * v[1232] + 0.00108 * v[1196];
+    v[1327] = v[23] * v[113];
+    v[1328] = v[18] * v[23];
+    v[1329] = -(v[22] * v[1104]) - v[23] * v[1197];
+    v[1330] = -(v[22] * v[1105]) - v[23] * v[1198];
+    v[1331] = -(v[22] * v[1102]) - v[23] * v[1199];
+    v[1332] = -(v[22] * v[83]) - v[23] * v[1195];
+    v[1333] = -(v[22] * v[84]) - v[23] * v[1200];
+    v[1334] = -(v[22] * v[1106]) - v[23] * v[1201];
+    v[1335] = -(v[22] * v[1103]) - v[23] * v[1202];
+    v[1336] = -(v[14] * v[22]) - v[23] * v[1196];
+    v[1337] = v[22] * v[113];
+    v[1338] = v[18] * v[22];
+    v[1339] = v[22] * v[1197] - v[23] * v[1104];
+    v[1340] = v[22] * v[1198] - v[23] * v[1105];
+    v[1341] = v[22] * v[1199] - v[23] * v[1102];
+    v[1342] = v[22] * v[1195] - v[23] * v[83];
+    v[134] = v[135] - v[134];
+    v[135] = v[22] * v[1200] - v[23] * v[84];
+    v[1343] = v[22] * v[1201] - v[23] * v[1106];
+    v[1344] = v[22] * v[1202] - v[23] * v[1103];
+    v[1345] = v[22] * v[1196] - v[14] * v[23];
+    v[1346] = v[18] * v[24];
+    v[1347] = v[22] * v[1225] - v[23] * v[1210] + (v[24] * v[1197] - v[25] * v[1104]);
+    v[1348] = v[22] * v[1226] - v[23] * v[1211] + (v[24] * v[1198] - v[25] * v[1105]);
+    v[1349] = v[22] * v[1227] - v[23] * v[1212] + (v[24] * v[1199] - v[25] * v[1102]);
+    v[1350] = v[22] * v[1228] - v[23] * v[1213] + (v[24] * v[1195] - v[25] * v[83]);
+    v[1351] = v[24] * v[113] - v[23] * v[117];
+    v[142] = v[142] + (v[143] - v[24] * v[120]);
+    v[143] = v[22] * v[1229] - v[23] * v[1214] + (v[24] * v[1200] - v[25] * v[84]);
+    v[1352] = v[22] * v[1230] - v[23] * v[1215] + (v[24] * v[1201] - v[25] * v[1106]);
+    v[1353] = v[22] * v[1231] - v[23] * v[1216] + (v[24] * v[1202] - v[25] * v[1103]);
+    v[1354] = v[22] * v[1232] - v[23] * v[1217] + (v[24] * v[1196] - v[14] * v[25]);
+    v[1355] = v[18] * v[25];
+    v[1356] = v[23] * v[1225] + v[22] * v[1210] + (v[25] * v[1197] - v[26] * v[1104]);
+    v[1357] = v[23] * v[1226] + v[22] * v[1211] + (v[25] * v[1198] - v[26] * v[1105]);
+    v[1358] = v[23] * v[1227] + v[22] * v[1212] + (v[25] * v[1199] - v[26] * v[1102]);
+    v[1359] = v[23] * v[1228] + v[22] * v[1213] + (v[25] * v[1195] - v[26] * v[83]);
+    v[1360] = v[22] * v[117] + v[25] * v[113];
+    v[138] = v[139] - v[138] + (v[120] * v[971] - v[140]);
+    v[139] = v[23] * v[1229] + v[22] * v[1214] + (v[25] * v[1200] - v[26] * v[84]);
+    v[140] = v[23] * v[1230] + v[22] * v[1215] + (v[25] * v[1201] - v[26] * v[1106]);
+    v[1361] = v[23] * v[1231] + v[22] * v[1216] + (v[25] * v[1202] - v[26] * v[1103]);
+    v[1362] = v[23] * v[1232] + v[22] * v[1217] + (v[25] * v[1196] - v[14] * v[26]);
+    v[1363] = x[13] * v[1339];
+    v[1364] = x[13] * v[1340];
+    v[1365] = x[13] * v[1341];
+    v[1366] = x[13] * v[1342];
+    v[1367] = x[13] * v[1337];
+    v[1368] = x[13] * v[134];
+    v[1369] = x[13] * v[135];
+    v[1370] = x[13] * v[1343];
+    v[1371] = x[13] * v[1344];
+    v[1372] = x[13] * v[1345];
+    v[1373] = x[13] * v[1338];
+    v[1374] = x[13] * v[23];
+    v[1375] = x[13] * v[1329];
+    v[1376] = x[13] * v[1330];
+    v[1377] = x[13] * v[1331];
+    v[1378] = x[13] * v[1332];
+    v[1379] = x[13] * v[1327];
+    v[1380] = x[13] * v[1333];
+    v[1381] = x[13] * v[1334];
+    v[1382] = x[13] * v[1335];
+    v[1383] = x[13] * v[1336];
+    v[1384] = x[13] * v[1328];
+    v[1385] = x[13] * v[22];
+    v[1386] = x[13] * v[1356];
+    v[1387] = x[13] * v[1357];
+    v[1388] = x[13] * v[1358];
+    v[1389] = x[13] * v[1359];
+    v[1390] = x[13] * v[1360];
+    v[1391] = x[13] * v[138];
+    v[1392] = x[13] * v[139];
+    v[1393] = x[13] * v[140];
+    v[1394] = x[13] * v[1361];
+    v[1395] = x[13] * v[1362];
+    v[1396] = x[13] * v[1355];
+    v[1397] = x[13] * v[26];
+    v[1398] = x[13] * v[1347];
+    v[1399] = x[13] * v[1348];
+    v[1400] = x[13] * v[1349];
+    v[1401] = x[13] * v[1350];
+    v[1402] = x[13] * v[1351];
+    v[1403] = x[13] * v[142];
+    v[1404] = x[13] * v[143];
+    v[1405] = x[13] * v[1352];
+    v[1406] = x[13] * v[1353];
+    v[1407] = x[13] * v[1354];
+    v[1408] = x[13] * v[1346];
+    v[1409] = x[13] * v[25];
+    v[1410] = -0.006 * v[1356] + 0.001 * v[1329];
+    v[1411] = -0.006 * v[1357] + 0.001 * v[1330];
+    v[1412] = -0.006 * v[1358] + 0.001 * v[1331];
+    v[1413] = -0.006 * v[1359] + 0.001 * v[1332];
+    v[1414] = -0.006 * v[1360] - 0.001 * v[1327];
+    v[1415] = v[152] + -0.006 * v[138];
+    v[1416] = -0.006 * v[139] + 0.001 * v[1333];
+    v[1417] = -0.006 * v[140] + 0.001 * v[1334];
+    v[1418] = -0.006 * v[1361] + 0.001 * v[1335];
+    v[1419] = -0.006 * v[1362] + 0.001 * v[1336];
+    v[1420] = -0.006 * v[1355] - 0.001 * v[1328];
+    v[1421] = 0.006 * v[1347] + 0.001 * v[1339];
+    v[1422] = 0.006 * v[1348] + 0.001 * v[1340];
+    v[1423] = 0.006 * v[1349] + 0.001 * v[1341];
+    v[1424] = 0.006 * v[1350] + 0.001 * v[1342];
+    v[1425] = 0.006 * v[1351] + 0.001 * v[1337];
+    v[1426] = 0.006 * v[142] + 0.001 * v[134];
+    v[1427] = 0.006 * v[143] + 0.001 * v[135];
+    v[1428] = 0.006 * v[1352] + 0.001 * v[1343];
+    v[1429] = 0.006 * v[1353] + 0.001 * v[1344];
+    v[1430] = 0.006 * v[1354] + 0.001 * v[1345];
+    v[1431] = 0.006 * v[1346] + 0.001 * v[1338];
+    v[1432] = 0.001 * v[1205];
+    v[1433] = 0.001 * v[1206];
+    v[1434] = 0.001 * v[1207];
+    v[1435] = 0.001 * v[1203];
+    v[1436] = 0.001 * v[110];
+    v[1437] = 0.001 * v[111];
+    v[1438] = 0.001 * v[1208];
+    v[1439] = 0.001 * v[1209];
+    v[1440] = 0.001 * v[1204];
+    v[1441] = 0.001 * v[19];
+    v[1442] = 0.3 * v[1347] + 0.006 * v[1339];
+    v[1443] = 0.3 * v[1348] + 0.006 * v[1340];
+    v[1444] = 0.3 * v[1349] + 0.006 * v[1341];
+    v[1445] = 0.3 * v[1350] + 0.006 * v[1342];
+    v[1446] = 0.3 * v[1351] + 0.006 * v[1337];
+    v[1447] = 0.3 * v[142] + 0.006 * v[134];
+    v[1448] = 0.3 * v[143] + 0.006 * v[135];
+    v[1449] = 0.3 * v[1352] + 0.006 * v[1343];
+    v[1450] = 0.3 * v[1353] + 0.006 * v[1344];
+    v[1451] = 0.3 * v[1354] + 0.006 * v[1345];
+    v[1452] = 0.3 * v[1346] + 0.006 * v[1338];
+    v[1453] = -0.006 * v[137];
+    v[1454] = 0.3 * v[1356] + -0.006 * v[1329];
+    v[1455] = 0.3 * v[1357] + -0.006 * v[1330];
+    v[1456] = 0.3 * v[1358] + -0.006 * v[1331];
+    v[1457] = 0.3 * v[1359] + -0.006 * v[1332];
+    v[1458] = 0.3 * v[1360] - -0.006 * v[1327];
+    v[1459] = 0.3 * v[138] + v[1453];
+    v[1460] = 0.3 * v[139] + -0.006 * v[1333];
+    v[1461] = 0.3 * v[140] + -0.006 * v[1334];
+    v[1462] = 0.3 * v[1361] + -0.006 * v[1335];
+    v[1463] = 0.3 * v[1362] + -0.006 * v[1336];
+    v[1464] = 0.3 * v[1355] - -0.006 * v[1328];
+    v[1465] = 0.3 * v[1218];
+    v[1466] = 0.3 * v[1219];
+    v[1467] = 0.3 * v[1220];
+    v[1468] = 0.3 * v[1221];
+    v[1469] = 0.3 * v[114];
+    v[1470] = 0.3 * v[115];
+    v[1471] = 0.3 * v[1222];
+    v[1472] = 0.3 * v[1223];
+    v[1473] = 0.3 * v[1224];
+    v[1474] = v[158] * v[1347] + v[141] * v[1454] - (v[156] * v[1356] + v[144] * v[1442]) + (v[153] * v[1329] + v[136] * v[1421] - (v[151] * v[1339] + v[137] * v[1410]));
+    v[1475] = v[158] * v[1348] + v[141] * v[1455] - (v[156] * v[1357] + v[144] * v[1443]) + (v[153] * v[1330] + v[136] * v[1422] - (v[151] * v[1340] + v[137] * v[1411]));
+    v[1476] = v[158] * v[1349] + v[141] * v[1456] - (v[156] * v[1358] + v[144] * v[1444]) + (v[153] * v[1331] + v[136] * v[1423] - (v[151] * v[1341] + v[137] * v[1412]));
+    v[1477] = v[158] * v[1350] + v[141] * v[1457] - (v[156] * v[1359] + v[144] * v[1445]) + (v[153] * v[1332] + v[136] * v[1424] - (v[151] * v[1342] + v[137] * v[1413]));
+    v[1478] = v[158] * v[1351] + v[141] * v[1458] - (v[156] * v[1360] + v[144] * v[1446]) + (v[136] * v[1425] - v[153] * v[1327] - (v[151] * v[1337] + v[137] * v[1414]));
+    v[1479] = v[158] * v[142] + v[141] * v[1459] - (v[156] * v[138] + v[144] * v[1447]) + (v[137] * v[153] + v[136] * v[1426] - (v[151] * v[134] + v[137] * v[1415]));
+    v[1480] = v[158] * v[143] + v[141] * v[1460] - (v[156] * v[139] + v[144] * v[1448]) + (v[153] * v[1333] + v[136] * v[1427] - (v[151] * v[135] + v[137] * v[1416]));
+    v[1481] = v[158] * v[1352] + v[141] * v[1461] - (v[156] * v[140] + v[144] * v[1449]) + (v[153] * v[1334] + v[136] * v[1428] - (v[151] * v[1343] + v[137] * v[1417]));
+    v[1482] = v[158] * v[1353] + v[141] * v[1462] - (v[156] * v[1361] + v[144] * v[1450]) + (v[153] * v[1335] + v[136] * v[1429] - (v[151] * v[1344] + v[137] * v[1418]));
+    v[1483] = v[158] * v[1354] + v[141] * v[1463] - (v[156] * v[1362] + v[144] * v[1451]) + (v[153] * v[1336] + v[136] * v[1430] - (v[151] * v[1345] + v[137] * v[1419]));
+    v[1484] = v[158] * v[1346] + v[141] * v[1464] - (v[156] * v[1355] + v[144] * v[1452]) + (v[136] * v[1431] - v[153] * v[1328] - (v[151] * v[1338] + v[137] * v[1420]));
+    v[1485] = v[25] * v[158] + v[141] * v[183] - (v[26] * v[156] + v[144] * v[180]) + (v[22] * v[153] + v[136] * v[174] - (v[23] * v[151] + v[137] * v[169]));
+    v[1486] = v[137] * v[158] + v[136] * v[1459] - (v[156] * v[134] + v[137] * v[1447]);
+    v[1356] = v[159] * v[1356] + v[144] * v[1465] - (v[158] * v[1218] + v[118] * v[1454]) + (v[154] * v[1339] + v[137] * v[1432] - (v[153] * v[1205] + v[145] * v[1421])) + (0.001 * v[1363] - -0.006 * v[1398]);
+    v[1357] = v[159] * v[1357] + v[144] * v[1466] - (v[158] * v[1219] + v[118] * v[1455]) + (v[154] * v[1340] + v[137] * v[1433] - (v[153] * v[1206] + v[145] * v[1422])) + (0.001 * v[1364] - -0.006 * v[1399]);
+    v[1358] = v[159] * v[1358] + v[144] * v[1467] - (v[158] * v[1220] + v[118] * v[1456]) + (v[154] * v[1341] + v[137] * v[1434] - (v[153] * v[1207] + v[145] * v[1423])) + (0.001 * v[1365] - -0.006 * v[1400]);
+    v[1359] = v[159] * v[1359] + v[144] * v[1468] - (v[158] * v[1221] + v[118] * v[1457]) + (v[154] * v[1342] - v[137] * v[1435] - (v[145] * v[1424] - v[153] * v[1203])) + (0.001 * v[1366] - -0.006 * v[1401]);
+    v[1360] = v[159] * v[1360] + v[144] * v[1469] - (v[158] * v[114] + v[118] * v[1458]) + (v[154] * v[1337] + v[137] * v[1436] - (v[153] * v[110] + v[145] * v[1425])) + (0.001 * v[1367] - -0.006 * v[1402]);
+    v[138] = v[159] * v[138] - v[118] * v[1459] + (v[154] * v[134] - v[145] * v[1426]) + (0.001 * v[1368] - -0.006 * v[1403]);
+    v[139] = v[159] * v[139] + v[144] * v[1470] - (v[158] * v[115] + v[118] * v[1460]) + (v[154] * v[135] + v[137] * v[1437] - (v[153] * v[111] + v[145] * v[1427])) + (0.001 * v[1369] - -0.006 * v[1404]);
+    v[140] = v[159] * v[140] + v[144] * v[1471] - (v[158] * v[1222] + v[118] * v[1461]) + (v[154] * v[1343] + v[137] * v[1438] - (v[153] * v[1208] + v[145] * v[1428])) + (0.001 * v[1370] - -0.006 * v[1405]);
+    v[1361] = v[159] * v[1361] + v[144] * v[1472] - (v[158] * v[1223] + v[118] * v[1462]) + (v[154] * v[1344] + v[137] * v[1439] - (v[153] * v[1209] + v[145] * v[1429])) + (0.001 * v[1371] - -0.006 * v[1406]);
+    v[1362] = v[159] * v[1362] + v[144] * v[1473] - (v[158] * v[1224] + v[118] * v[1463]) + (v[154] * v[1345] - v[137] * v[1440] - (v[145] * v[1430] - v[153] * v[1204])) + (0.001 * v[1372] - -0.006 * v[1407]);
+    v[1355] = v[159] * v[1355] - v[118] * v[1464] + (v[154] * v[1338] + v[137] * v[1441] - (v[19] * v[153] + v[145] * v[1431])) + (0.001 * v[1373] - -0.006 * v[1408]);
+    v[174] = v[26] * v[159] - v[118] * v[183] + (v[23] * v[154] - v[145] * v[174]) + (0.001 * v[1374] - -0.006 * v[1409]);
+    v[152] = v[152] - v[153] + (v[152] - -0.006 * v[141]);
+    v[153] = v[156] * v[1218] + v[118] * v[1442] - (v[159] * v[1347] + v[141] * v[1465]) + (v[151] * v[1205] + v[145] * v[1410] - (v[154] * v[1329] + v[136] * v[1432])) + (0.006 * v[1386] - 0.001 * v[1375]);
+    v[1347] = v[156] * v[1219] + v[118] * v[1443] - (v[159] * v[1348] + v[141] * v[1466]) + (v[151] * v[1206] + v[145] * v[1411] - (v[154] * v[1330] + v[136] * v[1433])) + (0.006 * v[1387] - 0.001 * v[1376]);
+    v[1348] = v[156] * v[1220] + v[118] * v[1444] - (v[159] * v[1349] + v[141] * v[1467]) + (v[151] * v[1207] + v[145] * v[1412] - (v[154] * v[1331] + v[136] * v[1434])) + (0.006 * v[1388] - 0.001 * v[1377]);
+    v[1349] = v[156] * v[1221] + v[118] * v[1445] - (v[159] * v[1350] + v[141] * v[1468]) + (v[145] * v[1413] - v[151] * v[1203] - (v[154] * v[1332] - v[136] * v[1435])) + (0.006 * v[1389] - 0.001 * v[1378]);
+    v[1350] = v[156] * v[114] + v[118] * v[1446] - (v[159] * v[1351] + v[141] * v[1469]) + (v[151] * v[110] + v[145] * v[1414] - (v[136] * v[1436] - v[154] * v[1327])) + (0.006 * v[1390] + 0.001 * v[1379]);
+    v[142] = v[118] * v[1447] - v[159] * v[142] + (v[145] * v[1415] - v[160]) + (0.006 * v[1391] - v[164]);
+    v[143] = v[156] * v[115] + v[118] * v[1448] - (v[159] * v[143] + v[141] * v[1470]) + (v[151] * v[111] + v[145] * v[1416] - (v[154] * v[1333] + v[136] * v[1437])) + (0.006 * v[1392] - 0.001 * v[1380]);
+    v[160] = v[156] * v[1222] + v[118] * v[1449] - (v[159] * v[1352] + v[141] * v[1471]) + (v[151] * v[1208] + v[145] * v[1417] - (v[154] * v[1334] + v[136] * v[1438])) + (0.006 * v[1393] - 0.001 * v[1381]);
+    v[164] = v[156] * v[1223] + v[118] * v[1450] - (v[159] * v[1353] + v[141] * v[1472]) + (v[151] * v[1209] + v[145] * v[1418] - (v[154] * v[1335] + v[136] * v[1439])) + (0.006 * v[1394] - 0.001 * v[1382]);
+    v[141] = v[156] * v[1224] + v[118] * v[1451] - (v[159] * v[1354] + v[141] * v[1473]) + (v[145] * v[1419] - v[151] * v[1204] - (v[154] * v[1336] - v[136] * v[1440])) + (0.006 * v[1395] - 0.001 * v[1383]);
+    v[1346] = v[118] * v[1452] - v[159] * v[1346] + (v[19] * v[151] + v[145] * v[1420] - (v[136] * v[1441] - v[154] * v[1328])) + (0.006 * v[1396] + 0.001 * v[1384]);
+    v[154] = v[118] * v[180] - v[25] * v[159] + (v[145] * v[169] - v[22] * v[154]) + (0.006 * v[1397] - 0.001 * v[1385]);
+    v[144] = v[151] - v[150] + (0.006 * v[144] - v[150]);
+    v[150] = v[1479] - 0.001 * v[1479] / 0.001;
+    v[151] = v[159] * v[1339] + v[137] * v[1465] - (v[158] * v[1205] + v[145] * v[1454]) + (0.3 * v[1386] - 0.006 * v[1375]);
+    v[169] = v[159] * v[1340] + v[137] * v[1466] - (v[158] * v[1206] + v[145] * v[1455]) + (0.3 * v[1387] - 0.006 * v[1376]);
+    v[1351] = v[159] * v[1341] + v[137] * v[1467] - (v[158] * v[1207] + v[145] * v[1456]) + (0.3 * v[1388] - 0.006 * v[1377]);
+    v[1352] = v[159] * v[1342] + v[137] * v[1468] - (v[145] * v[1457] - v[158] * v[1203]) + (0.3 * v[1389] - 0.006 * v[1378]);
+    v[1353] = v[159] * v[1337] + v[137] * v[1469] - (v[158] * v[110] + v[145] * v[1458]) + (0.3 * v[1390] + 0.006 * v[1379]);
+    v[134] = v[159] * v[134] - v[145] * v[1459] + (0.3 * v[1391] - 0.006 * v[146]);
+    v[146] = v[159] * v[135] + v[137] * v[1470] - (v[158] * v[111] + v[145] * v[1460]) + (0.3 * v[1392] - 0.006 * v[1380]);
+    v[1354] = v[159] * v[1343] + v[137] * v[1471] - (v[158] * v[1208] + v[145] * v[1461]) + (0.3 * v[1393] - 0.006 * v[1381]);
+    v[1375] = v[159] * v[1344] + v[137] * v[1472] - (v[158] * v[1209] + v[145] * v[1462]) + (0.3 * v[1394] - 0.006 * v[1382]);
+    v[1376] = v[159] * v[1345] + v[137] * v[1473] - (v[145] * v[1463] - v[158] * v[1204]) + (0.3 * v[1395] - 0.006 * v[1383]);
+    v[1377] = v[159] * v[1338] - (v[19] * v[158] + v[145] * v[1464]) + (0.3 * v[1396] + 0.006 * v[1384]);
+    v[1378] = v[23] * v[159] - v[145] * v[183] + (0.3 * v[1397] - 0.006 * v[1385]);
+    v[157] = v[157] - 0.006 * v[136] - v[158];
+    v[1363] = v[156] * v[1205] + v[145] * v[1442] - (v[159] * v[1329] + v[136] * v[1465]) + (-0.006 * v[1363] - 0.3 * v[1398]);
+    v[1364] = v[156] * v[1206] + v[145] * v[1443] - (v[159] * v[1330] + v[136] * v[1466]) + (-0.006 * v[1364] - 0.3 * v[1399]);
+    v[1365] = v[156] * v[1207] + v[145] * v[1444] - (v[159] * v[1331] + v[136] * v[1467]) + (-0.006 * v[1365] - 0.3 * v[1400]);
+    v[1366] = v[145] * v[1445] - v[156] * v[1203] - (v[159] * v[1332] + v[136] * v[1468]) + (-0.006 * v[1366] - 0.3 * v[1401]);
+    v[1367] = v[156] * v[110] + v[145] * v[1446] - (v[136] * v[1469] - v[159] * v[1327]) + (-0.006 * v[1367] - 0.3 * v[1402]);
+    v[162] = v[145] * v[1447] - v[162] + (-0.006 * v[1368] - 0.3 * v[1403]);
+    v[1368] = v[156] * v[111] + v[145] * v[1448] - (v[159] * v[1333] + v[136] * v[1470]) + (-0.006 * v[1369] - 0.3 * v[1404]);
+    v[1369] = v[156] * v[1208] + v[145] * v[1449] - (v[159] * v[1334] + v[136] * v[1471]) + (-0.006 * v[1370] - 0.3 * v[1405]);
+    v[1370] = v[156] * v[1209] + v[145] * v[1450] - (v[159] * v[1335] + v[136] * v[1472]) + (-0.006 * v[1371] - 0.3 * v[1406]);
+    v[1371] = v[145] * v[1451] - v[156] * v[1204] - (v[159] * v[1336] + v[136] * v[1473]) + (-0.006 * v[1372] - 0.3 * v[1407]);
+    v[1372] = v[159] * v[1328] + (v[19] * v[156] + v[145] * v[1452]) + (-0.006 * v[1373] - 0.3 * v[1408]);
+    v[145] = v[145] * v[180] - v[22] * v[159] + (-0.006 * v[1374] - 0.3 * v[1409]);
+    v[155] = v[156] + (v[1453] - v[155]);
+    v[159] = v[168] - -0.006 * v[24];
+    v[149] = v[149] + -0.006 * v[971];
+    v[168] = -v[168] - v[172];
+    v[172] = -v[176] - v[177];
+    v[170] = v[170] - v[177];
+    v[171] = v[171] + 0.3 * v[971];
+    v[175] = v[175] - v[196];
+    v[176] = v[197] - v[204];
+    v[177] = -v[191] - v[190];
+    v[184] = v[179] * v[971] + v[26] * v[170] + (v[200] - v[184]) + (v[201] - v[185] + (v[186] + v[22] * v[159]));
+    v[185] = v[183] * v[971] + v[26] * v[171] + (v[25] * v[172] - v[187]) + (v[23] * v[168] - v[188] + (v[189] + v[22] * v[149]));
+    v[182] = v[205] + v[182] * v[971] - v[177] + (v[193] + v[207] - (-v[192] - v[206]));
+    v[181] = v[194] - v[195] + (v[181] * v[971] - v[203]) + (v[175] + v[176]);
+    v[186] = v[213] + v[214] + (-v[213] - v[214]);
+    v[189] = v[148] * v[971] + v[26] * v[162] + (v[25] * v[134] - v[221]) + (v[23] * v[142] - v[222] + (v[223] + v[22] * v[138]));
+    v[194] = v[26] * v[155] + v[25] * v[157] + (v[23] * v[144] + v[22] * v[152]);
+    v[195] = v[130] * v[1210] + v[116] * v[1308] - (v[129] * v[1218] + v[118] * v[1298]) + (v[126] * v[1197] + v[112] * v[1280] - (v[125] * v[1205] + v[113] * v[1271])) + (v[26] * v[1363] + v[25] * v[151] + (v[23] * v[153] + v[22] * v[1356]));
+    v[196] = v[130] * v[1211] + v[116] * v[1309] - (v[129] * v[1219] + v[118] * v[1299]) + (v[126] * v[1198] + v[112] * v[1281] - (v[125] * v[1206] + v[113] * v[1272])) + (v[26] * v[1364] + v[25] * v[169] + (v[23] * v[1347] + v[22] * v[1357]));
+    v[197] = v[130] * v[1212] + v[116] * v[1310] - (v[129] * v[1220] + v[118] * v[1300]) + (v[126] * v[1199] + v[112] * v[1282] - (v[125] * v[1207] + v[113] * v[1273])) + (v[26] * v[1365] + v[25] * v[1351] + (v[23] * v[1348] + v[22] * v[1358]));
+    v[203] = v[130] * v[1213] + v[116] * v[1311] - (v[129] * v[1221] + v[118] * v[1301]) + (v[126] * v[1195] + v[112] * v[1283] - (v[113] * v[1274] - v[125] * v[1203])) + (v[26] * v[1366] + v[25] * v[1352] + (v[23] * v[1349] + v[22] * v[1359]));
+    v[204] = v[130] * v[117] + v[116] * v[1312] - (v[129] * v[114] + v[118] * v[1302]) + (v[113] * v[126] + v[112] * v[1284] - (v[125] * v[110] + v[113] * v[1275])) + (v[26] * v[1367] + v[25] * v[1353] + (v[23] * v[1350] + v[22] * v[1360]));
+    v[205] = v[130] * v[1214] + v[116] * v[1313] - (v[129] * v[115] + v[118] * v[1303]) + (v[126] * v[1200] + v[112] * v[1285] - (v[125] * v[111] + v[113] * v[1276])) + (v[26] * v[1368] + v[25] * v[146] + (v[23] * v[143] + v[22] * v[139]));
+    v[213] = v[130] * v[1215] + v[116] * v[1314] - (v[129] * v[1222] + v[118] * v[1304]) + (v[126] * v[1201] + v[112] * v[1286] - (v[125] * v[1208] + v[113] * v[1277])) + (v[26] * v[1369] + v[25] * v[1354] + (v[23] * v[160] + v[22] * v[140]));
+    v[214] = v[130] * v[1216] + v[116] * v[1315] - (v[129] * v[1223] + v[118] * v[1305]) + (v[126] * v[1202] + v[112] * v[1287] - (v[125] * v[1209] + v[113] * v[1278])) + (v[26] * v[1370] + v[25] * v[1375] + (v[23] * v[164] + v[22] * v[1361]));
+    v[221] = v[130] * v[1217] + v[116] * v[1316] - (v[129] * v[1224] + v[118] * v[1306]) + (v[126] * v[1196] + v[112] * v[1288] - (v[113] * v[1279] - v[125] * v[1204])) + (v[26] * v[1371] + v[25] * v[1376] + (v[23] * v[141] + v[22] * v[1362]));
+    v[222] = v[116] * v[258] - v[118] * v[266] + (v[18] * v[126] + v[112] * v[265] - (v[19] * v[125] + v[113] * v[1270])) + (v[26] * v[1372] + v[25] * v[1377] + (v[23] * v[1346] + v[22] * v[1355]));
+    v[26] = v[26] * v[145] + v[25] * v[1378] + (v[23] * v[154] + v[22] * v[174]) - -0.00108 * v[118];
+    v[223] = -0.5 - v[26];
+    v[971] = v[230] * v[185];
+    v[1373] = (v[184] - v[971]) / v[218];
+    v[1374] = v[231] * v[185];
+    v[1379] = (v[185] - v[1374]) / v[218];
+    v[1380] = v[232] * v[185];
+    v[1381] = (v[182] - v[1380]) / v[218];
+    v[1382] = v[233] * v[185];
+    v[1383] = (v[181] - v[1382]) / v[218];
+    v[159] = v[25] * v[170] - v[24] * v[179] + (v[187] + v[198]) + (v[188] + v[173] - (v[23] * v[159] - v[167])) - (v[230] * v[184] + v[199] * v[1373]);
+    v[149] = v[25] * v[171] - v[24] * v[183] + (v[200] + v[24] * v[172]) + (v[201] + v[22] * v[168] - (v[23] * v[149] - v[202])) - (v[971] + v[218] * v[1373]);
+    v[167] = -v[176] - v[175] - (v[230] * v[182] + v[219] * v[1373]);
+    v[168] = v[177] + (v[190] + v[191]) + (v[192] + v[206] - (-v[207] - v[193])) - (v[230] * v[181] + v[208] * v[1373]);
+    v[173] = v[184] - (v[231] * v[184] + v[199] * v[1379]);
+    v[175] = v[182] - (v[231] * v[182] + v[219] * v[1379]);
+    v[176] = v[181] - (v[231] * v[181] + v[208] * v[1379]);
+    v[177] = v[215] + v[22] * v[170] - (v[212] - v[178]) - (v[232] * v[184] + v[199] * v[1381]);
+    v[178] = v[216] + v[22] * v[171] - (v[23] * v[172] - v[217]) - (v[1380] + v[218] * v[1381]);
+    v[179] = v[186] - (v[232] * v[182] + v[219] * v[1381]);
+    v[187] = v[232] * v[181] + v[208] * v[1381];
+    v[170] = v[23] * v[170] - v[209] + (v[210] + v[217]) - (v[233] * v[184] + v[199] * v[1383]);
+    v[188] = v[233] * v[182] + v[219] * v[1383];
+    v[186] = v[186] - (v[233] * v[181] + v[208] * v[1383]);
+    v[153] = v[131] * v[1218] + v[118] * v[1319] - (v[130] * v[1225] + v[119] * v[1308]) + (v[127] * v[1205] + v[113] * v[1290] - (v[120] * v[1280] - v[126] * v[1104])) + (v[25] * v[1363] + v[24] * v[151] + (v[22] * v[153] - v[23] * v[1356])) + (v[241] * v[1252] - -0.00072 * v[1261] + v[234] * v[1233]) - v[199] * v[195] / v[218];
+    v[190] = v[131] * v[1219] + v[118] * v[1320] - (v[130] * v[1226] + v[119] * v[1309]) + (v[127] * v[1206] + v[113] * v[1291] - (v[120] * v[1281] - v[126] * v[1105])) + (v[25] * v[1364] + v[24] * v[169] + (v[22] * v[1347] - v[23] * v[1357])) + (v[241] * v[1253] - -0.00072 * v[1262] + v[234] * v[1234]) - v[199] * v[196] / v[218];
+    v[191] = v[131] * v[1220] + v[118] * v[1321] - (v[130] * v[1227] + v[119] * v[1310]) + (v[127] * v[1207] + v[113] * v[1292] - (v[120] * v[1282] - v[126] * v[1102])) + (v[25] * v[1365] + v[24] * v[1351] + (v[22] * v[1348] - v[23] * v[1358])) + (v[241] * v[1254] - -0.00072 * v[1263] + v[234] * v[1235]) - v[199] * v[197] / v[218];
+    v[192] = v[131] * v[1221] + v[118] * v[1322] - (v[130] * v[1228] + v[119] * v[1311]) + (v[113] * v[1293] - v[127] * v[1203] - (v[120] * v[1283] - v[126] * v[83])) + (v[25] * v[1366] + v[24] * v[1352] + (v[22] * v[1349] - v[23] * v[1359])) + (v[241] * v[1255] - -0.00072 * v[1264] - v[234] * v[1236]) - v[199] * v[203] / v[218];
+    v[114] = v[131] * v[114] + v[118] * v[1317] - v[119] * v[1312] + (v[127] * v[110] + v[113] * v[1289] - v[120] * v[1284]) + (v[25] * v[1367] + v[24] * v[1353] + (v[22] * v[1350] - v[23] * v[1360])) + (v[241] * v[1256] - -0.00072 * v[1265] + v[234] * v[1237]) - v[199] * v[204] / v[218];
+    v[138] = (v[229] * v[184] - v[199] * v[189] - v[247] * v[185]) / v[218] + (v[25] * v[162] - v[24] * v[148] + (v[224] + v[24] * v[134]) + (v[166] + v[22] * v[142] - (v[23] * v[138] - v[165])) + (v[123] * v[177] + v[121] * v[159]));
+    v[115] = v[131] * v[115] + v[118] * v[1323] - (v[130] * v[1229] + v[119] * v[1313]) + (v[127] * v[111] + v[113] * v[1294] - (v[120] * v[1285] - v[126] * v[84])) + (v[25] * v[1368] + v[24] * v[146] + (v[22] * v[143] - v[23] * v[139])) + (v[241] * v[1257] - -0.00072 * v[1266] + v[234] * v[1238]) - v[199] * v[205] / v[218];
+    v[139] = v[131] * v[1222] + v[118] * v[1324] - (v[130] * v[1230] + v[119] * v[1314]) + (v[127] * v[1208] + v[113] * v[1295] - (v[120] * v[1286] - v[126] * v[1106])) + (v[25] * v[1369] + v[24] * v[1354] + (v[22] * v[160] - v[23] * v[140])) + (v[241] * v[1258] - -0.00072 * v[1267] + v[234] * v[1239]) - v[199] * v[213] / v[218];
+    v[140] = v[131] * v[1223] + v[118] * v[1325] - (v[130] * v[1231] + v[119] * v[1315]) + (v[127] * v[1209] + v[113] * v[1296] - (v[120] * v[1287] - v[126] * v[1103])) + (v[25] * v[1370] + v[24] * v[1375] + (v[22] * v[164] - v[23] * v[1361])) + (v[241] * v[1259] - -0.00072 * v[1268] + v[234] * v[1240]) - v[199] * v[214] / v[218];
+    v[141] = v[131] * v[1224] + v[118] * v[1326] - (v[130] * v[1232] + v[119] * v[1316]) + (v[113] * v[1297] - v[127] * v[1204] - (v[120] * v[1288] - v[14] * v[126])) + (v[25] * v[1371] + v[24] * v[1376] + (v[22] * v[141] - v[23] * v[1362])) + (v[241] * v[1260] - -0.00072 * v[1269] - v[234] * v[1241]) - v[199] * v[221] / v[218];
+    v[142] = v[118] * v[1318] - v[119] * v[258] + (v[19] * v[127] - v[120] * v[265]) + (v[25] * v[1372] + v[24] * v[1377] + (v[22] * v[1346] - v[23] * v[1355])) + v[234] * v[1242] - v[199] * v[222] / v[218];
+    v[126] = v[199] * v[223] / v[218] + (0.0047 * v[113] - v[126] + (v[25] * v[145] + v[24] * v[1378] + (v[22] * v[154] - v[23] * v[174])) + (v[118] * v[241] - -0.00072 * v[116] + v[113] * v[234]));
+    v[24] = v[25] * v[155] + v[24] * v[157] + (v[22] * v[144] - v[23] * v[152]) - v[199] * v[194] / v[218];
+    v[25] = v[129] * v[1225] + v[119] * v[1298] - (v[131] * v[1210] + v[116] * v[1319]) + (v[120] * v[1271] - v[125] * v[1104] - (v[127] * v[1197] + v[112] * v[1290])) + (v[1474] - 0.001 * v[1474] / 0.001) + (0.00072 * v[1252] - 0.0036 * v[1243]);
+    v[143] = v[129] * v[1226] + v[119] * v[1299] - (v[131] * v[1211] + v[116] * v[1320]) + (v[120] * v[1272] - v[125] * v[1105] - (v[127] * v[1198] + v[112] * v[1291])) + (v[1475] - 0.001 * v[1475] / 0.001) + (0.00072 * v[1253] - 0.0036 * v[1244]);
+    v[144] = v[129] * v[1227] + v[119] * v[1300] - (v[131] * v[1212] + v[116] * v[1321]) + (v[120] * v[1273] - v[125] * v[1102] - (v[127] * v[1199] + v[112] * v[1292])) + (v[1476] - 0.001 * v[1476] / 0.001) + (0.00072 * v[1254] - 0.0036 * v[1245]);
+    v[148] = v[129] * v[1228] + v[119] * v[1301] - (v[131] * v[1213] + v[116] * v[1322]) + (v[120] * v[1274] - v[125] * v[83] - (v[127] * v[1195] + v[112] * v[1293])) + (v[1477] - 0.001 * v[1477] / 0.001) + (0.00072 * v[1255] - 0.0036 * v[1246]);
+    v[117] = v[119] * v[1302] - (v[131] * v[117] + v[116] * v[1317]) + (v[120] * v[1275] - (v[132] + v[112] * v[1289])) + (v[1478] - 0.001 * v[1478] / 0.001) + (0.00072 * v[1256] - 0.0036 * v[121]);
+    v[132] = v[129] * v[1229] + v[119] * v[1303] - (v[131] * v[1214] + v[116] * v[1323]) + (v[120] * v[1276] - v[125] * v[84] - (v[127] * v[1200] + v[112] * v[1294])) + (v[1480] - 0.001 * v[1480] / 0.001) + (0.00072 * v[1257] - 0.0036 * v[1247]);
+    v[152] = v[129] * v[1230] + v[119] * v[1304] - (v[131] * v[1215] + v[116] * v[1324]) + (v[120] * v[1277] - v[125] * v[1106] - (v[127] * v[1201] + v[112] * v[1295])) + (v[1481] - 0.001 * v[1481] / 0.001) + (0.00072 * v[1258] - 0.0036 * v[1248]);
+    v[154] = v[129] * v[1231] + v[119] * v[1305] - (v[131] * v[1216] + v[116] * v[1325]) + (v[120] * v[1278] - v[125] * v[1103] - (v[127] * v[1202] + v[112] * v[1296])) + (v[1482] - 0.001 * v[1482] / 0.001) + (0.00072 * v[1259] - 0.0036 * v[1249]);
+    v[160] = v[129] * v[1232] + v[119] * v[1306] - (v[131] * v[1217] + v[116] * v[1326]) + (v[120] * v[1279] - v[14] * v[125] - (v[127] * v[1196] + v[112] * v[1297])) + (v[1483] - 0.001 * v[1483] / 0.001) + (0.00072 * v[1260] - 0.0036 * v[1250]);
+    v[127] = v[119] * v[266] - v[116] * v[1318] + (v[120] * v[1270] - v[18] * v[127]) + (v[1484] - 0.001 * v[1484] / 0.001) - 0.0036 * v[1251];
+    v[119] = -0.00108 * v[119] + (v[125] - 0.0047 * v[112]) + (v[1485] - 0.001 * v[1485] / 0.001) + (0.00072 * v[118] - 0.0036 * v[112]);
+    v[125] = v[131] * v[1205] + v[113] * v[1319] - (v[120] * v[1308] - v[130] * v[1104]) + (v[22] * v[1363] - v[23] * v[151]) + (v[243] * v[1252] + (v[236] * v[1233] - 0.00072 * v[1243])) - v[219] * v[195] / v[218];
+    v[164] = v[131] * v[1206] + v[113] * v[1320] - (v[120] * v[1309] - v[130] * v[1105]) + (v[22] * v[1364] - v[23] * v[169]) + (v[243] * v[1253] + (v[236] * v[1234] - 0.00072 * v[1244])) - v[219] * v[196] / v[218];
+    v[165] = v[131] * v[1207] + v[113] * v[1321] - (v[120] * v[1310] - v[130] * v[1102]) + (v[22] * v[1365] - v[23] * v[1351]) + (v[243] * v[1254] + (v[236] * v[1235] - 0.00072 * v[1245])) - v[219] * v[197] / v[218];
+    v[166] = v[113] * v[1322] - v[131] * v[1203] - (v[120] * v[1311] - v[130] * v[83]) + (v[22] * v[1366] - v[23] * v[1352]) + (v[243] * v[1255] + (-(v[236] * v[1236]) - 0.00072 * v[1246])) - v[219] * v[203] / v[218];
+    v[174] = v[131] * v[110] + v[113] * v[1317] - v[120] * v[1312] + (v[22] * v[1367] - v[23] * v[1353]) + (v[243] * v[1256] + (v[236] * v[1237] - 0.00072 * v[121])) - v[219] * v[204] / v[218];
+    v[147] = (v[229] * v[182] - v[219] * v[189] - v[250] * v[185]) / v[218] + (v[227] + v[22] * v[162] - (v[23] * v[134] - v[147]) + (v[123] * v[179] + v[121] * v[167]));
+    v[193] = v[131] * v[111] + v[113] * v[1323] - (v[120] * v[1313] - v[130] * v[84]) + (v[22] * v[1368] - v[23] * v[146]) + (v[243] * v[1257] + (v[236] * v[1238] - 0.00072 * v[1247])) - v[219] * v[205] / v[218];
+    v[198] = v[131] * v[1208] + v[113] * v[1324] - (v[120] * v[1314] - v[130] * v[1106]) + (v[22] * v[1369] - v[23] * v[1354]) + (v[243] * v[1258] + (v[236] * v[1239] - 0.00072 * v[1248])) - v[219] * v[213] / v[218];
+    v[200] = v[131] * v[1209] + v[113] * v[1325] - (v[120] * v[1315] - v[130] * v[1103]) + (v[22] * v[1370] - v[23] * v[1375]) + (v[243] * v[1259] + (v[236] * v[1240] - 0.00072 * v[1249])) - v[219] * v[214] / v[218];
+    v[201] = v[113] * v[1326] - v[131] * v[1204] - (v[120] * v[1316] - v[14] * v[130]) + (v[22] * v[1371] - v[23] * v[1376]) + (v[243] * v[1260] + (-(v[236] * v[1241]) - 0.00072 * v[1250])) - v[219] * v[221] / v[218];
+    v[202] = v[19] * v[131] + v[113] * v[1318] - v[120] * v[258] + (v[22] * v[1372] - v[23] * v[1377]) + (v[236] * v[1242] - 0.00072 * v[1251]) - v[219] * v[222] / v[218];
+    v[206] = v[219] * v[223] / v[218] + (v[22] * v[145] - v[23] * v[1378] - v[130] + (v[118] * v[243] + (v[113] * v[236] - 0.00072 * v[112])));
+    v[207] = v[22] * v[155] - v[23] * v[157] - v[219] * v[194] / v[218];
+    v[209] = v[120] * v[1298] - v[129] * v[1104] - (v[131] * v[1197] + v[112] * v[1319]) + (v[158] * v[1329] + v[136] * v[1454] - (v[156] * v[1339] + v[137] * v[1442])) + (-0.00072 * v[1233] - 2.1 * v[1261]);
+    v[210] = v[120] * v[1299] - v[129] * v[1105] - (v[131] * v[1198] + v[112] * v[1320]) + (v[158] * v[1330] + v[136] * v[1455] - (v[156] * v[1340] + v[137] * v[1443])) + (-0.00072 * v[1234] - 2.1 * v[1262]);
+    v[215] = v[120] * v[1300] - v[129] * v[1102] - (v[131] * v[1199] + v[112] * v[1321]) + (v[158] * v[1331] + v[136] * v[1456] - (v[156] * v[1341] + v[137] * v[1444])) + (-0.00072 * v[1235] - 2.1 * v[1263]);
+    v[216] = v[120] * v[1301] - v[129] * v[83] - (v[131] * v[1195] + v[112] * v[1322]) + (v[158] * v[1332] + v[136] * v[1457] - (v[156] * v[1342] + v[137] * v[1445])) + (-(-0.00072 * v[1236]) - 2.1 * v[1264]);
+    v[133] = v[120] * v[1302] - (v[133] + v[112] * v[1317]) + (v[136] * v[1458] - v[158] * v[1327] - (v[156] * v[1337] + v[137] * v[1446])) + (-0.00072 * v[1237] - 2.1 * v[1265]);
+    v[135] = v[120] * v[1303] - v[129] * v[84] - (v[131] * v[1200] + v[112] * v[1323]) + (v[158] * v[1333] + v[136] * v[1460] - (v[156] * v[135] + v[137] * v[1448])) + (-0.00072 * v[1238] - 2.1 * v[1266]);
+    v[217] = v[120] * v[1304] - v[129] * v[1106] - (v[131] * v[1201] + v[112] * v[1324]) + (v[158] * v[1334] + v[136] * v[1461] - (v[156] * v[1343] + v[137] * v[1449])) + (-0.00072 * v[1239] - 2.1 * v[1267]);
+    v[224] = v[120] * v[1305] - v[129] * v[1103] - (v[131] * v[1202] + v[112] * v[1325]) + (v[158] * v[1335] + v[136] * v[1462] - (v[156] * v[1344] + v[137] * v[1450])) + (-0.00072 * v[1240] - 2.1 * v[1268]);
+    v[227] = v[120] * v[1306] - v[14] * v[129] - (v[131] * v[1196] + v[112] * v[1326]) + (v[158] * v[1336] + v[136] * v[1463] - (v[156] * v[1345] + v[137] * v[1451])) + (-(-0.00072 * v[1241]) - 2.1 * v[1269]);
+    v[120] = v[120] * v[266] - (v[18] * v[131] + v[112] * v[1318]) + (v[136] * v[1464] - v[158] * v[1328] - (v[156] * v[1338] + v[137] * v[1452])) + -0.00072 * v[1242];
+    v[116] = v[128] + v[129] + (v[22] * v[158] + v[136] * v[183] - (v[23] * v[156] + v[137] * v[180])) + (v[1307] - v[116] * 2.1);
+    v[128] = v[130] * v[1197] + v[112] * v[1308] - (v[129] * v[1205] + v[113] * v[1298]) + (v[23] * v[1363] + v[22] * v[151]) + (v[244] * v[1252] + v[237] * v[1233]) - v[208] * v[195] / v[218];
+    v[131] = v[130] * v[1198] + v[112] * v[1309] - (v[129] * v[1206] + v[113] * v[1299]) + (v[23] * v[1364] + v[22] * v[169]) + (v[244] * v[1253] + v[237] * v[1234]) - v[208] * v[196] / v[218];
+    v[136] = v[130] * v[1199] + v[112] * v[1310] - (v[129] * v[1207] + v[113] * v[1300]) + (v[23] * v[1365] + v[22] * v[1351]) + (v[244] * v[1254] + v[237] * v[1235]) - v[208] * v[197] / v[218];
+    v[137] = v[130] * v[1195] + v[112] * v[1311] - (v[113] * v[1301] - v[129] * v[1203]) + (v[23] * v[1366] + v[22] * v[1352]) + (v[244] * v[1255] - v[237] * v[1236]) - v[208] * v[203] / v[218];
+    v[110] = v[113] * v[130] + v[112] * v[1312] - (v[129] * v[110] + v[113] * v[1302]) + (v[23] * v[1367] + v[22] * v[1353]) + (v[244] * v[1256] + v[237] * v[1237]) - v[208] * v[204] / v[218];
+    v[134] = (v[229] * v[181] - v[208] * v[189] - v[252] * v[185]) / v[218] + (v[23] * v[162] - v[225] + (v[226] + v[22] * v[134]) + (v[121] * v[168] - v[123] * v[187]));
+    v[111] = v[130] * v[1200] + v[112] * v[1313] - (v[129] * v[111] + v[113] * v[1303]) + (v[23] * v[1368] + v[22] * v[146]) + (v[244] * v[1257] + v[237] * v[1238]) - v[208] * v[205] / v[218];
+    v[146] = v[130] * v[1201] + v[112] * v[1314] - (v[129] * v[1208] + v[113] * v[1304]) + (v[23] * v[1369] + v[22] * v[1354]) + (v[244] * v[1258] + v[237] * v[1239]) - v[208] * v[213] / v[218];
+    v[151] = v[130] * v[1202] + v[112] * v[1315] - (v[129] * v[1209] + v[113] * v[1305]) + (v[23] * v[1370] + v[22] * v[1375]) + (v[244] * v[1259] + v[237] * v[1240]) - v[208] * v[214] / v[218];
+    v[156] = v[130] * v[1196] + v[112] * v[1316] - (v[113] * v[1306] - v[129] * v[1204]) + (v[23] * v[1371] + v[22] * v[1376]) + (v[244] * v[1260] - v[237] * v[1241]) - v[208] * v[221] / v[218];
+    v[129] = v[18] * v[130] + v[112] * v[258] - (v[19] * v[129] + v[113] * v[266]) + (v[23] * v[1372] + v[22] * v[1377]) + v[237] * v[1242] - v[208] * v[222] / v[218];
+    v[130] = v[208] * v[223] / v[218] + (v[23] * v[145] + v[22] * v[1378] - -0.00108 * v[113] + (v[118] * v[244] + v[113] * v[237]));
+    v[145] = v[23] * v[155] + v[22] * v[157] - v[208] * v[194] / v[218];
+    v[155] = 0.2155 * v[168] + v[19] * v[159];
+    v[157] = -0.00072 * v[970] - v[236] * v[969];
+    v[158] = v[20] * v[167] - v[149];
+    v[159] = v[18] * v[159];
+    v[162] = v[19] * v[167];
+    v[169] = -v[261] - v[260];
+    v[167] = v[18] * v[167];
+    v[180] = 0.00072 * v[969];
+    v[183] = -v[274] - v[266];
+    v[225] = v[19] * v[177] - 0.2155 * v[187];
+    v[226] = v[243] * v[969];
+    v[234] = v[20] * v[179] - v[178];
+    v[177] = v[18] * v[177];
+    v[236] = v[19] * v[179];
+    v[179] = v[18] * v[179];
+    v[237] = 2.1 * v[970];
+    v[241] = 0.2155 * v[186];
+    v[243] = v[241] + v[19] * v[170];
+    v[246] = v[246] * v[969];
+    v[22] = -(v[20] * v[188]) - (v[23] * v[171] - v[211] + (v[212] + v[22] * v[172]) - (v[1382] + v[218] * v[1383]));
+    v[23] = v[18] * v[170];
+    v[170] = v[19] * v[188];
+    v[171] = v[18] * v[188];
+    v[172] = v[309] - v[287];
+    v[188] = v[310] - v[300];
+    v[211] = v[18] * v[155];
+    v[212] = v[288] - v[257] - v[172];
+    v[247] = v[18] * v[158];
+    v[250] = -v[289] - v[19] * v[180] + (v[290] + v[18] * v[157]);
+    v[252] = v[18] * v[159];
+    v[261] = -v[292] - v[263] + (v[293] + v[18] * v[254]);
+    v[265] = v[18] * v[162];
+    v[266] = -v[295] - v[267] + (v[296] + v[18] * v[169]);
+    v[274] = v[18] * v[168];
+    v[287] = v[18] * v[167];
+    v[288] = v[188] + (v[301] + v[259]);
+    v[289] = v[324] - v[317];
+    v[290] = v[320] - v[334] - (v[333] - v[319]);
+    v[300] = -v[274];
+    v[301] = v[18] * v[230];
+    v[309] = v[19] * v[117] - v[339] + (v[340] + v[18] * v[114]);
+    v[310] = v[19] * v[150] + v[18] * v[138];
+    v[317] = v[19] * v[119] + v[18] * v[126];
+    v[319] = -0.2 * v[19] + v[18] * v[24];
+    v[320] = v[106] * v[1108] + v[90] * v[1179] - (v[104] * v[1113] + v[93] * v[1171]) + (v[101] * v[1098] + v[85] * v[1155] - (v[99] * v[1104] + v[86] * v[1147])) + (v[19] * v[25] + v[18] * v[153]);
+    v[324] = v[106] * v[1109] + v[90] * v[1180] - (v[104] * v[1114] + v[93] * v[1172]) + (v[101] * v[1099] + v[85] * v[1156] - (v[99] * v[1105] + v[86] * v[1148])) + (v[19] * v[143] + v[18] * v[190]);
+    v[333] = v[106] * v[1110] + v[90] * v[1181] - (v[104] * v[1115] + v[93] * v[1173]) + (v[85] * v[1157] - v[101] * v[1096] - (v[99] * v[1102] + v[86] * v[1149])) + (v[19] * v[144] + v[18] * v[191]);
+    v[334] = v[106] * v[91] + v[90] * v[1182] - (v[104] * v[87] + v[93] * v[1174]) + (v[86] * v[101] + v[85] * v[1158] - (v[99] * v[83] + v[86] * v[1150])) + (v[19] * v[148] + v[18] * v[192]);
+    v[339] = v[106] * v[92] + v[90] * v[1183] - (v[104] * v[88] + v[93] * v[1175]) + (v[101] * v[1100] + v[85] * v[1159] - (v[99] * v[84] + v[86] * v[1151])) + (v[19] * v[132] + v[18] * v[115]);
+    v[340] = v[106] * v[1111] + v[90] * v[1184] - (v[104] * v[89] + v[93] * v[1176]) + (v[101] * v[1101] + v[85] * v[1160] - (v[99] * v[1106] + v[86] * v[1152])) + (v[19] * v[152] + v[18] * v[139]);
+    v[971] = v[106] * v[1107] + v[90] * v[1185] - (v[104] * v[1112] + v[93] * v[1177]) + (v[85] * v[1161] - v[101] * v[1097] - (v[99] * v[1103] + v[86] * v[1153])) + (v[19] * v[154] + v[18] * v[140]);
+    v[1195] = v[16] * v[106] + v[90] * v[1186] - (v[17] * v[104] + v[93] * v[1178]) + (v[13] * v[101] + v[85] * v[1162] - (v[14] * v[99] + v[86] * v[1154])) + (v[19] * v[160] + v[18] * v[141]);
+    v[1196] = 0.00017 * v[90] - -0.0357 * v[93] + -0.0027 * v[85] + (v[19] * v[127] + v[18] * v[142]);
+    v[1197] = -1. - v[1196];
+    v[1198] = v[347] * v[261];
+    v[1199] = (v[212] - v[1198]) / v[336];
+    v[1200] = v[347] * v[252];
+    v[1201] = (v[211] - v[1200]) / v[336];
+    v[1202] = v[348] * v[261];
+    v[1203] = (v[250] - v[1202]) / v[336];
+    v[1204] = v[348] * v[252];
+    v[1205] = (v[247] - v[1204]) / v[336];
+    v[1206] = v[349] * v[261];
+    v[1207] = (v[261] - v[1206]) / v[336];
+    v[1208] = v[349] * v[252];
+    v[1209] = (v[252] - v[1208]) / v[336];
+    v[1210] = v[350] * v[261];
+    v[1211] = (v[266] - v[1210]) / v[336];
+    v[1212] = v[350] * v[252];
+    v[1213] = (v[265] - v[1212]) / v[336];
+    v[1214] = v[351] * v[261];
+    v[1215] = (v[298] - v[1214]) / v[336];
+    v[1216] = v[351] * v[252];
+    v[1217] = (v[300] - v[1216]) / v[336];
+    v[1218] = v[352] * v[261];
+    v[1219] = (v[288] - v[1218]) / v[336];
+    v[1220] = v[352] * v[252];
+    v[1221] = (v[287] - v[1220]) / v[336];
+    v[255] = v[292] + v[263] + (-v[255] - v[293]) - v[291] - (v[347] * v[212] + v[308] * v[1199]);
+    v[155] = 0.2155 * v[243] + v[19] * v[155] - (v[347] * v[211] + v[308] * v[1201]);
+    v[157] = v[19] * v[157] - v[256] - (v[264] - v[18] * v[180]) - 0.2155 * v[246] - (v[347] * v[250] + v[335] * v[1199]);
+    v[158] = 0.2155 * v[22] + v[19] * v[158] - (v[347] * v[247] + v[335] * v[1201]);
+    v[172] = 0.2155 * v[282] + (v[19] * v[254] - v[257] - v[172]) - (v[1198] + v[336] * v[1199]);
+    v[159] = 0.2155 * v[23] + v[19] * v[159] - (v[1200] + v[336] * v[1201]);
+    v[169] = v[19] * v[169] - v[259] - v[188] - v[299] - (v[347] * v[266] + v[337] * v[1199]);
+    v[162] = v[19] * v[162] - 0.2155 * v[170] - (v[347] * v[265] + v[337] * v[1201]);
+    v[180] = v[311] - (v[338] * v[1199] - v[297] * v[347]);
+    v[168] = -(v[19] * v[168]) - v[241] - (v[338] * v[1201] - v[347] * v[274]);
+    v[188] = v[294] + (v[296] - v[262] - (v[295] + v[267])) - (v[347] * v[288] + v[312] * v[1199]);
+    v[167] = v[19] * v[167] - 0.2155 * v[171] - (v[347] * v[287] + v[312] * v[1201]);
+    v[238] = v[238] + (v[260] * v[970] - v[303] + (v[20] * v[183] - v[272] * v[969])) - (v[348] * v[212] + v[308] * v[1203]);
+    v[241] = v[20] * v[225] - (0.2155 * v[176] + v[19] * v[173]) - (v[348] * v[211] + v[308] * v[1205]);
+    v[239] = v[239] * v[969] + (v[278] * v[970] + v[21] * v[237] + (-(v[273] * v[969]) - v[20] * v[226])) - (v[348] * v[250] + v[335] * v[1203]);
+    v[254] = v[20] * v[234] - (v[20] * v[175] - (v[185] - (v[1374] + v[218] * v[1379]))) - (v[348] * v[247] + v[335] * v[1205]);
+    v[256] = v[302] + v[258] * v[970] + (v[20] * v[271] - v[275] * v[969]) - v[268] - (v[1202] + v[336] * v[1203]);
+    v[173] = v[20] * v[177] - v[18] * v[173] - (v[1204] + v[336] * v[1205]);
+    v[257] = v[270] + (-(v[276] * v[969]) - v[307] - (v[306] + v[279] * v[970])) - (v[348] * v[266] + v[337] * v[1203]);
+    v[258] = v[20] * v[236] - v[19] * v[175] - (v[348] * v[265] + v[337] * v[1205]);
+    v[244] = v[244] * v[969] - (v[338] * v[1203] - v[297] * v[348]);
+    v[176] = v[176] + v[20] * v[187] - (v[338] * v[1205] - v[348] * v[274]);
+    v[259] = v[280] * v[970] - v[304] + (v[305] - v[277] * v[969]) - v[269] - (v[348] * v[288] + v[312] * v[1203]);
+    v[175] = v[20] * v[179] - v[18] * v[175] - (v[348] * v[287] + v[312] * v[1205]);
+    v[260] = v[212] - (v[349] * v[212] + v[308] * v[1207]);
+    v[262] = v[211] - (v[349] * v[211] + v[308] * v[1209]);
+    v[263] = v[250] - (v[349] * v[250] + v[335] * v[1207]);
+    v[264] = v[247] - (v[349] * v[247] + v[335] * v[1209]);
+    v[267] = v[266] - (v[349] * v[266] + v[337] * v[1207]);
+    v[268] = v[265] - (v[349] * v[265] + v[337] * v[1209]);
+    v[269] = v[298] - (v[338] * v[1207] - v[297] * v[349]);
+    v[270] = v[300] - (v[338] * v[1209] - v[349] * v[274]);
+    v[272] = v[19] * v[183] - v[325] - v[289] - (v[350] * v[212] + v[308] * v[1211]);
+    v[273] = v[19] * v[225] - (v[350] * v[211] + v[308] * v[1213]);
+    v[275] = -v[327] - v[19] * v[226] - (v[326] + v[18] * v[237]) - (v[350] * v[250] + v[335] * v[1211]);
+    v[276] = v[19] * v[234] - (v[350] * v[247] + v[335] * v[1213]);
+    v[277] = v[19] * v[271] - v[329] - (v[313] + v[328]) - (v[1210] + v[336] * v[1211]);
+    v[278] = v[19] * v[177] - (v[1212] + v[336] * v[1213]);
+    v[279] = v[322] + v[330] + (-v[331] - v[323]) - (v[350] * v[266] + v[337] * v[1211]);
+    v[280] = v[19] * v[236] - (v[350] * v[265] + v[337] * v[1213]);
+    v[291] = v[332] - (v[338] * v[1211] - v[297] * v[350]);
+    v[292] = v[19] * v[187] - (v[338] * v[1213] - v[350] * v[274]);
+    v[293] = v[290] - (v[350] * v[288] + v[312] * v[1211]);
+    v[294] = v[19] * v[179] - (v[350] * v[287] + v[312] * v[1213]);
+    v[245] = v[245] - (v[351] * v[212] + v[308] * v[1215]);
+    v[243] = -v[243] - (v[351] * v[211] + v[308] * v[1217]);
+    v[246] = v[246] - (v[351] * v[250] + v[335] * v[1215]);
+    v[22] = -v[22] - (v[351] * v[247] + v[335] * v[1217]);
+    v[282] = -v[282] - (v[1214] + v[336] * v[1215]);
+    v[23] = -v[23] - (v[1216] + v[336] * v[1217]);
+    v[286] = v[286] - (v[351] * v[266] + v[337] * v[1215]);
+    v[170] = v[170] - (v[351] * v[265] + v[337] * v[1217]);
+    v[295] = v[338] * v[1215] - v[297] * v[351];
+    v[186] = v[186] - (v[338] * v[1217] - v[351] * v[274]);
+    v[285] = v[285] - (v[351] * v[288] + v[312] * v[1215]);
+    v[171] = v[171] - (v[351] * v[287] + v[312] * v[1217]);
+    v[183] = -v[313] - v[328] + (v[314] + v[18] * v[183]) - (v[352] * v[212] + v[308] * v[1219]);
+    v[225] = v[18] * v[225] - (v[352] * v[211] + v[308] * v[1221]);
+    v[226] = v[19] * v[237] - v[315] + (v[316] - v[18] * v[226]) - (v[352] * v[250] + v[335] * v[1219]);
+    v[234] = v[18] * v[234] - (v[352] * v[247] + v[335] * v[1221]);
+    v[237] = v[290] - (v[352] * v[266] + v[337] * v[1219]);
+    v[236] = v[18] * v[236] - (v[352] * v[265] + v[337] * v[1221]);
+    v[290] = v[321] - (v[338] * v[1219] - v[297] * v[352]);
+    v[187] = v[18] * v[187] - (v[338] * v[1221] - v[352] * v[274]);
+    v[25] = v[107] * v[1113] + v[93] * v[1190] - (v[106] * v[1031] + v[66] * v[1179]) + (v[102] * v[1104] + v[86] * v[1163] - (v[101] * v[1027] + v[94] * v[1155])) + (0.2155 * v[128] + (v[19] * v[153] - v[18] * v[25])) + (v[367] * v[1131] - v[283] * v[1139] + (v[353] * v[1116] - v[358] * v[1124])) - v[308] * v[320] / v[336];
+    v[143] = v[107] * v[1114] + v[93] * v[1191] - (v[106] * v[1032] + v[66] * v[1180]) + (v[102] * v[1105] + v[86] * v[1164] - (v[94] * v[1156] - v[101] * v[1025])) + (0.2155 * v[131] + (v[19] * v[190] - v[18] * v[143])) + (v[367] * v[1132] - v[283] * v[1140] + (v[353] * v[1117] - v[358] * v[1125])) - v[308] * v[324] / v[336];
+    v[144] = v[107] * v[1115] + v[93] * v[1192] - (v[106] * v[63] + v[66] * v[1181]) + (v[102] * v[1102] + v[86] * v[1165] - (v[101] * v[59] + v[94] * v[1157])) + (0.2155 * v[136] + (v[19] * v[191] - v[18] * v[144])) + (v[367] * v[1133] - v[283] * v[1141] + (v[358] * v[1126] + v[353] * v[1118])) - v[308] * v[333] / v[336];
+    v[87] = v[107] * v[87] + v[93] * v[1187] - v[66] * v[1182] + (v[102] * v[83] + v[86] * v[1166] - v[94] * v[1158]) + (0.2155 * v[137] + (v[19] * v[192] - v[18] * v[148])) + (v[367] * v[1134] - v[283] * v[1142] + (v[353] * v[1119] - v[95] * v[358])) - v[308] * v[334] / v[336];
+    v[114] = (v[346] * v[212] - v[308] * v[309] - v[380] * v[261]) / v[336] + (0.2155 * v[110] + (v[19] * v[114] - v[248] - (v[161] + v[18] * v[117])) + (v[97] * v[272] - v[98] * v[245] + (v[95] * v[255] - v[96] * v[238])));
+    v[117] = (v[346] * v[211] - v[308] * v[310] - v[380] * v[252]) / v[336] + (0.2155 * v[134] + (v[19] * v[138] - v[18] * v[150]) + (v[97] * v[273] - v[98] * v[243] + (v[95] * v[155] - v[96] * v[241])));
+    v[88] = v[107] * v[88] + v[93] * v[1193] - (v[106] * v[1033] + v[66] * v[1183]) + (v[102] * v[84] + v[86] * v[1167] - (v[101] * v[822] + v[94] * v[1159])) + (0.2155 * v[111] + (v[19] * v[115] - v[18] * v[132])) + (v[367] * v[1135] - v[283] * v[1143] + (v[353] * v[1120] - v[358] * v[1127])) - v[308] * v[339] / v[336];
+    v[89] = v[107] * v[89] + v[93] * v[1194] - (v[106] * v[1034] + v[66] * v[1184]) + (v[102] * v[1106] + v[86] * v[1168] - (v[94] * v[1160] - v[101] * v[1026])) + (0.2155 * v[146] + (v[19] * v[139] - v[18] * v[152])) + (v[367] * v[1136] - v[283] * v[1144] + (v[353] * v[1121] - v[358] * v[1128])) - v[308] * v[340] / v[336];
+    v[115] = v[107] * v[1112] + v[93] * v[1188] - v[66] * v[1185] + (v[102] * v[1103] + v[86] * v[1169] - (v[10] * v[101] + v[94] * v[1161])) + (0.2155 * v[151] + (v[19] * v[140] - v[18] * v[154])) + (v[367] * v[1137] - v[283] * v[1145] + (v[358] * v[1129] + v[353] * v[1122])) - v[308] * v[971] / v[336];
+    v[132] = v[17] * v[107] + v[93] * v[1189] - v[66] * v[1186] + (v[14] * v[102] + v[86] * v[1170] - v[94] * v[1162]) + (0.2155 * v[156] + (v[19] * v[141] - v[18] * v[160])) + (v[367] * v[1138] - v[283] * v[1146] + (v[353] * v[1123] - v[358] * v[1130])) - v[308] * v[1195] / v[336];
+    v[100] = v[308] * v[1197] / v[336] + (0.0058 * v[86] - (v[100] + v[101]) - 0.00017 * v[66] + (0.2155 * v[129] + (v[19] * v[142] - v[18] * v[127])) + (v[93] * v[367] - v[90] * v[283] + (v[86] * v[353] - v[85] * v[358])));
+    v[101] = 0.2155 * v[130] + (v[19] * v[126] - v[18] * v[119]) - v[308] * v[317] / v[336];
+    v[24] = 0.2155 * v[145] + (v[19] * v[24] - -0.2 * v[18]) - v[308] * v[319] / v[336];
+    v[119] = 0.2155 * v[233] + v[19] * v[230] - v[308] * v[301] / v[336];
+    v[126] = -(v[19] * v[308] / v[336]) - v[18];
+    v[127] = v[19] * v[335] / v[336];
+    v[138] = v[104] * v[1031] + v[66] * v[1171] - (v[107] * v[1108] + v[90] * v[1190]) + (v[99] * v[1027] + v[94] * v[1147] - (v[102] * v[1098] + v[85] * v[1163])) + (v[21] * v[209] + v[20] * v[125] - (v[195] + (v[242] * v[1252] + v[235] * v[1233]) - v[218] * v[195] / v[218])) + (v[368] * v[1131] - v[284] * v[1139] + (v[354] * v[1116] - v[359] * v[1124])) - v[335] * v[320] / v[336];
+    v[139] = v[104] * v[1032] + v[66] * v[1172] - (v[107] * v[1109] + v[90] * v[1191]) + (v[94] * v[1148] - v[99] * v[1025] - (v[102] * v[1099] + v[85] * v[1164])) + (v[21] * v[210] + v[20] * v[164] - (v[196] + (v[242] * v[1253] + v[235] * v[1234]) - v[218] * v[196] / v[218])) + (v[368] * v[1132] - v[284] * v[1140] + (v[354] * v[1117] - v[359] * v[1125])) - v[335] * v[324] / v[336];
+    v[140] = v[104] * v[63] + v[66] * v[1173] - (v[107] * v[1110] + v[90] * v[1192]) + (v[99] * v[59] + v[94] * v[1149] - (v[85] * v[1165] - v[102] * v[1096])) + (v[21] * v[215] + v[20] * v[165] - (v[197] + (v[242] * v[1254] + v[235] * v[1235]) - v[218] * v[197] / v[218])) + (v[368] * v[1133] - v[284] * v[1141] + (v[359] * v[1126] + v[354] * v[1118])) - v[335] * v[333] / v[336];
+    v[91] = v[66] * v[1174] - (v[107] * v[91] + v[90] * v[1187]) + (v[94] * v[1150] - (v[108] + v[85] * v[1166])) + (v[21] * v[216] + v[20] * v[166] - (v[203] + (v[242] * v[1255] - v[235] * v[1236]) - v[218] * v[203] / v[218])) + (v[368] * v[1134] - v[284] * v[1142] + (v[354] * v[1119] - v[95] * v[359])) - v[335] * v[334] / v[336];
+    v[108] = (v[346] * v[250] - v[335] * v[309] - v[382] * v[261]) / v[336] + (v[124] * v[970] + v[21] * v[133] + (v[20] * v[174] - v[251] * v[969]) - (v[204] + (v[242] * v[1256] + v[235] * v[1237]) - v[218] * v[204] / v[218]) + (v[97] * v[275] - v[98] * v[246] + (v[95] * v[157] - v[96] * v[239])));
+    v[123] = (v[346] * v[247] - v[335] * v[310] - v[382] * v[252]) / v[336] + (v[21] * v[1486] + v[20] * v[147] - ((v[229] * v[185] - v[218] * v[189] - v[249] * v[185]) / v[218] + (v[189] + (v[123] * v[178] + v[121] * v[149]))) + (v[97] * v[276] - v[98] * v[22] + (v[95] * v[158] - v[96] * v[254])));
+    v[92] = v[104] * v[1033] + v[66] * v[1175] - (v[107] * v[92] + v[90] * v[1193]) + (v[99] * v[822] + v[94] * v[1151] - (v[102] * v[1100] + v[85] * v[1167])) + (v[21] * v[135] + v[20] * v[193] - (v[205] + (v[242] * v[1257] + v[235] * v[1238]) - v[218] * v[205] / v[218])) + (v[368] * v[1135] - v[284] * v[1143] + (v[354] * v[1120] - v[359] * v[1127])) - v[335] * v[339] / v[336];
+    v[124] = v[104] * v[1034] + v[66] * v[1176] - (v[107] * v[1111] + v[90] * v[1194]) + (v[94] * v[1152] - v[99] * v[1026] - (v[102] * v[1101] + v[85] * v[1168])) + (v[21] * v[217] + v[20] * v[198] - (v[213] + (v[242] * v[1258] + v[235] * v[1239]) - v[218] * v[213] / v[218])) + (v[368] * v[1136] - v[284] * v[1144] + (v[354] * v[1121] - v[359] * v[1128])) - v[335] * v[340] / v[336];
+    v[141] = v[66] * v[1177] - (v[107] * v[1107] + v[90] * v[1188]) + (v[10] * v[99] + v[94] * v[1153] - (v[85] * v[1169] - v[102] * v[1097])) + (v[21] * v[224] + v[20] * v[200] - (v[214] + (v[242] * v[1259] + v[235] * v[1240]) - v[218] * v[214] / v[218])) + (v[368] * v[1137] - v[284] * v[1145] + (v[359] * v[1129] + v[354] * v[1122])) - v[335] * v[971] / v[336];
+    v[102] = v[66] * v[1178] - (v[16] * v[107] + v[90] * v[1189]) + (v[94] * v[1154] - (v[13] * v[102] + v[85] * v[1170])) + (v[21] * v[227] + v[20] * v[201] - (v[221] + (v[242] * v[1260] - v[235] * v[1241]) - v[218] * v[221] / v[218])) + (v[368] * v[1138] - v[284] * v[1146] + (v[354] * v[1123] - v[359] * v[1130])) - v[335] * v[1195] / v[336];
+    v[99] = v[335] * v[1197] / v[336] + (-0.0357 * v[66] + (v[99] - 0.0058 * v[85]) + (v[21] * v[120] + v[20] * v[202] - (v[222] + v[235] * v[1242] - v[218] * v[222] / v[218])) + (v[93] * v[368] - v[90] * v[284] + (v[86] * v[354] - v[85] * v[359])));
+    v[21] = v[21] * v[116] + v[20] * v[206] - (v[218] * v[223] / v[218] + (v[26] + (v[118] * v[242] + v[113] * v[235]))) - v[335] * v[317] / v[336];
+    v[26] = v[20] * v[207] - (v[194] - v[218] * v[194] / v[218]) - v[335] * v[319] / v[336];
+    v[142] = v[20] * v[232] - v[231] - v[335] * v[301] / v[336];
+    v[148] = v[19] * v[337] / v[336];
+    v[149] = v[107] * v[1104] + v[86] * v[1190] - (v[106] * v[1027] + v[94] * v[1179]) + (v[19] * v[125] - v[18] * v[209]) + (v[370] * v[1131] - v[374] * v[1139] + (v[356] * v[1116] - v[361] * v[1124])) - v[337] * v[320] / v[336];
+    v[150] = v[107] * v[1105] + v[86] * v[1191] - (v[94] * v[1180] - v[106] * v[1025]) + (v[19] * v[164] - v[18] * v[210]) + (v[370] * v[1132] - v[374] * v[1140] + (v[356] * v[1117] - v[361] * v[1125])) - v[337] * v[324] / v[336];
+    v[152] = v[107] * v[1102] + v[86] * v[1192] - (v[106] * v[59] + v[94] * v[1181]) + (v[19] * v[165] - v[18] * v[215]) + (v[370] * v[1133] - v[374] * v[1141] + (v[361] * v[1126] + v[356] * v[1118])) - v[337] * v[333] / v[336];
+    v[153] = v[107] * v[83] + v[86] * v[1187] - v[94] * v[1182] + (v[19] * v[166] - v[18] * v[216]) + (v[370] * v[1134] - v[374] * v[1142] + (v[356] * v[1119] - v[95] * v[361])) - v[337] * v[334] / v[336];
+    v[154] = (v[346] * v[266] - v[337] * v[309] - v[384] * v[261]) / v[336] + (v[19] * v[174] - v[344] - (v[343] + v[18] * v[133]) + (v[97] * v[279] - v[98] * v[286] + (v[95] * v[169] - v[96] * v[257])));
+    v[160] = (v[346] * v[265] - v[337] * v[310] - v[384] * v[252]) / v[336] + (v[19] * v[147] - v[18] * v[1486] + (v[97] * v[280] - v[98] * v[170] + (v[95] * v[162] - v[96] * v[258])));
+    v[161] = v[107] * v[84] + v[86] * v[1193] - (v[106] * v[822] + v[94] * v[1183]) + (v[19] * v[193] - v[18] * v[135]) + (v[370] * v[1135] - v[374] * v[1143] + (v[356] * v[1120] - v[361] * v[1127])) - v[337] * v[339] / v[336];
+    v[178] = v[107] * v[1106] + v[86] * v[1194] - (v[94] * v[1184] - v[106] * v[1026]) + (v[19] * v[198] - v[18] * v[217]) + (v[370] * v[1136] - v[374] * v[1144] + (v[356] * v[1121] - v[361] * v[1128])) - v[337] * v[340] / v[336];
+    v[190] = v[107] * v[1103] + v[86] * v[1188] - (v[10] * v[106] + v[94] * v[1185]) + (v[19] * v[200] - v[18] * v[224]) + (v[370] * v[1137] - v[374] * v[1145] + (v[361] * v[1129] + v[356] * v[1122])) - v[337] * v[971] / v[336];
+    v[191] = v[14] * v[107] + v[86] * v[1189] - v[94] * v[1186] + (v[19] * v[201] - v[18] * v[227]) + (v[370] * v[1138] - v[374] * v[1146] + (v[356] * v[1123] - v[361] * v[1130])) - v[337] * v[1195] / v[336];
+    v[105] = v[337] * v[1197] / v[336] + (v[19] * v[202] - v[18] * v[120] - (v[105] + v[106]) + (v[93] * v[370] - v[90] * v[374] + (v[86] * v[356] - v[85] * v[361])));
+    v[192] = v[19] * v[206] - v[18] * v[116] - v[337] * v[317] / v[336];
+    v[229] = v[19] * v[207] - v[337] * v[319] / v[336];
+    v[230] = v[19] * v[232] - v[337] * v[301] / v[336];
+    v[231] = v[19] * v[338] / v[336];
+    v[128] = v[104] * v[1027] + v[94] * v[1171] - (v[107] * v[1098] + v[85] * v[1190]) - v[128] + (v[371] * v[1131] - v[220] * v[1139] + (v[281] * v[1116] - v[240] * v[1124])) - v[338] * v[320] / v[336];
+    v[131] = v[94] * v[1172] - v[104] * v[1025] - (v[107] * v[1099] + v[85] * v[1191]) - v[131] + (v[371] * v[1132] - v[220] * v[1140] + (v[281] * v[1117] - v[240] * v[1125])) - v[338] * v[324] / v[336];
+    v[136] = v[104] * v[59] + v[94] * v[1173] - (v[85] * v[1192] - v[107] * v[1096]) - v[136] + (v[371] * v[1133] - v[220] * v[1141] + (v[240] * v[1126] + v[281] * v[1118])) - v[338] * v[333] / v[336];
+    v[109] = v[94] * v[1174] - (v[109] + v[85] * v[1187]) - v[137] + (v[371] * v[1134] - v[220] * v[1142] + (v[281] * v[1119] - v[95] * v[240])) - v[338] * v[334] / v[336];
+    v[110] = (-(v[297] * v[346]) - v[338] * v[309] - v[386] * v[261]) / v[336] + (v[98] * v[295] + v[97] * v[291] + (v[95] * v[180] - v[96] * v[244]) - v[110]);
+    v[134] = (-(v[346] * v[274]) - v[338] * v[310] - v[386] * v[252]) / v[336] + (v[97] * v[292] - v[98] * v[186] + (v[95] * v[168] - v[96] * v[176]) - v[134]);
+    v[111] = v[104] * v[822] + v[94] * v[1175] - (v[107] * v[1100] + v[85] * v[1193]) - v[111] + (v[371] * v[1135] - v[220] * v[1143] + (v[281] * v[1120] - v[240] * v[1127])) - v[338] * v[339] / v[336];
+    v[137] = v[94] * v[1176] - v[104] * v[1026] - (v[107] * v[1101] + v[85] * v[1194]) - v[146] + (v[371] * v[1136] - v[220] * v[1144] + (v[281] * v[1121] - v[240] * v[1128])) - v[338] * v[340] / v[336];
+    v[146] = v[10] * v[104] + v[94] * v[1177] - (v[85] * v[1188] - v[107] * v[1097]) - v[151] + (v[371] * v[1137] - v[220] * v[1145] + (v[240] * v[1129] + v[281] * v[1122])) - v[338] * v[971] / v[336];
+    v[94] = v[94] * v[1178] - (v[13] * v[107] + v[85] * v[1189]) - v[156] + (v[371] * v[1138] - v[220] * v[1146] + (v[281] * v[1123] - v[240] * v[1130])) - v[338] * v[1195] / v[336];
+    v[103] = v[338] * v[1197] / v[336] + (v[103] + v[104] - v[129] + (v[93] * v[371] - v[90] * v[220] + (v[86] * v[281] - v[85] * v[240])));
+    v[107] = -(v[338] * v[317] / v[336]) - v[130];
+    v[129] = -(v[338] * v[319] / v[336]) - v[145];
+    v[130] = -(v[338] * v[301] / v[336]) - v[233];
+    v[145] = v[393] + (v[392] - v[15] * v[281]);
+    v[151] = v[16] * v[180] + v[15] * v[169] + (v[13] * v[157] - v[14] * v[255]);
+    v[156] = v[16] * v[168] + v[15] * v[162] + (v[13] * v[158] - v[14] * v[155]);
+    v[233] = v[281] * v[968] - v[388] + (v[390] - v[389]);
+    v[157] = v[17] * v[180] + v[16] * v[169] + (v[14] * v[157] + v[13] * v[255]);
+    v[155] = v[17] * v[168] + v[16] * v[162] + (v[14] * v[158] + v[13] * v[155]);
+    v[158] = v[13] * v[180] - v[14] * v[169];
+    v[235] = v[13] * v[168] - v[14] * v[162];
+    v[242] = v[396] - v[395];
+    v[169] = v[14] * v[180] + v[13] * v[169];
+    v[162] = v[14] * v[168] + v[13] * v[162];
+    v[168] = v[404] + (v[403] - v[15] * v[240]);
+    v[180] = v[16] * v[244] + v[15] * v[257] + (v[13] * v[239] - v[14] * v[238]);
+    v[248] = v[16] * v[176] + v[15] * v[258] + (v[13] * v[254] - v[14] * v[241]);
+    v[240] = v[240] * v[968] - v[399] + (v[401] - v[400]);
+    v[238] = v[17] * v[244] + v[16] * v[257] + (v[14] * v[239] + v[13] * v[238]);
+    v[239] = v[17] * v[176] + v[16] * v[258] + (v[14] * v[254] + v[13] * v[241]);
+    v[241] = v[13] * v[244] - v[14] * v[257];
+    v[249] = v[13] * v[176] - v[14] * v[258];
+    v[251] = v[407] - v[406];
+    v[244] = v[14] * v[244] + v[13] * v[257];
+    v[176] = v[14] * v[176] + v[13] * v[258];
+    v[254] = v[420] + (v[419] - v[15] * v[371]);
+    v[255] = v[16] * v[291] + v[15] * v[279] + (v[13] * v[275] - v[14] * v[272]);
+    v[257] = v[16] * v[292] + v[15] * v[280] + (v[13] * v[276] - v[14] * v[273]);
+    v[258] = v[371] * v[968] - v[415] + (v[417] - v[416]);
+    v[272] = v[17] * v[291] + v[16] * v[279] + (v[14] * v[275] + v[13] * v[272]);
+    v[273] = v[17] * v[292] + v[16] * v[280] + (v[14] * v[276] + v[13] * v[273]);
+    v[275] = v[13] * v[291] - v[14] * v[279];
+    v[276] = v[13] * v[292] - v[14] * v[280];
+    v[281] = v[423] - v[422];
+    v[279] = v[14] * v[291] + v[13] * v[279];
+    v[280] = v[14] * v[292] + v[13] * v[280];
+    v[283] = v[431] + (v[430] - v[15] * v[220]);
+    v[284] = v[15] * v[286] - v[16] * v[295] + (v[13] * v[246] - v[14] * v[245]);
+    v[291] = v[16] * v[186] + v[15] * v[170] + (v[13] * v[22] - v[14] * v[243]);
+    v[220] = v[220] * v[968] - v[426] + (v[428] - v[427]);
+    v[245] = v[16] * v[286] - v[17] * v[295] + (v[14] * v[246] + v[13] * v[245]);
+    v[22] = v[17] * v[186] + v[16] * v[170] + (v[14] * v[22] + v[13] * v[243]);
+    v[243] = -(v[13] * v[295]) - v[14] * v[286];
+    v[246] = v[13] * v[186] - v[14] * v[170];
+    v[292] = v[434] - v[433];
+    v[286] = v[13] * v[286] - v[14] * v[295];
+    v[170] = v[14] * v[186] + v[13] * v[170];
+    v[186] = v[429] * v[968] + v[17] * v[283] + (v[16] * v[254] - v[442]) + (v[14] * v[168] - v[443] + (v[444] + v[13] * v[145]));
+    v[295] = v[17] * v[284] + v[16] * v[255] + (v[14] * v[180] + v[13] * v[151]);
+    v[296] = v[17] * v[291] + v[16] * v[257] + (v[14] * v[248] + v[13] * v[156]);
+    v[298] = v[373] * v[968] - v[445] + (v[447] - v[446]);
+    v[299] = v[17] * v[282] + v[16] * v[277] + (v[14] * v[256] + v[13] * v[172]);
+    v[300] = v[17] * v[23] + v[16] * v[278] + (v[14] * v[173] + v[13] * v[159]);
+    v[302] = v[432] * v[968] + v[17] * v[220] + (v[16] * v[258] - v[448]) + (v[14] * v[240] - v[449] + (v[450] + v[13] * v[233]));
+    v[303] = v[17] * v[245] + v[16] * v[272] + (v[14] * v[238] + v[13] * v[157]);
+    v[304] = v[17] * v[22] + v[16] * v[273] + (v[14] * v[239] + v[13] * v[155]);
+    v[305] = v[470] + v[435] * v[968] + (v[471] - v[451]) + (v[409] - v[452] + (v[453] + v[398]));
+    v[306] = v[17] * v[243] + v[16] * v[275] + (v[14] * v[241] + v[13] * v[158]);
+    v[307] = v[17] * v[246] + v[16] * v[276] + (v[14] * v[249] + v[13] * v[235]);
+    v[311] = v[375] * v[968] - v[454] + (v[456] - v[455]);
+    v[313] = v[17] * v[285] + v[16] * v[293] + (v[14] * v[259] + v[13] * v[188]);
+    v[314] = v[17] * v[171] + v[16] * v[294] + (v[14] * v[175] + v[13] * v[167]);
+    v[315] = v[436] * v[968] + v[17] * v[292] + (v[16] * v[281] - v[458]) + (v[14] * v[251] - v[459] + (v[460] + v[13] * v[242]));
+    v[316] = v[17] * v[286] + v[16] * v[279] + (v[14] * v[244] + v[13] * v[169]);
+    v[321] = v[17] * v[170] + v[16] * v[280] + (v[14] * v[176] + v[13] * v[162]);
+    v[325] = v[253] * v[968] + v[17] * v[109] + (v[16] * v[153] - v[494]) + (v[14] * v[91] - v[495] + (v[496] + v[13] * v[87]));
+    v[326] = v[17] * v[110] + v[16] * v[154] + (v[14] * v[108] + v[13] * v[114]);
+    v[327] = v[17] * v[134] + v[16] * v[160] + (v[14] * v[123] + v[13] * v[117]);
+    v[328] = v[17] * v[103] + v[16] * v[105] + (v[14] * v[99] + v[13] * v[100]);
+    v[329] = v[17] * v[107] + v[16] * v[192] + (v[14] * v[21] + v[13] * v[101]);
+    v[332] = v[17] * v[129] + v[16] * v[229] + (v[14] * v[26] + v[13] * v[24]);
+    v[343] = v[17] * v[351] + v[16] * v[350] + (v[14] * v[348] + v[13] * v[347]);
+    v[344] = v[17] * v[130] + v[16] * v[230] + (v[14] * v[142] + v[13] * v[119]);
+    v[353] = -(v[17] * v[231]) - v[16] * v[148] + (v[13] * v[126] - v[14] * v[127]);
+    v[354] = v[79] * v[60] + v[64] * v[1085] - (v[78] * v[1031] + v[66] * v[1079]) + (v[75] * v[1024] + v[61] * v[1067] - (v[73] * v[1027] + v[62] * v[1061])) + (v[17] * v[128] + v[16] * v[149] + (v[14] * v[138] + v[13] * v[25]));
+    v[356] = v[79] * v[1028] + v[64] * v[1086] - (v[78] * v[1032] + v[66] * v[1080]) + (v[75] * v[1022] + v[61] * v[1068] - (v[62] * v[1062] - v[73] * v[1025])) + (v[17] * v[131] + v[16] * v[150] + (v[14] * v[139] + v[13] * v[143]));
+    v[358] = v[79] * v[65] + v[64] * v[1087] - (v[78] * v[63] + v[66] * v[1081]) + (v[62] * v[75] + v[61] * v[1069] - (v[73] * v[59] + v[62] * v[1063])) + (v[17] * v[136] + v[16] * v[152] + (v[14] * v[140] + v[13] * v[144]));
+    v[359] = v[79] * v[1029] + v[64] * v[1088] - (v[78] * v[1033] + v[66] * v[1082]) + (v[75] * v[820] + v[61] * v[1070] - (v[73] * v[822] + v[62] * v[1064])) + (v[17] * v[111] + v[16] * v[161] + (v[14] * v[92] + v[13] * v[88]));
+    v[361] = v[79] * v[1030] + v[64] * v[1089] - (v[78] * v[1034] + v[66] * v[1083]) + (v[75] * v[1023] + v[61] * v[1071] - (v[62] * v[1065] - v[73] * v[1026])) + (v[17] * v[137] + v[16] * v[178] + (v[14] * v[124] + v[13] * v[89]));
+    v[367] = v[64] * v[1084] - v[66] * v[1078] + (v[9] * v[75] + v[61] * v[1066] - (v[10] * v[73] + v[62] * v[1060])) + (v[17] * v[146] + v[16] * v[190] + (v[14] * v[141] + v[13] * v[115]));
+    v[368] = -0.0061 * v[61] - -0.1809 * v[66] + (v[17] * v[94] + v[16] * v[191] + (v[14] * v[102] + v[13] * v[132]));
+    v[370] = -0.3 - v[368];
+    v[371] = v[503] * v[302];
+    v[374] = (v[186] - v[371]) / v[492];
+    v[380] = v[503] * v[303];
+    v[382] = (v[295] - v[380]) / v[492];
+    v[384] = v[503] * v[304];
+    v[386] = (v[296] - v[384]) / v[492];
+    v[388] = v[504] * v[302];
+    v[389] = (v[298] - v[388]) / v[492];
+    v[390] = v[504] * v[303];
+    v[392] = (v[299] - v[390]) / v[492];
+    v[393] = v[504] * v[304];
+    v[395] = (v[300] - v[393]) / v[492];
+    v[396] = v[505] * v[302];
+    v[399] = (v[302] - v[396]) / v[492];
+    v[400] = v[505] * v[303];
+    v[401] = (v[303] - v[400]) / v[492];
+    v[403] = v[505] * v[304];
+    v[404] = (v[304] - v[403]) / v[492];
+    v[406] = v[506] * v[302];
+    v[407] = (v[305] - v[406]) / v[492];
+    v[415] = v[506] * v[303];
+    v[416] = (v[306] - v[415]) / v[492];
+    v[417] = v[506] * v[304];
+    v[419] = (v[307] - v[417]) / v[492];
+    v[420] = v[507] * v[302];
+    v[422] = (v[311] - v[420]) / v[492];
+    v[423] = v[507] * v[303];
+    v[426] = (v[313] - v[423]) / v[492];
+    v[427] = v[507] * v[304];
+    v[428] = (v[314] - v[427]) / v[492];
+    v[430] = v[508] * v[302];
+    v[431] = (v[315] - v[430]) / v[492];
+    v[433] = v[508] * v[303];
+    v[434] = (v[316] - v[433]) / v[492];
+    v[442] = v[508] * v[304];
+    v[443] = (v[321] - v[442]) / v[492];
+    v[145] = v[16] * v[283] - v[15] * v[429] + (v[461] + v[15] * v[254]) + (v[402] + v[13] * v[168] - (v[14] * v[145] - v[391])) - (v[503] * v[186] + v[462] * v[374]);
+    v[151] = v[16] * v[284] + v[15] * v[255] + (v[13] * v[180] - v[14] * v[151]) - (v[503] * v[295] + v[462] * v[382]);
+    v[156] = v[16] * v[291] + v[15] * v[257] + (v[13] * v[248] - v[14] * v[156]) - (v[503] * v[296] + v[462] * v[386]);
+    v[168] = v[464] + (v[463] - v[15] * v[373]) - (v[503] * v[298] + v[491] * v[374]);
+    v[180] = v[16] * v[282] + v[15] * v[277] + (v[13] * v[256] - v[14] * v[172]) - (v[503] * v[299] + v[491] * v[382]);
+    v[248] = v[16] * v[23] + v[15] * v[278] + (v[13] * v[173] - v[14] * v[159]) - (v[503] * v[300] + v[491] * v[386]);
+    v[233] = v[16] * v[220] - v[15] * v[432] + (v[465] + v[15] * v[258]) + (v[405] + v[13] * v[240] - (v[14] * v[233] - v[394])) - (v[371] + v[492] * v[374]);
+    v[157] = v[16] * v[245] + v[15] * v[272] + (v[13] * v[238] - v[14] * v[157]) - (v[380] + v[492] * v[382]);
+    v[155] = v[16] * v[22] + v[15] * v[273] + (v[13] * v[239] - v[14] * v[155]) - (v[384] + v[492] * v[386]);
+    v[238] = v[457] - v[15] * v[435] + (v[458] + v[466]) + (v[459] + v[408] - (v[460] - v[397])) - (v[503] * v[305] + v[493] * v[374]);
+    v[158] = v[16] * v[243] + v[15] * v[275] + (v[13] * v[241] - v[14] * v[158]) - (v[503] * v[306] + v[493] * v[382]);
+    v[235] = v[16] * v[246] + v[15] * v[276] + (v[13] * v[249] - v[14] * v[235]) - (v[503] * v[307] + v[493] * v[386]);
+    v[239] = v[468] + (v[467] - v[15] * v[375]) - (v[503] * v[311] + v[469] * v[374]);
+    v[240] = v[16] * v[285] + v[15] * v[293] + (v[13] * v[259] - v[14] * v[188]) - (v[503] * v[313] + v[469] * v[382]);
+    v[241] = v[16] * v[171] + v[15] * v[294] + (v[13] * v[175] - v[14] * v[167]) - (v[503] * v[314] + v[469] * v[386]);
+    v[242] = v[16] * v[292] - v[15] * v[436] + (v[471] + v[15] * v[281]) + (v[409] + v[13] * v[251] - (v[14] * v[242] - v[398])) - (v[503] * v[315] + v[472] * v[374]);
+    v[169] = v[16] * v[286] + v[15] * v[279] + (v[13] * v[244] - v[14] * v[169]) - (v[503] * v[316] + v[472] * v[382]);
+    v[162] = v[16] * v[170] + v[15] * v[280] + (v[13] * v[176] - v[14] * v[162]) - (v[503] * v[321] + v[472] * v[386]);
+    v[176] = v[363] + (v[413] - v[15] * v[366]) - (v[504] * v[186] + v[462] * v[389]);
+    v[244] = v[16] * v[269] + v[15] * v[267] + (v[13] * v[263] - v[14] * v[260]) - (v[504] * v[295] + v[462] * v[392]);
+    v[249] = v[16] * v[270] + v[15] * v[268] + (v[13] * v[264] - v[14] * v[262]) - (v[504] * v[296] + v[462] * v[395]);
+    v[251] = v[504] * v[298] + v[491] * v[389];
+    v[363] = v[261] - (v[1206] + v[336] * v[1207]) - (v[504] * v[299] + v[491] * v[392]);
+    v[371] = v[252] - (v[1208] + v[336] * v[1209]) - (v[504] * v[300] + v[491] * v[395]);
+    v[366] = v[366] * v[968] - v[410] + (v[412] - v[411]) - (v[388] + v[492] * v[389]);
+    v[260] = v[17] * v[269] + v[16] * v[267] + (v[14] * v[263] + v[13] * v[260]) - (v[390] + v[492] * v[392]);
+    v[262] = v[17] * v[270] + v[16] * v[268] + (v[14] * v[264] + v[13] * v[262]) - (v[393] + v[492] * v[395]);
+    v[263] = v[365] - (v[504] * v[305] + v[493] * v[389]);
+    v[264] = v[13] * v[269] - v[14] * v[267] - (v[504] * v[306] + v[493] * v[392]);
+    v[365] = v[13] * v[270] - v[14] * v[268] - (v[504] * v[307] + v[493] * v[395]);
+    v[374] = v[504] * v[311] + v[469] * v[389];
+    v[380] = v[288] - (v[349] * v[288] + v[312] * v[1207]) - (v[504] * v[313] + v[469] * v[392]);
+    v[382] = v[287] - (v[349] * v[287] + v[312] * v[1209]) - (v[504] * v[314] + v[469] * v[395]);
+    v[364] = v[414] - v[364] - (v[504] * v[315] + v[472] * v[389]);
+    v[267] = v[14] * v[269] + v[13] * v[267] - (v[504] * v[316] + v[472] * v[392]);
+    v[268] = v[14] * v[270] + v[13] * v[268] - (v[504] * v[321] + v[472] * v[395]);
+    v[269] = v[186] - (v[505] * v[186] + v[462] * v[399]);
+    v[270] = v[295] - (v[505] * v[295] + v[462] * v[401]);
+    v[384] = v[296] - (v[505] * v[296] + v[462] * v[404]);
+    v[386] = v[298] - (v[505] * v[298] + v[491] * v[399]);
+    v[388] = v[299] - (v[505] * v[299] + v[491] * v[401]);
+    v[389] = v[300] - (v[505] * v[300] + v[491] * v[404]);
+    v[390] = v[305] - (v[505] * v[305] + v[493] * v[399]);
+    v[391] = v[306] - (v[505] * v[306] + v[493] * v[401]);
+    v[392] = v[307] - (v[505] * v[307] + v[493] * v[404]);
+    v[393] = v[311] - (v[505] * v[311] + v[469] * v[399]);
+    v[394] = v[313] - (v[505] * v[313] + v[469] * v[401]);
+    v[395] = v[314] - (v[505] * v[314] + v[469] * v[404]);
+    v[397] = v[315] - (v[505] * v[315] + v[472] * v[399]);
+    v[398] = v[316] - (v[505] * v[316] + v[472] * v[401]);
+    v[402] = v[321] - (v[505] * v[321] + v[472] * v[404]);
+    v[405] = v[485] + v[13] * v[283] - (v[14] * v[254] - v[418]) - (v[506] * v[186] + v[462] * v[407]);
+    v[408] = v[13] * v[284] - v[14] * v[255] - (v[506] * v[295] + v[462] * v[416]);
+    v[409] = v[13] * v[291] - v[14] * v[257] - (v[506] * v[296] + v[462] * v[419]);
+    v[410] = v[486] - (v[506] * v[298] + v[491] * v[407]);
+    v[411] = v[13] * v[282] - v[14] * v[277] - (v[506] * v[299] + v[491] * v[416]);
+    v[412] = v[13] * v[23] - v[14] * v[278] - (v[506] * v[300] + v[491] * v[419]);
+    v[406] = v[487] + v[13] * v[220] - (v[14] * v[258] - v[421]) - (v[406] + v[492] * v[407]);
+    v[413] = v[13] * v[245] - v[14] * v[272] - (v[415] + v[492] * v[416]);
+    v[414] = v[13] * v[22] - v[14] * v[273] - (v[417] + v[492] * v[419]);
+    v[415] = v[483] + v[488] - (v[484] - v[424]) - (v[506] * v[305] + v[493] * v[407]);
+    v[417] = v[13] * v[243] - v[14] * v[275] - (v[506] * v[306] + v[493] * v[416]);
+    v[418] = v[13] * v[246] - v[14] * v[276] - (v[506] * v[307] + v[493] * v[419]);
+    v[421] = v[489] - (v[506] * v[311] + v[469] * v[407]);
+    v[424] = v[13] * v[285] - v[14] * v[293] - (v[506] * v[313] + v[469] * v[416]);
+    v[429] = v[13] * v[171] - v[14] * v[294] - (v[506] * v[314] + v[469] * v[419]);
+    v[407] = v[490] + v[13] * v[292] - (v[14] * v[281] - v[425]) - (v[506] * v[315] + v[472] * v[407]);
+    v[416] = v[13] * v[286] - v[14] * v[279] - (v[506] * v[316] + v[472] * v[416]);
+    v[419] = v[13] * v[170] - v[14] * v[280] - (v[506] * v[321] + v[472] * v[419]);
+    v[376] = v[376] + (v[440] - v[15] * v[379]) - (v[507] * v[186] + v[462] * v[422]);
+    v[432] = v[16] * v[290] + v[15] * v[237] + (v[13] * v[226] - v[14] * v[183]) - (v[507] * v[295] + v[462] * v[426]);
+    v[435] = v[16] * v[187] + v[15] * v[236] + (v[13] * v[234] - v[14] * v[225]) - (v[507] * v[296] + v[462] * v[428]);
+    v[436] = v[507] * v[298] + v[491] * v[422];
+    v[271] = v[289] + (v[318] + v[18] * v[271]) - (v[1218] + v[336] * v[1219]) - (v[507] * v[299] + v[491] * v[426]);
+    v[177] = v[18] * v[177] - (v[1220] + v[336] * v[1221]) - (v[507] * v[300] + v[491] * v[428]);
+    v[289] = v[379] * v[968] - v[437] + (v[439] - v[438]) - (v[420] + v[492] * v[422]);
+    v[183] = v[17] * v[290] + v[16] * v[237] + (v[14] * v[226] + v[13] * v[183]) - (v[423] + v[492] * v[426]);
+    v[225] = v[17] * v[187] + v[16] * v[236] + (v[14] * v[234] + v[13] * v[225]) - (v[427] + v[492] * v[428]);
+    v[226] = v[378] - (v[507] * v[305] + v[493] * v[422]);
+    v[234] = v[13] * v[290] - v[14] * v[237] - (v[507] * v[306] + v[493] * v[426]);
+    v[318] = v[13] * v[187] - v[14] * v[236] - (v[507] * v[307] + v[493] * v[428]);
+    v[378] = v[507] * v[311] + v[469] * v[422];
+    v[322] = -v[322] - v[330] + (v[323] + v[331]) - (v[352] * v[288] + v[312] * v[1219]) - (v[507] * v[313] + v[469] * v[426]);
+    v[179] = v[18] * v[179] - (v[352] * v[287] + v[312] * v[1221]) - (v[507] * v[314] + v[469] * v[428]);
+    v[323] = v[441] - v[377] - (v[507] * v[315] + v[472] * v[422]);
+    v[237] = v[14] * v[290] + v[13] * v[237] - (v[507] * v[316] + v[472] * v[426]);
+    v[187] = v[14] * v[187] + v[13] * v[236] - (v[507] * v[321] + v[472] * v[428]);
+    v[236] = v[14] * v[283] - v[473] + (v[474] + v[13] * v[254]) - (v[508] * v[186] + v[462] * v[431]);
+    v[254] = v[14] * v[284] + v[13] * v[255] - (v[508] * v[295] + v[462] * v[434]);
+    v[255] = v[14] * v[291] + v[13] * v[257] - (v[508] * v[296] + v[462] * v[443]);
+    v[257] = v[476] - v[475] - (v[508] * v[298] + v[491] * v[431]);
+    v[283] = v[14] * v[282] + v[13] * v[277] - (v[508] * v[299] + v[491] * v[434]);
+    v[284] = v[14] * v[23] + v[13] * v[278] - (v[508] * v[300] + v[491] * v[443]);
+    v[290] = v[490] - v[479] + (v[480] + v[425]) - (v[508] * v[305] + v[493] * v[431]);
+    v[243] = v[14] * v[243] + v[13] * v[275] - (v[508] * v[306] + v[493] * v[434]);
+    v[246] = v[14] * v[246] + v[13] * v[276] - (v[508] * v[307] + v[493] * v[443]);
+    v[275] = v[482] - v[481] - (v[508] * v[311] + v[469] * v[431]);
+    v[276] = v[14] * v[285] + v[13] * v[293] - (v[508] * v[313] + v[469] * v[434]);
+    v[291] = v[14] * v[171] + v[13] * v[294] - (v[508] * v[314] + v[469] * v[443]);
+    v[281] = v[14] * v[292] - v[483] + (v[484] + v[13] * v[281]) - (v[508] * v[315] + v[472] * v[431]);
+    v[279] = v[14] * v[286] + v[13] * v[279] - (v[508] * v[316] + v[472] * v[434]);
+    v[170] = v[14] * v[170] + v[13] * v[280] - (v[508] * v[321] + v[472] * v[443]);
+    v[25] = v[80] * v[1031] + v[66] * v[1092] - (v[79] * v[1035] + v[67] * v[1085]) + (v[76] * v[1027] + v[62] * v[1073] - (v[68] * v[1067] - v[75] * v[979])) + (v[16] * v[128] + v[15] * v[149] + (v[13] * v[138] - v[14] * v[25])) + (v[526] * v[1050] - v[532] * v[1055] + (v[509] * v[1039] - v[515] * v[1045])) - v[462] * v[354] / v[492];
+    v[138] = v[80] * v[1032] + v[66] * v[1093] - (v[79] * v[1036] + v[67] * v[1086]) + (v[62] * v[1074] - v[76] * v[1025] - (v[68] * v[1068] - v[75] * v[36])) + (v[16] * v[131] + v[15] * v[150] + (v[13] * v[139] - v[14] * v[143])) + (v[526] * v[1051] - v[532] * v[1056] + (-(v[509] * v[1040]) - v[515] * v[1046])) - v[462] * v[356] / v[492];
+    v[63] = v[80] * v[63] + v[66] * v[1090] - v[67] * v[1087] + (v[76] * v[59] + v[62] * v[1075] - v[68] * v[1069]) + (v[16] * v[136] + v[15] * v[152] + (v[13] * v[140] - v[14] * v[144])) + (v[526] * v[1052] - v[532] * v[1057] + (v[509] * v[1041] - v[69] * v[515])) - v[462] * v[358] / v[492];
+    v[87] = (v[502] * v[186] - v[462] * v[325] - v[543] * v[302]) / v[492] + (v[16] * v[109] - v[15] * v[253] + (v[497] + v[15] * v[153]) + (v[228] + v[13] * v[91] - (v[14] * v[87] - v[381])) + (v[71] * v[405] - v[72] * v[376] + (v[69] * v[145] - v[70] * v[176])));
+    v[91] = (v[502] * v[295] - v[462] * v[326] - v[543] * v[303]) / v[492] + (v[16] * v[110] + v[15] * v[154] + (v[13] * v[108] - v[14] * v[114]) + (v[71] * v[408] - v[72] * v[432] + (v[69] * v[151] - v[70] * v[244])));
+    v[108] = (v[502] * v[296] - v[462] * v[327] - v[543] * v[304]) / v[492] + (v[16] * v[134] + v[15] * v[160] + (v[13] * v[123] - v[14] * v[117]) + (v[71] * v[409] - v[72] * v[435] + (v[69] * v[156] - v[70] * v[249])));
+    v[88] = v[80] * v[1033] + v[66] * v[1094] - (v[79] * v[1037] + v[67] * v[1088]) + (v[76] * v[822] + v[62] * v[1076] - (v[68] * v[1070] - v[75] * v[821])) + (v[16] * v[111] + v[15] * v[161] + (v[13] * v[92] - v[14] * v[88])) + (v[526] * v[1053] - v[532] * v[1058] + (v[509] * v[1042] - v[515] * v[1047])) - v[462] * v[359] / v[492];
+    v[89] = v[80] * v[1034] + v[66] * v[1095] - (v[79] * v[1038] + v[67] * v[1089]) + (v[62] * v[1077] - v[76] * v[1026] - (v[68] * v[1071] - v[5] * v[75])) + (v[16] * v[137] + v[15] * v[178] + (v[13] * v[124] - v[14] * v[89])) + (v[526] * v[1054] - v[532] * v[1059] + (-(v[509] * v[1043]) - v[515] * v[1048])) - v[462] * v[361] / v[492];
+    v[92] = v[66] * v[1091] - v[67] * v[1084] + (v[10] * v[76] + v[62] * v[1072] - v[68] * v[1066]) + (v[16] * v[146] + v[15] * v[190] + (v[13] * v[141] - v[14] * v[115])) + (v[509] * v[1044] - v[515] * v[1049]) - v[462] * v[367] / v[492];
+    v[74] = v[462] * v[370] / v[492] + (0.0411 * v[62] - (v[74] + v[75]) + (v[16] * v[94] + v[15] * v[191] + (v[13] * v[102] - v[14] * v[132])) + (v[66] * v[526] - v[64] * v[532] + (v[62] * v[509] - v[61] * v[515])));
+    v[75] = v[16] * v[103] + v[15] * v[105] + (v[13] * v[99] - v[14] * v[100]) - v[462] * v[328] / v[492];
+    v[21] = v[16] * v[107] + v[15] * v[192] + (v[13] * v[21] - v[14] * v[101]) - v[462] * v[329] / v[492];
+    v[24] = v[16] * v[129] + v[15] * v[229] + (v[13] * v[26] - v[14] * v[24]) - v[462] * v[332] / v[492];
+    v[26] = v[16] * v[351] + v[15] * v[350] + (v[13] * v[348] - v[14] * v[347]) - v[462] * v[343] / v[492];
+    v[99] = v[16] * v[130] + v[15] * v[230] + (v[13] * v[142] - v[14] * v[119]) - v[462] * v[344] / v[492];
+    v[100] = -(v[16] * v[231]) - v[15] * v[148] + (-(v[13] * v[127]) - v[14] * v[126]) - v[462] * v[353] / v[492];
+    v[60] = v[78] * v[1035] + v[67] * v[1079] - (v[80] * v[60] + v[64] * v[1092]) + (v[68] * v[1061] - v[73] * v[979] - (v[76] * v[1024] + v[61] * v[1073])) + (v[320] + (v[369] * v[1131] - v[373] * v[1139] + (v[355] * v[1116] - v[360] * v[1124])) - v[336] * v[320] / v[336]) + (v[527] * v[1050] - v[533] * v[1055] + (v[510] * v[1039] - v[516] * v[1045])) - v[491] * v[354] / v[492];
+    v[101] = v[78] * v[1036] + v[67] * v[1080] - (v[80] * v[1028] + v[64] * v[1093]) + (v[68] * v[1062] - v[73] * v[36] - (v[76] * v[1022] + v[61] * v[1074])) + (v[324] + (v[369] * v[1132] - v[373] * v[1140] + (v[355] * v[1117] - v[360] * v[1125])) - v[336] * v[324] / v[336]) + (v[527] * v[1051] - v[533] * v[1056] + (-(v[510] * v[1040]) - v[516] * v[1046])) - v[491] * v[356] / v[492];
+    v[65] = v[67] * v[1081] - (v[80] * v[65] + v[64] * v[1090]) + (v[68] * v[1063] - (v[81] + v[61] * v[1075])) + (v[333] + (v[369] * v[1133] - v[373] * v[1141] + (v[360] * v[1126] + v[355] * v[1118])) - v[336] * v[333] / v[336]) + (v[527] * v[1052] - v[533] * v[1057] + (v[510] * v[1041] - v[69] * v[516])) - v[491] * v[358] / v[492];
+    v[81] = (v[502] * v[298] - v[491] * v[325] - v[545] * v[302]) / v[492] + (v[334] + (v[369] * v[1134] - v[373] * v[1142] + (v[355] * v[1119] - v[95] * v[360])) - v[336] * v[334] / v[336] + (v[72] * v[436] + v[71] * v[410] + (v[70] * v[251] + v[69] * v[168])));
+    v[102] = (v[502] * v[299] - v[491] * v[326] - v[545] * v[303]) / v[492] + ((v[346] * v[261] - v[336] * v[309] - v[383] * v[261]) / v[336] + (v[309] + (v[97] * v[277] - v[98] * v[282] + (v[95] * v[172] - v[96] * v[256]))) + (v[71] * v[411] - v[72] * v[271] + (v[69] * v[180] - v[70] * v[363])));
+    v[23] = (v[502] * v[300] - v[491] * v[327] - v[545] * v[304]) / v[492] + ((v[346] * v[252] - v[336] * v[310] - v[383] * v[252]) / v[336] + (v[310] + (v[97] * v[278] - v[98] * v[23] + (v[95] * v[159] - v[96] * v[173]))) + (v[71] * v[412] - v[72] * v[177] + (v[69] * v[248] - v[70] * v[371])));
+    v[114] = v[78] * v[1037] + v[67] * v[1082] - (v[80] * v[1029] + v[64] * v[1094]) + (v[68] * v[1064] - v[73] * v[821] - (v[76] * v[820] + v[61] * v[1076])) + (v[339] + (v[369] * v[1135] - v[373] * v[1143] + (v[355] * v[1120] - v[360] * v[1127])) - v[336] * v[339] / v[336]) + (v[527] * v[1053] - v[533] * v[1058] + (v[510] * v[1042] - v[516] * v[1047])) - v[491] * v[359] / v[492];
+    v[115] = v[78] * v[1038] + v[67] * v[1083] - (v[80] * v[1030] + v[64] * v[1095]) + (v[68] * v[1065] - v[5] * v[73] - (v[76] * v[1023] + v[61] * v[1077])) + (v[340] + (v[369] * v[1136] - v[373] * v[1144] + (v[355] * v[1121] - v[360] * v[1128])) - v[336] * v[340] / v[336]) + (v[527] * v[1054] - v[533] * v[1059] + (-(v[510] * v[1043]) - v[516] * v[1048])) - v[491] * v[361] / v[492];
+    v[76] = v[67] * v[1078] - v[64] * v[1091] + (v[68] * v[1060] - (v[9] * v[76] + v[61] * v[1072])) + (v[971] + (v[369] * v[1137] - v[373] * v[1145] + (v[360] * v[1129] + v[355] * v[1122])) - v[336] * v[971] / v[336]) + (v[510] * v[1044] - v[516] * v[1049]) - v[491] * v[367] / v[492];
+    v[67] = v[491] * v[370] / v[492] + (-0.1809 * v[67] + (v[73] - 0.0411 * v[61]) + (v[1195] + (v[369] * v[1138] - v[373] * v[1146] + (v[355] * v[1123] - v[360] * v[1130])) - v[336] * v[1195] / v[336]) + (v[66] * v[527] - v[64] * v[533] + (v[62] * v[510] - v[61] * v[516])));
+    v[73] = v[336] * v[1197] / v[336] + (v[1196] + (v[93] * v[369] - v[90] * v[373] + (v[86] * v[355] - v[85] * v[360]))) - v[491] * v[328] / v[492];
+    v[117] = v[317] - v[336] * v[317] / v[336] - v[491] * v[329] / v[492];
+    v[119] = v[319] - v[336] * v[319] / v[336] - v[491] * v[332] / v[492];
+    v[123] = v[349] - v[491] * v[343] / v[492];
+    v[124] = v[301] - v[336] * v[301] / v[336] - v[491] * v[344] / v[492];
+    v[126] = v[19] - v[19] * v[336] / v[336] - v[491] * v[353] / v[492];
+    v[127] = v[80] * v[1027] + v[62] * v[1092] - (v[68] * v[1085] - v[79] * v[979]) + (v[13] * v[128] - v[14] * v[149]) + (v[529] * v[1050] - v[535] * v[1055] + (v[512] * v[1039] - v[518] * v[1045])) - v[493] * v[354] / v[492];
+    v[132] = v[62] * v[1093] - v[80] * v[1025] - (v[68] * v[1086] - v[79] * v[36]) + (v[13] * v[131] - v[14] * v[150]) + (v[529] * v[1051] - v[535] * v[1056] + (-(v[512] * v[1040]) - v[518] * v[1046])) - v[493] * v[356] / v[492];
+    v[139] = v[80] * v[59] + v[62] * v[1090] - v[68] * v[1087] + (v[13] * v[136] - v[14] * v[152]) + (v[529] * v[1052] - v[535] * v[1057] + (v[512] * v[1041] - v[69] * v[518])) - v[493] * v[358] / v[492];
+    v[140] = (v[502] * v[305] - v[493] * v[325] - v[547] * v[302]) / v[492] + (v[500] + v[13] * v[109] - (v[14] * v[153] - v[385]) + (v[71] * v[415] - v[72] * v[226] + (v[69] * v[238] - v[70] * v[263])));
+    v[141] = (v[502] * v[306] - v[493] * v[326] - v[547] * v[303]) / v[492] + (v[13] * v[110] - v[14] * v[154] + (v[71] * v[417] - v[72] * v[234] + (v[69] * v[158] - v[70] * v[264])));
+    v[142] = (v[502] * v[307] - v[493] * v[327] - v[547] * v[304]) / v[492] + (v[13] * v[134] - v[14] * v[160] + (v[71] * v[418] - v[72] * v[318] + (v[69] * v[235] - v[70] * v[365])));
+    v[143] = v[80] * v[822] + v[62] * v[1094] - (v[68] * v[1088] - v[79] * v[821]) + (v[13] * v[111] - v[14] * v[161]) + (v[529] * v[1053] - v[535] * v[1058] + (v[512] * v[1042] - v[518] * v[1047])) - v[493] * v[359] / v[492];
+    v[144] = v[62] * v[1095] - v[80] * v[1026] - (v[68] * v[1089] - v[5] * v[79]) + (v[13] * v[137] - v[14] * v[178]) + (v[529] * v[1054] - v[535] * v[1059] + (-(v[512] * v[1043]) - v[518] * v[1048])) - v[493] * v[361] / v[492];
+    v[159] = v[10] * v[80] + v[62] * v[1091] - v[68] * v[1084] + (v[13] * v[146] - v[14] * v[190]) + (v[512] * v[1044] - v[518] * v[1049]) - v[493] * v[367] / v[492];
+    v[172] = v[493] * v[370] / v[492] + (v[13] * v[94] - v[14] * v[191] - v[79] + (v[66] * v[529] - v[64] * v[535] + (v[62] * v[512] - v[61] * v[518])));
+    v[173] = v[13] * v[103] - v[14] * v[105] - v[493] * v[328] / v[492];
+    v[228] = v[13] * v[107] - v[14] * v[192] - v[493] * v[329] / v[492];
+    v[253] = v[13] * v[129] - v[14] * v[229] - v[493] * v[332] / v[492];
+    v[256] = v[13] * v[351] - v[14] * v[350] - v[493] * v[343] / v[492];
+    v[277] = v[13] * v[130] - v[14] * v[230] - v[493] * v[344] / v[492];
+    v[278] = v[14] * v[148] - v[13] * v[231] - v[493] * v[353] / v[492];
+    v[125] = v[68] * v[1079] - v[78] * v[979] - (v[80] * v[1024] + v[61] * v[1092]) + (v[106] * v[1098] + v[85] * v[1179] - (v[104] * v[1104] + v[86] * v[1171]) + (v[19] * v[209] + v[18] * v[125]) + (v[372] * v[1131] - v[375] * v[1139] + (v[357] * v[1116] - v[362] * v[1124])) - v[312] * v[320] / v[336]) + (v[530] * v[1050] - v[536] * v[1055] + (v[513] * v[1039] - v[519] * v[1045])) - v[469] * v[354] / v[492];
+    v[164] = v[68] * v[1080] - v[78] * v[36] - (v[80] * v[1022] + v[61] * v[1093]) + (v[106] * v[1099] + v[85] * v[1180] - (v[104] * v[1105] + v[86] * v[1172]) + (v[19] * v[210] + v[18] * v[164]) + (v[372] * v[1132] - v[375] * v[1140] + (v[357] * v[1117] - v[362] * v[1125])) - v[312] * v[324] / v[336]) + (v[530] * v[1051] - v[536] * v[1056] + (-(v[513] * v[1040]) - v[519] * v[1046])) - v[469] * v[356] / v[492];
+    v[82] = v[68] * v[1081] - (v[82] + v[61] * v[1090]) + (v[85] * v[1181] - v[106] * v[1096] - (v[104] * v[1102] + v[86] * v[1173]) + (v[19] * v[215] + v[18] * v[165]) + (v[372] * v[1133] - v[375] * v[1141] + (v[362] * v[1126] + v[357] * v[1118])) - v[312] * v[333] / v[336]) + (v[530] * v[1052] - v[536] * v[1057] + (v[513] * v[1041] - v[69] * v[519])) - v[469] * v[358] / v[492];
+    v[83] = (v[502] * v[311] - v[469] * v[325] - v[549] * v[302]) / v[492] + (v[86] * v[106] + v[85] * v[1182] - (v[104] * v[83] + v[86] * v[1174]) + (v[19] * v[216] + v[18] * v[166]) + (v[372] * v[1134] - v[375] * v[1142] + (v[357] * v[1119] - v[95] * v[362])) - v[312] * v[334] / v[336] + (v[72] * v[378] + v[71] * v[421] + (v[70] * v[374] + v[69] * v[239])));
+    v[133] = (v[502] * v[313] - v[469] * v[326] - v[549] * v[303]) / v[492] + ((v[346] * v[288] - v[312] * v[309] - v[387] * v[261]) / v[336] + (v[19] * v[133] - v[341] + (v[342] + v[18] * v[174]) + (v[97] * v[293] - v[98] * v[285] + (v[95] * v[188] - v[96] * v[259]))) + (v[71] * v[424] - v[72] * v[322] + (v[69] * v[240] - v[70] * v[380])));
+    v[96] = (v[502] * v[314] - v[469] * v[327] - v[549] * v[304]) / v[492] + ((v[346] * v[287] - v[312] * v[310] - v[387] * v[252]) / v[336] + (v[19] * v[1486] + v[18] * v[147] + (v[97] * v[294] - v[98] * v[171] + (v[95] * v[167] - v[96] * v[175]))) + (v[71] * v[429] - v[72] * v[179] + (v[69] * v[241] - v[70] * v[382])));
+    v[84] = v[68] * v[1082] - v[78] * v[821] - (v[80] * v[820] + v[61] * v[1094]) + (v[106] * v[1100] + v[85] * v[1183] - (v[104] * v[84] + v[86] * v[1175]) + (v[19] * v[135] + v[18] * v[193]) + (v[372] * v[1135] - v[375] * v[1143] + (v[357] * v[1120] - v[362] * v[1127])) - v[312] * v[339] / v[336]) + (v[530] * v[1053] - v[536] * v[1058] + (v[513] * v[1042] - v[519] * v[1047])) - v[469] * v[359] / v[492];
+    v[97] = v[68] * v[1083] - v[5] * v[78] - (v[80] * v[1023] + v[61] * v[1095]) + (v[106] * v[1101] + v[85] * v[1184] - (v[104] * v[1106] + v[86] * v[1176]) + (v[19] * v[217] + v[18] * v[198]) + (v[372] * v[1136] - v[375] * v[1144] + (v[357] * v[1121] - v[362] * v[1128])) - v[312] * v[340] / v[336]) + (v[530] * v[1054] - v[536] * v[1059] + (-(v[513] * v[1043]) - v[519] * v[1048])) - v[469] * v[361] / v[492];
+    v[68] = v[68] * v[1078] - (v[9] * v[80] + v[61] * v[1091]) + (v[85] * v[1185] - v[106] * v[1097] - (v[104] * v[1103] + v[86] * v[1177]) + (v[19] * v[224] + v[18] * v[200]) + (v[372] * v[1137] - v[375] * v[1145] + (v[362] * v[1129] + v[357] * v[1122])) - v[312] * v[971] / v[336]) + (v[513] * v[1044] - v[519] * v[1049]) - v[469] * v[367] / v[492];
+    v[77] = v[469] * v[370] / v[492] + (v[77] + v[78] + (v[13] * v[106] + v[85] * v[1186] - (v[14] * v[104] + v[86] * v[1178]) + (v[19] * v[227] + v[18] * v[201]) + (v[372] * v[1138] - v[375] * v[1146] + (v[357] * v[1123] - v[362] * v[1130])) - v[312] * v[1195] / v[336]) + (v[66] * v[530] - v[64] * v[536] + (v[62] * v[513] - v[61] * v[519])));
+    v[80] = v[312] * v[1197] / v[336] + (0.00017 * v[85] - -0.0357 * v[86] + (v[19] * v[120] + v[18] * v[202]) + (v[93] * v[372] - v[90] * v[375] + (v[86] * v[357] - v[85] * v[362]))) - v[469] * v[328] / v[492];
+    v[98] = v[19] * v[116] + v[18] * v[206] - v[312] * v[317] / v[336] - v[469] * v[329] / v[492];
+    v[104] = v[18] * v[207] - v[312] * v[319] / v[336] - v[469] * v[332] / v[492];
+    v[106] = v[352] - v[469] * v[343] / v[492];
+    v[116] = v[18] * v[232] - v[312] * v[301] / v[336] - v[469] * v[344] / v[492];
+    v[120] = -(v[469] * v[353] / v[492]) - v[19] * v[312] / v[336];
+    v[128] = v[79] * v[1024] + v[61] * v[1085] - (v[78] * v[1027] + v[62] * v[1079]) + (v[14] * v[128] + v[13] * v[149]) + (v[531] * v[1050] - v[537] * v[1055] + (v[514] * v[1039] - v[520] * v[1045])) - v[472] * v[354] / v[492];
+    v[131] = v[79] * v[1022] + v[61] * v[1086] - (v[62] * v[1080] - v[78] * v[1025]) + (v[14] * v[131] + v[13] * v[150]) + (v[531] * v[1051] - v[537] * v[1056] + (-(v[514] * v[1040]) - v[520] * v[1046])) - v[472] * v[356] / v[492];
+    v[59] = v[62] * v[79] + v[61] * v[1087] - (v[78] * v[59] + v[62] * v[1081]) + (v[14] * v[136] + v[13] * v[152]) + (v[531] * v[1052] - v[537] * v[1057] + (v[514] * v[1041] - v[69] * v[520])) - v[472] * v[358] / v[492];
+    v[109] = (v[502] * v[315] - v[472] * v[325] - v[551] * v[302]) / v[492] + (v[14] * v[109] - v[498] + (v[499] + v[13] * v[153]) + (v[71] * v[407] - v[72] * v[323] + (v[69] * v[242] - v[70] * v[364])));
+    v[110] = (v[502] * v[316] - v[472] * v[326] - v[551] * v[303]) / v[492] + (v[14] * v[110] + v[13] * v[154] + (v[71] * v[416] - v[72] * v[237] + (v[69] * v[169] - v[70] * v[267])));
+    v[134] = (v[502] * v[321] - v[472] * v[327] - v[551] * v[304]) / v[492] + (v[14] * v[134] + v[13] * v[160] + (v[71] * v[419] - v[72] * v[187] + (v[69] * v[162] - v[70] * v[268])));
+    v[111] = v[79] * v[820] + v[61] * v[1088] - (v[78] * v[822] + v[62] * v[1082]) + (v[14] * v[111] + v[13] * v[161]) + (v[531] * v[1053] - v[537] * v[1058] + (v[514] * v[1042] - v[520] * v[1047])) - v[472] * v[359] / v[492];
+    v[135] = v[79] * v[1023] + v[61] * v[1089] - (v[62] * v[1083] - v[78] * v[1026]) + (v[14] * v[137] + v[13] * v[178]) + (v[531] * v[1054] - v[537] * v[1059] + (-(v[514] * v[1043]) - v[520] * v[1048])) - v[472] * v[361] / v[492];
+    v[78] = v[9] * v[79] + v[61] * v[1084] - (v[10] * v[78] + v[62] * v[1078]) + (v[14] * v[146] + v[13] * v[190]) + (v[514] * v[1044] - v[520] * v[1049]) - v[472] * v[367] / v[492];
+    v[79] = v[472] * v[370] / v[492] + (v[14] * v[94] + v[13] * v[191] - -0.1809 * v[62] + (v[66] * v[531] - v[64] * v[537] + (v[62] * v[514] - v[61] * v[520])));
+    v[94] = v[14] * v[103] + v[13] * v[105] - v[472] * v[328] / v[492];
+    v[103] = v[14] * v[107] + v[13] * v[192] - v[472] * v[329] / v[492];
+    v[105] = v[14] * v[129] + v[13] * v[229] - v[472] * v[332] / v[492];
+    v[107] = v[14] * v[351] + v[13] * v[350] - v[472] * v[343] / v[492];
+    v[129] = v[14] * v[130] + v[13] * v[230] - v[472] * v[344] / v[492];
+    v[130] = -(v[14] * v[231]) - v[13] * v[148] - v[472] * v[353] / v[492];
+    v[136] = -v[557] - v[556];
+    v[137] = 0.2155 * v[242] + (v[10] * v[145] - v[9] * v[168]);
+    v[146] = 0.2155 * v[169] + (v[10] * v[151] - v[9] * v[180]);
+    v[147] = 0.2155 * v[162] + (v[10] * v[156] - v[9] * v[248]);
+    v[148] = v[513] * v[967] - v[512] * v[966];
+    v[149] = v[12] * v[239] + v[11] * v[238] - v[233];
+    v[150] = v[12] * v[240] + v[11] * v[158] - v[157];
+    v[152] = v[12] * v[241] + v[11] * v[235] - v[155];
+    v[145] = v[10] * v[168] + v[9] * v[145];
+    v[151] = v[10] * v[180] + v[9] * v[151];
+    v[153] = v[10] * v[248] + v[9] * v[156];
+    v[154] = -(v[9] * v[512]) - v[10] * v[513];
+    v[156] = v[10] * v[238] - v[9] * v[239];
+    v[158] = v[10] * v[158] - v[9] * v[240];
+    v[160] = v[10] * v[235] - v[9] * v[241];
+    v[161] = -v[564] - v[563];
+    v[165] = 0.2155 * v[364] + (v[9] * v[251] + v[10] * v[176]);
+    v[166] = 0.2155 * v[267] + (v[10] * v[244] - v[9] * v[363]);
+    v[167] = 0.2155 * v[268] + (v[10] * v[249] - v[9] * v[371]);
+    v[168] = v[519] * v[967] - v[518] * v[966];
+    v[171] = v[11] * v[263] - v[12] * v[374] - v[366];
+    v[174] = v[12] * v[380] + v[11] * v[264] - v[260];
+    v[175] = v[12] * v[382] + v[11] * v[365] - v[262];
+    v[176] = v[9] * v[176] - v[10] * v[251];
+    v[178] = v[10] * v[363] + v[9] * v[244];
+    v[180] = v[10] * v[371] + v[9] * v[249];
+    v[188] = -(v[9] * v[518]) - v[10] * v[519];
+    v[190] = v[9] * v[374] + v[10] * v[263];
+    v[191] = v[10] * v[264] - v[9] * v[380];
+    v[192] = v[10] * v[365] - v[9] * v[382];
+    v[193] = -v[572] - v[571];
+    v[198] = 0.2155 * v[407] + (v[10] * v[405] - v[9] * v[410]);
+    v[200] = 0.2155 * v[416] + (v[10] * v[408] - v[9] * v[411]);
+    v[201] = 0.2155 * v[419] + (v[10] * v[409] - v[9] * v[412]);
+    v[202] = v[530] * v[967] - v[529] * v[966];
+    v[206] = v[12] * v[421] + v[11] * v[415] - v[406];
+    v[207] = v[12] * v[424] + v[11] * v[417] - v[413];
+    v[209] = v[12] * v[429] + v[11] * v[418] - v[414];
+    v[210] = v[10] * v[410] + v[9] * v[405];
+    v[215] = v[10] * v[411] + v[9] * v[408];
+    v[216] = v[10] * v[412] + v[9] * v[409];
+    v[217] = -(v[9] * v[529]) - v[10] * v[530];
+    v[224] = v[10] * v[415] - v[9] * v[421];
+    v[227] = v[10] * v[417] - v[9] * v[424];
+    v[229] = v[10] * v[418] - v[9] * v[429];
+    v[230] = -v[579] - v[578];
+    v[231] = 0.2155 * v[323] + (v[9] * v[436] + v[10] * v[376]);
+    v[232] = 0.2155 * v[237] + (v[10] * v[432] - v[9] * v[271]);
+    v[235] = 0.2155 * v[187] + (v[10] * v[435] - v[9] * v[177]);
+    v[238] = v[536] * v[967] - v[535] * v[966];
+    v[239] = v[11] * v[226] - v[12] * v[378] - v[289];
+    v[240] = v[12] * v[322] + v[11] * v[234] - v[183];
+    v[241] = v[12] * v[179] + v[11] * v[318] - v[225];
+    v[244] = v[9] * v[376] - v[10] * v[436];
+    v[248] = v[10] * v[271] + v[9] * v[432];
+    v[177] = v[10] * v[177] + v[9] * v[435];
+    v[249] = -(v[9] * v[535]) - v[10] * v[536];
+    v[226] = v[9] * v[378] + v[10] * v[226];
+    v[234] = v[10] * v[234] - v[9] * v[322];
+    v[179] = v[10] * v[318] - v[9] * v[179];
+    v[251] = 0.2155 * v[281];
+    v[259] = 0.2155 * v[279];
+    v[263] = 0.2155 * v[170];
+    v[264] = -v[538] - v[539];
+    v[271] = v[251] + (v[10] * v[236] - v[9] * v[257]);
+    v[280] = v[259] + (v[10] * v[254] - v[9] * v[283]);
+    v[282] = v[263] + (v[10] * v[255] - v[9] * v[284]);
+    v[285] = v[541] * v[967] - v[540] * v[966];
+    v[220] = v[12] * v[275] + v[11] * v[290] - (v[14] * v[220] - v[477] + (v[478] + v[13] * v[258]) - (v[430] + v[492] * v[431]));
+    v[245] = v[12] * v[276] + v[11] * v[243] - (v[14] * v[245] + v[13] * v[272] - (v[433] + v[492] * v[434]));
+    v[22] = v[12] * v[291] + v[11] * v[246] - (v[14] * v[22] + v[13] * v[273] - (v[442] + v[492] * v[443]));
+    v[236] = v[10] * v[257] + v[9] * v[236];
+    v[254] = v[10] * v[283] + v[9] * v[254];
+    v[255] = v[10] * v[284] + v[9] * v[255];
+    v[257] = -(v[9] * v[540]) - v[10] * v[541];
+    v[258] = v[10] * v[290] - v[9] * v[275];
+    v[243] = v[10] * v[243] - v[9] * v[276];
+    v[246] = v[10] * v[246] - v[9] * v[291];
+    v[272] = v[10] * v[161] - v[588] + (v[589] + v[9] * v[136]);
+    v[273] = v[10] * v[165] + v[9] * v[137];
+    v[275] = v[10] * v[166] + v[9] * v[146];
+    v[276] = v[10] * v[167] + v[9] * v[147];
+    v[283] = v[10] * v[168] - v[590] + (v[591] + v[9] * v[148]);
+    v[284] = v[10] * v[171] + v[9] * v[149];
+    v[286] = v[10] * v[174] + v[9] * v[150];
+    v[290] = v[10] * v[175] + v[9] * v[152];
+    v[291] = v[10] * v[560] - v[592] + (v[593] + v[9] * v[553]);
+    v[292] = v[10] * v[176] + v[9] * v[145];
+    v[293] = v[10] * v[178] + v[9] * v[151];
+    v[294] = v[10] * v[180] + v[9] * v[153];
+    v[318] = v[10] * v[188] - v[594] + (v[595] + v[9] * v[154]);
+    v[322] = v[10] * v[190] + v[9] * v[156];
+    v[330] = v[10] * v[191] + v[9] * v[158];
+    v[331] = v[10] * v[192] + v[9] * v[160];
+    v[341] = -(v[9] * v[242]) - v[10] * v[364];
+    v[342] = -(v[9] * v[169]) - v[10] * v[267];
+    v[346] = -(v[9] * v[162]) - v[10] * v[268];
+    v[347] = v[10] * v[65] - v[604] + (v[605] + v[9] * v[63]);
+    v[348] = v[10] * v[81] + v[9] * v[87];
+    v[349] = v[10] * v[102] + v[9] * v[91];
+    v[350] = v[10] * v[23] + v[9] * v[108];
+    v[351] = v[10] * v[67] + v[9] * v[74];
+    v[352] = v[10] * v[73] + v[9] * v[75];
+    v[355] = v[10] * v[117] + v[9] * v[21];
+    v[357] = v[10] * v[119] + v[9] * v[24];
+    v[360] = v[10] * v[504] + v[9] * v[503];
+    v[362] = v[10] * v[123] + v[9] * v[26];
+    v[363] = v[10] * v[124] + v[9] * v[99];
+    v[365] = v[10] * v[126] + v[9] * v[100];
+    v[369] = v[55] * v[37] + v[41] * v[1014] - (v[54] * v[981] + v[43] * v[1010]) + (v[38] * v[1002] - v[51] * v[978] - (v[49] * v[979] + v[39] * v[998])) + (v[10] * v[60] + v[9] * v[25]);
+    v[371] = v[55] * v[42] + v[41] * v[1015] - (v[54] * v[40] + v[43] * v[1011]) + (v[39] * v[51] + v[38] * v[1003] - (v[49] * v[36] + v[39] * v[999])) + (v[10] * v[101] + v[9] * v[138]);
+    v[372] = v[55] * v[980] + v[41] * v[1016] - (v[54] * v[982] + v[43] * v[1012]) + (v[38] * v[1004] - v[51] * v[819] - (v[49] * v[821] + v[39] * v[1000])) + (v[10] * v[114] + v[9] * v[88]);
+    v[373] = v[7] * v[55] + v[41] * v[1017] - (v[8] * v[54] + v[43] * v[1013]) + (v[4] * v[51] + v[38] * v[1005] - (v[5] * v[49] + v[39] * v[1001])) + (v[10] * v[115] + v[9] * v[89]);
+    v[374] = -0.0117 * v[38] - -0.09 * v[43] + (v[10] * v[76] + v[9] * v[92]);
+    v[375] = -0.5 - v[374];
+    v[376] = v[608] * v[291];
+    v[377] = (v[272] - v[376]) / v[602];
+    v[378] = v[608] * v[292];
+    v[379] = (v[273] - v[378]) / v[602];
+    v[380] = v[608] * v[293];
+    v[381] = (v[275] - v[380]) / v[602];
+    v[382] = v[608] * v[294];
+    v[383] = (v[276] - v[382]) / v[602];
+    v[385] = v[609] * v[291];
+    v[387] = (v[283] - v[385]) / v[602];
+    v[405] = v[609] * v[292];
+    v[408] = (v[284] - v[405]) / v[602];
+    v[409] = v[609] * v[293];
+    v[410] = (v[286] - v[409]) / v[602];
+    v[411] = v[609] * v[294];
+    v[412] = (v[290] - v[411]) / v[602];
+    v[415] = v[610] * v[291];
+    v[417] = (v[291] - v[415]) / v[602];
+    v[418] = v[610] * v[292];
+    v[420] = (v[292] - v[418]) / v[602];
+    v[421] = v[610] * v[293];
+    v[422] = (v[293] - v[421]) / v[602];
+    v[423] = v[610] * v[294];
+    v[424] = (v[294] - v[423]) / v[602];
+    v[425] = v[611] * v[291];
+    v[426] = (v[318] - v[425]) / v[602];
+    v[427] = v[611] * v[292];
+    v[428] = (v[322] - v[427]) / v[602];
+    v[429] = v[611] * v[293];
+    v[430] = (v[330] - v[429]) / v[602];
+    v[431] = v[611] * v[294];
+    v[432] = (v[331] - v[431]) / v[602];
+    v[433] = v[612] * v[291];
+    v[434] = (v[596] - v[433]) / v[602];
+    v[435] = v[612] * v[292];
+    v[436] = (v[341] - v[435]) / v[602];
+    v[437] = v[612] * v[293];
+    v[438] = (v[342] - v[437]) / v[602];
+    v[439] = v[612] * v[294];
+    v[440] = (v[346] - v[439]) / v[602];
+    v[136] = 0.2155 * v[264] + (v[10] * v[136] - v[554] - (v[561] + v[9] * v[161])) - (v[608] * v[272] + v[597] * v[377]);
+    v[137] = 0.2155 * v[271] + (v[10] * v[137] - v[9] * v[165]) - (v[608] * v[273] + v[597] * v[379]);
+    v[146] = 0.2155 * v[280] + (v[10] * v[146] - v[9] * v[166]) - (v[608] * v[275] + v[597] * v[381]);
+    v[147] = 0.2155 * v[282] + (v[10] * v[147] - v[9] * v[167]) - (v[608] * v[276] + v[597] * v[383]);
+    v[148] = 0.2155 * v[285] + (v[10] * v[148] - v[555] - (v[562] + v[9] * v[168])) - (v[608] * v[283] + v[601] * v[377]);
+    v[149] = 0.2155 * v[220] + (v[10] * v[149] - v[9] * v[171]) - (v[608] * v[284] + v[601] * v[379]);
+    v[150] = 0.2155 * v[245] + (v[10] * v[150] - v[9] * v[174]) - (v[608] * v[286] + v[601] * v[381]);
+    v[152] = 0.2155 * v[22] + (v[10] * v[152] - v[9] * v[175]) - (v[608] * v[290] + v[601] * v[383]);
+    v[161] = 0.2155 * v[583] + (v[10] * v[553] - v[558] - (v[565] + v[9] * v[560])) - (v[376] + v[602] * v[377]);
+    v[145] = 0.2155 * v[236] + (v[10] * v[145] - v[9] * v[176]) - (v[378] + v[602] * v[379]);
+    v[151] = 0.2155 * v[254] + (v[10] * v[151] - v[9] * v[178]) - (v[380] + v[602] * v[381]);
+    v[153] = 0.2155 * v[255] + (v[10] * v[153] - v[9] * v[180]) - (v[382] + v[602] * v[383]);
+    v[154] = 0.2155 * v[257] + (v[10] * v[154] - v[559] - (v[566] + v[9] * v[188])) - (v[608] * v[318] + v[603] * v[377]);
+    v[156] = 0.2155 * v[258] + (v[10] * v[156] - v[9] * v[190]) - (v[608] * v[322] + v[603] * v[379]);
+    v[158] = 0.2155 * v[243] + (v[10] * v[158] - v[9] * v[191]) - (v[608] * v[330] + v[603] * v[381]);
+    v[160] = 0.2155 * v[246] + (v[10] * v[160] - v[9] * v[192]) - (v[608] * v[331] + v[603] * v[383]);
+    v[165] = v[598] + v[599] - (v[596] * v[608] + v[600] * v[377]);
+    v[166] = v[9] * v[364] - v[10] * v[242] - v[251] - (v[608] * v[341] + v[600] * v[379]);
+    v[167] = v[9] * v[267] - v[10] * v[169] - v[259] - (v[608] * v[342] + v[600] * v[381]);
+    v[162] = v[9] * v[268] - v[10] * v[162] - v[263] - (v[608] * v[346] + v[600] * v[383]);
+    v[168] = v[576] * v[967] + v[12] * v[230] + (v[11] * v[193] - v[569] * v[966]) - (-v[521] - v[522]) - (v[609] * v[272] + v[597] * v[387]);
+    v[169] = v[12] * v[231] + v[11] * v[198] - (0.2155 * v[397] + (v[10] * v[269] - v[9] * v[386])) - (v[609] * v[273] + v[597] * v[408]);
+    v[171] = v[12] * v[232] + v[11] * v[200] - (0.2155 * v[398] + (v[10] * v[270] - v[9] * v[388])) - (v[609] * v[275] + v[597] * v[410]);
+    v[174] = v[12] * v[235] + v[11] * v[201] - (0.2155 * v[402] + (v[10] * v[384] - v[9] * v[389])) - (v[609] * v[276] + v[597] * v[412]);
+    v[175] = v[577] * v[967] + v[12] * v[238] + (v[11] * v[202] - v[570] * v[966]) - (v[524] * v[967] - v[523] * v[966]) - (v[609] * v[283] + v[601] * v[387]);
+    v[176] = v[12] * v[239] + v[11] * v[206] - (v[12] * v[393] + v[11] * v[390] - (v[302] - (v[396] + v[492] * v[399]))) - (v[609] * v[284] + v[601] * v[408]);
+    v[178] = v[12] * v[240] + v[11] * v[207] - (v[12] * v[394] + v[11] * v[391] - (v[303] - (v[400] + v[492] * v[401]))) - (v[609] * v[286] + v[601] * v[410]);
+    v[180] = v[12] * v[241] + v[11] * v[209] - (v[12] * v[395] + v[11] * v[392] - (v[304] - (v[403] + v[492] * v[404]))) - (v[609] * v[290] + v[601] * v[412]);
+    v[188] = v[580] * v[967] + v[12] * v[575] + (v[11] * v[568] - v[573] * v[966]) - v[567] - (v[385] + v[602] * v[387]);
+    v[190] = v[12] * v[244] + v[11] * v[210] - (v[10] * v[386] + v[9] * v[269]) - (v[405] + v[602] * v[408]);
+    v[191] = v[12] * v[248] + v[11] * v[215] - (v[10] * v[388] + v[9] * v[270]) - (v[409] + v[602] * v[410]);
+    v[192] = v[12] * v[177] + v[11] * v[216] - (v[10] * v[389] + v[9] * v[384]) - (v[411] + v[602] * v[412]);
+    v[242] = v[581] * v[967] + v[12] * v[249] + (v[11] * v[217] - v[574] * v[966]) - (-(v[9] * v[523]) - v[10] * v[524]) - (v[609] * v[318] + v[603] * v[387]);
+    v[251] = v[12] * v[226] + v[11] * v[224] - (v[10] * v[390] - v[9] * v[393]) - (v[609] * v[322] + v[603] * v[408]);
+    v[259] = v[12] * v[234] + v[11] * v[227] - (v[10] * v[391] - v[9] * v[394]) - (v[609] * v[330] + v[603] * v[410]);
+    v[263] = v[12] * v[179] + v[11] * v[229] - (v[10] * v[392] - v[9] * v[395]) - (v[609] * v[331] + v[603] * v[412]);
+    v[267] = v[531] * v[966] - v[537] * v[967] - (v[596] * v[609] + v[600] * v[387]);
+    v[268] = v[397] + (-(v[11] * v[407]) - v[12] * v[323]) - (v[609] * v[341] + v[600] * v[408]);
+    v[269] = v[398] + (-(v[11] * v[416]) - v[12] * v[237]) - (v[609] * v[342] + v[600] * v[410]);
+    v[270] = v[402] + (-(v[11] * v[419]) - v[12] * v[187]) - (v[609] * v[346] + v[600] * v[412]);
+    v[193] = v[10] * v[193] - v[9] * v[569] - (v[10] * v[576] + v[9] * v[230]) - (v[611] * v[272] + v[597] * v[426]);
+    v[198] = v[10] * v[198] - v[9] * v[231] - (v[611] * v[273] + v[597] * v[428]);
+    v[200] = v[10] * v[200] - v[9] * v[232] - (v[611] * v[275] + v[597] * v[430]);
+    v[201] = v[10] * v[201] - v[9] * v[235] - (v[611] * v[276] + v[597] * v[432]);
+    v[202] = v[10] * v[202] - v[9] * v[570] - (v[10] * v[577] + v[9] * v[238]) - (v[611] * v[283] + v[601] * v[426]);
+    v[206] = v[10] * v[206] - v[9] * v[239] - (v[611] * v[284] + v[601] * v[428]);
+    v[207] = v[10] * v[207] - v[9] * v[240] - (v[611] * v[286] + v[601] * v[430]);
+    v[209] = v[10] * v[209] - v[9] * v[241] - (v[611] * v[290] + v[601] * v[432]);
+    v[230] = v[10] * v[568] - v[9] * v[573] - (v[10] * v[580] + v[9] * v[575]) - (v[425] + v[602] * v[426]);
+    v[210] = v[10] * v[210] - v[9] * v[244] - (v[427] + v[602] * v[428]);
+    v[215] = v[10] * v[215] - v[9] * v[248] - (v[429] + v[602] * v[430]);
+    v[177] = v[10] * v[216] - v[9] * v[177] - (v[431] + v[602] * v[432]);
+    v[216] = v[10] * v[217] - v[9] * v[574] - (v[10] * v[581] + v[9] * v[249]) - (v[611] * v[318] + v[603] * v[426]);
+    v[217] = v[10] * v[224] - v[9] * v[226] - (v[611] * v[322] + v[603] * v[428]);
+    v[224] = v[10] * v[227] - v[9] * v[234] - (v[611] * v[330] + v[603] * v[430]);
+    v[179] = v[10] * v[229] - v[9] * v[179] - (v[611] * v[331] + v[603] * v[432]);
+    v[226] = v[10] * v[537] + v[9] * v[531] - (v[596] * v[611] + v[600] * v[426]);
+    v[227] = v[9] * v[323] - v[10] * v[407] - (v[611] * v[341] + v[600] * v[428]);
+    v[229] = v[9] * v[237] - v[10] * v[416] - (v[611] * v[342] + v[600] * v[430]);
+    v[187] = v[9] * v[187] - v[10] * v[419] - (v[611] * v[346] + v[600] * v[432]);
+    v[231] = -v[264] - (v[612] * v[272] + v[597] * v[434]);
+    v[232] = -v[271] - (v[612] * v[273] + v[597] * v[436]);
+    v[234] = -v[280] - (v[612] * v[275] + v[597] * v[438]);
+    v[235] = -v[282] - (v[612] * v[276] + v[597] * v[440]);
+    v[237] = -v[285] - (v[612] * v[283] + v[601] * v[434]);
+    v[220] = -v[220] - (v[612] * v[284] + v[601] * v[436]);
+    v[238] = -v[245] - (v[612] * v[286] + v[601] * v[438]);
+    v[22] = -v[22] - (v[612] * v[290] + v[601] * v[440]);
+    v[239] = -v[583] - (v[433] + v[602] * v[434]);
+    v[236] = -v[236] - (v[435] + v[602] * v[436]);
+    v[240] = -v[254] - (v[437] + v[602] * v[438]);
+    v[241] = -v[255] - (v[439] + v[602] * v[440]);
+    v[244] = -v[257] - (v[612] * v[318] + v[603] * v[434]);
+    v[245] = -v[258] - (v[612] * v[322] + v[603] * v[436]);
+    v[243] = -v[243] - (v[612] * v[330] + v[603] * v[438]);
+    v[246] = -v[246] - (v[612] * v[331] + v[603] * v[440]);
+    v[248] = v[596] * v[612] + v[600] * v[434];
+    v[249] = v[281] - (v[612] * v[341] + v[600] * v[436]);
+    v[254] = v[279] - (v[612] * v[342] + v[600] * v[438]);
+    v[170] = v[170] - (v[612] * v[346] + v[600] * v[440]);
+    v[25] = v[56] * v[981] - v[43] * v[1018] + (v[52] * v[979] + v[39] * v[1006] - (v[44] * v[1002] - v[27] * v[51])) + (0.2155 * v[128] + (v[10] * v[25] - v[9] * v[60])) + (v[625] * v[990] - v[584] * v[994] + (v[617] * v[987] + v[613] * v[983])) - v[597] * v[369] / v[602];
+    v[40] = v[56] * v[40] + v[43] * v[1019] + (v[52] * v[36] + v[39] * v[1007] - v[44] * v[1003]) + (0.2155 * v[131] + (v[10] * v[138] - v[9] * v[101])) + (v[625] * v[991] - v[584] * v[995] + (v[613] * v[984] - v[45] * v[617])) - v[597] * v[371] / v[602];
+    v[60] = (v[607] * v[272] - v[597] * v[347] - v[630] * v[291]) / v[602] + (0.2155 * v[59] + (v[10] * v[63] - v[544] - (v[345] + v[9] * v[65])) + (v[47] * v[193] - v[48] * v[231] + (v[45] * v[136] - v[46] * v[168])));
+    v[63] = (v[607] * v[273] - v[597] * v[348] - v[630] * v[292]) / v[602] + (0.2155 * v[109] + (v[10] * v[87] - v[9] * v[81]) + (v[47] * v[198] - v[48] * v[232] + (v[45] * v[137] - v[46] * v[169])));
+    v[65] = (v[607] * v[275] - v[597] * v[349] - v[630] * v[293]) / v[602] + (0.2155 * v[110] + (v[10] * v[91] - v[9] * v[102]) + (v[47] * v[200] - v[48] * v[234] + (v[45] * v[146] - v[46] * v[171])));
+    v[23] = (v[607] * v[276] - v[597] * v[350] - v[630] * v[294]) / v[602] + (0.2155 * v[134] + (v[10] * v[108] - v[9] * v[23]) + (v[47] * v[201] - v[48] * v[235] + (v[45] * v[147] - v[46] * v[174])));
+    v[81] = v[56] * v[982] - v[43] * v[1020] + (v[52] * v[821] + v[39] * v[1008] - (v[3] * v[51] + v[44] * v[1004])) + (0.2155 * v[111] + (v[10] * v[88] - v[9] * v[114])) + (v[625] * v[992] - v[584] * v[996] + (v[617] * v[988] + v[613] * v[985])) - v[597] * v[372] / v[602];
+    v[87] = v[8] * v[56] + v[43] * v[1021] + (v[5] * v[52] + v[39] * v[1009] - v[44] * v[1005]) + (0.2155 * v[135] + (v[10] * v[89] - v[9] * v[115])) + (v[625] * v[993] - v[584] * v[997] + (v[613] * v[986] - v[617] * v[989])) - v[597] * v[373] / v[602];
+    v[50] = v[597] * v[375] / v[602] + (0.0127 * v[39] - (v[50] + v[51]) + (0.2155 * v[78] + (v[10] * v[92] - v[9] * v[76])) + (v[43] * v[625] - v[41] * v[584] + (v[39] * v[613] - v[38] * v[617])));
+    v[51] = 0.2155 * v[79] + (v[10] * v[74] - v[9] * v[67]) - v[597] * v[351] / v[602];
+    v[67] = 0.2155 * v[94] + (v[10] * v[75] - v[9] * v[73]) - v[597] * v[352] / v[602];
+    v[21] = 0.2155 * v[103] + (v[10] * v[21] - v[9] * v[117]) - v[597] * v[355] / v[602];
+    v[24] = 0.2155 * v[105] + (v[10] * v[24] - v[9] * v[119]) - v[597] * v[357] / v[602];
+    v[73] = 0.2155 * v[508] + (v[10] * v[503] - v[9] * v[504]) - v[597] * v[360] / v[602];
+    v[26] = 0.2155 * v[107] + (v[10] * v[26] - v[9] * v[123]) - v[597] * v[362] / v[602];
+    v[74] = 0.2155 * v[129] + (v[10] * v[99] - v[9] * v[124]) - v[597] * v[363] / v[602];
+    v[75] = 0.2155 * v[130] + (v[10] * v[100] - v[9] * v[126]) - v[597] * v[365] / v[602];
+    v[37] = v[44] * v[998] - v[27] * v[49] - (v[38] * v[1006] - v[52] * v[978]) - (v[56] * v[37] - v[41] * v[1018]) + (v[12] * v[125] + v[11] * v[127] - (v[354] + (v[528] * v[1050] - v[534] * v[1055] + (v[511] * v[1039] - v[517] * v[1045])) - v[492] * v[354] / v[492])) + (v[626] * v[990] - v[585] * v[994] + (v[618] * v[987] + v[614] * v[983])) - v[601] * v[369] / v[602];
+    v[42] = v[44] * v[999] - (v[57] + v[38] * v[1007]) - (v[56] * v[42] + v[41] * v[1019]) + (v[12] * v[164] + v[11] * v[132] - (v[356] + (v[528] * v[1051] - v[534] * v[1056] + (-(v[511] * v[1040]) - v[517] * v[1046])) - v[492] * v[356] / v[492])) + (v[626] * v[991] - v[585] * v[995] + (v[614] * v[984] - v[45] * v[618])) - v[601] * v[371] / v[602];
+    v[57] = (v[607] * v[283] - v[601] * v[347] - v[632] * v[291]) / v[602] + (v[550] * v[967] + v[12] * v[82] + (v[11] * v[139] - v[548] * v[966]) - (v[358] + (v[528] * v[1052] - v[534] * v[1057] + (v[511] * v[1041] - v[69] * v[517])) - v[492] * v[358] / v[492]) + (v[47] * v[202] - v[48] * v[237] + (v[45] * v[148] - v[46] * v[175])));
+    v[76] = (v[607] * v[284] - v[601] * v[348] - v[632] * v[292]) / v[602] + (v[12] * v[83] + v[11] * v[140] - ((v[502] * v[302] - v[492] * v[325] - v[546] * v[302]) / v[492] + (v[325] + (v[71] * v[406] - v[72] * v[289] + (v[69] * v[233] - v[70] * v[366])))) + (v[47] * v[206] - v[48] * v[220] + (v[45] * v[149] - v[46] * v[176])));
+    v[88] = (v[607] * v[286] - v[601] * v[349] - v[632] * v[293]) / v[602] + (v[12] * v[133] + v[11] * v[141] - ((v[502] * v[303] - v[492] * v[326] - v[546] * v[303]) / v[492] + (v[326] + (v[71] * v[413] - v[72] * v[183] + (v[69] * v[157] - v[70] * v[260])))) + (v[47] * v[207] - v[48] * v[238] + (v[45] * v[150] - v[46] * v[178])));
+    v[70] = (v[607] * v[290] - v[601] * v[350] - v[632] * v[294]) / v[602] + (v[12] * v[96] + v[11] * v[142] - ((v[502] * v[304] - v[492] * v[327] - v[546] * v[304]) / v[492] + (v[327] + (v[71] * v[414] - v[72] * v[225] + (v[69] * v[155] - v[70] * v[262])))) + (v[47] * v[209] - v[48] * v[22] + (v[45] * v[152] - v[46] * v[180])));
+    v[71] = v[3] * v[49] + v[44] * v[1000] - (v[38] * v[1008] - v[52] * v[819]) - (v[56] * v[980] - v[41] * v[1020]) + (v[12] * v[84] + v[11] * v[143] - (v[359] + (v[528] * v[1053] - v[534] * v[1058] + (v[511] * v[1042] - v[517] * v[1047])) - v[492] * v[359] / v[492])) + (v[626] * v[992] - v[585] * v[996] + (v[618] * v[988] + v[614] * v[985])) - v[601] * v[372] / v[602];
+    v[52] = v[44] * v[1001] - (v[4] * v[52] + v[38] * v[1009]) - (v[7] * v[56] + v[41] * v[1021]) + (v[12] * v[97] + v[11] * v[144] - (v[361] + (v[528] * v[1054] - v[534] * v[1059] + (-(v[511] * v[1043]) - v[517] * v[1048])) - v[492] * v[361] / v[492])) + (v[626] * v[993] - v[585] * v[997] + (v[614] * v[986] - v[618] * v[989])) - v[601] * v[373] / v[602];
+    v[49] = v[601] * v[375] / v[602] + (v[49] - 0.0127 * v[38] + (v[12] * v[68] + v[11] * v[159] - (v[367] + (v[511] * v[1044] - v[517] * v[1049]) - v[492] * v[367] / v[492])) + (v[43] * v[626] - v[41] * v[585] + (v[39] * v[614] - v[38] * v[618])));
+    v[72] = v[12] * v[77] + v[11] * v[172] - (v[492] * v[370] / v[492] + (v[368] + (v[66] * v[528] - v[64] * v[534] + (v[62] * v[511] - v[61] * v[517])))) - v[601] * v[351] / v[602];
+    v[89] = v[12] * v[80] + v[11] * v[173] - (v[328] - v[492] * v[328] / v[492]) - v[601] * v[352] / v[602];
+    v[91] = v[12] * v[98] + v[11] * v[228] - (v[329] - v[492] * v[329] / v[492]) - v[601] * v[355] / v[602];
+    v[92] = v[12] * v[104] + v[11] * v[253] - (v[332] - v[492] * v[332] / v[492]) - v[601] * v[357] / v[602];
+    v[99] = v[12] * v[507] + v[11] * v[506] - v[505] - v[601] * v[360] / v[602];
+    v[100] = v[12] * v[106] + v[11] * v[256] - (v[343] - v[492] * v[343] / v[492]) - v[601] * v[362] / v[602];
+    v[101] = v[12] * v[116] + v[11] * v[277] - (v[344] - v[492] * v[344] / v[492]) - v[601] * v[363] / v[602];
+    v[102] = v[12] * v[120] + v[11] * v[278] - (v[353] - v[492] * v[353] / v[492]) - v[601] * v[365] / v[602];
+    v[108] = v[56] * v[979] - v[39] * v[1018] - (v[44] * v[1014] - v[27] * v[55]) + (v[10] * v[127] - v[9] * v[125]) + (v[628] * v[990] - v[587] * v[994] + (v[620] * v[987] + v[616] * v[983])) - v[603] * v[369] / v[602];
+    v[36] = v[56] * v[36] + v[39] * v[1019] - v[44] * v[1015] + (v[10] * v[132] - v[9] * v[164]) + (v[628] * v[991] - v[587] * v[995] + (v[616] * v[984] - v[45] * v[620])) - v[603] * v[371] / v[602];
+    v[82] = (v[607] * v[318] - v[603] * v[347] - v[634] * v[291]) / v[602] + (v[10] * v[139] - v[9] * v[548] - (v[10] * v[550] + v[9] * v[82]) + (v[47] * v[216] - v[48] * v[244] + (v[45] * v[154] - v[46] * v[242])));
+    v[83] = (v[607] * v[322] - v[603] * v[348] - v[634] * v[292]) / v[602] + (v[10] * v[140] - v[9] * v[83] + (v[47] * v[217] - v[48] * v[245] + (v[45] * v[156] - v[46] * v[251])));
+    v[114] = (v[607] * v[330] - v[603] * v[349] - v[634] * v[293]) / v[602] + (v[10] * v[141] - v[9] * v[133] + (v[47] * v[224] - v[48] * v[243] + (v[45] * v[158] - v[46] * v[259])));
+    v[96] = (v[607] * v[331] - v[603] * v[350] - v[634] * v[294]) / v[602] + (v[10] * v[142] - v[9] * v[96] + (v[47] * v[179] - v[48] * v[246] + (v[45] * v[160] - v[46] * v[263])));
+    v[84] = v[56] * v[821] - v[39] * v[1020] - (v[3] * v[55] + v[44] * v[1016]) + (v[10] * v[143] - v[9] * v[84]) + (v[628] * v[992] - v[587] * v[996] + (v[620] * v[988] + v[616] * v[985])) - v[603] * v[372] / v[602];
+    v[97] = v[5] * v[56] + v[39] * v[1021] - v[44] * v[1017] + (v[10] * v[144] - v[9] * v[97]) + (v[628] * v[993] - v[587] * v[997] + (v[616] * v[986] - v[620] * v[989])) - v[603] * v[373] / v[602];
+    v[55] = v[603] * v[375] / v[602] + (v[10] * v[159] - v[9] * v[68] - v[55] + (v[43] * v[628] - v[41] * v[587] + (v[39] * v[616] - v[38] * v[620])));
+    v[68] = v[10] * v[172] - v[9] * v[77] - v[603] * v[351] / v[602];
+    v[77] = v[10] * v[173] - v[9] * v[80] - v[603] * v[352] / v[602];
+    v[80] = v[10] * v[228] - v[9] * v[98] - v[603] * v[355] / v[602];
+    v[98] = v[10] * v[253] - v[9] * v[104] - v[603] * v[357] / v[602];
+    v[104] = v[10] * v[506] - v[9] * v[507] - v[603] * v[360] / v[602];
+    v[106] = v[10] * v[256] - v[9] * v[106] - v[603] * v[362] / v[602];
+    v[115] = v[10] * v[277] - v[9] * v[116] - v[603] * v[363] / v[602];
+    v[116] = v[10] * v[278] - v[9] * v[120] - v[603] * v[365] / v[602];
+    v[117] = v[44] * v[1010] - v[27] * v[54] - (-(v[56] * v[978]) - v[38] * v[1018]) - v[128] + (v[629] * v[990] - v[542] * v[994] + (v[525] * v[987] + v[582] * v[983])) - v[600] * v[369] / v[602];
+    v[58] = v[44] * v[1011] - (v[58] + v[38] * v[1019]) - v[131] + (v[629] * v[991] - v[542] * v[995] + (v[582] * v[984] - v[45] * v[525])) - v[600] * v[371] / v[602];
+    v[59] = (v[596] * v[607] - v[600] * v[347] - v[636] * v[291]) / v[602] + (v[48] * v[248] + v[47] * v[226] + (v[45] * v[165] - v[46] * v[267]) - v[59]);
+    v[109] = (v[607] * v[341] - v[600] * v[348] - v[636] * v[292]) / v[602] + (v[47] * v[227] - v[48] * v[249] + (v[45] * v[166] - v[46] * v[268]) - v[109]);
+    v[110] = (v[607] * v[342] - v[600] * v[349] - v[636] * v[293]) / v[602] + (v[47] * v[229] - v[48] * v[254] + (v[45] * v[167] - v[46] * v[269]) - v[110]);
+    v[119] = (v[607] * v[346] - v[600] * v[350] - v[636] * v[294]) / v[602] + (v[47] * v[187] - v[48] * v[170] + (v[45] * v[162] - v[46] * v[270]) - v[134]);
+    v[111] = v[3] * v[54] + v[44] * v[1012] - (-(v[56] * v[819]) - v[38] * v[1020]) - v[111] + (v[629] * v[992] - v[542] * v[996] + (v[525] * v[988] + v[582] * v[985])) - v[600] * v[372] / v[602];
+    v[44] = v[44] * v[1013] - (v[4] * v[56] + v[38] * v[1021]) - v[135] + (v[629] * v[993] - v[542] * v[997] + (v[582] * v[986] - v[525] * v[989])) - v[600] * v[373] / v[602];
+    v[53] = v[600] * v[375] / v[602] + (v[53] + v[54] - v[78] + (v[43] * v[629] - v[41] * v[542] + (v[39] * v[582] - v[38] * v[525])));
+    v[54] = -(v[600] * v[351] / v[602]) - v[79];
+    v[56] = -(v[600] * v[352] / v[602]) - v[94];
+    v[78] = -(v[600] * v[355] / v[602]) - v[103];
+    v[79] = -(v[600] * v[357] / v[602]) - v[105];
+    v[94] = -(v[600] * v[360] / v[602]) - v[508];
+    v[103] = -(v[600] * v[362] / v[602]) - v[107];
+    v[105] = -(v[600] * v[363] / v[602]) - v[129];
+    v[107] = -(v[600] * v[365] / v[602]) - v[130];
+    v[120] = v[642] + (v[641] - v[6] * v[582]);
+    v[123] = v[7] * v[165] + v[6] * v[154] + (v[4] * v[148] - v[5] * v[136]);
+    v[124] = v[7] * v[166] + v[6] * v[156] + (v[4] * v[149] - v[5] * v[137]);
+    v[125] = v[7] * v[167] + v[6] * v[158] + (v[4] * v[150] - v[5] * v[146]);
+    v[126] = v[7] * v[162] + v[6] * v[160] + (v[4] * v[152] - v[5] * v[147]);
+    v[127] = v[649] + (v[648] - v[6] * v[525]);
+    v[128] = v[7] * v[267] + v[6] * v[242] + (v[4] * v[175] - v[5] * v[168]);
+    v[129] = v[7] * v[268] + v[6] * v[251] + (v[4] * v[176] - v[5] * v[169]);
+    v[130] = v[7] * v[269] + v[6] * v[259] + (v[4] * v[178] - v[5] * v[171]);
+    v[131] = v[7] * v[270] + v[6] * v[263] + (v[4] * v[180] - v[5] * v[174]);
+    v[132] = v[656] + (v[655] - v[6] * v[629]);
+    v[133] = v[7] * v[226] + v[6] * v[216] + (v[4] * v[202] - v[5] * v[193]);
+    v[134] = v[7] * v[227] + v[6] * v[217] + (v[4] * v[206] - v[5] * v[198]);
+    v[135] = v[7] * v[229] + v[6] * v[224] + (v[4] * v[207] - v[5] * v[200]);
+    v[138] = v[7] * v[187] + v[6] * v[179] + (v[4] * v[209] - v[5] * v[201]);
+    v[139] = v[663] + (v[662] - v[6] * v[542]);
+    v[140] = v[6] * v[244] - v[7] * v[248] + (v[4] * v[237] - v[5] * v[231]);
+    v[141] = v[7] * v[249] + v[6] * v[245] + (v[4] * v[220] - v[5] * v[232]);
+    v[142] = v[7] * v[254] + v[6] * v[243] + (v[4] * v[238] - v[5] * v[234]);
+    v[143] = v[7] * v[170] + v[6] * v[246] + (v[4] * v[22] - v[5] * v[235]);
+    v[144] = v[661] * v[965] + v[8] * v[139] + (v[7] * v[132] - v[665]) + (v[5] * v[127] - v[666] + (v[667] + v[4] * v[120]));
+    v[155] = v[8] * v[140] + v[7] * v[133] + (v[5] * v[128] + v[4] * v[123]);
+    v[157] = v[8] * v[141] + v[7] * v[134] + (v[5] * v[129] + v[4] * v[124]);
+    v[159] = v[8] * v[142] + v[7] * v[135] + (v[5] * v[130] + v[4] * v[125]);
+    v[164] = v[8] * v[143] + v[7] * v[138] + (v[5] * v[131] + v[4] * v[126]);
+    v[172] = v[586] * v[965] - v[668] + (v[670] - v[669]);
+    v[173] = v[8] * v[239] + v[7] * v[230] + (v[5] * v[188] + v[4] * v[161]);
+    v[183] = v[8] * v[236] + v[7] * v[210] + (v[5] * v[190] + v[4] * v[145]);
+    v[225] = v[8] * v[240] + v[7] * v[215] + (v[5] * v[191] + v[4] * v[151]);
+    v[228] = v[8] * v[241] + v[7] * v[177] + (v[5] * v[192] + v[4] * v[153]);
+    v[233] = v[664] * v[965] + v[8] * (v[542] * v[965] - v[658] + (v[660] - v[659])) + (v[7] * (v[629] * v[965] - v[651] + (v[653] - v[652])) - v[6] * v[657]) + (v[5] * (v[525] * v[965] - v[644] + (v[646] - v[645])) - v[4] * v[650] + (v[5] * v[643] + v[4] * (v[582] * v[965] - v[637] + (v[639] - v[638]))));
+    v[136] = v[8] * (v[7] * v[244] - v[8] * v[248] + (v[5] * v[237] + v[4] * v[231])) + v[7] * (v[8] * v[226] + v[7] * v[216] + (v[5] * v[202] + v[4] * v[193])) + (v[5] * (v[8] * v[267] + v[7] * v[242] + (v[5] * v[175] + v[4] * v[168])) + v[4] * (v[8] * v[165] + v[7] * v[154] + (v[5] * v[148] + v[4] * v[136])));
+    v[137] = v[8] * (v[8] * v[249] + v[7] * v[245] + (v[5] * v[220] + v[4] * v[232])) + v[7] * (v[8] * v[227] + v[7] * v[217] + (v[5] * v[206] + v[4] * v[198])) + (v[5] * (v[8] * v[268] + v[7] * v[251] + (v[5] * v[176] + v[4] * v[169])) + v[4] * (v[8] * v[166] + v[7] * v[156] + (v[5] * v[149] + v[4] * v[137])));
+    v[146] = v[8] * (v[8] * v[254] + v[7] * v[243] + (v[5] * v[238] + v[4] * v[234])) + v[7] * (v[8] * v[229] + v[7] * v[224] + (v[5] * v[207] + v[4] * v[200])) + (v[5] * (v[8] * v[269] + v[7] * v[259] + (v[5] * v[178] + v[4] * v[171])) + v[4] * (v[8] * v[167] + v[7] * v[158] + (v[5] * v[150] + v[4] * v[146])));
+    v[22] = v[8] * (v[8] * v[170] + v[7] * v[246] + (v[5] * v[22] + v[4] * v[235])) + v[7] * (v[8] * v[187] + v[7] * v[179] + (v[5] * v[209] + v[4] * v[201])) + (v[5] * (v[8] * v[270] + v[7] * v[263] + (v[5] * v[180] + v[4] * v[174])) + v[4] * (v[8] * v[162] + v[7] * v[160] + (v[5] * v[152] + v[4] * v[147])));
+    v[147] = v[552] * v[965] + v[8] * v[58] + (v[7] * v[36] - v[676]) + (v[5] * v[42] - v[677] + (v[678] + v[4] * v[40]));
+    v[148] = v[8] * v[59] + v[7] * v[82] + (v[5] * v[57] + v[4] * v[60]);
+    v[149] = v[8] * v[109] + v[7] * v[83] + (v[5] * v[76] + v[4] * v[63]);
+    v[150] = v[8] * v[110] + v[7] * v[114] + (v[5] * v[88] + v[4] * v[65]);
+    v[152] = v[8] * v[119] + v[7] * v[96] + (v[5] * v[70] + v[4] * v[23]);
+    v[154] = v[8] * v[53] + v[7] * v[55] + (v[5] * v[49] + v[4] * v[50]);
+    v[156] = v[8] * v[54] + v[7] * v[68] + (v[5] * v[72] + v[4] * v[51]);
+    v[158] = v[8] * v[56] + v[7] * v[77] + (v[5] * v[89] + v[4] * v[67]);
+    v[160] = v[8] * v[78] + v[7] * v[80] + (v[5] * v[91] + v[4] * v[21]);
+    v[162] = v[8] * v[79] + v[7] * v[98] + (v[5] * v[92] + v[4] * v[24]);
+    v[165] = v[8] * v[612] + v[7] * v[611] + (v[5] * v[609] + v[4] * v[608]);
+    v[166] = v[8] * v[94] + v[7] * v[104] + (v[5] * v[99] + v[4] * v[73]);
+    v[167] = v[8] * v[103] + v[7] * v[106] + (v[5] * v[100] + v[4] * v[26]);
+    v[168] = v[8] * v[105] + v[7] * v[115] + (v[5] * v[101] + v[4] * v[74]);
+    v[169] = v[8] * v[107] + v[7] * v[116] + (v[5] * v[102] + v[4] * v[75]);
+    v[170] = v[28] * v[32] - v[27] * v[976] - (v[28] * v[974] - v[27] * v[31]) + (v[8] * v[117] + v[7] * v[108] + (v[5] * v[37] + v[4] * v[25]));
+    v[171] = v[2] * v[32] + v[27] * v[977] - (v[3] * v[31] + v[28] * v[975]) + (v[8] * v[111] + v[7] * v[84] + (v[5] * v[71] + v[4] * v[81]));
+    v[174] = -0.5 - (v[8] * v[44] + v[7] * v[97] + (v[5] * v[52] + v[4] * v[87]));
+    v[175] = (v[144] - v[680] * v[233]) / v[675];
+    v[176] = (v[155] - v[680] * v[136]) / v[675];
+    v[178] = (v[157] - v[680] * v[137]) / v[675];
+    v[179] = (v[159] - v[680] * v[146]) / v[675];
+    v[180] = (v[164] - v[680] * v[22]) / v[675];
+    v[187] = (v[172] - v[681] * v[233]) / v[675];
+    v[193] = (v[173] - v[681] * v[136]) / v[675];
+    v[198] = (v[183] - v[681] * v[137]) / v[675];
+    v[200] = (v[225] - v[681] * v[146]) / v[675];
+    v[201] = (v[228] - v[681] * v[22]) / v[675];
+    v[120] = v[7] * v[139] - v[6] * v[661] + (v[654] + v[6] * v[132]) + (v[647] + v[4] * v[127] - (v[5] * v[120] - v[640])) - (v[680] * v[144] + v[671] * v[175]);
+    v[123] = v[7] * v[140] + v[6] * v[133] + (v[4] * v[128] - v[5] * v[123]) - (v[680] * v[155] + v[671] * v[176]);
+    v[124] = v[7] * v[141] + v[6] * v[134] + (v[4] * v[129] - v[5] * v[124]) - (v[680] * v[157] + v[671] * v[178]);
+    v[125] = v[7] * v[142] + v[6] * v[135] + (v[4] * v[130] - v[5] * v[125]) - (v[680] * v[159] + v[671] * v[179]);
+    v[126] = v[7] * v[143] + v[6] * v[138] + (v[4] * v[131] - v[5] * v[126]) - (v[680] * v[164] + v[671] * v[180]);
+    v[127] = v[673] + (v[672] - v[6] * v[586]) - (v[680] * v[172] + v[674] * v[175]);
+    v[128] = v[7] * v[239] + v[6] * v[230] + (v[4] * v[188] - v[5] * v[161]) - (v[680] * v[173] + v[674] * v[176]);
+    v[129] = v[7] * v[236] + v[6] * v[210] + (v[4] * v[190] - v[5] * v[145]) - (v[680] * v[183] + v[674] * v[178]);
+    v[130] = v[7] * v[240] + v[6] * v[215] + (v[4] * v[191] - v[5] * v[151]) - (v[680] * v[225] + v[674] * v[179]);
+    v[131] = v[7] * v[241] + v[6] * v[177] + (v[4] * v[192] - v[5] * v[153]) - (v[680] * v[228] + v[674] * v[180]);
+    v[132] = v[5] * v[622] + v[4] * v[621] + (v[7] * v[623] - v[6] * v[624]) - (v[681] * v[144] + v[671] * v[187]);
+    v[133] = v[7] * (v[596] - (v[596] * v[610] + v[600] * v[417])) + v[6] * (v[318] - (v[610] * v[318] + v[603] * v[417])) + (v[4] * (v[283] - (v[610] * v[283] + v[601] * v[417])) - v[5] * (v[272] - (v[610] * v[272] + v[597] * v[417]))) - (v[681] * v[155] + v[671] * v[193]);
+    v[134] = v[7] * (v[341] - (v[610] * v[341] + v[600] * v[420])) + v[6] * (v[322] - (v[610] * v[322] + v[603] * v[420])) + (v[4] * (v[284] - (v[610] * v[284] + v[601] * v[420])) - v[5] * (v[273] - (v[610] * v[273] + v[597] * v[420]))) - (v[681] * v[157] + v[671] * v[198]);
+    v[135] = v[7] * (v[342] - (v[610] * v[342] + v[600] * v[422])) + v[6] * (v[330] - (v[610] * v[330] + v[603] * v[422])) + (v[4] * (v[286] - (v[610] * v[286] + v[601] * v[422])) - v[5] * (v[275] - (v[610] * v[275] + v[597] * v[422]))) - (v[681] * v[159] + v[671] * v[200]);
+    v[138] = v[7] * (v[346] - (v[610] * v[346] + v[600] * v[424])) + v[6] * (v[331] - (v[610] * v[331] + v[603] * v[424])) + (v[4] * (v[290] - (v[610] * v[290] + v[601] * v[424])) - v[5] * (v[276] - (v[610] * v[276] + v[597] * v[424]))) - (v[681] * v[164] + v[671] * v[201]);
+    v[139] = v[681] * v[172] + v[674] * v[187];
+    v[140] = v[291] - (v[415] + v[602] * v[417]) - (v[681] * v[173] + v[674] * v[193]);
+    v[141] = v[292] - (v[418] + v[602] * v[420]) - (v[681] * v[183] + v[674] * v[198]);
+    v[142] = v[293] - (v[421] + v[602] * v[422]) - (v[681] * v[225] + v[674] * v[200]);
+    v[143] = v[294] - (v[423] + v[602] * v[424]) - (v[681] * v[228] + v[674] * v[201]);
+    v[25] = (-(v[3] * (x[8] * v[974] - v[35] + (v[369] + (v[627] * v[990] - v[586] * v[994] + (v[619] * v[987] + v[615] * v[983])) - v[602] * v[369] / v[602]) + (-(v[30] * v[683]) - v[29] * v[685]) - v[674] * v[170] / v[675]) - v[2] * v[606] + (v[3] * v[687] + v[2] * (x[8] * v[976] - v[34] + (v[7] * v[117] + v[6] * v[108] + (v[4] * v[37] - v[5] * v[25])) + (-(v[30] * v[682]) - v[29] * v[684]) - v[671] * v[170] / v[675]))) - v[692] * (v[3] * (v[3] * v[684] - v[2] * v[685]) - v[2] * v[690] + (v[3] * v[689] + v[2] * (v[3] * v[682] - v[2] * v[683])))) / v[691];
+    y[24] = v[25];
+    v[34] = (-(v[3] * ((v[679] * v[172] - v[674] * v[147] - v[688] * v[233]) / v[675] + (v[371] + (v[627] * v[991] - v[586] * v[995] + (v[615] * v[984] - v[45] * v[619])) - v[602] * v[371] / v[602] + (v[30] * v[139] + v[29] * v[127]))) + v[2] * ((v[679] * v[144] - v[671] * v[147] - v[686] * v[233]) / v[675] + (v[7] * v[58] - v[6] * v[552] + (v[635] + v[6] * v[36]) + (v[501] + v[4] * v[42] - (v[5] * v[40] - v[631])) + (v[29] * v[120] - v[30] * v[132])))) - v[692] * (v[3] * (v[2] * v[132] - v[3] * v[139]) + v[2] * (v[3] * v[127] + v[2] * v[120]))) / v[691];
+    y[25] = v[34];
+    v[35] = (-(v[3] * ((v[679] * v[173] - v[674] * v[148] - v[688] * v[136]) / v[675] + ((v[607] * v[291] - v[602] * v[347] - v[633] * v[291]) / v[602] + (v[347] + (v[47] * v[230] - v[48] * v[239] + (v[45] * v[161] - v[46] * v[188]))) + (v[29] * v[128] - v[30] * v[140]))) + v[2] * ((v[679] * v[155] - v[671] * v[148] - v[686] * v[136]) / v[675] + (v[7] * v[59] + v[6] * v[82] + (v[4] * v[57] - v[5] * v[60]) + (v[29] * v[123] - v[30] * v[133])))) - v[692] * (v[3] * (v[3] * v[140] + v[2] * v[133]) + v[2] * (v[3] * v[128] + v[2] * v[123]))) / v[691];
+    y[26] = v[35];
+    v[36] = (-(v[3] * ((v[679] * v[183] - v[674] * v[149] - v[688] * v[137]) / v[675] + ((v[607] * v[292] - v[602] * v[348] - v[633] * v[292]) / v[602] + (v[348] + (v[47] * v[210] - v[48] * v[236] + (v[45] * v[145] - v[46] * v[190]))) + (v[29] * v[129] - v[30] * v[141]))) + v[2] * ((v[679] * v[157] - v[671] * v[149] - v[686] * v[137]) / v[675] + (v[7] * v[109] + v[6] * v[83] + (v[4] * v[76] - v[5] * v[63]) + (v[29] * v[124] - v[30] * v[134])))) - v[692] * (v[3] * (v[3] * v[141] + v[2] * v[134]) + v[2] * (v[3] * v[129] + v[2] * v[124]))) / v[691];
+    y[27] = v[36];
+    v[37] = (-(v[3] * ((v[679] * v[225] - v[674] * v[150] - v[688] * v[146]) / v[675] + ((v[607] * v[293] - v[602] * v[349] - v[633] * v[293]) / v[602] + (v[349] + (v[47] * v[215] - v[48] * v[240] + (v[45] * v[151] - v[46] * v[191]))) + (v[29] * v[130] - v[30] * v[142]))) + v[2] * ((v[679] * v[159] - v[671] * v[150] - v[686] * v[146]) / v[675] + (v[7] * v[110] + v[6] * v[114] + (v[4] * v[88] - v[5] * v[65]) + (v[29] * v[125] - v[30] * v[135])))) - v[692] * (v[3] * (v[3] * v[142] + v[2] * v[135]) + v[2] * (v[3] * v[130] + v[2] * v[125]))) / v[691];
+    y[28] = v[37];
+    v[23] = (-(v[3] * ((v[679] * v[228] - v[674] * v[152] - v[688] * v[22]) / v[675] + ((v[607] * v[294] - v[602] * v[350] - v[633] * v[294]) / v[602] + (v[350] + (v[47] * v[177] - v[48] * v[241] + (v[45] * v[153] - v[46] * v[192]))) + (v[29] * v[131] - v[30] * v[143]))) + v[2] * ((v[679] * v[164] - v[671] * v[152] - v[686] * v[22]) / v[675] + (v[7] * v[119] + v[6] * v[96] + (v[4] * v[70] - v[5] * v[23]) + (v[29] * v[126] - v[30] * v[138])))) - v[692] * (v[3] * (v[3] * v[143] + v[2] * v[138]) + v[2] * (v[3] * v[131] + v[2] * v[126]))) / v[691];
+    y[29] = v[23];
+    v[33] = (-0.5 - (v[3] * (x[8] * v[975] - v[2] * v[33] + (v[372] + (v[627] * v[992] - v[586] * v[996] + (v[619] * v[988] + v[615] * v[985])) - v[602] * v[372] / v[602]) + (v[683] * v[972] - v[685] * v[973]) - v[674] * v[171] / v[675]) + v[2] * (v[3] * v[33] - x[8] * v[977] + (v[7] * v[111] + v[6] * v[84] + (v[4] * v[71] - v[5] * v[81])) + (v[682] * v[972] - v[684] * v[973]) - v[671] * v[171] / v[675]))) / v[691];
+    y[30] = v[33];
+    v[31] = (v[3] * (v[674] * v[174] / v[675] + (v[31] - 0.0579 * v[27] + (v[373] + (v[627] * v[993] - v[586] * v[997] + (v[615] * v[986] - v[619] * v[989])) - v[602] * v[373] / v[602]) + (v[28] * v[683] - v[27] * v[685]))) + v[2] * (v[671] * v[174] / v[675] + (0.0579 * v[28] - v[32] + (v[7] * v[44] + v[6] * v[97] + (v[4] * v[52] - v[5] * v[87])) + (v[28] * v[682] - v[27] * v[684])))) / v[691];
+    y[31] = -v[31];
+    v[32] = (v[3] * (v[602] * v[375] / v[602] + (v[374] + (v[43] * v[627] - v[41] * v[586] + (v[39] * v[615] - v[38] * v[619]))) - v[674] * v[154] / v[675]) + v[2] * (v[7] * v[53] + v[6] * v[55] + (v[4] * v[49] - v[5] * v[50]) - v[671] * v[154] / v[675])) / v[691];
+    y[32] = -v[32];
+    v[40] = (v[3] * (v[351] - v[602] * v[351] / v[602] - v[674] * v[156] / v[675]) + v[2] * (v[7] * v[54] + v[6] * v[68] + (v[4] * v[72] - v[5] * v[51]) - v[671] * v[156] / v[675])) / v[691];
+    y[33] = -v[40];
+    v[42] = (v[3] * (v[352] - v[602] * v[352] / v[602] - v[674] * v[158] / v[675]) + v[2] * (v[7] * v[56] + v[6] * v[77] + (v[4] * v[89] - v[5] * v[67]) - v[671] * v[158] / v[675])) / v[691];
+    y[34] = -v[42];
+    v[21] = (v[3] * (v[355] - v[602] * v[355] / v[602] - v[674] * v[160] / v[675]) + v[2] * (v[7] * v[78] + v[6] * v[80] + (v[4] * v[91] - v[5] * v[21]) - v[671] * v[160] / v[675])) / v[691];
+    y[35] = -v[21];
+    v[24] = (v[3] * (v[357] - v[602] * v[357] / v[602] - v[674] * v[162] / v[675]) + v[2] * (v[7] * v[79] + v[6] * v[98] + (v[4] * v[92] - v[5] * v[24]) - v[671] * v[162] / v[675])) / v[691];
+    y[36] = -v[24];
+    v[44] = 1. / v[691];
+    y[37] = v[44];
+    v[46] = (v[3] * v[681] + v[2] * v[680]) / v[691];
+    y[38] = -v[46];
+    v[47] = (v[3] * (v[610] - v[674] * v[165] / v[675]) + v[2] * (v[7] * v[612] + v[6] * v[611] + (v[4] * v[609] - v[5] * v[608]) - v[671] * v[165] / v[675])) / v[691];
+    y[39] = -v[47];
+    v[48] = (v[3] * (v[360] - v[602] * v[360] / v[602] - v[674] * v[166] / v[675]) + v[2] * (v[7] * v[94] + v[6] * v[104] + (v[4] * v[99] - v[5] * v[73]) - v[671] * v[166] / v[675])) / v[691];
+    y[40] = -v[48];
+    v[26] = (v[3] * (v[362] - v[602] * v[362] / v[602] - v[674] * v[167] / v[675]) + v[2] * (v[7] * v[103] + v[6] * v[106] + (v[4] * v[100] - v[5] * v[26]) - v[671] * v[167] / v[675])) / v[691];
+    y[41] = -v[26];
+    v[49] = (v[3] * (v[363] - v[602] * v[363] / v[602] - v[674] * v[168] / v[675]) + v[2] * (v[7] * v[105] + v[6] * v[115] + (v[4] * v[101] - v[5] * v[74]) - v[671] * v[168] / v[675])) / v[691];
+    y[42] = -v[49];
+    v[50] = (v[3] * (v[365] - v[602] * v[365] / v[602] - v[674] * v[169] / v[675]) + v[2] * (v[7] * v[107] + v[6] * v[116] + (v[4] * v[102] - v[5] * v[75]) - v[671] * v[169] / v[675])) / v[691];
+    y[43] = -v[50];
+    v[51] = v[2] * v[34];
+    v[52] = v[2] * v[35];
+    v[53] = v[2] * v[36];
+    v[54] = v[2] * v[37];
+    v[55] = v[2] * v[23];
+    v[56] = v[2] * v[32];
+    v[57] = v[2] * v[40];
+    v[58] = v[2] * v[42];
+    v[59] = v[2] * v[21];
+    v[60] = v[2] * v[24];
+    v[63] = v[2] * v[44];
+    v[65] = v[2] * v[46];
+    v[67] = v[2] * v[47];
+    v[68] = v[2] * v[48];
+    v[70] = v[2] * v[26];
+    v[71] = v[2] * v[49];
+    v[72] = v[2] * v[50];
+    v[34] = v[3] * v[34];
+    v[35] = v[3] * v[35];
+    v[36] = v[3] * v[36];
+    v[37] = v[3] * v[37];
+    v[23] = v[3] * v[23];
+    v[32] = v[3] * v[32];
+    v[40] = v[3] * v[40];
+    v[42] = v[3] * v[42];
+    v[21] = v[3] * v[21];
+    v[24] = v[3] * v[24];
+    v[44] = v[3] * v[44];
+    v[46] = v[3] * v[46];
+    v[47] = v[3] * v[47];
+    v[48] = v[3] * v[48];
+    v[26] = v[3] * v[26];
+    v[49] = v[3] * v[49];
+    v[50] = v[3] * v[50];
+    v[30] = v[694] + v[2] * v[25] - v[30];
+    v[73] = v[972] + v[2] * v[33];
+    v[28] = v[28] - v[2] * v[31];
+    v[25] = v[3] * v[25] - v[693] - v[29];
+    v[29] = v[3] * v[33] - v[973];
+    v[27] = -(v[3] * v[31]) - v[27];
+    v[31] = (-v[170] - (v[674] * v[25] + v[671] * v[30])) / v[675];
+    y[44] = v[31];
+    v[33] = (-v[147] - (v[696] * v[172] + v[674] * v[34] + (v[695] * v[144] + v[671] * v[51])) - v[697] * v[233]) / v[675];
+    y[45] = v[33];
+    v[74] = (-v[148] - (v[696] * v[173] + v[674] * v[35] + (v[695] * v[155] + v[671] * v[52])) - v[697] * v[136]) / v[675];
+    y[46] = v[74];
+    v[75] = (-v[149] - (v[696] * v[183] + v[674] * v[36] + (v[695] * v[157] + v[671] * v[53])) - v[697] * v[137]) / v[675];
+    y[47] = v[75];
+    v[76] = (-v[150] - (v[696] * v[225] + v[674] * v[37] + (v[695] * v[159] + v[671] * v[54])) - v[697] * v[146]) / v[675];
+    y[48] = v[76];
+    v[22] = (-v[152] - (v[696] * v[228] + v[674] * v[23] + (v[695] * v[164] + v[671] * v[55])) - v[697] * v[22]) / v[675];
+    y[49] = v[22];
+    v[77] = (-v[171] - (v[674] * v[29] + v[671] * v[73])) / v[675];
+    y[50] = v[77];
+    v[78] = (v[174] - (v[674] * v[27] + v[671] * v[28])) / v[675];
+    y[51] = v[78];
+    v[79] = (-v[154] - (-(v[674] * v[32]) - v[671] * v[56])) / v[675];
+    y[52] = v[79];
+    v[80] = (-v[156] - (-(v[674] * v[40]) - v[671] * v[57])) / v[675];
+    y[53] = v[80];
+    v[81] = (-v[158] - (-(v[674] * v[42]) - v[671] * v[58])) / v[675];
+    y[54] = v[81];
+    v[82] = (-v[160] - (-(v[674] * v[21]) - v[671] * v[59])) / v[675];
+    y[55] = v[82];
+    v[83] = (-v[162] - (-(v[674] * v[24]) - v[671] * v[60])) / v[675];
+    y[56] = v[83];
+    v[84] = (v[674] * v[44] + v[671] * v[63]) / v[675];
+    y[57] = -v[84];
+    v[87] = (1. - (-(v[674] * v[46]) - v[671] * v[65])) / v[675];
+    y[58] = v[87];
+    v[88] = (-v[165] - (-(v[674] * v[47]) - v[671] * v[67])) / v[675];
+    y[59] = v[88];
+    v[89] = (-v[166] - (-(v[674] * v[48]) - v[671] * v[68])) / v[675];
+    y[60] = v[89];
+    v[91] = (-v[167] - (-(v[674] * v[26]) - v[671] * v[70])) / v[675];
+    y[61] = v[91];
+    v[92] = (-v[168] - (-(v[674] * v[49]) - v[671] * v[71])) / v[675];
+    y[62] = v[92];
+    v[94] = (-v[169] - (-(v[674] * v[50]) - v[671] * v[72])) / v[675];
+    y[63] = v[94];
+    v[96] = v[4] * v[74] - v[5] * v[52];
+    v[97] = v[4] * v[75] - v[5] * v[53];
+    v[98] = v[4] * v[76] - v[5] * v[54];
+    v[99] = v[4] * v[22] - v[5] * v[55];
+    v[100] = v[4] * v[80] + v[5] * v[57];
+    v[101] = v[4] * v[81] + v[5] * v[58];
+    v[102] = v[4] * v[82] + v[5] * v[59];
+    v[103] = v[4] * v[83] + v[5] * v[60];
+    v[104] = -(v[4] * v[84]) - v[5] * v[63];
+    v[105] = v[4] * v[87] + v[5] * v[65];
+    v[106] = v[4] * v[88] + v[5] * v[67];
+    v[107] = v[4] * v[89] + v[5] * v[68];
+    v[108] = v[4] * v[91] + v[5] * v[70];
+    v[109] = v[4] * v[92] + v[5] * v[71];
+    v[110] = v[4] * v[94] + v[5] * v[72];
+    v[111] = v[5] * v[74] + v[4] * v[52];
+    v[114] = v[5] * v[75] + v[4] * v[53];
+    v[115] = v[5] * v[76] + v[4] * v[54];
+    v[116] = v[5] * v[22] + v[4] * v[55];
+    v[117] = v[5] * v[80] - v[4] * v[57];
+    v[119] = v[5] * v[81] - v[4] * v[58];
+    v[120] = v[5] * v[82] - v[4] * v[59];
+    v[123] = v[5] * v[83] - v[4] * v[60];
+    v[124] = v[4] * v[63] - v[5] * v[84];
+    v[125] = v[5] * v[87] - v[4] * v[65];
+    v[126] = v[5] * v[88] - v[4] * v[67];
+    v[127] = v[5] * v[89] - v[4] * v[68];
+    v[128] = v[5] * v[91] - v[4] * v[70];
+    v[129] = v[5] * v[92] - v[4] * v[71];
+    v[130] = v[5] * v[94] - v[4] * v[72];
+    v[131] = v[7] * v[74] + v[6] * v[52];
+    v[132] = v[7] * v[75] + v[6] * v[53];
+    v[133] = v[7] * v[76] + v[6] * v[54];
+    v[134] = v[7] * v[22] + v[6] * v[55];
+    v[135] = v[7] * v[80] - v[6] * v[57];
+    v[136] = v[7] * v[81] - v[6] * v[58];
+    v[137] = v[7] * v[82] - v[6] * v[59];
+    v[138] = v[7] * v[83] - v[6] * v[60];
+    v[139] = v[6] * v[63] - v[7] * v[84];
+    v[140] = v[7] * v[87] - v[6] * v[65];
+    v[141] = v[7] * v[88] - v[6] * v[67];
+    v[142] = v[7] * v[89] - v[6] * v[68];
+    v[143] = v[7] * v[91] - v[6] * v[70];
+    v[144] = v[7] * v[92] - v[6] * v[71];
+    v[145] = v[7] * v[94] - v[6] * v[72];
+    v[52] = v[8] * v[74] + v[7] * v[52];
+    v[53] = v[8] * v[75] + v[7] * v[53];
+    v[54] = v[8] * v[76] + v[7] * v[54];
+    v[55] = v[8] * v[22] + v[7] * v[55];
+    v[57] = v[8] * v[80] - v[7] * v[57];
+    v[58] = v[8] * v[81] - v[7] * v[58];
+    v[59] = v[8] * v[82] - v[7] * v[59];
+    v[60] = v[8] * v[83] - v[7] * v[60];
+    v[63] = v[7] * v[63] - v[8] * v[84];
+    v[65] = v[8] * v[87] - v[7] * v[65];
+    v[67] = v[8] * v[88] - v[7] * v[67];
+    v[68] = v[8] * v[89] - v[7] * v[68];
+    v[70] = v[8] * v[91] - v[7] * v[70];
+    v[71] = v[8] * v[92] - v[7] * v[71];
+    v[72] = v[8] * v[94] - v[7] * v[72];
+    v[146] = v[983] + (v[4] * v[31] - v[5] * v[30]);
+    v[147] = v[984] + (v[700] + v[4] * v[33] - (v[5] * v[51] - v[701]));
+    v[148] = v[985] + (v[4] * v[77] - v[5] * v[73]);
+    v[149] = v[986] + (v[4] * v[78] - v[5] * v[28]);
+    v[39] = v[39] + (v[4] * v[79] + v[5] * v[56]);
+    v[150] = v[987] + (v[5] * v[31] + v[4] * v[30]);
+    v[45] = v[5] * v[33] - v[698] + (v[699] + v[4] * v[51]) - v[45];
+    v[151] = v[988] + (v[5] * v[77] + v[4] * v[73]);
+    v[152] = v[5] * v[78] + v[4] * v[28] - v[989];
+    v[38] = v[5] * v[79] - v[4] * v[56] - v[38];
+    v[153] = v[990] + (v[7] * v[31] + v[6] * v[30]);
+    v[154] = v[991] + (v[7] * v[33] - v[6] * v[697] + (v[703] + v[6] * v[51]));
+    v[155] = v[992] + (v[7] * v[77] + v[6] * v[73]);
+    v[156] = v[993] + (v[7] * v[78] + v[6] * v[28]);
+    v[6] = v[43] + (v[7] * v[79] - v[6] * v[56]);
+    v[30] = v[8] * v[31] + v[7] * v[30] - v[994];
+    v[43] = v[697] * v[965] + v[8] * v[33] + (v[7] * v[51] - v[702]) - v[995];
+    v[51] = v[8] * v[77] + v[7] * v[73] - v[996];
+    v[28] = v[8] * v[78] + v[7] * v[28] - v[997];
+    v[7] = v[8] * v[79] - v[7] * v[56] - v[41];
+    v[8] = (-v[369] - (v[600] * v[30] + v[603] * v[153] + (v[602] * v[25] + v[601] * v[150] + v[597] * v[146]))) / v[602];
+    y[64] = v[8];
+    v[41] = (-v[371] - (v[600] * v[43] + v[603] * v[154] + (v[602] * v[34] + v[601] * v[45] + v[597] * v[147]))) / v[602];
+    y[65] = v[41];
+    v[56] = (-v[347] - (v[596] * v[707] + v[600] * v[52] + (v[706] * v[318] + v[603] * v[131]) + (v[696] * v[291] + v[602] * v[35] + (v[705] * v[283] + v[601] * v[111]) + (v[704] * v[272] + v[597] * v[96]))) - v[708] * v[291]) / v[602];
+    y[66] = v[56];
+    v[73] = (-v[348] - (v[707] * v[341] + v[600] * v[53] + (v[706] * v[322] + v[603] * v[132]) + (v[696] * v[292] + v[602] * v[36] + (v[705] * v[284] + v[601] * v[114]) + (v[704] * v[273] + v[597] * v[97]))) - v[708] * v[292]) / v[602];
+    y[67] = v[73];
+    v[157] = (-v[349] - (v[707] * v[342] + v[600] * v[54] + (v[706] * v[330] + v[603] * v[133]) + (v[696] * v[293] + v[602] * v[37] + (v[705] * v[286] + v[601] * v[115]) + (v[704] * v[275] + v[597] * v[98]))) - v[708] * v[293]) / v[602];
+    y[68] = v[157];
+    v[158] = (-v[350] - (v[707] * v[346] + v[600] * v[55] + (v[706] * v[331] + v[603] * v[134]) + (v[696] * v[294] + v[602] * v[23] + (v[705] * v[290] + v[601] * v[116]) + (v[704] * v[276] + v[597] * v[99]))) - v[708] * v[294]) / v[602];
+    y[69] = v[158];
+    v[159] = (-v[372] - (v[600] * v[51] + v[603] * v[155] + (v[602] * v[29] + v[601] * v[151] + v[597] * v[148]))) / v[602];
+    y[70] = v[159];
+    v[160] = (-v[373] - (v[600] * v[28] + v[603] * v[156] + (v[602] * v[27] + v[601] * v[152] + v[597] * v[149]))) / v[602];
+    y[71] = v[160];
+    v[161] = (v[375] - (v[600] * v[7] + v[603] * v[6] + (v[601] * v[38] - v[602] * v[32] + v[597] * v[39]))) / v[602];
+    y[72] = v[161];
+    v[162] = (-v[351] - (v[600] * v[57] + v[603] * v[135] + (v[601] * v[117] - v[602] * v[40] + v[597] * v[100]))) / v[602];
+    y[73] = v[162];
+    v[164] = (-v[352] - (v[600] * v[58] + v[603] * v[136] + (v[601] * v[119] - v[602] * v[42] + v[597] * v[101]))) / v[602];
+    y[74] = v[164];
+    v[165] = (-v[355] - (v[600] * v[59] + v[603] * v[137] + (v[601] * v[120] - v[602] * v[21] + v[597] * v[102]))) / v[602];
+    y[75] = v[165];
+    v[166] = (-v[357] - (v[600] * v[60] + v[603] * v[138] + (v[601] * v[123] - v[602] * v[24] + v[597] * v[103]))) / v[602];
+    y[76] = v[166];
+    v[167] = (v[600] * v[63] + v[603] * v[139] + (v[602] * v[44] + v[601] * v[124] + v[597] * v[104])) / v[602];
+    y[77] = -v[167];
+    v[168] = (v[600] * v[65] + v[603] * v[140] + (v[601] * v[125] - v[602] * v[46] + v[597] * v[105])) / v[602];
+    y[78] = -v[168];
+    v[169] = (1. - (v[600] * v[67] + v[603] * v[141] + (v[601] * v[126] - v[602] * v[47] + v[597] * v[106]))) / v[602];
+    y[79] = v[169];
+    v[170] = (-v[360] - (v[600] * v[68] + v[603] * v[142] + (v[601] * v[127] - v[602] * v[48] + v[597] * v[107]))) / v[602];
+    y[80] = v[170];
+    v[171] = (-v[362] - (v[600] * v[70] + v[603] * v[143] + (v[601] * v[128] - v[602] * v[26] + v[597] * v[108]))) / v[602];
+    y[81] = v[171];
+    v[172] = (-v[363] - (v[600] * v[71] + v[603] * v[144] + (v[601] * v[129] - v[602] * v[49] + v[597] * v[109]))) / v[602];
+    y[82] = v[172];
+    v[173] = (-v[365] - (v[600] * v[72] + v[603] * v[145] + (v[601] * v[130] - v[602] * v[50] + v[597] * v[110]))) / v[602];
+    y[83] = v[173];
+    v[25] = v[25] + v[8];
+    v[34] = v[34] + v[41];
+    v[35] = v[35] + v[56];
+    v[36] = v[36] + v[73];
+    v[37] = v[37] + v[157];
+    v[23] = v[23] + v[158];
+    v[29] = v[29] + v[159];
+    v[27] = v[27] + v[160];
+    v[32] = v[161] - v[32];
+    v[40] = v[162] - v[40];
+    v[42] = v[164] - v[42];
+    v[21] = v[165] - v[21];
+    v[24] = v[166] - v[24];
+    v[44] = v[44] - v[167];
+    v[46] = -v[46] - v[168];
+    v[47] = v[169] - v[47];
+    v[48] = v[170] - v[48];
+    v[26] = v[171] - v[26];
+    v[49] = v[172] - v[49];
+    v[50] = v[173] - v[50];
+    v[174] = v[9] * v[36] + v[10] * v[97];
+    v[175] = v[9] * v[37] + v[10] * v[98];
+    v[176] = v[9] * v[23] + v[10] * v[99];
+    v[177] = v[9] * v[42] + v[10] * v[101];
+    v[178] = v[9] * v[21] + v[10] * v[102];
+    v[179] = v[9] * v[24] + v[10] * v[103];
+    v[180] = v[9] * v[44] + v[10] * v[104];
+    v[183] = v[9] * v[46] + v[10] * v[105];
+    v[187] = v[9] * v[47] + v[10] * v[106];
+    v[188] = v[9] * v[48] + v[10] * v[107];
+    v[190] = v[9] * v[26] + v[10] * v[108];
+    v[191] = v[9] * v[49] + v[10] * v[109];
+    v[192] = v[9] * v[50] + v[10] * v[110];
+    v[36] = v[10] * v[36] - v[9] * v[97];
+    v[37] = v[10] * v[37] - v[9] * v[98];
+    v[23] = v[10] * v[23] - v[9] * v[99];
+    v[42] = v[10] * v[42] - v[9] * v[101];
+    v[21] = v[10] * v[21] - v[9] * v[102];
+    v[24] = v[10] * v[24] - v[9] * v[103];
+    v[44] = v[10] * v[44] - v[9] * v[104];
+    v[46] = v[10] * v[46] - v[9] * v[105];
+    v[47] = v[10] * v[47] - v[9] * v[106];
+    v[48] = v[10] * v[48] - v[9] * v[107];
+    v[26] = v[10] * v[26] - v[9] * v[108];
+    v[49] = v[10] * v[49] - v[9] * v[109];
+    v[50] = v[10] * v[50] - v[9] * v[110];
+    v[193] = v[10] * v[132] + v[11] * v[114];
+    v[198] = v[10] * v[133] + v[11] * v[115];
+    v[200] = v[10] * v[134] + v[11] * v[116];
+    v[201] = v[10] * v[6] + v[11] * v[38];
+    v[202] = v[10] * v[136] + v[11] * v[119];
+    v[206] = v[10] * v[137] + v[11] * v[120];
+    v[207] = v[10] * v[138] + v[11] * v[123];
+    v[209] = v[10] * v[139] + v[11] * v[124];
+    v[210] = v[10] * v[140] + v[11] * v[125];
+    v[215] = v[10] * v[141] + v[11] * v[126];
+    v[216] = v[10] * v[142] + v[11] * v[127];
+    v[217] = v[10] * v[143] + v[11] * v[128];
+    v[220] = v[10] * v[144] + v[11] * v[129];
+    v[224] = v[10] * v[145] + v[11] * v[130];
+    v[132] = v[12] * v[114] - v[9] * v[132];
+    v[133] = v[12] * v[115] - v[9] * v[133];
+    v[134] = v[12] * v[116] - v[9] * v[134];
+    v[6] = v[12] * v[38] - v[9] * v[6];
+    v[136] = v[12] * v[119] - v[9] * v[136];
+    v[137] = v[12] * v[120] - v[9] * v[137];
+    v[138] = v[12] * v[123] - v[9] * v[138];
+    v[139] = v[12] * v[124] - v[9] * v[139];
+    v[140] = v[12] * v[125] - v[9] * v[140];
+    v[141] = v[12] * v[126] - v[9] * v[141];
+    v[142] = v[12] * v[127] - v[9] * v[142];
+    v[143] = v[12] * v[128] - v[9] * v[143];
+    v[144] = v[12] * v[129] - v[9] * v[144];
+    v[145] = v[12] * v[130] - v[9] * v[145];
+    v[30] = 0.2155 * v[146] - v[30];
+    v[43] = 0.2155 * v[147] - v[43];
+    v[52] = 0.2155 * v[96] - v[52];
+    v[53] = 0.2155 * v[97] - v[53];
+    v[54] = 0.2155 * v[98] - v[54];
+    v[55] = 0.2155 * v[99] - v[55];
+    v[51] = 0.2155 * v[148] - v[51];
+    v[28] = 0.2155 * v[149] - v[28];
+    v[7] = 0.2155 * v[39] - v[7];
+    v[57] = 0.2155 * v[100] - v[57];
+    v[58] = 0.2155 * v[101] - v[58];
+    v[59] = 0.2155 * v[102] - v[59];
+    v[60] = 0.2155 * v[103] - v[60];
+    v[63] = 0.2155 * v[104] - v[63];
+    v[65] = 0.2155 * v[105] - v[65];
+    v[67] = 0.2155 * v[106] - v[67];
+    v[68] = 0.2155 * v[107] - v[68];
+    v[70] = 0.2155 * v[108] - v[70];
+    v[71] = 0.2155 * v[109] - v[71];
+    v[72] = 0.2155 * v[110] - v[72];
+    v[97] = v[1039] + (v[9] * v[25] + v[10] * v[146]);
+    v[98] = v[9] * v[34] + v[10] * v[147] - v[1040];
+    v[99] = v[1041] + (v[709] + v[9] * v[35] + (v[10] * v[96] - v[712]));
+    v[101] = v[1042] + (v[9] * v[29] + v[10] * v[148]);
+    v[102] = v[9] * v[27] + v[10] * v[149] - v[1043];
+    v[103] = v[1044] + (v[9] * v[32] + v[10] * v[39]);
+    v[62] = v[62] + (v[9] * v[40] + v[10] * v[100]);
+    v[25] = v[10] * v[25] - v[9] * v[146] - v[1045];
+    v[34] = v[10] * v[34] - v[9] * v[147] - v[1046];
+    v[35] = v[10] * v[35] - v[710] - (v[711] + v[9] * v[96]) - v[69];
+    v[29] = v[10] * v[29] - v[9] * v[148] - v[1047];
+    v[27] = v[10] * v[27] - v[9] * v[149] - v[1048];
+    v[32] = v[10] * v[32] - v[9] * v[39] - v[1049];
+    v[39] = v[10] * v[40] - v[9] * v[100] - v[61];
+    v[40] = v[1050] + (v[10] * v[153] + v[11] * v[150]);
+    v[61] = v[1051] + (v[10] * v[154] + v[11] * v[45]);
+    v[69] = v[1052] + (v[10] * v[131] - v[714] + (v[11] * v[111] - v[705] * v[966]));
+    v[96] = v[1053] + (v[10] * v[155] + v[11] * v[151]);
+    v[100] = v[1054] + (v[10] * v[156] + v[11] * v[152]);
+    v[11] = v[66] + (v[10] * v[135] + v[11] * v[117]);
+    v[66] = v[12] * v[150] - v[9] * v[153] - v[1055];
+    v[104] = v[12] * v[45] - v[9] * v[154] - v[1056];
+    v[105] = v[705] * v[967] + v[12] * v[111] - (v[713] + v[9] * v[131]) - v[1057];
+    v[106] = v[12] * v[151] - v[9] * v[155] - v[1058];
+    v[107] = v[12] * v[152] - v[9] * v[156] - v[1059];
+    v[12] = v[12] * v[117] - v[9] * v[135] - v[64];
+    v[64] = (-v[354] - (v[472] * v[30] + v[469] * v[66] + v[493] * v[40] + (v[491] * v[25] - v[492] * v[150] + v[462] * v[97]))) / v[492];
+    y[84] = v[64];
+    v[108] = (-v[356] - (v[472] * v[43] + v[469] * v[104] + v[493] * v[61] + (v[491] * v[34] - v[492] * v[45] + v[462] * v[98]))) / v[492];
+    y[85] = v[108];
+    v[109] = (-v[358] - (v[472] * v[52] + v[469] * v[105] + v[493] * v[69] + (v[491] * v[35] - v[492] * v[111] + v[462] * v[99]))) / v[492];
+    y[86] = v[109];
+    v[110] = (-v[325] - (v[715] * v[315] + v[472] * v[53] + (v[719] * v[311] + v[469] * v[132]) + (v[718] * v[305] + v[493] * v[193]) + (v[717] * v[298] + v[491] * v[36] - (v[705] * v[302] + v[492] * v[114]) + (v[716] * v[186] + v[462] * v[174]))) - v[720] * v[302]) / v[492];
+    y[87] = v[110];
+    v[131] = (-v[326] - (v[715] * v[316] + v[472] * v[54] + (v[719] * v[313] + v[469] * v[133]) + (v[718] * v[306] + v[493] * v[198]) + (v[717] * v[299] + v[491] * v[37] - (v[705] * v[303] + v[492] * v[115]) + (v[716] * v[295] + v[462] * v[175]))) - v[720] * v[303]) / v[492];
+    y[88] = v[131];
+    v[135] = (-v[327] - (v[715] * v[321] + v[472] * v[55] + (v[719] * v[314] + v[469] * v[134]) + (v[718] * v[307] + v[493] * v[200]) + (v[717] * v[300] + v[491] * v[23] - (v[705] * v[304] + v[492] * v[116]) + (v[716] * v[296] + v[462] * v[176]))) - v[720] * v[304]) / v[492];
+    y[89] = v[135];
+    v[146] = (-v[359] - (v[472] * v[51] + v[469] * v[106] + v[493] * v[96] + (v[491] * v[29] - v[492] * v[151] + v[462] * v[101]))) / v[492];
+    y[90] = v[146];
+    v[147] = (-v[361] - (v[472] * v[28] + v[469] * v[107] + v[493] * v[100] + (v[491] * v[27] - v[492] * v[152] + v[462] * v[102]))) / v[492];
+    y[91] = v[147];
+    v[148] = (-v[367] - (v[472] * v[7] + v[469] * v[6] + v[493] * v[201] + (v[491] * v[32] - v[492] * v[38] + v[462] * v[103]))) / v[492];
+    y[92] = v[148];
+    v[149] = (v[370] - (v[472] * v[57] + v[469] * v[12] + v[493] * v[11] + (v[491] * v[39] - v[492] * v[117] + v[462] * v[62]))) / v[492];
+    y[93] = v[149];
+    v[153] = (-v[328] - (v[472] * v[58] + v[469] * v[136] + v[493] * v[202] + (v[491] * v[42] - v[492] * v[119] + v[462] * v[177]))) / v[492];
+    y[94] = v[153];
+    v[154] = (-v[329] - (v[472] * v[59] + v[469] * v[137] + v[493] * v[206] + (v[491] * v[21] - v[492] * v[120] + v[462] * v[178]))) / v[492];
+    y[95] = v[154];
+    v[155] = (-v[332] - (v[472] * v[60] + v[469] * v[138] + v[493] * v[207] + (v[491] * v[24] - v[492] * v[123] + v[462] * v[179]))) / v[492];
+    y[96] = v[155];
+    v[156] = (v[472] * v[63] + v[469] * v[139] + v[493] * v[209] + (v[491] * v[44] - v[492] * v[124] + v[462] * v[180])) / v[492];
+    v[186] = -v[156];
+    y[97] = v[186];
+    v[225] = (v[472] * v[65] + v[469] * v[140] + v[493] * v[210] + (v[491] * v[46] - v[492] * v[125] + v[462] * v[183])) / v[492];
+    v[226] = -v[225];
+    y[98] = v[226];
+    v[227] = (v[472] * v[67] + v[469] * v[141] + v[493] * v[215] + (v[491] * v[47] - v[492] * v[126] + v[462] * v[187])) / v[492];
+    v[228] = -v[227];
+    y[99] = v[228];
+    v[229] = (1. - (v[472] * v[68] + v[469] * v[142] + v[493] * v[216] + (v[491] * v[48] - v[492] * v[127] + v[462] * v[188]))) / v[492];
+    y[100] = v[229];
+    v[230] = (-v[343] - (v[472] * v[70] + v[469] * v[143] + v[493] * v[217] + (v[491] * v[26] - v[492] * v[128] + v[462] * v[190]))) / v[492];
+    y[101] = v[230];
+    v[231] = (-v[344] - (v[472] * v[71] + v[469] * v[144] + v[493] * v[220] + (v[491] * v[49] - v[492] * v[129] + v[462] * v[191]))) / v[492];
+    y[102] = v[231];
+    v[232] = (-v[353] - (v[472] * v[72] + v[469] * v[145] + v[493] * v[224] + (v[491] * v[50] - v[492] * v[130] + v[462] * v[192]))) / v[492];
+    y[103] = v[232];
+    v[150] = v[64] - v[150];
+    v[45] = v[108] - v[45];
+    v[111] = v[109] - v[111];
+    v[114] = v[110] - v[114];
+    v[115] = v[131] - v[115];
+    v[116] = v[135] - v[116];
+    v[151] = v[146] - v[151];
+    v[152] = v[147] - v[152];
+    v[38] = v[148] - v[38];
+    v[117] = v[149] - v[117];
+    v[119] = v[153] - v[119];
+    v[120] = v[154] - v[120];
+    v[123] = v[155] - v[123];
+    v[124] = v[186] - v[124];
+    v[125] = v[226] - v[125];
+    v[126] = v[228] - v[126];
+    v[127] = v[229] - v[127];
+    v[128] = v[230] - v[128];
+    v[129] = v[231] - v[129];
+    v[130] = v[232] - v[130];
+    v[186] = v[13] * v[115] - v[14] * v[175];
+    v[226] = v[13] * v[116] - v[14] * v[176];
+    v[228] = v[13] * v[120] - v[14] * v[178];
+    v[233] = v[13] * v[123] - v[14] * v[179];
+    v[234] = v[13] * v[124] - v[14] * v[180];
+    v[235] = v[13] * v[125] - v[14] * v[183];
+    v[236] = v[13] * v[126] - v[14] * v[187];
+    v[237] = v[13] * v[127] - v[14] * v[188];
+    v[238] = v[13] * v[128] - v[14] * v[190];
+    v[239] = v[13] * v[129] - v[14] * v[191];
+    v[240] = v[13] * v[130] - v[14] * v[192];
+    v[241] = v[14] * v[115] + v[13] * v[175];
+    v[242] = v[14] * v[116] + v[13] * v[176];
+    v[243] = v[14] * v[120] + v[13] * v[178];
+    v[244] = v[14] * v[123] + v[13] * v[179];
+    v[245] = v[14] * v[124] + v[13] * v[180];
+    v[246] = v[14] * v[125] + v[13] * v[183];
+    v[248] = v[14] * v[126] + v[13] * v[187];
+    v[249] = v[14] * v[127] + v[13] * v[188];
+    v[251] = v[14] * v[128] + v[13] * v[190];
+    v[253] = v[14] * v[129] + v[13] * v[191];
+    v[254] = v[14] * v[130] + v[13] * v[192];
+    v[255] = v[13] * v[54] - v[14] * v[198] + (v[16] * v[115] + v[15] * v[175]);
+    v[256] = v[13] * v[55] - v[14] * v[200] + (v[16] * v[116] + v[15] * v[176]);
+    v[257] = v[13] * v[59] - v[14] * v[206] + (v[16] * v[120] + v[15] * v[178]);
+    v[258] = v[13] * v[60] - v[14] * v[207] + (v[16] * v[123] + v[15] * v[179]);
+    v[259] = v[13] * v[63] - v[14] * v[209] + (v[16] * v[124] + v[15] * v[180]);
+    v[260] = v[13] * v[65] - v[14] * v[210] + (v[16] * v[125] + v[15] * v[183]);
+    v[262] = v[13] * v[67] - v[14] * v[215] + (v[16] * v[126] + v[15] * v[187]);
+    v[263] = v[13] * v[68] - v[14] * v[216] + (v[16] * v[127] + v[15] * v[188]);
+    v[264] = v[13] * v[70] - v[14] * v[217] + (v[16] * v[128] + v[15] * v[190]);
+    v[267] = v[13] * v[71] - v[14] * v[220] + (v[16] * v[129] + v[15] * v[191]);
+    v[268] = v[13] * v[72] - v[14] * v[224] + (v[16] * v[130] + v[15] * v[192]);
+    v[54] = v[14] * v[54] + v[13] * v[198] + (v[17] * v[115] + v[16] * v[175]);
+    v[55] = v[14] * v[55] + v[13] * v[200] + (v[17] * v[116] + v[16] * v[176]);
+    v[59] = v[14] * v[59] + v[13] * v[206] + (v[17] * v[120] + v[16] * v[178]);
+    v[60] = v[14] * v[60] + v[13] * v[207] + (v[17] * v[123] + v[16] * v[179]);
+    v[63] = v[14] * v[63] + v[13] * v[209] + (v[17] * v[124] + v[16] * v[180]);
+    v[65] = v[14] * v[65] + v[13] * v[210] + (v[17] * v[125] + v[16] * v[183]);
+    v[67] = v[14] * v[67] + v[13] * v[215] + (v[17] * v[126] + v[16] * v[187]);
+    v[68] = v[14] * v[68] + v[13] * v[216] + (v[17] * v[127] + v[16] * v[188]);
+    v[70] = v[14] * v[70] + v[13] * v[217] + (v[17] * v[128] + v[16] * v[190]);
+    v[71] = v[14] * v[71] + v[13] * v[220] + (v[17] * v[129] + v[16] * v[191]);
+    v[72] = v[14] * v[72] + v[13] * v[224] + (v[17] * v[130] + v[16] * v[192]);
+    v[115] = v[1116] + (v[13] * v[150] - v[14] * v[97]);
+    v[116] = v[1117] + (v[13] * v[45] - v[14] * v[98]);
+    v[120] = v[1118] + (v[13] * v[111] - v[14] * v[99]);
+    v[123] = v[1119] + (v[724] + v[13] * v[114] - (v[14] * v[174] - v[725]));
+    v[124] = v[1120] + (v[13] * v[151] - v[14] * v[101]);
+    v[125] = v[1121] + (v[13] * v[152] - v[14] * v[102]);
+    v[126] = v[1122] + (v[13] * v[38] - v[14] * v[103]);
+    v[127] = v[1123] + (v[13] * v[117] - v[14] * v[62]);
+    v[86] = v[86] + (v[13] * v[119] - v[14] * v[177]);
+    v[128] = v[14] * v[150] + v[13] * v[97] - v[1124];
+    v[129] = v[14] * v[45] + v[13] * v[98] - v[1125];
+    v[130] = v[1126] + (v[14] * v[111] + v[13] * v[99]);
+    v[95] = v[14] * v[114] - v[722] + (v[723] + v[13] * v[174]) - v[95];
+    v[175] = v[14] * v[151] + v[13] * v[101] - v[1127];
+    v[176] = v[14] * v[152] + v[13] * v[102] - v[1128];
+    v[178] = v[1129] + (v[14] * v[38] + v[13] * v[103]);
+    v[179] = v[14] * v[117] + v[13] * v[62] - v[1130];
+    v[85] = v[14] * v[119] + v[13] * v[177] - v[85];
+    v[180] = v[1131] + (v[13] * v[30] - v[14] * v[40] + (v[16] * v[150] + v[15] * v[97]));
+    v[183] = v[1132] + (v[13] * v[43] - v[14] * v[61] + (v[16] * v[45] + v[15] * v[98]));
+    v[187] = v[1133] + (v[13] * v[52] - v[14] * v[69] + (v[16] * v[111] + v[15] * v[99]));
+    v[188] = v[1134] + (v[729] + v[13] * v[53] - (v[14] * v[193] - v[730]) + (v[16] * v[114] - v[15] * v[721] + (v[731] + v[15] * v[174])));
+    v[190] = v[1135] + (v[13] * v[51] - v[14] * v[96] + (v[16] * v[151] + v[15] * v[101]));
+    v[191] = v[1136] + (v[13] * v[28] - v[14] * v[100] + (v[16] * v[152] + v[15] * v[102]));
+    v[192] = v[1137] + (v[13] * v[7] - v[14] * v[201] + (v[16] * v[38] + v[15] * v[103]));
+    v[198] = v[1138] + (v[13] * v[57] - v[14] * v[11] + (v[16] * v[117] + v[15] * v[62]));
+    v[15] = v[93] + (v[13] * v[58] - v[14] * v[202] + (v[16] * v[119] + v[15] * v[177]));
+    v[30] = v[14] * v[30] + v[13] * v[40] + (v[17] * v[150] + v[16] * v[97]) - v[1139];
+    v[40] = v[14] * v[43] + v[13] * v[61] + (v[17] * v[45] + v[16] * v[98]) - v[1140];
+    v[43] = v[14] * v[52] + v[13] * v[69] + (v[17] * v[111] + v[16] * v[99]) - v[1141];
+    v[45] = v[14] * v[53] - v[726] + (v[727] + v[13] * v[193]) + (v[721] * v[968] + v[17] * v[114] + (v[16] * v[174] - v[728])) - v[1142];
+    v[51] = v[14] * v[51] + v[13] * v[96] + (v[17] * v[151] + v[16] * v[101]) - v[1143];
+    v[28] = v[14] * v[28] + v[13] * v[100] + (v[17] * v[152] + v[16] * v[102]) - v[1144];
+    v[7] = v[14] * v[7] + v[13] * v[201] + (v[17] * v[38] + v[16] * v[103]) - v[1145];
+    v[11] = v[14] * v[57] + v[13] * v[11] + (v[17] * v[117] + v[16] * v[62]) - v[1146];
+    v[16] = v[14] * v[58] + v[13] * v[202] + (v[17] * v[119] + v[16] * v[177]) - v[90];
+    v[17] = (-v[320] - (v[312] * v[66] + v[338] * v[30] + v[337] * v[180] + (v[336] * v[25] + v[335] * v[128] + v[308] * v[115]))) / v[336];
+    y[104] = v[17];
+    v[38] = (-v[324] - (v[312] * v[104] + v[338] * v[40] + v[337] * v[183] + (v[336] * v[34] + v[335] * v[129] + v[308] * v[116]))) / v[336];
+    y[105] = v[38];
+    v[52] = (-v[333] - (v[312] * v[105] + v[338] * v[43] + v[337] * v[187] + (v[336] * v[35] + v[335] * v[130] + v[308] * v[120]))) / v[336];
+    y[106] = v[52];
+    v[53] = (-v[334] - (v[312] * v[132] + v[338] * v[45] + v[337] * v[188] + (v[336] * v[36] + v[335] * v[95] + v[308] * v[123]))) / v[336];
+    y[107] = v[53];
+    v[57] = (-v[309] - (v[719] * v[288] + v[312] * v[133] + (v[338] * v[54] - v[297] * v[735]) + (v[734] * v[266] + v[337] * v[255]) + (v[717] * v[261] + v[336] * v[37] + (v[733] * v[250] + v[335] * v[241]) + (v[732] * v[212] + v[308] * v[186]))) - v[736] * v[261]) / v[336];
+    y[108] = v[57];
+    v[58] = (-v[310] - (v[719] * v[287] + v[312] * v[134] + (v[338] * v[55] - v[735] * v[274]) + (v[734] * v[265] + v[337] * v[256]) + (v[717] * v[252] + v[336] * v[23] + (v[733] * v[247] + v[335] * v[242]) + (v[732] * v[211] + v[308] * v[226]))) - v[736] * v[252]) / v[336];
+    y[109] = v[58];
+    v[61] = (-v[339] - (v[312] * v[106] + v[338] * v[51] + v[337] * v[190] + (v[336] * v[29] + v[335] * v[175] + v[308] * v[124]))) / v[336];
+    y[110] = v[61];
+    v[62] = (-v[340] - (v[312] * v[107] + v[338] * v[28] + v[337] * v[191] + (v[336] * v[27] + v[335] * v[176] + v[308] * v[125]))) / v[336];
+    y[111] = v[62];
+    v[69] = (-v[971] - (v[312] * v[6] + v[338] * v[7] + v[337] * v[192] + (v[336] * v[32] + v[335] * v[178] + v[308] * v[126]))) / v[336];
+    y[112] = v[69];
+    v[90] = (-v[1195] - (v[312] * v[12] + v[338] * v[11] + v[337] * v[198] + (v[336] * v[39] + v[335] * v[179] + v[308] * v[127]))) / v[336];
+    y[113] = v[90];
+    v[93] = (v[1197] - (v[312] * v[136] + v[338] * v[16] + v[337] * v[15] + (v[336] * v[42] + v[335] * v[85] + v[308] * v[86]))) / v[336];
+    y[114] = v[93];
+    v[96] = (-v[317] - (v[312] * v[137] + v[338] * v[59] + v[337] * v[257] + (v[336] * v[21] + v[335] * v[243] + v[308] * v[228]))) / v[336];
+    y[115] = v[96];
+    v[97] = (-v[319] - (v[312] * v[138] + v[338] * v[60] + v[337] * v[258] + (v[336] * v[24] + v[335] * v[244] + v[308] * v[233]))) / v[336];
+    y[116] = v[97];
+    v[98] = (v[312] * v[139] + v[338] * v[63] + v[337] * v[259] + (v[336] * v[44] + v[335] * v[245] + v[308] * v[234])) / v[336];
+    y[117] = -v[98];
+    v[99] = (v[312] * v[140] + v[338] * v[65] + v[337] * v[260] + (v[336] * v[46] + v[335] * v[246] + v[308] * v[235])) / v[336];
+    y[118] = -v[99];
+    v[100] = (v[312] * v[141] + v[338] * v[67] + v[337] * v[262] + (v[336] * v[47] + v[335] * v[248] + v[308] * v[236])) / v[336];
+    y[119] = -v[100];
+    v[101] = (v[312] * v[142] + v[338] * v[68] + v[337] * v[263] + (v[336] * v[48] + v[335] * v[249] + v[308] * v[237])) / v[336];
+    y[120] = -v[101];
+    v[102] = (1. - (v[312] * v[143] + v[338] * v[70] + v[337] * v[264] + (v[336] * v[26] + v[335] * v[251] + v[308] * v[238]))) / v[336];
+    y[121] = v[102];
+    v[103] = (-v[301] - (v[312] * v[144] + v[338] * v[71] + v[337] * v[267] + (v[336] * v[49] + v[335] * v[253] + v[308] * v[239]))) / v[336];
+    y[122] = v[103];
+    v[111] = (-v[19] - (v[312] * v[145] + v[338] * v[72] + v[337] * v[268] + (v[336] * v[50] + v[335] * v[254] + v[308] * v[240]))) / v[336];
+    y[123] = v[111];
+    v[25] = v[25] + v[17];
+    v[34] = v[34] + v[38];
+    v[35] = v[35] + v[52];
+    v[36] = v[36] + v[53];
+    v[37] = v[37] + v[57];
+    v[23] = v[23] + v[58];
+    v[29] = v[29] + v[61];
+    v[27] = v[27] + v[62];
+    v[32] = v[32] + v[69];
+    v[39] = v[39] + v[90];
+    v[42] = v[42] + v[93];
+    v[21] = v[21] + v[96];
+    v[24] = v[24] + v[97];
+    v[44] = v[44] - v[98];
+    v[46] = v[46] - v[99];
+    v[47] = v[47] - v[100];
+    v[48] = v[48] - v[101];
+    v[26] = v[26] + v[102];
+    v[49] = v[49] + v[103];
+    v[50] = v[50] + v[111];
+    v[30] = (-v[195] - (v[208] * (0.2155 * v[115] - v[30]) + v[219] * (v[1252] + (v[18] * v[66] + v[19] * v[180] + v[20] * v[128])) + (v[199] * (v[1233] + (v[18] * v[25] + v[19] * v[115])) - v[218] * v[128]))) / v[218];
+    y[124] = v[30];
+    v[40] = (-v[196] - (v[208] * (0.2155 * v[116] - v[40]) + v[219] * (v[1253] + (v[18] * v[104] + v[19] * v[183] + v[20] * v[129])) + (v[199] * (v[1234] + (v[18] * v[34] + v[19] * v[116])) - v[218] * v[129]))) / v[218];
+    y[125] = v[40];
+    v[43] = (-v[197] - (v[208] * (0.2155 * v[120] - v[43]) + v[219] * (v[1254] + (v[18] * v[105] + v[19] * v[187] + v[20] * v[130])) + (v[199] * (v[1235] + (v[18] * v[35] + v[19] * v[120])) - v[218] * v[130]))) / v[218];
+    y[126] = v[43];
+    v[45] = (-v[203] - (v[208] * (0.2155 * v[123] - v[45]) + v[219] * (v[1255] + (v[18] * v[132] + v[19] * v[188] + v[20] * v[95])) + (v[199] * (v[18] * v[36] + v[19] * v[123] - v[1236]) - v[218] * v[95]))) / v[218];
+    y[127] = v[45];
+    v[54] = (-v[204] - (v[208] * (0.2155 * v[186] - v[54]) + v[219] * (v[1256] + (v[19] * v[719] + v[18] * v[133] + (v[19] * v[255] - v[18] * v[734]) + (v[20] * v[241] - v[733] * v[969]))) + (v[199] * (v[1237] + (v[737] + v[18] * v[37] + (v[19] * v[186] - v[740]))) - v[218] * v[241]))) / v[218];
+    y[128] = v[54];
+    v[55] = (-v[189] - (v[741] * v[181] + v[208] * (0.2155 * v[226] - v[55]) + (v[743] * v[182] + v[219] * (v[18] * v[134] + v[19] * v[256] + v[20] * v[242])) + (v[742] * v[184] + v[199] * (v[18] * v[23] + v[19] * v[226]) - (v[733] * v[185] + v[218] * v[242]))) - v[744] * v[185]) / v[218];
+    y[129] = v[55];
+    v[51] = (-v[205] - (v[208] * (0.2155 * v[124] - v[51]) + v[219] * (v[1257] + (v[18] * v[106] + v[19] * v[190] + v[20] * v[175])) + (v[199] * (v[1238] + (v[18] * v[29] + v[19] * v[124])) - v[218] * v[175]))) / v[218];
+    y[130] = v[51];
+    v[28] = (-v[213] - (v[208] * (0.2155 * v[125] - v[28]) + v[219] * (v[1258] + (v[18] * v[107] + v[19] * v[191] + v[20] * v[176])) + (v[199] * (v[1239] + (v[18] * v[27] + v[19] * v[125])) - v[218] * v[176]))) / v[218];
+    y[131] = v[28];
+    v[6] = (-v[214] - (v[208] * (0.2155 * v[126] - v[7]) + v[219] * (v[1259] + (v[18] * v[6] + v[19] * v[192] + v[20] * v[178])) + (v[199] * (v[1240] + (v[18] * v[32] + v[19] * v[126])) - v[218] * v[178]))) / v[218];
+    y[132] = v[6];
+    v[7] = (-v[221] - (v[208] * (0.2155 * v[127] - v[11]) + v[219] * (v[1260] + (v[18] * v[12] + v[19] * v[198] + v[20] * v[179])) + (v[199] * (v[18] * v[39] + v[19] * v[127] - v[1241]) - v[218] * v[179]))) / v[218];
+    y[133] = v[7];
+    v[11] = (-v[222] - (v[208] * (0.2155 * v[86] - v[16]) + v[219] * (v[18] * v[136] + v[19] * v[15] + v[20] * v[85]) + (v[199] * (v[1242] + (v[18] * v[42] + v[19] * v[86])) - v[218] * v[85]))) / v[218];
+    y[134] = v[11];
+    v[12] = (v[223] - (v[208] * (0.2155 * v[228] - v[59]) + v[219] * (v[118] + (v[18] * v[137] + v[19] * v[257] + v[20] * v[243])) + (v[199] * (v[113] + (v[18] * v[21] + v[19] * v[228])) - v[218] * v[243]))) / v[218];
+    y[135] = v[12];
+    v[15] = (-v[194] - (v[208] * (0.2155 * v[233] - v[60]) + v[219] * (v[18] * v[138] + v[19] * v[258] + v[20] * v[244]) + (v[199] * (v[18] * v[24] + v[19] * v[233]) - v[218] * v[244]))) / v[218];
+    y[136] = v[15];
+    v[16] = (v[208] * (0.2155 * v[234] - v[63]) + v[219] * (v[18] * v[139] + v[19] * v[259] + v[20] * v[245]) + (v[199] * (v[18] * v[44] + v[19] * v[234]) - v[218] * v[245])) / v[218];
+    y[137] = -v[16];
+    v[59] = (v[208] * (0.2155 * v[235] - v[65]) + v[219] * (v[18] * v[140] + v[19] * v[260] + v[20] * v[246]) + (v[199] * (v[18] * v[46] + v[19] * v[235]) - v[218] * v[246])) / v[218];
+    y[138] = -v[59];
+    v[60] = (v[208] * (0.2155 * v[236] - v[67]) + v[219] * (v[18] * v[141] + v[19] * v[262] + v[20] * v[248]) + (v[199] * (v[18] * v[47] + v[19] * v[236]) - v[218] * v[248])) / v[218];
+    y[139] = -v[60];
+    v[63] = (v[208] * (0.2155 * v[237] - v[68]) + v[219] * (v[18] * v[142] + v[19] * v[263] + v[20] * v[249]) + (v[199] * (v[18] * v[48] + v[19] * v[237]) - v[218] * v[249])) / v[218];
+    y[140] = -v[63];
+    v[65] = (v[208] * (0.2155 * v[238] - v[70]) + v[219] * (v[18] * v[143] + v[19] * v[264] + v[20] * v[251]) + (v[199] * (v[18] * v[26] + v[19] * v[238]) - v[218] * v[251])) / v[218];
+    y[141] = -v[65];
+    v[66] = (1. - (v[208] * (0.2155 * v[239] - v[71]) + v[219] * (v[18] * v[144] + v[19] * v[267] + v[20] * v[253]) + (v[199] * (v[18] * v[49] + v[19] * v[239]) - v[218] * v[253]))) / v[218];
+    y[142] = v[66];
+    v[20] = (v[208] * (0.2155 * v[240] - v[72]) + v[219] * (v[18] * v[145] + v[19] * v[268] + v[20] * v[254]) + (v[199] * (v[18] * v[50] + v[19] * v[240]) - v[218] * v[254])) / v[218];
+    y[143] = -v[20];
+    y[144] = (-v[1474] - 0.001 * (v[19] * v[25] - v[18] * v[115] - v[1243])) / 0.001;
+    y[145] = (-v[1475] - 0.001 * (v[19] * v[34] - v[18] * v[116] - v[1244])) / 0.001;
+    y[146] = (-v[1476] - 0.001 * (v[19] * v[35] - v[18] * v[120] - v[1245])) / 0.001;
+    y[147] = (-v[1477] - 0.001 * (v[19] * v[36] - v[18] * v[123] - v[1246])) / 0.001;
+    y[148] = (-v[1478] - 0.001 * (v[19] * v[37] - v[738] - (v[739] + v[18] * v[186]) - v[121])) / 0.001;
+    y[149] = (-v[1479] - 0.001 * (v[19] * v[23] - v[18] * v[226])) / 0.001;
+    y[150] = (-v[1480] - 0.001 * (v[19] * v[29] - v[18] * v[124] - v[1247])) / 0.001;
+    y[151] = (-v[1481] - 0.001 * (v[19] * v[27] - v[18] * v[125] - v[1248])) / 0.001;
+    y[152] = (-v[1482] - 0.001 * (v[19] * v[32] - v[18] * v[126] - v[1249])) / 0.001;
+    y[153] = (-v[1483] - 0.001 * (v[19] * v[39] - v[18] * v[127] - v[1250])) / 0.001;
+    y[154] = (-v[1484] - 0.001 * (v[19] * v[42] - v[18] * v[86] - v[1251])) / 0.001;
+    y[155] = (-v[1485] - 0.001 * (v[19] * v[21] - v[18] * v[228] - v[112])) / 0.001;
+    y[156] = (-0.2 - 0.001 * (v[19] * v[24] - v[18] * v[233])) / 0.001;
+    y[157] = -(0.001 * (v[19] * v[44] - v[18] * v[234]) / 0.001);
+    y[158] = -(0.001 * (v[19] * v[46] - v[18] * v[235]) / 0.001);
+    y[159] = -(0.001 * (v[19] * v[47] - v[18] * v[236]) / 0.001);
+    y[160] = -(0.001 * (v[19] * v[48] - v[18] * v[237]) / 0.001);
+    y[161] = -(0.001 * (v[19] * v[26] - v[18] * v[238]) / 0.001);
+    y[162] = -(0.001 * (v[19] * v[49] - v[18] * v[239]) / 0.001);
+    y[163] = (1. - 0.001 * (v[19] * v[50] - v[18] * v[240])) / 0.001;
+    v[21] = v[5] * v[122];
+    v[23] = v[4] * v[122];
+    v[24] = v[4] * (v[2] * v[776]);
+    v[25] = -(v[4] * v[850]) - v[812];
+    v[26] = v[769] + v[5] * v[777];
+    v[27] = -v[806] - v[765];
+    v[29] = -v[766] - v[775];
+    v[32] = v[14] * (v[773] - v[779]);
+    v[34] = v[13] * v[25] + v[14] * (v[10] * v[27] - v[816]);
+    v[35] = v[866] - v[13] * v[24];
+    v[36] = v[13] * v[26] + v[14] * (v[10] * v[29]);
+    v[37] = v[14] * v[778] - v[13] * v[781];
+    v[39] = v[5] * v[786];
+    v[42] = v[4] * v[786];
+    v[44] = -(v[4] * v[849]) - v[767];
+    v[46] = v[811] + v[5] * v[776];
+    v[47] = -v[775] - v[766];
+    v[48] = -v[765] - v[806];
+    v[49] = v[13] * v[817];
+    v[50] = v[9] * v[828];
+    v[67] = v[9] * (v[760] - v[762]);
+    v[68] = v[10] * v[801];
+    v[70] = v[9] * v[813];
+    v[71] = -v[891] - v[892];
+    v[72] = v[19] * v[884];
+    v[85] = v[19] * v[71];
+    v[86] = v[19] * v[817];
+    v[95] = v[13] * v[870];
+    v[26] = v[10] * v[26];
+    v[25] = v[9] * (v[756] - v[899]) + (v[19] * v[70] + v[18] * (v[13] * v[815] + v[14] * (v[10] * v[25])));
+    v[104] = v[9] * v[759];
+    v[105] = v[9] * (v[4] * v[757]);
+    v[106] = v[10] * v[856];
+    v[107] = v[863] - v[864];
+    v[112] = v[19] * (v[9] * v[772]);
+    v[113] = v[13] * v[858];
+    v[114] = v[14] * v[772];
+    v[115] = v[895] - v[805];
+    v[116] = v[18] * (v[114] - v[13] * v[865]);
+    v[117] = v[19] * v[107] + v[18] * (v[14] * v[861]);
+    v[118] = v[19] * v[867] - v[18] * v[861];
+    v[119] = v[18] * (v[113] + v[14] * (v[10] * v[772])) - v[112] - v[105];
+    v[120] = v[106] + v[117] - v[104];
+    v[121] = v[85] + v[18] * (v[14] * v[115] - v[894]) - v[889] - v[887] - v[794];
+    v[123] = v[9] * v[760] + (v[19] * (v[9] * v[767] - v[773]) + v[18] * (v[13] * v[766] + v[14] * (-v[780] - v[10] * v[767]))) - v[758] - v[755];
+    v[124] = v[10] * v[761];
+    v[125] = v[10] * v[870];
+    v[126] = v[19] * v[125];
+    v[127] = v[18] * (v[14] * v[770] - v[13] * v[873]);
+    v[128] = v[19] * v[874] - v[18] * v[871];
+    v[24] = v[18] * (v[113] - v[14] * (v[10] * v[24])) - v[112] - v[105];
+    v[105] = v[67] + (v[19] * v[779] + v[18] * (v[95] + v[14] * v[26]));
+    v[112] = v[124] + (v[126] - v[18] * (v[14] * (v[9] * v[778])));
+    v[113] = -v[771] - v[773];
+    v[129] = v[14] * v[877];
+    v[130] = v[18] * (v[13] * v[774]);
+    v[132] = v[19] * v[879] - v[18] * v[877];
+    v[133] = v[68] + (v[906] + (v[86] + v[18] * (v[14] * v[846])));
+    v[104] = v[106] + (v[117] - v[104]);
+    v[106] = v[124] + (v[126] + v[18] * (v[14] * v[871]));
+    v[117] = v[19] * v[113] + v[18] * v[129] - v[758] - v[764];
+    v[124] = v[18] * (v[49] + v[14] * v[46]);
+    v[107] = v[18] * (v[114] + v[13] * v[107]);
+    v[114] = v[18] * (v[14] * v[44] + v[13] * v[125]);
+    v[113] = v[18] * (v[13] * v[113]);
+    v[125] = v[18] * (v[129] - v[13] * v[881]);
+    v[126] = v[19] * v[882];
+    v[129] = v[19] * v[37];
+    v[27] = v[19] * v[34] + v[18] * (v[809] + v[9] * v[27]);
+    v[134] = v[19] * v[35] + v[18] * (-v[859] - v[860]);
+    v[29] = v[19] * v[36] + v[18] * (v[9] * v[29]);
+    v[136] = v[19] * v[32] + v[18] * v[781];
+    v[137] = v[72] - v[784];
+    v[138] = v[9] * v[842];
+    v[139] = v[14] * v[768];
+    v[140] = v[18] * (v[139] - v[13] * v[896]);
+    v[141] = v[19] * v[897];
+    v[142] = v[19] * v[115] + v[18] * (v[14] * v[893]);
+    v[143] = v[141] - v[18] * v[893];
+    v[144] = v[18] * (v[13] * v[890] + v[14] * (v[10] * v[768])) - v[19] * (v[9] * v[768]) - v[9] * (v[4] * v[799]);
+    v[145] = v[10] * v[888] + v[142] - v[138];
+    v[150] = v[9] * v[843] + (v[19] * (v[9] * v[806] - v[809]) + v[18] * (v[13] * v[811] + v[14] * (-v[816] - v[10] * v[806]))) - v[800] - v[798];
+    v[151] = v[18] * (v[14] * v[807] - v[13] * v[902]);
+    v[152] = v[19] * v[904] - v[18] * v[901];
+    v[174] = v[869] + (v[872] + v[18] * (v[13] * v[44] + v[14] * (v[10] * v[47])));
+    v[175] = v[844] + (v[19] * v[845] + v[18] * (v[13] * v[46] + v[14] * (v[10] * v[48])));
+    v[176] = v[10] * v[900] + (v[19] * (v[10] * v[848]) - v[18] * (v[14] * v[70]));
+    v[177] = v[10] * v[46];
+    v[178] = v[10] * v[44] - v[780];
+    v[179] = -v[808] - v[809];
+    v[180] = v[14] * v[907];
+    v[181] = v[18] * (v[13] * v[810]);
+    v[182] = v[19] * v[908] - v[18] * v[907];
+    v[44] = v[10] * (v[762] + v[5] * (v[3] * (v[1] * -0.4))) + (v[19] * v[178] + v[18] * (v[14] * (v[773] + v[9] * v[44])) - v[876]);
+    v[138] = v[142] - v[138] - v[10] * (v[5] * (v[2] * v[802]));
+    v[46] = v[10] * (-(v[4] * v[803]) - v[756]) + (v[19] * v[177] + v[18] * (v[14] * (v[9] * v[46])));
+    v[142] = v[19] * v[179] + v[18] * v[180] - v[800] - v[9] * v[804];
+    v[178] = v[18] * (v[14] * v[47] + v[13] * v[178]);
+    v[115] = v[18] * (v[139] + v[13] * v[115]);
+    v[139] = v[18] * (v[14] * v[48] + v[13] * v[177]);
+    v[177] = v[18] * (v[13] * v[179]);
+    v[179] = v[18] * (v[180] - v[814]);
+    v[180] = v[19] * v[911];
+    v[49] = v[19] * (v[910] - v[49]);
+    v[47] = v[885] + v[19] * (v[782] + v[13] * v[47]);
+    v[71] = v[141] + v[18] * v[71];
+    v[48] = v[19] * (v[903] + v[13] * v[48]) + v[18] * v[70];
+    v[70] = v[19] * (v[14] * (v[809] - v[845])) + v[18] * v[817];
+    v[141] = v[847] - v[18] * v[818];
+    v[183] = v[9] * v[825];
+    v[184] = v[10] * v[915];
+    v[185] = -v[830] - v[832];
+    v[186] = v[920] + v[50];
+    v[187] = v[19] * v[185];
+    v[188] = v[19] * v[186];
+    v[189] = v[14] * v[831];
+    v[190] = v[9] * v[933];
+    v[191] = v[10] * v[921];
+    v[192] = v[18] * (v[189] - v[13] * v[922]);
+    v[193] = v[19] * v[923] - v[18] * v[918];
+    v[4] = v[18] * (v[13] * v[916] + v[14] * (v[10] * v[831])) - v[19] * (v[9] * v[831]) - v[9] * (v[4] * v[823]);
+    v[194] = v[183] + (v[184] + (v[188] + v[18] * (v[14] * (v[917] + v[191]))));
+    v[3] = v[187] + v[18] * (v[14] * (v[836] + v[190]) - v[835]) - v[827] - v[824] - v[3] * 0.42;
+    v[195] = v[10] * v[925];
+    v[196] = v[19] * v[927];
+    v[197] = v[18] * (v[14] * v[926]);
+    v[198] = v[18] * (v[14] * v[829] - v[13] * v[927]);
+    v[199] = v[18] * v[926] + v[19] * v[928];
+    v[200] = v[18] * (v[14] * v[836] - v[835]) - v[19] * v[830] - v[827];
+    v[201] = -v[197] - v[196] - v[195];
+    v[202] = v[14] * v[837];
+    v[203] = v[18] * (v[13] * v[833]);
+    v[204] = v[19] * v[930];
+    v[205] = v[204] - v[18] * v[837];
+    v[183] = v[184] + (v[183] + (v[188] + v[18] * (v[14] * v[918])));
+    v[184] = -v[196] - v[197] - v[195];
+    v[187] = v[187] + v[18] * v[202] - v[824] - v[827];
+    v[186] = v[18] * (v[189] + v[13] * v[186]);
+    v[185] = v[18] * (v[13] * v[185]);
+    v[188] = v[18] * (v[202] - v[835]);
+    v[189] = v[19] * v[931];
+    v[195] = v[19] * (v[834] - v[13] * v[838]);
+    v[50] = v[19] * (v[919] + v[14] * (-v[50] - v[920])) + v[18] * (-v[191] - v[917]);
+    v[190] = v[204] + v[18] * (-v[190] - v[836]);
+    v[191] = v[19] * v[934] - v[18] * v[839];
+    v[196] = v[868] * v[936];
+    v[197] = x[9] * v[746];
+    v[202] = -v[941] - v[937];
+    v[204] = x[9] * v[789];
+    v[206] = v[1] + v[1];
+    v[207] = -v[0] - v[0];
+    v[208] = x[10] * (v[747] - v[745]);
+    v[209] = v[202] + x[10] * v[795];
+    v[210] = v[197] - x[10] * v[23];
+    v[211] = x[10] * v[791];
+    v[212] = v[204] - x[10] * v[42];
+    v[213] = v[786] + v[786];
+    v[214] = v[122] + v[122];
+    v[215] = x[11] * v[752];
+    v[216] = v[209] + x[11] * (v[9] * v[791] - v[787]);
+    v[217] = v[210] + x[11] * (v[10] * v[746] + v[9] * v[21]);
+    v[218] = v[208] + x[11] * (v[9] * v[748]);
+    v[219] = x[11] * (v[10] * v[796] - v[792]);
+    v[220] = v[212] + x[11] * (v[10] * v[789] + v[9] * v[39]);
+    v[221] = v[211] + x[11] * (v[9] * v[793]);
+    v[222] = v[793] + v[793];
+    v[223] = v[748] + v[748];
+    v[26] = x[7] * (v[67] + (v[72] + v[18] * (v[95] + v[14] * (v[26] - v[780]))) - v[758] - v[755]) + x[8] * v[121] + x[9] * v[25] + x[10] * v[133] + x[11] * v[124] + x[12] * v[27];
+    v[2] = x[7] * (v[85] + v[18] * (v[14] * (-(v[10] * (v[5] * (v[2] * v[849]))) - v[805]) - v[894]) - v[889] - v[887] - v[794]) + x[8] * v[123] + x[9] * v[24] + x[10] * v[104] + x[11] * v[107] + x[12] * v[134];
+    v[5] = x[7] * v[25] + x[8] * v[119] + x[9] * v[105] + x[10] * v[106] + x[11] * v[114] + x[12] * v[29];
+    v[67] = x[7] * (v[906] + (v[68] + (v[86] + v[18] * (v[14] * (-(v[9] * v[851]) - v[809]))))) + x[8] * v[120] + x[9] * v[112] + x[10] * v[117] + x[11] * v[113] + x[12] * v[136];
+    v[68] = x[7] * (v[18] * (v[14] * v[848] - v[13] * v[852])) + x[8] * v[116] + x[9] * v[127] - x[10] * v[130] + x[11] * v[125] + x[12] * v[129];
+    v[19] = x[7] * (v[19] * v[853] - v[913]) + x[8] * v[118] + x[9] * v[128] + x[10] * v[132] + x[11] * v[126] + x[12] * v[137];
+    v[34] = v[938] + x[7] * (v[844] + (v[847] + v[18] * v[34]) - v[800] - v[798]) + x[9] * v[174] + x[10] * v[44] + x[11] * v[178] + x[12] * v[47];
+    v[35] = x[7] * (v[749] + (v[855] + (v[857] + (v[862] + v[18] * v[35])))) + x[8] * v[150] + x[9] * v[144] + x[10] * v[138] + x[11] * v[115] + x[12] * v[71];
+    v[36] = x[7] * (v[869] + (v[872] + v[18] * v[36])) + x[8] * v[144] + x[9] * v[175] + x[10] * v[46] + x[11] * v[139] + x[12] * v[48];
+    v[32] = x[7] * (v[763] + (v[878] + v[18] * v[32]) - v[876]) + x[8] * v[145] + x[9] * v[176] + x[10] * v[142] + x[11] * v[177] + x[12] * v[70];
+    v[37] = x[7] * (v[18] * v[37]) + x[8] * v[140] + x[9] * v[151] - x[10] * v[181] + x[11] * v[179] + x[12] * v[49];
+    v[18] = x[7] * (v[783] - v[18] * v[774]) + x[8] * v[143] + x[9] * v[152] + x[10] * v[182] + x[11] * v[180] + x[12] * v[141];
+    v[72] = x[8] * v[3] + x[9] * v[4] + x[10] * v[183] + x[11] * v[186] + x[12] * v[50];
+    v[85] = x[8] * v[4] + x[9] * v[200] + x[10] * v[184] + x[11] * v[198] + x[12] * v[199];
+    v[86] = x[8] * v[194] + x[9] * v[201] + x[10] * v[187] + x[11] * v[185] + x[12] * v[190];
+    v[95] = x[8] * v[192] + x[9] * v[198] - x[10] * v[203] + x[11] * v[188] + x[12] * v[195];
+    v[224] = x[8] * v[193] + x[9] * v[199] + x[10] * v[205] + x[11] * v[189] + x[12] * v[191];
+    v[226] = v[955] * v[72];
+    v[228] = v[955] * v[85];
+    v[233] = v[955] * v[86];
+    v[234] = v[955] * v[95];
+    v[235] = v[955] * v[224];
+    v[236] = v[924] * v[955];
+    v[237] = v[929] * v[955];
+    v[238] = v[826] * v[955];
+    v[239] = v[932] * v[955];
+    v[240] = v[935] * v[955];
+    v[241] = v[953] * v[34];
+    v[242] = v[953] * v[35];
+    v[243] = v[953] * v[36];
+    v[244] = v[953] * v[32];
+    v[245] = v[953] * v[37];
+    v[246] = v[953] * v[18];
+    v[247] = v[785] * v[953];
+    v[248] = v[898] * v[953];
+    v[249] = v[905] * v[953];
+    v[250] = v[909] * v[953];
+    v[251] = v[912] * v[953];
+    v[252] = v[914] * v[953];
+    v[253] = v[952] * v[26];
+    v[254] = v[952] * v[2];
+    v[255] = v[952] * v[5];
+    v[256] = v[952] * v[67];
+    v[257] = v[952] * v[68];
+    v[258] = v[952] * v[19];
+    v[259] = v[854] * v[952];
+    v[260] = v[868] * v[952];
+    v[261] = v[875] * v[952];
+    v[262] = v[880] * v[952];
+    v[263] = v[883] * v[952];
+    v[264] = v[886] * v[952];
+    v[265] = v[956] * 2.;
+    v[241] = (v[241] + v[241] + (v[253] + v[253])) / v[265];
+    v[226] = (v[226] + v[226] + (v[242] + v[242]) + (v[254] + v[254])) / v[265];
+    v[228] = (v[228] + v[228] + (v[243] + v[243]) + (v[255] + v[255])) / v[265];
+    v[233] = (v[233] + v[233] + (v[244] + v[244]) + (v[256] + v[256])) / v[265];
+    v[234] = (v[234] + v[234] + (v[245] + v[245]) + (v[257] + v[257])) / v[265];
+    v[235] = (v[235] + v[235] + (v[246] + v[246]) + (v[258] + v[258])) / v[265];
+    v[242] = (v[247] + v[247] + (v[259] + v[259])) / v[265];
+    v[236] = (v[236] + v[236] + (v[248] + v[248]) + (v[260] + v[260])) / v[265];
+    v[237] = (v[237] + v[237] + (v[249] + v[249]) + (v[261] + v[261])) / v[265];
+    v[238] = (v[238] + v[238] + (v[250] + v[250]) + (v[262] + v[262])) / v[265];
+    v[239] = (v[239] + v[239] + (v[251] + v[251]) + (v[263] + v[263])) / v[265];
+    v[240] = (v[240] + v[240] + (v[252] + v[252]) + (v[264] + v[264])) / v[265];
+    v[243] = (x[16] + x[16]) / (2. * v[960]);
+    y[196] = 10. * (v[935] * v[55] + (v[932] * v[58] + v[826] * v[135]) + (v[929] * v[158] + v[924] * v[22]));
+    y[203] = 10. * (v[935] * v[15] + (v[932] * v[97] + v[826] * v[155]) + (v[929] * v[166] + v[924] * v[83]));
+    y[205] = 10. * (-(v[932] * v[98]) - v[826] * v[156] - v[935] * v[16] + (-(v[929] * v[167]) - v[924] * v[84]));
+    y[206] = 10. * (-(v[932] * v[99]) - v[826] * v[225] - v[935] * v[59] + (v[924] * v[87] - v[929] * v[168]));
+    y[207] = 10. * (-(v[932] * v[100]) - v[826] * v[227] - v[935] * v[60] + (v[929] * v[169] + v[924] * v[88]));
+    y[208] = 10. * (v[826] * v[229] - v[932] * v[101] - v[935] * v[63] + (v[929] * v[170] + v[924] * v[89]));
+    y[209] = 10. * (v[932] * v[102] + v[826] * v[230] - v[935] * v[65] + (v[929] * v[171] + v[924] * v[91]));
+    y[210] = 10. * (v[935] * v[66] + (v[932] * v[103] + v[826] * v[231]) + (v[929] * v[172] + v[924] * v[92]));
+    y[211] = 10. * (v[932] * v[111] + v[826] * v[232] - v[935] * v[20] + (v[929] * v[173] + v[924] * v[94]));
+    v[15] = v[963] * v[72];
+    v[16] = v[963] * v[85];
+    v[20] = v[963] * v[86];
+    v[22] = v[963] * v[95];
+    v[55] = v[963] * v[224];
+    v[58] = v[924] * v[963];
+    v[59] = v[929] * v[963];
+    v[60] = v[826] * v[963];
+    v[63] = v[932] * v[963];
+    v[65] = v[935] * v[963];
+    y[176] = v[962] * (v[952] * v[243]) / v[961];
+    y[164] = v[962] * (v[960] * v[26]) / v[961] + v[964] * ((v[26] - v[957] * v[241]) / v[956]);
+    y[165] = v[962] * (v[960] * v[2]) / v[961] + (v[964] * ((v[2] - v[957] * v[226]) / v[956]) + v[957] * v[15]);
+    y[166] = v[962] * (v[960] * v[5]) / v[961] + (v[964] * ((v[5] - v[957] * v[228]) / v[956]) + v[957] * v[16]);
+    y[167] = v[962] * (v[960] * v[67]) / v[961] + (v[964] * ((v[67] - v[957] * v[233]) / v[956]) + v[957] * v[20]);
+    y[168] = v[962] * (v[960] * v[68]) / v[961] + (v[964] * ((v[68] - v[957] * v[234]) / v[956]) + v[957] * v[22]);
+    y[169] = v[962] * (v[960] * v[19]) / v[961] + (v[964] * ((v[19] - v[957] * v[235]) / v[956]) + v[957] * v[55]);
+    y[170] = v[962] * (v[854] * v[960]) / v[961] + v[964] * ((v[854] - v[957] * v[242]) / v[956]);
+    y[171] = v[962] * (v[868] * v[960]) / v[961] + (v[964] * ((v[868] - v[957] * v[236]) / v[956]) + v[957] * v[58]);
+    y[172] = v[962] * (v[875] * v[960]) / v[961] + (v[964] * ((v[875] - v[957] * v[237]) / v[956]) + v[957] * v[59]);
+    y[173] = v[962] * (v[880] * v[960]) / v[961] + (v[964] * ((v[880] - v[957] * v[238]) / v[956]) + v[957] * v[60]);
+    y[174] = v[962] * (v[883] * v[960]) / v[961] + (v[964] * ((v[883] - v[957] * v[239]) / v[956]) + v[957] * v[63]);
+    y[175] = v[962] * (v[886] * v[960]) / v[961] + (v[964] * ((v[886] - v[957] * v[240]) / v[956]) + v[957] * v[65]);
+    y[189] = v[962] * (v[953] * v[243]) / v[961];
+    y[177] = v[962] * (v[960] * v[34]) / v[961] + v[964] * ((v[34] - v[958] * v[241]) / v[956]);
+    y[178] = v[962] * (v[960] * v[35]) / v[961] + (v[964] * ((v[35] - v[958] * v[226]) / v[956]) + v[958] * v[15]);
+    y[179] = v[962] * (v[960] * v[36]) / v[961] + (v[964] * ((v[36] - v[958] * v[228]) / v[956]) + v[958] * v[16]);
+    y[180] = v[962] * (v[960] * v[32]) / v[961] + (v[964] * ((v[32] - v[958] * v[233]) / v[956]) + v[958] * v[20]);
+    y[181] = v[962] * (v[960] * v[37]) / v[961] + (v[964] * ((v[37] - v[958] * v[234]) / v[956]) + v[958] * v[22]);
+    y[182] = v[962] * (v[960] * v[18]) / v[961] + (v[964] * ((v[18] - v[958] * v[235]) / v[956]) + v[958] * v[55]);
+    y[183] = v[962] * (v[785] * v[960]) / v[961] + v[964] * ((v[785] - v[958] * v[242]) / v[956]);
+    y[184] = v[962] * (v[898] * v[960]) / v[961] + (v[964] * ((v[898] - v[958] * v[236]) / v[956]) + v[958] * v[58]);
+    y[185] = v[962] * (v[905] * v[960]) / v[961] + (v[964] * ((v[905] - v[958] * v[237]) / v[956]) + v[958] * v[59]);
+    y[186] = v[962] * (v[909] * v[960]) / v[961] + (v[964] * ((v[909] - v[958] * v[238]) / v[956]) + v[958] * v[60]);
+    y[187] = v[962] * (v[912] * v[960]) / v[961] + (v[964] * ((v[912] - v[958] * v[239]) / v[956]) + v[958] * v[63]);
+    y[188] = v[962] * (v[914] * v[960]) / v[961] + (v[964] * ((v[914] - v[958] * v[240]) / v[956]) + v[958] * v[65]);
+    y[204] = v[962] * (v[955] * v[243]) / v[961];
+    y[190] = 10. * (x[8] * (-(v[196] + v[898] * v[937]) - (v[937] * v[121] - v[196])) + x[9] * (v[944] * v[174] + v[905] * (v[202] - v[937]) - (v[943] * v[25] + v[875] * v[944])) + x[10] * (v[940] * v[44] + v[909] * (v[202] + v[209]) - (v[942] * v[133] + v[880] * v[940])) + x[11] * (v[946] * v[178] + v[912] * (v[209] + v[216]) - (v[947] * v[124] + v[883] * v[946])) + x[12] * (v[949] * v[47] + v[914] * (v[216] + (v[216] + x[12] * (v[13] * (v[792] + v[10] * v[791]) + v[14] * v[793]))) - (v[950] * v[27] + v[886] * v[949]))) - v[964] * (v[959] * v[241] / v[956]);
+    y[191] = 10. * (x[8] * (-(v[936] * v[150]) - v[937] * v[123]) + x[9] * (v[944] * v[144] + v[905] * v[197] - (v[943] * v[24] + v[875] * v[204])) + x[10] * (v[940] * v[138] + v[909] * (v[197] + v[210]) - (v[942] * v[104] + v[880] * (v[204] + v[212]))) + x[11] * (v[946] * v[115] + v[912] * (v[210] + v[217]) - (v[947] * v[107] + v[883] * (v[212] + v[220]))) + x[12] * (v[949] * v[71] + v[914] * (v[217] + (v[217] + x[12] * (v[13] * (v[10] * v[21] - v[9] * v[746]) + v[14] * v[23]))) - (v[950] * v[134] + v[886] * (v[220] + (v[220] + x[12] * (v[14] * v[42] + v[13] * (v[10] * v[39] - v[9] * v[789])))))) + (v[935] * v[30] + v[744] * v[50] + (v[932] * v[17] + v[736] * v[186] + (v[826] * v[64] + v[720] * v[183])) + (v[929] * v[8] + v[708] * v[4] + (v[924] * v[31] + v[697] * v[3])))) + 601. * v[72] + (v[962] * (v[960] * v[72]) / v[961] + (v[964] * ((v[72] - v[959] * v[226]) / v[956]) + v[959] * v[15]));
+    y[192] = 10. * (x[8] * (-(v[936] * v[144]) - v[937] * v[119]) + x[9] * (v[944] * v[175] - v[943] * v[105]) + x[10] * (v[940] * v[46] + v[909] * v[208] - (v[942] * v[106] + v[880] * v[211])) + x[11] * (v[946] * v[139] + v[912] * (v[208] + v[218]) - (v[947] * v[114] + v[883] * (v[211] + v[221]))) + x[12] * (v[949] * v[48] + v[914] * (v[218] + (v[218] + x[12] * (v[13] * (v[10] * v[748]) + v[14] * v[751]))) - (v[950] * v[29] + v[886] * (v[221] + (v[221] + x[12] * (v[14] * v[788] + v[13] * (v[10] * v[793])))))) + (v[935] * v[40] + v[744] * v[199] + (v[932] * v[38] + v[736] * v[198] + (v[826] * v[108] + v[720] * v[184])) + (v[929] * v[41] + v[708] * v[200] + (v[924] * v[33] + v[697] * v[4])))) + 601. * v[85] + (v[962] * (v[960] * v[85]) / v[961] + (v[964] * ((v[85] - v[959] * v[228]) / v[956]) + v[959] * v[16]));
+    y[193] = 10. * (x[8] * (-(v[936] * v[145]) - v[937] * v[120]) + x[9] * (v[944] * v[176] - v[943] * v[112]) + x[10] * (v[940] * v[142] - v[942] * v[117]) + x[11] * (v[946] * v[177] + v[912] * v[215] - (v[947] * v[113] + v[883] * v[219])) + x[12] * (v[949] * v[70] + v[914] * (v[215] + (v[215] + x[12] * (v[13] * (-v[753] - v[163])))) - (v[950] * v[136] + v[886] * (v[219] + (v[219] + x[12] * (v[13] * (-(v[9] * v[788]) - v[787])))))) + (v[935] * v[43] + v[744] * v[190] + (v[932] * v[52] + v[736] * v[185] + (v[826] * v[109] + v[720] * v[187])) + (v[929] * v[56] + v[708] * v[201] + (v[924] * v[74] + v[697] * v[194])))) + 601. * v[86] + (v[962] * (v[960] * v[86]) / v[961] + (v[964] * ((v[86] - v[959] * v[233]) / v[956]) + v[959] * v[20]));
+    y[194] = 10. * (x[8] * (-(v[936] * v[140]) - v[937] * v[116]) + x[9] * (v[944] * v[151] - v[943] * v[127]) + x[10] * (v[942] * v[130] - v[940] * v[181]) + x[11] * (v[946] * v[179] - v[947] * v[125]) + x[12] * (v[949] * v[49] + v[914] * (x[12] * (v[14] * v[752] - v[13] * v[750])) - (v[950] * v[129] + v[886] * (x[12] * (v[14] * v[790] - v[13] * v[795])))) + (v[935] * v[45] + v[744] * v[195] + (v[932] * v[53] + v[736] * v[188] + (v[826] * v[110] - v[720] * v[203])) + (v[929] * v[73] + v[708] * v[198] + (v[924] * v[75] + v[697] * v[192])))) + 601. * v[95] + (v[962] * (v[960] * v[95]) / v[961] + (v[964] * ((v[95] - v[959] * v[234]) / v[956]) + v[959] * v[22]));
+    y[195] = 10. * (x[8] * (-(v[936] * v[143]) - v[937] * v[118]) + x[9] * (v[944] * v[152] - v[943] * v[128]) + x[10] * (v[940] * v[182] - v[942] * v[132]) + x[11] * (v[946] * v[180] - v[947] * v[126]) + x[12] * (v[949] * v[141] - v[950] * v[137]) + (v[935] * v[54] + v[744] * v[191] + (v[932] * v[57] + v[736] * v[189] + (v[826] * v[131] + v[720] * v[205])) + (v[929] * v[157] + v[708] * v[199] + (v[924] * v[76] + v[697] * v[193])))) + 601. * v[224] + (v[962] * (v[960] * v[224]) / v[961] + (v[964] * ((v[224] - v[959] * v[235]) / v[956]) + v[959] * v[55]));
+    y[197] = 10. * (v[935] * v[51] + (v[932] * v[61] + v[826] * v[146]) + (v[929] * v[159] + v[924] * v[77])) - v[964] * (v[959] * v[242] / v[956]);
+    y[198] = 10. * (v[939] + x[8] * (-(v[0] * v[898]) - v[1] * v[868]) + x[9] * (v[905] * v[207] - v[875] * v[206]) + x[10] * (v[909] * v[207] - v[880] * v[206]) + x[11] * (v[912] * v[207] - v[883] * v[206]) + x[12] * (v[914] * v[207] - v[886] * v[206]) + (v[935] * v[28] + (v[932] * v[62] + v[826] * v[147]) + (v[929] * v[160] + v[924] * v[78]))) + v[924] * 601. + (v[962] * (v[924] * v[960]) / v[961] + (v[964] * ((v[924] - v[959] * v[236]) / v[956]) + v[959] * v[58]));
+    y[199] = 10. * (v[945] + x[9] * (v[122] * v[905] - v[786] * v[875]) + x[10] * (v[909] * v[214] - v[880] * v[213]) + x[11] * (v[912] * v[214] - v[883] * v[213]) + x[12] * (v[914] * v[214] - v[886] * v[213]) + (v[935] * v[6] + (v[932] * v[69] + v[826] * v[148]) + (v[929] * v[161] + v[924] * v[79]))) + v[929] * 601. + (v[962] * (v[929] * v[960]) / v[961] + (v[964] * ((v[929] - v[959] * v[237]) / v[956]) + v[959] * v[59]));
+    y[200] = 10. * (v[948] + x[10] * (v[748] * v[909] - v[793] * v[880]) + x[11] * (v[912] * v[223] - v[883] * v[222]) + x[12] * (v[914] * v[223] - v[886] * v[222]) + (v[935] * v[7] + (v[932] * v[90] + v[826] * v[149]) + (v[929] * v[162] + v[924] * v[80]))) + v[826] * 601. + (v[962] * (v[826] * v[960]) / v[961] + (v[964] * ((v[826] - v[959] * v[238]) / v[956]) + v[959] * v[60]));
+    y[201] = 10. * (v[951] + x[11] * (v[754] * v[912] - v[797] * v[883]) + x[12] * (v[914] * (v[754] + v[754]) - v[886] * (v[797] + v[797])) + (v[935] * v[11] + (v[932] * v[93] + v[826] * v[153]) + (v[929] * v[164] + v[924] * v[81]))) + v[932] * 601. + (v[962] * (v[932] * v[960]) / v[961] + (v[964] * ((v[932] - v[959] * v[239]) / v[956]) + v[959] * v[63]));
+    y[202] = 10. * (v[954] + x[12] * (v[840] * v[914] - v[841] * v[886]) + (v[935] * v[12] + (v[932] * v[96] + v[826] * v[154]) + (v[929] * v[165] + v[924] * v[82]))) + v[935] * 601. + (v[962] * (v[935] * v[960]) / v[961] + (v[964] * ((v[935] - v[959] * v[240]) / v[956]) + v[959] * v[65]));
+    y[0] = x[7];
+    y[1] = x[8];
+    y[2] = x[9];
+    y[3] = x[10];
+    y[4] = x[11];
+    y[5] = x[12];
+    y[6] = x[13];
+    y[17] = 1.;
+    y[18] = 1.;
+    y[19] = 1.;
+    y[20] = 1.;
+    y[21] = 1.;
+    y[22] = 1.;
+    y[23] = 1.;
+
+    f = Eigen::Map<const state_vector_t>(y);
+    values = Eigen::Map<const values_t>(y + STATE_DIM);
+}
+
+void KUKASoftContactSystemLinearizedFusedForward::linearize(const state_vector_t& state, const control_vector_t& control, state_vector_t& f, state_matrix_t& A, state_control_matrix_t& B)
+{
+    linearizeSparse(state, control, f, values_);
+
+    A.setZero();
+    B.setZero();
+    for (int n = 0; n < NNZ; n++)
+    {
+        if (COLS[n] < (int)STATE_DIM) A(ROWS[n], COLS[n]) = values_[n];
+        else B(ROWS[n], COLS[n] - STATE_DIM) = values_[n];
+    }
+}
+
+}  // namespace KUKA
+}  // namespace models
+}  // namespace ct
+
+// clang-format on
@@ -0,0 +1,57 @@
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaSoftContactDynamics in
+// plant-models/KUKASoftContactSystemCodGenLinearizer.cpp, in the output format of the KUKASoftContactLinearizationCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against KUKASoftContactFDSystem by test_models (src/main_test_models.cpp).
+
+#pragma once
+
+#include <array>
+#include <Eigen/Core>
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+class KUKASoftContactSystemLinearizedFusedForward
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const size_t STATE_DIM = 17;
+    static const size_t CONTROL_DIM = 7;
+    static const size_t PARAM_DIM = 6;
+    static const int NNZ = 195;
+
+    // structural non-zeros of [dF/dx, dF/du], row-major
+    static const int ROWS[NNZ];
+    static const int COLS[NNZ];
+
+    typedef Eigen::Matrix<double, STATE_DIM, 1> state_vector_t;
+    typedef Eigen::Matrix<double, CONTROL_DIM, 1> control_vector_t;
+    typedef Eigen::Matrix<double, STATE_DIM, STATE_DIM> state_matrix_t;
+    typedef Eigen::Matrix<double, STATE_DIM, CONTROL_DIM> state_control_matrix_t;
+    typedef Eigen::Matrix<double, NNZ, 1> values_t;
+    typedef Eigen::Matrix<double, PARAM_DIM, 1> param_vector_t;
+
+    // starts with the parameters the code was generated with
+    KUKASoftContactSystemLinearizedFusedForward();
+
+    // parameters of f(x, u; p), kept for the following calls
+    void setParameters(const param_vector_t& p);
+
+    // f(x, u) and the non-zeros of dF/d(x, u) from one subexpression sweep
+    void linearizeSparse(const state_vector_t& x, const control_vector_t& u, state_vector_t& f, values_t& values);
+
+    // same, scattered into dense dF/dx and dF/du
+    void linearize(const state_vector_t& x, const control_vector_t& u, state_vector_t& f, state_matrix_t& A, state_control_matrix_t& B);
+
+private:
+    std::array<double, 30> in_;
+    std::array<double, 212> out_;
+    std::array<double, 1487> v_;
+    values_t values_;
+};
+
+}  // namespace KUKA
+}  // namespace models
+}  // namespace ct
@@ -0,0 +1,4391 @@
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaSoftContactDynamics in
+// plant-models/KUKASoftContactSystemCodGenLinearizer.cpp, in the output format of the KUKASoftContactLinearizationCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against KUKASoftContactFDSystem by test_models (src/main_test_models.cpp).
+
+// clang-format off
+
+#include <algorithm>
+#include <cmath>
+#include "KUKASoftContactSystemLinearizedFusedReverse.h"
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+const int KUKASoftContactSystemLinearizedFusedReverse::ROWS[KUKASoftContactSystemLinearizedFusedReverse::NNZ] = {0, 1, 2, 3, 4, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16};
+const int KUKASoftContactSystemLinearizedFusedReverse::COLS[KUKASoftContactSystemLinearizedFusedReverse::NNZ] = {7, 8, 9, 10, 11, 12, 13, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 16, 0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 16, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 16, 17, 18, 19, 20, 21, 22, 23};
+
+KUKASoftContactSystemLinearizedFusedReverse::KUKASoftContactSystemLinearizedFusedReverse()
+{
+    const double defaults[PARAM_DIM] = {1000, 0.5, 0.40000000000000002, 0.0050000000000000001, 1000, 10};
+    std::copy(defaults, defaults + PARAM_DIM, in_.begin() + STATE_DIM + CONTROL_DIM);
+}
+
+void KUKASoftContactSystemLinearizedFusedReverse::setParameters(const param_vector_t& p)
+{
+    Eigen::Map<param_vector_t>(in_.data() + STATE_DIM + CONTROL_DIM) = p;
+}
+
+void KUKASoftContactSystemLinearizedFusedReverse::linearizeSparse(const state_vector_t& state, const control_vector_t& control, state_vector_t& f, values_t& values)
+{
+    Eigen::Map<state_vector_t>(in_.data()) = state;
+    Eigen::Map<control_vector_t>(in_.data() + STATE_DIM) = control;
+
+    const double* x = in_.data();
+    double* y = out_.data();
+    double* v = v_.data();
+
+    v[0] = sin(x[0]);
+    v[1] = cos(x[0]);
+    v[2] = sin(x[1]);
+    v[3] = cos(x[1]);
+    v[4] = sin(x[2]);
+    v[5] = cos(x[2]);
+    v[6] = 0.2045 * v[4];
+    v[7] = 0.2045 * v[5];
+    v[8] = -0.2045 * v[4];
+    v[9] = sin(x[3]);
+    v[10] = cos(x[3]);
+    v[11] = 0.2155 * v[10];
+    v[12] = v[9] * -0.2155;
+    v[13] = sin(x[4]);
+    v[14] = cos(x[4]);
+    v[15] = 0.1845 * v[13];
+    v[16] = 0.1845 * v[14];
+    v[17] = -0.1845 * v[13];
+    v[18] = sin(x[5]);
+    v[19] = cos(x[5]);
+    v[20] = 0.2155 * v[19];
+    v[21] = -0.2155 * v[18];
+    v[22] = sin(x[6]);
+    v[23] = cos(x[6]);
+    v[24] = 0.081 * v[22];
+    v[25] = 0.081 * v[23];
+    v[26] = -0.081 * v[22];
+    v[27] = x[7] * v[2];
+    v[28] = x[7] * v[3];
+    v[29] = x[8] * v[28];
+    v[30] = x[8] * v[27];
+    v[31] = 0.071 * v[27];
+    v[32] = 0.025 * v[28];
+    v[33] = x[8] * 0.0579;
+    v[34] = x[8] * v[4] - v[5] * v[27];
+    v[35] = x[8] * v[5] + v[4] * v[27];
+    v[36] = x[8] * v[7] + v[6] * v[27];
+    v[37] = x[8] * v[8] + v[7] * v[27];
+    v[38] = x[9] + v[28];
+    v[39] = x[9] * v[35];
+    v[40] = x[9] * v[34];
+    v[41] = x[9] * v[37];
+    v[42] = x[9] * v[36];
+    v[43] = -0.39 * v[37] + 0.1334 * v[34];
+    v[44] = 0.39 * v[36] + (-0.0117 * v[38] + 0.1257 * v[35]);
+    v[45] = -0.09 * v[36] + (0.0127 * v[38] + -0.0117 * v[35]);
+    v[46] = 3. * v[36] + (-0.09 * v[38] + 0.39 * v[35]);
+    v[47] = 3. * v[37] + -0.39 * v[34];
+    v[48] = 0.09 * v[34];
+    v[49] = v[9] * v[38] + v[10] * v[34];
+    v[50] = v[10] * v[38] - v[9] * v[34];
+    v[51] = v[10] * v[36] + v[11] * v[35];
+    v[52] = v[12] * v[35] - v[9] * v[36];
+    v[53] = 0.2155 * v[34] - v[37];
+    v[54] = x[10] - v[35];
+    v[55] = x[10] * v[50];
+    v[56] = x[10] * v[49];
+    v[57] = x[10] * v[52];
+    v[58] = x[10] * v[51];
+    v[59] = 0.1809 * v[53] + -0.0918 * v[52] + 0.0452 * v[49];
+    v[60] = 0.0918 * v[51] + (-0.0061 * v[54] + 0.0131 * v[50]);
+    v[61] = -0.1809 * v[51] + (0.0411 * v[54] + -0.0061 * v[50]);
+    v[62] = 2.7 * v[51] + (-0.1809 * v[54] + 0.0918 * v[50]);
+    v[63] = 2.7 * v[52] + -0.0918 * v[49];
+    v[64] = 2.7 * v[53] + 0.1809 * v[49];
+    v[65] = v[13] * v[54] - v[14] * v[49];
+    v[66] = v[14] * v[54] + v[13] * v[49];
+    v[67] = v[13] * v[53] - v[14] * v[51] + (v[16] * v[54] + v[15] * v[49]);
+    v[68] = v[14] * v[53] + v[13] * v[51] + (v[17] * v[54] + v[16] * v[49]);
+    v[69] = x[11] + v[50];
+    v[70] = x[11] * v[66];
+    v[71] = x[11] * v[65];
+    v[72] = x[11] * v[68];
+    v[73] = x[11] * v[67];
+    v[74] = 0.0357 * v[52] + -0.1292 * v[68] + 0.0306 * v[65];
+    v[75] = -0.00017 * v[52] + 0.1292 * v[67] + (-0.0027 * v[69] + 0.0279 * v[66]);
+    v[76] = 0.00017 * v[68] + -0.0357 * v[67] + (0.0058 * v[69] + -0.0027 * v[66]);
+    v[77] = 1.7 * v[67] + (-0.0357 * v[69] + 0.1292 * v[66]);
+    v[78] = 1.7 * v[68] + (0.00017 * v[69] + -0.1292 * v[65]);
+    v[79] = 1.7 * v[52] + (-0.00017 * v[66] + 0.0357 * v[65]);
+    v[80] = v[18] * v[69] + v[19] * v[65];
+    v[81] = v[19] * v[69] - v[18] * v[65];
+    v[82] = v[18] * v[52] + v[19] * v[67] + v[20] * v[66];
+    v[83] = v[19] * v[52] - v[18] * v[67] + v[21] * v[66];
+    v[84] = 0.2155 * v[65] - v[68];
+    v[85] = x[12] - v[66];
+    v[86] = x[12] * v[81];
+    v[87] = x[12] * v[80];
+    v[88] = x[12] * v[83];
+    v[89] = x[12] * v[82];
+    v[90] = 0.00108 * v[84] + -0.00072 * v[83] + 0.0005 * v[80];
+    v[91] = 0.00072 * v[82] + 0.0036 * v[81];
+    v[92] = -0.00108 * v[82] + 0.0047 * v[85];
+    v[93] = 1.8 * v[82] + (-0.00108 * v[85] + 0.00072 * v[81]);
+    v[94] = 1.8 * v[83] + -0.00072 * v[80];
+    v[95] = 1.8 * v[84] + 0.00108 * v[80];
+    v[96] = v[22] * v[85] - v[23] * v[80];
+    v[97] = v[23] * v[85] + v[22] * v[80];
+    v[98] = v[22] * v[84] - v[23] * v[82] + (v[25] * v[85] + v[24] * v[80]);
+    v[99] = v[23] * v[84] + v[22] * v[82] + (v[26] * v[85] + v[25] * v[80]);
+    v[100] = x[13] + v[81];
+    v[101] = x[13] * v[97];
+    v[102] = x[13] * v[96];
+    v[103] = x[13] * v[99];
+    v[104] = x[13] * v[98];
+    v[105] = -0.006 * v[99] + 0.001 * v[96];
+    v[106] = 0.006 * v[98] + 0.001 * v[97];
+    v[107] = 0.001 * v[100];
+    v[108] = 0.3 * v[98] + 0.006 * v[97];
+    v[109] = 0.3 * v[99] + -0.006 * v[96];
+    v[110] = 0.3 * v[83];
+    v[111] = v[98] * v[109] - v[99] * v[108] + (v[96] * v[106] - v[97] * v[105]);
+    v[112] = x[23] + x[13] * -0.2 - v[111];
+    v[113] = v[99] * v[110] - v[83] * v[109] + (v[97] * v[107] - v[100] * v[106]) + (0.001 * v[101] - -0.006 * v[104]);
+    v[114] = v[83] * v[108] - v[98] * v[110] + (v[100] * v[105] - v[96] * v[107]) + (0.006 * v[103] - 0.001 * v[102]);
+    v[102] = v[97] * v[110] - v[100] * v[109] + (0.3 * v[103] - 0.006 * v[102]);
+    v[101] = v[100] * v[108] - v[96] * v[110] + (-0.006 * v[101] - 0.3 * v[104]);
+    v[103] = 0.001 * v[23];
+    v[104] = -0.006 * v[25] - v[103];
+    v[115] = 0.001 * v[22];
+    v[116] = -0.006 * v[26] + v[115];
+    v[117] = -0.006 * v[22];
+    v[118] = -0.006 * v[23];
+    v[115] = v[115] + 0.006 * v[24];
+    v[103] = v[103] + 0.006 * v[25];
+    v[119] = 0.006 * v[23];
+    v[120] = 0.006 * v[22];
+    v[121] = v[120] + 0.3 * v[24];
+    v[122] = 0.3 * v[25];
+    v[123] = v[119] + v[122];
+    v[124] = 0.3 * v[23];
+    v[125] = 0.3 * v[22];
+    v[122] = v[122] - v[118];
+    v[126] = v[117] + 0.3 * v[26];
+    v[127] = v[25] * v[125];
+    v[128] = v[25] * v[124];
+    v[129] = v[26] * v[122] + v[25] * v[121] + (v[23] * v[115] + v[22] * v[104]);
+    v[130] = v[127] + v[26] * v[124] + (v[23] * v[120] + v[22] * v[118]);
+    v[131] = v[22] * v[124];
+    v[132] = v[23] * v[125];
+    v[133] = 0.0047 + (v[26] * v[126] + v[25] * v[123] + (v[23] * v[103] + v[22] * v[116]));
+    v[134] = -0.00108 + (v[26] * v[125] - v[128] + (v[22] * v[117] - v[23] * v[119]));
+    v[135] = 1.8 + (v[22] * v[125] + v[23] * v[124]);
+    v[136] = v[82] * v[94] - v[83] * v[93] + (v[80] * v[91] - v[81] * v[90]) + (v[26] * v[101] + v[25] * v[102] + (v[23] * v[114] + v[22] * v[113]));
+    v[137] = x[22] + x[12] * -0.5 - v[136];
+    v[138] = v[129] / v[133];
+    v[139] = v[133] / v[133];
+    v[140] = v[134] / v[133];
+    v[141] = v[130] / v[133];
+    v[142] = 0.0005 + (v[25] * v[122] + v[24] * v[121] + (v[22] * v[115] - v[23] * v[104])) - v[129] * v[138];
+    v[143] = v[25] * v[126] + v[24] * v[123] + (v[22] * v[103] - v[23] * v[116]) - v[133] * v[138];
+    v[127] = v[127] - v[24] * v[124] + (-(v[23] * v[117]) - v[22] * v[119]) - v[134] * v[138];
+    v[128] = 0.00108 + (v[128] + v[24] * v[125] + (v[22] * v[120] - v[23] * v[118])) - v[130] * v[138];
+    v[144] = v[129] - v[129] * v[139];
+    v[145] = v[134] - v[134] * v[139];
+    v[146] = v[130] - v[130] * v[139];
+    v[147] = v[22] * v[122] - v[23] * v[121] - v[129] * v[140];
+    v[148] = -0.00108 + (v[22] * v[126] - v[23] * v[123]) - v[133] * v[140];
+    v[149] = v[135] - v[134] * v[140];
+    v[150] = v[131] - v[132] - v[130] * v[140];
+    v[151] = 0.00108 + (v[23] * v[122] + v[22] * v[121]) - v[129] * v[141];
+    v[131] = v[132] - v[131] - v[134] * v[141];
+    v[132] = v[135] - v[130] * v[141];
+    v[135] = v[129] * v[137] / v[133];
+    v[152] = v[135] + (v[83] * v[95] - v[84] * v[94] + (v[81] * v[92] - v[85] * v[91]) + (v[25] * v[101] + v[24] * v[102] + (v[22] * v[114] - v[23] * v[113])) + (v[88] * v[147] - -0.00072 * v[89] + v[86] * v[142]));
+    v[111] = v[84] * v[93] - v[82] * v[95] + (v[85] * v[90] - v[80] * v[92]) + (v[111] + 0.001 * v[112] / 0.001) + (0.00072 * v[88] - 0.0036 * v[87]);
+    v[153] = v[133] * v[137] / v[133];
+    v[154] = v[134] * v[137] / v[133];
+    v[155] = v[154] + (v[81] * v[95] - v[85] * v[94] + (v[22] * v[101] - v[23] * v[102]) + (v[88] * v[149] + (v[86] * v[127] - 0.00072 * v[87])));
+    v[89] = v[85] * v[93] - v[80] * v[95] + (v[96] * v[109] - v[97] * v[108]) + (-0.00072 * v[86] - v[89] * 2.1);
+    v[156] = v[130] * v[137] / v[133];
+    v[157] = v[156] + (v[80] * v[94] - v[81] * v[93] + (v[23] * v[101] + v[22] * v[102]) + (v[88] * v[150] + v[86] * v[128]));
+    v[158] = 0.2155 * v[128] + v[19] * v[142];
+    v[159] = -0.00072 * v[21] + v[20] * v[127] - v[143];
+    v[160] = v[18] * v[142];
+    v[161] = -0.00072 * v[18];
+    v[162] = v[19] * v[127] - v[161];
+    v[163] = -0.00072 * v[19];
+    v[164] = v[163] + v[18] * v[127];
+    v[165] = 0.0036 * v[18];
+    v[166] = 0.00072 * v[20];
+    v[167] = 0.0036 * v[19];
+    v[168] = 0.00072 * v[19];
+    v[169] = 0.00072 * v[18];
+    v[170] = 0.2155 * v[150] + (v[19] * v[147] - v[169]);
+    v[171] = v[20] * v[149] - v[148];
+    v[172] = v[168] + v[18] * v[147];
+    v[173] = v[19] * v[149];
+    v[174] = v[18] * v[149];
+    v[175] = v[21] * 2.1;
+    v[176] = v[18] * 2.1;
+    v[177] = v[19] * 2.1;
+    v[178] = 0.2155 * v[132];
+    v[179] = v[178] + v[19] * v[151];
+    v[180] = v[20] * v[131] - (v[23] * v[126] + v[22] * v[123] - v[133] * v[141]);
+    v[181] = v[18] * v[151];
+    v[182] = v[19] * v[131];
+    v[183] = v[18] * v[131];
+    v[184] = v[18] * v[158] - v[19] * v[165];
+    v[185] = v[19] * v[169] + v[18] * v[164];
+    v[186] = -0.0027 + (v[19] * v[166] + v[18] * v[159]);
+    v[187] = 0.0058 + (v[19] * v[167] + v[18] * v[160]);
+    v[188] = -0.0357 + (v[19] * v[168] + v[18] * v[162]);
+    v[189] = 0.00017 - v[18] * v[128];
+    v[190] = v[67] * v[78] - v[68] * v[77] + (v[65] * v[75] - v[66] * v[74]) + (v[19] * v[111] + v[18] * v[152]);
+    v[191] = x[21] - x[11] - v[190];
+    v[192] = v[184] / v[187];
+    v[193] = v[186] / v[187];
+    v[194] = v[187] / v[187];
+    v[195] = v[188] / v[187];
+    v[196] = v[189] / v[187];
+    v[197] = v[185] / v[187];
+    v[198] = 0.0306 + (0.2155 * v[179] + (v[18] * v[165] + v[19] * v[158])) - v[184] * v[192];
+    v[199] = 0.2155 * v[180] + (v[19] * v[159] - v[18] * v[166]) - v[186] * v[192];
+    v[200] = 0.2155 * v[181] + (v[19] * v[160] - v[18] * v[167]) - v[187] * v[192];
+    v[201] = 0.2155 * v[182] + (v[19] * v[162] - v[18] * v[168]) - v[188] * v[192];
+    v[178] = -0.1292 + (-(v[19] * v[128]) - v[178]) - v[189] * v[192];
+    v[202] = 0.0357 + (0.2155 * v[183] + (v[19] * v[164] - v[18] * v[169])) - v[185] * v[192];
+    v[203] = v[21] * v[163] + v[20] * v[170] - (0.2155 * v[146] + v[19] * v[144]) - v[184] * v[193];
+    v[204] = 0.0279 + (v[21] * v[175] + v[20] * v[171] - (v[20] * v[145] - (v[133] - v[133] * v[139]))) - v[186] * v[193];
+    v[205] = -0.0027 + (v[21] * v[161] + v[20] * v[172] - v[18] * v[144]) - v[187] * v[193];
+    v[206] = 0.1292 + (v[20] * v[173] - v[21] * v[176] - v[19] * v[145]) - v[188] * v[193];
+    v[146] = v[146] - v[20] * v[150] - v[189] * v[193];
+    v[207] = -0.00017 + (v[21] * v[177] + v[20] * v[174] - v[18] * v[145]) - v[185] * v[193];
+    v[208] = v[184] - v[184] * v[194];
+    v[209] = v[186] - v[186] * v[194];
+    v[210] = v[188] - v[188] * v[194];
+    v[211] = v[189] - v[189] * v[194];
+    v[212] = v[19] * v[170] - v[18] * v[163] - v[184] * v[195];
+    v[213] = 0.1292 + (v[19] * v[171] - v[18] * v[175]) - v[186] * v[195];
+    v[214] = -0.0357 + (v[19] * v[172] - v[18] * v[161]) - v[187] * v[195];
+    v[215] = 1.7 + (v[18] * v[176] + v[19] * v[173]) - v[188] * v[195];
+    v[216] = -(v[19] * v[150]) - v[189] * v[195];
+    v[217] = v[19] * v[174] - v[18] * v[177] - v[185] * v[195];
+    v[179] = -0.1292 - v[179] - v[184] * v[196];
+    v[180] = -v[180] - v[186] * v[196];
+    v[181] = 0.00017 - v[181] - v[187] * v[196];
+    v[182] = -v[182] - v[188] * v[196];
+    v[132] = 1.7 + v[132] - v[189] * v[196];
+    v[183] = -v[183] - v[185] * v[196];
+    v[218] = 0.0357 + (v[19] * v[163] + v[18] * v[170]) - v[184] * v[197];
+    v[219] = -0.00017 + (v[19] * v[175] + v[18] * v[171]) - v[186] * v[197];
+    v[220] = v[18] * v[173] - v[19] * v[176] - v[188] * v[197];
+    v[221] = -(v[18] * v[150]) - v[189] * v[197];
+    v[222] = v[184] * v[191] / v[187];
+    v[223] = v[222] + (v[68] * v[79] - v[52] * v[78] + (v[66] * v[76] - v[69] * v[75]) + (0.2155 * v[157] + (v[19] * v[152] - v[18] * v[111])) + (v[72] * v[212] - v[73] * v[179] + (v[70] * v[198] - v[71] * v[203])));
+    v[224] = v[186] * v[191] / v[187];
+    v[136] = v[224] + (v[52] * v[77] - v[67] * v[79] + (v[69] * v[74] - v[65] * v[76]) + (v[21] * v[89] + v[20] * v[155] - (v[153] + (v[136] + (v[88] * v[148] + v[86] * v[143])))) + (v[72] * v[213] - v[73] * v[180] + (v[70] * v[199] - v[71] * v[204])));
+    v[225] = v[187] * v[191] / v[187];
+    v[226] = v[188] * v[191] / v[187];
+    v[227] = v[226] + (v[66] * v[79] - v[69] * v[78] + (v[19] * v[155] - v[18] * v[89]) + (v[72] * v[215] - v[73] * v[182] + (v[70] * v[201] - v[71] * v[206])));
+    v[228] = v[189] * v[191] / v[187];
+    v[157] = v[228] + (v[69] * v[77] - v[65] * v[79] - v[157] + (v[72] * v[216] - v[73] * v[132] + (v[70] * v[178] - v[71] * v[146])));
+    v[229] = v[185] * v[191] / v[187];
+    v[230] = v[16] * v[178] + v[15] * v[201] + (v[13] * v[199] - v[14] * v[198]);
+    v[231] = v[17] * v[178] + v[16] * v[201] + (v[14] * v[199] + v[13] * v[198]);
+    v[232] = v[13] * v[178] - v[14] * v[201];
+    v[233] = v[14] * v[178] + v[13] * v[201];
+    v[234] = v[16] * v[146] + v[15] * v[206] + (v[13] * v[204] - v[14] * v[203]);
+    v[235] = v[17] * v[146] + v[16] * v[206] + (v[14] * v[204] + v[13] * v[203]);
+    v[236] = v[13] * v[146] - v[14] * v[206];
+    v[237] = v[14] * v[146] + v[13] * v[206];
+    v[238] = v[16] * v[216] + v[15] * v[215] + (v[13] * v[213] - v[14] * v[212]);
+    v[239] = v[17] * v[216] + v[16] * v[215] + (v[14] * v[213] + v[13] * v[212]);
+    v[240] = v[13] * v[216] - v[14] * v[215];
+    v[241] = v[14] * v[216] + v[13] * v[215];
+    v[242] = v[16] * v[132] + v[15] * v[182] + (v[13] * v[180] - v[14] * v[179]);
+    v[243] = v[17] * v[132] + v[16] * v[182] + (v[14] * v[180] + v[13] * v[179]);
+    v[244] = v[13] * v[132] - v[14] * v[182];
+    v[245] = v[14] * v[132] + v[13] * v[182];
+    v[246] = v[17] * v[242] + v[16] * v[238] + (v[14] * v[234] + v[13] * v[230]);
+    v[247] = v[17] * v[183] + v[16] * v[217] + (v[14] * v[207] + v[13] * v[202]);
+    v[248] = v[17] * v[245] + v[16] * v[241] + (v[14] * v[237] + v[13] * v[233]);
+    v[249] = -0.0061 + (v[17] * v[181] + v[16] * v[214] + (v[14] * v[205] + v[13] * v[200]));
+    v[250] = 0.0411 + (v[17] * v[243] + v[16] * v[239] + (v[14] * v[235] + v[13] * v[231]));
+    v[251] = -0.1809 + (v[17] * v[244] + v[16] * v[240] + (v[14] * v[236] + v[13] * v[232]));
+    v[252] = v[51] * v[63] - v[52] * v[62] + (v[49] * v[60] - v[50] * v[59]) + (v[17] * v[157] + v[16] * v[227] + (v[14] * v[136] + v[13] * v[223]));
+    v[253] = x[20] + x[10] * -0.3 - v[252];
+    v[254] = v[246] / v[250];
+    v[255] = v[249] / v[250];
+    v[256] = v[250] / v[250];
+    v[257] = v[251] / v[250];
+    v[258] = v[247] / v[250];
+    v[259] = v[248] / v[250];
+    v[260] = 0.0452 + (v[16] * v[242] + v[15] * v[238] + (v[13] * v[234] - v[14] * v[230])) - v[246] * v[254];
+    v[261] = v[16] * v[181] + v[15] * v[214] + (v[13] * v[205] - v[14] * v[200]) - v[249] * v[254];
+    v[262] = v[16] * v[243] + v[15] * v[239] + (v[13] * v[235] - v[14] * v[231]) - v[250] * v[254];
+    v[263] = v[16] * v[244] + v[15] * v[240] + (v[13] * v[236] - v[14] * v[232]) - v[251] * v[254];
+    v[264] = -0.0918 + (v[16] * v[183] + v[15] * v[217] + (v[13] * v[207] - v[14] * v[202])) - v[247] * v[254];
+    v[265] = 0.1809 + (v[16] * v[245] + v[15] * v[241] + (v[13] * v[237] - v[14] * v[233])) - v[248] * v[254];
+    v[266] = v[16] * v[211] + v[15] * v[210] + (v[13] * v[209] - v[14] * v[208]) - v[246] * v[255];
+    v[267] = 0.0131 + (v[187] - v[187] * v[194]) - v[249] * v[255];
+    v[268] = -0.0061 + (v[17] * v[211] + v[16] * v[210] + (v[14] * v[209] + v[13] * v[208])) - v[250] * v[255];
+    v[269] = 0.0918 + (v[13] * v[211] - v[14] * v[210]) - v[251] * v[255];
+    v[270] = v[185] - v[185] * v[194] - v[247] * v[255];
+    v[271] = v[14] * v[211] + v[13] * v[210] - v[248] * v[255];
+    v[272] = v[246] - v[246] * v[256];
+    v[273] = v[249] - v[249] * v[256];
+    v[274] = v[251] - v[251] * v[256];
+    v[275] = v[247] - v[247] * v[256];
+    v[276] = v[248] - v[248] * v[256];
+    v[277] = v[13] * v[242] - v[14] * v[238] - v[246] * v[257];
+    v[278] = 0.0918 + (v[13] * v[181] - v[14] * v[214]) - v[249] * v[257];
+    v[279] = -0.1809 + (v[13] * v[243] - v[14] * v[239]) - v[250] * v[257];
+    v[280] = 2.7 + (v[13] * v[244] - v[14] * v[240]) - v[251] * v[257];
+    v[281] = v[13] * v[183] - v[14] * v[217] - v[247] * v[257];
+    v[282] = v[13] * v[245] - v[14] * v[241] - v[248] * v[257];
+    v[283] = -0.0918 + (v[16] * v[221] + v[15] * v[220] + (v[13] * v[219] - v[14] * v[218])) - v[246] * v[258];
+    v[284] = v[19] * v[161] + v[18] * v[172] - v[187] * v[197] - v[249] * v[258];
+    v[285] = v[17] * v[221] + v[16] * v[220] + (v[14] * v[219] + v[13] * v[218]) - v[250] * v[258];
+    v[286] = v[13] * v[221] - v[14] * v[220] - v[251] * v[258];
+    v[287] = 2.7 + (1.7 + (v[19] * v[177] + v[18] * v[174]) - v[185] * v[197]) - v[247] * v[258];
+    v[288] = v[14] * v[221] + v[13] * v[220] - v[248] * v[258];
+    v[289] = 0.1809 + (v[14] * v[242] + v[13] * v[238]) - v[246] * v[259];
+    v[290] = v[14] * v[181] + v[13] * v[214] - v[249] * v[259];
+    v[291] = v[14] * v[244] + v[13] * v[240] - v[251] * v[259];
+    v[292] = v[14] * v[183] + v[13] * v[217] - v[247] * v[259];
+    v[293] = 2.7 + (v[14] * v[245] + v[13] * v[241]) - v[248] * v[259];
+    v[294] = v[246] * v[253] / v[250];
+    v[295] = v[294] + (v[52] * v[64] - v[53] * v[63] + (v[50] * v[61] - v[54] * v[60]) + (v[16] * v[157] + v[15] * v[227] + (v[13] * v[136] - v[14] * v[223])) + (v[57] * v[277] - v[58] * v[283] + (v[55] * v[260] - v[56] * v[266])));
+    v[296] = v[249] * v[253] / v[250];
+    v[190] = v[296] + (v[53] * v[62] - v[51] * v[64] + (v[54] * v[59] - v[49] * v[61]) + (v[225] + (v[190] + (v[72] * v[214] - v[73] * v[181] + (v[70] * v[200] - v[71] * v[205])))) + (v[57] * v[278] - v[58] * v[284] + (v[55] * v[261] - v[56] * v[267])));
+    v[297] = v[250] * v[253] / v[250];
+    v[298] = v[251] * v[253] / v[250];
+    v[299] = v[298] + (v[50] * v[64] - v[54] * v[63] + (v[13] * v[157] - v[14] * v[227]) + (v[57] * v[280] - v[58] * v[286] + (v[55] * v[263] - v[56] * v[269])));
+    v[300] = v[247] * v[253] / v[250];
+    v[301] = v[300] + (v[54] * v[62] - v[49] * v[64] + (v[229] + (v[65] * v[78] - v[66] * v[77] + (v[19] * v[89] + v[18] * v[155]) + (v[72] * v[217] - v[73] * v[183] + (v[70] * v[202] - v[71] * v[207])))) + (v[57] * v[281] - v[58] * v[287] + (v[55] * v[264] - v[56] * v[270])));
+    v[302] = v[248] * v[253] / v[250];
+    v[303] = v[302] + (v[49] * v[63] - v[50] * v[62] + (v[14] * v[157] + v[13] * v[227]) + (v[57] * v[282] - v[58] * v[288] + (v[55] * v[265] - v[56] * v[271])));
+    v[304] = 0.2155 * v[265] + (v[10] * v[260] - v[9] * v[261]);
+    v[305] = v[12] * v[264] + v[11] * v[263] - v[262];
+    v[306] = v[10] * v[261] + v[9] * v[260];
+    v[307] = v[10] * v[263] - v[9] * v[264];
+    v[308] = 0.2155 * v[271] + (v[10] * v[266] - v[9] * v[267]);
+    v[309] = v[12] * v[270] + v[11] * v[269] - v[268];
+    v[310] = v[10] * v[267] + v[9] * v[266];
+    v[311] = v[10] * v[269] - v[9] * v[270];
+    v[312] = 0.2155 * v[282] + (v[10] * v[277] - v[9] * v[278]);
+    v[313] = v[12] * v[281] + v[11] * v[280] - v[279];
+    v[314] = v[10] * v[278] + v[9] * v[277];
+    v[315] = v[10] * v[280] - v[9] * v[281];
+    v[316] = 0.2155 * v[288] + (v[10] * v[283] - v[9] * v[284]);
+    v[317] = v[12] * v[287] + v[11] * v[286] - v[285];
+    v[318] = v[10] * v[284] + v[9] * v[283];
+    v[319] = v[10] * v[286] - v[9] * v[287];
+    v[320] = 0.2155 * v[293];
+    v[321] = v[320] + (v[10] * v[289] - v[9] * v[290]);
+    v[322] = v[12] * v[292] + v[11] * v[291] - (v[14] * v[243] + v[13] * v[239] - v[250] * v[259]);
+    v[323] = v[10] * v[290] + v[9] * v[289];
+    v[324] = v[10] * v[291] - v[9] * v[292];
+    v[325] = v[10] * v[308] + v[9] * v[304];
+    v[326] = -(v[9] * v[265]) - v[10] * v[271];
+    v[327] = -0.0117 + (v[10] * v[309] + v[9] * v[305]);
+    v[328] = 0.0127 + (v[10] * v[310] + v[9] * v[306]);
+    v[329] = -0.09 + (v[10] * v[311] + v[9] * v[307]);
+    v[330] = v[36] * v[47] - v[37] * v[46] + (v[34] * v[44] - v[35] * v[43]) + (v[10] * v[190] + v[9] * v[295]);
+    v[331] = x[19] + x[9] * -0.5 - v[330];
+    v[332] = v[325] / v[328];
+    v[333] = v[327] / v[328];
+    v[334] = v[328] / v[328];
+    v[335] = v[329] / v[328];
+    v[336] = v[326] / v[328];
+    v[337] = 0.1334 + (0.2155 * v[321] + (v[10] * v[304] - v[9] * v[308])) - v[325] * v[332];
+    v[338] = 0.2155 * v[322] + (v[10] * v[305] - v[9] * v[309]) - v[327] * v[332];
+    v[339] = 0.2155 * v[323] + (v[10] * v[306] - v[9] * v[310]) - v[328] * v[332];
+    v[340] = 0.2155 * v[324] + (v[10] * v[307] - v[9] * v[311]) - v[329] * v[332];
+    v[320] = -0.39 + (v[9] * v[271] - v[10] * v[265] - v[320]) - v[326] * v[332];
+    v[341] = v[12] * v[316] + v[11] * v[312] - (0.2155 * v[276] + (v[10] * v[272] - v[9] * v[273])) - v[325] * v[333];
+    v[342] = 0.1257 + (v[12] * v[317] + v[11] * v[313] - (v[12] * v[275] + v[11] * v[274] - (v[250] - v[250] * v[256]))) - v[327] * v[333];
+    v[343] = -0.0117 + (v[12] * v[318] + v[11] * v[314] - (v[10] * v[273] + v[9] * v[272])) - v[328] * v[333];
+    v[344] = 0.39 + (v[12] * v[319] + v[11] * v[315] - (v[10] * v[274] - v[9] * v[275])) - v[329] * v[333];
+    v[276] = v[276] + (-(v[11] * v[282]) - v[12] * v[288]) - v[326] * v[333];
+    v[345] = v[325] - v[325] * v[334];
+    v[346] = v[327] - v[327] * v[334];
+    v[347] = v[329] - v[329] * v[334];
+    v[348] = v[326] - v[326] * v[334];
+    v[349] = v[10] * v[312] - v[9] * v[316] - v[325] * v[335];
+    v[350] = 0.39 + (v[10] * v[313] - v[9] * v[317]) - v[327] * v[335];
+    v[351] = -0.09 + (v[10] * v[314] - v[9] * v[318]) - v[328] * v[335];
+    v[352] = 3. + (v[10] * v[315] - v[9] * v[319]) - v[329] * v[335];
+    v[353] = v[9] * v[288] - v[10] * v[282] - v[326] * v[335];
+    v[321] = -0.39 - v[321] - v[325] * v[336];
+    v[322] = -v[322] - v[327] * v[336];
+    v[323] = -v[323] - v[328] * v[336];
+    v[324] = -v[324] - v[329] * v[336];
+    v[293] = 3. + v[293] - v[326] * v[336];
+    v[354] = v[325] * v[331] / v[328];
+    v[355] = v[354] + (v[37] * v[48] + (v[35] * v[45] - v[38] * v[44]) + (0.2155 * v[303] + (v[10] * v[295] - v[9] * v[190])) + (v[41] * v[349] - v[42] * v[321] + (v[39] * v[337] - v[40] * v[341])));
+    v[356] = v[327] * v[331] / v[328];
+    v[252] = v[356] + (v[38] * v[43] - v[34] * v[45] - v[36] * v[48] + (v[12] * v[301] + v[11] * v[299] - (v[297] + (v[252] + (v[57] * v[279] - v[58] * v[285] + (v[55] * v[262] - v[56] * v[268]))))) + (v[41] * v[350] - v[42] * v[322] + (v[39] * v[338] - v[40] * v[342])));
+    v[357] = v[328] * v[331] / v[328];
+    v[358] = v[329] * v[331] / v[328];
+    v[359] = v[358] + (v[35] * v[48] - v[38] * v[47] + (v[10] * v[299] - v[9] * v[301]) + (v[41] * v[352] - v[42] * v[324] + (v[39] * v[340] - v[40] * v[344])));
+    v[360] = v[326] * v[331] / v[328];
+    v[303] = v[360] + (v[38] * v[46] - v[34] * v[48] - v[303] + (v[41] * v[353] - v[42] * v[293] + (v[39] * v[320] - v[40] * v[276])));
+    v[361] = v[7] * v[320] + v[6] * v[340] + (v[4] * v[338] - v[5] * v[337]);
+    v[362] = v[8] * v[320] + v[7] * v[340] + (v[5] * v[338] + v[4] * v[337]);
+    v[363] = v[7] * v[276] + v[6] * v[344] + (v[4] * v[342] - v[5] * v[341]);
+    v[364] = v[8] * v[276] + v[7] * v[344] + (v[5] * v[342] + v[4] * v[341]);
+    v[365] = v[7] * v[353] + v[6] * v[352] + (v[4] * v[350] - v[5] * v[349]);
+    v[366] = v[8] * v[353] + v[7] * v[352] + (v[5] * v[350] + v[4] * v[349]);
+    v[367] = v[7] * v[293] + v[6] * v[324] + (v[4] * v[322] - v[5] * v[321]);
+    v[368] = v[8] * v[293] + v[7] * v[324] + (v[5] * v[322] + v[4] * v[321]);
+    v[369] = v[8] * v[367] + v[7] * v[365] + (v[5] * v[363] + v[4] * v[361]);
+    v[370] = v[8] * v[323] + v[7] * v[351] + (v[5] * v[343] + v[4] * v[339]);
+    v[371] = 0.0579 + (v[8] * v[368] + v[7] * v[366] + (v[5] * v[364] + v[4] * v[362]));
+    v[372] = x[18] + x[8] * -0.5 - (v[27] * v[32] - v[28] * v[31] + (v[8] * v[303] + v[7] * v[359] + (v[5] * v[252] + v[4] * v[355])));
+    v[373] = v[369] / v[371];
+    v[374] = v[370] / v[371];
+    v[375] = 0.071 + (v[7] * v[367] + v[6] * v[365] + (v[4] * v[363] - v[5] * v[361])) - v[369] * v[373];
+    v[376] = v[7] * v[323] + v[6] * v[351] + (v[4] * v[343] - v[5] * v[339]) - v[370] * v[373];
+    v[377] = v[7] * v[348] + v[6] * v[347] + (v[4] * v[346] - v[5] * v[345]) - v[369] * v[374];
+    v[378] = 0.025 + (v[328] - v[328] * v[334]) - v[370] * v[374];
+    v[379] = v[369] * v[372] / v[371];
+    v[380] = v[379] + (v[28] * v[33] - x[8] * v[32] + (v[7] * v[303] + v[6] * v[359] + (v[4] * v[252] - v[5] * v[355])) + (v[29] * v[375] - v[30] * v[377]));
+    v[381] = v[370] * v[372] / v[371];
+    v[330] = v[381] + (x[8] * v[31] - v[27] * v[33] + (v[357] + (v[330] + (v[41] * v[351] - v[42] * v[323] + (v[39] * v[339] - v[40] * v[343])))) + (v[29] * v[376] - v[30] * v[378]));
+    v[382] = v[3] * v[376] + v[2] * v[375];
+    v[383] = v[3] * v[378] + v[2] * v[377];
+    v[384] = 0.0236 + (v[3] * v[383] + v[2] * v[382]);
+    v[385] = (x[17] + x[7] * -0.5 - (v[3] * v[330] + v[2] * v[380])) / v[384];
+    y[7] = v[385];
+    v[386] = v[29] + v[2] * v[385];
+    v[387] = v[3] * v[385] - v[30];
+    v[388] = (v[372] - (v[370] * v[387] + v[369] * v[386])) / v[371];
+    y[8] = v[388];
+    v[389] = v[39] + (v[4] * v[388] - v[5] * v[386]);
+    v[390] = v[5] * v[388] + v[4] * v[386] - v[40];
+    v[391] = v[41] + (v[7] * v[388] + v[6] * v[386]);
+    v[392] = v[8] * v[388] + v[7] * v[386] - v[42];
+    v[393] = (v[331] - (v[326] * v[392] + v[329] * v[391] + (v[328] * v[387] + v[327] * v[390] + v[325] * v[389]))) / v[328];
+    y[9] = v[393];
+    v[394] = v[387] + v[393];
+    v[395] = 0.2155 * v[389] - v[392];
+    v[396] = v[55] + (v[9] * v[394] + v[10] * v[389]);
+    v[397] = v[10] * v[394] - v[9] * v[389] - v[56];
+    v[398] = v[57] + (v[10] * v[391] + v[11] * v[390]);
+    v[399] = v[12] * v[390] - v[9] * v[391] - v[58];
+    v[400] = (v[253] - (v[248] * v[395] + v[247] * v[399] + v[251] * v[398] + (v[249] * v[397] - v[250] * v[390] + v[246] * v[396]))) / v[250];
+    y[10] = v[400];
+    v[401] = v[400] - v[390];
+    v[402] = v[70] + (v[13] * v[401] - v[14] * v[396]);
+    v[403] = v[14] * v[401] + v[13] * v[396] - v[71];
+    v[404] = v[72] + (v[13] * v[395] - v[14] * v[398] + (v[16] * v[401] + v[15] * v[396]));
+    v[405] = v[14] * v[395] + v[13] * v[398] + (v[17] * v[401] + v[16] * v[396]) - v[73];
+    v[406] = (v[191] - (v[185] * v[399] + v[189] * v[405] + v[188] * v[404] + (v[187] * v[397] + v[186] * v[403] + v[184] * v[402]))) / v[187];
+    y[11] = v[406];
+    v[407] = v[397] + v[406];
+    v[408] = 0.2155 * v[402] - v[405];
+    v[409] = v[86] + (v[18] * v[407] + v[19] * v[402]);
+    v[410] = v[88] + (v[18] * v[399] + v[19] * v[404] + v[20] * v[403]);
+    v[411] = (v[137] - (v[130] * v[408] + v[134] * v[410] + (v[129] * v[409] - v[133] * v[403]))) / v[133];
+    y[12] = v[411];
+    y[13] = (v[112] - 0.001 * (v[19] * v[407] - v[18] * v[402] - v[87])) / 0.001;
+    v[87] = v[1] * v[2];
+    v[112] = v[1] * v[3];
+    v[412] = v[4] * v[112];
+    v[413] = v[0] * v[5];
+    v[414] = -v[413] - v[412];
+    v[415] = v[0] * v[4] - v[5] * v[112];
+    v[416] = v[10] * v[415] - v[9] * v[87];
+    v[417] = v[10] * v[87] + v[9] * v[415];
+    v[412] = v[412] + v[413];
+    v[413] = v[1] * 0.42;
+    v[418] = v[1] * 0.4;
+    v[419] = v[2] * v[418];
+    v[420] = v[3] * v[418];
+    v[421] = v[0] * 0.4;
+    v[422] = v[4] * v[421] - v[5] * v[420];
+    v[423] = v[1] * 0.241;
+    v[424] = v[3] * v[423];
+    v[425] = v[5] * v[424];
+    v[426] = v[0] * 0.241;
+    v[427] = v[4] * v[426];
+    v[428] = v[427] - v[425];
+    v[429] = v[2] * v[423];
+    v[430] = v[10] * v[429];
+    v[431] = v[9] * v[428] + v[430];
+    v[432] = v[5] * v[426];
+    v[433] = v[1] * -0.241;
+    v[434] = v[3] * v[433];
+    v[435] = v[4] * v[434] - v[432];
+    v[425] = v[425] - v[427];
+    v[427] = v[9] * v[429];
+    v[436] = v[10] * v[425] + v[427];
+    v[437] = v[13] * v[435] + v[14] * v[436];
+    v[438] = v[2] * v[413] + (v[10] * v[419] + (v[9] * v[422] + (v[19] * v[431] + v[18] * v[437])));
+    v[439] = v[0] * v[2];
+    v[440] = v[1] * v[4];
+    v[441] = v[0] * v[3];
+    v[442] = v[5] * v[441];
+    v[443] = v[4] * v[441];
+    v[444] = v[1] * v[5];
+    v[445] = v[444] - v[443];
+    v[446] = -v[442] - v[440];
+    v[447] = v[10] * v[439] + v[9] * v[446];
+    v[440] = -v[440] - v[442];
+    v[442] = v[10] * v[440] - v[9] * v[439];
+    v[443] = v[443] - v[444];
+    v[444] = v[0] * 0.42;
+    v[448] = v[2] * v[421];
+    v[449] = v[4] * v[418];
+    v[450] = v[0] * -0.4;
+    v[451] = v[3] * v[450];
+    v[452] = v[5] * v[451] - v[449];
+    v[453] = v[3] * v[426];
+    v[454] = v[5] * v[453];
+    v[455] = v[4] * v[433] - v[454];
+    v[456] = v[2] * v[426];
+    v[457] = v[10] * v[456];
+    v[458] = v[9] * v[455] + v[457];
+    v[459] = v[4] * v[453];
+    v[460] = v[5] * v[423];
+    v[461] = v[460] - v[459];
+    v[462] = v[4] * v[423];
+    v[454] = v[454] + v[462];
+    v[463] = v[9] * v[456];
+    v[464] = v[10] * v[454] + v[463];
+    v[465] = v[13] * v[461] + v[14] * v[464];
+    v[466] = v[3] * 0.4;
+    v[467] = v[2] * 0.4;
+    v[468] = v[5] * v[467];
+    v[469] = v[2] * 0.241;
+    v[470] = v[5] * v[469];
+    v[471] = v[9] * v[470];
+    v[472] = v[3] * 0.241;
+    v[473] = v[471] + v[10] * v[472];
+    v[474] = v[4] * v[469];
+    v[475] = v[10] * v[470];
+    v[476] = v[9] * v[472];
+    v[477] = v[476] - v[475];
+    v[478] = v[13] * v[474] + v[14] * v[477];
+    v[479] = v[13] * v[416] + v[14] * v[414];
+    v[480] = v[14] * v[445] + v[13] * v[442];
+    v[481] = v[3] * v[421];
+    v[449] = v[449] + v[5] * v[481];
+    v[457] = v[9] * v[454] - v[457];
+    v[459] = v[459] - v[460];
+    v[460] = v[0] * -0.241;
+    v[482] = v[3] * v[460];
+    v[462] = v[5] * v[482] - v[462];
+    v[483] = v[10] * v[462] - v[463];
+    v[484] = v[13] * v[459] + v[14] * v[483];
+    v[485] = v[9] * v[449] + (v[19] * v[457] + v[18] * v[484]) - v[10] * v[448] - v[2] * v[444];
+    v[486] = v[5] * v[419];
+    v[487] = v[5] * v[429];
+    v[488] = v[9] * v[487] + v[10] * v[424];
+    v[489] = v[4] * v[429];
+    v[490] = v[9] * v[424] - v[10] * v[487];
+    v[491] = v[13] * v[489] + v[14] * v[490];
+    v[492] = v[3] * v[413] + (v[10] * v[420] + (v[9] * v[486] + (v[19] * v[488] + v[18] * v[491])));
+    v[493] = v[4] * v[420] + v[5] * v[421];
+    v[494] = v[4] * v[424];
+    v[432] = v[432] + v[494];
+    v[495] = v[9] * v[432];
+    v[496] = v[10] * v[435];
+    v[497] = v[13] * v[428] + v[14] * v[496];
+    v[498] = v[9] * v[493] + (v[19] * v[495] + v[18] * v[497]);
+    v[427] = v[10] * v[428] - v[427];
+    v[499] = v[14] * v[431];
+    v[500] = v[10] * v[422] + (v[19] * v[427] + v[18] * v[499] - v[9] * v[419]);
+    v[494] = v[5] * v[460] - v[494];
+    v[501] = v[14] * v[494] + v[13] * v[427];
+    v[502] = v[18] * v[501];
+    v[430] = v[9] * v[425] - v[430];
+    v[503] = v[19] * v[437] + v[18] * v[430];
+    v[504] = v[5] * v[448];
+    v[505] = v[5] * v[456];
+    v[506] = v[9] * v[505] + v[10] * v[453];
+    v[507] = v[4] * v[456];
+    v[508] = v[9] * v[453] - v[10] * v[505];
+    v[509] = v[13] * v[507] + v[14] * v[508];
+    v[510] = v[3] * v[444] + (v[10] * v[481] + (v[9] * v[504] + (v[19] * v[506] + v[18] * v[509])));
+    v[511] = v[4] * v[481] - v[5] * v[418];
+    v[512] = v[9] * v[459];
+    v[513] = v[10] * v[461];
+    v[514] = v[13] * v[455] + v[14] * v[513];
+    v[515] = v[9] * v[511] + (v[19] * v[512] + v[18] * v[514]);
+    v[463] = v[10] * v[455] - v[463];
+    v[516] = v[14] * v[458];
+    v[517] = v[10] * v[452] + (v[19] * v[463] + v[18] * v[516] - v[9] * v[448]);
+    v[518] = v[14] * v[461] + v[13] * v[463];
+    v[519] = v[18] * v[518];
+    v[520] = v[19] * v[465] + v[18] * v[457];
+    v[521] = v[5] * v[466];
+    v[522] = v[5] * v[472];
+    v[523] = v[9] * v[522] - v[10] * v[469];
+    v[524] = v[4] * v[472];
+    v[525] = v[2] * -0.241;
+    v[526] = v[9] * v[525] - v[10] * v[522];
+    v[527] = v[13] * v[524] + v[14] * v[526];
+    v[528] = v[9] * v[521] + (v[19] * v[523] + v[18] * v[527]) - v[10] * v[467] - v[2] * 0.42;
+    v[529] = v[4] * v[467];
+    v[530] = v[9] * v[474];
+    v[531] = v[10] * v[474];
+    v[532] = v[13] * v[470] + v[14] * v[531];
+    v[533] = v[18] * v[532] - v[19] * v[530] - v[9] * v[529];
+    v[475] = v[475] - v[476];
+    v[476] = v[14] * v[473];
+    v[534] = v[10] * v[468] + (v[19] * v[475] + v[18] * v[476] - v[9] * v[466]);
+    v[535] = v[14] * v[474] + v[13] * v[475];
+    v[536] = v[18] * v[535];
+    v[537] = v[3] * -0.241;
+    v[471] = v[10] * v[537] - v[471];
+    v[538] = v[19] * v[478] + v[18] * v[471];
+    v[539] = x[8] * v[0];
+    v[540] = x[8] * v[1];
+    v[541] = -(v[510] * v[539]) - v[492] * v[540];
+    v[542] = x[9] * v[87] - v[539];
+    v[543] = v[540] + x[9] * v[439];
+    v[544] = v[540] + v[543];
+    v[545] = v[542] - v[539];
+    v[546] = v[515] * v[545] - v[498] * v[544];
+    v[547] = v[542] + x[10] * v[412];
+    v[548] = v[543] + x[10] * v[443];
+    v[543] = v[543] + v[548];
+    v[542] = v[542] + v[547];
+    v[549] = v[517] * v[542] - v[500] * v[543];
+    v[550] = v[547] + x[11] * v[417];
+    v[551] = v[548] + x[11] * v[447];
+    v[548] = v[548] + v[551];
+    v[547] = v[547] + v[550];
+    v[552] = v[519] * v[547] - v[502] * v[548];
+    v[553] = x[7] * v[485] + x[8] * v[492] + x[9] * v[498] + x[10] * v[500] + x[11] * v[502] + x[12] * v[503];
+    v[554] = x[7] * v[438] + x[8] * v[510] + x[9] * v[515] + x[10] * v[517] + x[11] * v[519] + x[12] * v[520];
+    v[551] = v[551] + (v[551] + x[12] * v[480]);
+    v[550] = v[550] + (v[550] + x[12] * v[479]);
+    v[555] = v[520] * v[550] - v[503] * v[551];
+    v[556] = x[8] * v[528] + x[9] * v[533] + x[10] * v[534] + x[11] * v[536] + x[12] * v[538] + 1e-10;
+    v[557] = sqrt(v[556] * v[556] + v[554] * v[554] + v[553] * v[553]);
+    v[558] = v[553] / v[557];
+    v[559] = v[554] / v[557];
+    v[560] = v[556] / v[557];
+    v[561] = sqrt(x[16] * x[16]);
+    v[562] = x[27] * 10.;
+    v[563] = (x[26] * 2. - 1.) * (x[25] * 3.);
+    v[564] = x[25] * 601.;
+    v[565] = v[556] * v[564];
+    y[14] = v[563] * (v[553] * v[561]) / v[562] + v[558] * v[565];
+    y[15] = v[563] * (v[554] * v[561]) / v[562] + v[559] * v[565];
+    y[16] = (x[8] * v[541] + x[9] * v[546] + x[10] * v[549] + x[11] * v[552] + x[12] * v[555] + (v[411] * v[538] + (v[406] * v[536] + v[400] * v[534]) + (v[393] * v[533] + v[388] * v[528]))) * 10. + v[556] * 601. + (v[563] * (v[556] * v[561]) / v[562] + v[560] * v[565]);
+    v[566] = 1. / v[384];
+    y[37] = v[566];
+    v[567] = v[385] * v[566];
+    v[568] = v[2] * v[566];
+    v[569] = v[3] * v[566];
+    v[570] = v[2] * v[567];
+    v[571] = v[3] * v[567];
+    v[572] = v[569] / v[371];
+    v[573] = v[568] / v[371];
+    v[574] = -(v[370] * v[572]) - v[369] * v[573];
+    y[38] = v[574];
+    v[575] = -(v[3] * v[570]) - v[29] * v[569];
+    v[576] = v[30] * v[569] - v[3] * v[571];
+    v[577] = -(v[376] * v[569]) - v[375] * v[568];
+    v[578] = -(v[2] * v[570]) - v[29] * v[568];
+    v[579] = v[378] * v[569] + v[377] * v[568];
+    v[580] = v[30] * v[568] - v[2] * v[571];
+    v[581] = (-(v[370] * v[576]) - v[369] * v[580]) / v[371];
+    v[582] = -(v[372] * v[572]) - v[374] * v[576] - v[373] * v[575] + v[581];
+    v[583] = (-(v[370] * v[575]) - v[369] * v[578]) / v[371];
+    v[584] = -(v[372] * v[573]) - v[374] * v[580] - v[373] * v[578] + v[583];
+    v[572] = v[381] * v[572] + v[379] * v[573] - v[374] * v[581] - v[373] * v[583];
+    v[573] = v[5] * v[568] - v[4] * v[574];
+    v[581] = -(v[5] * v[574]) - v[4] * v[568];
+    v[583] = -(v[7] * v[574]) - v[6] * v[568];
+    v[585] = -(v[8] * v[574]) - v[7] * v[568];
+    v[586] = v[4] * v[572];
+    v[587] = v[5] * v[572];
+    v[588] = v[7] * v[572];
+    v[589] = v[8] * v[572];
+    v[590] = v[4] * v[584] - v[5] * v[578];
+    v[591] = v[5] * v[584] + v[4] * v[578];
+    v[592] = v[7] * v[584] + v[6] * v[578];
+    v[593] = v[8] * v[584] + v[7] * v[578];
+    v[594] = v[5] * v[580];
+    v[595] = v[4] * v[580];
+    v[596] = v[6] * v[580];
+    v[597] = v[7] * v[580];
+    v[598] = v[585] / v[328];
+    v[599] = v[583] / v[328];
+    v[600] = v[569] / v[328];
+    v[601] = v[581] / v[328];
+    v[602] = v[573] / v[328];
+    v[603] = v[326] * v[598] + v[329] * v[599] - v[328] * v[600] + v[327] * v[601] + v[325] * v[602];
+    y[39] = v[603];
+    v[604] = v[8] * v[586] + v[7] * v[590] + v[39] * v[585];
+    v[605] = v[8] * v[587] + v[7] * v[591] - v[40] * v[585];
+    v[606] = v[8] * v[588] + v[7] * v[592] + v[41] * v[585];
+    v[607] = v[8] * v[589] + v[7] * v[593] - v[42] * v[585];
+    v[608] = v[7] * v[586] + v[6] * v[590] + v[39] * v[583];
+    v[609] = v[7] * v[587] + v[6] * v[591] - v[40] * v[583];
+    v[610] = v[7] * v[588] + v[6] * v[592] + v[41] * v[583];
+    v[611] = v[7] * v[589] + v[6] * v[593] - v[42] * v[583];
+    v[612] = v[4] * v[582] - v[5] * v[575] - v[39] * v[569];
+    v[613] = v[5] * v[582] + v[4] * v[575] + v[40] * v[569];
+    v[614] = v[7] * v[582] + v[6] * v[575] - v[41] * v[569];
+    v[615] = v[8] * v[582] + v[7] * v[575] + v[42] * v[569];
+    v[616] = v[5] * v[586] + v[4] * v[590] + v[39] * v[581];
+    v[617] = v[5] * v[587] + v[4] * v[591] - v[40] * v[581];
+    v[618] = v[5] * v[588] + v[4] * v[592] + v[41] * v[581];
+    v[619] = v[5] * v[589] + v[4] * v[593] - v[42] * v[581];
+    v[620] = v[320] * v[585] + v[340] * v[583] - v[339] * v[569] + v[338] * v[581] + v[337] * v[573];
+    v[621] = v[4] * v[586] - v[5] * v[590] + v[39] * v[573];
+    v[622] = -(v[276] * v[585]) - v[344] * v[583] + v[343] * v[569] - v[342] * v[581] - v[341] * v[573];
+    v[623] = v[4] * v[587] - v[5] * v[591] - v[40] * v[573];
+    v[624] = v[353] * v[585] + v[352] * v[583] - v[351] * v[569] + v[350] * v[581] + v[349] * v[573];
+    v[625] = v[4] * v[588] - v[5] * v[592] + v[41] * v[573];
+    v[626] = -(v[293] * v[585]) - v[324] * v[583] + v[323] * v[569] - v[322] * v[581] - v[321] * v[573];
+    v[627] = v[4] * v[589] - v[5] * v[593] - v[42] * v[573];
+    v[628] = (-(v[326] * v[607]) - v[329] * v[611] - v[328] * v[615] - v[327] * v[619] - v[325] * v[627]) / v[328];
+    v[629] = v[597] + (v[331] * v[598] - v[336] * v[607] - v[335] * v[606]) - v[334] * v[597] - v[333] * v[605] - v[332] * v[604] + v[628];
+    v[630] = (-(v[326] * v[606]) - v[329] * v[610] - v[328] * v[614] - v[327] * v[618] - v[325] * v[625]) / v[328];
+    v[631] = v[596] + (v[331] * v[599] - v[336] * v[611] - v[335] * v[610]) - v[334] * v[596] - v[333] * v[609] - v[332] * v[608] + v[630];
+    v[596] = (-(v[326] * v[597]) - v[329] * v[596] - v[328] * v[576] - v[327] * v[595] + v[325] * v[594]) / v[328];
+    v[597] = (-(v[326] * v[605]) - v[329] * v[609] - v[328] * v[613] - v[327] * v[617] - v[325] * v[623]) / v[328];
+    v[595] = v[595] + (v[331] * v[601] - v[336] * v[619] - v[335] * v[618]) - v[334] * v[595] - v[333] * v[617] - v[332] * v[616] + v[597];
+    v[632] = (-(v[326] * v[604]) - v[329] * v[608] - v[328] * v[612] - v[327] * v[616] - v[325] * v[621]) / v[328];
+    v[594] = v[331] * v[602] - v[336] * v[627] - v[335] * v[625] - v[594] + v[334] * v[594] - v[333] * v[623] - v[332] * v[621] + v[632];
+    v[576] = v[576] + (-(v[360] * v[598]) - v[358] * v[599] + v[357] * v[600] - v[331] * v[600] - v[356] * v[601] - v[354] * v[602] - v[336] * v[615] - v[335] * v[614]) - v[334] * v[576] - v[333] * v[613] - v[332] * v[612] - v[336] * v[628] - v[335] * v[630] + v[596] - v[334] * v[596] - v[333] * v[597] - v[332] * v[632];
+    v[596] = -v[569] - v[603];
+    v[597] = v[10] * v[583] + v[11] * v[581];
+    v[598] = v[12] * v[581] - v[9] * v[583];
+    v[599] = v[9] * v[596] + v[10] * v[573];
+    v[600] = v[10] * v[596] - v[9] * v[573];
+    v[601] = 0.2155 * v[573] - v[585];
+    v[602] = v[10] * v[610] + v[11] * v[609];
+    v[628] = v[12] * v[609] - v[9] * v[610];
+    v[630] = v[10] * v[614] + v[11] * v[613];
+    v[632] = v[12] * v[613] - v[9] * v[614];
+    v[633] = v[11] * v[617];
+    v[634] = v[10] * v[618] + v[633];
+    v[635] = v[12] * v[617];
+    v[636] = v[635] - v[9] * v[618];
+    v[637] = v[10] * v[625] + v[11] * v[623];
+    v[638] = v[12] * v[623] - v[9] * v[625];
+    v[639] = v[9] * v[631] + v[10] * v[608];
+    v[640] = v[10] * v[631] - v[9] * v[608];
+    v[611] = 0.2155 * v[608] - v[611];
+    v[641] = v[9] * v[576] + v[10] * v[612];
+    v[642] = v[10] * v[576] - v[9] * v[612];
+    v[615] = 0.2155 * v[612] - v[615];
+    v[643] = v[9] * v[595] + v[10] * v[616];
+    v[644] = v[10] * v[595] - v[9] * v[616];
+    v[619] = 0.2155 * v[616] - v[619];
+    v[645] = v[9] * v[594] + v[10] * v[621];
+    v[646] = v[10] * v[594] - v[9] * v[621];
+    v[627] = 0.2155 * v[621] - v[627];
+    v[647] = v[10] * v[611] + v[11] * v[619];
+    v[648] = v[12] * v[619] - v[9] * v[611];
+    v[649] = v[9] * v[615] + v[10] * v[627];
+    v[650] = v[10] * v[615] - v[9] * v[627];
+    v[607] = v[607] + 0.2155 * (v[627] - v[604]);
+    v[633] = -(v[10] * v[609]) - v[633];
+    v[635] = v[9] * v[609] - v[635];
+    v[651] = -(v[9] * v[613]) - v[10] * v[623];
+    v[652] = v[9] * v[623] - v[10] * v[613];
+    v[653] = v[605] - 0.2155 * v[623];
+    v[654] = v[601] / v[250];
+    v[655] = v[598] / v[250];
+    v[656] = v[597] / v[250];
+    v[657] = v[581] / v[250];
+    v[658] = v[600] / v[250];
+    v[659] = v[599] / v[250];
+    v[660] = v[248] * v[654] + v[247] * v[655] + v[251] * v[656] - v[250] * v[657] + v[249] * v[658] + v[246] * v[659];
+    y[40] = v[660];
+    v[661] = -(v[9] * v[629]) - v[10] * v[604] + 0.2155 * v[645] + v[55] * v[601];
+    v[662] = v[9] * v[604] - v[10] * v[629] + 0.2155 * v[646] - v[56] * v[601];
+    v[663] = -(v[10] * v[606]) - v[11] * v[605] + 0.2155 * v[637] + v[57] * v[601];
+    v[664] = v[9] * v[606] - v[12] * v[605] + 0.2155 * v[638] - v[58] * v[601];
+    v[665] = v[12] * v[643] - v[9] * v[639] + v[55] * v[598];
+    v[666] = v[12] * v[644] - v[9] * v[640] - v[56] * v[598];
+    v[667] = v[12] * v[634] - v[9] * v[602] + v[57] * v[598];
+    v[668] = v[12] * v[636] - v[9] * v[628] - v[58] * v[598];
+    v[669] = v[10] * v[639] + v[11] * v[643] + v[55] * v[597];
+    v[670] = v[10] * v[640] + v[11] * v[644] - v[56] * v[597];
+    v[671] = v[10] * v[602] + v[11] * v[634] + v[57] * v[597];
+    v[672] = v[10] * v[628] + v[11] * v[636] - v[58] * v[597];
+    v[673] = -v[643] - v[55] * v[581];
+    v[674] = v[56] * v[581] - v[644];
+    v[675] = -v[634] - v[57] * v[581];
+    v[676] = v[58] * v[581] - v[636];
+    v[677] = v[10] * v[641] - v[9] * v[645] + v[55] * v[600];
+    v[678] = v[10] * v[642] - v[9] * v[646] - v[56] * v[600];
+    v[679] = v[10] * v[630] - v[9] * v[637] + v[57] * v[600];
+    v[680] = v[10] * v[632] - v[9] * v[638] - v[58] * v[600];
+    v[681] = v[265] * v[601] + v[264] * v[598] + v[263] * v[597] - v[262] * v[581] + v[261] * v[600] + v[260] * v[599];
+    v[682] = v[9] * v[641] + v[10] * v[645] + v[55] * v[599];
+    v[683] = -(v[271] * v[601]) - v[270] * v[598] - v[269] * v[597] + v[268] * v[581] - v[267] * v[600] - v[266] * v[599];
+    v[684] = v[9] * v[642] + v[10] * v[646] - v[56] * v[599];
+    v[685] = v[282] * v[601] + v[281] * v[598] + v[280] * v[597] - v[279] * v[581] + v[278] * v[600] + v[277] * v[599];
+    v[686] = v[9] * v[630] + v[10] * v[637] + v[57] * v[599];
+    v[687] = -(v[288] * v[601]) - v[287] * v[598] - v[286] * v[597] + v[285] * v[581] - v[284] * v[600] - v[283] * v[599];
+    v[688] = v[9] * v[632] + v[10] * v[638] - v[58] * v[599];
+    v[689] = (-(v[248] * v[607]) - v[247] * v[648] - v[251] * v[647] + v[250] * v[619] - v[249] * v[650] - v[246] * v[649]) / v[250];
+    v[690] = v[653] + (v[253] * v[654] - v[259] * v[607] - v[258] * v[664] - v[257] * v[663]) - v[256] * v[653] - v[255] * v[662] - v[254] * v[661] + v[689];
+    v[691] = (-(v[248] * v[664]) - v[247] * v[668] - v[251] * v[672] - v[250] * v[676] - v[249] * v[680] - v[246] * v[688]) / v[250];
+    v[692] = v[635] + (v[253] * v[655] - v[259] * v[648] - v[258] * v[668] - v[257] * v[667]) - v[256] * v[635] - v[255] * v[666] - v[254] * v[665] + v[691];
+    v[693] = (-(v[248] * v[663]) - v[247] * v[667] - v[251] * v[671] - v[250] * v[675] - v[249] * v[679] - v[246] * v[686]) / v[250];
+    v[694] = v[633] + (v[253] * v[656] - v[259] * v[647] - v[258] * v[672] - v[257] * v[671]) - v[256] * v[633] - v[255] * v[670] - v[254] * v[669] + v[693];
+    v[633] = (-(v[248] * v[653]) - v[247] * v[635] - v[251] * v[633] - v[250] * v[617] - v[249] * v[652] - v[246] * v[651]) / v[250];
+    v[635] = (-(v[248] * v[662]) - v[247] * v[666] - v[251] * v[670] - v[250] * v[674] - v[249] * v[678] - v[246] * v[684]) / v[250];
+    v[652] = v[652] + (v[253] * v[658] - v[259] * v[650] - v[258] * v[680] - v[257] * v[679]) - v[256] * v[652] - v[255] * v[678] - v[254] * v[677] + v[635];
+    v[653] = (-(v[248] * v[661]) - v[247] * v[665] - v[251] * v[669] - v[250] * v[673] - v[249] * v[677] - v[246] * v[682]) / v[250];
+    v[651] = v[651] + (v[253] * v[659] - v[259] * v[649] - v[258] * v[688] - v[257] * v[686]) - v[256] * v[651] - v[255] * v[684] - v[254] * v[682] + v[653];
+    v[633] = v[617] + (-(v[302] * v[654]) - v[300] * v[655] - v[298] * v[656] + v[297] * v[657] - v[253] * v[657] - v[296] * v[658] - v[294] * v[659] + v[259] * v[619] - v[258] * v[676] - v[257] * v[675]) - v[256] * v[617] - v[255] * v[674] - v[254] * v[673] - v[259] * v[689] - v[258] * v[691] - v[257] * v[693] + v[633] - v[256] * v[633] - v[255] * v[635] - v[254] * v[653];
+    v[635] = -v[581] - v[660];
+    v[653] = v[13] * v[635] - v[14] * v[599];
+    v[654] = v[14] * v[635] + v[13] * v[599];
+    v[655] = v[13] * v[601] - v[14] * v[597] + v[16] * v[635] + v[15] * v[599];
+    v[656] = v[14] * v[601] + v[13] * v[597] + v[17] * v[635] + v[16] * v[599];
+    v[657] = v[13] * v[690] - v[14] * v[661];
+    v[658] = v[14] * v[690] + v[13] * v[661];
+    v[659] = v[13] * v[607] - v[14] * v[663] + v[16] * v[690] + v[15] * v[661];
+    v[689] = v[14] * v[607] + v[13] * v[663] + v[17] * v[690] + v[16] * v[661];
+    v[691] = v[13] * v[694] - v[14] * v[669];
+    v[693] = v[14] * v[694] + v[13] * v[669];
+    v[695] = v[13] * v[647] - v[14] * v[671] + v[16] * v[694] + v[15] * v[669];
+    v[696] = v[14] * v[647] + v[13] * v[671] + v[17] * v[694] + v[16] * v[669];
+    v[697] = v[13] * v[633] - v[14] * v[673];
+    v[698] = v[14] * v[633] + v[13] * v[673];
+    v[699] = -(v[13] * v[619]) - v[14] * v[675] + v[16] * v[633] + v[15] * v[673];
+    v[700] = v[13] * v[675] - v[14] * v[619] + v[17] * v[633] + v[16] * v[673];
+    v[701] = v[13] * v[651] - v[14] * v[682];
+    v[702] = v[14] * v[651] + v[13] * v[682];
+    v[703] = v[13] * v[649] - v[14] * v[686] + v[16] * v[651] + v[15] * v[682];
+    v[704] = v[14] * v[649] + v[13] * v[686] + v[17] * v[651] + v[16] * v[682];
+    v[705] = v[13] * v[676] - v[14] * v[688];
+    v[706] = v[14] * v[676] + v[13] * v[688];
+    v[707] = v[13] * v[664] - v[14] * v[672] + v[16] * v[676] + v[15] * v[688];
+    v[708] = v[14] * v[664] + v[13] * v[672] + v[17] * v[676] + v[16] * v[688];
+    v[709] = v[13] * v[674] - v[14] * v[684];
+    v[710] = v[14] * v[674] + v[13] * v[684];
+    v[711] = v[13] * v[662] - v[14] * v[670] + v[16] * v[674] + v[15] * v[684];
+    v[712] = v[14] * v[662] + v[13] * v[670] + v[17] * v[674] + v[16] * v[684];
+    v[713] = v[598] / v[187];
+    v[714] = v[656] / v[187];
+    v[715] = v[655] / v[187];
+    v[716] = v[600] / v[187];
+    v[717] = v[654] / v[187];
+    v[718] = v[653] / v[187];
+    v[719] = v[185] * v[713] + v[189] * v[714] + v[188] * v[715] + v[187] * v[716] + v[186] * v[717] + v[184] * v[718];
+    y[41] = v[719];
+    v[720] = v[13] * v[692] - v[14] * v[665] + v[70] * v[598];
+    v[721] = v[14] * v[692] + v[13] * v[665] - v[71] * v[598];
+    v[722] = v[13] * v[648] - v[14] * v[667] + v[16] * v[692] + v[15] * v[665] + v[72] * v[598];
+    v[723] = v[14] * v[648] + v[13] * v[667] + v[17] * v[692] + v[16] * v[665] - v[73] * v[598];
+    v[724] = v[14] * v[657] + v[13] * v[691] + v[17] * v[697] + v[16] * v[701] + v[70] * v[656];
+    v[725] = v[14] * v[658] + v[13] * v[693] + v[17] * v[698] + v[16] * v[702] - v[71] * v[656];
+    v[726] = v[14] * v[659] + v[13] * v[695] + v[17] * v[699] + v[16] * v[703] + v[72] * v[656];
+    v[727] = v[14] * v[689] + v[13] * v[696] + v[17] * v[700] + v[16] * v[704] - v[73] * v[656];
+    v[728] = v[13] * v[657] - v[14] * v[691] + v[16] * v[697] + v[15] * v[701] + v[70] * v[655];
+    v[729] = v[13] * v[658] - v[14] * v[693] + v[16] * v[698] + v[15] * v[702] - v[71] * v[655];
+    v[730] = v[13] * v[659] - v[14] * v[695] + v[16] * v[699] + v[15] * v[703] + v[72] * v[655];
+    v[731] = v[13] * v[689] - v[14] * v[696] + v[16] * v[700] + v[15] * v[704] - v[73] * v[655];
+    v[732] = v[13] * v[652] - v[14] * v[677] + v[70] * v[600];
+    v[733] = v[14] * v[652] + v[13] * v[677] - v[71] * v[600];
+    v[734] = v[13] * v[650] - v[14] * v[679] + v[16] * v[652] + v[15] * v[677] + v[72] * v[600];
+    v[735] = v[14] * v[650] + v[13] * v[679] + v[17] * v[652] + v[16] * v[677] - v[73] * v[600];
+    v[736] = v[14] * v[697] + v[13] * v[701] + v[70] * v[654];
+    v[737] = v[14] * v[698] + v[13] * v[702] - v[71] * v[654];
+    v[738] = v[14] * v[699] + v[13] * v[703] + v[72] * v[654];
+    v[739] = v[14] * v[700] + v[13] * v[704] - v[73] * v[654];
+    v[740] = v[202] * v[598] + v[178] * v[656] + v[201] * v[655] + v[200] * v[600] + v[199] * v[654] + v[198] * v[653];
+    v[741] = v[13] * v[697] - v[14] * v[701] + v[70] * v[653];
+    v[742] = -(v[207] * v[598]) - v[146] * v[656] - v[206] * v[655] - v[205] * v[600] - v[204] * v[654] - v[203] * v[653];
+    v[743] = v[13] * v[698] - v[14] * v[702] - v[71] * v[653];
+    v[744] = v[217] * v[598] + v[216] * v[656] + v[215] * v[655] + v[214] * v[600] + v[213] * v[654] + v[212] * v[653];
+    v[745] = v[13] * v[699] - v[14] * v[703] + v[72] * v[653];
+    v[746] = -(v[183] * v[598]) - v[132] * v[656] - v[182] * v[655] - v[181] * v[600] - v[180] * v[654] - v[179] * v[653];
+    v[747] = v[13] * v[700] - v[14] * v[704] - v[73] * v[653];
+    v[748] = (-(v[185] * v[668]) - v[189] * v[708] - v[188] * v[707] - v[187] * v[680] - v[186] * v[706] - v[184] * v[705]) / v[187];
+    v[749] = v[666] + (v[191] * v[713] - v[197] * v[668] - v[196] * v[723] - v[195] * v[722]) - v[194] * v[666] - v[193] * v[721] - v[192] * v[720] + v[748];
+    v[750] = (-(v[185] * v[723]) - v[189] * v[727] - v[188] * v[731] - v[187] * v[735] - v[186] * v[739] - v[184] * v[747]) / v[187];
+    v[751] = v[712] + (v[191] * v[714] - v[197] * v[708] - v[196] * v[727] - v[195] * v[726]) - v[194] * v[712] - v[193] * v[725] - v[192] * v[724] + v[750];
+    v[752] = (-(v[185] * v[722]) - v[189] * v[726] - v[188] * v[730] - v[187] * v[734] - v[186] * v[738] - v[184] * v[745]) / v[187];
+    v[753] = v[711] + (v[191] * v[715] - v[197] * v[707] - v[196] * v[731] - v[195] * v[730]) - v[194] * v[711] - v[193] * v[729] - v[192] * v[728] + v[752];
+    v[666] = (-(v[185] * v[666]) - v[189] * v[712] - v[188] * v[711] - v[187] * v[678] - v[186] * v[710] - v[184] * v[709]) / v[187];
+    v[711] = (-(v[185] * v[721]) - v[189] * v[725] - v[188] * v[729] - v[187] * v[733] - v[186] * v[737] - v[184] * v[743]) / v[187];
+    v[710] = v[710] + (v[191] * v[717] - v[197] * v[706] - v[196] * v[739] - v[195] * v[738]) - v[194] * v[710] - v[193] * v[737] - v[192] * v[736] + v[711];
+    v[712] = (-(v[185] * v[720]) - v[189] * v[724] - v[188] * v[728] - v[187] * v[732] - v[186] * v[736] - v[184] * v[741]) / v[187];
+    v[709] = v[709] + (v[191] * v[718] - v[197] * v[705] - v[196] * v[747] - v[195] * v[745]) - v[194] * v[709] - v[193] * v[743] - v[192] * v[741] + v[712];
+    v[666] = v[678] + (-(v[229] * v[713]) - v[228] * v[714] - v[226] * v[715] - v[225] * v[716] + v[191] * v[716] - v[224] * v[717] - v[222] * v[718] - v[197] * v[680] - v[196] * v[735] - v[195] * v[734]) - v[194] * v[678] - v[193] * v[733] - v[192] * v[732] - v[197] * v[748] - v[196] * v[750] - v[195] * v[752] + v[666] - v[194] * v[666] - v[193] * v[711] - v[192] * v[712];
+    v[678] = v[600] - v[719];
+    v[711] = v[18] * v[598] + v[19] * v[655] + v[20] * v[654];
+    v[712] = v[19] * v[598] - v[18] * v[655] + v[21] * v[654];
+    v[713] = v[18] * v[678] + v[19] * v[653];
+    v[714] = v[19] * v[678] - v[18] * v[653];
+    v[715] = 0.2155 * v[653] - v[656];
+    v[716] = v[18] * v[668] + v[19] * v[722] + v[20] * v[721];
+    v[717] = v[18] * v[707] + v[19] * v[730] + v[20] * v[729];
+    v[718] = v[18] * v[680] + v[19] * v[734] + v[20] * v[733];
+    v[748] = v[20] * v[737];
+    v[750] = v[18] * v[706] + v[19] * v[738] + v[748];
+    v[752] = v[18] * v[705] + v[19] * v[745] + v[20] * v[743];
+    v[754] = v[18] * v[749] + v[19] * v[720];
+    v[723] = 0.2155 * v[720] - v[723];
+    v[755] = v[18] * v[753] + v[19] * v[728];
+    v[731] = 0.2155 * v[728] - v[731];
+    v[756] = v[18] * v[666] + v[19] * v[732];
+    v[735] = 0.2155 * v[732] - v[735];
+    v[757] = v[18] * v[710] + v[19] * v[736];
+    v[739] = 0.2155 * v[736] - v[739];
+    v[758] = v[18] * v[709] + v[19] * v[741];
+    v[747] = 0.2155 * v[741] - v[747];
+    v[759] = v[18] * v[723] + v[19] * v[731] + v[20] * v[739];
+    v[760] = v[18] * v[735] + v[19] * v[747];
+    v[727] = v[727] + 0.2155 * (v[747] - v[724]);
+    v[748] = -(v[18] * v[721]) - v[19] * v[729] - v[748];
+    v[761] = -(v[18] * v[733]) - v[19] * v[743];
+    v[762] = v[725] - 0.2155 * v[743];
+    v[763] = v[715] / v[133];
+    v[764] = v[711] / v[133];
+    v[765] = v[654] / v[133];
+    v[766] = v[713] / v[133];
+    v[767] = v[130] * v[763] + v[134] * v[764] - v[133] * v[765] + v[129] * v[766];
+    y[42] = v[767];
+    v[768] = -(v[18] * v[751]) - v[19] * v[724] + 0.2155 * v[758] + v[86] * v[715];
+    v[769] = -(v[18] * v[708]) - v[19] * v[726] - v[20] * v[725] + 0.2155 * v[752] + v[88] * v[715];
+    v[770] = v[18] * v[754] + v[19] * v[755] + v[20] * v[757] + v[86] * v[711];
+    v[771] = v[18] * v[716] + v[19] * v[717] + v[20] * v[750] + v[88] * v[711];
+    v[772] = -v[757] - v[86] * v[654];
+    v[773] = -v[750] - v[88] * v[654];
+    v[774] = -(0.00072 * v[711]) - 0.0036 * v[714];
+    v[775] = v[128] * v[715] + -0.00072 * v[712] + v[127] * v[711] - v[143] * v[654] + v[142] * v[713];
+    v[776] = v[18] * v[756] + v[19] * v[758] + v[86] * v[713];
+    v[777] = v[150] * v[715] + v[149] * v[711] - v[148] * v[654] + 0.00072 * v[714] + v[147] * v[713];
+    v[778] = v[18] * v[718] + v[19] * v[752] + v[88] * v[713];
+    v[779] = -(2.1 * v[712]) - -0.00072 * v[713];
+    v[780] = v[727] + v[771];
+    v[781] = (-(v[130] * v[727]) - v[134] * v[759] + v[133] * v[739] - v[129] * v[760]) / v[133];
+    v[727] = v[762] + (v[137] * v[763] - v[141] * v[727] - v[140] * v[769]) - v[139] * v[762] - v[138] * v[768] + v[781];
+    v[782] = (-(v[130] * v[769]) - v[134] * v[771] - v[133] * v[773] - v[129] * v[778]) / v[133];
+    v[771] = v[748] + (v[137] * v[764] - v[141] * v[759] - v[140] * v[771]) - v[139] * v[748] - v[138] * v[770] + v[782];
+    v[748] = (-(v[130] * v[762]) - v[134] * v[748] - v[133] * v[737] - v[129] * v[761]) / v[133];
+    v[762] = (-(v[130] * v[768]) - v[134] * v[770] - v[133] * v[772] - v[129] * v[776]) / v[133];
+    v[761] = v[761] + (v[137] * v[766] - v[141] * v[760] - v[140] * v[778]) - v[139] * v[761] - v[138] * v[776] + v[762];
+    v[748] = v[737] + (-(v[156] * v[763]) - v[154] * v[764] + v[153] * v[765] - v[137] * v[765] - v[135] * v[766] + v[141] * v[739] - v[140] * v[773]) - v[139] * v[737] - v[138] * v[772] - v[141] * v[781] - v[140] * v[782] + v[748] - v[139] * v[748] - v[138] * v[762];
+    v[762] = -v[654] - v[767];
+    v[763] = v[22] * v[762] - v[23] * v[713];
+    v[764] = v[23] * v[762] + v[22] * v[713];
+    v[765] = v[22] * v[715] - v[23] * v[711] + v[25] * v[762] + v[24] * v[713];
+    v[766] = v[23] * v[715] + v[22] * v[711] + v[26] * v[762] + v[25] * v[713];
+    v[781] = v[769] - v[759];
+    v[759] = v[759] - v[769];
+    v[769] = v[768] - v[771];
+    v[782] = v[770] + v[727];
+    v[783] = v[22] * v[748] - v[23] * v[772];
+    v[784] = v[23] * v[748] + v[22] * v[772];
+    v[785] = -(v[22] * v[739]) - v[23] * v[773] + v[25] * v[748] + v[24] * v[772];
+    v[786] = v[22] * v[773] - v[23] * v[739] + v[26] * v[748] + v[25] * v[772];
+    v[787] = v[22] * v[761] - v[23] * v[776];
+    v[788] = v[23] * v[761] + v[22] * v[776];
+    v[789] = v[22] * v[760] - v[23] * v[778] + v[25] * v[761] + v[24] * v[776];
+    v[790] = v[23] * v[760] + v[22] * v[778] + v[26] * v[761] + v[25] * v[776];
+    v[791] = 0.001 * (v[714] / 0.001);
+    y[43] = v[791];
+    v[792] = -(0.006 * v[765]) - 0.001 * v[764];
+    v[793] = 0.3 * v[765] + 0.006 * v[764];
+    v[794] = -0.006 * v[766] + 0.001 * v[763];
+    v[795] = -(0.3 * v[766]) - -0.006 * v[763];
+    v[796] = v[714] - v[791];
+    v[797] = v[96] * v[796] - v[100] * v[763];
+    v[798] = v[100] * v[764] - v[97] * v[796];
+    v[799] = v[96] * v[712] - v[100] * v[765] - v[83] * v[763] + v[98] * v[796];
+    v[800] = v[100] * v[766] - v[97] * v[712] + v[83] * v[764] - v[99] * v[796];
+    v[801] = v[108] * v[766] - v[109] * v[765] - v[106] * v[763] + v[105] * v[764] + 0.001 * (v[97] * v[763] - v[96] * v[764]);
+    v[802] = v[109] * v[796] - v[110] * v[764] + 0.3 * v[800] + 0.006 * v[797] + x[13] * v[795];
+    v[803] = v[110] * v[763] - v[108] * v[796] + 0.3 * v[799] + -0.006 * v[798] + x[13] * v[793];
+    v[798] = v[109] * v[712] - v[110] * v[766] - v[107] * v[764] + v[106] * v[796] + -0.006 * v[799] + 0.001 * v[798] + x[13] * v[792];
+    v[796] = v[110] * v[765] - v[108] * v[712] + v[107] * v[763] - v[105] * v[796] + 0.006 * v[800] + 0.001 * v[797] + x[13] * v[794];
+    v[797] = v[81] * v[713] - v[80] * v[714];
+    v[799] = v[80] * v[762] - v[85] * v[713];
+    v[800] = v[85] * v[714] - v[81] * v[762];
+    v[804] = v[81] * v[711] - v[80] * v[712] + v[83] * v[713] - v[82] * v[714];
+    v[805] = v[80] * v[715] - v[85] * v[711] - v[84] * v[713] + v[82] * v[762];
+    v[806] = v[85] * v[712] - v[81] * v[715] + v[84] * v[714] - v[83] * v[762];
+    v[807] = v[26] * v[803] + v[25] * v[802] + v[23] * v[796] + v[22] * v[798] - v[94] * v[711] + v[93] * v[712] - v[91] * v[713] + v[90] * v[714] + -0.00108 * v[806] + 0.0047 * v[797];
+    v[808] = v[23] * v[803] + v[22] * v[802] - v[94] * v[713] + v[93] * v[714] + 1.8 * v[804] + 0.00108 * v[800];
+    v[797] = v[22] * v[803] - v[23] * v[802] - v[95] * v[714] + v[94] * v[762] + 1.8 * v[806] + -0.00108 * v[797] + 0.00072 * v[799] + x[12] * v[779];
+    v[763] = v[108] * v[764] - v[109] * v[763] + 0.3 * (v[97] * v[765] - v[96] * v[766] + v[99] * v[763] - v[98] * v[764]) + v[95] * v[713] - v[93] * v[762] + 1.8 * v[805] + -0.00072 * v[800] + x[12] * v[777];
+    v[712] = v[25] * v[803] + v[24] * v[802] + v[22] * v[796] - v[23] * v[798] - v[95] * v[712] + v[94] * v[715] - v[92] * v[714] + v[91] * v[762] + 0.00108 * v[804] + -0.00072 * v[805] + 0.0005 * v[800] + x[12] * v[774];
+    v[714] = v[801] + v[95] * v[711] - v[93] * v[715] + v[92] * v[713] - v[90] * v[762] + 0.00072 * v[806] + 0.0036 * v[799] + x[12] * v[775];
+    v[764] = v[66] * v[653] - v[65] * v[654];
+    v[765] = v[65] * v[678] - v[69] * v[653];
+    v[766] = v[69] * v[654] - v[66] * v[678];
+    v[799] = v[66] * v[655] - v[65] * v[656] + v[68] * v[653] - v[67] * v[654];
+    v[800] = v[65] * v[598] - v[69] * v[655] - v[52] * v[653] + v[67] * v[678];
+    v[804] = v[69] * v[656] - v[66] * v[598] + v[52] * v[654] - v[68] * v[678];
+    v[805] = v[19] * v[714] + v[18] * v[712] - v[78] * v[655] + v[77] * v[656] - v[75] * v[653] + v[74] * v[654] + 0.00017 * v[800] + -0.0357 * v[804] + 0.0058 * v[764] + -0.0027 * v[765];
+    v[806] = v[19] * v[797] - v[18] * v[763] - v[79] * v[654] + v[78] * v[678] + 1.7 * v[804] + -0.0357 * v[764] + 0.1292 * v[765] + x[11] * v[746];
+    v[809] = v[79] * v[653] - v[808] - v[77] * v[678] + 1.7 * v[800] + 0.00017 * v[764] + -0.1292 * v[766] + x[11] * v[744];
+    v[656] = 0.2155 * v[808] - v[18] * v[714] + v[19] * v[712] - v[79] * v[656] + v[78] * v[598] - v[76] * v[654] + v[75] * v[678] + 0.0357 * v[799] + -0.1292 * v[800] + 0.0306 * v[766] + x[11] * v[742];
+    v[764] = v[21] * v[763] - v[807] + v[20] * v[797] + v[79] * v[655] - v[77] * v[598] + v[76] * v[653] - v[74] * v[678] + -0.00017 * v[799] + 0.1292 * v[804] + -0.0027 * v[764] + 0.0279 * v[765] + x[11] * v[740];
+    v[800] = v[50] * v[599] - v[49] * v[600];
+    v[804] = v[49] * v[635] - v[54] * v[599];
+    v[808] = v[54] * v[600] - v[50] * v[635];
+    v[810] = v[50] * v[597] - v[49] * v[598] + v[52] * v[599] - v[51] * v[600];
+    v[811] = v[49] * v[601] - v[54] * v[597] - v[53] * v[599] + v[51] * v[635];
+    v[812] = v[54] * v[598] - v[50] * v[601] + v[53] * v[600] - v[52] * v[635];
+    v[813] = v[17] * v[809] + v[16] * v[806] + v[14] * v[764] + v[13] * v[656] - v[63] * v[597] + v[62] * v[598] - v[60] * v[599] + v[59] * v[600] + -0.1809 * v[812] + 0.0411 * v[800] + -0.0061 * v[804];
+    v[814] = v[14] * v[809] + v[13] * v[806] - v[63] * v[599] + v[62] * v[600] + 2.7 * v[810] + 0.1809 * v[808];
+    v[815] = v[13] * v[809] - v[14] * v[806] - v[64] * v[600] + v[63] * v[635] + 2.7 * v[812] + -0.1809 * v[800] + 0.0918 * v[804] + x[10] * v[687];
+    v[765] = v[19] * v[763] + v[18] * v[797] - v[78] * v[653] + v[77] * v[654] + 1.7 * v[799] + -0.00017 * v[765] + 0.0357 * v[766] + v[64] * v[599] - v[62] * v[635] + 2.7 * v[811] + -0.0918 * v[808] + x[10] * v[685];
+    v[600] = v[16] * v[809] + v[15] * v[806] + v[13] * v[764] - v[14] * v[656] - v[64] * v[598] + v[63] * v[601] - v[61] * v[600] + v[60] * v[635] + 0.1809 * v[810] + -0.0918 * v[811] + 0.0452 * v[808] + x[10] * v[683];
+    v[766] = v[805] + v[64] * v[597] - v[62] * v[601] + v[61] * v[599] - v[59] * v[635] + 0.0918 * v[812] + -0.0061 * v[800] + 0.0131 * v[804] + x[10] * v[681];
+    v[799] = v[35] * v[573] - v[34] * v[581];
+    v[800] = v[34] * v[596] - v[38] * v[573];
+    v[804] = v[38] * v[581] - v[35] * v[596];
+    v[808] = v[36] * v[596] - v[38] * v[583];
+    v[810] = v[38] * v[585] - v[37] * v[596];
+    v[811] = v[10] * v[766] + v[9] * v[600] - v[47] * v[583] + v[46] * v[585] - v[44] * v[573] + v[43] * v[581] + -0.09 * v[810] + 0.0127 * v[799] + -0.0117 * v[800];
+    v[812] = v[10] * v[815] - v[9] * v[765] - v[48] * v[581] + v[47] * v[596] + 3. * v[810] + -0.09 * v[799] + 0.39 * v[800] + x[9] * v[626];
+    v[816] = v[48] * v[573] - v[814] - v[46] * v[596] + 3. * v[808] + -0.39 * v[804] + x[9] * v[624];
+    v[585] = 0.2155 * v[814] - v[9] * v[766] + v[10] * v[600] - v[48] * v[585] - v[45] * v[581] + v[44] * v[596] + 0.09 * (v[35] * v[583] - v[34] * v[585] + v[37] * v[573] - v[36] * v[581]) + -0.39 * v[808] + 0.1334 * v[804] + x[9] * v[622];
+    v[799] = v[12] * v[765] - v[813] + v[11] * v[815] + v[48] * v[583] + v[45] * v[573] - v[43] * v[596] + 0.39 * v[810] + -0.0117 * v[799] + 0.1257 * v[800] + x[9] * v[620];
+    v[800] = v[7] * v[816] + v[6] * v[812] + v[4] * v[799] - v[5] * v[585] + v[33] * v[569] - v[32] * v[574] + 0.071 * (v[28] * v[574] - x[8] * v[569]) + x[8] * v[579];
+    v[804] = v[811] - v[33] * v[568] + v[31] * v[574] + 0.025 * (x[8] * v[568] - v[27] * v[574]) + x[8] * v[577];
+    y[29] = v[23] * (v[102] * v[715] + v[101] * v[711] + v[113] * v[762] + v[114] * v[713] - v[123] * v[739] + v[121] * v[760] + v[124] * v[781] + v[125] * v[780] + v[126] * v[773] + v[122] * v[778] + v[118] * v[727] + v[117] * v[771] + v[116] * v[748] + v[104] * v[761] + v[120] * v[768] - v[119] * v[770] + v[103] * v[772] + v[115] * v[776] + 0.3 * (v[23] * v[759] + v[22] * v[780] + v[26] * v[771] + v[24] * v[768] + v[25] * v[782]) + 0.006 * (v[23] * v[727] + v[22] * v[768] + v[789]) + -0.006 * (v[22] * v[771] - v[23] * v[770] + v[786]) + 0.001 * (v[783] + v[788]) + v[82] * v[803] + v[84] * v[802] + v[80] * v[796] + v[85] * v[798] + -0.081 * (v[101] * v[762] + v[124] * v[727] + v[125] * v[771] + v[126] * v[748] + v[122] * v[761] + 0.3 * v[786] + -0.006 * v[783] + v[85] * v[803]) + 0.081 * (v[102] * v[713] + v[125] * v[768] - v[124] * v[770] + v[123] * v[772] + v[121] * v[776] + 0.3 * v[789] + 0.006 * v[788] + v[80] * v[802])) - v[22] * (v[101] * v[715] - v[102] * v[711] + v[114] * v[762] - v[113] * v[713] - v[126] * v[739] + v[122] * v[760] + v[125] * v[759] + v[124] * v[780] - v[123] * v[773] - v[121] * v[778] + v[120] * v[727] - v[119] * v[771] + v[103] * v[748] + v[115] * v[761] - v[118] * v[768] - v[117] * v[770] - v[116] * v[772] - v[104] * v[776] + 0.3 * (v[22] * v[781] + v[23] * v[780] + v[26] * v[727] + v[25] * v[769] - v[24] * v[770]) + 0.006 * (-(v[23] * v[771]) - v[22] * v[770] + v[785]) + -0.006 * (v[22] * v[727] - v[23] * v[768] - v[790]) + 0.001 * (v[784] - v[787]) + v[84] * v[803] - v[82] * v[802] + v[85] * v[796] - v[80] * v[798] + 0.081 * (v[102] * v[762] + v[101] * v[713] + v[123] * v[748] + v[121] * v[761] + v[124] * v[769] + v[125] * v[782] + v[126] * v[772] + v[122] * v[776] + 0.3 * (v[785] + v[790]) + 0.006 * v[784] + -0.006 * v[787] + v[80] * v[803] + v[85] * v[802]));
+    y[28] = v[19] * (v[155] * v[598] - v[89] * v[655] + v[152] * v[678] - v[111] * v[653] + v[174] * v[668] - v[150] * v[708] + v[173] * v[707] + v[172] * v[680] + v[171] * v[706] + v[170] * v[705] - v[177] * v[722] + v[176] * v[730] - v[161] * v[734] - v[175] * v[738] - v[163] * v[745] + v[164] * v[749] - v[128] * v[751] + v[162] * v[753] + v[160] * v[666] + v[159] * v[710] + v[158] * v[709] - v[169] * v[720] - v[168] * v[728] - v[167] * v[732] - v[166] * v[736] + v[165] * v[741] + v[131] * v[723] + v[151] * v[735] + 2.1 * (v[18] * v[730] - v[19] * v[707] - v[21] * v[729]) + v[149] * v[716] + v[147] * v[718] - v[145] * v[721] - v[144] * v[733] + 0.00072 * (v[19] * v[749] - v[18] * v[720] - v[752]) + 0.0036 * (v[18] * v[741] - v[19] * v[709]) + v[127] * v[754] + -0.00072 * (v[19] * v[680] - v[18] * v[734] + v[21] * v[733] - v[755]) + v[142] * v[756] - v[67] * v[763] + v[52] * v[797] - v[65] * v[714] + v[69] * v[712] + -0.2155 * (v[89] * v[654] + v[177] * v[721] - v[176] * v[729] + v[161] * v[733] + v[175] * v[737] + v[163] * v[743] + 2.1 * (v[19] * v[706] - v[18] * v[738] + v[21] * v[737]) + -0.00072 * v[757] + v[66] * v[763])) - v[18] * (v[89] * v[598] + v[155] * v[655] + v[111] * v[678] + v[152] * v[653] + v[177] * v[668] - v[176] * v[707] + v[161] * v[680] + v[175] * v[706] + v[163] * v[705] + v[174] * v[722] - v[150] * v[726] + v[173] * v[730] + v[172] * v[734] + v[171] * v[738] + v[170] * v[745] + v[169] * v[749] + v[168] * v[753] + v[167] * v[666] + v[166] * v[710] - v[165] * v[709] + v[164] * v[720] - v[128] * v[724] + v[162] * v[728] + v[160] * v[732] + v[159] * v[736] + v[158] * v[741] + v[131] * v[731] + v[151] * v[747] + 2.1 * (v[19] * v[668] - v[18] * v[722] + v[21] * v[721]) + v[149] * v[717] + v[147] * v[752] - v[145] * v[729] - v[144] * v[743] + 0.00072 * (v[718] + (v[19] * v[753] - v[18] * v[728])) + 0.0036 * (v[19] * v[666] - v[18] * v[732]) + -0.00072 * (v[19] * v[705] - v[18] * v[745] + v[21] * v[743] + v[754]) + v[127] * v[755] + v[142] * v[758] + v[52] * v[763] + v[67] * v[797] + v[69] * v[714] + v[65] * v[712] + 0.2155 * (v[155] * v[654] + v[174] * v[721] - v[150] * v[725] + v[173] * v[729] + v[172] * v[733] + v[171] * v[737] + v[170] * v[743] + v[131] * v[739] + v[149] * v[750] - v[145] * v[737] + 0.00072 * (v[19] * v[710] - v[18] * v[736]) + v[127] * v[757] + v[66] * v[797]));
+    y[27] = v[14] * (v[227] * v[601] + v[157] * v[597] + v[223] * v[635] + v[136] * v[599] + v[241] * v[607] + v[217] * v[648] + v[240] * v[647] - v[239] * v[619] + v[214] * v[650] + v[238] * v[649] + v[245] * v[663] + v[183] * v[667] + v[244] * v[671] + v[243] * v[675] + v[181] * v[679] + v[242] * v[686] + v[233] * v[690] + v[202] * v[692] + v[232] * v[694] + v[231] * v[633] + v[200] * v[652] + v[230] * v[651] + v[237] * v[661] + v[207] * v[665] + v[236] * v[669] + v[235] * v[673] + v[205] * v[677] + v[234] * v[682] + v[220] * v[664] + v[221] * v[672] + v[218] * v[676] + v[219] * v[688] + v[182] * v[689] + v[132] * v[696] + v[179] * v[700] + v[180] * v[704] + v[215] * v[659] + v[216] * v[695] + v[212] * v[699] + v[213] * v[703] + v[210] * v[662] + v[211] * v[670] + v[208] * v[674] + v[209] * v[684] + v[206] * v[658] + v[146] * v[693] + v[203] * v[698] + v[204] * v[702] + v[201] * v[657] + v[178] * v[691] + v[198] * v[697] + v[199] * v[701] + v[51] * v[809] + v[53] * v[806] + v[49] * v[764] + v[54] * v[656] + -0.1845 * (v[157] * v[635] + v[245] * v[690] + v[183] * v[692] + v[244] * v[694] + v[243] * v[633] + v[181] * v[652] + v[242] * v[651] + v[221] * v[676] + v[132] * v[700] + v[216] * v[699] + v[211] * v[674] + v[146] * v[698] + v[178] * v[697] + v[54] * v[809]) + 0.1845 * (v[227] * v[599] + v[241] * v[661] + v[217] * v[665] + v[240] * v[669] + v[239] * v[673] + v[214] * v[677] + v[238] * v[682] + v[220] * v[688] + v[182] * v[704] + v[215] * v[703] + v[210] * v[684] + v[206] * v[702] + v[201] * v[701] + v[49] * v[806])) - v[13] * (v[157] * v[601] - v[227] * v[597] + v[136] * v[635] - v[223] * v[599] + v[245] * v[607] + v[183] * v[648] + v[244] * v[647] - v[243] * v[619] + v[181] * v[650] + v[242] * v[649] - v[241] * v[663] - v[217] * v[667] - v[240] * v[671] - v[239] * v[675] - v[214] * v[679] - v[238] * v[686] + v[237] * v[690] + v[207] * v[692] + v[236] * v[694] + v[235] * v[633] + v[205] * v[652] + v[234] * v[651] - v[233] * v[661] - v[202] * v[665] - v[232] * v[669] - v[231] * v[673] - v[200] * v[677] - v[230] * v[682] + v[221] * v[664] - v[220] * v[672] + v[219] * v[676] - v[218] * v[688] + v[132] * v[689] - v[182] * v[696] + v[180] * v[700] - v[179] * v[704] + v[216] * v[659] - v[215] * v[695] + v[213] * v[699] - v[212] * v[703] + v[211] * v[662] - v[210] * v[670] + v[209] * v[674] - v[208] * v[684] + v[146] * v[658] - v[206] * v[693] + v[204] * v[698] - v[203] * v[702] + v[178] * v[657] - v[201] * v[691] + v[199] * v[697] - v[198] * v[701] + v[53] * v[809] - v[51] * v[806] + v[54] * v[764] - v[49] * v[656] + 0.1845 * (v[227] * v[635] + v[157] * v[599] + v[241] * v[690] + v[217] * v[692] + v[240] * v[694] + v[239] * v[633] + v[214] * v[652] + v[238] * v[651] + v[245] * v[661] + v[183] * v[665] + v[244] * v[669] + v[243] * v[673] + v[181] * v[677] + v[242] * v[682] + v[220] * v[676] + v[221] * v[688] + v[182] * v[700] + v[132] * v[704] + v[215] * v[699] + v[216] * v[703] + v[210] * v[674] + v[211] * v[684] + v[206] * v[698] + v[146] * v[702] + v[201] * v[697] + v[178] * v[701] + v[49] * v[809] + v[54] * v[806]));
+    y[26] = v[10] * (v[295] * v[596] - v[301] * v[583] - v[190] * v[573] + v[288] * v[606] - v[319] * v[610] - v[318] * v[614] - v[317] * v[618] - v[316] * v[625] - v[265] * v[629] + v[307] * v[631] + v[306] * v[576] + v[305] * v[595] + v[304] * v[594] + v[271] * v[604] - v[311] * v[608] - v[310] * v[612] - v[309] * v[616] - v[308] * v[621] - v[292] * v[611] + v[289] * v[615] - v[290] * v[627] - v[287] * v[628] + v[283] * v[632] - v[284] * v[638] - v[281] * v[602] + v[277] * v[630] - v[278] * v[637] + v[275] * v[609] - v[272] * v[613] + v[273] * v[623] - v[270] * v[640] + v[266] * v[642] - v[267] * v[646] - v[264] * v[639] + v[260] * v[641] - v[261] * v[645] - v[36] * v[765] - v[34] * v[766] + v[38] * v[600] + -0.2155 * (v[301] * v[581] - v[288] * v[605] + v[319] * v[609] + v[318] * v[613] + v[317] * v[617] + v[316] * v[623] + v[292] * v[619] + v[287] * v[636] + v[281] * v[634] - v[275] * v[617] + v[270] * v[644] + v[264] * v[643] + v[35] * v[765])) - v[9] * (v[299] * v[583] + v[190] * v[596] + v[295] * v[573] - v[282] * v[606] + v[315] * v[610] + v[314] * v[614] + v[313] * v[618] + v[312] * v[625] - v[271] * v[629] + v[311] * v[631] + v[310] * v[576] + v[309] * v[595] + v[308] * v[594] - v[265] * v[604] + v[307] * v[608] + v[306] * v[612] + v[305] * v[616] + v[304] * v[621] + v[291] * v[611] + v[290] * v[615] + v[289] * v[627] + v[286] * v[628] + v[284] * v[632] + v[283] * v[638] + v[280] * v[602] + v[278] * v[630] + v[277] * v[637] - v[274] * v[609] - v[273] * v[613] - v[272] * v[623] + v[269] * v[640] + v[267] * v[642] + v[266] * v[646] + v[263] * v[639] + v[261] * v[641] + v[260] * v[645] + v[36] * v[815] + v[38] * v[766] + v[34] * v[600] + 0.2155 * (v[299] * v[581] - v[282] * v[605] + v[315] * v[609] + v[314] * v[613] + v[313] * v[617] + v[312] * v[623] + v[291] * v[619] + v[286] * v[636] + v[280] * v[634] - v[274] * v[617] + v[269] * v[644] + v[263] * v[643] + v[35] * v[815]));
+    y[25] = v[5] * (-(v[355] * v[574]) - v[252] * v[568] + v[362] * v[572] + v[339] * v[582] + v[361] * v[584] + v[343] * v[575] + v[363] * v[578] + v[321] * v[589] + v[322] * v[593] + v[349] * v[588] + v[350] * v[592] + v[346] * v[580] + v[341] * v[587] + v[342] * v[591] + v[337] * v[586] + v[338] * v[590] + v[27] * v[799] + x[8] * v[585] + -0.2045 * (v[368] * v[572] - v[303] * v[574] + v[323] * v[582] + v[367] * v[584] + v[293] * v[589] + v[353] * v[588] + v[276] * v[587] + v[320] * v[586] + x[8] * v[816]) + 0.2045 * (v[351] * v[575] - v[359] * v[568] + v[365] * v[578] + v[324] * v[593] + v[352] * v[592] + v[347] * v[580] + v[344] * v[591] + v[340] * v[590] + v[27] * v[812])) - v[4] * (v[355] * v[568] - v[252] * v[574] + v[364] * v[572] + v[343] * v[582] + v[363] * v[584] - v[339] * v[575] - v[361] * v[578] + v[322] * v[589] - v[321] * v[593] + v[350] * v[588] - v[349] * v[592] - v[345] * v[580] + v[342] * v[587] - v[341] * v[591] + v[338] * v[586] - v[337] * v[590] + x[8] * v[799] - v[27] * v[585] + 0.2045 * (-(v[359] * v[574]) - v[303] * v[568] + v[366] * v[572] + v[351] * v[582] + v[365] * v[584] + v[323] * v[575] + v[367] * v[578] + v[324] * v[589] + v[293] * v[593] + v[352] * v[588] + v[353] * v[592] + v[348] * v[580] + v[344] * v[587] + v[276] * v[591] + v[340] * v[586] + v[320] * v[590] + v[27] * v[816] + x[8] * v[812]));
+    y[24] = v[3] * (-(v[380] * v[566]) - v[382] * v[567] - v[377] * v[571] - v[375] * v[570] + x[7] * v[800]) - v[2] * (-(v[330] * v[566]) - v[383] * v[567] - v[378] * v[571] - v[376] * v[570] + x[7] * v[804]);
+    y[36] = v[801] + (v[98] * v[795] + v[99] * v[793] + v[96] * v[792] + v[97] * v[794]) + -0.2 * v[791];
+    y[35] = v[807] + (v[82] * v[779] + v[83] * v[777] + v[80] * v[774] + v[81] * v[775]) + -0.5 * v[767];
+    y[34] = v[805] + (v[67] * v[746] + v[68] * v[744] + v[65] * v[742] + v[66] * v[740]) - v[719];
+    y[33] = v[813] + (v[51] * v[687] + v[52] * v[685] + v[49] * v[683] + v[50] * v[681]) + -0.3 * v[660];
+    y[32] = v[811] + (v[36] * v[626] + v[37] * v[624] + v[34] * v[622] + v[35] * v[620]) + -0.5 * v[603];
+    y[31] = v[8] * v[816] + v[7] * v[812] + v[5] * v[799] + v[4] * v[585] + v[32] * v[568] - v[31] * v[569] + 0.0579 * (v[27] * v[569] - v[28] * v[568]) + v[27] * v[579] + v[28] * v[577] + -0.5 * v[574];
+    y[30] = v[3] * v[804] + v[2] * v[800] + -0.5 * v[566];
+    v[566] = 1. / v[371];
+    v[567] = v[369] * v[566];
+    v[568] = v[370] * v[566];
+    v[569] = (-(v[3] * v[568]) - v[2] * v[567]) / v[384];
+    y[57] = v[569];
+    v[570] = v[385] * v[569];
+    v[571] = v[2] * v[569];
+    v[572] = v[3] * v[569];
+    v[573] = v[2] * v[570];
+    v[574] = v[3] * v[570];
+    v[575] = v[572] / v[371];
+    v[576] = v[571] / v[371];
+    v[577] = v[566] - v[370] * v[575] - v[369] * v[576];
+    y[58] = v[577];
+    v[578] = -(v[3] * v[573]) - v[29] * v[572];
+    v[579] = v[30] * v[572] - v[3] * v[574];
+    v[580] = -v[567] - v[376] * v[572] - v[375] * v[571];
+    v[581] = -(v[2] * v[573]) - v[29] * v[571];
+    v[582] = v[568] + v[378] * v[572] + v[377] * v[571];
+    v[583] = v[30] * v[571] - v[2] * v[574];
+    v[584] = (-(v[370] * v[579]) - v[369] * v[583]) / v[371];
+    v[585] = -(v[387] * v[566]) - v[372] * v[575] - v[374] * v[579] - v[373] * v[578] + v[584];
+    v[586] = (-(v[370] * v[578]) - v[369] * v[581]) / v[371];
+    v[587] = -(v[386] * v[566]) - v[372] * v[576] - v[374] * v[583] - v[373] * v[581] + v[586];
+    v[566] = v[381] * v[575] - v[388] * v[566] + v[379] * v[576] - v[374] * v[584] - v[373] * v[586];
+    v[575] = v[5] * v[571] - v[4] * v[577];
+    v[576] = -(v[5] * v[577]) - v[4] * v[571];
+    v[584] = -(v[7] * v[577]) - v[6] * v[571];
+    v[586] = -(v[8] * v[577]) - v[7] * v[571];
+    v[588] = v[4] * v[566];
+    v[589] = v[5] * v[566];
+    v[590] = v[7] * v[566];
+    v[591] = v[8] * v[566];
+    v[592] = v[4] * v[587] - v[5] * v[581];
+    v[593] = v[5] * v[587] + v[4] * v[581];
+    v[594] = v[7] * v[587] + v[6] * v[581];
+    v[595] = v[8] * v[587] + v[7] * v[581];
+    v[596] = v[5] * v[583];
+    v[597] = v[4] * v[583];
+    v[598] = v[6] * v[583];
+    v[599] = v[7] * v[583];
+    v[600] = v[586] / v[328];
+    v[601] = v[584] / v[328];
+    v[602] = v[572] / v[328];
+    v[603] = v[576] / v[328];
+    v[604] = v[575] / v[328];
+    v[605] = v[326] * v[600] + v[329] * v[601] - v[328] * v[602] + v[327] * v[603] + v[325] * v[604];
+    y[59] = v[605];
+    v[606] = v[8] * v[588] + v[7] * v[592] + v[39] * v[586];
+    v[607] = v[8] * v[589] + v[7] * v[593] - v[40] * v[586];
+    v[608] = v[8] * v[590] + v[7] * v[594] + v[41] * v[586];
+    v[609] = v[8] * v[591] + v[7] * v[595] - v[42] * v[586];
+    v[610] = v[7] * v[588] + v[6] * v[592] + v[39] * v[584];
+    v[611] = v[7] * v[589] + v[6] * v[593] - v[40] * v[584];
+    v[612] = v[7] * v[590] + v[6] * v[594] + v[41] * v[584];
+    v[613] = v[7] * v[591] + v[6] * v[595] - v[42] * v[584];
+    v[614] = v[4] * v[585] - v[5] * v[578] - v[39] * v[572];
+    v[615] = v[5] * v[585] + v[4] * v[578] + v[40] * v[572];
+    v[616] = v[7] * v[585] + v[6] * v[578] - v[41] * v[572];
+    v[617] = v[8] * v[585] + v[7] * v[578] + v[42] * v[572];
+    v[618] = v[5] * v[588] + v[4] * v[592] + v[39] * v[576];
+    v[619] = v[5] * v[589] + v[4] * v[593] - v[40] * v[576];
+    v[620] = v[5] * v[590] + v[4] * v[594] + v[41] * v[576];
+    v[621] = v[5] * v[591] + v[4] * v[595] - v[42] * v[576];
+    v[622] = v[320] * v[586] + v[340] * v[584] - v[339] * v[572] + v[338] * v[576] + v[337] * v[575];
+    v[623] = v[4] * v[588] - v[5] * v[592] + v[39] * v[575];
+    v[624] = -(v[276] * v[586]) - v[344] * v[584] + v[343] * v[572] - v[342] * v[576] - v[341] * v[575];
+    v[625] = v[4] * v[589] - v[5] * v[593] - v[40] * v[575];
+    v[626] = v[353] * v[586] + v[352] * v[584] - v[351] * v[572] + v[350] * v[576] + v[349] * v[575];
+    v[627] = v[4] * v[590] - v[5] * v[594] + v[41] * v[575];
+    v[628] = -(v[293] * v[586]) - v[324] * v[584] + v[323] * v[572] - v[322] * v[576] - v[321] * v[575];
+    v[629] = v[4] * v[591] - v[5] * v[595] - v[42] * v[575];
+    v[630] = (-(v[326] * v[609]) - v[329] * v[613] - v[328] * v[617] - v[327] * v[621] - v[325] * v[629]) / v[328];
+    v[631] = v[599] + (v[331] * v[600] - v[336] * v[609] - v[335] * v[608]) - v[334] * v[599] - v[333] * v[607] - v[332] * v[606] + v[630];
+    v[632] = (-(v[326] * v[608]) - v[329] * v[612] - v[328] * v[616] - v[327] * v[620] - v[325] * v[627]) / v[328];
+    v[633] = v[598] + (v[331] * v[601] - v[336] * v[613] - v[335] * v[612]) - v[334] * v[598] - v[333] * v[611] - v[332] * v[610] + v[632];
+    v[598] = (-(v[326] * v[599]) - v[329] * v[598] - v[328] * v[579] - v[327] * v[597] + v[325] * v[596]) / v[328];
+    v[599] = (-(v[326] * v[607]) - v[329] * v[611] - v[328] * v[615] - v[327] * v[619] - v[325] * v[625]) / v[328];
+    v[597] = v[597] + (v[331] * v[603] - v[336] * v[621] - v[335] * v[620]) - v[334] * v[597] - v[333] * v[619] - v[332] * v[618] + v[599];
+    v[634] = (-(v[326] * v[606]) - v[329] * v[610] - v[328] * v[614] - v[327] * v[618] - v[325] * v[623]) / v[328];
+    v[596] = v[331] * v[604] - v[336] * v[629] - v[335] * v[627] - v[596] + v[334] * v[596] - v[333] * v[625] - v[332] * v[623] + v[634];
+    v[579] = v[579] + (-(v[360] * v[600]) - v[358] * v[601] + v[357] * v[602] - v[331] * v[602] - v[356] * v[603] - v[354] * v[604] - v[336] * v[617] - v[335] * v[616]) - v[334] * v[579] - v[333] * v[615] - v[332] * v[614] - v[336] * v[630] - v[335] * v[632] + v[598] - v[334] * v[598] - v[333] * v[599] - v[332] * v[634];
+    v[598] = -v[572] - v[605];
+    v[599] = v[10] * v[584] + v[11] * v[576];
+    v[600] = v[12] * v[576] - v[9] * v[584];
+    v[601] = v[9] * v[598] + v[10] * v[575];
+    v[602] = v[10] * v[598] - v[9] * v[575];
+    v[603] = 0.2155 * v[575] - v[586];
+    v[604] = v[10] * v[612] + v[11] * v[611];
+    v[630] = v[12] * v[611] - v[9] * v[612];
+    v[632] = v[10] * v[616] + v[11] * v[615];
+    v[634] = v[12] * v[615] - v[9] * v[616];
+    v[635] = v[11] * v[619];
+    v[636] = v[10] * v[620] + v[635];
+    v[637] = v[12] * v[619];
+    v[638] = v[637] - v[9] * v[620];
+    v[639] = v[10] * v[627] + v[11] * v[625];
+    v[640] = v[12] * v[625] - v[9] * v[627];
+    v[641] = v[9] * v[633] + v[10] * v[610];
+    v[642] = v[10] * v[633] - v[9] * v[610];
+    v[613] = 0.2155 * v[610] - v[613];
+    v[643] = v[9] * v[579] + v[10] * v[614];
+    v[644] = v[10] * v[579] - v[9] * v[614];
+    v[617] = 0.2155 * v[614] - v[617];
+    v[645] = v[9] * v[597] + v[10] * v[618];
+    v[646] = v[10] * v[597] - v[9] * v[618];
+    v[621] = 0.2155 * v[618] - v[621];
+    v[647] = v[9] * v[596] + v[10] * v[623];
+    v[648] = v[10] * v[596] - v[9] * v[623];
+    v[629] = 0.2155 * v[623] - v[629];
+    v[649] = v[10] * v[613] + v[11] * v[621];
+    v[650] = v[12] * v[621] - v[9] * v[613];
+    v[651] = v[9] * v[617] + v[10] * v[629];
+    v[652] = v[10] * v[617] - v[9] * v[629];
+    v[609] = v[609] + 0.2155 * (v[629] - v[606]);
+    v[635] = -(v[10] * v[611]) - v[635];
+    v[637] = v[9] * v[611] - v[637];
+    v[653] = -(v[9] * v[615]) - v[10] * v[625];
+    v[654] = v[9] * v[625] - v[10] * v[615];
+    v[655] = v[607] - 0.2155 * v[625];
+    v[656] = v[603] / v[250];
+    v[657] = v[600] / v[250];
+    v[658] = v[599] / v[250];
+    v[659] = v[576] / v[250];
+    v[660] = v[602] / v[250];
+    v[661] = v[601] / v[250];
+    v[662] = v[248] * v[656] + v[247] * v[657] + v[251] * v[658] - v[250] * v[659] + v[249] * v[660] + v[246] * v[661];
+    y[60] = v[662];
+    v[663] = -(v[9] * v[631]) - v[10] * v[606] + 0.2155 * v[647] + v[55] * v[603];
+    v[664] = v[9] * v[606] - v[10] * v[631] + 0.2155 * v[648] - v[56] * v[603];
+    v[665] = -(v[10] * v[608]) - v[11] * v[607] + 0.2155 * v[639] + v[57] * v[603];
+    v[666] = v[9] * v[608] - v[12] * v[607] + 0.2155 * v[640] - v[58] * v[603];
+    v[667] = v[12] * v[645] - v[9] * v[641] + v[55] * v[600];
+    v[668] = v[12] * v[646] - v[9] * v[642] - v[56] * v[600];
+    v[669] = v[12] * v[636] - v[9] * v[604] + v[57] * v[600];
+    v[670] = v[12] * v[638] - v[9] * v[630] - v[58] * v[600];
+    v[671] = v[10] * v[641] + v[11] * v[645] + v[55] * v[599];
+    v[672] = v[10] * v[642] + v[11] * v[646] - v[56] * v[599];
+    v[673] = v[10] * v[604] + v[11] * v[636] + v[57] * v[599];
+    v[674] = v[10] * v[630] + v[11] * v[638] - v[58] * v[599];
+    v[675] = -v[645] - v[55] * v[576];
+    v[676] = v[56] * v[576] - v[646];
+    v[677] = -v[636] - v[57] * v[576];
+    v[678] = v[58] * v[576] - v[638];
+    v[679] = v[10] * v[643] - v[9] * v[647] + v[55] * v[602];
+    v[680] = v[10] * v[644] - v[9] * v[648] - v[56] * v[602];
+    v[681] = v[10] * v[632] - v[9] * v[639] + v[57] * v[602];
+    v[682] = v[10] * v[634] - v[9] * v[640] - v[58] * v[602];
+    v[683] = v[265] * v[603] + v[264] * v[600] + v[263] * v[599] - v[262] * v[576] + v[261] * v[602] + v[260] * v[601];
+    v[684] = v[9] * v[643] + v[10] * v[647] + v[55] * v[601];
+    v[685] = -(v[271] * v[603]) - v[270] * v[600] - v[269] * v[599] + v[268] * v[576] - v[267] * v[602] - v[266] * v[601];
+    v[686] = v[9] * v[644] + v[10] * v[648] - v[56] * v[601];
+    v[687] = v[282] * v[603] + v[281] * v[600] + v[280] * v[599] - v[279] * v[576] + v[278] * v[602] + v[277] * v[601];
+    v[688] = v[9] * v[632] + v[10] * v[639] + v[57] * v[601];
+    v[689] = -(v[288] * v[603]) - v[287] * v[600] - v[286] * v[599] + v[285] * v[576] - v[284] * v[602] - v[283] * v[601];
+    v[690] = v[9] * v[634] + v[10] * v[640] - v[58] * v[601];
+    v[691] = (-(v[248] * v[609]) - v[247] * v[650] - v[251] * v[649] + v[250] * v[621] - v[249] * v[652] - v[246] * v[651]) / v[250];
+    v[692] = v[655] + (v[253] * v[656] - v[259] * v[609] - v[258] * v[666] - v[257] * v[665]) - v[256] * v[655] - v[255] * v[664] - v[254] * v[663] + v[691];
+    v[693] = (-(v[248] * v[666]) - v[247] * v[670] - v[251] * v[674] - v[250] * v[678] - v[249] * v[682] - v[246] * v[690]) / v[250];
+    v[694] = v[637] + (v[253] * v[657] - v[259] * v[650] - v[258] * v[670] - v[257] * v[669]) - v[256] * v[637] - v[255] * v[668] - v[254] * v[667] + v[693];
+    v[695] = (-(v[248] * v[665]) - v[247] * v[669] - v[251] * v[673] - v[250] * v[677] - v[249] * v[681] - v[246] * v[688]) / v[250];
+    v[696] = v[635] + (v[253] * v[658] - v[259] * v[649] - v[258] * v[674] - v[257] * v[673]) - v[256] * v[635] - v[255] * v[672] - v[254] * v[671] + v[695];
+    v[635] = (-(v[248] * v[655]) - v[247] * v[637] - v[251] * v[635] - v[250] * v[619] - v[249] * v[654] - v[246] * v[653]) / v[250];
+    v[637] = (-(v[248] * v[664]) - v[247] * v[668] - v[251] * v[672] - v[250] * v[676] - v[249] * v[680] - v[246] * v[686]) / v[250];
+    v[654] = v[654] + (v[253] * v[660] - v[259] * v[652] - v[258] * v[682] - v[257] * v[681]) - v[256] * v[654] - v[255] * v[680] - v[254] * v[679] + v[637];
+    v[655] = (-(v[248] * v[663]) - v[247] * v[667] - v[251] * v[671] - v[250] * v[675] - v[249] * v[679] - v[246] * v[684]) / v[250];
+    v[653] = v[653] + (v[253] * v[661] - v[259] * v[651] - v[258] * v[690] - v[257] * v[688]) - v[256] * v[653] - v[255] * v[686] - v[254] * v[684] + v[655];
+    v[635] = v[619] + (-(v[302] * v[656]) - v[300] * v[657] - v[298] * v[658] + v[297] * v[659] - v[253] * v[659] - v[296] * v[660] - v[294] * v[661] + v[259] * v[621] - v[258] * v[678] - v[257] * v[677]) - v[256] * v[619] - v[255] * v[676] - v[254] * v[675] - v[259] * v[691] - v[258] * v[693] - v[257] * v[695] + v[635] - v[256] * v[635] - v[255] * v[637] - v[254] * v[655];
+    v[637] = -v[576] - v[662];
+    v[655] = v[13] * v[637] - v[14] * v[601];
+    v[656] = v[14] * v[637] + v[13] * v[601];
+    v[657] = v[13] * v[603] - v[14] * v[599] + v[16] * v[637] + v[15] * v[601];
+    v[658] = v[14] * v[603] + v[13] * v[599] + v[17] * v[637] + v[16] * v[601];
+    v[659] = v[13] * v[692] - v[14] * v[663];
+    v[660] = v[14] * v[692] + v[13] * v[663];
+    v[661] = v[13] * v[609] - v[14] * v[665] + v[16] * v[692] + v[15] * v[663];
+    v[691] = v[14] * v[609] + v[13] * v[665] + v[17] * v[692] + v[16] * v[663];
+    v[693] = v[13] * v[696] - v[14] * v[671];
+    v[695] = v[14] * v[696] + v[13] * v[671];
+    v[697] = v[13] * v[649] - v[14] * v[673] + v[16] * v[696] + v[15] * v[671];
+    v[698] = v[14] * v[649] + v[13] * v[673] + v[17] * v[696] + v[16] * v[671];
+    v[699] = v[13] * v[635] - v[14] * v[675];
+    v[700] = v[14] * v[635] + v[13] * v[675];
+    v[701] = -(v[13] * v[621]) - v[14] * v[677] + v[16] * v[635] + v[15] * v[675];
+    v[702] = v[13] * v[677] - v[14] * v[621] + v[17] * v[635] + v[16] * v[675];
+    v[703] = v[13] * v[653] - v[14] * v[684];
+    v[704] = v[14] * v[653] + v[13] * v[684];
+    v[705] = v[13] * v[651] - v[14] * v[688] + v[16] * v[653] + v[15] * v[684];
+    v[706] = v[14] * v[651] + v[13] * v[688] + v[17] * v[653] + v[16] * v[684];
+    v[707] = v[13] * v[678] - v[14] * v[690];
+    v[708] = v[14] * v[678] + v[13] * v[690];
+    v[709] = v[13] * v[666] - v[14] * v[674] + v[16] * v[678] + v[15] * v[690];
+    v[710] = v[14] * v[666] + v[13] * v[674] + v[17] * v[678] + v[16] * v[690];
+    v[711] = v[13] * v[676] - v[14] * v[686];
+    v[712] = v[14] * v[676] + v[13] * v[686];
+    v[713] = v[13] * v[664] - v[14] * v[672] + v[16] * v[676] + v[15] * v[686];
+    v[714] = v[14] * v[664] + v[13] * v[672] + v[17] * v[676] + v[16] * v[686];
+    v[715] = v[600] / v[187];
+    v[716] = v[658] / v[187];
+    v[717] = v[657] / v[187];
+    v[718] = v[602] / v[187];
+    v[719] = v[656] / v[187];
+    v[720] = v[655] / v[187];
+    v[721] = v[185] * v[715] + v[189] * v[716] + v[188] * v[717] + v[187] * v[718] + v[186] * v[719] + v[184] * v[720];
+    y[61] = v[721];
+    v[722] = v[13] * v[694] - v[14] * v[667] + v[70] * v[600];
+    v[723] = v[14] * v[694] + v[13] * v[667] - v[71] * v[600];
+    v[724] = v[13] * v[650] - v[14] * v[669] + v[16] * v[694] + v[15] * v[667] + v[72] * v[600];
+    v[725] = v[14] * v[650] + v[13] * v[669] + v[17] * v[694] + v[16] * v[667] - v[73] * v[600];
+    v[726] = v[14] * v[659] + v[13] * v[693] + v[17] * v[699] + v[16] * v[703] + v[70] * v[658];
+    v[727] = v[14] * v[660] + v[13] * v[695] + v[17] * v[700] + v[16] * v[704] - v[71] * v[658];
+    v[728] = v[14] * v[661] + v[13] * v[697] + v[17] * v[701] + v[16] * v[705] + v[72] * v[658];
+    v[729] = v[14] * v[691] + v[13] * v[698] + v[17] * v[702] + v[16] * v[706] - v[73] * v[658];
+    v[730] = v[13] * v[659] - v[14] * v[693] + v[16] * v[699] + v[15] * v[703] + v[70] * v[657];
+    v[731] = v[13] * v[660] - v[14] * v[695] + v[16] * v[700] + v[15] * v[704] - v[71] * v[657];
+    v[732] = v[13] * v[661] - v[14] * v[697] + v[16] * v[701] + v[15] * v[705] + v[72] * v[657];
+    v[733] = v[13] * v[691] - v[14] * v[698] + v[16] * v[702] + v[15] * v[706] - v[73] * v[657];
+    v[734] = v[13] * v[654] - v[14] * v[679] + v[70] * v[602];
+    v[735] = v[14] * v[654] + v[13] * v[679] - v[71] * v[602];
+    v[736] = v[13] * v[652] - v[14] * v[681] + v[16] * v[654] + v[15] * v[679] + v[72] * v[602];
+    v[737] = v[14] * v[652] + v[13] * v[681] + v[17] * v[654] + v[16] * v[679] - v[73] * v[602];
+    v[738] = v[14] * v[699] + v[13] * v[703] + v[70] * v[656];
+    v[739] = v[14] * v[700] + v[13] * v[704] - v[71] * v[656];
+    v[740] = v[14] * v[701] + v[13] * v[705] + v[72] * v[656];
+    v[741] = v[14] * v[702] + v[13] * v[706] - v[73] * v[656];
+    v[742] = v[202] * v[600] + v[178] * v[658] + v[201] * v[657] + v[200] * v[602] + v[199] * v[656] + v[198] * v[655];
+    v[743] = v[13] * v[699] - v[14] * v[703] + v[70] * v[655];
+    v[744] = -(v[207] * v[600]) - v[146] * v[658] - v[206] * v[657] - v[205] * v[602] - v[204] * v[656] - v[203] * v[655];
+    v[745] = v[13] * v[700] - v[14] * v[704] - v[71] * v[655];
+    v[746] = v[217] * v[600] + v[216] * v[658] + v[215] * v[657] + v[214] * v[602] + v[213] * v[656] + v[212] * v[655];
+    v[747] = v[13] * v[701] - v[14] * v[705] + v[72] * v[655];
+    v[748] = -(v[183] * v[600]) - v[132] * v[658] - v[182] * v[657] - v[181] * v[602] - v[180] * v[656] - v[179] * v[655];
+    v[749] = v[13] * v[702] - v[14] * v[706] - v[73] * v[655];
+    v[750] = (-(v[185] * v[670]) - v[189] * v[710] - v[188] * v[709] - v[187] * v[682] - v[186] * v[708] - v[184] * v[707]) / v[187];
+    v[751] = v[668] + (v[191] * v[715] - v[197] * v[670] - v[196] * v[725] - v[195] * v[724]) - v[194] * v[668] - v[193] * v[723] - v[192] * v[722] + v[750];
+    v[752] = (-(v[185] * v[725]) - v[189] * v[729] - v[188] * v[733] - v[187] * v[737] - v[186] * v[741] - v[184] * v[749]) / v[187];
+    v[753] = v[714] + (v[191] * v[716] - v[197] * v[710] - v[196] * v[729] - v[195] * v[728]) - v[194] * v[714] - v[193] * v[727] - v[192] * v[726] + v[752];
+    v[754] = (-(v[185] * v[724]) - v[189] * v[728] - v[188] * v[732] - v[187] * v[736] - v[186] * v[740] - v[184] * v[747]) / v[187];
+    v[755] = v[713] + (v[191] * v[717] - v[197] * v[709] - v[196] * v[733] - v[195] * v[732]) - v[194] * v[713] - v[193] * v[731] - v[192] * v[730] + v[754];
+    v[668] = (-(v[185] * v[668]) - v[189] * v[714] - v[188] * v[713] - v[187] * v[680] - v[186] * v[712] - v[184] * v[711]) / v[187];
+    v[713] = (-(v[185] * v[723]) - v[189] * v[727] - v[188] * v[731] - v[187] * v[735] - v[186] * v[739] - v[184] * v[745]) / v[187];
+    v[712] = v[712] + (v[191] * v[719] - v[197] * v[708] - v[196] * v[741] - v[195] * v[740]) - v[194] * v[712] - v[193] * v[739] - v[192] * v[738] + v[713];
+    v[714] = (-(v[185] * v[722]) - v[189] * v[726] - v[188] * v[730] - v[187] * v[734] - v[186] * v[738] - v[184] * v[743]) / v[187];
+    v[711] = v[711] + (v[191] * v[720] - v[197] * v[707] - v[196] * v[749] - v[195] * v[747]) - v[194] * v[711] - v[193] * v[745] - v[192] * v[743] + v[714];
+    v[668] = v[680] + (-(v[229] * v[715]) - v[228] * v[716] - v[226] * v[717] - v[225] * v[718] + v[191] * v[718] - v[224] * v[719] - v[222] * v[720] - v[197] * v[682] - v[196] * v[737] - v[195] * v[736]) - v[194] * v[680] - v[193] * v[735] - v[192] * v[734] - v[197] * v[750] - v[196] * v[752] - v[195] * v[754] + v[668] - v[194] * v[668] - v[193] * v[713] - v[192] * v[714];
+    v[680] = v[602] - v[721];
+    v[713] = v[18] * v[600] + v[19] * v[657] + v[20] * v[656];
+    v[714] = v[19] * v[600] - v[18] * v[657] + v[21] * v[656];
+    v[715] = v[18] * v[680] + v[19] * v[655];
+    v[716] = v[19] * v[680] - v[18] * v[655];
+    v[717] = 0.2155 * v[655] - v[658];
+    v[718] = v[18] * v[670] + v[19] * v[724] + v[20] * v[723];
+    v[719] = v[18] * v[709] + v[19] * v[732] + v[20] * v[731];
+    v[720] = v[18] * v[682] + v[19] * v[736] + v[20] * v[735];
+    v[750] = v[20] * v[739];
+    v[752] = v[18] * v[708] + v[19] * v[740] + v[750];
+    v[754] = v[18] * v[707] + v[19] * v[747] + v[20] * v[745];
+    v[756] = v[18] * v[751] + v[19] * v[722];
+    v[725] = 0.2155 * v[722] - v[725];
+    v[757] = v[18] * v[755] + v[19] * v[730];
+    v[733] = 0.2155 * v[730] - v[733];
+    v[758] = v[18] * v[668] + v[19] * v[734];
+    v[737] = 0.2155 * v[734] - v[737];
+    v[759] = v[18] * v[712] + v[19] * v[738];
+    v[741] = 0.2155 * v[738] - v[741];
+    v[760] = v[18] * v[711] + v[19] * v[743];
+    v[749] = 0.2155 * v[743] - v[749];
+    v[761] = v[18] * v[725] + v[19] * v[733] + v[20] * v[741];
+    v[762] = v[18] * v[737] + v[19] * v[749];
+    v[729] = v[729] + 0.2155 * (v[749] - v[726]);
+    v[750] = -(v[18] * v[723]) - v[19] * v[731] - v[750];
+    v[763] = -(v[18] * v[735]) - v[19] * v[745];
+    v[764] = v[727] - 0.2155 * v[745];
+    v[765] = v[717] / v[133];
+    v[766] = v[713] / v[133];
+    v[767] = v[656] / v[133];
+    v[768] = v[715] / v[133];
+    v[769] = v[130] * v[765] + v[134] * v[766] - v[133] * v[767] + v[129] * v[768];
+    y[62] = v[769];
+    v[770] = -(v[18] * v[753]) - v[19] * v[726] + 0.2155 * v[760] + v[86] * v[717];
+    v[771] = -(v[18] * v[710]) - v[19] * v[728] - v[20] * v[727] + 0.2155 * v[754] + v[88] * v[717];
+    v[772] = v[18] * v[756] + v[19] * v[757] + v[20] * v[759] + v[86] * v[713];
+    v[773] = v[18] * v[718] + v[19] * v[719] + v[20] * v[752] + v[88] * v[713];
+    v[774] = -v[759] - v[86] * v[656];
+    v[775] = -v[752] - v[88] * v[656];
+    v[776] = -(0.00072 * v[713]) - 0.0036 * v[716];
+    v[777] = v[128] * v[717] + -0.00072 * v[714] + v[127] * v[713] - v[143] * v[656] + v[142] * v[715];
+    v[778] = v[18] * v[758] + v[19] * v[760] + v[86] * v[715];
+    v[779] = v[150] * v[717] + v[149] * v[713] - v[148] * v[656] + 0.00072 * v[716] + v[147] * v[715];
+    v[780] = v[18] * v[720] + v[19] * v[754] + v[88] * v[715];
+    v[781] = -(2.1 * v[714]) - -0.00072 * v[715];
+    v[782] = v[729] + v[773];
+    v[783] = (-(v[130] * v[729]) - v[134] * v[761] + v[133] * v[741] - v[129] * v[762]) / v[133];
+    v[729] = v[764] + (v[137] * v[765] - v[141] * v[729] - v[140] * v[771]) - v[139] * v[764] - v[138] * v[770] + v[783];
+    v[784] = (-(v[130] * v[771]) - v[134] * v[773] - v[133] * v[775] - v[129] * v[780]) / v[133];
+    v[773] = v[750] + (v[137] * v[766] - v[141] * v[761] - v[140] * v[773]) - v[139] * v[750] - v[138] * v[772] + v[784];
+    v[750] = (-(v[130] * v[764]) - v[134] * v[750] - v[133] * v[739] - v[129] * v[763]) / v[133];
+    v[764] = (-(v[130] * v[770]) - v[134] * v[772] - v[133] * v[774] - v[129] * v[778]) / v[133];
+    v[763] = v[763] + (v[137] * v[768] - v[141] * v[762] - v[140] * v[780]) - v[139] * v[763] - v[138] * v[778] + v[764];
+    v[750] = v[739] + (-(v[156] * v[765]) - v[154] * v[766] + v[153] * v[767] - v[137] * v[767] - v[135] * v[768] + v[141] * v[741] - v[140] * v[775]) - v[139] * v[739] - v[138] * v[774] - v[141] * v[783] - v[140] * v[784] + v[750] - v[139] * v[750] - v[138] * v[764];
+    v[764] = -v[656] - v[769];
+    v[765] = v[22] * v[764] - v[23] * v[715];
+    v[766] = v[23] * v[764] + v[22] * v[715];
+    v[767] = v[22] * v[717] - v[23] * v[713] + v[25] * v[764] + v[24] * v[715];
+    v[768] = v[23] * v[717] + v[22] * v[713] + v[26] * v[764] + v[25] * v[715];
+    v[783] = v[771] - v[761];
+    v[761] = v[761] - v[771];
+    v[771] = v[770] - v[773];
+    v[784] = v[772] + v[729];
+    v[785] = v[22] * v[750] - v[23] * v[774];
+    v[786] = v[23] * v[750] + v[22] * v[774];
+    v[787] = -(v[22] * v[741]) - v[23] * v[775] + v[25] * v[750] + v[24] * v[774];
+    v[788] = v[22] * v[775] - v[23] * v[741] + v[26] * v[750] + v[25] * v[774];
+    v[789] = v[22] * v[763] - v[23] * v[778];
+    v[790] = v[23] * v[763] + v[22] * v[778];
+    v[791] = v[22] * v[762] - v[23] * v[780] + v[25] * v[763] + v[24] * v[778];
+    v[792] = v[23] * v[762] + v[22] * v[780] + v[26] * v[763] + v[25] * v[778];
+    v[793] = 0.001 * (v[716] / 0.001);
+    y[63] = v[793];
+    v[794] = -(0.006 * v[767]) - 0.001 * v[766];
+    v[795] = 0.3 * v[767] + 0.006 * v[766];
+    v[796] = -0.006 * v[768] + 0.001 * v[765];
+    v[797] = -(0.3 * v[768]) - -0.006 * v[765];
+    v[798] = v[716] - v[793];
+    v[799] = v[96] * v[798] - v[100] * v[765];
+    v[800] = v[100] * v[766] - v[97] * v[798];
+    v[801] = v[96] * v[714] - v[100] * v[767] - v[83] * v[765] + v[98] * v[798];
+    v[802] = v[100] * v[768] - v[97] * v[714] + v[83] * v[766] - v[99] * v[798];
+    v[803] = v[108] * v[768] - v[109] * v[767] - v[106] * v[765] + v[105] * v[766] + 0.001 * (v[97] * v[765] - v[96] * v[766]);
+    v[804] = v[109] * v[798] - v[110] * v[766] + 0.3 * v[802] + 0.006 * v[799] + x[13] * v[797];
+    v[805] = v[110] * v[765] - v[108] * v[798] + 0.3 * v[801] + -0.006 * v[800] + x[13] * v[795];
+    v[800] = v[109] * v[714] - v[110] * v[768] - v[107] * v[766] + v[106] * v[798] + -0.006 * v[801] + 0.001 * v[800] + x[13] * v[794];
+    v[798] = v[110] * v[767] - v[108] * v[714] + v[107] * v[765] - v[105] * v[798] + 0.006 * v[802] + 0.001 * v[799] + x[13] * v[796];
+    v[799] = v[81] * v[715] - v[80] * v[716];
+    v[801] = v[80] * v[764] - v[85] * v[715];
+    v[802] = v[85] * v[716] - v[81] * v[764];
+    v[806] = v[81] * v[713] - v[80] * v[714] + v[83] * v[715] - v[82] * v[716];
+    v[807] = v[80] * v[717] - v[85] * v[713] - v[84] * v[715] + v[82] * v[764];
+    v[808] = v[85] * v[714] - v[81] * v[717] + v[84] * v[716] - v[83] * v[764];
+    v[809] = v[26] * v[805] + v[25] * v[804] + v[23] * v[798] + v[22] * v[800] - v[94] * v[713] + v[93] * v[714] - v[91] * v[715] + v[90] * v[716] + -0.00108 * v[808] + 0.0047 * v[799];
+    v[810] = v[23] * v[805] + v[22] * v[804] - v[94] * v[715] + v[93] * v[716] + 1.8 * v[806] + 0.00108 * v[802];
+    v[799] = v[22] * v[805] - v[23] * v[804] - v[95] * v[716] + v[94] * v[764] + 1.8 * v[808] + -0.00108 * v[799] + 0.00072 * v[801] + x[12] * v[781];
+    v[765] = v[108] * v[766] - v[109] * v[765] + 0.3 * (v[97] * v[767] - v[96] * v[768] + v[99] * v[765] - v[98] * v[766]) + v[95] * v[715] - v[93] * v[764] + 1.8 * v[807] + -0.00072 * v[802] + x[12] * v[779];
+    v[714] = v[25] * v[805] + v[24] * v[804] + v[22] * v[798] - v[23] * v[800] - v[95] * v[714] + v[94] * v[717] - v[92] * v[716] + v[91] * v[764] + 0.00108 * v[806] + -0.00072 * v[807] + 0.0005 * v[802] + x[12] * v[776];
+    v[716] = v[803] + v[95] * v[713] - v[93] * v[717] + v[92] * v[715] - v[90] * v[764] + 0.00072 * v[808] + 0.0036 * v[801] + x[12] * v[777];
+    v[766] = v[66] * v[655] - v[65] * v[656];
+    v[767] = v[65] * v[680] - v[69] * v[655];
+    v[768] = v[69] * v[656] - v[66] * v[680];
+    v[801] = v[66] * v[657] - v[65] * v[658] + v[68] * v[655] - v[67] * v[656];
+    v[802] = v[65] * v[600] - v[69] * v[657] - v[52] * v[655] + v[67] * v[680];
+    v[806] = v[69] * v[658] - v[66] * v[600] + v[52] * v[656] - v[68] * v[680];
+    v[807] = v[19] * v[716] + v[18] * v[714] - v[78] * v[657] + v[77] * v[658] - v[75] * v[655] + v[74] * v[656] + 0.00017 * v[802] + -0.0357 * v[806] + 0.0058 * v[766] + -0.0027 * v[767];
+    v[808] = v[19] * v[799] - v[18] * v[765] - v[79] * v[656] + v[78] * v[680] + 1.7 * v[806] + -0.0357 * v[766] + 0.1292 * v[767] + x[11] * v[748];
+    v[811] = v[79] * v[655] - v[810] - v[77] * v[680] + 1.7 * v[802] + 0.00017 * v[766] + -0.1292 * v[768] + x[11] * v[746];
+    v[658] = 0.2155 * v[810] - v[18] * v[716] + v[19] * v[714] - v[79] * v[658] + v[78] * v[600] - v[76] * v[656] + v[75] * v[680] + 0.0357 * v[801] + -0.1292 * v[802] + 0.0306 * v[768] + x[11] * v[744];
+    v[766] = v[21] * v[765] - v[809] + v[20] * v[799] + v[79] * v[657] - v[77] * v[600] + v[76] * v[655] - v[74] * v[680] + -0.00017 * v[801] + 0.1292 * v[806] + -0.0027 * v[766] + 0.0279 * v[767] + x[11] * v[742];
+    v[802] = v[50] * v[601] - v[49] * v[602];
+    v[806] = v[49] * v[637] - v[54] * v[601];
+    v[810] = v[54] * v[602] - v[50] * v[637];
+    v[812] = v[50] * v[599] - v[49] * v[600] + v[52] * v[601] - v[51] * v[602];
+    v[813] = v[49] * v[603] - v[54] * v[599] - v[53] * v[601] + v[51] * v[637];
+    v[814] = v[54] * v[600] - v[50] * v[603] + v[53] * v[602] - v[52] * v[637];
+    v[815] = v[17] * v[811] + v[16] * v[808] + v[14] * v[766] + v[13] * v[658] - v[63] * v[599] + v[62] * v[600] - v[60] * v[601] + v[59] * v[602] + -0.1809 * v[814] + 0.0411 * v[802] + -0.0061 * v[806];
+    v[816] = v[14] * v[811] + v[13] * v[808] - v[63] * v[601] + v[62] * v[602] + 2.7 * v[812] + 0.1809 * v[810];
+    v[817] = v[13] * v[811] - v[14] * v[808] - v[64] * v[602] + v[63] * v[637] + 2.7 * v[814] + -0.1809 * v[802] + 0.0918 * v[806] + x[10] * v[689];
+    v[767] = v[19] * v[765] + v[18] * v[799] - v[78] * v[655] + v[77] * v[656] + 1.7 * v[801] + -0.00017 * v[767] + 0.0357 * v[768] + v[64] * v[601] - v[62] * v[637] + 2.7 * v[813] + -0.0918 * v[810] + x[10] * v[687];
+    v[602] = v[16] * v[811] + v[15] * v[808] + v[13] * v[766] - v[14] * v[658] - v[64] * v[600] + v[63] * v[603] - v[61] * v[602] + v[60] * v[637] + 0.1809 * v[812] + -0.0918 * v[813] + 0.0452 * v[810] + x[10] * v[685];
+    v[768] = v[807] + v[64] * v[599] - v[62] * v[603] + v[61] * v[601] - v[59] * v[637] + 0.0918 * v[814] + -0.0061 * v[802] + 0.0131 * v[806] + x[10] * v[683];
+    v[801] = v[35] * v[575] - v[34] * v[576];
+    v[802] = v[34] * v[598] - v[38] * v[575];
+    v[806] = v[38] * v[576] - v[35] * v[598];
+    v[810] = v[36] * v[598] - v[38] * v[584];
+    v[812] = v[38] * v[586] - v[37] * v[598];
+    v[813] = v[10] * v[768] + v[9] * v[602] - v[47] * v[584] + v[46] * v[586] - v[44] * v[575] + v[43] * v[576] + -0.09 * v[812] + 0.0127 * v[801] + -0.0117 * v[802];
+    v[814] = v[10] * v[817] - v[9] * v[767] - v[48] * v[576] + v[47] * v[598] + 3. * v[812] + -0.09 * v[801] + 0.39 * v[802] + x[9] * v[628];
+    v[818] = v[48] * v[575] - v[816] - v[46] * v[598] + 3. * v[810] + -0.39 * v[806] + x[9] * v[626];
+    v[586] = 0.2155 * v[816] - v[9] * v[768] + v[10] * v[602] - v[48] * v[586] - v[45] * v[576] + v[44] * v[598] + 0.09 * (v[35] * v[584] - v[34] * v[586] + v[37] * v[575] - v[36] * v[576]) + -0.39 * v[810] + 0.1334 * v[806] + x[9] * v[624];
+    v[801] = v[12] * v[767] - v[815] + v[11] * v[817] + v[48] * v[584] + v[45] * v[575] - v[43] * v[598] + 0.39 * v[812] + -0.0117 * v[801] + 0.1257 * v[802] + x[9] * v[622];
+    v[802] = v[7] * v[818] + v[6] * v[814] + v[4] * v[801] - v[5] * v[586] + v[33] * v[572] - v[32] * v[577] + 0.071 * (v[28] * v[577] - x[8] * v[572]) + x[8] * v[582];
+    v[806] = v[813] - v[33] * v[571] + v[31] * v[577] + 0.025 * (x[8] * v[571] - v[27] * v[577]) + x[8] * v[580];
+    y[49] = v[23] * (v[102] * v[717] + v[101] * v[713] + v[113] * v[764] + v[114] * v[715] - v[123] * v[741] + v[121] * v[762] + v[124] * v[783] + v[125] * v[782] + v[126] * v[775] + v[122] * v[780] + v[118] * v[729] + v[117] * v[773] + v[116] * v[750] + v[104] * v[763] + v[120] * v[770] - v[119] * v[772] + v[103] * v[774] + v[115] * v[778] + 0.3 * (v[23] * v[761] + v[22] * v[782] + v[26] * v[773] + v[24] * v[770] + v[25] * v[784]) + 0.006 * (v[23] * v[729] + v[22] * v[770] + v[791]) + -0.006 * (v[22] * v[773] - v[23] * v[772] + v[788]) + 0.001 * (v[785] + v[790]) + v[82] * v[805] + v[84] * v[804] + v[80] * v[798] + v[85] * v[800] + -0.081 * (v[101] * v[764] + v[124] * v[729] + v[125] * v[773] + v[126] * v[750] + v[122] * v[763] + 0.3 * v[788] + -0.006 * v[785] + v[85] * v[805]) + 0.081 * (v[102] * v[715] + v[125] * v[770] - v[124] * v[772] + v[123] * v[774] + v[121] * v[778] + 0.3 * v[791] + 0.006 * v[790] + v[80] * v[804])) - v[22] * (v[101] * v[717] - v[102] * v[713] + v[114] * v[764] - v[113] * v[715] - v[126] * v[741] + v[122] * v[762] + v[125] * v[761] + v[124] * v[782] - v[123] * v[775] - v[121] * v[780] + v[120] * v[729] - v[119] * v[773] + v[103] * v[750] + v[115] * v[763] - v[118] * v[770] - v[117] * v[772] - v[116] * v[774] - v[104] * v[778] + 0.3 * (v[22] * v[783] + v[23] * v[782] + v[26] * v[729] + v[25] * v[771] - v[24] * v[772]) + 0.006 * (-(v[23] * v[773]) - v[22] * v[772] + v[787]) + -0.006 * (v[22] * v[729] - v[23] * v[770] - v[792]) + 0.001 * (v[786] - v[789]) + v[84] * v[805] - v[82] * v[804] + v[85] * v[798] - v[80] * v[800] + 0.081 * (v[102] * v[764] + v[101] * v[715] + v[123] * v[750] + v[121] * v[763] + v[124] * v[771] + v[125] * v[784] + v[126] * v[774] + v[122] * v[778] + 0.3 * (v[787] + v[792]) + 0.006 * v[786] + -0.006 * v[789] + v[80] * v[805] + v[85] * v[804]));
+    y[48] = v[19] * (v[155] * v[600] - v[89] * v[657] + v[152] * v[680] - v[111] * v[655] + v[174] * v[670] - v[150] * v[710] + v[173] * v[709] + v[172] * v[682] + v[171] * v[708] + v[170] * v[707] - v[177] * v[724] + v[176] * v[732] - v[161] * v[736] - v[175] * v[740] - v[163] * v[747] + v[164] * v[751] - v[128] * v[753] + v[162] * v[755] + v[160] * v[668] + v[159] * v[712] + v[158] * v[711] - v[169] * v[722] - v[168] * v[730] - v[167] * v[734] - v[166] * v[738] + v[165] * v[743] + v[131] * v[725] + v[151] * v[737] + 2.1 * (v[18] * v[732] - v[19] * v[709] - v[21] * v[731]) + v[149] * v[718] + v[147] * v[720] - v[145] * v[723] - v[144] * v[735] + 0.00072 * (v[19] * v[751] - v[18] * v[722] - v[754]) + 0.0036 * (v[18] * v[743] - v[19] * v[711]) + v[127] * v[756] + -0.00072 * (v[19] * v[682] - v[18] * v[736] + v[21] * v[735] - v[757]) + v[142] * v[758] - v[67] * v[765] + v[52] * v[799] - v[65] * v[716] + v[69] * v[714] + -0.2155 * (v[89] * v[656] + v[177] * v[723] - v[176] * v[731] + v[161] * v[735] + v[175] * v[739] + v[163] * v[745] + 2.1 * (v[19] * v[708] - v[18] * v[740] + v[21] * v[739]) + -0.00072 * v[759] + v[66] * v[765])) - v[18] * (v[89] * v[600] + v[155] * v[657] + v[111] * v[680] + v[152] * v[655] + v[177] * v[670] - v[176] * v[709] + v[161] * v[682] + v[175] * v[708] + v[163] * v[707] + v[174] * v[724] - v[150] * v[728] + v[173] * v[732] + v[172] * v[736] + v[171] * v[740] + v[170] * v[747] + v[169] * v[751] + v[168] * v[755] + v[167] * v[668] + v[166] * v[712] - v[165] * v[711] + v[164] * v[722] - v[128] * v[726] + v[162] * v[730] + v[160] * v[734] + v[159] * v[738] + v[158] * v[743] + v[131] * v[733] + v[151] * v[749] + 2.1 * (v[19] * v[670] - v[18] * v[724] + v[21] * v[723]) + v[149] * v[719] + v[147] * v[754] - v[145] * v[731] - v[144] * v[745] + 0.00072 * (v[720] + (v[19] * v[755] - v[18] * v[730])) + 0.0036 * (v[19] * v[668] - v[18] * v[734]) + -0.00072 * (v[19] * v[707] - v[18] * v[747] + v[21] * v[745] + v[756]) + v[127] * v[757] + v[142] * v[760] + v[52] * v[765] + v[67] * v[799] + v[69] * v[716] + v[65] * v[714] + 0.2155 * (v[155] * v[656] + v[174] * v[723] - v[150] * v[727] + v[173] * v[731] + v[172] * v[735] + v[171] * v[739] + v[170] * v[745] + v[131] * v[741] + v[149] * v[752] - v[145] * v[739] + 0.00072 * (v[19] * v[712] - v[18] * v[738]) + v[127] * v[759] + v[66] * v[799]));
+    y[47] = v[14] * (v[227] * v[603] + v[157] * v[599] + v[223] * v[637] + v[136] * v[601] + v[241] * v[609] + v[217] * v[650] + v[240] * v[649] - v[239] * v[621] + v[214] * v[652] + v[238] * v[651] + v[245] * v[665] + v[183] * v[669] + v[244] * v[673] + v[243] * v[677] + v[181] * v[681] + v[242] * v[688] + v[233] * v[692] + v[202] * v[694] + v[232] * v[696] + v[231] * v[635] + v[200] * v[654] + v[230] * v[653] + v[237] * v[663] + v[207] * v[667] + v[236] * v[671] + v[235] * v[675] + v[205] * v[679] + v[234] * v[684] + v[220] * v[666] + v[221] * v[674] + v[218] * v[678] + v[219] * v[690] + v[182] * v[691] + v[132] * v[698] + v[179] * v[702] + v[180] * v[706] + v[215] * v[661] + v[216] * v[697] + v[212] * v[701] + v[213] * v[705] + v[210] * v[664] + v[211] * v[672] + v[208] * v[676] + v[209] * v[686] + v[206] * v[660] + v[146] * v[695] + v[203] * v[700] + v[204] * v[704] + v[201] * v[659] + v[178] * v[693] + v[198] * v[699] + v[199] * v[703] + v[51] * v[811] + v[53] * v[808] + v[49] * v[766] + v[54] * v[658] + -0.1845 * (v[157] * v[637] + v[245] * v[692] + v[183] * v[694] + v[244] * v[696] + v[243] * v[635] + v[181] * v[654] + v[242] * v[653] + v[221] * v[678] + v[132] * v[702] + v[216] * v[701] + v[211] * v[676] + v[146] * v[700] + v[178] * v[699] + v[54] * v[811]) + 0.1845 * (v[227] * v[601] + v[241] * v[663] + v[217] * v[667] + v[240] * v[671] + v[239] * v[675] + v[214] * v[679] + v[238] * v[684] + v[220] * v[690] + v[182] * v[706] + v[215] * v[705] + v[210] * v[686] + v[206] * v[704] + v[201] * v[703] + v[49] * v[808])) - v[13] * (v[157] * v[603] - v[227] * v[599] + v[136] * v[637] - v[223] * v[601] + v[245] * v[609] + v[183] * v[650] + v[244] * v[649] - v[243] * v[621] + v[181] * v[652] + v[242] * v[651] - v[241] * v[665] - v[217] * v[669] - v[240] * v[673] - v[239] * v[677] - v[214] * v[681] - v[238] * v[688] + v[237] * v[692] + v[207] * v[694] + v[236] * v[696] + v[235] * v[635] + v[205] * v[654] + v[234] * v[653] - v[233] * v[663] - v[202] * v[667] - v[232] * v[671] - v[231] * v[675] - v[200] * v[679] - v[230] * v[684] + v[221] * v[666] - v[220] * v[674] + v[219] * v[678] - v[218] * v[690] + v[132] * v[691] - v[182] * v[698] + v[180] * v[702] - v[179] * v[706] + v[216] * v[661] - v[215] * v[697] + v[213] * v[701] - v[212] * v[705] + v[211] * v[664] - v[210] * v[672] + v[209] * v[676] - v[208] * v[686] + v[146] * v[660] - v[206] * v[695] + v[204] * v[700] - v[203] * v[704] + v[178] * v[659] - v[201] * v[693] + v[199] * v[699] - v[198] * v[703] + v[53] * v[811] - v[51] * v[808] + v[54] * v[766] - v[49] * v[658] + 0.1845 * (v[227] * v[637] + v[157] * v[601] + v[241] * v[692] + v[217] * v[694] + v[240] * v[696] + v[239] * v[635] + v[214] * v[654] + v[238] * v[653] + v[245] * v[663] + v[183] * v[667] + v[244] * v[671] + v[243] * v[675] + v[181] * v[679] + v[242] * v[684] + v[220] * v[678] + v[221] * v[690] + v[182] * v[702] + v[132] * v[706] + v[215] * v[701] + v[216] * v[705] + v[210] * v[676] + v[211] * v[686] + v[206] * v[700] + v[146] * v[704] + v[201] * v[699] + v[178] * v[703] + v[49] * v[811] + v[54] * v[808]));
+    y[46] = v[10] * (v[295] * v[598] - v[301] * v[584] - v[190] * v[575] + v[288] * v[608] - v[319] * v[612] - v[318] * v[616] - v[317] * v[620] - v[316] * v[627] - v[265] * v[631] + v[307] * v[633] + v[306] * v[579] + v[305] * v[597] + v[304] * v[596] + v[271] * v[606] - v[311] * v[610] - v[310] * v[614] - v[309] * v[618] - v[308] * v[623] - v[292] * v[613] + v[289] * v[617] - v[290] * v[629] - v[287] * v[630] + v[283] * v[634] - v[284] * v[640] - v[281] * v[604] + v[277] * v[632] - v[278] * v[639] + v[275] * v[611] - v[272] * v[615] + v[273] * v[625] - v[270] * v[642] + v[266] * v[644] - v[267] * v[648] - v[264] * v[641] + v[260] * v[643] - v[261] * v[647] - v[36] * v[767] - v[34] * v[768] + v[38] * v[602] + -0.2155 * (v[301] * v[576] - v[288] * v[607] + v[319] * v[611] + v[318] * v[615] + v[317] * v[619] + v[316] * v[625] + v[292] * v[621] + v[287] * v[638] + v[281] * v[636] - v[275] * v[619] + v[270] * v[646] + v[264] * v[645] + v[35] * v[767])) - v[9] * (v[299] * v[584] + v[190] * v[598] + v[295] * v[575] - v[282] * v[608] + v[315] * v[612] + v[314] * v[616] + v[313] * v[620] + v[312] * v[627] - v[271] * v[631] + v[311] * v[633] + v[310] * v[579] + v[309] * v[597] + v[308] * v[596] - v[265] * v[606] + v[307] * v[610] + v[306] * v[614] + v[305] * v[618] + v[304] * v[623] + v[291] * v[613] + v[290] * v[617] + v[289] * v[629] + v[286] * v[630] + v[284] * v[634] + v[283] * v[640] + v[280] * v[604] + v[278] * v[632] + v[277] * v[639] - v[274] * v[611] - v[273] * v[615] - v[272] * v[625] + v[269] * v[642] + v[267] * v[644] + v[266] * v[648] + v[263] * v[641] + v[261] * v[643] + v[260] * v[647] + v[36] * v[817] + v[38] * v[768] + v[34] * v[602] + 0.2155 * (v[299] * v[576] - v[282] * v[607] + v[315] * v[611] + v[314] * v[615] + v[313] * v[619] + v[312] * v[625] + v[291] * v[621] + v[286] * v[638] + v[280] * v[636] - v[274] * v[619] + v[269] * v[646] + v[263] * v[645] + v[35] * v[817]));
+    y[45] = v[5] * (-(v[355] * v[577]) - v[252] * v[571] + v[362] * v[566] + v[339] * v[585] + v[361] * v[587] + v[343] * v[578] + v[363] * v[581] + v[321] * v[591] + v[322] * v[595] + v[349] * v[590] + v[350] * v[594] + v[346] * v[583] + v[341] * v[589] + v[342] * v[593] + v[337] * v[588] + v[338] * v[592] + v[27] * v[801] + x[8] * v[586] + -0.2045 * (v[368] * v[566] - v[303] * v[577] + v[323] * v[585] + v[367] * v[587] + v[293] * v[591] + v[353] * v[590] + v[276] * v[589] + v[320] * v[588] + x[8] * v[818]) + 0.2045 * (v[351] * v[578] - v[359] * v[571] + v[365] * v[581] + v[324] * v[595] + v[352] * v[594] + v[347] * v[583] + v[344] * v[593] + v[340] * v[592] + v[27] * v[814])) - v[4] * (v[355] * v[571] - v[252] * v[577] + v[364] * v[566] + v[343] * v[585] + v[363] * v[587] - v[339] * v[578] - v[361] * v[581] + v[322] * v[591] - v[321] * v[595] + v[350] * v[590] - v[349] * v[594] - v[345] * v[583] + v[342] * v[589] - v[341] * v[593] + v[338] * v[588] - v[337] * v[592] + x[8] * v[801] - v[27] * v[586] + 0.2045 * (-(v[359] * v[577]) - v[303] * v[571] + v[366] * v[566] + v[351] * v[585] + v[365] * v[587] + v[323] * v[578] + v[367] * v[581] + v[324] * v[591] + v[293] * v[595] + v[352] * v[590] + v[353] * v[594] + v[348] * v[583] + v[344] * v[589] + v[276] * v[593] + v[340] * v[588] + v[320] * v[592] + v[27] * v[818] + x[8] * v[814]));
+    y[44] = v[3] * (-(v[385] * v[567]) - v[380] * v[569] - v[382] * v[570] - v[377] * v[574] - v[375] * v[573] + x[7] * v[802]) - v[2] * (-(v[385] * v[568]) - v[330] * v[569] - v[383] * v[570] - v[378] * v[574] - v[376] * v[573] + x[7] * v[806]);
+    y[56] = v[803] + (v[98] * v[797] + v[99] * v[795] + v[96] * v[794] + v[97] * v[796]) + -0.2 * v[793];
+    y[55] = v[809] + (v[82] * v[781] + v[83] * v[779] + v[80] * v[776] + v[81] * v[777]) + -0.5 * v[769];
+    y[54] = v[807] + (v[67] * v[748] + v[68] * v[746] + v[65] * v[744] + v[66] * v[742]) - v[721];
+    y[53] = v[815] + (v[51] * v[689] + v[52] * v[687] + v[49] * v[685] + v[50] * v[683]) + -0.3 * v[662];
+    y[52] = v[813] + (v[36] * v[628] + v[37] * v[626] + v[34] * v[624] + v[35] * v[622]) + -0.5 * v[605];
+    y[51] = v[8] * v[818] + v[7] * v[814] + v[5] * v[801] + v[4] * v[586] + v[32] * v[571] - v[31] * v[572] + 0.0579 * (v[27] * v[572] - v[28] * v[571]) + v[27] * v[582] + v[28] * v[580] + -0.5 * v[577];
+    y[50] = v[3] * v[806] + v[2] * v[802] + -0.5 * v[569];
+    v[566] = 1. / v[328];
+    v[567] = v[325] * v[566];
+    v[568] = v[327] * v[566];
+    v[569] = v[329] * v[566];
+    v[570] = v[326] * v[566];
+    v[571] = (-(v[8] * v[570]) - v[7] * v[569] - v[5] * v[568] - v[4] * v[567]) / v[371];
+    v[572] = -(v[7] * v[570]) - v[6] * v[569] - v[4] * v[568] + v[5] * v[567] - v[369] * v[571];
+    v[573] = -(v[328] * v[566]) - v[370] * v[571];
+    v[574] = (v[3] * v[573] + v[2] * v[572]) / v[384];
+    y[77] = v[574];
+    v[575] = v[385] * v[574];
+    v[576] = v[2] * v[574];
+    v[577] = v[3] * v[574];
+    v[578] = v[2] * v[575];
+    v[579] = v[3] * v[575];
+    v[580] = v[577] / v[371];
+    v[581] = v[576] / v[371];
+    v[582] = v[571] - v[370] * v[580] - v[369] * v[581];
+    y[78] = v[582];
+    v[583] = -(v[3] * v[578]) - v[29] * v[577];
+    v[584] = v[30] * v[577] - v[3] * v[579];
+    v[585] = v[572] - v[376] * v[577] - v[375] * v[576];
+    v[586] = -(v[2] * v[578]) - v[29] * v[576];
+    v[587] = v[378] * v[577] - v[573] + v[377] * v[576];
+    v[588] = v[30] * v[576] - v[2] * v[579];
+    v[589] = (-(v[370] * v[584]) - v[369] * v[588]) / v[371];
+    v[590] = -(v[387] * v[571]) - v[372] * v[580] - v[374] * v[584] - v[373] * v[583] + v[589];
+    v[591] = (-(v[370] * v[583]) - v[369] * v[586]) / v[371];
+    v[592] = -(v[386] * v[571]) - v[372] * v[581] - v[374] * v[588] - v[373] * v[586] + v[591];
+    v[571] = v[381] * v[580] - v[388] * v[571] + v[379] * v[581] - v[374] * v[589] - v[373] * v[591];
+    v[580] = v[5] * v[576] - v[4] * v[582];
+    v[581] = -(v[5] * v[582]) - v[4] * v[576];
+    v[589] = -(v[7] * v[582]) - v[6] * v[576];
+    v[591] = -(v[8] * v[582]) - v[7] * v[576];
+    v[593] = v[4] * v[571];
+    v[594] = v[5] * v[571];
+    v[595] = v[7] * v[571];
+    v[596] = v[8] * v[571];
+    v[597] = v[4] * v[592] - v[5] * v[586];
+    v[598] = v[5] * v[592] + v[4] * v[586];
+    v[599] = v[7] * v[592] + v[6] * v[586];
+    v[600] = v[8] * v[592] + v[7] * v[586];
+    v[601] = v[5] * v[588];
+    v[602] = v[4] * v[588];
+    v[603] = v[6] * v[588];
+    v[604] = v[7] * v[588];
+    v[605] = v[591] / v[328];
+    v[606] = v[589] / v[328];
+    v[607] = v[577] / v[328];
+    v[608] = v[581] / v[328];
+    v[609] = v[580] / v[328];
+    v[610] = v[566] + v[326] * v[605] + v[329] * v[606] - v[328] * v[607] + v[327] * v[608] + v[325] * v[609];
+    y[79] = v[610];
+    v[611] = v[8] * v[593] + v[7] * v[597] + v[39] * v[591];
+    v[612] = v[8] * v[594] + v[7] * v[598] - v[40] * v[591];
+    v[613] = v[8] * v[595] + v[7] * v[599] + v[41] * v[591];
+    v[614] = v[8] * v[596] + v[7] * v[600] - v[42] * v[591];
+    v[615] = v[7] * v[593] + v[6] * v[597] + v[39] * v[589];
+    v[616] = v[7] * v[594] + v[6] * v[598] - v[40] * v[589];
+    v[617] = v[7] * v[595] + v[6] * v[599] + v[41] * v[589];
+    v[618] = v[7] * v[596] + v[6] * v[600] - v[42] * v[589];
+    v[619] = v[4] * v[590] - v[5] * v[583] - v[39] * v[577];
+    v[620] = v[5] * v[590] + v[4] * v[583] + v[40] * v[577];
+    v[621] = v[7] * v[590] + v[6] * v[583] - v[41] * v[577];
+    v[622] = v[8] * v[590] + v[7] * v[583] + v[42] * v[577];
+    v[623] = v[5] * v[593] + v[4] * v[597] + v[39] * v[581];
+    v[624] = v[5] * v[594] + v[4] * v[598] - v[40] * v[581];
+    v[625] = v[5] * v[595] + v[4] * v[599] + v[41] * v[581];
+    v[626] = v[5] * v[596] + v[4] * v[600] - v[42] * v[581];
+    v[627] = v[320] * v[591] - v[567] + v[340] * v[589] - v[339] * v[577] + v[338] * v[581] + v[337] * v[580];
+    v[628] = v[4] * v[593] - v[5] * v[597] + v[39] * v[580];
+    v[629] = v[568] - v[276] * v[591] - v[344] * v[589] + v[343] * v[577] - v[342] * v[581] - v[341] * v[580];
+    v[630] = v[4] * v[594] - v[5] * v[598] - v[40] * v[580];
+    v[631] = v[353] * v[591] - v[569] + v[352] * v[589] - v[351] * v[577] + v[350] * v[581] + v[349] * v[580];
+    v[632] = v[4] * v[595] - v[5] * v[599] + v[41] * v[580];
+    v[633] = v[570] - v[293] * v[591] - v[324] * v[589] + v[323] * v[577] - v[322] * v[581] - v[321] * v[580];
+    v[634] = v[4] * v[596] - v[5] * v[600] - v[42] * v[580];
+    v[635] = (-(v[326] * v[614]) - v[329] * v[618] - v[328] * v[622] - v[327] * v[626] - v[325] * v[634]) / v[328];
+    v[636] = v[604] + (v[331] * v[605] - v[392] * v[566] - v[336] * v[614] - v[335] * v[613]) - v[334] * v[604] - v[333] * v[612] - v[332] * v[611] + v[635];
+    v[637] = (-(v[326] * v[613]) - v[329] * v[617] - v[328] * v[621] - v[327] * v[625] - v[325] * v[632]) / v[328];
+    v[638] = v[603] + (v[331] * v[606] - v[391] * v[566] - v[336] * v[618] - v[335] * v[617]) - v[334] * v[603] - v[333] * v[616] - v[332] * v[615] + v[637];
+    v[603] = (-(v[326] * v[604]) - v[329] * v[603] - v[328] * v[584] - v[327] * v[602] + v[325] * v[601]) / v[328];
+    v[604] = (-(v[326] * v[612]) - v[329] * v[616] - v[328] * v[620] - v[327] * v[624] - v[325] * v[630]) / v[328];
+    v[602] = v[602] + (v[331] * v[608] - v[390] * v[566] - v[336] * v[626] - v[335] * v[625]) - v[334] * v[602] - v[333] * v[624] - v[332] * v[623] + v[604];
+    v[639] = (-(v[326] * v[611]) - v[329] * v[615] - v[328] * v[619] - v[327] * v[623] - v[325] * v[628]) / v[328];
+    v[601] = v[331] * v[609] - v[389] * v[566] - v[336] * v[634] - v[335] * v[632] - v[601] + v[334] * v[601] - v[333] * v[630] - v[332] * v[628] + v[639];
+    v[566] = v[584] + (-(v[393] * v[566]) - v[387] * v[566] - v[360] * v[605] - v[358] * v[606] + v[357] * v[607] - v[331] * v[607] - v[356] * v[608] - v[354] * v[609] - v[336] * v[622] - v[335] * v[621]) - v[334] * v[584] - v[333] * v[620] - v[332] * v[619] - v[336] * v[635] - v[335] * v[637] + v[603] - v[334] * v[603] - v[333] * v[604] - v[332] * v[639];
+    v[584] = -v[577] - v[610];
+    v[603] = v[10] * v[589] + v[11] * v[581];
+    v[604] = v[12] * v[581] - v[9] * v[589];
+    v[605] = v[9] * v[584] + v[10] * v[580];
+    v[606] = v[10] * v[584] - v[9] * v[580];
+    v[607] = 0.2155 * v[580] - v[591];
+    v[608] = v[10] * v[617] + v[11] * v[616];
+    v[609] = v[12] * v[616] - v[9] * v[617];
+    v[635] = v[10] * v[621] + v[11] * v[620];
+    v[637] = v[12] * v[620] - v[9] * v[621];
+    v[639] = v[11] * v[624];
+    v[640] = v[10] * v[625] + v[639];
+    v[641] = v[12] * v[624];
+    v[642] = v[641] - v[9] * v[625];
+    v[643] = v[10] * v[632] + v[11] * v[630];
+    v[644] = v[12] * v[630] - v[9] * v[632];
+    v[645] = v[9] * v[638] + v[10] * v[615];
+    v[646] = v[10] * v[638] - v[9] * v[615];
+    v[618] = 0.2155 * v[615] - v[618];
+    v[647] = v[9] * v[566] + v[10] * v[619];
+    v[648] = v[10] * v[566] - v[9] * v[619];
+    v[622] = 0.2155 * v[619] - v[622];
+    v[649] = v[9] * v[602] + v[10] * v[623];
+    v[650] = v[10] * v[602] - v[9] * v[623];
+    v[626] = 0.2155 * v[623] - v[626];
+    v[651] = v[9] * v[601] + v[10] * v[628];
+    v[652] = v[10] * v[601] - v[9] * v[628];
+    v[634] = 0.2155 * v[628] - v[634];
+    v[653] = v[10] * v[618] + v[11] * v[626];
+    v[654] = v[12] * v[626] - v[9] * v[618];
+    v[655] = v[9] * v[622] + v[10] * v[634];
+    v[656] = v[10] * v[622] - v[9] * v[634];
+    v[614] = v[614] + 0.2155 * (v[634] - v[611]);
+    v[639] = -(v[10] * v[616]) - v[639];
+    v[641] = v[9] * v[616] - v[641];
+    v[657] = -(v[9] * v[620]) - v[10] * v[630];
+    v[658] = v[9] * v[630] - v[10] * v[620];
+    v[659] = v[612] - 0.2155 * v[630];
+    v[660] = v[607] / v[250];
+    v[661] = v[604] / v[250];
+    v[662] = v[603] / v[250];
+    v[663] = v[581] / v[250];
+    v[664] = v[606] / v[250];
+    v[665] = v[605] / v[250];
+    v[666] = v[248] * v[660] + v[247] * v[661] + v[251] * v[662] - v[250] * v[663] + v[249] * v[664] + v[246] * v[665];
+    y[80] = v[666];
+    v[667] = -(v[9] * v[636]) - v[10] * v[611] + 0.2155 * v[651] + v[55] * v[607];
+    v[668] = v[9] * v[611] - v[10] * v[636] + 0.2155 * v[652] - v[56] * v[607];
+    v[669] = -(v[10] * v[613]) - v[11] * v[612] + 0.2155 * v[643] + v[57] * v[607];
+    v[670] = v[9] * v[613] - v[12] * v[612] + 0.2155 * v[644] - v[58] * v[607];
+    v[671] = v[12] * v[649] - v[9] * v[645] + v[55] * v[604];
+    v[672] = v[12] * v[650] - v[9] * v[646] - v[56] * v[604];
+    v[673] = v[12] * v[640] - v[9] * v[608] + v[57] * v[604];
+    v[674] = v[12] * v[642] - v[9] * v[609] - v[58] * v[604];
+    v[675] = v[10] * v[645] + v[11] * v[649] + v[55] * v[603];
+    v[676] = v[10] * v[646] + v[11] * v[650] - v[56] * v[603];
+    v[677] = v[10] * v[608] + v[11] * v[640] + v[57] * v[603];
+    v[678] = v[10] * v[609] + v[11] * v[642] - v[58] * v[603];
+    v[679] = -v[649] - v[55] * v[581];
+    v[680] = v[56] * v[581] - v[650];
+    v[681] = -v[640] - v[57] * v[581];
+    v[682] = v[58] * v[581] - v[642];
+    v[683] = v[10] * v[647] - v[9] * v[651] + v[55] * v[606];
+    v[684] = v[10] * v[648] - v[9] * v[652] - v[56] * v[606];
+    v[685] = v[10] * v[635] - v[9] * v[643] + v[57] * v[606];
+    v[686] = v[10] * v[637] - v[9] * v[644] - v[58] * v[606];
+    v[687] = v[265] * v[607] + v[264] * v[604] + v[263] * v[603] - v[262] * v[581] + v[261] * v[606] + v[260] * v[605];
+    v[688] = v[9] * v[647] + v[10] * v[651] + v[55] * v[605];
+    v[689] = -(v[271] * v[607]) - v[270] * v[604] - v[269] * v[603] + v[268] * v[581] - v[267] * v[606] - v[266] * v[605];
+    v[690] = v[9] * v[648] + v[10] * v[652] - v[56] * v[605];
+    v[691] = v[282] * v[607] + v[281] * v[604] + v[280] * v[603] - v[279] * v[581] + v[278] * v[606] + v[277] * v[605];
+    v[692] = v[9] * v[635] + v[10] * v[643] + v[57] * v[605];
+    v[693] = -(v[288] * v[607]) - v[287] * v[604] - v[286] * v[603] + v[285] * v[581] - v[284] * v[606] - v[283] * v[605];
+    v[694] = v[9] * v[637] + v[10] * v[644] - v[58] * v[605];
+    v[695] = (-(v[248] * v[614]) - v[247] * v[654] - v[251] * v[653] + v[250] * v[626] - v[249] * v[656] - v[246] * v[655]) / v[250];
+    v[696] = v[659] + (v[253] * v[660] - v[259] * v[614] - v[258] * v[670] - v[257] * v[669]) - v[256] * v[659] - v[255] * v[668] - v[254] * v[667] + v[695];
+    v[697] = (-(v[248] * v[670]) - v[247] * v[674] - v[251] * v[678] - v[250] * v[682] - v[249] * v[686] - v[246] * v[694]) / v[250];
+    v[698] = v[641] + (v[253] * v[661] - v[259] * v[654] - v[258] * v[674] - v[257] * v[673]) - v[256] * v[641] - v[255] * v[672] - v[254] * v[671] + v[697];
+    v[699] = (-(v[248] * v[669]) - v[247] * v[673] - v[251] * v[677] - v[250] * v[681] - v[249] * v[685] - v[246] * v[692]) / v[250];
+    v[700] = v[639] + (v[253] * v[662] - v[259] * v[653] - v[258] * v[678] - v[257] * v[677]) - v[256] * v[639] - v[255] * v[676] - v[254] * v[675] + v[699];
+    v[639] = (-(v[248] * v[659]) - v[247] * v[641] - v[251] * v[639] - v[250] * v[624] - v[249] * v[658] - v[246] * v[657]) / v[250];
+    v[641] = (-(v[248] * v[668]) - v[247] * v[672] - v[251] * v[676] - v[250] * v[680] - v[249] * v[684] - v[246] * v[690]) / v[250];
+    v[658] = v[658] + (v[253] * v[664] - v[259] * v[656] - v[258] * v[686] - v[257] * v[685]) - v[256] * v[658] - v[255] * v[684] - v[254] * v[683] + v[641];
+    v[659] = (-(v[248] * v[667]) - v[247] * v[671] - v[251] * v[675] - v[250] * v[679] - v[249] * v[683] - v[246] * v[688]) / v[250];
+    v[657] = v[657] + (v[253] * v[665] - v[259] * v[655] - v[258] * v[694] - v[257] * v[692]) - v[256] * v[657] - v[255] * v[690] - v[254] * v[688] + v[659];
+    v[639] = v[624] + (-(v[302] * v[660]) - v[300] * v[661] - v[298] * v[662] + v[297] * v[663] - v[253] * v[663] - v[296] * v[664] - v[294] * v[665] + v[259] * v[626] - v[258] * v[682] - v[257] * v[681]) - v[256] * v[624] - v[255] * v[680] - v[254] * v[679] - v[259] * v[695] - v[258] * v[697] - v[257] * v[699] + v[639] - v[256] * v[639] - v[255] * v[641] - v[254] * v[659];
+    v[641] = -v[581] - v[666];
+    v[659] = v[13] * v[641] - v[14] * v[605];
+    v[660] = v[14] * v[641] + v[13] * v[605];
+    v[661] = v[13] * v[607] - v[14] * v[603] + v[16] * v[641] + v[15] * v[605];
+    v[662] = v[14] * v[607] + v[13] * v[603] + v[17] * v[641] + v[16] * v[605];
+    v[663] = v[13] * v[696] - v[14] * v[667];
+    v[664] = v[14] * v[696] + v[13] * v[667];
+    v[665] = v[13] * v[614] - v[14] * v[669] + v[16] * v[696] + v[15] * v[667];
+    v[695] = v[14] * v[614] + v[13] * v[669] + v[17] * v[696] + v[16] * v[667];
+    v[697] = v[13] * v[700] - v[14] * v[675];
+    v[699] = v[14] * v[700] + v[13] * v[675];
+    v[701] = v[13] * v[653] - v[14] * v[677] + v[16] * v[700] + v[15] * v[675];
+    v[702] = v[14] * v[653] + v[13] * v[677] + v[17] * v[700] + v[16] * v[675];
+    v[703] = v[13] * v[639] - v[14] * v[679];
+    v[704] = v[14] * v[639] + v[13] * v[679];
+    v[705] = -(v[13] * v[626]) - v[14] * v[681] + v[16] * v[639] + v[15] * v[679];
+    v[706] = v[13] * v[681] - v[14] * v[626] + v[17] * v[639] + v[16] * v[679];
+    v[707] = v[13] * v[657] - v[14] * v[688];
+    v[708] = v[14] * v[657] + v[13] * v[688];
+    v[709] = v[13] * v[655] - v[14] * v[692] + v[16] * v[657] + v[15] * v[688];
+    v[710] = v[14] * v[655] + v[13] * v[692] + v[17] * v[657] + v[16] * v[688];
+    v[711] = v[13] * v[682] - v[14] * v[694];
+    v[712] = v[14] * v[682] + v[13] * v[694];
+    v[713] = v[13] * v[670] - v[14] * v[678] + v[16] * v[682] + v[15] * v[694];
+    v[714] = v[14] * v[670] + v[13] * v[678] + v[17] * v[682] + v[16] * v[694];
+    v[715] = v[13] * v[680] - v[14] * v[690];
+    v[716] = v[14] * v[680] + v[13] * v[690];
+    v[717] = v[13] * v[668] - v[14] * v[676] + v[16] * v[680] + v[15] * v[690];
+    v[718] = v[14] * v[668] + v[13] * v[676] + v[17] * v[680] + v[16] * v[690];
+    v[719] = v[604] / v[187];
+    v[720] = v[662] / v[187];
+    v[721] = v[661] / v[187];
+    v[722] = v[606] / v[187];
+    v[723] = v[660] / v[187];
+    v[724] = v[659] / v[187];
+    v[725] = v[185] * v[719] + v[189] * v[720] + v[188] * v[721] + v[187] * v[722] + v[186] * v[723] + v[184] * v[724];
+    y[81] = v[725];
+    v[726] = v[13] * v[698] - v[14] * v[671] + v[70] * v[604];
+    v[727] = v[14] * v[698] + v[13] * v[671] - v[71] * v[604];
+    v[728] = v[13] * v[654] - v[14] * v[673] + v[16] * v[698] + v[15] * v[671] + v[72] * v[604];
+    v[729] = v[14] * v[654] + v[13] * v[673] + v[17] * v[698] + v[16] * v[671] - v[73] * v[604];
+    v[730] = v[14] * v[663] + v[13] * v[697] + v[17] * v[703] + v[16] * v[707] + v[70] * v[662];
+    v[731] = v[14] * v[664] + v[13] * v[699] + v[17] * v[704] + v[16] * v[708] - v[71] * v[662];
+    v[732] = v[14] * v[665] + v[13] * v[701] + v[17] * v[705] + v[16] * v[709] + v[72] * v[662];
+    v[733] = v[14] * v[695] + v[13] * v[702] + v[17] * v[706] + v[16] * v[710] - v[73] * v[662];
+    v[734] = v[13] * v[663] - v[14] * v[697] + v[16] * v[703] + v[15] * v[707] + v[70] * v[661];
+    v[735] = v[13] * v[664] - v[14] * v[699] + v[16] * v[704] + v[15] * v[708] - v[71] * v[661];
+    v[736] = v[13] * v[665] - v[14] * v[701] + v[16] * v[705] + v[15] * v[709] + v[72] * v[661];
+    v[737] = v[13] * v[695] - v[14] * v[702] + v[16] * v[706] + v[15] * v[710] - v[73] * v[661];
+    v[738] = v[13] * v[658] - v[14] * v[683] + v[70] * v[606];
+    v[739] = v[14] * v[658] + v[13] * v[683] - v[71] * v[606];
+    v[740] = v[13] * v[656] - v[14] * v[685] + v[16] * v[658] + v[15] * v[683] + v[72] * v[606];
+    v[741] = v[14] * v[656] + v[13] * v[685] + v[17] * v[658] + v[16] * v[683] - v[73] * v[606];
+    v[742] = v[14] * v[703] + v[13] * v[707] + v[70] * v[660];
+    v[743] = v[14] * v[704] + v[13] * v[708] - v[71] * v[660];
+    v[744] = v[14] * v[705] + v[13] * v[709] + v[72] * v[660];
+    v[745] = v[14] * v[706] + v[13] * v[710] - v[73] * v[660];
+    v[746] = v[202] * v[604] + v[178] * v[662] + v[201] * v[661] + v[200] * v[606] + v[199] * v[660] + v[198] * v[659];
+    v[747] = v[13] * v[703] - v[14] * v[707] + v[70] * v[659];
+    v[748] = -(v[207] * v[604]) - v[146] * v[662] - v[206] * v[661] - v[205] * v[606] - v[204] * v[660] - v[203] * v[659];
+    v[749] = v[13] * v[704] - v[14] * v[708] - v[71] * v[659];
+    v[750] = v[217] * v[604] + v[216] * v[662] + v[215] * v[661] + v[214] * v[606] + v[213] * v[660] + v[212] * v[659];
+    v[751] = v[13] * v[705] - v[14] * v[709] + v[72] * v[659];
+    v[752] = -(v[183] * v[604]) - v[132] * v[662] - v[182] * v[661] - v[181] * v[606] - v[180] * v[660] - v[179] * v[659];
+    v[753] = v[13] * v[706] - v[14] * v[710] - v[73] * v[659];
+    v[754] = (-(v[185] * v[674]) - v[189] * v[714] - v[188] * v[713] - v[187] * v[686] - v[186] * v[712] - v[184] * v[711]) / v[187];
+    v[755] = v[672] + (v[191] * v[719] - v[197] * v[674] - v[196] * v[729] - v[195] * v[728]) - v[194] * v[672] - v[193] * v[727] - v[192] * v[726] + v[754];
+    v[756] = (-(v[185] * v[729]) - v[189] * v[733] - v[188] * v[737] - v[187] * v[741] - v[186] * v[745] - v[184] * v[753]) / v[187];
+    v[757] = v[718] + (v[191] * v[720] - v[197] * v[714] - v[196] * v[733] - v[195] * v[732]) - v[194] * v[718] - v[193] * v[731] - v[192] * v[730] + v[756];
+    v[758] = (-(v[185] * v[728]) - v[189] * v[732] - v[188] * v[736] - v[187] * v[740] - v[186] * v[744] - v[184] * v[751]) / v[187];
+    v[759] = v[717] + (v[191] * v[721] - v[197] * v[713] - v[196] * v[737] - v[195] * v[736]) - v[194] * v[717] - v[193] * v[735] - v[192] * v[734] + v[758];
+    v[672] = (-(v[185] * v[672]) - v[189] * v[718] - v[188] * v[717] - v[187] * v[684] - v[186] * v[716] - v[184] * v[715]) / v[187];
+    v[717] = (-(v[185] * v[727]) - v[189] * v[731] - v[188] * v[735] - v[187] * v[739] - v[186] * v[743] - v[184] * v[749]) / v[187];
+    v[716] = v[716] + (v[191] * v[723] - v[197] * v[712] - v[196] * v[745] - v[195] * v[744]) - v[194] * v[716] - v[193] * v[743] - v[192] * v[742] + v[717];
+    v[718] = (-(v[185] * v[726]) - v[189] * v[730] - v[188] * v[734] - v[187] * v[738] - v[186] * v[742] - v[184] * v[747]) / v[187];
+    v[715] = v[715] + (v[191] * v[724] - v[197] * v[711] - v[196] * v[753] - v[195] * v[751]) - v[194] * v[715] - v[193] * v[749] - v[192] * v[747] + v[718];
+    v[672] = v[684] + (-(v[229] * v[719]) - v[228] * v[720] - v[226] * v[721] - v[225] * v[722] + v[191] * v[722] - v[224] * v[723] - v[222] * v[724] - v[197] * v[686] - v[196] * v[741] - v[195] * v[740]) - v[194] * v[684] - v[193] * v[739] - v[192] * v[738] - v[197] * v[754] - v[196] * v[756] - v[195] * v[758] + v[672] - v[194] * v[672] - v[193] * v[717] - v[192] * v[718];
+    v[684] = v[606] - v[725];
+    v[717] = v[18] * v[604] + v[19] * v[661] + v[20] * v[660];
+    v[718] = v[19] * v[604] - v[18] * v[661] + v[21] * v[660];
+    v[719] = v[18] * v[684] + v[19] * v[659];
+    v[720] = v[19] * v[684] - v[18] * v[659];
+    v[721] = 0.2155 * v[659] - v[662];
+    v[722] = v[18] * v[674] + v[19] * v[728] + v[20] * v[727];
+    v[723] = v[18] * v[713] + v[19] * v[736] + v[20] * v[735];
+    v[724] = v[18] * v[686] + v[19] * v[740] + v[20] * v[739];
+    v[754] = v[20] * v[743];
+    v[756] = v[18] * v[712] + v[19] * v[744] + v[754];
+    v[758] = v[18] * v[711] + v[19] * v[751] + v[20] * v[749];
+    v[760] = v[18] * v[755] + v[19] * v[726];
+    v[729] = 0.2155 * v[726] - v[729];
+    v[761] = v[18] * v[759] + v[19] * v[734];
+    v[737] = 0.2155 * v[734] - v[737];
+    v[762] = v[18] * v[672] + v[19] * v[738];
+    v[741] = 0.2155 * v[738] - v[741];
+    v[763] = v[18] * v[716] + v[19] * v[742];
+    v[745] = 0.2155 * v[742] - v[745];
+    v[764] = v[18] * v[715] + v[19] * v[747];
+    v[753] = 0.2155 * v[747] - v[753];
+    v[765] = v[18] * v[729] + v[19] * v[737] + v[20] * v[745];
+    v[766] = v[18] * v[741] + v[19] * v[753];
+    v[733] = v[733] + 0.2155 * (v[753] - v[730]);
+    v[754] = -(v[18] * v[727]) - v[19] * v[735] - v[754];
+    v[767] = -(v[18] * v[739]) - v[19] * v[749];
+    v[768] = v[731] - 0.2155 * v[749];
+    v[769] = v[721] / v[133];
+    v[770] = v[717] / v[133];
+    v[771] = v[660] / v[133];
+    v[772] = v[719] / v[133];
+    v[773] = v[130] * v[769] + v[134] * v[770] - v[133] * v[771] + v[129] * v[772];
+    y[82] = v[773];
+    v[774] = -(v[18] * v[757]) - v[19] * v[730] + 0.2155 * v[764] + v[86] * v[721];
+    v[775] = -(v[18] * v[714]) - v[19] * v[732] - v[20] * v[731] + 0.2155 * v[758] + v[88] * v[721];
+    v[776] = v[18] * v[760] + v[19] * v[761] + v[20] * v[763] + v[86] * v[717];
+    v[777] = v[18] * v[722] + v[19] * v[723] + v[20] * v[756] + v[88] * v[717];
+    v[778] = -v[763] - v[86] * v[660];
+    v[779] = -v[756] - v[88] * v[660];
+    v[780] = -(0.00072 * v[717]) - 0.0036 * v[720];
+    v[781] = v[128] * v[721] + -0.00072 * v[718] + v[127] * v[717] - v[143] * v[660] + v[142] * v[719];
+    v[782] = v[18] * v[762] + v[19] * v[764] + v[86] * v[719];
+    v[783] = v[150] * v[721] + v[149] * v[717] - v[148] * v[660] + 0.00072 * v[720] + v[147] * v[719];
+    v[784] = v[18] * v[724] + v[19] * v[758] + v[88] * v[719];
+    v[785] = -(2.1 * v[718]) - -0.00072 * v[719];
+    v[786] = v[733] + v[777];
+    v[787] = (-(v[130] * v[733]) - v[134] * v[765] + v[133] * v[745] - v[129] * v[766]) / v[133];
+    v[733] = v[768] + (v[137] * v[769] - v[141] * v[733] - v[140] * v[775]) - v[139] * v[768] - v[138] * v[774] + v[787];
+    v[788] = (-(v[130] * v[775]) - v[134] * v[777] - v[133] * v[779] - v[129] * v[784]) / v[133];
+    v[777] = v[754] + (v[137] * v[770] - v[141] * v[765] - v[140] * v[777]) - v[139] * v[754] - v[138] * v[776] + v[788];
+    v[754] = (-(v[130] * v[768]) - v[134] * v[754] - v[133] * v[743] - v[129] * v[767]) / v[133];
+    v[768] = (-(v[130] * v[774]) - v[134] * v[776] - v[133] * v[778] - v[129] * v[782]) / v[133];
+    v[767] = v[767] + (v[137] * v[772] - v[141] * v[766] - v[140] * v[784]) - v[139] * v[767] - v[138] * v[782] + v[768];
+    v[754] = v[743] + (-(v[156] * v[769]) - v[154] * v[770] + v[153] * v[771] - v[137] * v[771] - v[135] * v[772] + v[141] * v[745] - v[140] * v[779]) - v[139] * v[743] - v[138] * v[778] - v[141] * v[787] - v[140] * v[788] + v[754] - v[139] * v[754] - v[138] * v[768];
+    v[768] = -v[660] - v[773];
+    v[769] = v[22] * v[768] - v[23] * v[719];
+    v[770] = v[23] * v[768] + v[22] * v[719];
+    v[771] = v[22] * v[721] - v[23] * v[717] + v[25] * v[768] + v[24] * v[719];
+    v[772] = v[23] * v[721] + v[22] * v[717] + v[26] * v[768] + v[25] * v[719];
+    v[787] = v[775] - v[765];
+    v[765] = v[765] - v[775];
+    v[775] = v[774] - v[777];
+    v[788] = v[776] + v[733];
+    v[789] = v[22] * v[754] - v[23] * v[778];
+    v[790] = v[23] * v[754] + v[22] * v[778];
+    v[791] = -(v[22] * v[745]) - v[23] * v[779] + v[25] * v[754] + v[24] * v[778];
+    v[792] = v[22] * v[779] - v[23] * v[745] + v[26] * v[754] + v[25] * v[778];
+    v[793] = v[22] * v[767] - v[23] * v[782];
+    v[794] = v[23] * v[767] + v[22] * v[782];
+    v[795] = v[22] * v[766] - v[23] * v[784] + v[25] * v[767] + v[24] * v[782];
+    v[796] = v[23] * v[766] + v[22] * v[784] + v[26] * v[767] + v[25] * v[782];
+    v[797] = 0.001 * (v[720] / 0.001);
+    y[83] = v[797];
+    v[798] = -(0.006 * v[771]) - 0.001 * v[770];
+    v[799] = 0.3 * v[771] + 0.006 * v[770];
+    v[800] = -0.006 * v[772] + 0.001 * v[769];
+    v[801] = -(0.3 * v[772]) - -0.006 * v[769];
+    v[802] = v[720] - v[797];
+    v[803] = v[96] * v[802] - v[100] * v[769];
+    v[804] = v[100] * v[770] - v[97] * v[802];
+    v[805] = v[96] * v[718] - v[100] * v[771] - v[83] * v[769] + v[98] * v[802];
+    v[806] = v[100] * v[772] - v[97] * v[718] + v[83] * v[770] - v[99] * v[802];
+    v[807] = v[108] * v[772] - v[109] * v[771] - v[106] * v[769] + v[105] * v[770] + 0.001 * (v[97] * v[769] - v[96] * v[770]);
+    v[808] = v[109] * v[802] - v[110] * v[770] + 0.3 * v[806] + 0.006 * v[803] + x[13] * v[801];
+    v[809] = v[110] * v[769] - v[108] * v[802] + 0.3 * v[805] + -0.006 * v[804] + x[13] * v[799];
+    v[804] = v[109] * v[718] - v[110] * v[772] - v[107] * v[770] + v[106] * v[802] + -0.006 * v[805] + 0.001 * v[804] + x[13] * v[798];
+    v[802] = v[110] * v[771] - v[108] * v[718] + v[107] * v[769] - v[105] * v[802] + 0.006 * v[806] + 0.001 * v[803] + x[13] * v[800];
+    v[803] = v[81] * v[719] - v[80] * v[720];
+    v[805] = v[80] * v[768] - v[85] * v[719];
+    v[806] = v[85] * v[720] - v[81] * v[768];
+    v[810] = v[81] * v[717] - v[80] * v[718] + v[83] * v[719] - v[82] * v[720];
+    v[811] = v[80] * v[721] - v[85] * v[717] - v[84] * v[719] + v[82] * v[768];
+    v[812] = v[85] * v[718] - v[81] * v[721] + v[84] * v[720] - v[83] * v[768];
+    v[813] = v[26] * v[809] + v[25] * v[808] + v[23] * v[802] + v[22] * v[804] - v[94] * v[717] + v[93] * v[718] - v[91] * v[719] + v[90] * v[720] + -0.00108 * v[812] + 0.0047 * v[803];
+    v[814] = v[23] * v[809] + v[22] * v[808] - v[94] * v[719] + v[93] * v[720] + 1.8 * v[810] + 0.00108 * v[806];
+    v[803] = v[22] * v[809] - v[23] * v[808] - v[95] * v[720] + v[94] * v[768] + 1.8 * v[812] + -0.00108 * v[803] + 0.00072 * v[805] + x[12] * v[785];
+    v[769] = v[108] * v[770] - v[109] * v[769] + 0.3 * (v[97] * v[771] - v[96] * v[772] + v[99] * v[769] - v[98] * v[770]) + v[95] * v[719] - v[93] * v[768] + 1.8 * v[811] + -0.00072 * v[806] + x[12] * v[783];
+    v[718] = v[25] * v[809] + v[24] * v[808] + v[22] * v[802] - v[23] * v[804] - v[95] * v[718] + v[94] * v[721] - v[92] * v[720] + v[91] * v[768] + 0.00108 * v[810] + -0.00072 * v[811] + 0.0005 * v[806] + x[12] * v[780];
+    v[720] = v[807] + v[95] * v[717] - v[93] * v[721] + v[92] * v[719] - v[90] * v[768] + 0.00072 * v[812] + 0.0036 * v[805] + x[12] * v[781];
+    v[770] = v[66] * v[659] - v[65] * v[660];
+    v[771] = v[65] * v[684] - v[69] * v[659];
+    v[772] = v[69] * v[660] - v[66] * v[684];
+    v[805] = v[66] * v[661] - v[65] * v[662] + v[68] * v[659] - v[67] * v[660];
+    v[806] = v[65] * v[604] - v[69] * v[661] - v[52] * v[659] + v[67] * v[684];
+    v[810] = v[69] * v[662] - v[66] * v[604] + v[52] * v[660] - v[68] * v[684];
+    v[811] = v[19] * v[720] + v[18] * v[718] - v[78] * v[661] + v[77] * v[662] - v[75] * v[659] + v[74] * v[660] + 0.00017 * v[806] + -0.0357 * v[810] + 0.0058 * v[770] + -0.0027 * v[771];
+    v[812] = v[19] * v[803] - v[18] * v[769] - v[79] * v[660] + v[78] * v[684] + 1.7 * v[810] + -0.0357 * v[770] + 0.1292 * v[771] + x[11] * v[752];
+    v[815] = v[79] * v[659] - v[814] - v[77] * v[684] + 1.7 * v[806] + 0.00017 * v[770] + -0.1292 * v[772] + x[11] * v[750];
+    v[662] = 0.2155 * v[814] - v[18] * v[720] + v[19] * v[718] - v[79] * v[662] + v[78] * v[604] - v[76] * v[660] + v[75] * v[684] + 0.0357 * v[805] + -0.1292 * v[806] + 0.0306 * v[772] + x[11] * v[748];
+    v[770] = v[21] * v[769] - v[813] + v[20] * v[803] + v[79] * v[661] - v[77] * v[604] + v[76] * v[659] - v[74] * v[684] + -0.00017 * v[805] + 0.1292 * v[810] + -0.0027 * v[770] + 0.0279 * v[771] + x[11] * v[746];
+    v[806] = v[50] * v[605] - v[49] * v[606];
+    v[810] = v[49] * v[641] - v[54] * v[605];
+    v[814] = v[54] * v[606] - v[50] * v[641];
+    v[816] = v[50] * v[603] - v[49] * v[604] + v[52] * v[605] - v[51] * v[606];
+    v[817] = v[49] * v[607] - v[54] * v[603] - v[53] * v[605] + v[51] * v[641];
+    v[818] = v[54] * v[604] - v[50] * v[607] + v[53] * v[606] - v[52] * v[641];
+    v[819] = v[17] * v[815] + v[16] * v[812] + v[14] * v[770] + v[13] * v[662] - v[63] * v[603] + v[62] * v[604] - v[60] * v[605] + v[59] * v[606] + -0.1809 * v[818] + 0.0411 * v[806] + -0.0061 * v[810];
+    v[820] = v[14] * v[815] + v[13] * v[812] - v[63] * v[605] + v[62] * v[606] + 2.7 * v[816] + 0.1809 * v[814];
+    v[821] = v[13] * v[815] - v[14] * v[812] - v[64] * v[606] + v[63] * v[641] + 2.7 * v[818] + -0.1809 * v[806] + 0.0918 * v[810] + x[10] * v[693];
+    v[771] = v[19] * v[769] + v[18] * v[803] - v[78] * v[659] + v[77] * v[660] + 1.7 * v[805] + -0.00017 * v[771] + 0.0357 * v[772] + v[64] * v[605] - v[62] * v[641] + 2.7 * v[817] + -0.0918 * v[814] + x[10] * v[691];
+    v[606] = v[16] * v[815] + v[15] * v[812] + v[13] * v[770] - v[14] * v[662] - v[64] * v[604] + v[63] * v[607] - v[61] * v[606] + v[60] * v[641] + 0.1809 * v[816] + -0.0918 * v[817] + 0.0452 * v[814] + x[10] * v[689];
+    v[772] = v[811] + v[64] * v[603] - v[62] * v[607] + v[61] * v[605] - v[59] * v[641] + 0.0918 * v[818] + -0.0061 * v[806] + 0.0131 * v[810] + x[10] * v[687];
+    v[805] = v[35] * v[580] - v[34] * v[581];
+    v[806] = v[34] * v[584] - v[38] * v[580];
+    v[810] = v[38] * v[581] - v[35] * v[584];
+    v[814] = v[36] * v[584] - v[38] * v[589];
+    v[816] = v[38] * v[591] - v[37] * v[584];
+    v[817] = v[10] * v[772] + v[9] * v[606] - v[47] * v[589] + v[46] * v[591] - v[44] * v[580] + v[43] * v[581] + -0.09 * v[816] + 0.0127 * v[805] + -0.0117 * v[806];
+    v[818] = v[10] * v[821] - v[9] * v[771] - v[48] * v[581] + v[47] * v[584] + 3. * v[816] + -0.09 * v[805] + 0.39 * v[806] + x[9] * v[633];
+    v[822] = v[48] * v[580] - v[820] - v[46] * v[584] + 3. * v[814] + -0.39 * v[810] + x[9] * v[631];
+    v[591] = 0.2155 * v[820] - v[9] * v[772] + v[10] * v[606] - v[48] * v[591] - v[45] * v[581] + v[44] * v[584] + 0.09 * (v[35] * v[589] - v[34] * v[591] + v[37] * v[580] - v[36] * v[581]) + -0.39 * v[814] + 0.1334 * v[810] + x[9] * v[629];
+    v[805] = v[12] * v[771] - v[819] + v[11] * v[821] + v[48] * v[589] + v[45] * v[580] - v[43] * v[584] + 0.39 * v[816] + -0.0117 * v[805] + 0.1257 * v[806] + x[9] * v[627];
+    v[806] = v[7] * v[822] + v[6] * v[818] + v[4] * v[805] - v[5] * v[591] + v[33] * v[577] - v[32] * v[582] + 0.071 * (v[28] * v[582] - x[8] * v[577]) + x[8] * v[587];
+    v[810] = v[817] - v[33] * v[576] + v[31] * v[582] + 0.025 * (x[8] * v[576] - v[27] * v[582]) + x[8] * v[585];
+    y[69] = v[23] * (v[102] * v[721] + v[101] * v[717] + v[113] * v[768] + v[114] * v[719] - v[123] * v[745] + v[121] * v[766] + v[124] * v[787] + v[125] * v[786] + v[126] * v[779] + v[122] * v[784] + v[118] * v[733] + v[117] * v[777] + v[116] * v[754] + v[104] * v[767] + v[120] * v[774] - v[119] * v[776] + v[103] * v[778] + v[115] * v[782] + 0.3 * (v[23] * v[765] + v[22] * v[786] + v[26] * v[777] + v[24] * v[774] + v[25] * v[788]) + 0.006 * (v[23] * v[733] + v[22] * v[774] + v[795]) + -0.006 * (v[22] * v[777] - v[23] * v[776] + v[792]) + 0.001 * (v[789] + v[794]) + v[82] * v[809] + v[84] * v[808] + v[80] * v[802] + v[85] * v[804] + -0.081 * (v[101] * v[768] + v[124] * v[733] + v[125] * v[777] + v[126] * v[754] + v[122] * v[767] + 0.3 * v[792] + -0.006 * v[789] + v[85] * v[809]) + 0.081 * (v[102] * v[719] + v[125] * v[774] - v[124] * v[776] + v[123] * v[778] + v[121] * v[782] + 0.3 * v[795] + 0.006 * v[794] + v[80] * v[808])) - v[22] * (v[101] * v[721] - v[102] * v[717] + v[114] * v[768] - v[113] * v[719] - v[126] * v[745] + v[122] * v[766] + v[125] * v[765] + v[124] * v[786] - v[123] * v[779] - v[121] * v[784] + v[120] * v[733] - v[119] * v[777] + v[103] * v[754] + v[115] * v[767] - v[118] * v[774] - v[117] * v[776] - v[116] * v[778] - v[104] * v[782] + 0.3 * (v[22] * v[787] + v[23] * v[786] + v[26] * v[733] + v[25] * v[775] - v[24] * v[776]) + 0.006 * (-(v[23] * v[777]) - v[22] * v[776] + v[791]) + -0.006 * (v[22] * v[733] - v[23] * v[774] - v[796]) + 0.001 * (v[790] - v[793]) + v[84] * v[809] - v[82] * v[808] + v[85] * v[802] - v[80] * v[804] + 0.081 * (v[102] * v[768] + v[101] * v[719] + v[123] * v[754] + v[121] * v[767] + v[124] * v[775] + v[125] * v[788] + v[126] * v[778] + v[122] * v[782] + 0.3 * (v[791] + v[796]) + 0.006 * v[790] + -0.006 * v[793] + v[80] * v[809] + v[85] * v[808]));
+    y[68] = v[19] * (v[155] * v[604] - v[89] * v[661] + v[152] * v[684] - v[111] * v[659] + v[174] * v[674] - v[150] * v[714] + v[173] * v[713] + v[172] * v[686] + v[171] * v[712] + v[170] * v[711] - v[177] * v[728] + v[176] * v[736] - v[161] * v[740] - v[175] * v[744] - v[163] * v[751] + v[164] * v[755] - v[128] * v[757] + v[162] * v[759] + v[160] * v[672] + v[159] * v[716] + v[158] * v[715] - v[169] * v[726] - v[168] * v[734] - v[167] * v[738] - v[166] * v[742] + v[165] * v[747] + v[131] * v[729] + v[151] * v[741] + 2.1 * (v[18] * v[736] - v[19] * v[713] - v[21] * v[735]) + v[149] * v[722] + v[147] * v[724] - v[145] * v[727] - v[144] * v[739] + 0.00072 * (v[19] * v[755] - v[18] * v[726] - v[758]) + 0.0036 * (v[18] * v[747] - v[19] * v[715]) + v[127] * v[760] + -0.00072 * (v[19] * v[686] - v[18] * v[740] + v[21] * v[739] - v[761]) + v[142] * v[762] - v[67] * v[769] + v[52] * v[803] - v[65] * v[720] + v[69] * v[718] + -0.2155 * (v[89] * v[660] + v[177] * v[727] - v[176] * v[735] + v[161] * v[739] + v[175] * v[743] + v[163] * v[749] + 2.1 * (v[19] * v[712] - v[18] * v[744] + v[21] * v[743]) + -0.00072 * v[763] + v[66] * v[769])) - v[18] * (v[89] * v[604] + v[155] * v[661] + v[111] * v[684] + v[152] * v[659] + v[177] * v[674] - v[176] * v[713] + v[161] * v[686] + v[175] * v[712] + v[163] * v[711] + v[174] * v[728] - v[150] * v[732] + v[173] * v[736] + v[172] * v[740] + v[171] * v[744] + v[170] * v[751] + v[169] * v[755] + v[168] * v[759] + v[167] * v[672] + v[166] * v[716] - v[165] * v[715] + v[164] * v[726] - v[128] * v[730] + v[162] * v[734] + v[160] * v[738] + v[159] * v[742] + v[158] * v[747] + v[131] * v[737] + v[151] * v[753] + 2.1 * (v[19] * v[674] - v[18] * v[728] + v[21] * v[727]) + v[149] * v[723] + v[147] * v[758] - v[145] * v[735] - v[144] * v[749] + 0.00072 * (v[724] + (v[19] * v[759] - v[18] * v[734])) + 0.0036 * (v[19] * v[672] - v[18] * v[738]) + -0.00072 * (v[19] * v[711] - v[18] * v[751] + v[21] * v[749] + v[760]) + v[127] * v[761] + v[142] * v[764] + v[52] * v[769] + v[67] * v[803] + v[69] * v[720] + v[65] * v[718] + 0.2155 * (v[155] * v[660] + v[174] * v[727] - v[150] * v[731] + v[173] * v[735] + v[172] * v[739] + v[171] * v[743] + v[170] * v[749] + v[131] * v[745] + v[149] * v[756] - v[145] * v[743] + 0.00072 * (v[19] * v[716] - v[18] * v[742]) + v[127] * v[763] + v[66] * v[803]));
+    y[67] = v[14] * (v[227] * v[607] + v[157] * v[603] + v[223] * v[641] + v[136] * v[605] + v[241] * v[614] + v[217] * v[654] + v[240] * v[653] - v[239] * v[626] + v[214] * v[656] + v[238] * v[655] + v[245] * v[669] + v[183] * v[673] + v[244] * v[677] + v[243] * v[681] + v[181] * v[685] + v[242] * v[692] + v[233] * v[696] + v[202] * v[698] + v[232] * v[700] + v[231] * v[639] + v[200] * v[658] + v[230] * v[657] + v[237] * v[667] + v[207] * v[671] + v[236] * v[675] + v[235] * v[679] + v[205] * v[683] + v[234] * v[688] + v[220] * v[670] + v[221] * v[678] + v[218] * v[682] + v[219] * v[694] + v[182] * v[695] + v[132] * v[702] + v[179] * v[706] + v[180] * v[710] + v[215] * v[665] + v[216] * v[701] + v[212] * v[705] + v[213] * v[709] + v[210] * v[668] + v[211] * v[676] + v[208] * v[680] + v[209] * v[690] + v[206] * v[664] + v[146] * v[699] + v[203] * v[704] + v[204] * v[708] + v[201] * v[663] + v[178] * v[697] + v[198] * v[703] + v[199] * v[707] + v[51] * v[815] + v[53] * v[812] + v[49] * v[770] + v[54] * v[662] + -0.1845 * (v[157] * v[641] + v[245] * v[696] + v[183] * v[698] + v[244] * v[700] + v[243] * v[639] + v[181] * v[658] + v[242] * v[657] + v[221] * v[682] + v[132] * v[706] + v[216] * v[705] + v[211] * v[680] + v[146] * v[704] + v[178] * v[703] + v[54] * v[815]) + 0.1845 * (v[227] * v[605] + v[241] * v[667] + v[217] * v[671] + v[240] * v[675] + v[239] * v[679] + v[214] * v[683] + v[238] * v[688] + v[220] * v[694] + v[182] * v[710] + v[215] * v[709] + v[210] * v[690] + v[206] * v[708] + v[201] * v[707] + v[49] * v[812])) - v[13] * (v[157] * v[607] - v[227] * v[603] + v[136] * v[641] - v[223] * v[605] + v[245] * v[614] + v[183] * v[654] + v[244] * v[653] - v[243] * v[626] + v[181] * v[656] + v[242] * v[655] - v[241] * v[669] - v[217] * v[673] - v[240] * v[677] - v[239] * v[681] - v[214] * v[685] - v[238] * v[692] + v[237] * v[696] + v[207] * v[698] + v[236] * v[700] + v[235] * v[639] + v[205] * v[658] + v[234] * v[657] - v[233] * v[667] - v[202] * v[671] - v[232] * v[675] - v[231] * v[679] - v[200] * v[683] - v[230] * v[688] + v[221] * v[670] - v[220] * v[678] + v[219] * v[682] - v[218] * v[694] + v[132] * v[695] - v[182] * v[702] + v[180] * v[706] - v[179] * v[710] + v[216] * v[665] - v[215] * v[701] + v[213] * v[705] - v[212] * v[709] + v[211] * v[668] - v[210] * v[676] + v[209] * v[680] - v[208] * v[690] + v[146] * v[664] - v[206] * v[699] + v[204] * v[704] - v[203] * v[708] + v[178] * v[663] - v[201] * v[697] + v[199] * v[703] - v[198] * v[707] + v[53] * v[815] - v[51] * v[812] + v[54] * v[770] - v[49] * v[662] + 0.1845 * (v[227] * v[641] + v[157] * v[605] + v[241] * v[696] + v[217] * v[698] + v[240] * v[700] + v[239] * v[639] + v[214] * v[658] + v[238] * v[657] + v[245] * v[667] + v[183] * v[671] + v[244] * v[675] + v[243] * v[679] + v[181] * v[683] + v[242] * v[688] + v[220] * v[682] + v[221] * v[694] + v[182] * v[706] + v[132] * v[710] + v[215] * v[705] + v[216] * v[709] + v[210] * v[680] + v[211] * v[690] + v[206] * v[704] + v[146] * v[708] + v[201] * v[703] + v[178] * v[707] + v[49] * v[815] + v[54] * v[812]));
+    y[66] = v[10] * (v[295] * v[584] - v[301] * v[589] - v[190] * v[580] + v[288] * v[613] - v[319] * v[617] - v[318] * v[621] - v[317] * v[625] - v[316] * v[632] - v[265] * v[636] + v[307] * v[638] + v[306] * v[566] + v[305] * v[602] + v[304] * v[601] + v[271] * v[611] - v[311] * v[615] - v[310] * v[619] - v[309] * v[623] - v[308] * v[628] - v[292] * v[618] + v[289] * v[622] - v[290] * v[634] - v[287] * v[609] + v[283] * v[637] - v[284] * v[644] - v[281] * v[608] + v[277] * v[635] - v[278] * v[643] + v[275] * v[616] - v[272] * v[620] + v[273] * v[630] - v[270] * v[646] + v[266] * v[648] - v[267] * v[652] - v[264] * v[645] + v[260] * v[647] - v[261] * v[651] - v[36] * v[771] - v[34] * v[772] + v[38] * v[606] + -0.2155 * (v[301] * v[581] - v[288] * v[612] + v[319] * v[616] + v[318] * v[620] + v[317] * v[624] + v[316] * v[630] + v[292] * v[626] + v[287] * v[642] + v[281] * v[640] - v[275] * v[624] + v[270] * v[650] + v[264] * v[649] + v[35] * v[771])) - v[9] * (v[299] * v[589] + v[190] * v[584] + v[295] * v[580] - v[282] * v[613] + v[315] * v[617] + v[314] * v[621] + v[313] * v[625] + v[312] * v[632] - v[271] * v[636] + v[311] * v[638] + v[310] * v[566] + v[309] * v[602] + v[308] * v[601] - v[265] * v[611] + v[307] * v[615] + v[306] * v[619] + v[305] * v[623] + v[304] * v[628] + v[291] * v[618] + v[290] * v[622] + v[289] * v[634] + v[286] * v[609] + v[284] * v[637] + v[283] * v[644] + v[280] * v[608] + v[278] * v[635] + v[277] * v[643] - v[274] * v[616] - v[273] * v[620] - v[272] * v[630] + v[269] * v[646] + v[267] * v[648] + v[266] * v[652] + v[263] * v[645] + v[261] * v[647] + v[260] * v[651] + v[36] * v[821] + v[38] * v[772] + v[34] * v[606] + 0.2155 * (v[299] * v[581] - v[282] * v[612] + v[315] * v[616] + v[314] * v[620] + v[313] * v[624] + v[312] * v[630] + v[291] * v[626] + v[286] * v[642] + v[280] * v[640] - v[274] * v[624] + v[269] * v[650] + v[263] * v[649] + v[35] * v[821]));
+    y[65] = v[5] * (-(v[386] * v[568]) - v[388] * v[567] - v[355] * v[582] - v[252] * v[576] + v[362] * v[571] + v[339] * v[590] + v[361] * v[592] + v[343] * v[583] + v[363] * v[586] + v[321] * v[596] + v[322] * v[600] + v[349] * v[595] + v[350] * v[599] + v[346] * v[588] + v[341] * v[594] + v[342] * v[598] + v[337] * v[593] + v[338] * v[597] + v[27] * v[805] + x[8] * v[591] + -0.2045 * (-(v[388] * v[570]) - v[303] * v[582] + v[368] * v[571] + v[323] * v[590] + v[367] * v[592] + v[293] * v[596] + v[353] * v[595] + v[276] * v[594] + v[320] * v[593] + x[8] * v[822]) + 0.2045 * (-(v[386] * v[569]) - v[359] * v[576] + v[351] * v[583] + v[365] * v[586] + v[324] * v[600] + v[352] * v[599] + v[347] * v[588] + v[344] * v[598] + v[340] * v[597] + v[27] * v[818])) - v[4] * (v[386] * v[567] - v[388] * v[568] - v[252] * v[582] + v[355] * v[576] + v[364] * v[571] + v[343] * v[590] + v[363] * v[592] - v[339] * v[583] - v[361] * v[586] + v[322] * v[596] - v[321] * v[600] + v[350] * v[595] - v[349] * v[599] - v[345] * v[588] + v[342] * v[594] - v[341] * v[598] + v[338] * v[593] - v[337] * v[597] + x[8] * v[805] - v[27] * v[591] + 0.2045 * (-(v[386] * v[570]) - v[388] * v[569] - v[359] * v[582] - v[303] * v[576] + v[366] * v[571] + v[351] * v[590] + v[365] * v[592] + v[323] * v[583] + v[367] * v[586] + v[324] * v[596] + v[293] * v[600] + v[352] * v[595] + v[353] * v[599] + v[348] * v[588] + v[344] * v[594] + v[276] * v[598] + v[340] * v[593] + v[320] * v[597] + v[27] * v[822] + x[8] * v[818]));
+    y[64] = v[3] * (v[385] * v[572] - v[380] * v[574] - v[382] * v[575] - v[377] * v[579] - v[375] * v[578] + x[7] * v[806]) - v[2] * (v[385] * v[573] - v[330] * v[574] - v[383] * v[575] - v[378] * v[579] - v[376] * v[578] + x[7] * v[810]);
+    y[76] = v[807] + (v[98] * v[801] + v[99] * v[799] + v[96] * v[798] + v[97] * v[800]) + -0.2 * v[797];
+    y[75] = v[813] + (v[82] * v[785] + v[83] * v[783] + v[80] * v[780] + v[81] * v[781]) + -0.5 * v[773];
+    y[74] = v[811] + (v[67] * v[752] + v[68] * v[750] + v[65] * v[748] + v[66] * v[746]) - v[725];
+    y[73] = v[819] + (v[51] * v[693] + v[52] * v[691] + v[49] * v[689] + v[50] * v[687]) + -0.3 * v[666];
+    y[72] = v[817] + (v[36] * v[633] + v[37] * v[631] + v[34] * v[629] + v[35] * v[627]) + -0.5 * v[610];
+    y[71] = v[8] * v[822] + v[7] * v[818] + v[5] * v[805] + v[4] * v[591] + v[32] * v[576] - v[31] * v[577] + 0.0579 * (v[27] * v[577] - v[28] * v[576]) + v[27] * v[587] + v[28] * v[585] + -0.5 * v[582];
+    y[70] = v[3] * v[810] + v[2] * v[806] + -0.5 * v[574];
+    v[566] = 1. / v[250];
+    v[567] = v[246] * v[566];
+    v[568] = v[249] * v[566];
+    v[569] = v[251] * v[566];
+    v[570] = v[247] * v[566];
+    v[571] = v[248] * v[566];
+    v[572] = -(v[10] * v[568]) - v[9] * v[567];
+    v[573] = v[572] / v[328];
+    v[574] = v[9] * v[568] - 0.2155 * v[571] - v[10] * v[567] - v[325] * v[573];
+    v[575] = v[250] * v[566] - v[12] * v[570] - v[11] * v[569] - v[327] * v[573];
+    v[576] = v[9] * v[570] - v[10] * v[569] - v[329] * v[573];
+    v[571] = v[571] - v[326] * v[573];
+    v[577] = (v[8] * v[571] + v[7] * v[576] + v[5] * v[575] + v[4] * v[574]) / v[371];
+    v[578] = v[7] * v[571] + v[6] * v[576] + v[4] * v[575] - v[5] * v[574] - v[369] * v[577];
+    v[572] = v[572] - v[328] * v[573] - v[370] * v[577];
+    v[579] = (v[3] * v[572] + v[2] * v[578]) / v[384];
+    y[97] = v[579];
+    v[580] = v[385] * v[579];
+    v[581] = v[2] * v[579];
+    v[582] = v[3] * v[579];
+    v[583] = v[2] * v[580];
+    v[584] = v[3] * v[580];
+    v[585] = v[582] / v[371];
+    v[586] = v[581] / v[371];
+    v[587] = v[577] - v[370] * v[585] - v[369] * v[586];
+    y[98] = v[587];
+    v[588] = -(v[3] * v[583]) - v[29] * v[582];
+    v[589] = v[30] * v[582] - v[3] * v[584];
+    v[590] = v[578] - v[376] * v[582] - v[375] * v[581];
+    v[591] = -(v[2] * v[583]) - v[29] * v[581];
+    v[592] = v[378] * v[582] - v[572] + v[377] * v[581];
+    v[593] = v[30] * v[581] - v[2] * v[584];
+    v[594] = (-(v[370] * v[589]) - v[369] * v[593]) / v[371];
+    v[595] = -(v[387] * v[577]) - v[372] * v[585] - v[374] * v[589] - v[373] * v[588] + v[594];
+    v[596] = (-(v[370] * v[588]) - v[369] * v[591]) / v[371];
+    v[597] = -(v[386] * v[577]) - v[372] * v[586] - v[374] * v[593] - v[373] * v[591] + v[596];
+    v[577] = v[381] * v[585] - v[388] * v[577] + v[379] * v[586] - v[374] * v[594] - v[373] * v[596];
+    v[585] = v[5] * v[581] - v[4] * v[587];
+    v[586] = -(v[5] * v[587]) - v[4] * v[581];
+    v[594] = -(v[7] * v[587]) - v[6] * v[581];
+    v[596] = -(v[8] * v[587]) - v[7] * v[581];
+    v[598] = v[4] * v[577];
+    v[599] = v[5] * v[577];
+    v[600] = v[7] * v[577];
+    v[601] = v[8] * v[577];
+    v[602] = v[4] * v[597] - v[5] * v[591];
+    v[603] = v[5] * v[597] + v[4] * v[591];
+    v[604] = v[7] * v[597] + v[6] * v[591];
+    v[605] = v[8] * v[597] + v[7] * v[591];
+    v[606] = v[5] * v[593];
+    v[607] = v[4] * v[593];
+    v[608] = v[6] * v[593];
+    v[609] = v[7] * v[593];
+    v[610] = v[596] / v[328];
+    v[611] = v[594] / v[328];
+    v[612] = v[582] / v[328];
+    v[613] = v[586] / v[328];
+    v[614] = v[585] / v[328];
+    v[615] = v[573] + v[326] * v[610] + v[329] * v[611] - v[328] * v[612] + v[327] * v[613] + v[325] * v[614];
+    y[99] = v[615];
+    v[616] = v[8] * v[598] + v[7] * v[602] + v[39] * v[596];
+    v[617] = v[8] * v[599] + v[7] * v[603] - v[40] * v[596];
+    v[618] = v[8] * v[600] + v[7] * v[604] + v[41] * v[596];
+    v[619] = v[8] * v[601] + v[7] * v[605] - v[42] * v[596];
+    v[620] = v[7] * v[598] + v[6] * v[602] + v[39] * v[594];
+    v[621] = v[7] * v[599] + v[6] * v[603] - v[40] * v[594];
+    v[622] = v[7] * v[600] + v[6] * v[604] + v[41] * v[594];
+    v[623] = v[7] * v[601] + v[6] * v[605] - v[42] * v[594];
+    v[624] = v[4] * v[595] - v[5] * v[588] - v[39] * v[582];
+    v[625] = v[5] * v[595] + v[4] * v[588] + v[40] * v[582];
+    v[626] = v[7] * v[595] + v[6] * v[588] - v[41] * v[582];
+    v[627] = v[8] * v[595] + v[7] * v[588] + v[42] * v[582];
+    v[628] = v[5] * v[598] + v[4] * v[602] + v[39] * v[586];
+    v[629] = v[5] * v[599] + v[4] * v[603] - v[40] * v[586];
+    v[630] = v[5] * v[600] + v[4] * v[604] + v[41] * v[586];
+    v[631] = v[5] * v[601] + v[4] * v[605] - v[42] * v[586];
+    v[632] = v[574] + v[320] * v[596] + v[340] * v[594] - v[339] * v[582] + v[338] * v[586] + v[337] * v[585];
+    v[633] = v[4] * v[598] - v[5] * v[602] + v[39] * v[585];
+    v[634] = -v[575] - v[276] * v[596] - v[344] * v[594] + v[343] * v[582] - v[342] * v[586] - v[341] * v[585];
+    v[635] = v[4] * v[599] - v[5] * v[603] - v[40] * v[585];
+    v[636] = v[576] + v[353] * v[596] + v[352] * v[594] - v[351] * v[582] + v[350] * v[586] + v[349] * v[585];
+    v[637] = v[4] * v[600] - v[5] * v[604] + v[41] * v[585];
+    v[638] = -v[571] - v[293] * v[596] - v[324] * v[594] + v[323] * v[582] - v[322] * v[586] - v[321] * v[585];
+    v[639] = v[4] * v[601] - v[5] * v[605] - v[42] * v[585];
+    v[640] = (-(v[326] * v[619]) - v[329] * v[623] - v[328] * v[627] - v[327] * v[631] - v[325] * v[639]) / v[328];
+    v[641] = v[609] + (v[331] * v[610] - v[392] * v[573] - v[336] * v[619] - v[335] * v[618]) - v[334] * v[609] - v[333] * v[617] - v[332] * v[616] + v[640];
+    v[642] = (-(v[326] * v[618]) - v[329] * v[622] - v[328] * v[626] - v[327] * v[630] - v[325] * v[637]) / v[328];
+    v[643] = v[608] + (v[331] * v[611] - v[391] * v[573] - v[336] * v[623] - v[335] * v[622]) - v[334] * v[608] - v[333] * v[621] - v[332] * v[620] + v[642];
+    v[608] = (-(v[326] * v[609]) - v[329] * v[608] - v[328] * v[589] - v[327] * v[607] + v[325] * v[606]) / v[328];
+    v[609] = (-(v[326] * v[617]) - v[329] * v[621] - v[328] * v[625] - v[327] * v[629] - v[325] * v[635]) / v[328];
+    v[607] = v[607] + (v[331] * v[613] - v[390] * v[573] - v[336] * v[631] - v[335] * v[630]) - v[334] * v[607] - v[333] * v[629] - v[332] * v[628] + v[609];
+    v[644] = (-(v[326] * v[616]) - v[329] * v[620] - v[328] * v[624] - v[327] * v[628] - v[325] * v[633]) / v[328];
+    v[606] = v[331] * v[614] - v[389] * v[573] - v[336] * v[639] - v[335] * v[637] - v[606] + v[334] * v[606] - v[333] * v[635] - v[332] * v[633] + v[644];
+    v[573] = v[589] + (-(v[393] * v[573]) - v[387] * v[573] - v[360] * v[610] - v[358] * v[611] + v[357] * v[612] - v[331] * v[612] - v[356] * v[613] - v[354] * v[614] - v[336] * v[627] - v[335] * v[626]) - v[334] * v[589] - v[333] * v[625] - v[332] * v[624] - v[336] * v[640] - v[335] * v[642] + v[608] - v[334] * v[608] - v[333] * v[609] - v[332] * v[644];
+    v[589] = -v[582] - v[615];
+    v[608] = v[10] * v[594] + v[11] * v[586];
+    v[609] = v[12] * v[586] - v[9] * v[594];
+    v[610] = v[9] * v[589] + v[10] * v[585];
+    v[611] = v[10] * v[589] - v[9] * v[585];
+    v[612] = 0.2155 * v[585] - v[596];
+    v[613] = v[10] * v[622] + v[11] * v[621];
+    v[614] = v[12] * v[621] - v[9] * v[622];
+    v[640] = v[10] * v[626] + v[11] * v[625];
+    v[642] = v[12] * v[625] - v[9] * v[626];
+    v[644] = v[11] * v[629];
+    v[645] = v[10] * v[630] + v[644];
+    v[646] = v[12] * v[629];
+    v[647] = v[646] - v[9] * v[630];
+    v[648] = v[10] * v[637] + v[11] * v[635];
+    v[649] = v[12] * v[635] - v[9] * v[637];
+    v[650] = v[9] * v[643] + v[10] * v[620];
+    v[651] = v[10] * v[643] - v[9] * v[620];
+    v[623] = 0.2155 * v[620] - v[623];
+    v[652] = v[9] * v[573] + v[10] * v[624];
+    v[653] = v[10] * v[573] - v[9] * v[624];
+    v[627] = 0.2155 * v[624] - v[627];
+    v[654] = v[9] * v[607] + v[10] * v[628];
+    v[655] = v[10] * v[607] - v[9] * v[628];
+    v[631] = 0.2155 * v[628] - v[631];
+    v[656] = v[9] * v[606] + v[10] * v[633];
+    v[657] = v[10] * v[606] - v[9] * v[633];
+    v[639] = 0.2155 * v[633] - v[639];
+    v[658] = v[10] * v[623] + v[11] * v[631];
+    v[659] = v[12] * v[631] - v[9] * v[623];
+    v[660] = v[9] * v[627] + v[10] * v[639];
+    v[661] = v[10] * v[627] - v[9] * v[639];
+    v[619] = v[619] + 0.2155 * (v[639] - v[616]);
+    v[644] = -(v[10] * v[621]) - v[644];
+    v[646] = v[9] * v[621] - v[646];
+    v[662] = -(v[9] * v[625]) - v[10] * v[635];
+    v[663] = v[9] * v[635] - v[10] * v[625];
+    v[664] = v[617] - 0.2155 * v[635];
+    v[665] = v[612] / v[250];
+    v[666] = v[609] / v[250];
+    v[667] = v[608] / v[250];
+    v[668] = v[586] / v[250];
+    v[669] = v[611] / v[250];
+    v[670] = v[610] / v[250];
+    v[671] = v[566] + v[248] * v[665] + v[247] * v[666] + v[251] * v[667] - v[250] * v[668] + v[249] * v[669] + v[246] * v[670];
+    y[100] = v[671];
+    v[672] = -(v[9] * v[641]) - v[10] * v[616] + 0.2155 * v[656] + v[55] * v[612];
+    v[673] = v[9] * v[616] - v[10] * v[641] + 0.2155 * v[657] - v[56] * v[612];
+    v[674] = -(v[10] * v[618]) - v[11] * v[617] + 0.2155 * v[648] + v[57] * v[612];
+    v[675] = v[9] * v[618] - v[12] * v[617] + 0.2155 * v[649] - v[58] * v[612];
+    v[676] = v[12] * v[654] - v[9] * v[650] + v[55] * v[609];
+    v[677] = v[12] * v[655] - v[9] * v[651] - v[56] * v[609];
+    v[678] = v[12] * v[645] - v[9] * v[613] + v[57] * v[609];
+    v[679] = v[12] * v[647] - v[9] * v[614] - v[58] * v[609];
+    v[680] = v[10] * v[650] + v[11] * v[654] + v[55] * v[608];
+    v[681] = v[10] * v[651] + v[11] * v[655] - v[56] * v[608];
+    v[682] = v[10] * v[613] + v[11] * v[645] + v[57] * v[608];
+    v[683] = v[10] * v[614] + v[11] * v[647] - v[58] * v[608];
+    v[684] = -v[654] - v[55] * v[586];
+    v[685] = v[56] * v[586] - v[655];
+    v[686] = -v[645] - v[57] * v[586];
+    v[687] = v[58] * v[586] - v[647];
+    v[688] = v[10] * v[652] - v[9] * v[656] + v[55] * v[611];
+    v[689] = v[10] * v[653] - v[9] * v[657] - v[56] * v[611];
+    v[690] = v[10] * v[640] - v[9] * v[648] + v[57] * v[611];
+    v[691] = v[10] * v[642] - v[9] * v[649] - v[58] * v[611];
+    v[692] = v[265] * v[612] - v[567] + v[264] * v[609] + v[263] * v[608] - v[262] * v[586] + v[261] * v[611] + v[260] * v[610];
+    v[693] = v[9] * v[652] + v[10] * v[656] + v[55] * v[610];
+    v[694] = v[568] - v[271] * v[612] - v[270] * v[609] - v[269] * v[608] + v[268] * v[586] - v[267] * v[611] - v[266] * v[610];
+    v[695] = v[9] * v[653] + v[10] * v[657] - v[56] * v[610];
+    v[696] = v[282] * v[612] - v[569] + v[281] * v[609] + v[280] * v[608] - v[279] * v[586] + v[278] * v[611] + v[277] * v[610];
+    v[697] = v[9] * v[640] + v[10] * v[648] + v[57] * v[610];
+    v[698] = v[570] - v[288] * v[612] - v[287] * v[609] - v[286] * v[608] + v[285] * v[586] - v[284] * v[611] - v[283] * v[610];
+    v[699] = v[9] * v[642] + v[10] * v[649] - v[58] * v[610];
+    v[700] = (-(v[248] * v[619]) - v[247] * v[659] - v[251] * v[658] + v[250] * v[631] - v[249] * v[661] - v[246] * v[660]) / v[250];
+    v[701] = v[664] + (v[253] * v[665] - v[395] * v[566] - v[259] * v[619] - v[258] * v[675] - v[257] * v[674]) - v[256] * v[664] - v[255] * v[673] - v[254] * v[672] + v[700];
+    v[702] = (-(v[248] * v[675]) - v[247] * v[679] - v[251] * v[683] - v[250] * v[687] - v[249] * v[691] - v[246] * v[699]) / v[250];
+    v[703] = v[646] + (v[253] * v[666] - v[399] * v[566] - v[259] * v[659] - v[258] * v[679] - v[257] * v[678]) - v[256] * v[646] - v[255] * v[677] - v[254] * v[676] + v[702];
+    v[704] = (-(v[248] * v[674]) - v[247] * v[678] - v[251] * v[682] - v[250] * v[686] - v[249] * v[690] - v[246] * v[697]) / v[250];
+    v[705] = v[644] + (v[253] * v[667] - v[398] * v[566] - v[259] * v[658] - v[258] * v[683] - v[257] * v[682]) - v[256] * v[644] - v[255] * v[681] - v[254] * v[680] + v[704];
+    v[644] = (-(v[248] * v[664]) - v[247] * v[646] - v[251] * v[644] - v[250] * v[629] - v[249] * v[663] - v[246] * v[662]) / v[250];
+    v[646] = (-(v[248] * v[673]) - v[247] * v[677] - v[251] * v[681] - v[250] * v[685] - v[249] * v[689] - v[246] * v[695]) / v[250];
+    v[663] = v[663] + (v[253] * v[669] - v[397] * v[566] - v[259] * v[661] - v[258] * v[691] - v[257] * v[690]) - v[256] * v[663] - v[255] * v[689] - v[254] * v[688] + v[646];
+    v[664] = (-(v[248] * v[672]) - v[247] * v[676] - v[251] * v[680] - v[250] * v[684] - v[249] * v[688] - v[246] * v[693]) / v[250];
+    v[662] = v[662] + (v[253] * v[670] - v[396] * v[566] - v[259] * v[660] - v[258] * v[699] - v[257] * v[697]) - v[256] * v[662] - v[255] * v[695] - v[254] * v[693] + v[664];
+    v[566] = v[629] + (v[390] * v[566] - v[400] * v[566] - v[302] * v[665] - v[300] * v[666] - v[298] * v[667] + v[297] * v[668] - v[253] * v[668] - v[296] * v[669] - v[294] * v[670] + v[259] * v[631] - v[258] * v[687] - v[257] * v[686]) - v[256] * v[629] - v[255] * v[685] - v[254] * v[684] - v[259] * v[700] - v[258] * v[702] - v[257] * v[704] + v[644] - v[256] * v[644] - v[255] * v[646] - v[254] * v[664];
+    v[644] = -v[586] - v[671];
+    v[646] = v[13] * v[644] - v[14] * v[610];
+    v[664] = v[14] * v[644] + v[13] * v[610];
+    v[665] = v[13] * v[612] - v[14] * v[608] + v[16] * v[644] + v[15] * v[610];
+    v[666] = v[14] * v[612] + v[13] * v[608] + v[17] * v[644] + v[16] * v[610];
+    v[667] = v[13] * v[701] - v[14] * v[672];
+    v[668] = v[14] * v[701] + v[13] * v[672];
+    v[669] = v[13] * v[619] - v[14] * v[674] + v[16] * v[701] + v[15] * v[672];
+    v[670] = v[14] * v[619] + v[13] * v[674] + v[17] * v[701] + v[16] * v[672];
+    v[700] = v[13] * v[705] - v[14] * v[680];
+    v[702] = v[14] * v[705] + v[13] * v[680];
+    v[704] = v[13] * v[658] - v[14] * v[682] + v[16] * v[705] + v[15] * v[680];
+    v[706] = v[14] * v[658] + v[13] * v[682] + v[17] * v[705] + v[16] * v[680];
+    v[707] = v[13] * v[566] - v[14] * v[684];
+    v[708] = v[14] * v[566] + v[13] * v[684];
+    v[709] = -(v[13] * v[631]) - v[14] * v[686] + v[16] * v[566] + v[15] * v[684];
+    v[710] = v[13] * v[686] - v[14] * v[631] + v[17] * v[566] + v[16] * v[684];
+    v[711] = v[13] * v[662] - v[14] * v[693];
+    v[712] = v[14] * v[662] + v[13] * v[693];
+    v[713] = v[13] * v[660] - v[14] * v[697] + v[16] * v[662] + v[15] * v[693];
+    v[714] = v[14] * v[660] + v[13] * v[697] + v[17] * v[662] + v[16] * v[693];
+    v[715] = v[13] * v[687] - v[14] * v[699];
+    v[716] = v[14] * v[687] + v[13] * v[699];
+    v[717] = v[13] * v[675] - v[14] * v[683] + v[16] * v[687] + v[15] * v[699];
+    v[718] = v[14] * v[675] + v[13] * v[683] + v[17] * v[687] + v[16] * v[699];
+    v[719] = v[13] * v[685] - v[14] * v[695];
+    v[720] = v[14] * v[685] + v[13] * v[695];
+    v[721] = v[13] * v[673] - v[14] * v[681] + v[16] * v[685] + v[15] * v[695];
+    v[722] = v[14] * v[673] + v[13] * v[681] + v[17] * v[685] + v[16] * v[695];
+    v[723] = v[609] / v[187];
+    v[724] = v[666] / v[187];
+    v[725] = v[665] / v[187];
+    v[726] = v[611] / v[187];
+    v[727] = v[664] / v[187];
+    v[728] = v[646] / v[187];
+    v[729] = v[185] * v[723] + v[189] * v[724] + v[188] * v[725] + v[187] * v[726] + v[186] * v[727] + v[184] * v[728];
+    y[101] = v[729];
+    v[730] = v[13] * v[703] - v[14] * v[676] + v[70] * v[609];
+    v[731] = v[14] * v[703] + v[13] * v[676] - v[71] * v[609];
+    v[732] = v[13] * v[659] - v[14] * v[678] + v[16] * v[703] + v[15] * v[676] + v[72] * v[609];
+    v[733] = v[14] * v[659] + v[13] * v[678] + v[17] * v[703] + v[16] * v[676] - v[73] * v[609];
+    v[734] = v[14] * v[667] + v[13] * v[700] + v[17] * v[707] + v[16] * v[711] + v[70] * v[666];
+    v[735] = v[14] * v[668] + v[13] * v[702] + v[17] * v[708] + v[16] * v[712] - v[71] * v[666];
+    v[736] = v[14] * v[669] + v[13] * v[704] + v[17] * v[709] + v[16] * v[713] + v[72] * v[666];
+    v[737] = v[14] * v[670] + v[13] * v[706] + v[17] * v[710] + v[16] * v[714] - v[73] * v[666];
+    v[738] = v[13] * v[667] - v[14] * v[700] + v[16] * v[707] + v[15] * v[711] + v[70] * v[665];
+    v[739] = v[13] * v[668] - v[14] * v[702] + v[16] * v[708] + v[15] * v[712] - v[71] * v[665];
+    v[740] = v[13] * v[669] - v[14] * v[704] + v[16] * v[709] + v[15] * v[713] + v[72] * v[665];
+    v[741] = v[13] * v[670] - v[14] * v[706] + v[16] * v[710] + v[15] * v[714] - v[73] * v[665];
+    v[742] = v[13] * v[663] - v[14] * v[688] + v[70] * v[611];
+    v[743] = v[14] * v[663] + v[13] * v[688] - v[71] * v[611];
+    v[744] = v[13] * v[661] - v[14] * v[690] + v[16] * v[663] + v[15] * v[688] + v[72] * v[611];
+    v[745] = v[14] * v[661] + v[13] * v[690] + v[17] * v[663] + v[16] * v[688] - v[73] * v[611];
+    v[746] = v[14] * v[707] + v[13] * v[711] + v[70] * v[664];
+    v[747] = v[14] * v[708] + v[13] * v[712] - v[71] * v[664];
+    v[748] = v[14] * v[709] + v[13] * v[713] + v[72] * v[664];
+    v[749] = v[14] * v[710] + v[13] * v[714] - v[73] * v[664];
+    v[750] = v[202] * v[609] + v[178] * v[666] + v[201] * v[665] + v[200] * v[611] + v[199] * v[664] + v[198] * v[646];
+    v[751] = v[13] * v[707] - v[14] * v[711] + v[70] * v[646];
+    v[752] = -(v[207] * v[609]) - v[146] * v[666] - v[206] * v[665] - v[205] * v[611] - v[204] * v[664] - v[203] * v[646];
+    v[753] = v[13] * v[708] - v[14] * v[712] - v[71] * v[646];
+    v[754] = v[217] * v[609] + v[216] * v[666] + v[215] * v[665] + v[214] * v[611] + v[213] * v[664] + v[212] * v[646];
+    v[755] = v[13] * v[709] - v[14] * v[713] + v[72] * v[646];
+    v[756] = -(v[183] * v[609]) - v[132] * v[666] - v[182] * v[665] - v[181] * v[611] - v[180] * v[664] - v[179] * v[646];
+    v[757] = v[13] * v[710] - v[14] * v[714] - v[73] * v[646];
+    v[758] = (-(v[185] * v[679]) - v[189] * v[718] - v[188] * v[717] - v[187] * v[691] - v[186] * v[716] - v[184] * v[715]) / v[187];
+    v[759] = v[677] + (v[191] * v[723] - v[197] * v[679] - v[196] * v[733] - v[195] * v[732]) - v[194] * v[677] - v[193] * v[731] - v[192] * v[730] + v[758];
+    v[760] = (-(v[185] * v[733]) - v[189] * v[737] - v[188] * v[741] - v[187] * v[745] - v[186] * v[749] - v[184] * v[757]) / v[187];
+    v[761] = v[722] + (v[191] * v[724] - v[197] * v[718] - v[196] * v[737] - v[195] * v[736]) - v[194] * v[722] - v[193] * v[735] - v[192] * v[734] + v[760];
+    v[762] = (-(v[185] * v[732]) - v[189] * v[736] - v[188] * v[740] - v[187] * v[744] - v[186] * v[748] - v[184] * v[755]) / v[187];
+    v[763] = v[721] + (v[191] * v[725] - v[197] * v[717] - v[196] * v[741] - v[195] * v[740]) - v[194] * v[721] - v[193] * v[739] - v[192] * v[738] + v[762];
+    v[677] = (-(v[185] * v[677]) - v[189] * v[722] - v[188] * v[721] - v[187] * v[689] - v[186] * v[720] - v[184] * v[719]) / v[187];
+    v[721] = (-(v[185] * v[731]) - v[189] * v[735] - v[188] * v[739] - v[187] * v[743] - v[186] * v[747] - v[184] * v[753]) / v[187];
+    v[720] = v[720] + (v[191] * v[727] - v[197] * v[716] - v[196] * v[749] - v[195] * v[748]) - v[194] * v[720] - v[193] * v[747] - v[192] * v[746] + v[721];
+    v[722] = (-(v[185] * v[730]) - v[189] * v[734] - v[188] * v[738] - v[187] * v[742] - v[186] * v[746] - v[184] * v[751]) / v[187];
+    v[719] = v[719] + (v[191] * v[728] - v[197] * v[715] - v[196] * v[757] - v[195] * v[755]) - v[194] * v[719] - v[193] * v[753] - v[192] * v[751] + v[722];
+    v[677] = v[689] + (-(v[229] * v[723]) - v[228] * v[724] - v[226] * v[725] - v[225] * v[726] + v[191] * v[726] - v[224] * v[727] - v[222] * v[728] - v[197] * v[691] - v[196] * v[745] - v[195] * v[744]) - v[194] * v[689] - v[193] * v[743] - v[192] * v[742] - v[197] * v[758] - v[196] * v[760] - v[195] * v[762] + v[677] - v[194] * v[677] - v[193] * v[721] - v[192] * v[722];
+    v[689] = v[611] - v[729];
+    v[721] = v[18] * v[609] + v[19] * v[665] + v[20] * v[664];
+    v[722] = v[19] * v[609] - v[18] * v[665] + v[21] * v[664];
+    v[723] = v[18] * v[689] + v[19] * v[646];
+    v[724] = v[19] * v[689] - v[18] * v[646];
+    v[725] = 0.2155 * v[646] - v[666];
+    v[726] = v[18] * v[679] + v[19] * v[732] + v[20] * v[731];
+    v[727] = v[18] * v[717] + v[19] * v[740] + v[20] * v[739];
+    v[728] = v[18] * v[691] + v[19] * v[744] + v[20] * v[743];
+    v[758] = v[20] * v[747];
+    v[760] = v[18] * v[716] + v[19] * v[748] + v[758];
+    v[762] = v[18] * v[715] + v[19] * v[755] + v[20] * v[753];
+    v[764] = v[18] * v[759] + v[19] * v[730];
+    v[733] = 0.2155 * v[730] - v[733];
+    v[765] = v[18] * v[763] + v[19] * v[738];
+    v[741] = 0.2155 * v[738] - v[741];
+    v[766] = v[18] * v[677] + v[19] * v[742];
+    v[745] = 0.2155 * v[742] - v[745];
+    v[767] = v[18] * v[720] + v[19] * v[746];
+    v[749] = 0.2155 * v[746] - v[749];
+    v[768] = v[18] * v[719] + v[19] * v[751];
+    v[757] = 0.2155 * v[751] - v[757];
+    v[769] = v[18] * v[733] + v[19] * v[741] + v[20] * v[749];
+    v[770] = v[18] * v[745] + v[19] * v[757];
+    v[737] = v[737] + 0.2155 * (v[757] - v[734]);
+    v[758] = -(v[18] * v[731]) - v[19] * v[739] - v[758];
+    v[771] = -(v[18] * v[743]) - v[19] * v[753];
+    v[772] = v[735] - 0.2155 * v[753];
+    v[773] = v[725] / v[133];
+    v[774] = v[721] / v[133];
+    v[775] = v[664] / v[133];
+    v[776] = v[723] / v[133];
+    v[777] = v[130] * v[773] + v[134] * v[774] - v[133] * v[775] + v[129] * v[776];
+    y[102] = v[777];
+    v[778] = -(v[18] * v[761]) - v[19] * v[734] + 0.2155 * v[768] + v[86] * v[725];
+    v[779] = -(v[18] * v[718]) - v[19] * v[736] - v[20] * v[735] + 0.2155 * v[762] + v[88] * v[725];
+    v[780] = v[18] * v[764] + v[19] * v[765] + v[20] * v[767] + v[86] * v[721];
+    v[781] = v[18] * v[726] + v[19] * v[727] + v[20] * v[760] + v[88] * v[721];
+    v[782] = -v[767] - v[86] * v[664];
+    v[783] = -v[760] - v[88] * v[664];
+    v[784] = -(0.00072 * v[721]) - 0.0036 * v[724];
+    v[785] = v[128] * v[725] + -0.00072 * v[722] + v[127] * v[721] - v[143] * v[664] + v[142] * v[723];
+    v[786] = v[18] * v[766] + v[19] * v[768] + v[86] * v[723];
+    v[787] = v[150] * v[725] + v[149] * v[721] - v[148] * v[664] + 0.00072 * v[724] + v[147] * v[723];
+    v[788] = v[18] * v[728] + v[19] * v[762] + v[88] * v[723];
+    v[789] = -(2.1 * v[722]) - -0.00072 * v[723];
+    v[790] = v[737] + v[781];
+    v[791] = (-(v[130] * v[737]) - v[134] * v[769] + v[133] * v[749] - v[129] * v[770]) / v[133];
+    v[737] = v[772] + (v[137] * v[773] - v[141] * v[737] - v[140] * v[779]) - v[139] * v[772] - v[138] * v[778] + v[791];
+    v[792] = (-(v[130] * v[779]) - v[134] * v[781] - v[133] * v[783] - v[129] * v[788]) / v[133];
+    v[781] = v[758] + (v[137] * v[774] - v[141] * v[769] - v[140] * v[781]) - v[139] * v[758] - v[138] * v[780] + v[792];
+    v[758] = (-(v[130] * v[772]) - v[134] * v[758] - v[133] * v[747] - v[129] * v[771]) / v[133];
+    v[772] = (-(v[130] * v[778]) - v[134] * v[780] - v[133] * v[782] - v[129] * v[786]) / v[133];
+    v[771] = v[771] + (v[137] * v[776] - v[141] * v[770] - v[140] * v[788]) - v[139] * v[771] - v[138] * v[786] + v[772];
+    v[758] = v[747] + (-(v[156] * v[773]) - v[154] * v[774] + v[153] * v[775] - v[137] * v[775] - v[135] * v[776] + v[141] * v[749] - v[140] * v[783]) - v[139] * v[747] - v[138] * v[782] - v[141] * v[791] - v[140] * v[792] + v[758] - v[139] * v[758] - v[138] * v[772];
+    v[772] = -v[664] - v[777];
+    v[773] = v[22] * v[772] - v[23] * v[723];
+    v[774] = v[23] * v[772] + v[22] * v[723];
+    v[775] = v[22] * v[725] - v[23] * v[721] + v[25] * v[772] + v[24] * v[723];
+    v[776] = v[23] * v[725] + v[22] * v[721] + v[26] * v[772] + v[25] * v[723];
+    v[791] = v[779] - v[769];
+    v[769] = v[769] - v[779];
+    v[779] = v[778] - v[781];
+    v[792] = v[780] + v[737];
+    v[793] = v[22] * v[758] - v[23] * v[782];
+    v[794] = v[23] * v[758] + v[22] * v[782];
+    v[795] = -(v[22] * v[749]) - v[23] * v[783] + v[25] * v[758] + v[24] * v[782];
+    v[796] = v[22] * v[783] - v[23] * v[749] + v[26] * v[758] + v[25] * v[782];
+    v[797] = v[22] * v[771] - v[23] * v[786];
+    v[798] = v[23] * v[771] + v[22] * v[786];
+    v[799] = v[22] * v[770] - v[23] * v[788] + v[25] * v[771] + v[24] * v[786];
+    v[800] = v[23] * v[770] + v[22] * v[788] + v[26] * v[771] + v[25] * v[786];
+    v[801] = 0.001 * (v[724] / 0.001);
+    y[103] = v[801];
+    v[802] = -(0.006 * v[775]) - 0.001 * v[774];
+    v[803] = 0.3 * v[775] + 0.006 * v[774];
+    v[804] = -0.006 * v[776] + 0.001 * v[773];
+    v[805] = -(0.3 * v[776]) - -0.006 * v[773];
+    v[806] = v[724] - v[801];
+    v[807] = v[96] * v[806] - v[100] * v[773];
+    v[808] = v[100] * v[774] - v[97] * v[806];
+    v[809] = v[96] * v[722] - v[100] * v[775] - v[83] * v[773] + v[98] * v[806];
+    v[810] = v[100] * v[776] - v[97] * v[722] + v[83] * v[774] - v[99] * v[806];
+    v[811] = v[108] * v[776] - v[109] * v[775] - v[106] * v[773] + v[105] * v[774] + 0.001 * (v[97] * v[773] - v[96] * v[774]);
+    v[812] = v[109] * v[806] - v[110] * v[774] + 0.3 * v[810] + 0.006 * v[807] + x[13] * v[805];
+    v[813] = v[110] * v[773] - v[108] * v[806] + 0.3 * v[809] + -0.006 * v[808] + x[13] * v[803];
+    v[808] = v[109] * v[722] - v[110] * v[776] - v[107] * v[774] + v[106] * v[806] + -0.006 * v[809] + 0.001 * v[808] + x[13] * v[802];
+    v[806] = v[110] * v[775] - v[108] * v[722] + v[107] * v[773] - v[105] * v[806] + 0.006 * v[810] + 0.001 * v[807] + x[13] * v[804];
+    v[807] = v[81] * v[723] - v[80] * v[724];
+    v[809] = v[80] * v[772] - v[85] * v[723];
+    v[810] = v[85] * v[724] - v[81] * v[772];
+    v[814] = v[81] * v[721] - v[80] * v[722] + v[83] * v[723] - v[82] * v[724];
+    v[815] = v[80] * v[725] - v[85] * v[721] - v[84] * v[723] + v[82] * v[772];
+    v[816] = v[85] * v[722] - v[81] * v[725] + v[84] * v[724] - v[83] * v[772];
+    v[817] = v[26] * v[813] + v[25] * v[812] + v[23] * v[806] + v[22] * v[808] - v[94] * v[721] + v[93] * v[722] - v[91] * v[723] + v[90] * v[724] + -0.00108 * v[816] + 0.0047 * v[807];
+    v[818] = v[23] * v[813] + v[22] * v[812] - v[94] * v[723] + v[93] * v[724] + 1.8 * v[814] + 0.00108 * v[810];
+    v[807] = v[22] * v[813] - v[23] * v[812] - v[95] * v[724] + v[94] * v[772] + 1.8 * v[816] + -0.00108 * v[807] + 0.00072 * v[809] + x[12] * v[789];
+    v[773] = v[108] * v[774] - v[109] * v[773] + 0.3 * (v[97] * v[775] - v[96] * v[776] + v[99] * v[773] - v[98] * v[774]) + v[95] * v[723] - v[93] * v[772] + 1.8 * v[815] + -0.00072 * v[810] + x[12] * v[787];
+    v[722] = v[25] * v[813] + v[24] * v[812] + v[22] * v[806] - v[23] * v[808] - v[95] * v[722] + v[94] * v[725] - v[92] * v[724] + v[91] * v[772] + 0.00108 * v[814] + -0.00072 * v[815] + 0.0005 * v[810] + x[12] * v[784];
+    v[724] = v[811] + v[95] * v[721] - v[93] * v[725] + v[92] * v[723] - v[90] * v[772] + 0.00072 * v[816] + 0.0036 * v[809] + x[12] * v[785];
+    v[774] = v[66] * v[646] - v[65] * v[664];
+    v[775] = v[65] * v[689] - v[69] * v[646];
+    v[776] = v[69] * v[664] - v[66] * v[689];
+    v[809] = v[66] * v[665] - v[65] * v[666] + v[68] * v[646] - v[67] * v[664];
+    v[810] = v[65] * v[609] - v[69] * v[665] - v[52] * v[646] + v[67] * v[689];
+    v[814] = v[69] * v[666] - v[66] * v[609] + v[52] * v[664] - v[68] * v[689];
+    v[815] = v[19] * v[724] + v[18] * v[722] - v[78] * v[665] + v[77] * v[666] - v[75] * v[646] + v[74] * v[664] + 0.00017 * v[810] + -0.0357 * v[814] + 0.0058 * v[774] + -0.0027 * v[775];
+    v[816] = v[19] * v[807] - v[18] * v[773] - v[79] * v[664] + v[78] * v[689] + 1.7 * v[814] + -0.0357 * v[774] + 0.1292 * v[775] + x[11] * v[756];
+    v[819] = v[79] * v[646] - v[818] - v[77] * v[689] + 1.7 * v[810] + 0.00017 * v[774] + -0.1292 * v[776] + x[11] * v[754];
+    v[666] = 0.2155 * v[818] - v[18] * v[724] + v[19] * v[722] - v[79] * v[666] + v[78] * v[609] - v[76] * v[664] + v[75] * v[689] + 0.0357 * v[809] + -0.1292 * v[810] + 0.0306 * v[776] + x[11] * v[752];
+    v[774] = v[21] * v[773] - v[817] + v[20] * v[807] + v[79] * v[665] - v[77] * v[609] + v[76] * v[646] - v[74] * v[689] + -0.00017 * v[809] + 0.1292 * v[814] + -0.0027 * v[774] + 0.0279 * v[775] + x[11] * v[750];
+    v[810] = v[50] * v[610] - v[49] * v[611];
+    v[814] = v[49] * v[644] - v[54] * v[610];
+    v[818] = v[54] * v[611] - v[50] * v[644];
+    v[820] = v[50] * v[608] - v[49] * v[609] + v[52] * v[610] - v[51] * v[611];
+    v[821] = v[49] * v[612] - v[54] * v[608] - v[53] * v[610] + v[51] * v[644];
+    v[822] = v[54] * v[609] - v[50] * v[612] + v[53] * v[611] - v[52] * v[644];
+    v[823] = v[17] * v[819] + v[16] * v[816] + v[14] * v[774] + v[13] * v[666] - v[63] * v[608] + v[62] * v[609] - v[60] * v[610] + v[59] * v[611] + -0.1809 * v[822] + 0.0411 * v[810] + -0.0061 * v[814];
+    v[824] = v[14] * v[819] + v[13] * v[816] - v[63] * v[610] + v[62] * v[611] + 2.7 * v[820] + 0.1809 * v[818];
+    v[825] = v[13] * v[819] - v[14] * v[816] - v[64] * v[611] + v[63] * v[644] + 2.7 * v[822] + -0.1809 * v[810] + 0.0918 * v[814] + x[10] * v[698];
+    v[775] = v[19] * v[773] + v[18] * v[807] - v[78] * v[646] + v[77] * v[664] + 1.7 * v[809] + -0.00017 * v[775] + 0.0357 * v[776] + v[64] * v[610] - v[62] * v[644] + 2.7 * v[821] + -0.0918 * v[818] + x[10] * v[696];
+    v[611] = v[16] * v[819] + v[15] * v[816] + v[13] * v[774] - v[14] * v[666] - v[64] * v[609] + v[63] * v[612] - v[61] * v[611] + v[60] * v[644] + 0.1809 * v[820] + -0.0918 * v[821] + 0.0452 * v[818] + x[10] * v[694];
+    v[776] = v[815] + v[64] * v[608] - v[62] * v[612] + v[61] * v[610] - v[59] * v[644] + 0.0918 * v[822] + -0.0061 * v[810] + 0.0131 * v[814] + x[10] * v[692];
+    v[809] = v[35] * v[585] - v[34] * v[586];
+    v[810] = v[34] * v[589] - v[38] * v[585];
+    v[814] = v[38] * v[586] - v[35] * v[589];
+    v[818] = v[36] * v[589] - v[38] * v[594];
+    v[820] = v[38] * v[596] - v[37] * v[589];
+    v[821] = v[10] * v[776] + v[9] * v[611] - v[47] * v[594] + v[46] * v[596] - v[44] * v[585] + v[43] * v[586] + -0.09 * v[820] + 0.0127 * v[809] + -0.0117 * v[810];
+    v[822] = v[10] * v[825] - v[9] * v[775] - v[48] * v[586] + v[47] * v[589] + 3. * v[820] + -0.09 * v[809] + 0.39 * v[810] + x[9] * v[638];
+    v[826] = v[48] * v[585] - v[824] - v[46] * v[589] + 3. * v[818] + -0.39 * v[814] + x[9] * v[636];
+    v[596] = 0.2155 * v[824] - v[9] * v[776] + v[10] * v[611] - v[48] * v[596] - v[45] * v[586] + v[44] * v[589] + 0.09 * (v[35] * v[594] - v[34] * v[596] + v[37] * v[585] - v[36] * v[586]) + -0.39 * v[818] + 0.1334 * v[814] + x[9] * v[634];
+    v[809] = v[12] * v[775] - v[823] + v[11] * v[825] + v[48] * v[594] + v[45] * v[585] - v[43] * v[589] + 0.39 * v[820] + -0.0117 * v[809] + 0.1257 * v[810] + x[9] * v[632];
+    v[810] = v[7] * v[826] + v[6] * v[822] + v[4] * v[809] - v[5] * v[596] + v[33] * v[582] - v[32] * v[587] + 0.071 * (v[28] * v[587] - x[8] * v[582]) + x[8] * v[592];
+    v[814] = v[821] - v[33] * v[581] + v[31] * v[587] + 0.025 * (x[8] * v[581] - v[27] * v[587]) + x[8] * v[590];
+    y[89] = v[23] * (v[102] * v[725] + v[101] * v[721] + v[113] * v[772] + v[114] * v[723] - v[123] * v[749] + v[121] * v[770] + v[124] * v[791] + v[125] * v[790] + v[126] * v[783] + v[122] * v[788] + v[118] * v[737] + v[117] * v[781] + v[116] * v[758] + v[104] * v[771] + v[120] * v[778] - v[119] * v[780] + v[103] * v[782] + v[115] * v[786] + 0.3 * (v[23] * v[769] + v[22] * v[790] + v[26] * v[781] + v[24] * v[778] + v[25] * v[792]) + 0.006 * (v[23] * v[737] + v[22] * v[778] + v[799]) + -0.006 * (v[22] * v[781] - v[23] * v[780] + v[796]) + 0.001 * (v[793] + v[798]) + v[82] * v[813] + v[84] * v[812] + v[80] * v[806] + v[85] * v[808] + -0.081 * (v[101] * v[772] + v[124] * v[737] + v[125] * v[781] + v[126] * v[758] + v[122] * v[771] + 0.3 * v[796] + -0.006 * v[793] + v[85] * v[813]) + 0.081 * (v[102] * v[723] + v[125] * v[778] - v[124] * v[780] + v[123] * v[782] + v[121] * v[786] + 0.3 * v[799] + 0.006 * v[798] + v[80] * v[812])) - v[22] * (v[101] * v[725] - v[102] * v[721] + v[114] * v[772] - v[113] * v[723] - v[126] * v[749] + v[122] * v[770] + v[125] * v[769] + v[124] * v[790] - v[123] * v[783] - v[121] * v[788] + v[120] * v[737] - v[119] * v[781] + v[103] * v[758] + v[115] * v[771] - v[118] * v[778] - v[117] * v[780] - v[116] * v[782] - v[104] * v[786] + 0.3 * (v[22] * v[791] + v[23] * v[790] + v[26] * v[737] + v[25] * v[779] - v[24] * v[780]) + 0.006 * (-(v[23] * v[781]) - v[22] * v[780] + v[795]) + -0.006 * (v[22] * v[737] - v[23] * v[778] - v[800]) + 0.001 * (v[794] - v[797]) + v[84] * v[813] - v[82] * v[812] + v[85] * v[806] - v[80] * v[808] + 0.081 * (v[102] * v[772] + v[101] * v[723] + v[123] * v[758] + v[121] * v[771] + v[124] * v[779] + v[125] * v[792] + v[126] * v[782] + v[122] * v[786] + 0.3 * (v[795] + v[800]) + 0.006 * v[794] + -0.006 * v[797] + v[80] * v[813] + v[85] * v[812]));
+    y[88] = v[19] * (v[155] * v[609] - v[89] * v[665] + v[152] * v[689] - v[111] * v[646] + v[174] * v[679] - v[150] * v[718] + v[173] * v[717] + v[172] * v[691] + v[171] * v[716] + v[170] * v[715] - v[177] * v[732] + v[176] * v[740] - v[161] * v[744] - v[175] * v[748] - v[163] * v[755] + v[164] * v[759] - v[128] * v[761] + v[162] * v[763] + v[160] * v[677] + v[159] * v[720] + v[158] * v[719] - v[169] * v[730] - v[168] * v[738] - v[167] * v[742] - v[166] * v[746] + v[165] * v[751] + v[131] * v[733] + v[151] * v[745] + 2.1 * (v[18] * v[740] - v[19] * v[717] - v[21] * v[739]) + v[149] * v[726] + v[147] * v[728] - v[145] * v[731] - v[144] * v[743] + 0.00072 * (v[19] * v[759] - v[18] * v[730] - v[762]) + 0.0036 * (v[18] * v[751] - v[19] * v[719]) + v[127] * v[764] + -0.00072 * (v[19] * v[691] - v[18] * v[744] + v[21] * v[743] - v[765]) + v[142] * v[766] - v[67] * v[773] + v[52] * v[807] - v[65] * v[724] + v[69] * v[722] + -0.2155 * (v[89] * v[664] + v[177] * v[731] - v[176] * v[739] + v[161] * v[743] + v[175] * v[747] + v[163] * v[753] + 2.1 * (v[19] * v[716] - v[18] * v[748] + v[21] * v[747]) + -0.00072 * v[767] + v[66] * v[773])) - v[18] * (v[89] * v[609] + v[155] * v[665] + v[111] * v[689] + v[152] * v[646] + v[177] * v[679] - v[176] * v[717] + v[161] * v[691] + v[175] * v[716] + v[163] * v[715] + v[174] * v[732] - v[150] * v[736] + v[173] * v[740] + v[172] * v[744] + v[171] * v[748] + v[170] * v[755] + v[169] * v[759] + v[168] * v[763] + v[167] * v[677] + v[166] * v[720] - v[165] * v[719] + v[164] * v[730] - v[128] * v[734] + v[162] * v[738] + v[160] * v[742] + v[159] * v[746] + v[158] * v[751] + v[131] * v[741] + v[151] * v[757] + 2.1 * (v[19] * v[679] - v[18] * v[732] + v[21] * v[731]) + v[149] * v[727] + v[147] * v[762] - v[145] * v[739] - v[144] * v[753] + 0.00072 * (v[728] + (v[19] * v[763] - v[18] * v[738])) + 0.0036 * (v[19] * v[677] - v[18] * v[742]) + -0.00072 * (v[19] * v[715] - v[18] * v[755] + v[21] * v[753] + v[764]) + v[127] * v[765] + v[142] * v[768] + v[52] * v[773] + v[67] * v[807] + v[69] * v[724] + v[65] * v[722] + 0.2155 * (v[155] * v[664] + v[174] * v[731] - v[150] * v[735] + v[173] * v[739] + v[172] * v[743] + v[171] * v[747] + v[170] * v[753] + v[131] * v[749] + v[149] * v[760] - v[145] * v[747] + 0.00072 * (v[19] * v[720] - v[18] * v[746]) + v[127] * v[767] + v[66] * v[807]));
+    y[87] = v[14] * (v[227] * v[612] + v[157] * v[608] + v[223] * v[644] + v[136] * v[610] + v[241] * v[619] + v[217] * v[659] + v[240] * v[658] - v[239] * v[631] + v[214] * v[661] + v[238] * v[660] + v[245] * v[674] + v[183] * v[678] + v[244] * v[682] + v[243] * v[686] + v[181] * v[690] + v[242] * v[697] + v[233] * v[701] + v[202] * v[703] + v[232] * v[705] + v[231] * v[566] + v[200] * v[663] + v[230] * v[662] + v[237] * v[672] + v[207] * v[676] + v[236] * v[680] + v[235] * v[684] + v[205] * v[688] + v[234] * v[693] + v[220] * v[675] + v[221] * v[683] + v[218] * v[687] + v[219] * v[699] + v[182] * v[670] + v[132] * v[706] + v[179] * v[710] + v[180] * v[714] + v[215] * v[669] + v[216] * v[704] + v[212] * v[709] + v[213] * v[713] + v[210] * v[673] + v[211] * v[681] + v[208] * v[685] + v[209] * v[695] + v[206] * v[668] + v[146] * v[702] + v[203] * v[708] + v[204] * v[712] + v[201] * v[667] + v[178] * v[700] + v[198] * v[707] + v[199] * v[711] + v[51] * v[819] + v[53] * v[816] + v[49] * v[774] + v[54] * v[666] + -0.1845 * (v[157] * v[644] + v[245] * v[701] + v[183] * v[703] + v[244] * v[705] + v[243] * v[566] + v[181] * v[663] + v[242] * v[662] + v[221] * v[687] + v[132] * v[710] + v[216] * v[709] + v[211] * v[685] + v[146] * v[708] + v[178] * v[707] + v[54] * v[819]) + 0.1845 * (v[227] * v[610] + v[241] * v[672] + v[217] * v[676] + v[240] * v[680] + v[239] * v[684] + v[214] * v[688] + v[238] * v[693] + v[220] * v[699] + v[182] * v[714] + v[215] * v[713] + v[210] * v[695] + v[206] * v[712] + v[201] * v[711] + v[49] * v[816])) - v[13] * (v[157] * v[612] - v[227] * v[608] + v[136] * v[644] - v[223] * v[610] + v[245] * v[619] + v[183] * v[659] + v[244] * v[658] - v[243] * v[631] + v[181] * v[661] + v[242] * v[660] - v[241] * v[674] - v[217] * v[678] - v[240] * v[682] - v[239] * v[686] - v[214] * v[690] - v[238] * v[697] + v[237] * v[701] + v[207] * v[703] + v[236] * v[705] + v[235] * v[566] + v[205] * v[663] + v[234] * v[662] - v[233] * v[672] - v[202] * v[676] - v[232] * v[680] - v[231] * v[684] - v[200] * v[688] - v[230] * v[693] + v[221] * v[675] - v[220] * v[683] + v[219] * v[687] - v[218] * v[699] + v[132] * v[670] - v[182] * v[706] + v[180] * v[710] - v[179] * v[714] + v[216] * v[669] - v[215] * v[704] + v[213] * v[709] - v[212] * v[713] + v[211] * v[673] - v[210] * v[681] + v[209] * v[685] - v[208] * v[695] + v[146] * v[668] - v[206] * v[702] + v[204] * v[708] - v[203] * v[712] + v[178] * v[667] - v[201] * v[700] + v[199] * v[707] - v[198] * v[711] + v[53] * v[819] - v[51] * v[816] + v[54] * v[774] - v[49] * v[666] + 0.1845 * (v[227] * v[644] + v[157] * v[610] + v[241] * v[701] + v[217] * v[703] + v[240] * v[705] + v[239] * v[566] + v[214] * v[663] + v[238] * v[662] + v[245] * v[672] + v[183] * v[676] + v[244] * v[680] + v[243] * v[684] + v[181] * v[688] + v[242] * v[693] + v[220] * v[687] + v[221] * v[699] + v[182] * v[710] + v[132] * v[714] + v[215] * v[709] + v[216] * v[713] + v[210] * v[685] + v[211] * v[695] + v[206] * v[708] + v[146] * v[712] + v[201] * v[707] + v[178] * v[711] + v[49] * v[819] + v[54] * v[816]));
+    y[86] = v[10] * (v[391] * v[570] + v[389] * v[568] - v[394] * v[567] - v[301] * v[594] + v[295] * v[589] - v[190] * v[585] + v[288] * v[618] - v[319] * v[622] - v[318] * v[626] - v[317] * v[630] - v[316] * v[637] - v[265] * v[641] + v[307] * v[643] + v[306] * v[573] + v[305] * v[607] + v[304] * v[606] + v[271] * v[616] - v[311] * v[620] - v[310] * v[624] - v[309] * v[628] - v[308] * v[633] - v[292] * v[623] + v[289] * v[627] - v[290] * v[639] - v[287] * v[614] + v[283] * v[642] - v[284] * v[649] - v[281] * v[613] + v[277] * v[640] - v[278] * v[648] + v[275] * v[621] - v[272] * v[625] + v[273] * v[635] - v[270] * v[651] + v[266] * v[653] - v[267] * v[657] - v[264] * v[650] + v[260] * v[652] - v[261] * v[656] - v[36] * v[775] - v[34] * v[776] + v[38] * v[611] + -0.2155 * (v[301] * v[586] - v[390] * v[570] - v[288] * v[617] + v[319] * v[621] + v[318] * v[625] + v[317] * v[629] + v[316] * v[635] + v[292] * v[631] + v[287] * v[647] + v[281] * v[645] - v[275] * v[629] + v[270] * v[655] + v[264] * v[654] + v[35] * v[775])) - v[9] * (-(v[391] * v[569]) - v[394] * v[568] - v[389] * v[567] + v[299] * v[594] + v[190] * v[589] + v[295] * v[585] - v[282] * v[618] + v[315] * v[622] + v[314] * v[626] + v[313] * v[630] + v[312] * v[637] - v[271] * v[641] + v[311] * v[643] + v[310] * v[573] + v[309] * v[607] + v[308] * v[606] - v[265] * v[616] + v[307] * v[620] + v[306] * v[624] + v[305] * v[628] + v[304] * v[633] + v[291] * v[623] + v[290] * v[627] + v[289] * v[639] + v[286] * v[614] + v[284] * v[642] + v[283] * v[649] + v[280] * v[613] + v[278] * v[640] + v[277] * v[648] - v[274] * v[621] - v[273] * v[625] - v[272] * v[635] + v[269] * v[651] + v[267] * v[653] + v[266] * v[657] + v[263] * v[650] + v[261] * v[652] + v[260] * v[656] + v[36] * v[825] + v[38] * v[776] + v[34] * v[611] + 0.2155 * (v[299] * v[586] - v[390] * v[569] - v[282] * v[617] + v[315] * v[621] + v[314] * v[625] + v[313] * v[629] + v[312] * v[635] + v[291] * v[631] + v[286] * v[647] + v[280] * v[645] - v[274] * v[629] + v[269] * v[655] + v[263] * v[654] + v[35] * v[825]));
+    y[85] = v[5] * (v[386] * v[575] + v[388] * v[574] - v[355] * v[587] - v[252] * v[581] + v[362] * v[577] + v[339] * v[595] + v[361] * v[597] + v[343] * v[588] + v[363] * v[591] + v[321] * v[601] + v[322] * v[605] + v[349] * v[600] + v[350] * v[604] + v[346] * v[593] + v[341] * v[599] + v[342] * v[603] + v[337] * v[598] + v[338] * v[602] + v[27] * v[809] + x[8] * v[596] + -0.2045 * (v[388] * v[571] - v[303] * v[587] + v[368] * v[577] + v[323] * v[595] + v[367] * v[597] + v[293] * v[601] + v[353] * v[600] + v[276] * v[599] + v[320] * v[598] + x[8] * v[826]) + 0.2045 * (v[386] * v[576] - v[359] * v[581] + v[351] * v[588] + v[365] * v[591] + v[324] * v[605] + v[352] * v[604] + v[347] * v[593] + v[344] * v[603] + v[340] * v[602] + v[27] * v[822])) - v[4] * (v[388] * v[575] - v[386] * v[574] - v[252] * v[587] + v[355] * v[581] + v[364] * v[577] + v[343] * v[595] + v[363] * v[597] - v[339] * v[588] - v[361] * v[591] + v[322] * v[601] - v[321] * v[605] + v[350] * v[600] - v[349] * v[604] - v[345] * v[593] + v[342] * v[599] - v[341] * v[603] + v[338] * v[598] - v[337] * v[602] + x[8] * v[809] - v[27] * v[596] + 0.2045 * (v[386] * v[571] + v[388] * v[576] - v[359] * v[587] - v[303] * v[581] + v[366] * v[577] + v[351] * v[595] + v[365] * v[597] + v[323] * v[588] + v[367] * v[591] + v[324] * v[601] + v[293] * v[605] + v[352] * v[600] + v[353] * v[604] + v[348] * v[593] + v[344] * v[599] + v[276] * v[603] + v[340] * v[598] + v[320] * v[602] + v[27] * v[826] + x[8] * v[822]));
+    y[84] = v[3] * (v[385] * v[578] - v[380] * v[579] - v[382] * v[580] - v[377] * v[584] - v[375] * v[583] + x[7] * v[810]) - v[2] * (v[385] * v[572] - v[330] * v[579] - v[383] * v[580] - v[378] * v[584] - v[376] * v[583] + x[7] * v[814]);
+    y[96] = v[811] + (v[98] * v[805] + v[99] * v[803] + v[96] * v[802] + v[97] * v[804]) + -0.2 * v[801];
+    y[95] = v[817] + (v[82] * v[789] + v[83] * v[787] + v[80] * v[784] + v[81] * v[785]) + -0.5 * v[777];
+    y[94] = v[815] + (v[67] * v[756] + v[68] * v[754] + v[65] * v[752] + v[66] * v[750]) - v[729];
+    y[93] = v[823] + (v[51] * v[698] + v[52] * v[696] + v[49] * v[694] + v[50] * v[692]) + -0.3 * v[671];
+    y[92] = v[821] + (v[36] * v[638] + v[37] * v[636] + v[34] * v[634] + v[35] * v[632]) + -0.5 * v[615];
+    y[91] = v[8] * v[826] + v[7] * v[822] + v[5] * v[809] + v[4] * v[596] + v[32] * v[581] - v[31] * v[582] + 0.0579 * (v[27] * v[582] - v[28] * v[581]) + v[27] * v[592] + v[28] * v[590] + -0.5 * v[587];
+    y[90] = v[3] * v[814] + v[2] * v[810] + -0.5 * v[579];
+    v[566] = 1. / v[187];
+    v[567] = v[184] * v[566];
+    v[568] = v[186] * v[566];
+    v[569] = v[188] * v[566];
+    v[570] = v[189] * v[566];
+    v[571] = -(v[17] * v[570]) - v[16] * v[569] - v[14] * v[568] - v[13] * v[567];
+    v[572] = v[571] / v[250];
+    v[573] = -(v[16] * v[570]) - v[15] * v[569] - v[13] * v[568] + v[14] * v[567] - v[246] * v[572];
+    v[574] = -(v[187] * v[566]) - v[249] * v[572];
+    v[575] = v[14] * v[569] - v[13] * v[570] - v[251] * v[572];
+    v[576] = -(v[185] * v[566]) - v[247] * v[572];
+    v[577] = -(v[14] * v[570]) - v[13] * v[569] - v[248] * v[572];
+    v[578] = v[10] * v[574] + v[9] * v[573];
+    v[579] = v[578] / v[328];
+    v[580] = 0.2155 * v[577] - v[9] * v[574] + v[10] * v[573] - v[325] * v[579];
+    v[571] = v[250] * v[572] - v[571] + v[12] * v[576] + v[11] * v[575] - v[327] * v[579];
+    v[581] = v[10] * v[575] - v[9] * v[576] - v[329] * v[579];
+    v[577] = -v[577] - v[326] * v[579];
+    v[582] = (v[8] * v[577] + v[7] * v[581] + v[5] * v[571] + v[4] * v[580]) / v[371];
+    v[583] = v[7] * v[577] + v[6] * v[581] + v[4] * v[571] - v[5] * v[580] - v[369] * v[582];
+    v[578] = v[578] - v[328] * v[579] - v[370] * v[582];
+    v[584] = (v[3] * v[578] + v[2] * v[583]) / v[384];
+    y[117] = v[584];
+    v[585] = v[385] * v[584];
+    v[586] = v[2] * v[584];
+    v[587] = v[3] * v[584];
+    v[588] = v[2] * v[585];
+    v[589] = v[3] * v[585];
+    v[590] = v[587] / v[371];
+    v[591] = v[586] / v[371];
+    v[592] = v[582] - v[370] * v[590] - v[369] * v[591];
+    y[118] = v[592];
+    v[593] = -(v[3] * v[588]) - v[29] * v[587];
+    v[594] = v[30] * v[587] - v[3] * v[589];
+    v[595] = v[583] - v[376] * v[587] - v[375] * v[586];
+    v[596] = -(v[2] * v[588]) - v[29] * v[586];
+    v[597] = v[378] * v[587] - v[578] + v[377] * v[586];
+    v[598] = v[30] * v[586] - v[2] * v[589];
+    v[599] = (-(v[370] * v[594]) - v[369] * v[598]) / v[371];
+    v[600] = -(v[387] * v[582]) - v[372] * v[590] - v[374] * v[594] - v[373] * v[593] + v[599];
+    v[601] = (-(v[370] * v[593]) - v[369] * v[596]) / v[371];
+    v[602] = -(v[386] * v[582]) - v[372] * v[591] - v[374] * v[598] - v[373] * v[596] + v[601];
+    v[582] = v[381] * v[590] - v[388] * v[582] + v[379] * v[591] - v[374] * v[599] - v[373] * v[601];
+    v[590] = v[5] * v[586] - v[4] * v[592];
+    v[591] = -(v[5] * v[592]) - v[4] * v[586];
+    v[599] = -(v[7] * v[592]) - v[6] * v[586];
+    v[601] = -(v[8] * v[592]) - v[7] * v[586];
+    v[603] = v[4] * v[582];
+    v[604] = v[5] * v[582];
+    v[605] = v[7] * v[582];
+    v[606] = v[8] * v[582];
+    v[607] = v[4] * v[602] - v[5] * v[596];
+    v[608] = v[5] * v[602] + v[4] * v[596];
+    v[609] = v[7] * v[602] + v[6] * v[596];
+    v[610] = v[8] * v[602] + v[7] * v[596];
+    v[611] = v[5] * v[598];
+    v[612] = v[4] * v[598];
+    v[613] = v[6] * v[598];
+    v[614] = v[7] * v[598];
+    v[615] = v[601] / v[328];
+    v[616] = v[599] / v[328];
+    v[617] = v[587] / v[328];
+    v[618] = v[591] / v[328];
+    v[619] = v[590] / v[328];
+    v[620] = v[579] + v[326] * v[615] + v[329] * v[616] - v[328] * v[617] + v[327] * v[618] + v[325] * v[619];
+    y[119] = v[620];
+    v[621] = v[8] * v[603] + v[7] * v[607] + v[39] * v[601];
+    v[622] = v[8] * v[604] + v[7] * v[608] - v[40] * v[601];
+    v[623] = v[8] * v[605] + v[7] * v[609] + v[41] * v[601];
+    v[624] = v[8] * v[606] + v[7] * v[610] - v[42] * v[601];
+    v[625] = v[7] * v[603] + v[6] * v[607] + v[39] * v[599];
+    v[626] = v[7] * v[604] + v[6] * v[608] - v[40] * v[599];
+    v[627] = v[7] * v[605] + v[6] * v[609] + v[41] * v[599];
+    v[628] = v[7] * v[606] + v[6] * v[610] - v[42] * v[599];
+    v[629] = v[4] * v[600] - v[5] * v[593] - v[39] * v[587];
+    v[630] = v[5] * v[600] + v[4] * v[593] + v[40] * v[587];
+    v[631] = v[7] * v[600] + v[6] * v[593] - v[41] * v[587];
+    v[632] = v[8] * v[600] + v[7] * v[593] + v[42] * v[587];
+    v[633] = v[5] * v[603] + v[4] * v[607] + v[39] * v[591];
+    v[634] = v[5] * v[604] + v[4] * v[608] - v[40] * v[591];
+    v[635] = v[5] * v[605] + v[4] * v[609] + v[41] * v[591];
+    v[636] = v[5] * v[606] + v[4] * v[610] - v[42] * v[591];
+    v[637] = v[580] + v[320] * v[601] + v[340] * v[599] - v[339] * v[587] + v[338] * v[591] + v[337] * v[590];
+    v[638] = v[4] * v[603] - v[5] * v[607] + v[39] * v[590];
+    v[639] = -v[571] - v[276] * v[601] - v[344] * v[599] + v[343] * v[587] - v[342] * v[591] - v[341] * v[590];
+    v[640] = v[4] * v[604] - v[5] * v[608] - v[40] * v[590];
+    v[641] = v[581] + v[353] * v[601] + v[352] * v[599] - v[351] * v[587] + v[350] * v[591] + v[349] * v[590];
+    v[642] = v[4] * v[605] - v[5] * v[609] + v[41] * v[590];
+    v[643] = -v[577] - v[293] * v[601] - v[324] * v[599] + v[323] * v[587] - v[322] * v[591] - v[321] * v[590];
+    v[644] = v[4] * v[606] - v[5] * v[610] - v[42] * v[590];
+    v[645] = (-(v[326] * v[624]) - v[329] * v[628] - v[328] * v[632] - v[327] * v[636] - v[325] * v[644]) / v[328];
+    v[646] = v[614] + (v[331] * v[615] - v[392] * v[579] - v[336] * v[624] - v[335] * v[623]) - v[334] * v[614] - v[333] * v[622] - v[332] * v[621] + v[645];
+    v[647] = (-(v[326] * v[623]) - v[329] * v[627] - v[328] * v[631] - v[327] * v[635] - v[325] * v[642]) / v[328];
+    v[648] = v[613] + (v[331] * v[616] - v[391] * v[579] - v[336] * v[628] - v[335] * v[627]) - v[334] * v[613] - v[333] * v[626] - v[332] * v[625] + v[647];
+    v[613] = (-(v[326] * v[614]) - v[329] * v[613] - v[328] * v[594] - v[327] * v[612] + v[325] * v[611]) / v[328];
+    v[614] = (-(v[326] * v[622]) - v[329] * v[626] - v[328] * v[630] - v[327] * v[634] - v[325] * v[640]) / v[328];
+    v[612] = v[612] + (v[331] * v[618] - v[390] * v[579] - v[336] * v[636] - v[335] * v[635]) - v[334] * v[612] - v[333] * v[634] - v[332] * v[633] + v[614];
+    v[649] = (-(v[326] * v[621]) - v[329] * v[625] - v[328] * v[629] - v[327] * v[633] - v[325] * v[638]) / v[328];
+    v[611] = v[331] * v[619] - v[389] * v[579] - v[336] * v[644] - v[335] * v[642] - v[611] + v[334] * v[611] - v[333] * v[640] - v[332] * v[638] + v[649];
+    v[579] = v[594] + (-(v[393] * v[579]) - v[387] * v[579] - v[360] * v[615] - v[358] * v[616] + v[357] * v[617] - v[331] * v[617] - v[356] * v[618] - v[354] * v[619] - v[336] * v[632] - v[335] * v[631]) - v[334] * v[594] - v[333] * v[630] - v[332] * v[629] - v[336] * v[645] - v[335] * v[647] + v[613] - v[334] * v[613] - v[333] * v[614] - v[332] * v[649];
+    v[594] = -v[587] - v[620];
+    v[613] = v[10] * v[599] + v[11] * v[591];
+    v[614] = v[12] * v[591] - v[9] * v[599];
+    v[615] = v[9] * v[594] + v[10] * v[590];
+    v[616] = v[10] * v[594] - v[9] * v[590];
+    v[617] = 0.2155 * v[590] - v[601];
+    v[618] = v[10] * v[627] + v[11] * v[626];
+    v[619] = v[12] * v[626] - v[9] * v[627];
+    v[645] = v[10] * v[631] + v[11] * v[630];
+    v[647] = v[12] * v[630] - v[9] * v[631];
+    v[649] = v[11] * v[634];
+    v[650] = v[10] * v[635] + v[649];
+    v[651] = v[12] * v[634];
+    v[652] = v[651] - v[9] * v[635];
+    v[653] = v[10] * v[642] + v[11] * v[640];
+    v[654] = v[12] * v[640] - v[9] * v[642];
+    v[655] = v[9] * v[648] + v[10] * v[625];
+    v[656] = v[10] * v[648] - v[9] * v[625];
+    v[628] = 0.2155 * v[625] - v[628];
+    v[657] = v[9] * v[579] + v[10] * v[629];
+    v[658] = v[10] * v[579] - v[9] * v[629];
+    v[632] = 0.2155 * v[629] - v[632];
+    v[659] = v[9] * v[612] + v[10] * v[633];
+    v[660] = v[10] * v[612] - v[9] * v[633];
+    v[636] = 0.2155 * v[633] - v[636];
+    v[661] = v[9] * v[611] + v[10] * v[638];
+    v[662] = v[10] * v[611] - v[9] * v[638];
+    v[644] = 0.2155 * v[638] - v[644];
+    v[663] = v[10] * v[628] + v[11] * v[636];
+    v[664] = v[12] * v[636] - v[9] * v[628];
+    v[665] = v[9] * v[632] + v[10] * v[644];
+    v[666] = v[10] * v[632] - v[9] * v[644];
+    v[624] = v[624] + 0.2155 * (v[644] - v[621]);
+    v[649] = -(v[10] * v[626]) - v[649];
+    v[651] = v[9] * v[626] - v[651];
+    v[667] = -(v[9] * v[630]) - v[10] * v[640];
+    v[668] = v[9] * v[640] - v[10] * v[630];
+    v[669] = v[622] - 0.2155 * v[640];
+    v[670] = v[617] / v[250];
+    v[671] = v[614] / v[250];
+    v[672] = v[613] / v[250];
+    v[673] = v[591] / v[250];
+    v[674] = v[616] / v[250];
+    v[675] = v[615] / v[250];
+    v[676] = v[572] + v[248] * v[670] + v[247] * v[671] + v[251] * v[672] - v[250] * v[673] + v[249] * v[674] + v[246] * v[675];
+    y[120] = v[676];
+    v[677] = -(v[9] * v[646]) - v[10] * v[621] + 0.2155 * v[661] + v[55] * v[617];
+    v[678] = v[9] * v[621] - v[10] * v[646] + 0.2155 * v[662] - v[56] * v[617];
+    v[679] = -(v[10] * v[623]) - v[11] * v[622] + 0.2155 * v[653] + v[57] * v[617];
+    v[680] = v[9] * v[623] - v[12] * v[622] + 0.2155 * v[654] - v[58] * v[617];
+    v[681] = v[12] * v[659] - v[9] * v[655] + v[55] * v[614];
+    v[682] = v[12] * v[660] - v[9] * v[656] - v[56] * v[614];
+    v[683] = v[12] * v[650] - v[9] * v[618] + v[57] * v[614];
+    v[684] = v[12] * v[652] - v[9] * v[619] - v[58] * v[614];
+    v[685] = v[10] * v[655] + v[11] * v[659] + v[55] * v[613];
+    v[686] = v[10] * v[656] + v[11] * v[660] - v[56] * v[613];
+    v[687] = v[10] * v[618] + v[11] * v[650] + v[57] * v[613];
+    v[688] = v[10] * v[619] + v[11] * v[652] - v[58] * v[613];
+    v[689] = -v[659] - v[55] * v[591];
+    v[690] = v[56] * v[591] - v[660];
+    v[691] = -v[650] - v[57] * v[591];
+    v[692] = v[58] * v[591] - v[652];
+    v[693] = v[10] * v[657] - v[9] * v[661] + v[55] * v[616];
+    v[694] = v[10] * v[658] - v[9] * v[662] - v[56] * v[616];
+    v[695] = v[10] * v[645] - v[9] * v[653] + v[57] * v[616];
+    v[696] = v[10] * v[647] - v[9] * v[654] - v[58] * v[616];
+    v[697] = v[573] + v[265] * v[617] + v[264] * v[614] + v[263] * v[613] - v[262] * v[591] + v[261] * v[616] + v[260] * v[615];
+    v[698] = v[9] * v[657] + v[10] * v[661] + v[55] * v[615];
+    v[699] = -v[574] - v[271] * v[617] - v[270] * v[614] - v[269] * v[613] + v[268] * v[591] - v[267] * v[616] - v[266] * v[615];
+    v[700] = v[9] * v[658] + v[10] * v[662] - v[56] * v[615];
+    v[701] = v[575] + v[282] * v[617] + v[281] * v[614] + v[280] * v[613] - v[279] * v[591] + v[278] * v[616] + v[277] * v[615];
+    v[702] = v[9] * v[645] + v[10] * v[653] + v[57] * v[615];
+    v[703] = -v[576] - v[288] * v[617] - v[287] * v[614] - v[286] * v[613] + v[285] * v[591] - v[284] * v[616] - v[283] * v[615];
+    v[704] = v[9] * v[647] + v[10] * v[654] - v[58] * v[615];
+    v[705] = (-(v[248] * v[624]) - v[247] * v[664] - v[251] * v[663] + v[250] * v[636] - v[249] * v[666] - v[246] * v[665]) / v[250];
+    v[706] = v[669] + (v[253] * v[670] - v[395] * v[572] - v[259] * v[624] - v[258] * v[680] - v[257] * v[679]) - v[256] * v[669] - v[255] * v[678] - v[254] * v[677] + v[705];
+    v[707] = (-(v[248] * v[680]) - v[247] * v[684] - v[251] * v[688] - v[250] * v[692] - v[249] * v[696] - v[246] * v[704]) / v[250];
+    v[708] = v[651] + (v[253] * v[671] - v[399] * v[572] - v[259] * v[664] - v[258] * v[684] - v[257] * v[683]) - v[256] * v[651] - v[255] * v[682] - v[254] * v[681] + v[707];
+    v[709] = (-(v[248] * v[679]) - v[247] * v[683] - v[251] * v[687] - v[250] * v[691] - v[249] * v[695] - v[246] * v[702]) / v[250];
+    v[710] = v[649] + (v[253] * v[672] - v[398] * v[572] - v[259] * v[663] - v[258] * v[688] - v[257] * v[687]) - v[256] * v[649] - v[255] * v[686] - v[254] * v[685] + v[709];
+    v[649] = (-(v[248] * v[669]) - v[247] * v[651] - v[251] * v[649] - v[250] * v[634] - v[249] * v[668] - v[246] * v[667]) / v[250];
+    v[651] = (-(v[248] * v[678]) - v[247] * v[682] - v[251] * v[686] - v[250] * v[690] - v[249] * v[694] - v[246] * v[700]) / v[250];
+    v[668] = v[668] + (v[253] * v[674] - v[397] * v[572] - v[259] * v[666] - v[258] * v[696] - v[257] * v[695]) - v[256] * v[668] - v[255] * v[694] - v[254] * v[693] + v[651];
+    v[669] = (-(v[248] * v[677]) - v[247] * v[681] - v[251] * v[685] - v[250] * v[689] - v[249] * v[693] - v[246] * v[698]) / v[250];
+    v[667] = v[667] + (v[253] * v[675] - v[396] * v[572] - v[259] * v[665] - v[258] * v[704] - v[257] * v[702]) - v[256] * v[667] - v[255] * v[700] - v[254] * v[698] + v[669];
+    v[572] = v[634] + (v[390] * v[572] - v[400] * v[572] - v[302] * v[670] - v[300] * v[671] - v[298] * v[672] + v[297] * v[673] - v[253] * v[673] - v[296] * v[674] - v[294] * v[675] + v[259] * v[636] - v[258] * v[692] - v[257] * v[691]) - v[256] * v[634] - v[255] * v[690] - v[254] * v[689] - v[259] * v[705] - v[258] * v[707] - v[257] * v[709] + v[649] - v[256] * v[649] - v[255] * v[651] - v[254] * v[669];
+    v[649] = -v[591] - v[676];
+    v[651] = v[13] * v[649] - v[14] * v[615];
+    v[669] = v[14] * v[649] + v[13] * v[615];
+    v[670] = v[13] * v[617] - v[14] * v[613] + v[16] * v[649] + v[15] * v[615];
+    v[671] = v[14] * v[617] + v[13] * v[613] + v[17] * v[649] + v[16] * v[615];
+    v[672] = v[13] * v[706] - v[14] * v[677];
+    v[673] = v[14] * v[706] + v[13] * v[677];
+    v[674] = v[13] * v[624] - v[14] * v[679] + v[16] * v[706] + v[15] * v[677];
+    v[675] = v[14] * v[624] + v[13] * v[679] + v[17] * v[706] + v[16] * v[677];
+    v[705] = v[13] * v[710] - v[14] * v[685];
+    v[707] = v[14] * v[710] + v[13] * v[685];
+    v[709] = v[13] * v[663] - v[14] * v[687] + v[16] * v[710] + v[15] * v[685];
+    v[711] = v[14] * v[663] + v[13] * v[687] + v[17] * v[710] + v[16] * v[685];
+    v[712] = v[13] * v[572] - v[14] * v[689];
+    v[713] = v[14] * v[572] + v[13] * v[689];
+    v[714] = -(v[13] * v[636]) - v[14] * v[691] + v[16] * v[572] + v[15] * v[689];
+    v[715] = v[13] * v[691] - v[14] * v[636] + v[17] * v[572] + v[16] * v[689];
+    v[716] = v[13] * v[667] - v[14] * v[698];
+    v[717] = v[14] * v[667] + v[13] * v[698];
+    v[718] = v[13] * v[665] - v[14] * v[702] + v[16] * v[667] + v[15] * v[698];
+    v[719] = v[14] * v[665] + v[13] * v[702] + v[17] * v[667] + v[16] * v[698];
+    v[720] = v[13] * v[692] - v[14] * v[704];
+    v[721] = v[14] * v[692] + v[13] * v[704];
+    v[722] = v[13] * v[680] - v[14] * v[688] + v[16] * v[692] + v[15] * v[704];
+    v[723] = v[14] * v[680] + v[13] * v[688] + v[17] * v[692] + v[16] * v[704];
+    v[724] = v[13] * v[690] - v[14] * v[700];
+    v[725] = v[14] * v[690] + v[13] * v[700];
+    v[726] = v[13] * v[678] - v[14] * v[686] + v[16] * v[690] + v[15] * v[700];
+    v[727] = v[14] * v[678] + v[13] * v[686] + v[17] * v[690] + v[16] * v[700];
+    v[728] = v[614] / v[187];
+    v[729] = v[671] / v[187];
+    v[730] = v[670] / v[187];
+    v[731] = v[616] / v[187];
+    v[732] = v[669] / v[187];
+    v[733] = v[651] / v[187];
+    v[734] = v[566] + v[185] * v[728] + v[189] * v[729] + v[188] * v[730] + v[187] * v[731] + v[186] * v[732] + v[184] * v[733];
+    y[121] = v[734];
+    v[735] = v[13] * v[708] - v[14] * v[681] + v[70] * v[614];
+    v[736] = v[14] * v[708] + v[13] * v[681] - v[71] * v[614];
+    v[737] = v[13] * v[664] - v[14] * v[683] + v[16] * v[708] + v[15] * v[681] + v[72] * v[614];
+    v[738] = v[14] * v[664] + v[13] * v[683] + v[17] * v[708] + v[16] * v[681] - v[73] * v[614];
+    v[739] = v[14] * v[672] + v[13] * v[705] + v[17] * v[712] + v[16] * v[716] + v[70] * v[671];
+    v[740] = v[14] * v[673] + v[13] * v[707] + v[17] * v[713] + v[16] * v[717] - v[71] * v[671];
+    v[741] = v[14] * v[674] + v[13] * v[709] + v[17] * v[714] + v[16] * v[718] + v[72] * v[671];
+    v[742] = v[14] * v[675] + v[13] * v[711] + v[17] * v[715] + v[16] * v[719] - v[73] * v[671];
+    v[743] = v[13] * v[672] - v[14] * v[705] + v[16] * v[712] + v[15] * v[716] + v[70] * v[670];
+    v[744] = v[13] * v[673] - v[14] * v[707] + v[16] * v[713] + v[15] * v[717] - v[71] * v[670];
+    v[745] = v[13] * v[674] - v[14] * v[709] + v[16] * v[714] + v[15] * v[718] + v[72] * v[670];
+    v[746] = v[13] * v[675] - v[14] * v[711] + v[16] * v[715] + v[15] * v[719] - v[73] * v[670];
+    v[747] = v[13] * v[668] - v[14] * v[693] + v[70] * v[616];
+    v[748] = v[14] * v[668] + v[13] * v[693] - v[71] * v[616];
+    v[749] = v[13] * v[666] - v[14] * v[695] + v[16] * v[668] + v[15] * v[693] + v[72] * v[616];
+    v[750] = v[14] * v[666] + v[13] * v[695] + v[17] * v[668] + v[16] * v[693] - v[73] * v[616];
+    v[751] = v[14] * v[712] + v[13] * v[716] + v[70] * v[669];
+    v[752] = v[14] * v[713] + v[13] * v[717] - v[71] * v[669];
+    v[753] = v[14] * v[714] + v[13] * v[718] + v[72] * v[669];
+    v[754] = v[14] * v[715] + v[13] * v[719] - v[73] * v[669];
+    v[755] = v[202] * v[614] - v[567] + v[178] * v[671] + v[201] * v[670] + v[200] * v[616] + v[199] * v[669] + v[198] * v[651];
+    v[756] = v[13] * v[712] - v[14] * v[716] + v[70] * v[651];
+    v[757] = v[568] - v[207] * v[614] - v[146] * v[671] - v[206] * v[670] - v[205] * v[616] - v[204] * v[669] - v[203] * v[651];
+    v[758] = v[13] * v[713] - v[14] * v[717] - v[71] * v[651];
+    v[759] = v[217] * v[614] - v[569] + v[216] * v[671] + v[215] * v[670] + v[214] * v[616] + v[213] * v[669] + v[212] * v[651];
+    v[760] = v[13] * v[714] - v[14] * v[718] + v[72] * v[651];
+    v[761] = v[570] - v[183] * v[614] - v[132] * v[671] - v[182] * v[670] - v[181] * v[616] - v[180] * v[669] - v[179] * v[651];
+    v[762] = v[13] * v[715] - v[14] * v[719] - v[73] * v[651];
+    v[763] = (-(v[185] * v[684]) - v[189] * v[723] - v[188] * v[722] - v[187] * v[696] - v[186] * v[721] - v[184] * v[720]) / v[187];
+    v[764] = v[682] + (v[191] * v[728] - v[399] * v[566] - v[197] * v[684] - v[196] * v[738] - v[195] * v[737]) - v[194] * v[682] - v[193] * v[736] - v[192] * v[735] + v[763];
+    v[765] = (-(v[185] * v[738]) - v[189] * v[742] - v[188] * v[746] - v[187] * v[750] - v[186] * v[754] - v[184] * v[762]) / v[187];
+    v[766] = v[727] + (v[191] * v[729] - v[405] * v[566] - v[197] * v[723] - v[196] * v[742] - v[195] * v[741]) - v[194] * v[727] - v[193] * v[740] - v[192] * v[739] + v[765];
+    v[767] = (-(v[185] * v[737]) - v[189] * v[741] - v[188] * v[745] - v[187] * v[749] - v[186] * v[753] - v[184] * v[760]) / v[187];
+    v[768] = v[726] + (v[191] * v[730] - v[404] * v[566] - v[197] * v[722] - v[196] * v[746] - v[195] * v[745]) - v[194] * v[726] - v[193] * v[744] - v[192] * v[743] + v[767];
+    v[682] = (-(v[185] * v[682]) - v[189] * v[727] - v[188] * v[726] - v[187] * v[694] - v[186] * v[725] - v[184] * v[724]) / v[187];
+    v[726] = (-(v[185] * v[736]) - v[189] * v[740] - v[188] * v[744] - v[187] * v[748] - v[186] * v[752] - v[184] * v[758]) / v[187];
+    v[725] = v[725] + (v[191] * v[732] - v[403] * v[566] - v[197] * v[721] - v[196] * v[754] - v[195] * v[753]) - v[194] * v[725] - v[193] * v[752] - v[192] * v[751] + v[726];
+    v[727] = (-(v[185] * v[735]) - v[189] * v[739] - v[188] * v[743] - v[187] * v[747] - v[186] * v[751] - v[184] * v[756]) / v[187];
+    v[724] = v[724] + (v[191] * v[733] - v[402] * v[566] - v[197] * v[720] - v[196] * v[762] - v[195] * v[760]) - v[194] * v[724] - v[193] * v[758] - v[192] * v[756] + v[727];
+    v[566] = v[694] + (-(v[406] * v[566]) - v[397] * v[566] - v[229] * v[728] - v[228] * v[729] - v[226] * v[730] - v[225] * v[731] + v[191] * v[731] - v[224] * v[732] - v[222] * v[733] - v[197] * v[696] - v[196] * v[750] - v[195] * v[749]) - v[194] * v[694] - v[193] * v[748] - v[192] * v[747] - v[197] * v[763] - v[196] * v[765] - v[195] * v[767] + v[682] - v[194] * v[682] - v[193] * v[726] - v[192] * v[727];
+    v[682] = v[616] - v[734];
+    v[694] = v[18] * v[614] + v[19] * v[670] + v[20] * v[669];
+    v[726] = v[19] * v[614] - v[18] * v[670] + v[21] * v[669];
+    v[727] = v[18] * v[682] + v[19] * v[651];
+    v[728] = v[19] * v[682] - v[18] * v[651];
+    v[729] = 0.2155 * v[651] - v[671];
+    v[730] = v[18] * v[684] + v[19] * v[737] + v[20] * v[736];
+    v[731] = v[18] * v[722] + v[19] * v[745] + v[20] * v[744];
+    v[732] = v[18] * v[696] + v[19] * v[749] + v[20] * v[748];
+    v[733] = v[20] * v[752];
+    v[763] = v[18] * v[721] + v[19] * v[753] + v[733];
+    v[765] = v[18] * v[720] + v[19] * v[760] + v[20] * v[758];
+    v[767] = v[18] * v[764] + v[19] * v[735];
+    v[738] = 0.2155 * v[735] - v[738];
+    v[769] = v[18] * v[768] + v[19] * v[743];
+    v[746] = 0.2155 * v[743] - v[746];
+    v[770] = v[18] * v[566] + v[19] * v[747];
+    v[750] = 0.2155 * v[747] - v[750];
+    v[771] = v[18] * v[725] + v[19] * v[751];
+    v[754] = 0.2155 * v[751] - v[754];
+    v[772] = v[18] * v[724] + v[19] * v[756];
+    v[762] = 0.2155 * v[756] - v[762];
+    v[773] = v[18] * v[738] + v[19] * v[746] + v[20] * v[754];
+    v[774] = v[18] * v[750] + v[19] * v[762];
+    v[742] = v[742] + 0.2155 * (v[762] - v[739]);
+    v[733] = -(v[18] * v[736]) - v[19] * v[744] - v[733];
+    v[775] = -(v[18] * v[748]) - v[19] * v[758];
+    v[776] = v[740] - 0.2155 * v[758];
+    v[777] = v[729] / v[133];
+    v[778] = v[694] / v[133];
+    v[779] = v[669] / v[133];
+    v[780] = v[727] / v[133];
+    v[781] = v[130] * v[777] + v[134] * v[778] - v[133] * v[779] + v[129] * v[780];
+    y[122] = v[781];
+    v[782] = -(v[18] * v[766]) - v[19] * v[739] + 0.2155 * v[772] + v[86] * v[729];
+    v[783] = -(v[18] * v[723]) - v[19] * v[741] - v[20] * v[740] + 0.2155 * v[765] + v[88] * v[729];
+    v[784] = v[18] * v[767] + v[19] * v[769] + v[20] * v[771] + v[86] * v[694];
+    v[785] = v[18] * v[730] + v[19] * v[731] + v[20] * v[763] + v[88] * v[694];
+    v[786] = -v[771] - v[86] * v[669];
+    v[787] = -v[763] - v[88] * v[669];
+    v[788] = -(0.00072 * v[694]) - 0.0036 * v[728];
+    v[789] = v[128] * v[729] + -0.00072 * v[726] + v[127] * v[694] - v[143] * v[669] + v[142] * v[727];
+    v[790] = v[18] * v[770] + v[19] * v[772] + v[86] * v[727];
+    v[791] = v[150] * v[729] + v[149] * v[694] - v[148] * v[669] + 0.00072 * v[728] + v[147] * v[727];
+    v[792] = v[18] * v[732] + v[19] * v[765] + v[88] * v[727];
+    v[793] = -(2.1 * v[726]) - -0.00072 * v[727];
+    v[794] = v[742] + v[785];
+    v[795] = (-(v[130] * v[742]) - v[134] * v[773] + v[133] * v[754] - v[129] * v[774]) / v[133];
+    v[742] = v[776] + (v[137] * v[777] - v[141] * v[742] - v[140] * v[783]) - v[139] * v[776] - v[138] * v[782] + v[795];
+    v[796] = (-(v[130] * v[783]) - v[134] * v[785] - v[133] * v[787] - v[129] * v[792]) / v[133];
+    v[785] = v[733] + (v[137] * v[778] - v[141] * v[773] - v[140] * v[785]) - v[139] * v[733] - v[138] * v[784] + v[796];
+    v[733] = (-(v[130] * v[776]) - v[134] * v[733] - v[133] * v[752] - v[129] * v[775]) / v[133];
+    v[776] = (-(v[130] * v[782]) - v[134] * v[784] - v[133] * v[786] - v[129] * v[790]) / v[133];
+    v[775] = v[775] + (v[137] * v[780] - v[141] * v[774] - v[140] * v[792]) - v[139] * v[775] - v[138] * v[790] + v[776];
+    v[733] = v[752] + (-(v[156] * v[777]) - v[154] * v[778] + v[153] * v[779] - v[137] * v[779] - v[135] * v[780] + v[141] * v[754] - v[140] * v[787]) - v[139] * v[752] - v[138] * v[786] - v[141] * v[795] - v[140] * v[796] + v[733] - v[139] * v[733] - v[138] * v[776];
+    v[776] = -v[669] - v[781];
+    v[777] = v[22] * v[776] - v[23] * v[727];
+    v[778] = v[23] * v[776] + v[22] * v[727];
+    v[779] = v[22] * v[729] - v[23] * v[694] + v[25] * v[776] + v[24] * v[727];
+    v[780] = v[23] * v[729] + v[22] * v[694] + v[26] * v[776] + v[25] * v[727];
+    v[795] = v[783] - v[773];
+    v[773] = v[773] - v[783];
+    v[783] = v[782] - v[785];
+    v[796] = v[784] + v[742];
+    v[797] = v[22] * v[733] - v[23] * v[786];
+    v[798] = v[23] * v[733] + v[22] * v[786];
+    v[799] = -(v[22] * v[754]) - v[23] * v[787] + v[25] * v[733] + v[24] * v[786];
+    v[800] = v[22] * v[787] - v[23] * v[754] + v[26] * v[733] + v[25] * v[786];
+    v[801] = v[22] * v[775] - v[23] * v[790];
+    v[802] = v[23] * v[775] + v[22] * v[790];
+    v[803] = v[22] * v[774] - v[23] * v[792] + v[25] * v[775] + v[24] * v[790];
+    v[804] = v[23] * v[774] + v[22] * v[792] + v[26] * v[775] + v[25] * v[790];
+    v[805] = 0.001 * (v[728] / 0.001);
+    y[123] = v[805];
+    v[806] = -(0.006 * v[779]) - 0.001 * v[778];
+    v[807] = 0.3 * v[779] + 0.006 * v[778];
+    v[808] = -0.006 * v[780] + 0.001 * v[777];
+    v[809] = -(0.3 * v[780]) - -0.006 * v[777];
+    v[810] = v[728] - v[805];
+    v[811] = v[96] * v[810] - v[100] * v[777];
+    v[812] = v[100] * v[778] - v[97] * v[810];
+    v[813] = v[96] * v[726] - v[100] * v[779] - v[83] * v[777] + v[98] * v[810];
+    v[814] = v[100] * v[780] - v[97] * v[726] + v[83] * v[778] - v[99] * v[810];
+    v[815] = v[108] * v[780] - v[109] * v[779] - v[106] * v[777] + v[105] * v[778] + 0.001 * (v[97] * v[777] - v[96] * v[778]);
+    v[816] = v[109] * v[810] - v[110] * v[778] + 0.3 * v[814] + 0.006 * v[811] + x[13] * v[809];
+    v[817] = v[110] * v[777] - v[108] * v[810] + 0.3 * v[813] + -0.006 * v[812] + x[13] * v[807];
+    v[812] = v[109] * v[726] - v[110] * v[780] - v[107] * v[778] + v[106] * v[810] + -0.006 * v[813] + 0.001 * v[812] + x[13] * v[806];
+    v[810] = v[110] * v[779] - v[108] * v[726] + v[107] * v[777] - v[105] * v[810] + 0.006 * v[814] + 0.001 * v[811] + x[13] * v[808];
+    v[811] = v[81] * v[727] - v[80] * v[728];
+    v[813] = v[80] * v[776] - v[85] * v[727];
+    v[814] = v[85] * v[728] - v[81] * v[776];
+    v[818] = v[81] * v[694] - v[80] * v[726] + v[83] * v[727] - v[82] * v[728];
+    v[819] = v[80] * v[729] - v[85] * v[694] - v[84] * v[727] + v[82] * v[776];
+    v[820] = v[85] * v[726] - v[81] * v[729] + v[84] * v[728] - v[83] * v[776];
+    v[821] = v[26] * v[817] + v[25] * v[816] + v[23] * v[810] + v[22] * v[812] - v[94] * v[694] + v[93] * v[726] - v[91] * v[727] + v[90] * v[728] + -0.00108 * v[820] + 0.0047 * v[811];
+    v[822] = v[23] * v[817] + v[22] * v[816] - v[94] * v[727] + v[93] * v[728] + 1.8 * v[818] + 0.00108 * v[814];
+    v[811] = v[22] * v[817] - v[23] * v[816] - v[95] * v[728] + v[94] * v[776] + 1.8 * v[820] + -0.00108 * v[811] + 0.00072 * v[813] + x[12] * v[793];
+    v[777] = v[108] * v[778] - v[109] * v[777] + 0.3 * (v[97] * v[779] - v[96] * v[780] + v[99] * v[777] - v[98] * v[778]) + v[95] * v[727] - v[93] * v[776] + 1.8 * v[819] + -0.00072 * v[814] + x[12] * v[791];
+    v[726] = v[25] * v[817] + v[24] * v[816] + v[22] * v[810] - v[23] * v[812] - v[95] * v[726] + v[94] * v[729] - v[92] * v[728] + v[91] * v[776] + 0.00108 * v[818] + -0.00072 * v[819] + 0.0005 * v[814] + x[12] * v[788];
+    v[728] = v[815] + v[95] * v[694] - v[93] * v[729] + v[92] * v[727] - v[90] * v[776] + 0.00072 * v[820] + 0.0036 * v[813] + x[12] * v[789];
+    v[778] = v[66] * v[651] - v[65] * v[669];
+    v[779] = v[65] * v[682] - v[69] * v[651];
+    v[780] = v[69] * v[669] - v[66] * v[682];
+    v[813] = v[66] * v[670] - v[65] * v[671] + v[68] * v[651] - v[67] * v[669];
+    v[814] = v[65] * v[614] - v[69] * v[670] - v[52] * v[651] + v[67] * v[682];
+    v[818] = v[69] * v[671] - v[66] * v[614] + v[52] * v[669] - v[68] * v[682];
+    v[819] = v[19] * v[728] + v[18] * v[726] - v[78] * v[670] + v[77] * v[671] - v[75] * v[651] + v[74] * v[669] + 0.00017 * v[814] + -0.0357 * v[818] + 0.0058 * v[778] + -0.0027 * v[779];
+    v[820] = v[19] * v[811] - v[18] * v[777] - v[79] * v[669] + v[78] * v[682] + 1.7 * v[818] + -0.0357 * v[778] + 0.1292 * v[779] + x[11] * v[761];
+    v[823] = v[79] * v[651] - v[822] - v[77] * v[682] + 1.7 * v[814] + 0.00017 * v[778] + -0.1292 * v[780] + x[11] * v[759];
+    v[671] = 0.2155 * v[822] - v[18] * v[728] + v[19] * v[726] - v[79] * v[671] + v[78] * v[614] - v[76] * v[669] + v[75] * v[682] + 0.0357 * v[813] + -0.1292 * v[814] + 0.0306 * v[780] + x[11] * v[757];
+    v[778] = v[21] * v[777] - v[821] + v[20] * v[811] + v[79] * v[670] - v[77] * v[614] + v[76] * v[651] - v[74] * v[682] + -0.00017 * v[813] + 0.1292 * v[818] + -0.0027 * v[778] + 0.0279 * v[779] + x[11] * v[755];
+    v[814] = v[50] * v[615] - v[49] * v[616];
+    v[818] = v[49] * v[649] - v[54] * v[615];
+    v[822] = v[54] * v[616] - v[50] * v[649];
+    v[824] = v[50] * v[613] - v[49] * v[614] + v[52] * v[615] - v[51] * v[616];
+    v[825] = v[49] * v[617] - v[54] * v[613] - v[53] * v[615] + v[51] * v[649];
+    v[826] = v[54] * v[614] - v[50] * v[617] + v[53] * v[616] - v[52] * v[649];
+    v[827] = v[17] * v[823] + v[16] * v[820] + v[14] * v[778] + v[13] * v[671] - v[63] * v[613] + v[62] * v[614] - v[60] * v[615] + v[59] * v[616] + -0.1809 * v[826] + 0.0411 * v[814] + -0.0061 * v[818];
+    v[828] = v[14] * v[823] + v[13] * v[820] - v[63] * v[615] + v[62] * v[616] + 2.7 * v[824] + 0.1809 * v[822];
+    v[829] = v[13] * v[823] - v[14] * v[820] - v[64] * v[616] + v[63] * v[649] + 2.7 * v[826] + -0.1809 * v[814] + 0.0918 * v[818] + x[10] * v[703];
+    v[779] = v[19] * v[777] + v[18] * v[811] - v[78] * v[651] + v[77] * v[669] + 1.7 * v[813] + -0.00017 * v[779] + 0.0357 * v[780] + v[64] * v[615] - v[62] * v[649] + 2.7 * v[825] + -0.0918 * v[822] + x[10] * v[701];
+    v[616] = v[16] * v[823] + v[15] * v[820] + v[13] * v[778] - v[14] * v[671] - v[64] * v[614] + v[63] * v[617] - v[61] * v[616] + v[60] * v[649] + 0.1809 * v[824] + -0.0918 * v[825] + 0.0452 * v[822] + x[10] * v[699];
+    v[780] = v[819] + v[64] * v[613] - v[62] * v[617] + v[61] * v[615] - v[59] * v[649] + 0.0918 * v[826] + -0.0061 * v[814] + 0.0131 * v[818] + x[10] * v[697];
+    v[813] = v[35] * v[590] - v[34] * v[591];
+    v[814] = v[34] * v[594] - v[38] * v[590];
+    v[818] = v[38] * v[591] - v[35] * v[594];
+    v[822] = v[36] * v[594] - v[38] * v[599];
+    v[824] = v[38] * v[601] - v[37] * v[594];
+    v[825] = v[10] * v[780] + v[9] * v[616] - v[47] * v[599] + v[46] * v[601] - v[44] * v[590] + v[43] * v[591] + -0.09 * v[824] + 0.0127 * v[813] + -0.0117 * v[814];
+    v[826] = v[10] * v[829] - v[9] * v[779] - v[48] * v[591] + v[47] * v[594] + 3. * v[824] + -0.09 * v[813] + 0.39 * v[814] + x[9] * v[643];
+    v[830] = v[48] * v[590] - v[828] - v[46] * v[594] + 3. * v[822] + -0.39 * v[818] + x[9] * v[641];
+    v[601] = 0.2155 * v[828] - v[9] * v[780] + v[10] * v[616] - v[48] * v[601] - v[45] * v[591] + v[44] * v[594] + 0.09 * (v[35] * v[599] - v[34] * v[601] + v[37] * v[590] - v[36] * v[591]) + -0.39 * v[822] + 0.1334 * v[818] + x[9] * v[639];
+    v[813] = v[12] * v[779] - v[827] + v[11] * v[829] + v[48] * v[599] + v[45] * v[590] - v[43] * v[594] + 0.39 * v[824] + -0.0117 * v[813] + 0.1257 * v[814] + x[9] * v[637];
+    v[814] = v[7] * v[830] + v[6] * v[826] + v[4] * v[813] - v[5] * v[601] + v[33] * v[587] - v[32] * v[592] + 0.071 * (v[28] * v[592] - x[8] * v[587]) + x[8] * v[597];
+    v[818] = v[825] - v[33] * v[586] + v[31] * v[592] + 0.025 * (x[8] * v[586] - v[27] * v[592]) + x[8] * v[595];
+    y[109] = v[23] * (v[102] * v[729] + v[101] * v[694] + v[113] * v[776] + v[114] * v[727] - v[123] * v[754] + v[121] * v[774] + v[124] * v[795] + v[125] * v[794] + v[126] * v[787] + v[122] * v[792] + v[118] * v[742] + v[117] * v[785] + v[116] * v[733] + v[104] * v[775] + v[120] * v[782] - v[119] * v[784] + v[103] * v[786] + v[115] * v[790] + 0.3 * (v[23] * v[773] + v[22] * v[794] + v[26] * v[785] + v[24] * v[782] + v[25] * v[796]) + 0.006 * (v[23] * v[742] + v[22] * v[782] + v[803]) + -0.006 * (v[22] * v[785] - v[23] * v[784] + v[800]) + 0.001 * (v[797] + v[802]) + v[82] * v[817] + v[84] * v[816] + v[80] * v[810] + v[85] * v[812] + -0.081 * (v[101] * v[776] + v[124] * v[742] + v[125] * v[785] + v[126] * v[733] + v[122] * v[775] + 0.3 * v[800] + -0.006 * v[797] + v[85] * v[817]) + 0.081 * (v[102] * v[727] + v[125] * v[782] - v[124] * v[784] + v[123] * v[786] + v[121] * v[790] + 0.3 * v[803] + 0.006 * v[802] + v[80] * v[816])) - v[22] * (v[101] * v[729] - v[102] * v[694] + v[114] * v[776] - v[113] * v[727] - v[126] * v[754] + v[122] * v[774] + v[125] * v[773] + v[124] * v[794] - v[123] * v[787] - v[121] * v[792] + v[120] * v[742] - v[119] * v[785] + v[103] * v[733] + v[115] * v[775] - v[118] * v[782] - v[117] * v[784] - v[116] * v[786] - v[104] * v[790] + 0.3 * (v[22] * v[795] + v[23] * v[794] + v[26] * v[742] + v[25] * v[783] - v[24] * v[784]) + 0.006 * (-(v[23] * v[785]) - v[22] * v[784] + v[799]) + -0.006 * (v[22] * v[742] - v[23] * v[782] - v[804]) + 0.001 * (v[798] - v[801]) + v[84] * v[817] - v[82] * v[816] + v[85] * v[810] - v[80] * v[812] + 0.081 * (v[102] * v[776] + v[101] * v[727] + v[123] * v[733] + v[121] * v[775] + v[124] * v[783] + v[125] * v[796] + v[126] * v[786] + v[122] * v[790] + 0.3 * (v[799] + v[804]) + 0.006 * v[798] + -0.006 * v[801] + v[80] * v[817] + v[85] * v[816]));
+    y[108] = v[19] * (v[155] * v[614] - v[89] * v[670] + v[152] * v[682] - v[111] * v[651] + v[174] * v[684] - v[150] * v[723] + v[173] * v[722] + v[172] * v[696] + v[171] * v[721] + v[170] * v[720] - v[177] * v[737] + v[176] * v[745] - v[161] * v[749] - v[175] * v[753] - v[163] * v[760] + v[164] * v[764] - v[128] * v[766] + v[162] * v[768] + v[160] * v[566] + v[159] * v[725] + v[158] * v[724] - v[169] * v[735] - v[168] * v[743] - v[167] * v[747] - v[166] * v[751] + v[165] * v[756] + v[131] * v[738] + v[151] * v[750] + 2.1 * (v[18] * v[745] - v[19] * v[722] - v[21] * v[744]) + v[149] * v[730] + v[147] * v[732] - v[145] * v[736] - v[144] * v[748] + 0.00072 * (v[19] * v[764] - v[18] * v[735] - v[765]) + 0.0036 * (v[18] * v[756] - v[19] * v[724]) + v[127] * v[767] + -0.00072 * (v[19] * v[696] - v[18] * v[749] + v[21] * v[748] - v[769]) + v[142] * v[770] - v[67] * v[777] + v[52] * v[811] - v[65] * v[728] + v[69] * v[726] + -0.2155 * (v[89] * v[669] + v[177] * v[736] - v[176] * v[744] + v[161] * v[748] + v[175] * v[752] + v[163] * v[758] + 2.1 * (v[19] * v[721] - v[18] * v[753] + v[21] * v[752]) + -0.00072 * v[771] + v[66] * v[777])) - v[18] * (v[89] * v[614] + v[155] * v[670] + v[111] * v[682] + v[152] * v[651] + v[177] * v[684] - v[176] * v[722] + v[161] * v[696] + v[175] * v[721] + v[163] * v[720] + v[174] * v[737] - v[150] * v[741] + v[173] * v[745] + v[172] * v[749] + v[171] * v[753] + v[170] * v[760] + v[169] * v[764] + v[168] * v[768] + v[167] * v[566] + v[166] * v[725] - v[165] * v[724] + v[164] * v[735] - v[128] * v[739] + v[162] * v[743] + v[160] * v[747] + v[159] * v[751] + v[158] * v[756] + v[131] * v[746] + v[151] * v[762] + 2.1 * (v[19] * v[684] - v[18] * v[737] + v[21] * v[736]) + v[149] * v[731] + v[147] * v[765] - v[145] * v[744] - v[144] * v[758] + 0.00072 * (v[732] + (v[19] * v[768] - v[18] * v[743])) + 0.0036 * (v[19] * v[566] - v[18] * v[747]) + -0.00072 * (v[19] * v[720] - v[18] * v[760] + v[21] * v[758] + v[767]) + v[127] * v[769] + v[142] * v[772] + v[52] * v[777] + v[67] * v[811] + v[69] * v[728] + v[65] * v[726] + 0.2155 * (v[155] * v[669] + v[174] * v[736] - v[150] * v[740] + v[173] * v[744] + v[172] * v[748] + v[171] * v[752] + v[170] * v[758] + v[131] * v[754] + v[149] * v[763] - v[145] * v[752] + 0.00072 * (v[19] * v[725] - v[18] * v[751]) + v[127] * v[771] + v[66] * v[811]));
+    y[107] = v[14] * (-(v[398] * v[570]) - v[395] * v[569] - v[396] * v[568] - v[401] * v[567] + v[227] * v[617] + v[157] * v[613] + v[223] * v[649] + v[136] * v[615] + v[241] * v[624] + v[217] * v[664] + v[240] * v[663] - v[239] * v[636] + v[214] * v[666] + v[238] * v[665] + v[245] * v[679] + v[183] * v[683] + v[244] * v[687] + v[243] * v[691] + v[181] * v[695] + v[242] * v[702] + v[233] * v[706] + v[202] * v[708] + v[232] * v[710] + v[231] * v[572] + v[200] * v[668] + v[230] * v[667] + v[237] * v[677] + v[207] * v[681] + v[236] * v[685] + v[235] * v[689] + v[205] * v[693] + v[234] * v[698] + v[220] * v[680] + v[221] * v[688] + v[218] * v[692] + v[219] * v[704] + v[182] * v[675] + v[132] * v[711] + v[179] * v[715] + v[180] * v[719] + v[215] * v[674] + v[216] * v[709] + v[212] * v[714] + v[213] * v[718] + v[210] * v[678] + v[211] * v[686] + v[208] * v[690] + v[209] * v[700] + v[206] * v[673] + v[146] * v[707] + v[203] * v[713] + v[204] * v[717] + v[201] * v[672] + v[178] * v[705] + v[198] * v[712] + v[199] * v[716] + v[51] * v[823] + v[53] * v[820] + v[49] * v[778] + v[54] * v[671] + -0.1845 * (v[157] * v[649] - v[401] * v[570] + v[245] * v[706] + v[183] * v[708] + v[244] * v[710] + v[243] * v[572] + v[181] * v[668] + v[242] * v[667] + v[221] * v[692] + v[132] * v[715] + v[216] * v[714] + v[211] * v[690] + v[146] * v[713] + v[178] * v[712] + v[54] * v[823]) + 0.1845 * (v[227] * v[615] - v[396] * v[569] + v[241] * v[677] + v[217] * v[681] + v[240] * v[685] + v[239] * v[689] + v[214] * v[693] + v[238] * v[698] + v[220] * v[704] + v[182] * v[719] + v[215] * v[718] + v[210] * v[700] + v[206] * v[717] + v[201] * v[716] + v[49] * v[820])) - v[13] * (v[398] * v[569] - v[395] * v[570] - v[401] * v[568] + v[396] * v[567] + v[157] * v[617] - v[227] * v[613] + v[136] * v[649] - v[223] * v[615] + v[245] * v[624] + v[183] * v[664] + v[244] * v[663] - v[243] * v[636] + v[181] * v[666] + v[242] * v[665] - v[241] * v[679] - v[217] * v[683] - v[240] * v[687] - v[239] * v[691] - v[214] * v[695] - v[238] * v[702] + v[237] * v[706] + v[207] * v[708] + v[236] * v[710] + v[235] * v[572] + v[205] * v[668] + v[234] * v[667] - v[233] * v[677] - v[202] * v[681] - v[232] * v[685] - v[231] * v[689] - v[200] * v[693] - v[230] * v[698] + v[221] * v[680] - v[220] * v[688] + v[219] * v[692] - v[218] * v[704] + v[132] * v[675] - v[182] * v[711] + v[180] * v[715] - v[179] * v[719] + v[216] * v[674] - v[215] * v[709] + v[213] * v[714] - v[212] * v[718] + v[211] * v[678] - v[210] * v[686] + v[209] * v[690] - v[208] * v[700] + v[146] * v[673] - v[206] * v[707] + v[204] * v[713] - v[203] * v[717] + v[178] * v[672] - v[201] * v[705] + v[199] * v[712] - v[198] * v[716] + v[53] * v[823] - v[51] * v[820] + v[54] * v[778] - v[49] * v[671] + 0.1845 * (-(v[396] * v[570]) - v[401] * v[569] + v[227] * v[649] + v[157] * v[615] + v[241] * v[706] + v[217] * v[708] + v[240] * v[710] + v[239] * v[572] + v[214] * v[668] + v[238] * v[667] + v[245] * v[677] + v[183] * v[681] + v[244] * v[685] + v[243] * v[689] + v[181] * v[693] + v[242] * v[698] + v[220] * v[692] + v[221] * v[704] + v[182] * v[715] + v[132] * v[719] + v[215] * v[714] + v[216] * v[718] + v[210] * v[690] + v[211] * v[700] + v[206] * v[713] + v[146] * v[717] + v[201] * v[712] + v[178] * v[716] + v[49] * v[823] + v[54] * v[820]));
+    y[106] = v[10] * (-(v[391] * v[576]) - v[389] * v[574] + v[394] * v[573] - v[301] * v[599] + v[295] * v[594] - v[190] * v[590] + v[288] * v[623] - v[319] * v[627] - v[318] * v[631] - v[317] * v[635] - v[316] * v[642] - v[265] * v[646] + v[307] * v[648] + v[306] * v[579] + v[305] * v[612] + v[304] * v[611] + v[271] * v[621] - v[311] * v[625] - v[310] * v[629] - v[309] * v[633] - v[308] * v[638] - v[292] * v[628] + v[289] * v[632] - v[290] * v[644] - v[287] * v[619] + v[283] * v[647] - v[284] * v[654] - v[281] * v[618] + v[277] * v[645] - v[278] * v[653] + v[275] * v[626] - v[272] * v[630] + v[273] * v[640] - v[270] * v[656] + v[266] * v[658] - v[267] * v[662] - v[264] * v[655] + v[260] * v[657] - v[261] * v[661] - v[36] * v[779] - v[34] * v[780] + v[38] * v[616] + -0.2155 * (v[390] * v[576] + v[301] * v[591] - v[288] * v[622] + v[319] * v[626] + v[318] * v[630] + v[317] * v[634] + v[316] * v[640] + v[292] * v[636] + v[287] * v[652] + v[281] * v[650] - v[275] * v[634] + v[270] * v[660] + v[264] * v[659] + v[35] * v[779])) - v[9] * (v[391] * v[575] + v[394] * v[574] + v[389] * v[573] + v[299] * v[599] + v[190] * v[594] + v[295] * v[590] - v[282] * v[623] + v[315] * v[627] + v[314] * v[631] + v[313] * v[635] + v[312] * v[642] - v[271] * v[646] + v[311] * v[648] + v[310] * v[579] + v[309] * v[612] + v[308] * v[611] - v[265] * v[621] + v[307] * v[625] + v[306] * v[629] + v[305] * v[633] + v[304] * v[638] + v[291] * v[628] + v[290] * v[632] + v[289] * v[644] + v[286] * v[619] + v[284] * v[647] + v[283] * v[654] + v[280] * v[618] + v[278] * v[645] + v[277] * v[653] - v[274] * v[626] - v[273] * v[630] - v[272] * v[640] + v[269] * v[656] + v[267] * v[658] + v[266] * v[662] + v[263] * v[655] + v[261] * v[657] + v[260] * v[661] + v[36] * v[829] + v[38] * v[780] + v[34] * v[616] + 0.2155 * (v[390] * v[575] + v[299] * v[591] - v[282] * v[622] + v[315] * v[626] + v[314] * v[630] + v[313] * v[634] + v[312] * v[640] + v[291] * v[636] + v[286] * v[652] + v[280] * v[650] - v[274] * v[634] + v[269] * v[660] + v[263] * v[659] + v[35] * v[829]));
+    y[105] = v[5] * (v[386] * v[571] + v[388] * v[580] - v[355] * v[592] - v[252] * v[586] + v[362] * v[582] + v[339] * v[600] + v[361] * v[602] + v[343] * v[593] + v[363] * v[596] + v[321] * v[606] + v[322] * v[610] + v[349] * v[605] + v[350] * v[609] + v[346] * v[598] + v[341] * v[604] + v[342] * v[608] + v[337] * v[603] + v[338] * v[607] + v[27] * v[813] + x[8] * v[601] + -0.2045 * (v[388] * v[577] - v[303] * v[592] + v[368] * v[582] + v[323] * v[600] + v[367] * v[602] + v[293] * v[606] + v[353] * v[605] + v[276] * v[604] + v[320] * v[603] + x[8] * v[830]) + 0.2045 * (v[386] * v[581] - v[359] * v[586] + v[351] * v[593] + v[365] * v[596] + v[324] * v[610] + v[352] * v[609] + v[347] * v[598] + v[344] * v[608] + v[340] * v[607] + v[27] * v[826])) - v[4] * (v[388] * v[571] - v[386] * v[580] - v[252] * v[592] + v[355] * v[586] + v[364] * v[582] + v[343] * v[600] + v[363] * v[602] - v[339] * v[593] - v[361] * v[596] + v[322] * v[606] - v[321] * v[610] + v[350] * v[605] - v[349] * v[609] - v[345] * v[598] + v[342] * v[604] - v[341] * v[608] + v[338] * v[603] - v[337] * v[607] + x[8] * v[813] - v[27] * v[601] + 0.2045 * (v[386] * v[577] + v[388] * v[581] - v[359] * v[592] - v[303] * v[586] + v[366] * v[582] + v[351] * v[600] + v[365] * v[602] + v[323] * v[593] + v[367] * v[596] + v[324] * v[606] + v[293] * v[610] + v[352] * v[605] + v[353] * v[609] + v[348] * v[598] + v[344] * v[604] + v[276] * v[608] + v[340] * v[603] + v[320] * v[607] + v[27] * v[830] + x[8] * v[826]));
+    y[104] = v[3] * (v[385] * v[583] - v[380] * v[584] - v[382] * v[585] - v[377] * v[589] - v[375] * v[588] + x[7] * v[814]) - v[2] * (v[385] * v[578] - v[330] * v[584] - v[383] * v[585] - v[378] * v[589] - v[376] * v[588] + x[7] * v[818]);
+    y[116] = v[815] + (v[98] * v[809] + v[99] * v[807] + v[96] * v[806] + v[97] * v[808]) + -0.2 * v[805];
+    y[115] = v[821] + (v[82] * v[793] + v[83] * v[791] + v[80] * v[788] + v[81] * v[789]) + -0.5 * v[781];
+    y[114] = v[819] + (v[67] * v[761] + v[68] * v[759] + v[65] * v[757] + v[66] * v[755]) - v[734];
+    y[113] = v[827] + (v[51] * v[703] + v[52] * v[701] + v[49] * v[699] + v[50] * v[697]) + -0.3 * v[676];
+    y[112] = v[825] + (v[36] * v[643] + v[37] * v[641] + v[34] * v[639] + v[35] * v[637]) + -0.5 * v[620];
+    y[111] = v[8] * v[830] + v[7] * v[826] + v[5] * v[813] + v[4] * v[601] + v[32] * v[586] - v[31] * v[587] + 0.0579 * (v[27] * v[587] - v[28] * v[586]) + v[27] * v[597] + v[28] * v[595] + -0.5 * v[592];
+    y[110] = v[3] * v[818] + v[2] * v[814] + -0.5 * v[584];
+    v[566] = 1. / v[133];
+    v[567] = v[129] * v[566];
+    v[568] = v[134] * v[566];
+    v[569] = v[130] * v[566];
+    v[570] = v[18] * v[567];
+    v[571] = v[570] / v[187];
+    v[572] = -(0.2155 * v[569]) - v[19] * v[567] + v[184] * v[571];
+    v[573] = v[133] * v[566] - v[20] * v[568] + v[186] * v[571];
+    v[574] = v[188] * v[571] - v[19] * v[568];
+    v[569] = v[569] + v[189] * v[571];
+    v[575] = v[17] * v[569] + v[16] * v[574] + v[14] * v[573] + v[13] * v[572];
+    v[576] = v[575] / v[250];
+    v[577] = v[16] * v[569] + v[15] * v[574] + v[13] * v[573] - v[14] * v[572] - v[246] * v[576];
+    v[570] = v[187] * v[571] - v[570] - v[249] * v[576];
+    v[578] = v[13] * v[569] - v[14] * v[574] - v[251] * v[576];
+    v[579] = v[185] * v[571] - v[18] * v[568] - v[247] * v[576];
+    v[580] = v[14] * v[569] + v[13] * v[574] - v[248] * v[576];
+    v[581] = v[10] * v[570] + v[9] * v[577];
+    v[582] = v[581] / v[328];
+    v[583] = 0.2155 * v[580] - v[9] * v[570] + v[10] * v[577] - v[325] * v[582];
+    v[575] = v[250] * v[576] - v[575] + v[12] * v[579] + v[11] * v[578] - v[327] * v[582];
+    v[584] = v[10] * v[578] - v[9] * v[579] - v[329] * v[582];
+    v[580] = -v[580] - v[326] * v[582];
+    v[585] = (v[8] * v[580] + v[7] * v[584] + v[5] * v[575] + v[4] * v[583]) / v[371];
+    v[586] = v[7] * v[580] + v[6] * v[584] + v[4] * v[575] - v[5] * v[583] - v[369] * v[585];
+    v[581] = v[581] - v[328] * v[582] - v[370] * v[585];
+    v[587] = (v[3] * v[581] + v[2] * v[586]) / v[384];
+    y[137] = v[587];
+    v[588] = v[385] * v[587];
+    v[589] = v[2] * v[587];
+    v[590] = v[3] * v[587];
+    v[591] = v[2] * v[588];
+    v[592] = v[3] * v[588];
+    v[593] = v[590] / v[371];
+    v[594] = v[589] / v[371];
+    v[595] = v[585] - v[370] * v[593] - v[369] * v[594];
+    y[138] = v[595];
+    v[596] = -(v[3] * v[591]) - v[29] * v[590];
+    v[597] = v[30] * v[590] - v[3] * v[592];
+    v[598] = v[586] - v[376] * v[590] - v[375] * v[589];
+    v[599] = -(v[2] * v[591]) - v[29] * v[589];
+    v[600] = v[378] * v[590] - v[581] + v[377] * v[589];
+    v[601] = v[30] * v[589] - v[2] * v[592];
+    v[602] = (-(v[370] * v[597]) - v[369] * v[601]) / v[371];
+    v[603] = -(v[387] * v[585]) - v[372] * v[593] - v[374] * v[597] - v[373] * v[596] + v[602];
+    v[604] = (-(v[370] * v[596]) - v[369] * v[599]) / v[371];
+    v[605] = -(v[386] * v[585]) - v[372] * v[594] - v[374] * v[601] - v[373] * v[599] + v[604];
+    v[585] = v[381] * v[593] - v[388] * v[585] + v[379] * v[594] - v[374] * v[602] - v[373] * v[604];
+    v[593] = v[5] * v[589] - v[4] * v[595];
+    v[594] = -(v[5] * v[595]) - v[4] * v[589];
+    v[602] = -(v[7] * v[595]) - v[6] * v[589];
+    v[604] = -(v[8] * v[595]) - v[7] * v[589];
+    v[606] = v[4] * v[585];
+    v[607] = v[5] * v[585];
+    v[608] = v[7] * v[585];
+    v[609] = v[8] * v[585];
+    v[610] = v[4] * v[605] - v[5] * v[599];
+    v[611] = v[5] * v[605] + v[4] * v[599];
+    v[612] = v[7] * v[605] + v[6] * v[599];
+    v[613] = v[8] * v[605] + v[7] * v[599];
+    v[614] = v[5] * v[601];
+    v[615] = v[4] * v[601];
+    v[616] = v[6] * v[601];
+    v[617] = v[7] * v[601];
+    v[618] = v[604] / v[328];
+    v[619] = v[602] / v[328];
+    v[620] = v[590] / v[328];
+    v[621] = v[594] / v[328];
+    v[622] = v[593] / v[328];
+    v[623] = v[582] + v[326] * v[618] + v[329] * v[619] - v[328] * v[620] + v[327] * v[621] + v[325] * v[622];
+    y[139] = v[623];
+    v[624] = v[8] * v[606] + v[7] * v[610] + v[39] * v[604];
+    v[625] = v[8] * v[607] + v[7] * v[611] - v[40] * v[604];
+    v[626] = v[8] * v[608] + v[7] * v[612] + v[41] * v[604];
+    v[627] = v[8] * v[609] + v[7] * v[613] - v[42] * v[604];
+    v[628] = v[7] * v[606] + v[6] * v[610] + v[39] * v[602];
+    v[629] = v[7] * v[607] + v[6] * v[611] - v[40] * v[602];
+    v[630] = v[7] * v[608] + v[6] * v[612] + v[41] * v[602];
+    v[631] = v[7] * v[609] + v[6] * v[613] - v[42] * v[602];
+    v[632] = v[4] * v[603] - v[5] * v[596] - v[39] * v[590];
+    v[633] = v[5] * v[603] + v[4] * v[596] + v[40] * v[590];
+    v[634] = v[7] * v[603] + v[6] * v[596] - v[41] * v[590];
+    v[635] = v[8] * v[603] + v[7] * v[596] + v[42] * v[590];
+    v[636] = v[5] * v[606] + v[4] * v[610] + v[39] * v[594];
+    v[637] = v[5] * v[607] + v[4] * v[611] - v[40] * v[594];
+    v[638] = v[5] * v[608] + v[4] * v[612] + v[41] * v[594];
+    v[639] = v[5] * v[609] + v[4] * v[613] - v[42] * v[594];
+    v[640] = v[583] + v[320] * v[604] + v[340] * v[602] - v[339] * v[590] + v[338] * v[594] + v[337] * v[593];
+    v[641] = v[4] * v[606] - v[5] * v[610] + v[39] * v[593];
+    v[642] = -v[575] - v[276] * v[604] - v[344] * v[602] + v[343] * v[590] - v[342] * v[594] - v[341] * v[593];
+    v[643] = v[4] * v[607] - v[5] * v[611] - v[40] * v[593];
+    v[644] = v[584] + v[353] * v[604] + v[352] * v[602] - v[351] * v[590] + v[350] * v[594] + v[349] * v[593];
+    v[645] = v[4] * v[608] - v[5] * v[612] + v[41] * v[593];
+    v[646] = -v[580] - v[293] * v[604] - v[324] * v[602] + v[323] * v[590] - v[322] * v[594] - v[321] * v[593];
+    v[647] = v[4] * v[609] - v[5] * v[613] - v[42] * v[593];
+    v[648] = (-(v[326] * v[627]) - v[329] * v[631] - v[328] * v[635] - v[327] * v[639] - v[325] * v[647]) / v[328];
+    v[649] = v[617] + (v[331] * v[618] - v[392] * v[582] - v[336] * v[627] - v[335] * v[626]) - v[334] * v[617] - v[333] * v[625] - v[332] * v[624] + v[648];
+    v[650] = (-(v[326] * v[626]) - v[329] * v[630] - v[328] * v[634] - v[327] * v[638] - v[325] * v[645]) / v[328];
+    v[651] = v[616] + (v[331] * v[619] - v[391] * v[582] - v[336] * v[631] - v[335] * v[630]) - v[334] * v[616] - v[333] * v[629] - v[332] * v[628] + v[650];
+    v[616] = (-(v[326] * v[617]) - v[329] * v[616] - v[328] * v[597] - v[327] * v[615] + v[325] * v[614]) / v[328];
+    v[617] = (-(v[326] * v[625]) - v[329] * v[629] - v[328] * v[633] - v[327] * v[637] - v[325] * v[643]) / v[328];
+    v[615] = v[615] + (v[331] * v[621] - v[390] * v[582] - v[336] * v[639] - v[335] * v[638]) - v[334] * v[615] - v[333] * v[637] - v[332] * v[636] + v[617];
+    v[652] = (-(v[326] * v[624]) - v[329] * v[628] - v[328] * v[632] - v[327] * v[636] - v[325] * v[641]) / v[328];
+    v[614] = v[331] * v[622] - v[389] * v[582] - v[336] * v[647] - v[335] * v[645] - v[614] + v[334] * v[614] - v[333] * v[643] - v[332] * v[641] + v[652];
+    v[582] = v[597] + (-(v[393] * v[582]) - v[387] * v[582] - v[360] * v[618] - v[358] * v[619] + v[357] * v[620] - v[331] * v[620] - v[356] * v[621] - v[354] * v[622] - v[336] * v[635] - v[335] * v[634]) - v[334] * v[597] - v[333] * v[633] - v[332] * v[632] - v[336] * v[648] - v[335] * v[650] + v[616] - v[334] * v[616] - v[333] * v[617] - v[332] * v[652];
+    v[597] = -v[590] - v[623];
+    v[616] = v[10] * v[602] + v[11] * v[594];
+    v[617] = v[12] * v[594] - v[9] * v[602];
+    v[618] = v[9] * v[597] + v[10] * v[593];
+    v[619] = v[10] * v[597] - v[9] * v[593];
+    v[620] = 0.2155 * v[593] - v[604];
+    v[621] = v[10] * v[630] + v[11] * v[629];
+    v[622] = v[12] * v[629] - v[9] * v[630];
+    v[648] = v[10] * v[634] + v[11] * v[633];
+    v[650] = v[12] * v[633] - v[9] * v[634];
+    v[652] = v[11] * v[637];
+    v[653] = v[10] * v[638] + v[652];
+    v[654] = v[12] * v[637];
+    v[655] = v[654] - v[9] * v[638];
+    v[656] = v[10] * v[645] + v[11] * v[643];
+    v[657] = v[12] * v[643] - v[9] * v[645];
+    v[658] = v[9] * v[651] + v[10] * v[628];
+    v[659] = v[10] * v[651] - v[9] * v[628];
+    v[631] = 0.2155 * v[628] - v[631];
+    v[660] = v[9] * v[582] + v[10] * v[632];
+    v[661] = v[10] * v[582] - v[9] * v[632];
+    v[635] = 0.2155 * v[632] - v[635];
+    v[662] = v[9] * v[615] + v[10] * v[636];
+    v[663] = v[10] * v[615] - v[9] * v[636];
+    v[639] = 0.2155 * v[636] - v[639];
+    v[664] = v[9] * v[614] + v[10] * v[641];
+    v[665] = v[10] * v[614] - v[9] * v[641];
+    v[647] = 0.2155 * v[641] - v[647];
+    v[666] = v[10] * v[631] + v[11] * v[639];
+    v[667] = v[12] * v[639] - v[9] * v[631];
+    v[668] = v[9] * v[635] + v[10] * v[647];
+    v[669] = v[10] * v[635] - v[9] * v[647];
+    v[627] = v[627] + 0.2155 * (v[647] - v[624]);
+    v[652] = -(v[10] * v[629]) - v[652];
+    v[654] = v[9] * v[629] - v[654];
+    v[670] = -(v[9] * v[633]) - v[10] * v[643];
+    v[671] = v[9] * v[643] - v[10] * v[633];
+    v[672] = v[625] - 0.2155 * v[643];
+    v[673] = v[620] / v[250];
+    v[674] = v[617] / v[250];
+    v[675] = v[616] / v[250];
+    v[676] = v[594] / v[250];
+    v[677] = v[619] / v[250];
+    v[678] = v[618] / v[250];
+    v[679] = v[576] + v[248] * v[673] + v[247] * v[674] + v[251] * v[675] - v[250] * v[676] + v[249] * v[677] + v[246] * v[678];
+    y[140] = v[679];
+    v[680] = -(v[9] * v[649]) - v[10] * v[624] + 0.2155 * v[664] + v[55] * v[620];
+    v[681] = v[9] * v[624] - v[10] * v[649] + 0.2155 * v[665] - v[56] * v[620];
+    v[682] = -(v[10] * v[626]) - v[11] * v[625] + 0.2155 * v[656] + v[57] * v[620];
+    v[683] = v[9] * v[626] - v[12] * v[625] + 0.2155 * v[657] - v[58] * v[620];
+    v[684] = v[12] * v[662] - v[9] * v[658] + v[55] * v[617];
+    v[685] = v[12] * v[663] - v[9] * v[659] - v[56] * v[617];
+    v[686] = v[12] * v[653] - v[9] * v[621] + v[57] * v[617];
+    v[687] = v[12] * v[655] - v[9] * v[622] - v[58] * v[617];
+    v[688] = v[10] * v[658] + v[11] * v[662] + v[55] * v[616];
+    v[689] = v[10] * v[659] + v[11] * v[663] - v[56] * v[616];
+    v[690] = v[10] * v[621] + v[11] * v[653] + v[57] * v[616];
+    v[691] = v[10] * v[622] + v[11] * v[655] - v[58] * v[616];
+    v[692] = -v[662] - v[55] * v[594];
+    v[693] = v[56] * v[594] - v[663];
+    v[694] = -v[653] - v[57] * v[594];
+    v[695] = v[58] * v[594] - v[655];
+    v[696] = v[10] * v[660] - v[9] * v[664] + v[55] * v[619];
+    v[697] = v[10] * v[661] - v[9] * v[665] - v[56] * v[619];
+    v[698] = v[10] * v[648] - v[9] * v[656] + v[57] * v[619];
+    v[699] = v[10] * v[650] - v[9] * v[657] - v[58] * v[619];
+    v[700] = v[577] + v[265] * v[620] + v[264] * v[617] + v[263] * v[616] - v[262] * v[594] + v[261] * v[619] + v[260] * v[618];
+    v[701] = v[9] * v[660] + v[10] * v[664] + v[55] * v[618];
+    v[702] = -v[570] - v[271] * v[620] - v[270] * v[617] - v[269] * v[616] + v[268] * v[594] - v[267] * v[619] - v[266] * v[618];
+    v[703] = v[9] * v[661] + v[10] * v[665] - v[56] * v[618];
+    v[704] = v[578] + v[282] * v[620] + v[281] * v[617] + v[280] * v[616] - v[279] * v[594] + v[278] * v[619] + v[277] * v[618];
+    v[705] = v[9] * v[648] + v[10] * v[656] + v[57] * v[618];
+    v[706] = -v[579] - v[288] * v[620] - v[287] * v[617] - v[286] * v[616] + v[285] * v[594] - v[284] * v[619] - v[283] * v[618];
+    v[707] = v[9] * v[650] + v[10] * v[657] - v[58] * v[618];
+    v[708] = (-(v[248] * v[627]) - v[247] * v[667] - v[251] * v[666] + v[250] * v[639] - v[249] * v[669] - v[246] * v[668]) / v[250];
+    v[709] = v[672] + (v[253] * v[673] - v[395] * v[576] - v[259] * v[627] - v[258] * v[683] - v[257] * v[682]) - v[256] * v[672] - v[255] * v[681] - v[254] * v[680] + v[708];
+    v[710] = (-(v[248] * v[683]) - v[247] * v[687] - v[251] * v[691] - v[250] * v[695] - v[249] * v[699] - v[246] * v[707]) / v[250];
+    v[711] = v[654] + (v[253] * v[674] - v[399] * v[576] - v[259] * v[667] - v[258] * v[687] - v[257] * v[686]) - v[256] * v[654] - v[255] * v[685] - v[254] * v[684] + v[710];
+    v[712] = (-(v[248] * v[682]) - v[247] * v[686] - v[251] * v[690] - v[250] * v[694] - v[249] * v[698] - v[246] * v[705]) / v[250];
+    v[713] = v[652] + (v[253] * v[675] - v[398] * v[576] - v[259] * v[666] - v[258] * v[691] - v[257] * v[690]) - v[256] * v[652] - v[255] * v[689] - v[254] * v[688] + v[712];
+    v[652] = (-(v[248] * v[672]) - v[247] * v[654] - v[251] * v[652] - v[250] * v[637] - v[249] * v[671] - v[246] * v[670]) / v[250];
+    v[654] = (-(v[248] * v[681]) - v[247] * v[685] - v[251] * v[689] - v[250] * v[693] - v[249] * v[697] - v[246] * v[703]) / v[250];
+    v[671] = v[671] + (v[253] * v[677] - v[397] * v[576] - v[259] * v[669] - v[258] * v[699] - v[257] * v[698]) - v[256] * v[671] - v[255] * v[697] - v[254] * v[696] + v[654];
+    v[672] = (-(v[248] * v[680]) - v[247] * v[684] - v[251] * v[688] - v[250] * v[692] - v[249] * v[696] - v[246] * v[701]) / v[250];
+    v[670] = v[670] + (v[253] * v[678] - v[396] * v[576] - v[259] * v[668] - v[258] * v[707] - v[257] * v[705]) - v[256] * v[670] - v[255] * v[703] - v[254] * v[701] + v[672];
+    v[576] = v[637] + (v[390] * v[576] - v[400] * v[576] - v[302] * v[673] - v[300] * v[674] - v[298] * v[675] + v[297] * v[676] - v[253] * v[676] - v[296] * v[677] - v[294] * v[678] + v[259] * v[639] - v[258] * v[695] - v[257] * v[694]) - v[256] * v[637] - v[255] * v[693] - v[254] * v[692] - v[259] * v[708] - v[258] * v[710] - v[257] * v[712] + v[652] - v[256] * v[652] - v[255] * v[654] - v[254] * v[672];
+    v[652] = -v[594] - v[679];
+    v[654] = v[13] * v[652] - v[14] * v[618];
+    v[672] = v[14] * v[652] + v[13] * v[618];
+    v[673] = v[13] * v[620] - v[14] * v[616] + v[16] * v[652] + v[15] * v[618];
+    v[674] = v[14] * v[620] + v[13] * v[616] + v[17] * v[652] + v[16] * v[618];
+    v[675] = v[13] * v[709] - v[14] * v[680];
+    v[676] = v[14] * v[709] + v[13] * v[680];
+    v[677] = v[13] * v[627] - v[14] * v[682] + v[16] * v[709] + v[15] * v[680];
+    v[678] = v[14] * v[627] + v[13] * v[682] + v[17] * v[709] + v[16] * v[680];
+    v[708] = v[13] * v[713] - v[14] * v[688];
+    v[710] = v[14] * v[713] + v[13] * v[688];
+    v[712] = v[13] * v[666] - v[14] * v[690] + v[16] * v[713] + v[15] * v[688];
+    v[714] = v[14] * v[666] + v[13] * v[690] + v[17] * v[713] + v[16] * v[688];
+    v[715] = v[13] * v[576] - v[14] * v[692];
+    v[716] = v[14] * v[576] + v[13] * v[692];
+    v[717] = -(v[13] * v[639]) - v[14] * v[694] + v[16] * v[576] + v[15] * v[692];
+    v[718] = v[13] * v[694] - v[14] * v[639] + v[17] * v[576] + v[16] * v[692];
+    v[719] = v[13] * v[670] - v[14] * v[701];
+    v[720] = v[14] * v[670] + v[13] * v[701];
+    v[721] = v[13] * v[668] - v[14] * v[705] + v[16] * v[670] + v[15] * v[701];
+    v[722] = v[14] * v[668] + v[13] * v[705] + v[17] * v[670] + v[16] * v[701];
+    v[723] = v[13] * v[695] - v[14] * v[707];
+    v[724] = v[14] * v[695] + v[13] * v[707];
+    v[725] = v[13] * v[683] - v[14] * v[691] + v[16] * v[695] + v[15] * v[707];
+    v[726] = v[14] * v[683] + v[13] * v[691] + v[17] * v[695] + v[16] * v[707];
+    v[727] = v[13] * v[693] - v[14] * v[703];
+    v[728] = v[14] * v[693] + v[13] * v[703];
+    v[729] = v[13] * v[681] - v[14] * v[689] + v[16] * v[693] + v[15] * v[703];
+    v[730] = v[14] * v[681] + v[13] * v[689] + v[17] * v[693] + v[16] * v[703];
+    v[731] = v[617] / v[187];
+    v[732] = v[674] / v[187];
+    v[733] = v[673] / v[187];
+    v[734] = v[619] / v[187];
+    v[735] = v[672] / v[187];
+    v[736] = v[654] / v[187];
+    v[737] = v[185] * v[731] - v[571] + v[189] * v[732] + v[188] * v[733] + v[187] * v[734] + v[186] * v[735] + v[184] * v[736];
+    y[141] = v[737];
+    v[738] = v[13] * v[711] - v[14] * v[684] + v[70] * v[617];
+    v[739] = v[14] * v[711] + v[13] * v[684] - v[71] * v[617];
+    v[740] = v[13] * v[667] - v[14] * v[686] + v[16] * v[711] + v[15] * v[684] + v[72] * v[617];
+    v[741] = v[14] * v[667] + v[13] * v[686] + v[17] * v[711] + v[16] * v[684] - v[73] * v[617];
+    v[742] = v[14] * v[675] + v[13] * v[708] + v[17] * v[715] + v[16] * v[719] + v[70] * v[674];
+    v[743] = v[14] * v[676] + v[13] * v[710] + v[17] * v[716] + v[16] * v[720] - v[71] * v[674];
+    v[744] = v[14] * v[677] + v[13] * v[712] + v[17] * v[717] + v[16] * v[721] + v[72] * v[674];
+    v[745] = v[14] * v[678] + v[13] * v[714] + v[17] * v[718] + v[16] * v[722] - v[73] * v[674];
+    v[746] = v[13] * v[675] - v[14] * v[708] + v[16] * v[715] + v[15] * v[719] + v[70] * v[673];
+    v[747] = v[13] * v[676] - v[14] * v[710] + v[16] * v[716] + v[15] * v[720] - v[71] * v[673];
+    v[748] = v[13] * v[677] - v[14] * v[712] + v[16] * v[717] + v[15] * v[721] + v[72] * v[673];
+    v[749] = v[13] * v[678] - v[14] * v[714] + v[16] * v[718] + v[15] * v[722] - v[73] * v[673];
+    v[750] = v[13] * v[671] - v[14] * v[696] + v[70] * v[619];
+    v[751] = v[14] * v[671] + v[13] * v[696] - v[71] * v[619];
+    v[752] = v[13] * v[669] - v[14] * v[698] + v[16] * v[671] + v[15] * v[696] + v[72] * v[619];
+    v[753] = v[14] * v[669] + v[13] * v[698] + v[17] * v[671] + v[16] * v[696] - v[73] * v[619];
+    v[754] = v[14] * v[715] + v[13] * v[719] + v[70] * v[672];
+    v[755] = v[14] * v[716] + v[13] * v[720] - v[71] * v[672];
+    v[756] = v[14] * v[717] + v[13] * v[721] + v[72] * v[672];
+    v[757] = v[14] * v[718] + v[13] * v[722] - v[73] * v[672];
+    v[758] = v[572] + v[202] * v[617] + v[178] * v[674] + v[201] * v[673] + v[200] * v[619] + v[199] * v[672] + v[198] * v[654];
+    v[759] = v[13] * v[715] - v[14] * v[719] + v[70] * v[654];
+    v[760] = -v[573] - v[207] * v[617] - v[146] * v[674] - v[206] * v[673] - v[205] * v[619] - v[204] * v[672] - v[203] * v[654];
+    v[761] = v[13] * v[716] - v[14] * v[720] - v[71] * v[654];
+    v[762] = v[574] + v[217] * v[617] + v[216] * v[674] + v[215] * v[673] + v[214] * v[619] + v[213] * v[672] + v[212] * v[654];
+    v[763] = v[13] * v[717] - v[14] * v[721] + v[72] * v[654];
+    v[764] = -v[569] - v[183] * v[617] - v[132] * v[674] - v[182] * v[673] - v[181] * v[619] - v[180] * v[672] - v[179] * v[654];
+    v[765] = v[13] * v[718] - v[14] * v[722] - v[73] * v[654];
+    v[766] = (-(v[185] * v[687]) - v[189] * v[726] - v[188] * v[725] - v[187] * v[699] - v[186] * v[724] - v[184] * v[723]) / v[187];
+    v[767] = v[685] + (v[399] * v[571] + v[191] * v[731] - v[197] * v[687] - v[196] * v[741] - v[195] * v[740]) - v[194] * v[685] - v[193] * v[739] - v[192] * v[738] + v[766];
+    v[768] = (-(v[185] * v[741]) - v[189] * v[745] - v[188] * v[749] - v[187] * v[753] - v[186] * v[757] - v[184] * v[765]) / v[187];
+    v[769] = v[730] + (v[405] * v[571] + v[191] * v[732] - v[197] * v[726] - v[196] * v[745] - v[195] * v[744]) - v[194] * v[730] - v[193] * v[743] - v[192] * v[742] + v[768];
+    v[770] = (-(v[185] * v[740]) - v[189] * v[744] - v[188] * v[748] - v[187] * v[752] - v[186] * v[756] - v[184] * v[763]) / v[187];
+    v[771] = v[729] + (v[404] * v[571] + v[191] * v[733] - v[197] * v[725] - v[196] * v[749] - v[195] * v[748]) - v[194] * v[729] - v[193] * v[747] - v[192] * v[746] + v[770];
+    v[685] = (-(v[185] * v[685]) - v[189] * v[730] - v[188] * v[729] - v[187] * v[697] - v[186] * v[728] - v[184] * v[727]) / v[187];
+    v[729] = (-(v[185] * v[739]) - v[189] * v[743] - v[188] * v[747] - v[187] * v[751] - v[186] * v[755] - v[184] * v[761]) / v[187];
+    v[728] = v[728] + (v[403] * v[571] + v[191] * v[735] - v[197] * v[724] - v[196] * v[757] - v[195] * v[756]) - v[194] * v[728] - v[193] * v[755] - v[192] * v[754] + v[729];
+    v[730] = (-(v[185] * v[738]) - v[189] * v[742] - v[188] * v[746] - v[187] * v[750] - v[186] * v[754] - v[184] * v[759]) / v[187];
+    v[727] = v[727] + (v[402] * v[571] + v[191] * v[736] - v[197] * v[723] - v[196] * v[765] - v[195] * v[763]) - v[194] * v[727] - v[193] * v[761] - v[192] * v[759] + v[730];
+    v[571] = v[697] + (v[406] * v[571] + v[397] * v[571] - v[229] * v[731] - v[228] * v[732] - v[226] * v[733] - v[225] * v[734] + v[191] * v[734] - v[224] * v[735] - v[222] * v[736] - v[197] * v[699] - v[196] * v[753] - v[195] * v[752]) - v[194] * v[697] - v[193] * v[751] - v[192] * v[750] - v[197] * v[766] - v[196] * v[768] - v[195] * v[770] + v[685] - v[194] * v[685] - v[193] * v[729] - v[192] * v[730];
+    v[685] = v[619] - v[737];
+    v[697] = v[18] * v[617] + v[19] * v[673] + v[20] * v[672];
+    v[729] = v[19] * v[617] - v[18] * v[673] + v[21] * v[672];
+    v[730] = v[18] * v[685] + v[19] * v[654];
+    v[731] = v[19] * v[685] - v[18] * v[654];
+    v[732] = 0.2155 * v[654] - v[674];
+    v[733] = v[18] * v[687] + v[19] * v[740] + v[20] * v[739];
+    v[734] = v[18] * v[725] + v[19] * v[748] + v[20] * v[747];
+    v[735] = v[18] * v[699] + v[19] * v[752] + v[20] * v[751];
+    v[736] = v[20] * v[755];
+    v[766] = v[18] * v[724] + v[19] * v[756] + v[736];
+    v[768] = v[18] * v[723] + v[19] * v[763] + v[20] * v[761];
+    v[770] = v[18] * v[767] + v[19] * v[738];
+    v[741] = 0.2155 * v[738] - v[741];
+    v[772] = v[18] * v[771] + v[19] * v[746];
+    v[749] = 0.2155 * v[746] - v[749];
+    v[773] = v[18] * v[571] + v[19] * v[750];
+    v[753] = 0.2155 * v[750] - v[753];
+    v[774] = v[18] * v[728] + v[19] * v[754];
+    v[757] = 0.2155 * v[754] - v[757];
+    v[775] = v[18] * v[727] + v[19] * v[759];
+    v[765] = 0.2155 * v[759] - v[765];
+    v[776] = v[18] * v[741] + v[19] * v[749] + v[20] * v[757];
+    v[777] = v[18] * v[753] + v[19] * v[765];
+    v[745] = v[745] + 0.2155 * (v[765] - v[742]);
+    v[736] = -(v[18] * v[739]) - v[19] * v[747] - v[736];
+    v[778] = -(v[18] * v[751]) - v[19] * v[761];
+    v[779] = v[743] - 0.2155 * v[761];
+    v[780] = v[732] / v[133];
+    v[781] = v[697] / v[133];
+    v[782] = v[672] / v[133];
+    v[783] = v[730] / v[133];
+    v[784] = v[566] + v[130] * v[780] + v[134] * v[781] - v[133] * v[782] + v[129] * v[783];
+    y[142] = v[784];
+    v[785] = -(v[18] * v[769]) - v[19] * v[742] + 0.2155 * v[775] + v[86] * v[732];
+    v[786] = -(v[18] * v[726]) - v[19] * v[744] - v[20] * v[743] + 0.2155 * v[768] + v[88] * v[732];
+    v[787] = v[18] * v[770] + v[19] * v[772] + v[20] * v[774] + v[86] * v[697];
+    v[788] = v[18] * v[733] + v[19] * v[734] + v[20] * v[766] + v[88] * v[697];
+    v[789] = -v[774] - v[86] * v[672];
+    v[790] = -v[766] - v[88] * v[672];
+    v[791] = -(0.00072 * v[697]) - 0.0036 * v[731];
+    v[792] = v[128] * v[732] - v[567] + -0.00072 * v[729] + v[127] * v[697] - v[143] * v[672] + v[142] * v[730];
+    v[793] = v[18] * v[773] + v[19] * v[775] + v[86] * v[730];
+    v[794] = v[150] * v[732] - v[568] + v[149] * v[697] - v[148] * v[672] + 0.00072 * v[731] + v[147] * v[730];
+    v[795] = v[18] * v[735] + v[19] * v[768] + v[88] * v[730];
+    v[796] = -(2.1 * v[729]) - -0.00072 * v[730];
+    v[797] = v[745] + v[788];
+    v[798] = (-(v[130] * v[745]) - v[134] * v[776] + v[133] * v[757] - v[129] * v[777]) / v[133];
+    v[745] = v[779] + (v[137] * v[780] - v[408] * v[566] - v[141] * v[745] - v[140] * v[786]) - v[139] * v[779] - v[138] * v[785] + v[798];
+    v[799] = (-(v[130] * v[786]) - v[134] * v[788] - v[133] * v[790] - v[129] * v[795]) / v[133];
+    v[788] = v[736] + (v[137] * v[781] - v[410] * v[566] - v[141] * v[776] - v[140] * v[788]) - v[139] * v[736] - v[138] * v[787] + v[799];
+    v[736] = (-(v[130] * v[779]) - v[134] * v[736] - v[133] * v[755] - v[129] * v[778]) / v[133];
+    v[779] = (-(v[130] * v[785]) - v[134] * v[787] - v[133] * v[789] - v[129] * v[793]) / v[133];
+    v[778] = v[778] + (v[137] * v[783] - v[409] * v[566] - v[141] * v[777] - v[140] * v[795]) - v[139] * v[778] - v[138] * v[793] + v[779];
+    v[566] = v[755] + (v[403] * v[566] - v[411] * v[566] - v[156] * v[780] - v[154] * v[781] + v[153] * v[782] - v[137] * v[782] - v[135] * v[783] + v[141] * v[757] - v[140] * v[790]) - v[139] * v[755] - v[138] * v[789] - v[141] * v[798] - v[140] * v[799] + v[736] - v[139] * v[736] - v[138] * v[779];
+    v[736] = -v[672] - v[784];
+    v[779] = v[22] * v[736] - v[23] * v[730];
+    v[780] = v[23] * v[736] + v[22] * v[730];
+    v[781] = v[22] * v[732] - v[23] * v[697] + v[25] * v[736] + v[24] * v[730];
+    v[782] = v[23] * v[732] + v[22] * v[697] + v[26] * v[736] + v[25] * v[730];
+    v[783] = v[786] - v[776];
+    v[776] = v[776] - v[786];
+    v[786] = v[785] - v[788];
+    v[798] = v[787] + v[745];
+    v[799] = v[22] * v[566] - v[23] * v[789];
+    v[800] = v[23] * v[566] + v[22] * v[789];
+    v[801] = -(v[22] * v[757]) - v[23] * v[790] + v[25] * v[566] + v[24] * v[789];
+    v[802] = v[22] * v[790] - v[23] * v[757] + v[26] * v[566] + v[25] * v[789];
+    v[803] = v[22] * v[778] - v[23] * v[793];
+    v[804] = v[23] * v[778] + v[22] * v[793];
+    v[805] = v[22] * v[777] - v[23] * v[795] + v[25] * v[778] + v[24] * v[793];
+    v[806] = v[23] * v[777] + v[22] * v[795] + v[26] * v[778] + v[25] * v[793];
+    v[807] = 0.001 * (v[731] / 0.001);
+    y[143] = v[807];
+    v[808] = -(0.006 * v[781]) - 0.001 * v[780];
+    v[809] = 0.3 * v[781] + 0.006 * v[780];
+    v[810] = -0.006 * v[782] + 0.001 * v[779];
+    v[811] = -(0.3 * v[782]) - -0.006 * v[779];
+    v[812] = v[731] - v[807];
+    v[813] = v[96] * v[812] - v[100] * v[779];
+    v[814] = v[100] * v[780] - v[97] * v[812];
+    v[815] = v[96] * v[729] - v[100] * v[781] - v[83] * v[779] + v[98] * v[812];
+    v[816] = v[100] * v[782] - v[97] * v[729] + v[83] * v[780] - v[99] * v[812];
+    v[817] = v[108] * v[782] - v[109] * v[781] - v[106] * v[779] + v[105] * v[780] + 0.001 * (v[97] * v[779] - v[96] * v[780]);
+    v[818] = v[109] * v[812] - v[110] * v[780] + 0.3 * v[816] + 0.006 * v[813] + x[13] * v[811];
+    v[819] = v[110] * v[779] - v[108] * v[812] + 0.3 * v[815] + -0.006 * v[814] + x[13] * v[809];
+    v[814] = v[109] * v[729] - v[110] * v[782] - v[107] * v[780] + v[106] * v[812] + -0.006 * v[815] + 0.001 * v[814] + x[13] * v[808];
+    v[812] = v[110] * v[781] - v[108] * v[729] + v[107] * v[779] - v[105] * v[812] + 0.006 * v[816] + 0.001 * v[813] + x[13] * v[810];
+    v[813] = v[81] * v[730] - v[80] * v[731];
+    v[815] = v[80] * v[736] - v[85] * v[730];
+    v[816] = v[85] * v[731] - v[81] * v[736];
+    v[820] = v[81] * v[697] - v[80] * v[729] + v[83] * v[730] - v[82] * v[731];
+    v[821] = v[80] * v[732] - v[85] * v[697] - v[84] * v[730] + v[82] * v[736];
+    v[822] = v[85] * v[729] - v[81] * v[732] + v[84] * v[731] - v[83] * v[736];
+    v[823] = v[26] * v[819] + v[25] * v[818] + v[23] * v[812] + v[22] * v[814] - v[94] * v[697] + v[93] * v[729] - v[91] * v[730] + v[90] * v[731] + -0.00108 * v[822] + 0.0047 * v[813];
+    v[824] = v[23] * v[819] + v[22] * v[818] - v[94] * v[730] + v[93] * v[731] + 1.8 * v[820] + 0.00108 * v[816];
+    v[813] = v[22] * v[819] - v[23] * v[818] - v[95] * v[731] + v[94] * v[736] + 1.8 * v[822] + -0.00108 * v[813] + 0.00072 * v[815] + x[12] * v[796];
+    v[779] = v[108] * v[780] - v[109] * v[779] + 0.3 * (v[97] * v[781] - v[96] * v[782] + v[99] * v[779] - v[98] * v[780]) + v[95] * v[730] - v[93] * v[736] + 1.8 * v[821] + -0.00072 * v[816] + x[12] * v[794];
+    v[729] = v[25] * v[819] + v[24] * v[818] + v[22] * v[812] - v[23] * v[814] - v[95] * v[729] + v[94] * v[732] - v[92] * v[731] + v[91] * v[736] + 0.00108 * v[820] + -0.00072 * v[821] + 0.0005 * v[816] + x[12] * v[791];
+    v[731] = v[817] + v[95] * v[697] - v[93] * v[732] + v[92] * v[730] - v[90] * v[736] + 0.00072 * v[822] + 0.0036 * v[815] + x[12] * v[792];
+    v[780] = v[66] * v[654] - v[65] * v[672];
+    v[781] = v[65] * v[685] - v[69] * v[654];
+    v[782] = v[69] * v[672] - v[66] * v[685];
+    v[815] = v[66] * v[673] - v[65] * v[674] + v[68] * v[654] - v[67] * v[672];
+    v[816] = v[65] * v[617] - v[69] * v[673] - v[52] * v[654] + v[67] * v[685];
+    v[820] = v[69] * v[674] - v[66] * v[617] + v[52] * v[672] - v[68] * v[685];
+    v[821] = v[19] * v[731] + v[18] * v[729] - v[78] * v[673] + v[77] * v[674] - v[75] * v[654] + v[74] * v[672] + 0.00017 * v[816] + -0.0357 * v[820] + 0.0058 * v[780] + -0.0027 * v[781];
+    v[822] = v[19] * v[813] - v[18] * v[779] - v[79] * v[672] + v[78] * v[685] + 1.7 * v[820] + -0.0357 * v[780] + 0.1292 * v[781] + x[11] * v[764];
+    v[825] = v[79] * v[654] - v[824] - v[77] * v[685] + 1.7 * v[816] + 0.00017 * v[780] + -0.1292 * v[782] + x[11] * v[762];
+    v[674] = 0.2155 * v[824] - v[18] * v[731] + v[19] * v[729] - v[79] * v[674] + v[78] * v[617] - v[76] * v[672] + v[75] * v[685] + 0.0357 * v[815] + -0.1292 * v[816] + 0.0306 * v[782] + x[11] * v[760];
+    v[780] = v[21] * v[779] - v[823] + v[20] * v[813] + v[79] * v[673] - v[77] * v[617] + v[76] * v[654] - v[74] * v[685] + -0.00017 * v[815] + 0.1292 * v[820] + -0.0027 * v[780] + 0.0279 * v[781] + x[11] * v[758];
+    v[816] = v[50] * v[618] - v[49] * v[619];
+    v[820] = v[49] * v[652] - v[54] * v[618];
+    v[824] = v[54] * v[619] - v[50] * v[652];
+    v[826] = v[50] * v[616] - v[49] * v[617] + v[52] * v[618] - v[51] * v[619];
+    v[827] = v[49] * v[620] - v[54] * v[616] - v[53] * v[618] + v[51] * v[652];
+    v[828] = v[54] * v[617] - v[50] * v[620] + v[53] * v[619] - v[52] * v[652];
+    v[829] = v[17] * v[825] + v[16] * v[822] + v[14] * v[780] + v[13] * v[674] - v[63] * v[616] + v[62] * v[617] - v[60] * v[618] + v[59] * v[619] + -0.1809 * v[828] + 0.0411 * v[816] + -0.0061 * v[820];
+    v[830] = v[14] * v[825] + v[13] * v[822] - v[63] * v[618] + v[62] * v[619] + 2.7 * v[826] + 0.1809 * v[824];
+    v[831] = v[13] * v[825] - v[14] * v[822] - v[64] * v[619] + v[63] * v[652] + 2.7 * v[828] + -0.1809 * v[816] + 0.0918 * v[820] + x[10] * v[706];
+    v[781] = v[19] * v[779] + v[18] * v[813] - v[78] * v[654] + v[77] * v[672] + 1.7 * v[815] + -0.00017 * v[781] + 0.0357 * v[782] + v[64] * v[618] - v[62] * v[652] + 2.7 * v[827] + -0.0918 * v[824] + x[10] * v[704];
+    v[619] = v[16] * v[825] + v[15] * v[822] + v[13] * v[780] - v[14] * v[674] - v[64] * v[617] + v[63] * v[620] - v[61] * v[619] + v[60] * v[652] + 0.1809 * v[826] + -0.0918 * v[827] + 0.0452 * v[824] + x[10] * v[702];
+    v[782] = v[821] + v[64] * v[616] - v[62] * v[620] + v[61] * v[618] - v[59] * v[652] + 0.0918 * v[828] + -0.0061 * v[816] + 0.0131 * v[820] + x[10] * v[700];
+    v[815] = v[35] * v[593] - v[34] * v[594];
+    v[816] = v[34] * v[597] - v[38] * v[593];
+    v[820] = v[38] * v[594] - v[35] * v[597];
+    v[824] = v[36] * v[597] - v[38] * v[602];
+    v[826] = v[38] * v[604] - v[37] * v[597];
+    v[827] = v[10] * v[782] + v[9] * v[619] - v[47] * v[602] + v[46] * v[604] - v[44] * v[593] + v[43] * v[594] + -0.09 * v[826] + 0.0127 * v[815] + -0.0117 * v[816];
+    v[828] = v[10] * v[831] - v[9] * v[781] - v[48] * v[594] + v[47] * v[597] + 3. * v[826] + -0.09 * v[815] + 0.39 * v[816] + x[9] * v[646];
+    v[832] = v[48] * v[593] - v[830] - v[46] * v[597] + 3. * v[824] + -0.39 * v[820] + x[9] * v[644];
+    v[604] = 0.2155 * v[830] - v[9] * v[782] + v[10] * v[619] - v[48] * v[604] - v[45] * v[594] + v[44] * v[597] + 0.09 * (v[35] * v[602] - v[34] * v[604] + v[37] * v[593] - v[36] * v[594]) + -0.39 * v[824] + 0.1334 * v[820] + x[9] * v[642];
+    v[815] = v[12] * v[781] - v[829] + v[11] * v[831] + v[48] * v[602] + v[45] * v[593] - v[43] * v[597] + 0.39 * v[826] + -0.0117 * v[815] + 0.1257 * v[816] + x[9] * v[640];
+    v[816] = v[7] * v[832] + v[6] * v[828] + v[4] * v[815] - v[5] * v[604] + v[33] * v[590] - v[32] * v[595] + 0.071 * (v[28] * v[595] - x[8] * v[590]) + x[8] * v[600];
+    v[820] = v[827] - v[33] * v[589] + v[31] * v[595] + 0.025 * (x[8] * v[589] - v[27] * v[595]) + x[8] * v[598];
+    y[129] = v[23] * (v[102] * v[732] + v[101] * v[697] + v[113] * v[736] + v[114] * v[730] - v[123] * v[757] + v[121] * v[777] + v[124] * v[783] + v[125] * v[797] + v[126] * v[790] + v[122] * v[795] + v[118] * v[745] + v[117] * v[788] + v[116] * v[566] + v[104] * v[778] + v[120] * v[785] - v[119] * v[787] + v[103] * v[789] + v[115] * v[793] + 0.3 * (v[23] * v[776] + v[22] * v[797] + v[26] * v[788] + v[24] * v[785] + v[25] * v[798]) + 0.006 * (v[23] * v[745] + v[22] * v[785] + v[805]) + -0.006 * (v[22] * v[788] - v[23] * v[787] + v[802]) + 0.001 * (v[799] + v[804]) + v[82] * v[819] + v[84] * v[818] + v[80] * v[812] + v[85] * v[814] + -0.081 * (v[101] * v[736] + v[124] * v[745] + v[125] * v[788] + v[126] * v[566] + v[122] * v[778] + 0.3 * v[802] + -0.006 * v[799] + v[85] * v[819]) + 0.081 * (v[102] * v[730] + v[125] * v[785] - v[124] * v[787] + v[123] * v[789] + v[121] * v[793] + 0.3 * v[805] + 0.006 * v[804] + v[80] * v[818])) - v[22] * (v[101] * v[732] - v[102] * v[697] + v[114] * v[736] - v[113] * v[730] - v[126] * v[757] + v[122] * v[777] + v[125] * v[776] + v[124] * v[797] - v[123] * v[790] - v[121] * v[795] + v[120] * v[745] - v[119] * v[788] + v[103] * v[566] + v[115] * v[778] - v[118] * v[785] - v[117] * v[787] - v[116] * v[789] - v[104] * v[793] + 0.3 * (v[22] * v[783] + v[23] * v[797] + v[26] * v[745] + v[25] * v[786] - v[24] * v[787]) + 0.006 * (-(v[23] * v[788]) - v[22] * v[787] + v[801]) + -0.006 * (v[22] * v[745] - v[23] * v[785] - v[806]) + 0.001 * (v[800] - v[803]) + v[84] * v[819] - v[82] * v[818] + v[85] * v[812] - v[80] * v[814] + 0.081 * (v[102] * v[736] + v[101] * v[730] + v[123] * v[566] + v[121] * v[778] + v[124] * v[786] + v[125] * v[798] + v[126] * v[789] + v[122] * v[793] + 0.3 * (v[801] + v[806]) + 0.006 * v[800] + -0.006 * v[803] + v[80] * v[819] + v[85] * v[818]));
+    y[128] = v[19] * (-(v[399] * v[568]) - v[407] * v[567] + v[155] * v[617] - v[89] * v[673] + v[152] * v[685] - v[111] * v[654] + v[174] * v[687] - v[150] * v[726] + v[173] * v[725] + v[172] * v[699] + v[171] * v[724] + v[170] * v[723] - v[177] * v[740] + v[176] * v[748] - v[161] * v[752] - v[175] * v[756] - v[163] * v[763] + v[164] * v[767] - v[128] * v[769] + v[162] * v[771] + v[160] * v[571] + v[159] * v[728] + v[158] * v[727] - v[169] * v[738] - v[168] * v[746] - v[167] * v[750] - v[166] * v[754] + v[165] * v[759] + v[131] * v[741] + v[151] * v[753] + 2.1 * (v[18] * v[748] - v[19] * v[725] - v[21] * v[747]) + v[149] * v[733] + v[147] * v[735] - v[145] * v[739] - v[144] * v[751] + 0.00072 * (v[19] * v[767] - v[18] * v[738] - v[768]) + 0.0036 * (v[18] * v[759] - v[19] * v[727]) + v[127] * v[770] + -0.00072 * (v[19] * v[699] - v[18] * v[752] + v[21] * v[751] - v[772]) + v[142] * v[773] - v[67] * v[779] + v[52] * v[813] - v[65] * v[731] + v[69] * v[729] + -0.2155 * (v[89] * v[672] + v[177] * v[739] - v[176] * v[747] + v[161] * v[751] + v[175] * v[755] + v[163] * v[761] + 2.1 * (v[19] * v[724] - v[18] * v[756] + v[21] * v[755]) + -0.00072 * v[774] + v[66] * v[779])) - v[18] * (-(v[404] * v[568]) - v[402] * v[567] + v[89] * v[617] + v[155] * v[673] + v[111] * v[685] + v[152] * v[654] + v[177] * v[687] - v[176] * v[725] + v[161] * v[699] + v[175] * v[724] + v[163] * v[723] + v[174] * v[740] - v[150] * v[744] + v[173] * v[748] + v[172] * v[752] + v[171] * v[756] + v[170] * v[763] + v[169] * v[767] + v[168] * v[771] + v[167] * v[571] + v[166] * v[728] - v[165] * v[727] + v[164] * v[738] - v[128] * v[742] + v[162] * v[746] + v[160] * v[750] + v[159] * v[754] + v[158] * v[759] + v[131] * v[749] + v[151] * v[765] + 2.1 * (v[19] * v[687] - v[18] * v[740] + v[21] * v[739]) + v[149] * v[734] + v[147] * v[768] - v[145] * v[747] - v[144] * v[761] + 0.00072 * (v[735] + (v[19] * v[771] - v[18] * v[746])) + 0.0036 * (v[19] * v[571] - v[18] * v[750]) + -0.00072 * (v[19] * v[723] - v[18] * v[763] + v[21] * v[761] + v[770]) + v[127] * v[772] + v[142] * v[775] + v[52] * v[779] + v[67] * v[813] + v[69] * v[731] + v[65] * v[729] + 0.2155 * (v[155] * v[672] - v[403] * v[568] + v[174] * v[739] - v[150] * v[743] + v[173] * v[747] + v[172] * v[751] + v[171] * v[755] + v[170] * v[761] + v[131] * v[757] + v[149] * v[766] - v[145] * v[755] + 0.00072 * (v[19] * v[728] - v[18] * v[754]) + v[127] * v[774] + v[66] * v[813]));
+    y[127] = v[14] * (v[398] * v[569] + v[395] * v[574] + v[396] * v[573] + v[401] * v[572] + v[227] * v[620] + v[157] * v[616] + v[223] * v[652] + v[136] * v[618] + v[241] * v[627] + v[217] * v[667] + v[240] * v[666] - v[239] * v[639] + v[214] * v[669] + v[238] * v[668] + v[245] * v[682] + v[183] * v[686] + v[244] * v[690] + v[243] * v[694] + v[181] * v[698] + v[242] * v[705] + v[233] * v[709] + v[202] * v[711] + v[232] * v[713] + v[231] * v[576] + v[200] * v[671] + v[230] * v[670] + v[237] * v[680] + v[207] * v[684] + v[236] * v[688] + v[235] * v[692] + v[205] * v[696] + v[234] * v[701] + v[220] * v[683] + v[221] * v[691] + v[218] * v[695] + v[219] * v[707] + v[182] * v[678] + v[132] * v[714] + v[179] * v[718] + v[180] * v[722] + v[215] * v[677] + v[216] * v[712] + v[212] * v[717] + v[213] * v[721] + v[210] * v[681] + v[211] * v[689] + v[208] * v[693] + v[209] * v[703] + v[206] * v[676] + v[146] * v[710] + v[203] * v[716] + v[204] * v[720] + v[201] * v[675] + v[178] * v[708] + v[198] * v[715] + v[199] * v[719] + v[51] * v[825] + v[53] * v[822] + v[49] * v[780] + v[54] * v[674] + -0.1845 * (v[401] * v[569] + v[157] * v[652] + v[245] * v[709] + v[183] * v[711] + v[244] * v[713] + v[243] * v[576] + v[181] * v[671] + v[242] * v[670] + v[221] * v[695] + v[132] * v[718] + v[216] * v[717] + v[211] * v[693] + v[146] * v[716] + v[178] * v[715] + v[54] * v[825]) + 0.1845 * (v[396] * v[574] + v[227] * v[618] + v[241] * v[680] + v[217] * v[684] + v[240] * v[688] + v[239] * v[692] + v[214] * v[696] + v[238] * v[701] + v[220] * v[707] + v[182] * v[722] + v[215] * v[721] + v[210] * v[703] + v[206] * v[720] + v[201] * v[719] + v[49] * v[822])) - v[13] * (v[395] * v[569] - v[398] * v[574] + v[401] * v[573] - v[396] * v[572] + v[157] * v[620] - v[227] * v[616] + v[136] * v[652] - v[223] * v[618] + v[245] * v[627] + v[183] * v[667] + v[244] * v[666] - v[243] * v[639] + v[181] * v[669] + v[242] * v[668] - v[241] * v[682] - v[217] * v[686] - v[240] * v[690] - v[239] * v[694] - v[214] * v[698] - v[238] * v[705] + v[237] * v[709] + v[207] * v[711] + v[236] * v[713] + v[235] * v[576] + v[205] * v[671] + v[234] * v[670] - v[233] * v[680] - v[202] * v[684] - v[232] * v[688] - v[231] * v[692] - v[200] * v[696] - v[230] * v[701] + v[221] * v[683] - v[220] * v[691] + v[219] * v[695] - v[218] * v[707] + v[132] * v[678] - v[182] * v[714] + v[180] * v[718] - v[179] * v[722] + v[216] * v[677] - v[215] * v[712] + v[213] * v[717] - v[212] * v[721] + v[211] * v[681] - v[210] * v[689] + v[209] * v[693] - v[208] * v[703] + v[146] * v[676] - v[206] * v[710] + v[204] * v[716] - v[203] * v[720] + v[178] * v[675] - v[201] * v[708] + v[199] * v[715] - v[198] * v[719] + v[53] * v[825] - v[51] * v[822] + v[54] * v[780] - v[49] * v[674] + 0.1845 * (v[396] * v[569] + v[401] * v[574] + v[227] * v[652] + v[157] * v[618] + v[241] * v[709] + v[217] * v[711] + v[240] * v[713] + v[239] * v[576] + v[214] * v[671] + v[238] * v[670] + v[245] * v[680] + v[183] * v[684] + v[244] * v[688] + v[243] * v[692] + v[181] * v[696] + v[242] * v[701] + v[220] * v[695] + v[221] * v[707] + v[182] * v[718] + v[132] * v[722] + v[215] * v[717] + v[216] * v[721] + v[210] * v[693] + v[211] * v[703] + v[206] * v[716] + v[146] * v[720] + v[201] * v[715] + v[178] * v[719] + v[49] * v[825] + v[54] * v[822]));
+    y[126] = v[10] * (-(v[391] * v[579]) - v[389] * v[570] + v[394] * v[577] - v[301] * v[602] + v[295] * v[597] - v[190] * v[593] + v[288] * v[626] - v[319] * v[630] - v[318] * v[634] - v[317] * v[638] - v[316] * v[645] - v[265] * v[649] + v[307] * v[651] + v[306] * v[582] + v[305] * v[615] + v[304] * v[614] + v[271] * v[624] - v[311] * v[628] - v[310] * v[632] - v[309] * v[636] - v[308] * v[641] - v[292] * v[631] + v[289] * v[635] - v[290] * v[647] - v[287] * v[622] + v[283] * v[650] - v[284] * v[657] - v[281] * v[621] + v[277] * v[648] - v[278] * v[656] + v[275] * v[629] - v[272] * v[633] + v[273] * v[643] - v[270] * v[659] + v[266] * v[661] - v[267] * v[665] - v[264] * v[658] + v[260] * v[660] - v[261] * v[664] - v[36] * v[781] - v[34] * v[782] + v[38] * v[619] + -0.2155 * (v[390] * v[579] + v[301] * v[594] - v[288] * v[625] + v[319] * v[629] + v[318] * v[633] + v[317] * v[637] + v[316] * v[643] + v[292] * v[639] + v[287] * v[655] + v[281] * v[653] - v[275] * v[637] + v[270] * v[663] + v[264] * v[662] + v[35] * v[781])) - v[9] * (v[391] * v[578] + v[394] * v[570] + v[389] * v[577] + v[299] * v[602] + v[190] * v[597] + v[295] * v[593] - v[282] * v[626] + v[315] * v[630] + v[314] * v[634] + v[313] * v[638] + v[312] * v[645] - v[271] * v[649] + v[311] * v[651] + v[310] * v[582] + v[309] * v[615] + v[308] * v[614] - v[265] * v[624] + v[307] * v[628] + v[306] * v[632] + v[305] * v[636] + v[304] * v[641] + v[291] * v[631] + v[290] * v[635] + v[289] * v[647] + v[286] * v[622] + v[284] * v[650] + v[283] * v[657] + v[280] * v[621] + v[278] * v[648] + v[277] * v[656] - v[274] * v[629] - v[273] * v[633] - v[272] * v[643] + v[269] * v[659] + v[267] * v[661] + v[266] * v[665] + v[263] * v[658] + v[261] * v[660] + v[260] * v[664] + v[36] * v[831] + v[38] * v[782] + v[34] * v[619] + 0.2155 * (v[390] * v[578] + v[299] * v[594] - v[282] * v[625] + v[315] * v[629] + v[314] * v[633] + v[313] * v[637] + v[312] * v[643] + v[291] * v[639] + v[286] * v[655] + v[280] * v[653] - v[274] * v[637] + v[269] * v[663] + v[263] * v[662] + v[35] * v[831]));
+    y[125] = v[5] * (v[386] * v[575] + v[388] * v[583] - v[355] * v[595] - v[252] * v[589] + v[362] * v[585] + v[339] * v[603] + v[361] * v[605] + v[343] * v[596] + v[363] * v[599] + v[321] * v[609] + v[322] * v[613] + v[349] * v[608] + v[350] * v[612] + v[346] * v[601] + v[341] * v[607] + v[342] * v[611] + v[337] * v[606] + v[338] * v[610] + v[27] * v[815] + x[8] * v[604] + -0.2045 * (v[388] * v[580] - v[303] * v[595] + v[368] * v[585] + v[323] * v[603] + v[367] * v[605] + v[293] * v[609] + v[353] * v[608] + v[276] * v[607] + v[320] * v[606] + x[8] * v[832]) + 0.2045 * (v[386] * v[584] - v[359] * v[589] + v[351] * v[596] + v[365] * v[599] + v[324] * v[613] + v[352] * v[612] + v[347] * v[601] + v[344] * v[611] + v[340] * v[610] + v[27] * v[828])) - v[4] * (v[388] * v[575] - v[386] * v[583] - v[252] * v[595] + v[355] * v[589] + v[364] * v[585] + v[343] * v[603] + v[363] * v[605] - v[339] * v[596] - v[361] * v[599] + v[322] * v[609] - v[321] * v[613] + v[350] * v[608] - v[349] * v[612] - v[345] * v[601] + v[342] * v[607] - v[341] * v[611] + v[338] * v[606] - v[337] * v[610] + x[8] * v[815] - v[27] * v[604] + 0.2045 * (v[386] * v[580] + v[388] * v[584] - v[359] * v[595] - v[303] * v[589] + v[366] * v[585] + v[351] * v[603] + v[365] * v[605] + v[323] * v[596] + v[367] * v[599] + v[324] * v[609] + v[293] * v[613] + v[352] * v[608] + v[353] * v[612] + v[348] * v[601] + v[344] * v[607] + v[276] * v[611] + v[340] * v[606] + v[320] * v[610] + v[27] * v[832] + x[8] * v[828]));
+    y[124] = v[3] * (v[385] * v[586] - v[380] * v[587] - v[382] * v[588] - v[377] * v[592] - v[375] * v[591] + x[7] * v[816]) - v[2] * (v[385] * v[581] - v[330] * v[587] - v[383] * v[588] - v[378] * v[592] - v[376] * v[591] + x[7] * v[820]);
+    y[136] = v[817] + (v[98] * v[811] + v[99] * v[809] + v[96] * v[808] + v[97] * v[810]) + -0.2 * v[807];
+    y[135] = v[823] + (v[82] * v[796] + v[83] * v[794] + v[80] * v[791] + v[81] * v[792]) + -0.5 * v[784];
+    y[134] = v[821] + (v[67] * v[764] + v[68] * v[762] + v[65] * v[760] + v[66] * v[758]) - v[737];
+    y[133] = v[829] + (v[51] * v[706] + v[52] * v[704] + v[49] * v[702] + v[50] * v[700]) + -0.3 * v[679];
+    y[132] = v[827] + (v[36] * v[646] + v[37] * v[644] + v[34] * v[642] + v[35] * v[640]) + -0.5 * v[623];
+    y[131] = v[8] * v[832] + v[7] * v[828] + v[5] * v[815] + v[4] * v[604] + v[32] * v[589] - v[31] * v[590] + 0.0579 * (v[27] * v[590] - v[28] * v[589]) + v[27] * v[600] + v[28] * v[598] + -0.5 * v[595];
+    y[130] = v[3] * v[820] + v[2] * v[816] + -0.5 * v[587];
+    v[566] = v[19] / v[187];
+    v[567] = v[18] + v[184] * v[566];
+    v[568] = v[186] * v[566];
+    v[569] = v[188] * v[566];
+    v[570] = v[189] * v[566];
+    v[571] = v[17] * v[570] + v[16] * v[569] + v[14] * v[568] + v[13] * v[567];
+    v[572] = v[571] / v[250];
+    v[573] = v[16] * v[570] + v[15] * v[569] + v[13] * v[568] - v[14] * v[567] - v[246] * v[572];
+    v[574] = v[187] * v[566] - v[19] - v[249] * v[572];
+    v[575] = v[13] * v[570] - v[14] * v[569] - v[251] * v[572];
+    v[576] = v[185] * v[566] - v[247] * v[572];
+    v[577] = v[14] * v[570] + v[13] * v[569] - v[248] * v[572];
+    v[578] = v[10] * v[574] + v[9] * v[573];
+    v[579] = v[578] / v[328];
+    v[580] = 0.2155 * v[577] - v[9] * v[574] + v[10] * v[573] - v[325] * v[579];
+    v[571] = v[250] * v[572] - v[571] + v[12] * v[576] + v[11] * v[575] - v[327] * v[579];
+    v[581] = v[10] * v[575] - v[9] * v[576] - v[329] * v[579];
+    v[577] = -v[577] - v[326] * v[579];
+    v[582] = (v[8] * v[577] + v[7] * v[581] + v[5] * v[571] + v[4] * v[580]) / v[371];
+    v[583] = v[7] * v[577] + v[6] * v[581] + v[4] * v[571] - v[5] * v[580] - v[369] * v[582];
+    v[578] = v[578] - v[328] * v[579] - v[370] * v[582];
+    v[584] = (v[3] * v[578] + v[2] * v[583]) / v[384];
+    y[157] = v[584];
+    v[585] = v[385] * v[584];
+    v[586] = v[2] * v[584];
+    v[587] = v[3] * v[584];
+    v[588] = v[2] * v[585];
+    v[589] = v[3] * v[585];
+    v[590] = v[587] / v[371];
+    v[591] = v[586] / v[371];
+    v[592] = v[582] - v[370] * v[590] - v[369] * v[591];
+    y[158] = v[592];
+    v[593] = -(v[3] * v[588]) - v[29] * v[587];
+    v[594] = v[30] * v[587] - v[3] * v[589];
+    v[595] = v[583] - v[376] * v[587] - v[375] * v[586];
+    v[596] = -(v[2] * v[588]) - v[29] * v[586];
+    v[597] = v[378] * v[587] - v[578] + v[377] * v[586];
+    v[598] = v[30] * v[586] - v[2] * v[589];
+    v[599] = (-(v[370] * v[594]) - v[369] * v[598]) / v[371];
+    v[600] = -(v[387] * v[582]) - v[372] * v[590] - v[374] * v[594] - v[373] * v[593] + v[599];
+    v[601] = (-(v[370] * v[593]) - v[369] * v[596]) / v[371];
+    v[602] = -(v[386] * v[582]) - v[372] * v[591] - v[374] * v[598] - v[373] * v[596] + v[601];
+    v[582] = v[381] * v[590] - v[388] * v[582] + v[379] * v[591] - v[374] * v[599] - v[373] * v[601];
+    v[590] = v[5] * v[586] - v[4] * v[592];
+    v[591] = -(v[5] * v[592]) - v[4] * v[586];
+    v[599] = -(v[7] * v[592]) - v[6] * v[586];
+    v[601] = -(v[8] * v[592]) - v[7] * v[586];
+    v[603] = v[4] * v[582];
+    v[604] = v[5] * v[582];
+    v[605] = v[7] * v[582];
+    v[606] = v[8] * v[582];
+    v[607] = v[4] * v[602] - v[5] * v[596];
+    v[608] = v[5] * v[602] + v[4] * v[596];
+    v[609] = v[7] * v[602] + v[6] * v[596];
+    v[610] = v[8] * v[602] + v[7] * v[596];
+    v[611] = v[5] * v[598];
+    v[612] = v[4] * v[598];
+    v[613] = v[6] * v[598];
+    v[614] = v[7] * v[598];
+    v[615] = v[601] / v[328];
+    v[616] = v[599] / v[328];
+    v[617] = v[587] / v[328];
+    v[618] = v[591] / v[328];
+    v[619] = v[590] / v[328];
+    v[620] = v[579] + v[326] * v[615] + v[329] * v[616] - v[328] * v[617] + v[327] * v[618] + v[325] * v[619];
+    y[159] = v[620];
+    v[621] = v[8] * v[603] + v[7] * v[607] + v[39] * v[601];
+    v[622] = v[8] * v[604] + v[7] * v[608] - v[40] * v[601];
+    v[623] = v[8] * v[605] + v[7] * v[609] + v[41] * v[601];
+    v[624] = v[8] * v[606] + v[7] * v[610] - v[42] * v[601];
+    v[625] = v[7] * v[603] + v[6] * v[607] + v[39] * v[599];
+    v[626] = v[7] * v[604] + v[6] * v[608] - v[40] * v[599];
+    v[627] = v[7] * v[605] + v[6] * v[609] + v[41] * v[599];
+    v[628] = v[7] * v[606] + v[6] * v[610] - v[42] * v[599];
+    v[629] = v[4] * v[600] - v[5] * v[593] - v[39] * v[587];
+    v[630] = v[5] * v[600] + v[4] * v[593] + v[40] * v[587];
+    v[631] = v[7] * v[600] + v[6] * v[593] - v[41] * v[587];
+    v[632] = v[8] * v[600] + v[7] * v[593] + v[42] * v[587];
+    v[633] = v[5] * v[603] + v[4] * v[607] + v[39] * v[591];
+    v[634] = v[5] * v[604] + v[4] * v[608] - v[40] * v[591];
+    v[635] = v[5] * v[605] + v[4] * v[609] + v[41] * v[591];
+    v[636] = v[5] * v[606] + v[4] * v[610] - v[42] * v[591];
+    v[637] = v[580] + v[320] * v[601] + v[340] * v[599] - v[339] * v[587] + v[338] * v[591] + v[337] * v[590];
+    v[638] = v[4] * v[603] - v[5] * v[607] + v[39] * v[590];
+    v[639] = -v[571] - v[276] * v[601] - v[344] * v[599] + v[343] * v[587] - v[342] * v[591] - v[341] * v[590];
+    v[640] = v[4] * v[604] - v[5] * v[608] - v[40] * v[590];
+    v[641] = v[581] + v[353] * v[601] + v[352] * v[599] - v[351] * v[587] + v[350] * v[591] + v[349] * v[590];
+    v[642] = v[4] * v[605] - v[5] * v[609] + v[41] * v[590];
+    v[643] = -v[577] - v[293] * v[601] - v[324] * v[599] + v[323] * v[587] - v[322] * v[591] - v[321] * v[590];
+    v[644] = v[4] * v[606] - v[5] * v[610] - v[42] * v[590];
+    v[645] = (-(v[326] * v[624]) - v[329] * v[628] - v[328] * v[632] - v[327] * v[636] - v[325] * v[644]) / v[328];
+    v[646] = v[614] + (v[331] * v[615] - v[392] * v[579] - v[336] * v[624] - v[335] * v[623]) - v[334] * v[614] - v[333] * v[622] - v[332] * v[621] + v[645];
+    v[647] = (-(v[326] * v[623]) - v[329] * v[627] - v[328] * v[631] - v[327] * v[635] - v[325] * v[642]) / v[328];
+    v[648] = v[613] + (v[331] * v[616] - v[391] * v[579] - v[336] * v[628] - v[335] * v[627]) - v[334] * v[613] - v[333] * v[626] - v[332] * v[625] + v[647];
+    v[613] = (-(v[326] * v[614]) - v[329] * v[613] - v[328] * v[594] - v[327] * v[612] + v[325] * v[611]) / v[328];
+    v[614] = (-(v[326] * v[622]) - v[329] * v[626] - v[328] * v[630] - v[327] * v[634] - v[325] * v[640]) / v[328];
+    v[612] = v[612] + (v[331] * v[618] - v[390] * v[579] - v[336] * v[636] - v[335] * v[635]) - v[334] * v[612] - v[333] * v[634] - v[332] * v[633] + v[614];
+    v[649] = (-(v[326] * v[621]) - v[329] * v[625] - v[328] * v[629] - v[327] * v[633] - v[325] * v[638]) / v[328];
+    v[611] = v[331] * v[619] - v[389] * v[579] - v[336] * v[644] - v[335] * v[642] - v[611] + v[334] * v[611] - v[333] * v[640] - v[332] * v[638] + v[649];
+    v[579] = v[594] + (-(v[393] * v[579]) - v[387] * v[579] - v[360] * v[615] - v[358] * v[616] + v[357] * v[617] - v[331] * v[617] - v[356] * v[618] - v[354] * v[619] - v[336] * v[632] - v[335] * v[631]) - v[334] * v[594] - v[333] * v[630] - v[332] * v[629] - v[336] * v[645] - v[335] * v[647] + v[613] - v[334] * v[613] - v[333] * v[614] - v[332] * v[649];
+    v[594] = -v[587] - v[620];
+    v[613] = v[10] * v[599] + v[11] * v[591];
+    v[614] = v[12] * v[591] - v[9] * v[599];
+    v[615] = v[9] * v[594] + v[10] * v[590];
+    v[616] = v[10] * v[594] - v[9] * v[590];
+    v[617] = 0.2155 * v[590] - v[601];
+    v[618] = v[10] * v[627] + v[11] * v[626];
+    v[619] = v[12] * v[626] - v[9] * v[627];
+    v[645] = v[10] * v[631] + v[11] * v[630];
+    v[647] = v[12] * v[630] - v[9] * v[631];
+    v[649] = v[11] * v[634];
+    v[650] = v[10] * v[635] + v[649];
+    v[651] = v[12] * v[634];
+    v[652] = v[651] - v[9] * v[635];
+    v[653] = v[10] * v[642] + v[11] * v[640];
+    v[654] = v[12] * v[640] - v[9] * v[642];
+    v[655] = v[9] * v[648] + v[10] * v[625];
+    v[656] = v[10] * v[648] - v[9] * v[625];
+    v[628] = 0.2155 * v[625] - v[628];
+    v[657] = v[9] * v[579] + v[10] * v[629];
+    v[658] = v[10] * v[579] - v[9] * v[629];
+    v[632] = 0.2155 * v[629] - v[632];
+    v[659] = v[9] * v[612] + v[10] * v[633];
+    v[660] = v[10] * v[612] - v[9] * v[633];
+    v[636] = 0.2155 * v[633] - v[636];
+    v[661] = v[9] * v[611] + v[10] * v[638];
+    v[662] = v[10] * v[611] - v[9] * v[638];
+    v[644] = 0.2155 * v[638] - v[644];
+    v[663] = v[10] * v[628] + v[11] * v[636];
+    v[664] = v[12] * v[636] - v[9] * v[628];
+    v[665] = v[9] * v[632] + v[10] * v[644];
+    v[666] = v[10] * v[632] - v[9] * v[644];
+    v[624] = v[624] + 0.2155 * (v[644] - v[621]);
+    v[649] = -(v[10] * v[626]) - v[649];
+    v[651] = v[9] * v[626] - v[651];
+    v[667] = -(v[9] * v[630]) - v[10] * v[640];
+    v[668] = v[9] * v[640] - v[10] * v[630];
+    v[669] = v[622] - 0.2155 * v[640];
+    v[670] = v[617] / v[250];
+    v[671] = v[614] / v[250];
+    v[672] = v[613] / v[250];
+    v[673] = v[591] / v[250];
+    v[674] = v[616] / v[250];
+    v[675] = v[615] / v[250];
+    v[676] = v[572] + v[248] * v[670] + v[247] * v[671] + v[251] * v[672] - v[250] * v[673] + v[249] * v[674] + v[246] * v[675];
+    y[160] = v[676];
+    v[677] = -(v[9] * v[646]) - v[10] * v[621] + 0.2155 * v[661] + v[55] * v[617];
+    v[678] = v[9] * v[621] - v[10] * v[646] + 0.2155 * v[662] - v[56] * v[617];
+    v[679] = -(v[10] * v[623]) - v[11] * v[622] + 0.2155 * v[653] + v[57] * v[617];
+    v[680] = v[9] * v[623] - v[12] * v[622] + 0.2155 * v[654] - v[58] * v[617];
+    v[681] = v[12] * v[659] - v[9] * v[655] + v[55] * v[614];
+    v[682] = v[12] * v[660] - v[9] * v[656] - v[56] * v[614];
+    v[683] = v[12] * v[650] - v[9] * v[618] + v[57] * v[614];
+    v[684] = v[12] * v[652] - v[9] * v[619] - v[58] * v[614];
+    v[685] = v[10] * v[655] + v[11] * v[659] + v[55] * v[613];
+    v[686] = v[10] * v[656] + v[11] * v[660] - v[56] * v[613];
+    v[687] = v[10] * v[618] + v[11] * v[650] + v[57] * v[613];
+    v[688] = v[10] * v[619] + v[11] * v[652] - v[58] * v[613];
+    v[689] = -v[659] - v[55] * v[591];
+    v[690] = v[56] * v[591] - v[660];
+    v[691] = -v[650] - v[57] * v[591];
+    v[692] = v[58] * v[591] - v[652];
+    v[693] = v[10] * v[657] - v[9] * v[661] + v[55] * v[616];
+    v[694] = v[10] * v[658] - v[9] * v[662] - v[56] * v[616];
+    v[695] = v[10] * v[645] - v[9] * v[653] + v[57] * v[616];
+    v[696] = v[10] * v[647] - v[9] * v[654] - v[58] * v[616];
+    v[697] = v[573] + v[265] * v[617] + v[264] * v[614] + v[263] * v[613] - v[262] * v[591] + v[261] * v[616] + v[260] * v[615];
+    v[698] = v[9] * v[657] + v[10] * v[661] + v[55] * v[615];
+    v[699] = -v[574] - v[271] * v[617] - v[270] * v[614] - v[269] * v[613] + v[268] * v[591] - v[267] * v[616] - v[266] * v[615];
+    v[700] = v[9] * v[658] + v[10] * v[662] - v[56] * v[615];
+    v[701] = v[575] + v[282] * v[617] + v[281] * v[614] + v[280] * v[613] - v[279] * v[591] + v[278] * v[616] + v[277] * v[615];
+    v[702] = v[9] * v[645] + v[10] * v[653] + v[57] * v[615];
+    v[703] = -v[576] - v[288] * v[617] - v[287] * v[614] - v[286] * v[613] + v[285] * v[591] - v[284] * v[616] - v[283] * v[615];
+    v[704] = v[9] * v[647] + v[10] * v[654] - v[58] * v[615];
+    v[705] = (-(v[248] * v[624]) - v[247] * v[664] - v[251] * v[663] + v[250] * v[636] - v[249] * v[666] - v[246] * v[665]) / v[250];
+    v[706] = v[669] + (v[253] * v[670] - v[395] * v[572] - v[259] * v[624] - v[258] * v[680] - v[257] * v[679]) - v[256] * v[669] - v[255] * v[678] - v[254] * v[677] + v[705];
+    v[707] = (-(v[248] * v[680]) - v[247] * v[684] - v[251] * v[688] - v[250] * v[692] - v[249] * v[696] - v[246] * v[704]) / v[250];
+    v[708] = v[651] + (v[253] * v[671] - v[399] * v[572] - v[259] * v[664] - v[258] * v[684] - v[257] * v[683]) - v[256] * v[651] - v[255] * v[682] - v[254] * v[681] + v[707];
+    v[709] = (-(v[248] * v[679]) - v[247] * v[683] - v[251] * v[687] - v[250] * v[691] - v[249] * v[695] - v[246] * v[702]) / v[250];
+    v[710] = v[649] + (v[253] * v[672] - v[398] * v[572] - v[259] * v[663] - v[258] * v[688] - v[257] * v[687]) - v[256] * v[649] - v[255] * v[686] - v[254] * v[685] + v[709];
+    v[649] = (-(v[248] * v[669]) - v[247] * v[651] - v[251] * v[649] - v[250] * v[634] - v[249] * v[668] - v[246] * v[667]) / v[250];
+    v[651] = (-(v[248] * v[678]) - v[247] * v[682] - v[251] * v[686] - v[250] * v[690] - v[249] * v[694] - v[246] * v[700]) / v[250];
+    v[668] = v[668] + (v[253] * v[674] - v[397] * v[572] - v[259] * v[666] - v[258] * v[696] - v[257] * v[695]) - v[256] * v[668] - v[255] * v[694] - v[254] * v[693] + v[651];
+    v[669] = (-(v[248] * v[677]) - v[247] * v[681] - v[251] * v[685] - v[250] * v[689] - v[249] * v[693] - v[246] * v[698]) / v[250];
+    v[667] = v[667] + (v[253] * v[675] - v[396] * v[572] - v[259] * v[665] - v[258] * v[704] - v[257] * v[702]) - v[256] * v[667] - v[255] * v[700] - v[254] * v[698] + v[669];
+    v[572] = v[634] + (v[390] * v[572] - v[400] * v[572] - v[302] * v[670] - v[300] * v[671] - v[298] * v[672] + v[297] * v[673] - v[253] * v[673] - v[296] * v[674] - v[294] * v[675] + v[259] * v[636] - v[258] * v[692] - v[257] * v[691]) - v[256] * v[634] - v[255] * v[690] - v[254] * v[689] - v[259] * v[705] - v[258] * v[707] - v[257] * v[709] + v[649] - v[256] * v[649] - v[255] * v[651] - v[254] * v[669];
+    v[649] = -v[591] - v[676];
+    v[651] = v[13] * v[649] - v[14] * v[615];
+    v[669] = v[14] * v[649] + v[13] * v[615];
+    v[670] = v[13] * v[617] - v[14] * v[613] + v[16] * v[649] + v[15] * v[615];
+    v[671] = v[14] * v[617] + v[13] * v[613] + v[17] * v[649] + v[16] * v[615];
+    v[672] = v[13] * v[706] - v[14] * v[677];
+    v[673] = v[14] * v[706] + v[13] * v[677];
+    v[674] = v[13] * v[624] - v[14] * v[679] + v[16] * v[706] + v[15] * v[677];
+    v[675] = v[14] * v[624] + v[13] * v[679] + v[17] * v[706] + v[16] * v[677];
+    v[705] = v[13] * v[710] - v[14] * v[685];
+    v[707] = v[14] * v[710] + v[13] * v[685];
+    v[709] = v[13] * v[663] - v[14] * v[687] + v[16] * v[710] + v[15] * v[685];
+    v[711] = v[14] * v[663] + v[13] * v[687] + v[17] * v[710] + v[16] * v[685];
+    v[712] = v[13] * v[572] - v[14] * v[689];
+    v[713] = v[14] * v[572] + v[13] * v[689];
+    v[714] = -(v[13] * v[636]) - v[14] * v[691] + v[16] * v[572] + v[15] * v[689];
+    v[715] = v[13] * v[691] - v[14] * v[636] + v[17] * v[572] + v[16] * v[689];
+    v[716] = v[13] * v[667] - v[14] * v[698];
+    v[717] = v[14] * v[667] + v[13] * v[698];
+    v[718] = v[13] * v[665] - v[14] * v[702] + v[16] * v[667] + v[15] * v[698];
+    v[719] = v[14] * v[665] + v[13] * v[702] + v[17] * v[667] + v[16] * v[698];
+    v[720] = v[13] * v[692] - v[14] * v[704];
+    v[721] = v[14] * v[692] + v[13] * v[704];
+    v[722] = v[13] * v[680] - v[14] * v[688] + v[16] * v[692] + v[15] * v[704];
+    v[723] = v[14] * v[680] + v[13] * v[688] + v[17] * v[692] + v[16] * v[704];
+    v[724] = v[13] * v[690] - v[14] * v[700];
+    v[725] = v[14] * v[690] + v[13] * v[700];
+    v[726] = v[13] * v[678] - v[14] * v[686] + v[16] * v[690] + v[15] * v[700];
+    v[727] = v[14] * v[678] + v[13] * v[686] + v[17] * v[690] + v[16] * v[700];
+    v[728] = v[614] / v[187];
+    v[729] = v[671] / v[187];
+    v[730] = v[670] / v[187];
+    v[731] = v[616] / v[187];
+    v[732] = v[669] / v[187];
+    v[733] = v[651] / v[187];
+    v[734] = v[185] * v[728] - v[566] + v[189] * v[729] + v[188] * v[730] + v[187] * v[731] + v[186] * v[732] + v[184] * v[733];
+    y[161] = v[734];
+    v[735] = v[13] * v[708] - v[14] * v[681] + v[70] * v[614];
+    v[736] = v[14] * v[708] + v[13] * v[681] - v[71] * v[614];
+    v[737] = v[13] * v[664] - v[14] * v[683] + v[16] * v[708] + v[15] * v[681] + v[72] * v[614];
+    v[738] = v[14] * v[664] + v[13] * v[683] + v[17] * v[708] + v[16] * v[681] - v[73] * v[614];
+    v[739] = v[14] * v[672] + v[13] * v[705] + v[17] * v[712] + v[16] * v[716] + v[70] * v[671];
+    v[740] = v[14] * v[673] + v[13] * v[707] + v[17] * v[713] + v[16] * v[717] - v[71] * v[671];
+    v[741] = v[14] * v[674] + v[13] * v[709] + v[17] * v[714] + v[16] * v[718] + v[72] * v[671];
+    v[742] = v[14] * v[675] + v[13] * v[711] + v[17] * v[715] + v[16] * v[719] - v[73] * v[671];
+    v[743] = v[13] * v[672] - v[14] * v[705] + v[16] * v[712] + v[15] * v[716] + v[70] * v[670];
+    v[744] = v[13] * v[673] - v[14] * v[707] + v[16] * v[713] + v[15] * v[717] - v[71] * v[670];
+    v[745] = v[13] * v[674] - v[14] * v[709] + v[16] * v[714] + v[15] * v[718] + v[72] * v[670];
+    v[746] = v[13] * v[675] - v[14] * v[711] + v[16] * v[715] + v[15] * v[719] - v[73] * v[670];
+    v[747] = v[13] * v[668] - v[14] * v[693] + v[70] * v[616];
+    v[748] = v[14] * v[668] + v[13] * v[693] - v[71] * v[616];
+    v[749] = v[13] * v[666] - v[14] * v[695] + v[16] * v[668] + v[15] * v[693] + v[72] * v[616];
+    v[750] = v[14] * v[666] + v[13] * v[695] + v[17] * v[668] + v[16] * v[693] - v[73] * v[616];
+    v[751] = v[14] * v[712] + v[13] * v[716] + v[70] * v[669];
+    v[752] = v[14] * v[713] + v[13] * v[717] - v[71] * v[669];
+    v[753] = v[14] * v[714] + v[13] * v[718] + v[72] * v[669];
+    v[754] = v[14] * v[715] + v[13] * v[719] - v[73] * v[669];
+    v[755] = v[567] + v[202] * v[614] + v[178] * v[671] + v[201] * v[670] + v[200] * v[616] + v[199] * v[669] + v[198] * v[651];
+    v[756] = v[13] * v[712] - v[14] * v[716] + v[70] * v[651];
+    v[757] = -v[568] - v[207] * v[614] - v[146] * v[671] - v[206] * v[670] - v[205] * v[616] - v[204] * v[669] - v[203] * v[651];
+    v[758] = v[13] * v[713] - v[14] * v[717] - v[71] * v[651];
+    v[759] = v[569] + v[217] * v[614] + v[216] * v[671] + v[215] * v[670] + v[214] * v[616] + v[213] * v[669] + v[212] * v[651];
+    v[760] = v[13] * v[714] - v[14] * v[718] + v[72] * v[651];
+    v[761] = -v[570] - v[183] * v[614] - v[132] * v[671] - v[182] * v[670] - v[181] * v[616] - v[180] * v[669] - v[179] * v[651];
+    v[762] = v[13] * v[715] - v[14] * v[719] - v[73] * v[651];
+    v[763] = (-(v[185] * v[684]) - v[189] * v[723] - v[188] * v[722] - v[187] * v[696] - v[186] * v[721] - v[184] * v[720]) / v[187];
+    v[764] = v[682] + (v[399] * v[566] + v[191] * v[728] - v[197] * v[684] - v[196] * v[738] - v[195] * v[737]) - v[194] * v[682] - v[193] * v[736] - v[192] * v[735] + v[763];
+    v[765] = (-(v[185] * v[738]) - v[189] * v[742] - v[188] * v[746] - v[187] * v[750] - v[186] * v[754] - v[184] * v[762]) / v[187];
+    v[766] = v[727] + (v[405] * v[566] + v[191] * v[729] - v[197] * v[723] - v[196] * v[742] - v[195] * v[741]) - v[194] * v[727] - v[193] * v[740] - v[192] * v[739] + v[765];
+    v[767] = (-(v[185] * v[737]) - v[189] * v[741] - v[188] * v[745] - v[187] * v[749] - v[186] * v[753] - v[184] * v[760]) / v[187];
+    v[768] = v[726] + (v[404] * v[566] + v[191] * v[730] - v[197] * v[722] - v[196] * v[746] - v[195] * v[745]) - v[194] * v[726] - v[193] * v[744] - v[192] * v[743] + v[767];
+    v[682] = (-(v[185] * v[682]) - v[189] * v[727] - v[188] * v[726] - v[187] * v[694] - v[186] * v[725] - v[184] * v[724]) / v[187];
+    v[726] = (-(v[185] * v[736]) - v[189] * v[740] - v[188] * v[744] - v[187] * v[748] - v[186] * v[752] - v[184] * v[758]) / v[187];
+    v[725] = v[725] + (v[403] * v[566] + v[191] * v[732] - v[197] * v[721] - v[196] * v[754] - v[195] * v[753]) - v[194] * v[725] - v[193] * v[752] - v[192] * v[751] + v[726];
+    v[727] = (-(v[185] * v[735]) - v[189] * v[739] - v[188] * v[743] - v[187] * v[747] - v[186] * v[751] - v[184] * v[756]) / v[187];
+    v[724] = v[724] + (v[402] * v[566] + v[191] * v[733] - v[197] * v[720] - v[196] * v[762] - v[195] * v[760]) - v[194] * v[724] - v[193] * v[758] - v[192] * v[756] + v[727];
+    v[566] = v[694] + (v[406] * v[566] + v[397] * v[566] - v[229] * v[728] - v[228] * v[729] - v[226] * v[730] - v[225] * v[731] + v[191] * v[731] - v[224] * v[732] - v[222] * v[733] - v[197] * v[696] - v[196] * v[750] - v[195] * v[749]) - v[194] * v[694] - v[193] * v[748] - v[192] * v[747] - v[197] * v[763] - v[196] * v[765] - v[195] * v[767] + v[682] - v[194] * v[682] - v[193] * v[726] - v[192] * v[727];
+    v[682] = v[616] - v[734];
+    v[694] = v[18] * v[614] + v[19] * v[670] + v[20] * v[669];
+    v[726] = v[19] * v[614] - v[18] * v[670] + v[21] * v[669];
+    v[727] = v[18] * v[682] + v[19] * v[651];
+    v[728] = v[19] * v[682] - v[18] * v[651];
+    v[729] = 0.2155 * v[651] - v[671];
+    v[730] = v[18] * v[684] + v[19] * v[737] + v[20] * v[736];
+    v[731] = v[18] * v[722] + v[19] * v[745] + v[20] * v[744];
+    v[732] = v[18] * v[696] + v[19] * v[749] + v[20] * v[748];
+    v[733] = v[20] * v[752];
+    v[763] = v[18] * v[721] + v[19] * v[753] + v[733];
+    v[765] = v[18] * v[720] + v[19] * v[760] + v[20] * v[758];
+    v[767] = v[18] * v[764] + v[19] * v[735];
+    v[738] = 0.2155 * v[735] - v[738];
+    v[769] = v[18] * v[768] + v[19] * v[743];
+    v[746] = 0.2155 * v[743] - v[746];
+    v[770] = v[18] * v[566] + v[19] * v[747];
+    v[750] = 0.2155 * v[747] - v[750];
+    v[771] = v[18] * v[725] + v[19] * v[751];
+    v[754] = 0.2155 * v[751] - v[754];
+    v[772] = v[18] * v[724] + v[19] * v[756];
+    v[762] = 0.2155 * v[756] - v[762];
+    v[773] = v[18] * v[738] + v[19] * v[746] + v[20] * v[754];
+    v[774] = v[18] * v[750] + v[19] * v[762];
+    v[742] = v[742] + 0.2155 * (v[762] - v[739]);
+    v[733] = -(v[18] * v[736]) - v[19] * v[744] - v[733];
+    v[775] = -(v[18] * v[748]) - v[19] * v[758];
+    v[776] = v[740] - 0.2155 * v[758];
+    v[777] = v[729] / v[133];
+    v[778] = v[694] / v[133];
+    v[779] = v[669] / v[133];
+    v[780] = v[727] / v[133];
+    v[781] = v[130] * v[777] + v[134] * v[778] - v[133] * v[779] + v[129] * v[780];
+    y[162] = v[781];
+    v[782] = -(v[18] * v[766]) - v[19] * v[739] + 0.2155 * v[772] + v[86] * v[729];
+    v[783] = -(v[18] * v[723]) - v[19] * v[741] - v[20] * v[740] + 0.2155 * v[765] + v[88] * v[729];
+    v[784] = v[18] * v[767] + v[19] * v[769] + v[20] * v[771] + v[86] * v[694];
+    v[785] = v[18] * v[730] + v[19] * v[731] + v[20] * v[763] + v[88] * v[694];
+    v[786] = -v[771] - v[86] * v[669];
+    v[787] = -v[763] - v[88] * v[669];
+    v[788] = 1. - 0.00072 * v[694] - 0.0036 * v[728];
+    v[789] = v[128] * v[729] + -0.00072 * v[726] + v[127] * v[694] - v[143] * v[669] + v[142] * v[727];
+    v[790] = v[18] * v[770] + v[19] * v[772] + v[86] * v[727];
+    v[791] = v[150] * v[729] + v[149] * v[694] - v[148] * v[669] + 0.00072 * v[728] + v[147] * v[727];
+    v[792] = v[18] * v[732] + v[19] * v[765] + v[88] * v[727];
+    v[793] = -(2.1 * v[726]) - -0.00072 * v[727];
+    v[794] = v[742] + v[785];
+    v[795] = (-(v[130] * v[742]) - v[134] * v[773] + v[133] * v[754] - v[129] * v[774]) / v[133];
+    v[742] = v[776] + (v[137] * v[777] - v[141] * v[742] - v[140] * v[783]) - v[139] * v[776] - v[138] * v[782] + v[795];
+    v[796] = (-(v[130] * v[783]) - v[134] * v[785] - v[133] * v[787] - v[129] * v[792]) / v[133];
+    v[785] = v[733] + (v[137] * v[778] - v[141] * v[773] - v[140] * v[785]) - v[139] * v[733] - v[138] * v[784] + v[796];
+    v[733] = (-(v[130] * v[776]) - v[134] * v[733] - v[133] * v[752] - v[129] * v[775]) / v[133];
+    v[776] = (-(v[130] * v[782]) - v[134] * v[784] - v[133] * v[786] - v[129] * v[790]) / v[133];
+    v[775] = v[775] + (v[137] * v[780] - v[141] * v[774] - v[140] * v[792]) - v[139] * v[775] - v[138] * v[790] + v[776];
+    v[733] = v[752] + (-(v[156] * v[777]) - v[154] * v[778] + v[153] * v[779] - v[137] * v[779] - v[135] * v[780] + v[141] * v[754] - v[140] * v[787]) - v[139] * v[752] - v[138] * v[786] - v[141] * v[795] - v[140] * v[796] + v[733] - v[139] * v[733] - v[138] * v[776];
+    v[776] = -v[669] - v[781];
+    v[777] = v[22] * v[776] - v[23] * v[727];
+    v[778] = v[23] * v[776] + v[22] * v[727];
+    v[779] = v[22] * v[729] - v[23] * v[694] + v[25] * v[776] + v[24] * v[727];
+    v[780] = v[23] * v[729] + v[22] * v[694] + v[26] * v[776] + v[25] * v[727];
+    v[795] = v[783] - v[773];
+    v[773] = v[773] - v[783];
+    v[783] = v[782] - v[785];
+    v[796] = v[784] + v[742];
+    v[797] = v[22] * v[733] - v[23] * v[786];
+    v[798] = v[23] * v[733] + v[22] * v[786];
+    v[799] = -(v[22] * v[754]) - v[23] * v[787] + v[25] * v[733] + v[24] * v[786];
+    v[800] = v[22] * v[787] - v[23] * v[754] + v[26] * v[733] + v[25] * v[786];
+    v[801] = v[22] * v[775] - v[23] * v[790];
+    v[802] = v[23] * v[775] + v[22] * v[790];
+    v[803] = v[22] * v[774] - v[23] * v[792] + v[25] * v[775] + v[24] * v[790];
+    v[804] = v[23] * v[774] + v[22] * v[792] + v[26] * v[775] + v[25] * v[790];
+    v[805] = 1000. + 0.001 * (v[728] / 0.001);
+    y[163] = v[805];
+    v[806] = -(0.006 * v[779]) - 0.001 * v[778];
+    v[807] = 0.3 * v[779] + 0.006 * v[778];
+    v[808] = -0.006 * v[780] + 0.001 * v[777];
+    v[809] = -(0.3 * v[780]) - -0.006 * v[777];
+    v[810] = v[728] - v[805];
+    v[811] = v[96] * v[810] - v[100] * v[777];
+    v[812] = v[100] * v[778] - v[97] * v[810];
+    v[813] = v[96] * v[726] - v[100] * v[779] - v[83] * v[777] + v[98] * v[810];
+    v[814] = v[100] * v[780] - v[97] * v[726] + v[83] * v[778] - v[99] * v[810];
+    v[815] = v[108] * v[780] - v[109] * v[779] - v[106] * v[777] + v[105] * v[778] + 0.001 * (v[97] * v[777] - v[96] * v[778]);
+    v[816] = v[109] * v[810] - v[110] * v[778] + 0.3 * v[814] + 0.006 * v[811] + x[13] * v[809];
+    v[817] = v[110] * v[777] - v[108] * v[810] + 0.3 * v[813] + -0.006 * v[812] + x[13] * v[807];
+    v[812] = v[109] * v[726] - v[110] * v[780] - v[107] * v[778] + v[106] * v[810] + -0.006 * v[813] + 0.001 * v[812] + x[13] * v[806];
+    v[810] = v[110] * v[779] - v[108] * v[726] + v[107] * v[777] - v[105] * v[810] + 0.006 * v[814] + 0.001 * v[811] + x[13] * v[808];
+    v[811] = v[81] * v[727] - v[80] * v[728];
+    v[813] = v[80] * v[776] - v[85] * v[727];
+    v[814] = v[85] * v[728] - v[81] * v[776];
+    v[818] = v[81] * v[694] - v[80] * v[726] + v[83] * v[727] - v[82] * v[728];
+    v[819] = v[80] * v[729] - v[85] * v[694] - v[84] * v[727] + v[82] * v[776];
+    v[820] = v[85] * v[726] - v[81] * v[729] + v[84] * v[728] - v[83] * v[776];
+    v[821] = v[26] * v[817] + v[25] * v[816] + v[23] * v[810] + v[22] * v[812] - v[94] * v[694] + v[93] * v[726] - v[91] * v[727] + v[90] * v[728] + -0.00108 * v[820] + 0.0047 * v[811];
+    v[822] = v[23] * v[817] + v[22] * v[816] - v[94] * v[727] + v[93] * v[728] + 1.8 * v[818] + 0.00108 * v[814];
+    v[811] = v[22] * v[817] - v[23] * v[816] - v[95] * v[728] + v[94] * v[776] + 1.8 * v[820] + -0.00108 * v[811] + 0.00072 * v[813] + x[12] * v[793];
+    v[777] = v[108] * v[778] - v[109] * v[777] + 0.3 * (v[97] * v[779] - v[96] * v[780] + v[99] * v[777] - v[98] * v[778]) + v[95] * v[727] - v[93] * v[776] + 1.8 * v[819] + -0.00072 * v[814] + x[12] * v[791];
+    v[726] = v[25] * v[817] + v[24] * v[816] + v[22] * v[810] - v[23] * v[812] - v[95] * v[726] + v[94] * v[729] - v[92] * v[728] + v[91] * v[776] + 0.00108 * v[818] + -0.00072 * v[819] + 0.0005 * v[814] + x[12] * v[788];
+    v[728] = v[815] + v[95] * v[694] - v[93] * v[729] + v[92] * v[727] - v[90] * v[776] + 0.00072 * v[820] + 0.0036 * v[813] + x[12] * v[789];
+    v[778] = v[66] * v[651] - v[65] * v[669];
+    v[779] = v[65] * v[682] - v[69] * v[651];
+    v[780] = v[69] * v[669] - v[66] * v[682];
+    v[813] = v[66] * v[670] - v[65] * v[671] + v[68] * v[651] - v[67] * v[669];
+    v[814] = v[65] * v[614] - v[69] * v[670] - v[52] * v[651] + v[67] * v[682];
+    v[818] = v[69] * v[671] - v[66] * v[614] + v[52] * v[669] - v[68] * v[682];
+    v[819] = v[19] * v[728] + v[18] * v[726] - v[78] * v[670] + v[77] * v[671] - v[75] * v[651] + v[74] * v[669] + 0.00017 * v[814] + -0.0357 * v[818] + 0.0058 * v[778] + -0.0027 * v[779];
+    v[820] = v[19] * v[811] - v[18] * v[777] - v[79] * v[669] + v[78] * v[682] + 1.7 * v[818] + -0.0357 * v[778] + 0.1292 * v[779] + x[11] * v[761];
+    v[823] = v[79] * v[651] - v[822] - v[77] * v[682] + 1.7 * v[814] + 0.00017 * v[778] + -0.1292 * v[780] + x[11] * v[759];
+    v[671] = 0.2155 * v[822] - v[18] * v[728] + v[19] * v[726] - v[79] * v[671] + v[78] * v[614] - v[76] * v[669] + v[75] * v[682] + 0.0357 * v[813] + -0.1292 * v[814] + 0.0306 * v[780] + x[11] * v[757];
+    v[778] = v[21] * v[777] - v[821] + v[20] * v[811] + v[79] * v[670] - v[77] * v[614] + v[76] * v[651] - v[74] * v[682] + -0.00017 * v[813] + 0.1292 * v[818] + -0.0027 * v[778] + 0.0279 * v[779] + x[11] * v[755];
+    v[814] = v[50] * v[615] - v[49] * v[616];
+    v[818] = v[49] * v[649] - v[54] * v[615];
+    v[822] = v[54] * v[616] - v[50] * v[649];
+    v[824] = v[50] * v[613] - v[49] * v[614] + v[52] * v[615] - v[51] * v[616];
+    v[825] = v[49] * v[617] - v[54] * v[613] - v[53] * v[615] + v[51] * v[649];
+    v[826] = v[54] * v[614] - v[50] * v[617] + v[53] * v[616] - v[52] * v[649];
+    v[827] = v[17] * v[823] + v[16] * v[820] + v[14] * v[778] + v[13] * v[671] - v[63] * v[613] + v[62] * v[614] - v[60] * v[615] + v[59] * v[616] + -0.1809 * v[826] + 0.0411 * v[814] + -0.0061 * v[818];
+    v[828] = v[14] * v[823] + v[13] * v[820] - v[63] * v[615] + v[62] * v[616] + 2.7 * v[824] + 0.1809 * v[822];
+    v[829] = v[13] * v[823] - v[14] * v[820] - v[64] * v[616] + v[63] * v[649] + 2.7 * v[826] + -0.1809 * v[814] + 0.0918 * v[818] + x[10] * v[703];
+    v[779] = v[19] * v[777] + v[18] * v[811] - v[78] * v[651] + v[77] * v[669] + 1.7 * v[813] + -0.00017 * v[779] + 0.0357 * v[780] + v[64] * v[615] - v[62] * v[649] + 2.7 * v[825] + -0.0918 * v[822] + x[10] * v[701];
+    v[616] = v[16] * v[823] + v[15] * v[820] + v[13] * v[778] - v[14] * v[671] - v[64] * v[614] + v[63] * v[617] - v[61] * v[616] + v[60] * v[649] + 0.1809 * v[824] + -0.0918 * v[825] + 0.0452 * v[822] + x[10] * v[699];
+    v[780] = v[819] + v[64] * v[613] - v[62] * v[617] + v[61] * v[615] - v[59] * v[649] + 0.0918 * v[826] + -0.0061 * v[814] + 0.0131 * v[818] + x[10] * v[697];
+    v[813] = v[35] * v[590] - v[34] * v[591];
+    v[814] = v[34] * v[594] - v[38] * v[590];
+    v[818] = v[38] * v[591] - v[35] * v[594];
+    v[822] = v[36] * v[594] - v[38] * v[599];
+    v[824] = v[38] * v[601] - v[37] * v[594];
+    v[825] = v[10] * v[780] + v[9] * v[616] - v[47] * v[599] + v[46] * v[601] - v[44] * v[590] + v[43] * v[591] + -0.09 * v[824] + 0.0127 * v[813] + -0.0117 * v[814];
+    v[826] = v[10] * v[829] - v[9] * v[779] - v[48] * v[591] + v[47] * v[594] + 3. * v[824] + -0.09 * v[813] + 0.39 * v[814] + x[9] * v[643];
+    v[830] = v[48] * v[590] - v[828] - v[46] * v[594] + 3. * v[822] + -0.39 * v[818] + x[9] * v[641];
+    v[601] = 0.2155 * v[828] - v[9] * v[780] + v[10] * v[616] - v[48] * v[601] - v[45] * v[591] + v[44] * v[594] + 0.09 * (v[35] * v[599] - v[34] * v[601] + v[37] * v[590] - v[36] * v[591]) + -0.39 * v[822] + 0.1334 * v[818] + x[9] * v[639];
+    v[813] = v[12] * v[779] - v[827] + v[11] * v[829] + v[48] * v[599] + v[45] * v[590] - v[43] * v[594] + 0.39 * v[824] + -0.0117 * v[813] + 0.1257 * v[814] + x[9] * v[637];
+    v[814] = v[7] * v[830] + v[6] * v[826] + v[4] * v[813] - v[5] * v[601] + v[33] * v[587] - v[32] * v[592] + 0.071 * (v[28] * v[592] - x[8] * v[587]) + x[8] * v[597];
+    v[818] = v[825] - v[33] * v[586] + v[31] * v[592] + 0.025 * (x[8] * v[586] - v[27] * v[592]) + x[8] * v[595];
+    y[149] = v[23] * (v[102] * v[729] + v[101] * v[694] + v[113] * v[776] + v[114] * v[727] - v[123] * v[754] + v[121] * v[774] + v[124] * v[795] + v[125] * v[794] + v[126] * v[787] + v[122] * v[792] + v[118] * v[742] + v[117] * v[785] + v[116] * v[733] + v[104] * v[775] + v[120] * v[782] - v[119] * v[784] + v[103] * v[786] + v[115] * v[790] + 0.3 * (v[23] * v[773] + v[22] * v[794] + v[26] * v[785] + v[24] * v[782] + v[25] * v[796]) + 0.006 * (v[23] * v[742] + v[22] * v[782] + v[803]) + -0.006 * (v[22] * v[785] - v[23] * v[784] + v[800]) + 0.001 * (v[797] + v[802]) + v[82] * v[817] + v[84] * v[816] + v[80] * v[810] + v[85] * v[812] + -0.081 * (v[101] * v[776] + v[124] * v[742] + v[125] * v[785] + v[126] * v[733] + v[122] * v[775] + 0.3 * v[800] + -0.006 * v[797] + v[85] * v[817]) + 0.081 * (v[102] * v[727] + v[125] * v[782] - v[124] * v[784] + v[123] * v[786] + v[121] * v[790] + 0.3 * v[803] + 0.006 * v[802] + v[80] * v[816])) - v[22] * (v[101] * v[729] - v[102] * v[694] + v[114] * v[776] - v[113] * v[727] - v[126] * v[754] + v[122] * v[774] + v[125] * v[773] + v[124] * v[794] - v[123] * v[787] - v[121] * v[792] + v[120] * v[742] - v[119] * v[785] + v[103] * v[733] + v[115] * v[775] - v[118] * v[782] - v[117] * v[784] - v[116] * v[786] - v[104] * v[790] + 0.3 * (v[22] * v[795] + v[23] * v[794] + v[26] * v[742] + v[25] * v[783] - v[24] * v[784]) + 0.006 * (-(v[23] * v[785]) - v[22] * v[784] + v[799]) + -0.006 * (v[22] * v[742] - v[23] * v[782] - v[804]) + 0.001 * (v[798] - v[801]) + v[84] * v[817] - v[82] * v[816] + v[85] * v[810] - v[80] * v[812] + 0.081 * (v[102] * v[776] + v[101] * v[727] + v[123] * v[733] + v[121] * v[775] + v[124] * v[783] + v[125] * v[796] + v[126] * v[786] + v[122] * v[790] + 0.3 * (v[799] + v[804]) + 0.006 * v[798] + -0.006 * v[801] + v[80] * v[817] + v[85] * v[816]));
+    y[148] = v[19] * (v[402] + v[155] * v[614] - v[89] * v[670] + v[152] * v[682] - v[111] * v[651] + v[174] * v[684] - v[150] * v[723] + v[173] * v[722] + v[172] * v[696] + v[171] * v[721] + v[170] * v[720] - v[177] * v[737] + v[176] * v[745] - v[161] * v[749] - v[175] * v[753] - v[163] * v[760] + v[164] * v[764] - v[128] * v[766] + v[162] * v[768] + v[160] * v[566] + v[159] * v[725] + v[158] * v[724] - v[169] * v[735] - v[168] * v[743] - v[167] * v[747] - v[166] * v[751] + v[165] * v[756] + v[131] * v[738] + v[151] * v[750] + 2.1 * (v[18] * v[745] - v[19] * v[722] - v[21] * v[744]) + v[149] * v[730] + v[147] * v[732] - v[145] * v[736] - v[144] * v[748] + 0.00072 * (v[19] * v[764] - v[18] * v[735] - v[765]) + 0.0036 * (v[18] * v[756] - v[19] * v[724]) + v[127] * v[767] + -0.00072 * (v[19] * v[696] - v[18] * v[749] + v[21] * v[748] - v[769]) + v[142] * v[770] - v[67] * v[777] + v[52] * v[811] - v[65] * v[728] + v[69] * v[726] + -0.2155 * (v[89] * v[669] + v[177] * v[736] - v[176] * v[744] + v[161] * v[748] + v[175] * v[752] + v[163] * v[758] + 2.1 * (v[19] * v[721] - v[18] * v[753] + v[21] * v[752]) + -0.00072 * v[771] + v[66] * v[777])) - v[18] * (v[89] * v[614] - v[407] + v[155] * v[670] + v[111] * v[682] + v[152] * v[651] + v[177] * v[684] - v[176] * v[722] + v[161] * v[696] + v[175] * v[721] + v[163] * v[720] + v[174] * v[737] - v[150] * v[741] + v[173] * v[745] + v[172] * v[749] + v[171] * v[753] + v[170] * v[760] + v[169] * v[764] + v[168] * v[768] + v[167] * v[566] + v[166] * v[725] - v[165] * v[724] + v[164] * v[735] - v[128] * v[739] + v[162] * v[743] + v[160] * v[747] + v[159] * v[751] + v[158] * v[756] + v[131] * v[746] + v[151] * v[762] + 2.1 * (v[19] * v[684] - v[18] * v[737] + v[21] * v[736]) + v[149] * v[731] + v[147] * v[765] - v[145] * v[744] - v[144] * v[758] + 0.00072 * (v[732] + (v[19] * v[768] - v[18] * v[743])) + 0.0036 * (v[19] * v[566] - v[18] * v[747]) + -0.00072 * (v[19] * v[720] - v[18] * v[760] + v[21] * v[758] + v[767]) + v[127] * v[769] + v[142] * v[772] + v[52] * v[777] + v[67] * v[811] + v[69] * v[728] + v[65] * v[726] + 0.2155 * (v[155] * v[669] + v[174] * v[736] - v[150] * v[740] + v[173] * v[744] + v[172] * v[748] + v[171] * v[752] + v[170] * v[758] + v[131] * v[754] + v[149] * v[763] - v[145] * v[752] + 0.00072 * (v[19] * v[725] - v[18] * v[751]) + v[127] * v[771] + v[66] * v[811]));
+    y[147] = v[14] * (v[398] * v[570] + v[395] * v[569] + v[396] * v[568] + v[401] * v[567] + v[227] * v[617] + v[157] * v[613] + v[223] * v[649] + v[136] * v[615] + v[241] * v[624] + v[217] * v[664] + v[240] * v[663] - v[239] * v[636] + v[214] * v[666] + v[238] * v[665] + v[245] * v[679] + v[183] * v[683] + v[244] * v[687] + v[243] * v[691] + v[181] * v[695] + v[242] * v[702] + v[233] * v[706] + v[202] * v[708] + v[232] * v[710] + v[231] * v[572] + v[200] * v[668] + v[230] * v[667] + v[237] * v[677] + v[207] * v[681] + v[236] * v[685] + v[235] * v[689] + v[205] * v[693] + v[234] * v[698] + v[220] * v[680] + v[221] * v[688] + v[218] * v[692] + v[219] * v[704] + v[182] * v[675] + v[132] * v[711] + v[179] * v[715] + v[180] * v[719] + v[215] * v[674] + v[216] * v[709] + v[212] * v[714] + v[213] * v[718] + v[210] * v[678] + v[211] * v[686] + v[208] * v[690] + v[209] * v[700] + v[206] * v[673] + v[146] * v[707] + v[203] * v[713] + v[204] * v[717] + v[201] * v[672] + v[178] * v[705] + v[198] * v[712] + v[199] * v[716] + v[51] * v[823] + v[53] * v[820] + v[49] * v[778] + v[54] * v[671] + -0.1845 * (v[401] * v[570] + v[157] * v[649] + v[245] * v[706] + v[183] * v[708] + v[244] * v[710] + v[243] * v[572] + v[181] * v[668] + v[242] * v[667] + v[221] * v[692] + v[132] * v[715] + v[216] * v[714] + v[211] * v[690] + v[146] * v[713] + v[178] * v[712] + v[54] * v[823]) + 0.1845 * (v[396] * v[569] + v[227] * v[615] + v[241] * v[677] + v[217] * v[681] + v[240] * v[685] + v[239] * v[689] + v[214] * v[693] + v[238] * v[698] + v[220] * v[704] + v[182] * v[719] + v[215] * v[718] + v[210] * v[700] + v[206] * v[717] + v[201] * v[716] + v[49] * v[820])) - v[13] * (v[395] * v[570] - v[398] * v[569] + v[401] * v[568] - v[396] * v[567] + v[157] * v[617] - v[227] * v[613] + v[136] * v[649] - v[223] * v[615] + v[245] * v[624] + v[183] * v[664] + v[244] * v[663] - v[243] * v[636] + v[181] * v[666] + v[242] * v[665] - v[241] * v[679] - v[217] * v[683] - v[240] * v[687] - v[239] * v[691] - v[214] * v[695] - v[238] * v[702] + v[237] * v[706] + v[207] * v[708] + v[236] * v[710] + v[235] * v[572] + v[205] * v[668] + v[234] * v[667] - v[233] * v[677] - v[202] * v[681] - v[232] * v[685] - v[231] * v[689] - v[200] * v[693] - v[230] * v[698] + v[221] * v[680] - v[220] * v[688] + v[219] * v[692] - v[218] * v[704] + v[132] * v[675] - v[182] * v[711] + v[180] * v[715] - v[179] * v[719] + v[216] * v[674] - v[215] * v[709] + v[213] * v[714] - v[212] * v[718] + v[211] * v[678] - v[210] * v[686] + v[209] * v[690] - v[208] * v[700] + v[146] * v[673] - v[206] * v[707] + v[204] * v[713] - v[203] * v[717] + v[178] * v[672] - v[201] * v[705] + v[199] * v[712] - v[198] * v[716] + v[53] * v[823] - v[51] * v[820] + v[54] * v[778] - v[49] * v[671] + 0.1845 * (v[396] * v[570] + v[401] * v[569] + v[227] * v[649] + v[157] * v[615] + v[241] * v[706] + v[217] * v[708] + v[240] * v[710] + v[239] * v[572] + v[214] * v[668] + v[238] * v[667] + v[245] * v[677] + v[183] * v[681] + v[244] * v[685] + v[243] * v[689] + v[181] * v[693] + v[242] * v[698] + v[220] * v[692] + v[221] * v[704] + v[182] * v[715] + v[132] * v[719] + v[215] * v[714] + v[216] * v[718] + v[210] * v[690] + v[211] * v[700] + v[206] * v[713] + v[146] * v[717] + v[201] * v[712] + v[178] * v[716] + v[49] * v[823] + v[54] * v[820]));
+    y[146] = v[10] * (-(v[391] * v[576]) - v[389] * v[574] + v[394] * v[573] - v[301] * v[599] + v[295] * v[594] - v[190] * v[590] + v[288] * v[623] - v[319] * v[627] - v[318] * v[631] - v[317] * v[635] - v[316] * v[642] - v[265] * v[646] + v[307] * v[648] + v[306] * v[579] + v[305] * v[612] + v[304] * v[611] + v[271] * v[621] - v[311] * v[625] - v[310] * v[629] - v[309] * v[633] - v[308] * v[638] - v[292] * v[628] + v[289] * v[632] - v[290] * v[644] - v[287] * v[619] + v[283] * v[647] - v[284] * v[654] - v[281] * v[618] + v[277] * v[645] - v[278] * v[653] + v[275] * v[626] - v[272] * v[630] + v[273] * v[640] - v[270] * v[656] + v[266] * v[658] - v[267] * v[662] - v[264] * v[655] + v[260] * v[657] - v[261] * v[661] - v[36] * v[779] - v[34] * v[780] + v[38] * v[616] + -0.2155 * (v[390] * v[576] + v[301] * v[591] - v[288] * v[622] + v[319] * v[626] + v[318] * v[630] + v[317] * v[634] + v[316] * v[640] + v[292] * v[636] + v[287] * v[652] + v[281] * v[650] - v[275] * v[634] + v[270] * v[660] + v[264] * v[659] + v[35] * v[779])) - v[9] * (v[391] * v[575] + v[394] * v[574] + v[389] * v[573] + v[299] * v[599] + v[190] * v[594] + v[295] * v[590] - v[282] * v[623] + v[315] * v[627] + v[314] * v[631] + v[313] * v[635] + v[312] * v[642] - v[271] * v[646] + v[311] * v[648] + v[310] * v[579] + v[309] * v[612] + v[308] * v[611] - v[265] * v[621] + v[307] * v[625] + v[306] * v[629] + v[305] * v[633] + v[304] * v[638] + v[291] * v[628] + v[290] * v[632] + v[289] * v[644] + v[286] * v[619] + v[284] * v[647] + v[283] * v[654] + v[280] * v[618] + v[278] * v[645] + v[277] * v[653] - v[274] * v[626] - v[273] * v[630] - v[272] * v[640] + v[269] * v[656] + v[267] * v[658] + v[266] * v[662] + v[263] * v[655] + v[261] * v[657] + v[260] * v[661] + v[36] * v[829] + v[38] * v[780] + v[34] * v[616] + 0.2155 * (v[390] * v[575] + v[299] * v[591] - v[282] * v[622] + v[315] * v[626] + v[314] * v[630] + v[313] * v[634] + v[312] * v[640] + v[291] * v[636] + v[286] * v[652] + v[280] * v[650] - v[274] * v[634] + v[269] * v[660] + v[263] * v[659] + v[35] * v[829]));
+    y[145] = v[5] * (v[386] * v[571] + v[388] * v[580] - v[355] * v[592] - v[252] * v[586] + v[362] * v[582] + v[339] * v[600] + v[361] * v[602] + v[343] * v[593] + v[363] * v[596] + v[321] * v[606] + v[322] * v[610] + v[349] * v[605] + v[350] * v[609] + v[346] * v[598] + v[341] * v[604] + v[342] * v[608] + v[337] * v[603] + v[338] * v[607] + v[27] * v[813] + x[8] * v[601] + -0.2045 * (v[388] * v[577] - v[303] * v[592] + v[368] * v[582] + v[323] * v[600] + v[367] * v[602] + v[293] * v[606] + v[353] * v[605] + v[276] * v[604] + v[320] * v[603] + x[8] * v[830]) + 0.2045 * (v[386] * v[581] - v[359] * v[586] + v[351] * v[593] + v[365] * v[596] + v[324] * v[610] + v[352] * v[609] + v[347] * v[598] + v[344] * v[608] + v[340] * v[607] + v[27] * v[826])) - v[4] * (v[388] * v[571] - v[386] * v[580] - v[252] * v[592] + v[355] * v[586] + v[364] * v[582] + v[343] * v[600] + v[363] * v[602] - v[339] * v[593] - v[361] * v[596] + v[322] * v[606] - v[321] * v[610] + v[350] * v[605] - v[349] * v[609] - v[345] * v[598] + v[342] * v[604] - v[341] * v[608] + v[338] * v[603] - v[337] * v[607] + x[8] * v[813] - v[27] * v[601] + 0.2045 * (v[386] * v[577] + v[388] * v[581] - v[359] * v[592] - v[303] * v[586] + v[366] * v[582] + v[351] * v[600] + v[365] * v[602] + v[323] * v[593] + v[367] * v[596] + v[324] * v[606] + v[293] * v[610] + v[352] * v[605] + v[353] * v[609] + v[348] * v[598] + v[344] * v[604] + v[276] * v[608] + v[340] * v[603] + v[320] * v[607] + v[27] * v[830] + x[8] * v[826]));
+    y[144] = v[3] * (v[385] * v[583] - v[380] * v[584] - v[382] * v[585] - v[377] * v[589] - v[375] * v[588] + x[7] * v[814]) - v[2] * (v[385] * v[578] - v[330] * v[584] - v[383] * v[585] - v[378] * v[589] - v[376] * v[588] + x[7] * v[818]);
+    y[156] = v[815] + (v[98] * v[809] + v[99] * v[807] + v[96] * v[806] + v[97] * v[808]) + -0.2 * v[805];
+    y[155] = v[821] + (v[82] * v[793] + v[83] * v[791] + v[80] * v[788] + v[81] * v[789]) + -0.5 * v[781];
+    y[154] = v[819] + (v[67] * v[761] + v[68] * v[759] + v[65] * v[757] + v[66] * v[755]) - v[734];
+    y[153] = v[827] + (v[51] * v[703] + v[52] * v[701] + v[49] * v[699] + v[50] * v[697]) + -0.3 * v[676];
+    y[152] = v[825] + (v[36] * v[643] + v[37] * v[641] + v[34] * v[639] + v[35] * v[637]) + -0.5 * v[620];
+    y[151] = v[8] * v[830] + v[7] * v[826] + v[5] * v[813] + v[4] * v[601] + v[32] * v[586] - v[31] * v[587] + 0.0579 * (v[27] * v[587] - v[28] * v[586]) + v[27] * v[597] + v[28] * v[595] + -0.5 * v[592];
+    y[150] = v[3] * v[818] + v[2] * v[814] + -0.5 * v[584];
+    v[562] = v[563] * (1. / v[562]);
+    v[563] = v[561] * v[562];
+    v[561] = 2. * v[561];
+    v[566] = x[16] * (v[553] * v[562] / v[561]);
+    y[176] = v[566] + v[566];
+    v[565] = v[565] / v[557];
+    v[566] = v[563] + v[565];
+    v[557] = v[557] * 2.;
+    v[567] = v[558] * v[565] / v[557];
+    v[568] = v[553] * v[567];
+    v[568] = v[566] - v[568] - v[568];
+    v[569] = v[554] * v[567];
+    v[569] = -v[569] - v[569];
+    v[567] = v[556] * v[567];
+    v[558] = v[558] * v[564] - v[567] - v[567];
+    v[567] = x[12] * v[558];
+    v[570] = x[12] * v[569];
+    y[175] = v[538] * v[558] + v[520] * v[569] + v[503] * v[568];
+    v[571] = x[12] * v[568];
+    v[572] = x[11] * v[558];
+    v[573] = x[11] * v[569];
+    y[174] = v[536] * v[558] + v[519] * v[569] + v[502] * v[568];
+    v[574] = x[11] * v[568];
+    v[575] = x[10] * v[558];
+    v[576] = x[10] * v[569];
+    y[173] = v[534] * v[558] + v[517] * v[569] + v[500] * v[568];
+    v[577] = x[10] * v[568];
+    v[578] = x[9] * v[558];
+    v[579] = x[9] * v[569];
+    y[172] = v[533] * v[558] + v[515] * v[569] + v[498] * v[568];
+    v[580] = x[9] * v[568];
+    v[581] = x[8] * v[558];
+    v[582] = x[8] * v[569];
+    y[171] = v[528] * v[558] + v[510] * v[569] + v[492] * v[568];
+    v[558] = x[8] * v[568];
+    v[583] = x[7] * v[569];
+    y[170] = v[438] * v[569] + v[485] * v[568];
+    v[568] = x[7] * v[568];
+    v[569] = v[18] * v[567];
+    v[584] = v[19] * v[567];
+    v[585] = v[18] * v[572];
+    v[586] = v[18] * v[575];
+    v[587] = v[14] * v[586];
+    v[588] = v[13] * v[585] + v[19] * v[575];
+    v[589] = v[10] * v[575];
+    v[590] = v[18] * v[578];
+    v[591] = v[14] * v[590];
+    v[592] = v[19] * v[578];
+    v[593] = v[9] * v[578];
+    v[594] = v[18] * v[581];
+    v[595] = v[14] * v[594];
+    v[596] = v[13] * v[594];
+    v[597] = v[19] * v[581];
+    v[598] = v[9] * v[597] - v[10] * v[595];
+    v[599] = v[9] * v[581];
+    v[600] = v[19] * v[570];
+    v[601] = v[18] * v[573];
+    v[602] = v[18] * v[576];
+    v[603] = v[14] * v[602];
+    v[604] = v[13] * v[601] + v[19] * v[576];
+    v[605] = v[10] * v[576];
+    v[606] = v[18] * v[579];
+    v[607] = v[14] * v[606];
+    v[608] = v[19] * v[579];
+    v[609] = v[9] * v[579];
+    v[610] = v[18] * v[582];
+    v[611] = v[14] * v[610];
+    v[612] = v[13] * v[610];
+    v[613] = v[19] * v[582];
+    v[614] = v[9] * v[613] - v[10] * v[611];
+    v[615] = v[9] * v[582];
+    v[616] = v[18] * v[571];
+    v[617] = v[18] * v[574];
+    v[618] = v[14] * v[617];
+    v[619] = v[18] * v[577];
+    v[620] = v[13] * v[617] + v[19] * v[577];
+    v[621] = v[18] * v[580];
+    v[622] = v[14] * v[621];
+    v[623] = v[19] * v[580];
+    v[624] = v[9] * v[623];
+    v[625] = v[624] - v[618];
+    v[626] = v[9] * v[580];
+    v[627] = v[18] * v[558];
+    v[628] = v[14] * v[627];
+    v[629] = v[13] * v[627];
+    v[630] = v[19] * v[558];
+    v[631] = v[9] * v[630] - v[10] * v[628];
+    v[632] = v[9] * v[558];
+    v[633] = v[18] * v[568];
+    v[634] = v[14] * v[633];
+    v[635] = v[10] * v[634];
+    v[636] = v[5] * v[635];
+    v[637] = v[9] * v[608] + v[13] * v[633];
+    v[638] = v[18] * v[570] + v[19] * v[568];
+    v[639] = v[9] * v[568];
+    v[640] = v[4] * v[609] + v[10] * v[582] + v[5] * v[639];
+    v[641] = v[14] * v[584];
+    v[642] = v[641] - v[588];
+    v[588] = v[588] - v[641];
+    v[641] = v[14] * v[585] + v[10] * v[591] - v[9] * v[592] + v[13] * v[584];
+    v[643] = v[587] - v[569];
+    v[644] = v[13] * v[590] + v[10] * v[588] + v[9] * v[643];
+    v[645] = v[14] * v[600];
+    v[646] = -v[604] - v[634] + v[645];
+    v[647] = v[9] * v[638] + v[10] * v[645];
+    v[648] = v[647] - v[635];
+    v[649] = v[14] * v[601] + v[10] * v[607] + v[13] * v[600];
+    v[650] = v[649] - v[637];
+    v[637] = v[637] - v[649];
+    v[649] = v[603] - v[638];
+    v[651] = v[4] * v[612] + v[5] * v[614] + v[9] * v[646] + v[10] * v[649];
+    v[652] = v[10] * v[604] + v[13] * v[606] + v[9] * v[603];
+    v[647] = v[647] - v[652];
+    v[653] = v[9] * v[611] + v[10] * v[613] + v[4] * v[637] + v[5] * v[647];
+    v[654] = v[639] - v[605];
+    v[655] = v[5] * v[605];
+    v[656] = v[5] * v[615] - v[9] * v[576] - v[10] * v[568];
+    v[657] = v[19] * v[571] + v[18] * v[583];
+    v[658] = v[14] * v[657];
+    v[659] = v[658] - v[620];
+    v[660] = v[9] * v[616] + v[10] * v[658];
+    v[661] = v[10] * v[622] + v[13] * v[657];
+    v[624] = v[624] - v[661];
+    v[662] = v[4] * v[661];
+    v[663] = v[14] * v[619] + v[19] * v[583];
+    v[664] = v[663] - v[616];
+    v[665] = v[4] * v[629] + v[5] * v[631] + v[9] * v[659] + v[10] * v[664];
+    v[666] = v[10] * v[620] + v[13] * v[621] + v[9] * v[663];
+    v[667] = v[666] - v[660];
+    v[660] = v[660] - v[666];
+    v[666] = v[4] * v[625] + v[9] * v[628] + v[10] * v[630] + v[5] * v[660];
+    v[668] = v[10] * v[577] + v[9] * v[583];
+    v[669] = v[4] * v[626] + v[10] * v[558] - v[5] * v[668];
+    v[670] = v[5] * v[632] - v[9] * v[577] + v[10] * v[583];
+    y[169] = v[19] * (v[471] * v[567] + v[535] * v[572] + v[476] * v[575] + v[532] * v[578] + v[527] * v[581] + v[457] * v[570] + v[518] * v[573] + v[516] * v[576] + v[514] * v[579] + v[509] * v[582] + v[430] * v[571] + v[501] * v[574] + v[499] * v[577] + v[497] * v[580] + v[491] * v[558] + v[484] * v[568] + v[437] * v[583]) - v[18] * (v[478] * v[567] + v[475] * v[575] - v[530] * v[578] + v[523] * v[581] + v[465] * v[570] + v[463] * v[576] + v[512] * v[579] + v[506] * v[582] + v[437] * v[571] + v[427] * v[577] + v[495] * v[580] + v[488] * v[558] + v[457] * v[568] + v[431] * v[583]);
+    y[168] = v[14] * (v[475] * v[585] + v[470] * v[590] + v[524] * v[594] + v[463] * v[601] + v[455] * v[606] + v[507] * v[610] + v[427] * v[617] + v[428] * v[621] + v[489] * v[627] + v[459] * v[633] + v[474] * v[584] + v[461] * v[600] + v[435] * v[657]) - v[13] * (v[474] * v[585] + v[473] * v[586] + v[531] * v[590] + v[526] * v[594] + v[461] * v[601] + v[458] * v[602] + v[513] * v[606] + v[508] * v[610] + v[494] * v[617] + v[431] * v[619] + v[496] * v[621] + v[490] * v[627] + v[483] * v[633] + v[477] * v[584] + v[464] * v[600] + v[436] * v[657]);
+    y[167] = v[10] * (-(v[466] * v[575]) - v[474] * v[592] - v[529] * v[578] + v[525] * v[595] + v[522] * v[597] + v[521] * v[581] - v[448] * v[576] + v[459] * v[608] + v[511] * v[579] + v[453] * v[611] + v[505] * v[613] + v[504] * v[582] + v[425] * v[616] - v[419] * v[577] + v[432] * v[623] + v[493] * v[580] + v[424] * v[628] + v[487] * v[630] + v[486] * v[558] + v[454] * v[638] + v[449] * v[568] + v[472] * v[642] + v[470] * v[643] + v[456] * v[646] + v[455] * v[603] + v[429] * v[659] + v[428] * v[663] + v[422] * v[583]) - v[9] * (v[537] * v[569] + v[468] * v[575] + v[474] * v[591] - v[522] * v[595] - v[469] * v[597] - v[467] * v[581] + v[455] * v[604] + v[452] * v[576] + v[461] * v[607] - v[505] * v[611] + v[453] * v[613] + v[481] * v[582] + v[428] * v[620] + v[422] * v[577] + v[435] * v[622] - v[487] * v[628] + v[424] * v[630] + v[420] * v[558] + v[462] * v[634] + v[470] * v[588] + v[472] * v[587] + v[454] * v[645] + v[456] * v[649] - v[448] * v[568] + v[425] * v[658] + v[429] * v[664] + v[419] * v[583]);
+    y[166] = v[5] * (v[472] * v[596] - v[467] * v[593] + v[481] * v[609] + v[456] * v[612] + v[424] * v[625] + v[420] * v[626] + v[429] * v[629] + v[469] * v[641] + v[423] * v[648] + v[453] * v[637] + v[433] * v[652] + v[418] * v[654] + v[434] * v[661] + v[426] * v[667] + v[421] * v[668]) - v[4] * (v[472] * v[598] + v[466] * v[599] - v[418] * v[609] + v[456] * v[614] + v[448] * v[615] + v[460] * v[618] + v[421] * v[626] + v[429] * v[631] + v[419] * v[632] + v[482] * v[635] + v[481] * v[639] + v[469] * v[644] + v[467] * v[589] + v[423] * v[650] + v[453] * v[647] + v[451] * v[605] + v[426] * v[624] + v[424] * v[660] - v[420] * v[668]);
+    y[165] = v[3] * (-0.241 * (v[9] * v[595]) - 0.42 * v[581] + 0.241 * (v[4] * v[641] - v[10] * v[597] + v[5] * v[644]) + 0.4 * (-(v[4] * v[593]) - v[10] * v[581] + v[5] * v[589]) + v[426] * v[651] + v[421] * v[656] - v[444] * v[568] + v[423] * v[665] + v[418] * v[670] + v[413] * v[583]) - v[2] * (-0.241 * (v[10] * v[569]) + v[444] * v[582] + v[413] * v[558] + v[460] * v[636] + v[421] * v[640] + 0.241 * (v[4] * v[596] + v[5] * v[598] + v[9] * v[642] + v[10] * v[587]) + 0.4 * (v[5] * v[599] - v[9] * v[575]) + v[426] * v[653] + v[450] * v[655] + v[433] * v[662] + v[423] * v[666] + v[418] * v[669]);
+    y[164] = v[1] * (-0.241 * (v[5] * v[618] + v[3] * v[636]) + -0.4 * (v[3] * v[655]) + 0.42 * (v[3] * v[582] - v[2] * v[568]) + 0.241 * (v[2] * v[651] + v[3] * v[653] + v[5] * v[624] + v[4] * v[667]) + 0.4 * (v[5] * v[626] + v[3] * v[640] + v[2] * v[656] + v[4] * v[668])) - v[0] * (-0.241 * (v[4] * v[652] + v[3] * v[662]) + 0.241 * (v[4] * v[648] + v[5] * v[650] + v[2] * v[665] + v[3] * v[666]) + 0.4 * (v[4] * v[654] - v[5] * v[609] + v[3] * v[669] + v[2] * v[670]) + 0.42 * (v[3] * v[558] + v[2] * v[583]));
+    v[558] = x[16] * (v[554] * v[562] / v[561]);
+    y[189] = v[558] + v[558];
+    v[558] = v[559] * v[565] / v[557];
+    v[567] = v[553] * v[558];
+    v[567] = -v[567] - v[567];
+    v[568] = v[554] * v[558];
+    v[566] = v[566] - v[568] - v[568];
+    v[558] = v[556] * v[558];
+    v[558] = v[559] * v[564] - v[558] - v[558];
+    v[559] = x[12] * v[558];
+    v[568] = x[12] * v[566];
+    y[188] = v[538] * v[558] + v[520] * v[566] + v[503] * v[567];
+    v[569] = x[12] * v[567];
+    v[570] = x[11] * v[558];
+    v[571] = x[11] * v[566];
+    y[187] = v[536] * v[558] + v[519] * v[566] + v[502] * v[567];
+    v[572] = x[11] * v[567];
+    v[573] = x[10] * v[558];
+    v[574] = x[10] * v[566];
+    y[186] = v[534] * v[558] + v[517] * v[566] + v[500] * v[567];
+    v[575] = x[10] * v[567];
+    v[576] = x[9] * v[558];
+    v[577] = x[9] * v[566];
+    y[185] = v[533] * v[558] + v[515] * v[566] + v[498] * v[567];
+    v[578] = x[9] * v[567];
+    v[579] = x[8] * v[558];
+    v[580] = x[8] * v[566];
+    y[184] = v[528] * v[558] + v[510] * v[566] + v[492] * v[567];
+    v[558] = x[8] * v[567];
+    v[581] = x[7] * v[566];
+    y[183] = v[438] * v[566] + v[485] * v[567];
+    v[566] = x[7] * v[567];
+    v[567] = v[18] * v[559];
+    v[582] = v[19] * v[559];
+    v[583] = v[18] * v[570];
+    v[584] = v[18] * v[573];
+    v[585] = v[14] * v[584];
+    v[586] = v[13] * v[583] + v[19] * v[573];
+    v[587] = v[10] * v[573];
+    v[588] = v[18] * v[576];
+    v[589] = v[14] * v[588];
+    v[590] = v[19] * v[576];
+    v[591] = v[9] * v[576];
+    v[592] = v[18] * v[579];
+    v[593] = v[14] * v[592];
+    v[594] = v[13] * v[592];
+    v[595] = v[19] * v[579];
+    v[596] = v[9] * v[595] - v[10] * v[593];
+    v[597] = v[9] * v[579];
+    v[598] = v[19] * v[568];
+    v[599] = v[18] * v[571];
+    v[600] = v[18] * v[574];
+    v[601] = v[14] * v[600];
+    v[602] = v[13] * v[599] + v[19] * v[574];
+    v[603] = v[10] * v[574];
+    v[604] = v[18] * v[577];
+    v[605] = v[14] * v[604];
+    v[606] = v[19] * v[577];
+    v[607] = v[9] * v[577];
+    v[608] = v[18] * v[580];
+    v[609] = v[14] * v[608];
+    v[610] = v[13] * v[608];
+    v[611] = v[19] * v[580];
+    v[612] = v[9] * v[611] - v[10] * v[609];
+    v[613] = v[9] * v[580];
+    v[614] = v[18] * v[569];
+    v[615] = v[18] * v[572];
+    v[616] = v[14] * v[615];
+    v[617] = v[18] * v[575];
+    v[618] = v[13] * v[615] + v[19] * v[575];
+    v[619] = v[18] * v[578];
+    v[620] = v[14] * v[619];
+    v[621] = v[19] * v[578];
+    v[622] = v[9] * v[621];
+    v[623] = v[622] - v[616];
+    v[624] = v[9] * v[578];
+    v[625] = v[18] * v[558];
+    v[626] = v[14] * v[625];
+    v[627] = v[13] * v[625];
+    v[628] = v[19] * v[558];
+    v[629] = v[9] * v[628] - v[10] * v[626];
+    v[630] = v[9] * v[558];
+    v[631] = v[18] * v[566];
+    v[632] = v[14] * v[631];
+    v[633] = v[10] * v[632];
+    v[634] = v[5] * v[633];
+    v[635] = v[9] * v[606] + v[13] * v[631];
+    v[636] = v[18] * v[568] + v[19] * v[566];
+    v[637] = v[9] * v[566];
+    v[638] = v[4] * v[607] + v[10] * v[580] + v[5] * v[637];
+    v[639] = v[14] * v[582];
+    v[640] = v[639] - v[586];
+    v[586] = v[586] - v[639];
+    v[639] = v[14] * v[583] + v[10] * v[589] - v[9] * v[590] + v[13] * v[582];
+    v[641] = v[585] - v[567];
+    v[642] = v[13] * v[588] + v[10] * v[586] + v[9] * v[641];
+    v[643] = v[14] * v[598];
+    v[644] = -v[602] - v[632] + v[643];
+    v[645] = v[9] * v[636] + v[10] * v[643];
+    v[646] = v[645] - v[633];
+    v[647] = v[14] * v[599] + v[10] * v[605] + v[13] * v[598];
+    v[648] = v[647] - v[635];
+    v[635] = v[635] - v[647];
+    v[647] = v[601] - v[636];
+    v[649] = v[4] * v[610] + v[5] * v[612] + v[9] * v[644] + v[10] * v[647];
+    v[650] = v[10] * v[602] + v[13] * v[604] + v[9] * v[601];
+    v[645] = v[645] - v[650];
+    v[651] = v[9] * v[609] + v[10] * v[611] + v[4] * v[635] + v[5] * v[645];
+    v[652] = v[637] - v[603];
+    v[653] = v[5] * v[603];
+    v[654] = v[5] * v[613] - v[9] * v[574] - v[10] * v[566];
+    v[655] = v[19] * v[569] + v[18] * v[581];
+    v[656] = v[14] * v[655];
+    v[657] = v[656] - v[618];
+    v[658] = v[9] * v[614] + v[10] * v[656];
+    v[659] = v[10] * v[620] + v[13] * v[655];
+    v[622] = v[622] - v[659];
+    v[660] = v[4] * v[659];
+    v[661] = v[14] * v[617] + v[19] * v[581];
+    v[662] = v[661] - v[614];
+    v[663] = v[4] * v[627] + v[5] * v[629] + v[9] * v[657] + v[10] * v[662];
+    v[664] = v[10] * v[618] + v[13] * v[619] + v[9] * v[661];
+    v[665] = v[664] - v[658];
+    v[658] = v[658] - v[664];
+    v[664] = v[4] * v[623] + v[9] * v[626] + v[10] * v[628] + v[5] * v[658];
+    v[666] = v[10] * v[575] + v[9] * v[581];
+    v[667] = v[4] * v[624] + v[10] * v[558] - v[5] * v[666];
+    v[668] = v[5] * v[630] - v[9] * v[575] + v[10] * v[581];
+    y[182] = v[19] * (v[471] * v[559] + v[535] * v[570] + v[476] * v[573] + v[532] * v[576] + v[527] * v[579] + v[457] * v[568] + v[518] * v[571] + v[516] * v[574] + v[514] * v[577] + v[509] * v[580] + v[430] * v[569] + v[501] * v[572] + v[499] * v[575] + v[497] * v[578] + v[491] * v[558] + v[484] * v[566] + v[437] * v[581]) - v[18] * (v[478] * v[559] + v[475] * v[573] - v[530] * v[576] + v[523] * v[579] + v[465] * v[568] + v[463] * v[574] + v[512] * v[577] + v[506] * v[580] + v[437] * v[569] + v[427] * v[575] + v[495] * v[578] + v[488] * v[558] + v[457] * v[566] + v[431] * v[581]);
+    y[181] = v[14] * (v[475] * v[583] + v[470] * v[588] + v[524] * v[592] + v[463] * v[599] + v[455] * v[604] + v[507] * v[608] + v[427] * v[615] + v[428] * v[619] + v[489] * v[625] + v[459] * v[631] + v[474] * v[582] + v[461] * v[598] + v[435] * v[655]) - v[13] * (v[474] * v[583] + v[473] * v[584] + v[531] * v[588] + v[526] * v[592] + v[461] * v[599] + v[458] * v[600] + v[513] * v[604] + v[508] * v[608] + v[494] * v[615] + v[431] * v[617] + v[496] * v[619] + v[490] * v[625] + v[483] * v[631] + v[477] * v[582] + v[464] * v[598] + v[436] * v[655]);
+    y[180] = v[10] * (-(v[466] * v[573]) - v[474] * v[590] - v[529] * v[576] + v[525] * v[593] + v[522] * v[595] + v[521] * v[579] - v[448] * v[574] + v[459] * v[606] + v[511] * v[577] + v[453] * v[609] + v[505] * v[611] + v[504] * v[580] + v[425] * v[614] - v[419] * v[575] + v[432] * v[621] + v[493] * v[578] + v[424] * v[626] + v[487] * v[628] + v[486] * v[558] + v[454] * v[636] + v[449] * v[566] + v[472] * v[640] + v[470] * v[641] + v[456] * v[644] + v[455] * v[601] + v[429] * v[657] + v[428] * v[661] + v[422] * v[581]) - v[9] * (v[537] * v[567] + v[468] * v[573] + v[474] * v[589] - v[522] * v[593] - v[469] * v[595] - v[467] * v[579] + v[455] * v[602] + v[452] * v[574] + v[461] * v[605] - v[505] * v[609] + v[453] * v[611] + v[481] * v[580] + v[428] * v[618] + v[422] * v[575] + v[435] * v[620] - v[487] * v[626] + v[424] * v[628] + v[420] * v[558] + v[462] * v[632] + v[470] * v[586] + v[472] * v[585] + v[454] * v[643] + v[456] * v[647] - v[448] * v[566] + v[425] * v[656] + v[429] * v[662] + v[419] * v[581]);
+    y[179] = v[5] * (v[472] * v[594] - v[467] * v[591] + v[481] * v[607] + v[456] * v[610] + v[424] * v[623] + v[420] * v[624] + v[429] * v[627] + v[469] * v[639] + v[423] * v[646] + v[453] * v[635] + v[433] * v[650] + v[418] * v[652] + v[434] * v[659] + v[426] * v[665] + v[421] * v[666]) - v[4] * (v[472] * v[596] + v[466] * v[597] - v[418] * v[607] + v[456] * v[612] + v[448] * v[613] + v[460] * v[616] + v[421] * v[624] + v[429] * v[629] + v[419] * v[630] + v[482] * v[633] + v[481] * v[637] + v[469] * v[642] + v[467] * v[587] + v[423] * v[648] + v[453] * v[645] + v[451] * v[603] + v[426] * v[622] + v[424] * v[658] - v[420] * v[666]);
+    y[178] = v[3] * (-0.241 * (v[9] * v[593]) - 0.42 * v[579] + 0.241 * (v[4] * v[639] - v[10] * v[595] + v[5] * v[642]) + 0.4 * (-(v[4] * v[591]) - v[10] * v[579] + v[5] * v[587]) + v[426] * v[649] + v[421] * v[654] - v[444] * v[566] + v[423] * v[663] + v[418] * v[668] + v[413] * v[581]) - v[2] * (-0.241 * (v[10] * v[567]) + v[444] * v[580] + v[413] * v[558] + v[460] * v[634] + v[421] * v[638] + 0.241 * (v[4] * v[594] + v[5] * v[596] + v[9] * v[640] + v[10] * v[585]) + 0.4 * (v[5] * v[597] - v[9] * v[573]) + v[426] * v[651] + v[450] * v[653] + v[433] * v[660] + v[423] * v[664] + v[418] * v[667]);
+    y[177] = v[1] * (-0.241 * (v[5] * v[616] + v[3] * v[634]) + -0.4 * (v[3] * v[653]) + 0.42 * (v[3] * v[580] - v[2] * v[566]) + 0.241 * (v[2] * v[649] + v[3] * v[651] + v[5] * v[622] + v[4] * v[665]) + 0.4 * (v[5] * v[624] + v[3] * v[638] + v[2] * v[654] + v[4] * v[666])) - v[0] * (-0.241 * (v[4] * v[650] + v[3] * v[660]) + 0.241 * (v[4] * v[646] + v[5] * v[648] + v[2] * v[663] + v[3] * v[664]) + 0.4 * (v[4] * v[652] - v[5] * v[607] + v[3] * v[667] + v[2] * v[668]) + 0.42 * (v[3] * v[558] + v[2] * v[581]));
+    v[558] = x[16] * (v[556] * v[562] / v[561]);
+    y[204] = v[558] + v[558];
+    v[557] = v[560] * v[565] / v[557];
+    v[553] = v[553] * v[557];
+    v[553] = -v[553] - v[553];
+    v[554] = v[554] * v[557];
+    v[554] = -v[554] - v[554];
+    v[556] = v[556] * v[557];
+    v[556] = v[565] + (601. + (v[563] + v[560] * v[564])) - v[556] - v[556];
+    v[557] = x[12] * 10.;
+    v[558] = v[520] * v[557];
+    v[559] = v[503] * v[557];
+    v[560] = v[411] * 10. + x[12] * v[556];
+    v[550] = v[550] * v[557] + x[12] * v[554];
+    v[551] = x[12] * v[553] - v[551] * v[557];
+    v[557] = x[12] * v[559];
+    v[561] = x[12] * v[558];
+    v[562] = x[11] * 10.;
+    v[563] = v[519] * v[562];
+    v[564] = v[558] + v[558] + v[563];
+    v[565] = v[502] * v[562];
+    v[566] = -v[559] - v[559] - v[565];
+    v[567] = v[406] * 10. + x[11] * v[556];
+    v[547] = v[547] * v[562] + x[11] * v[554];
+    v[548] = x[11] * v[553] - v[548] * v[562];
+    v[562] = x[11] * v[566];
+    v[568] = x[11] * v[564];
+    v[569] = x[10] * 10.;
+    v[570] = v[517] * v[569];
+    v[563] = v[563] + v[564] + v[570];
+    v[571] = v[500] * v[569];
+    v[565] = v[566] - v[565] - v[571];
+    v[572] = v[400] * 10. + x[10] * v[556];
+    v[542] = v[542] * v[569] + x[10] * v[554];
+    v[543] = x[10] * v[553] - v[543] * v[569];
+    v[569] = x[10] * v[565];
+    v[573] = x[9] * 10.;
+    v[574] = v[515] * v[573];
+    v[570] = v[570] + v[563] + v[574];
+    v[575] = v[498] * v[573];
+    v[571] = v[565] - v[571] - v[575];
+    v[576] = v[393] * 10. + x[9] * v[556];
+    v[545] = v[545] * v[573] + x[9] * v[554];
+    v[544] = x[9] * v[553] - v[544] * v[573];
+    v[573] = x[8] * 10.;
+    v[574] = -v[574] - v[570] - v[510] * v[573];
+    v[575] = v[571] - v[575] - v[492] * v[573];
+    v[577] = v[388] * 10. + x[8] * v[556];
+    v[539] = x[8] * v[554] - v[539] * v[573];
+    v[540] = x[8] * v[553] - v[540] * v[573];
+    v[573] = x[7] * v[554];
+    v[578] = x[7] * v[553];
+    v[579] = v[18] * v[560];
+    v[580] = v[19] * v[560];
+    v[581] = v[18] * v[567];
+    v[582] = v[18] * v[572];
+    v[583] = v[14] * v[582];
+    v[584] = v[13] * v[581] + v[19] * v[572];
+    v[585] = v[10] * v[572];
+    v[586] = v[18] * v[576];
+    v[587] = v[14] * v[586];
+    v[588] = v[19] * v[576];
+    v[589] = v[9] * v[576];
+    v[590] = v[18] * v[577];
+    v[591] = v[14] * v[590];
+    v[592] = v[13] * v[590];
+    v[593] = v[19] * v[577];
+    v[594] = v[9] * v[593] - v[10] * v[591];
+    v[595] = v[9] * v[577];
+    v[596] = v[19] * v[550];
+    v[597] = v[18] * v[547];
+    v[598] = v[18] * v[542];
+    v[599] = v[14] * v[598];
+    v[600] = v[13] * v[597] + v[19] * v[542];
+    v[601] = v[10] * v[542];
+    v[602] = v[18] * v[545];
+    v[603] = v[14] * v[602];
+    v[604] = v[19] * v[545];
+    v[605] = v[9] * v[545];
+    v[606] = v[18] * v[539];
+    v[607] = v[14] * v[606];
+    v[608] = v[13] * v[606];
+    v[609] = v[19] * v[539];
+    v[610] = v[9] * v[609] - v[10] * v[607];
+    v[611] = v[9] * v[539];
+    v[612] = v[18] * v[551];
+    v[613] = v[18] * v[548];
+    v[614] = v[14] * v[613];
+    v[615] = v[18] * v[543];
+    v[616] = v[13] * v[613] + v[19] * v[543];
+    v[617] = v[18] * v[544];
+    v[618] = v[14] * v[617];
+    v[619] = v[19] * v[544];
+    v[620] = v[9] * v[619];
+    v[621] = v[620] - v[614];
+    v[622] = v[9] * v[544];
+    v[623] = v[18] * v[540];
+    v[624] = v[14] * v[623];
+    v[625] = v[13] * v[623];
+    v[626] = v[19] * v[540];
+    v[627] = v[9] * v[626] - v[10] * v[624];
+    v[628] = v[9] * v[540];
+    v[629] = v[18] * v[578];
+    v[630] = v[14] * v[629];
+    v[631] = v[10] * v[630];
+    v[632] = v[5] * v[631];
+    v[633] = v[9] * v[604] + v[13] * v[629];
+    v[634] = v[18] * v[550] + v[19] * v[578];
+    v[635] = v[9] * v[578];
+    v[636] = v[4] * v[605] + v[10] * v[539] + v[5] * v[635];
+    v[637] = v[13] * v[557];
+    v[638] = v[14] * v[580];
+    v[639] = v[638] - v[584];
+    v[584] = v[584] - v[638];
+    v[638] = v[14] * v[581] + v[10] * v[587] - v[9] * v[588] + v[13] * v[580];
+    v[640] = v[583] - v[579];
+    v[641] = v[13] * v[586] + v[10] * v[584] + v[9] * v[640];
+    v[642] = v[14] * v[596];
+    v[643] = -v[600] - v[630] + v[642];
+    v[644] = v[9] * v[634] + v[10] * v[642];
+    v[645] = v[644] - v[631];
+    v[646] = v[14] * v[597] + v[10] * v[603] + v[13] * v[596];
+    v[647] = v[646] - v[633];
+    v[633] = v[633] - v[646];
+    v[646] = v[599] - v[634];
+    v[648] = v[4] * v[608] + v[5] * v[610] + v[9] * v[643] + v[10] * v[646];
+    v[649] = v[10] * v[600] + v[13] * v[602] + v[9] * v[599];
+    v[644] = v[644] - v[649];
+    v[650] = v[9] * v[607] + v[10] * v[609] + v[4] * v[633] + v[5] * v[644];
+    v[651] = v[635] - v[601];
+    v[652] = v[5] * v[601];
+    v[653] = v[5] * v[611] - v[9] * v[542] - v[10] * v[578];
+    v[654] = v[14] * v[557];
+    v[655] = v[10] * v[637] - v[9] * v[562];
+    v[656] = -v[569] - v[654];
+    v[569] = v[569] + v[654];
+    v[654] = v[4] * v[569] + v[5] * v[655];
+    v[657] = x[9] * v[571] + v[9] * v[637] + v[10] * v[562];
+    v[658] = v[19] * v[551] + v[18] * v[573];
+    v[659] = v[14] * v[658];
+    v[660] = v[659] - v[616];
+    v[661] = v[9] * v[612] + v[10] * v[659];
+    v[662] = v[10] * v[618] + v[13] * v[658];
+    v[620] = v[620] - v[662];
+    v[663] = v[4] * v[662];
+    v[664] = v[14] * v[615] + v[19] * v[573];
+    v[665] = v[664] - v[612];
+    v[666] = v[4] * v[625] + v[5] * v[627] + v[9] * v[660] + v[10] * v[665];
+    v[667] = v[10] * v[616] + v[13] * v[617] + v[9] * v[664];
+    v[668] = v[667] - v[661];
+    v[661] = v[661] - v[667];
+    v[667] = v[4] * v[621] + v[9] * v[624] + v[10] * v[626] + v[5] * v[661];
+    v[669] = v[10] * v[543] + v[9] * v[573];
+    v[670] = v[4] * v[622] + v[10] * v[540] - v[5] * v[669];
+    v[671] = v[5] * v[628] - v[9] * v[543] + v[10] * v[573];
+    v[672] = v[13] * v[561];
+    v[673] = v[9] * v[568] + v[10] * v[672];
+    v[674] = x[10] * v[563] - v[14] * v[561];
+    v[675] = v[4] * v[674] - v[5] * v[673];
+    v[676] = x[9] * v[570] - v[9] * v[672] + v[10] * v[568];
+    v[677] = v[538] * 10. / v[133];
+    v[678] = v[129] * v[677];
+    v[679] = v[134] * v[677];
+    v[680] = v[130] * v[677];
+    v[681] = v[18] * v[678];
+    v[682] = (v[536] * 10. - v[681]) / v[187];
+    v[683] = -(0.2155 * v[680]) - v[19] * v[678] - v[184] * v[682];
+    v[684] = v[133] * v[677] - v[20] * v[679] - v[186] * v[682];
+    v[685] = -(v[19] * v[679]) - v[188] * v[682];
+    v[680] = v[680] - v[189] * v[682];
+    v[686] = v[17] * v[680] + v[16] * v[685] + v[14] * v[684] + v[13] * v[683];
+    v[687] = (v[534] * 10. + v[686]) / v[250];
+    v[688] = v[16] * v[680] + v[15] * v[685] + v[13] * v[684] - v[14] * v[683] - v[246] * v[687];
+    v[681] = -v[681] - v[187] * v[682] - v[249] * v[687];
+    v[689] = v[13] * v[680] - v[14] * v[685] - v[251] * v[687];
+    v[690] = -(v[18] * v[679]) - v[185] * v[682] - v[247] * v[687];
+    v[691] = v[14] * v[680] + v[13] * v[685] - v[248] * v[687];
+    v[692] = v[10] * v[681] + v[9] * v[688];
+    v[693] = (v[533] * 10. + v[692]) / v[328];
+    v[694] = 0.2155 * v[691] - v[9] * v[681] + v[10] * v[688] - v[325] * v[693];
+    v[686] = v[250] * v[687] - v[686] + v[12] * v[690] + v[11] * v[689] - v[327] * v[693];
+    v[695] = v[10] * v[689] - v[9] * v[690] - v[329] * v[693];
+    v[691] = -v[691] - v[326] * v[693];
+    v[696] = (v[528] * 10. + v[8] * v[691] + v[7] * v[695] + v[5] * v[686] + v[4] * v[694]) / v[371];
+    v[697] = v[7] * v[691] + v[6] * v[695] + v[4] * v[686] - v[5] * v[694] - v[369] * v[696];
+    v[692] = v[692] - v[328] * v[693] - v[370] * v[696];
+    v[384] = (v[3] * v[692] + v[2] * v[697]) / v[384];
+    y[205] = v[384];
+    v[698] = v[385] * v[384];
+    v[699] = v[2] * v[384];
+    v[700] = v[3] * v[384];
+    v[701] = v[2] * v[698];
+    v[702] = v[3] * v[698];
+    v[703] = v[700] / v[371];
+    v[704] = v[699] / v[371];
+    v[705] = v[696] - v[370] * v[703] - v[369] * v[704];
+    y[206] = v[705];
+    v[706] = -(v[3] * v[701]) - v[29] * v[700];
+    v[707] = v[30] * v[700] - v[3] * v[702];
+    v[708] = v[697] - v[376] * v[700] - v[375] * v[699];
+    v[29] = -(v[2] * v[701]) - v[29] * v[699];
+    v[709] = v[378] * v[700] - v[692] + v[377] * v[699];
+    v[30] = v[30] * v[699] - v[2] * v[702];
+    v[710] = (-(v[370] * v[707]) - v[369] * v[30]) / v[371];
+    v[711] = -(v[387] * v[696]) - v[372] * v[703] - v[374] * v[707] - v[373] * v[706] + v[710];
+    v[369] = (-(v[370] * v[706]) - v[369] * v[29]) / v[371];
+    v[370] = -(v[386] * v[696]) - v[372] * v[704] - v[374] * v[30] - v[373] * v[29] + v[369];
+    v[369] = v[381] * v[703] - v[388] * v[696] + v[379] * v[704] - v[374] * v[710] - v[373] * v[369];
+    v[371] = v[5] * v[699] - v[4] * v[705];
+    v[372] = -(v[5] * v[705]) - v[4] * v[699];
+    v[373] = -(v[7] * v[705]) - v[6] * v[699];
+    v[374] = -(v[8] * v[705]) - v[7] * v[699];
+    v[379] = v[4] * v[369];
+    v[381] = v[5] * v[369];
+    v[696] = v[7] * v[369];
+    v[703] = v[8] * v[369];
+    v[704] = v[4] * v[370] - v[5] * v[29];
+    v[710] = v[5] * v[370] + v[4] * v[29];
+    v[712] = v[7] * v[370] + v[6] * v[29];
+    v[713] = v[8] * v[370] + v[7] * v[29];
+    v[714] = v[5] * v[30];
+    v[715] = v[4] * v[30];
+    v[716] = v[6] * v[30];
+    v[717] = v[7] * v[30];
+    v[718] = v[374] / v[328];
+    v[719] = v[373] / v[328];
+    v[720] = v[700] / v[328];
+    v[721] = v[372] / v[328];
+    v[722] = v[371] / v[328];
+    v[723] = v[693] + v[326] * v[718] + v[329] * v[719] - v[328] * v[720] + v[327] * v[721] + v[325] * v[722];
+    y[207] = v[723];
+    v[724] = v[8] * v[379] + v[7] * v[704] + v[39] * v[374];
+    v[725] = v[8] * v[381] + v[7] * v[710] - v[40] * v[374];
+    v[726] = v[8] * v[696] + v[7] * v[712] + v[41] * v[374];
+    v[727] = v[8] * v[703] + v[7] * v[713] - v[42] * v[374];
+    v[728] = v[7] * v[379] + v[6] * v[704] + v[39] * v[373];
+    v[729] = v[7] * v[381] + v[6] * v[710] - v[40] * v[373];
+    v[730] = v[7] * v[696] + v[6] * v[712] + v[41] * v[373];
+    v[731] = v[7] * v[703] + v[6] * v[713] - v[42] * v[373];
+    v[732] = v[4] * v[711] - v[5] * v[706] - v[39] * v[700];
+    v[733] = v[5] * v[711] + v[4] * v[706] + v[40] * v[700];
+    v[734] = v[7] * v[711] + v[6] * v[706] - v[41] * v[700];
+    v[735] = v[8] * v[711] + v[7] * v[706] + v[42] * v[700];
+    v[736] = v[5] * v[379] + v[4] * v[704] + v[39] * v[372];
+    v[737] = v[5] * v[381] + v[4] * v[710] - v[40] * v[372];
+    v[738] = v[5] * v[696] + v[4] * v[712] + v[41] * v[372];
+    v[739] = v[5] * v[703] + v[4] * v[713] - v[42] * v[372];
+    v[740] = v[694] + v[320] * v[374] + v[340] * v[373] - v[339] * v[700] + v[338] * v[372] + v[337] * v[371];
+    v[39] = v[4] * v[379] - v[5] * v[704] + v[39] * v[371];
+    v[741] = -v[686] - v[276] * v[374] - v[344] * v[373] + v[343] * v[700] - v[342] * v[372] - v[341] * v[371];
+    v[40] = v[4] * v[381] - v[5] * v[710] - v[40] * v[371];
+    v[742] = v[695] + v[353] * v[374] + v[352] * v[373] - v[351] * v[700] + v[350] * v[372] + v[349] * v[371];
+    v[41] = v[4] * v[696] - v[5] * v[712] + v[41] * v[371];
+    v[743] = -v[691] - v[293] * v[374] - v[324] * v[373] + v[323] * v[700] - v[322] * v[372] - v[321] * v[371];
+    v[42] = v[4] * v[703] - v[5] * v[713] - v[42] * v[371];
+    v[744] = (-(v[326] * v[727]) - v[329] * v[731] - v[328] * v[735] - v[327] * v[739] - v[325] * v[42]) / v[328];
+    v[392] = v[717] + (v[331] * v[718] - v[392] * v[693] - v[336] * v[727] - v[335] * v[726]) - v[334] * v[717] - v[333] * v[725] - v[332] * v[724] + v[744];
+    v[745] = (-(v[326] * v[726]) - v[329] * v[730] - v[328] * v[734] - v[327] * v[738] - v[325] * v[41]) / v[328];
+    v[746] = v[716] + (v[331] * v[719] - v[391] * v[693] - v[336] * v[731] - v[335] * v[730]) - v[334] * v[716] - v[333] * v[729] - v[332] * v[728] + v[745];
+    v[716] = (-(v[326] * v[717]) - v[329] * v[716] - v[328] * v[707] - v[327] * v[715] + v[325] * v[714]) / v[328];
+    v[717] = (-(v[326] * v[725]) - v[329] * v[729] - v[328] * v[733] - v[327] * v[737] - v[325] * v[40]) / v[328];
+    v[715] = v[715] + (v[331] * v[721] - v[390] * v[693] - v[336] * v[739] - v[335] * v[738]) - v[334] * v[715] - v[333] * v[737] - v[332] * v[736] + v[717];
+    v[325] = (-(v[326] * v[724]) - v[329] * v[728] - v[328] * v[732] - v[327] * v[736] - v[325] * v[39]) / v[328];
+    v[326] = v[331] * v[722] - v[389] * v[693] - v[336] * v[42] - v[335] * v[41] - v[714] + v[334] * v[714] - v[333] * v[40] - v[332] * v[39] + v[325];
+    v[325] = v[707] + (-(v[393] * v[693]) - v[387] * v[693] - v[360] * v[718] - v[358] * v[719] + v[357] * v[720] - v[331] * v[720] - v[356] * v[721] - v[354] * v[722] - v[336] * v[735] - v[335] * v[734]) - v[334] * v[707] - v[333] * v[733] - v[332] * v[732] - v[336] * v[744] - v[335] * v[745] + v[716] - v[334] * v[716] - v[333] * v[717] - v[332] * v[325];
+    v[327] = -v[700] - v[723];
+    v[328] = v[10] * v[373] + v[11] * v[372];
+    v[329] = v[12] * v[372] - v[9] * v[373];
+    v[331] = v[9] * v[327] + v[10] * v[371];
+    v[332] = v[10] * v[327] - v[9] * v[371];
+    v[333] = 0.2155 * v[371] - v[374];
+    v[334] = v[10] * v[730] + v[11] * v[729];
+    v[335] = v[12] * v[729] - v[9] * v[730];
+    v[336] = v[10] * v[734] + v[11] * v[733];
+    v[354] = v[12] * v[733] - v[9] * v[734];
+    v[356] = v[11] * v[737];
+    v[357] = v[10] * v[738] + v[356];
+    v[358] = v[12] * v[737];
+    v[360] = v[358] - v[9] * v[738];
+    v[387] = v[10] * v[41] + v[11] * v[40];
+    v[393] = v[12] * v[40] - v[9] * v[41];
+    v[693] = v[9] * v[746] + v[10] * v[728];
+    v[707] = v[10] * v[746] - v[9] * v[728];
+    v[714] = 0.2155 * v[728] - v[731];
+    v[716] = v[9] * v[325] + v[10] * v[732];
+    v[717] = v[10] * v[325] - v[9] * v[732];
+    v[718] = 0.2155 * v[732] - v[735];
+    v[719] = v[9] * v[715] + v[10] * v[736];
+    v[720] = v[10] * v[715] - v[9] * v[736];
+    v[721] = 0.2155 * v[736] - v[739];
+    v[722] = v[9] * v[326] + v[10] * v[39];
+    v[731] = v[10] * v[326] - v[9] * v[39];
+    v[42] = 0.2155 * v[39] - v[42];
+    v[735] = v[10] * v[714] + v[11] * v[721];
+    v[739] = v[12] * v[721] - v[9] * v[714];
+    v[744] = v[9] * v[718] + v[10] * v[42];
+    v[745] = v[10] * v[718] - v[9] * v[42];
+    v[727] = v[727] + 0.2155 * (v[42] - v[724]);
+    v[356] = -(v[10] * v[729]) - v[356];
+    v[358] = v[9] * v[729] - v[358];
+    v[747] = -(v[9] * v[733]) - v[10] * v[40];
+    v[748] = v[9] * v[40] - v[10] * v[733];
+    v[749] = v[725] - 0.2155 * v[40];
+    v[750] = v[333] / v[250];
+    v[751] = v[329] / v[250];
+    v[752] = v[328] / v[250];
+    v[753] = v[372] / v[250];
+    v[754] = v[332] / v[250];
+    v[755] = v[331] / v[250];
+    v[756] = v[687] + v[248] * v[750] + v[247] * v[751] + v[251] * v[752] - v[250] * v[753] + v[249] * v[754] + v[246] * v[755];
+    y[208] = v[756];
+    v[757] = -(v[9] * v[392]) - v[10] * v[724] + 0.2155 * v[722] + v[55] * v[333];
+    v[758] = v[9] * v[724] - v[10] * v[392] + 0.2155 * v[731] - v[56] * v[333];
+    v[759] = -(v[10] * v[726]) - v[11] * v[725] + 0.2155 * v[387] + v[57] * v[333];
+    v[760] = v[9] * v[726] - v[12] * v[725] + 0.2155 * v[393] - v[58] * v[333];
+    v[761] = v[12] * v[719] - v[9] * v[693] + v[55] * v[329];
+    v[762] = v[12] * v[720] - v[9] * v[707] - v[56] * v[329];
+    v[763] = v[12] * v[357] - v[9] * v[334] + v[57] * v[329];
+    v[764] = v[12] * v[360] - v[9] * v[335] - v[58] * v[329];
+    v[765] = v[10] * v[693] + v[11] * v[719] + v[55] * v[328];
+    v[766] = v[10] * v[707] + v[11] * v[720] - v[56] * v[328];
+    v[767] = v[10] * v[334] + v[11] * v[357] + v[57] * v[328];
+    v[768] = v[10] * v[335] + v[11] * v[360] - v[58] * v[328];
+    v[769] = -v[719] - v[55] * v[372];
+    v[770] = v[56] * v[372] - v[720];
+    v[771] = -v[357] - v[57] * v[372];
+    v[772] = v[58] * v[372] - v[360];
+    v[773] = v[10] * v[716] - v[9] * v[722] + v[55] * v[332];
+    v[774] = v[10] * v[717] - v[9] * v[731] - v[56] * v[332];
+    v[775] = v[10] * v[336] - v[9] * v[387] + v[57] * v[332];
+    v[776] = v[10] * v[354] - v[9] * v[393] - v[58] * v[332];
+    v[262] = v[688] + v[265] * v[333] + v[264] * v[329] + v[263] * v[328] - v[262] * v[372] + v[261] * v[332] + v[260] * v[331];
+    v[55] = v[9] * v[716] + v[10] * v[722] + v[55] * v[331];
+    v[268] = -v[681] - v[271] * v[333] - v[270] * v[329] - v[269] * v[328] + v[268] * v[372] - v[267] * v[332] - v[266] * v[331];
+    v[56] = v[9] * v[717] + v[10] * v[731] - v[56] * v[331];
+    v[279] = v[689] + v[282] * v[333] + v[281] * v[329] + v[280] * v[328] - v[279] * v[372] + v[278] * v[332] + v[277] * v[331];
+    v[57] = v[9] * v[336] + v[10] * v[387] + v[57] * v[331];
+    v[285] = -v[690] - v[288] * v[333] - v[287] * v[329] - v[286] * v[328] + v[285] * v[372] - v[284] * v[332] - v[283] * v[331];
+    v[58] = v[9] * v[354] + v[10] * v[393] - v[58] * v[331];
+    v[777] = (-(v[248] * v[727]) - v[247] * v[739] - v[251] * v[735] + v[250] * v[721] - v[249] * v[745] - v[246] * v[744]) / v[250];
+    v[778] = v[749] + (v[253] * v[750] - v[395] * v[687] - v[259] * v[727] - v[258] * v[760] - v[257] * v[759]) - v[256] * v[749] - v[255] * v[758] - v[254] * v[757] + v[777];
+    v[779] = (-(v[248] * v[760]) - v[247] * v[764] - v[251] * v[768] - v[250] * v[772] - v[249] * v[776] - v[246] * v[58]) / v[250];
+    v[780] = v[358] + (v[253] * v[751] - v[399] * v[687] - v[259] * v[739] - v[258] * v[764] - v[257] * v[763]) - v[256] * v[358] - v[255] * v[762] - v[254] * v[761] + v[779];
+    v[781] = (-(v[248] * v[759]) - v[247] * v[763] - v[251] * v[767] - v[250] * v[771] - v[249] * v[775] - v[246] * v[57]) / v[250];
+    v[782] = v[356] + (v[253] * v[752] - v[398] * v[687] - v[259] * v[735] - v[258] * v[768] - v[257] * v[767]) - v[256] * v[356] - v[255] * v[766] - v[254] * v[765] + v[781];
+    v[356] = (-(v[248] * v[749]) - v[247] * v[358] - v[251] * v[356] - v[250] * v[737] - v[249] * v[748] - v[246] * v[747]) / v[250];
+    v[358] = (-(v[248] * v[758]) - v[247] * v[762] - v[251] * v[766] - v[250] * v[770] - v[249] * v[774] - v[246] * v[56]) / v[250];
+    v[748] = v[748] + (v[253] * v[754] - v[397] * v[687] - v[259] * v[745] - v[258] * v[776] - v[257] * v[775]) - v[256] * v[748] - v[255] * v[774] - v[254] * v[773] + v[358];
+    v[246] = (-(v[248] * v[757]) - v[247] * v[761] - v[251] * v[765] - v[250] * v[769] - v[249] * v[773] - v[246] * v[55]) / v[250];
+    v[247] = v[747] + (v[253] * v[755] - v[396] * v[687] - v[259] * v[744] - v[258] * v[58] - v[257] * v[57]) - v[256] * v[747] - v[255] * v[56] - v[254] * v[55] + v[246];
+    v[246] = v[737] + (v[390] * v[687] - v[400] * v[687] - v[302] * v[750] - v[300] * v[751] - v[298] * v[752] + v[297] * v[753] - v[253] * v[753] - v[296] * v[754] - v[294] * v[755] + v[259] * v[721] - v[258] * v[772] - v[257] * v[771]) - v[256] * v[737] - v[255] * v[770] - v[254] * v[769] - v[259] * v[777] - v[258] * v[779] - v[257] * v[781] + v[356] - v[256] * v[356] - v[255] * v[358] - v[254] * v[246];
+    v[248] = -v[372] - v[756];
+    v[249] = v[13] * v[248] - v[14] * v[331];
+    v[250] = v[14] * v[248] + v[13] * v[331];
+    v[251] = v[13] * v[333] - v[14] * v[328] + v[16] * v[248] + v[15] * v[331];
+    v[253] = v[14] * v[333] + v[13] * v[328] + v[17] * v[248] + v[16] * v[331];
+    v[254] = v[13] * v[778] - v[14] * v[757];
+    v[255] = v[14] * v[778] + v[13] * v[757];
+    v[256] = v[13] * v[727] - v[14] * v[759] + v[16] * v[778] + v[15] * v[757];
+    v[257] = v[14] * v[727] + v[13] * v[759] + v[17] * v[778] + v[16] * v[757];
+    v[258] = v[13] * v[782] - v[14] * v[765];
+    v[259] = v[14] * v[782] + v[13] * v[765];
+    v[294] = v[13] * v[735] - v[14] * v[767] + v[16] * v[782] + v[15] * v[765];
+    v[296] = v[14] * v[735] + v[13] * v[767] + v[17] * v[782] + v[16] * v[765];
+    v[297] = v[13] * v[246] - v[14] * v[769];
+    v[298] = v[14] * v[246] + v[13] * v[769];
+    v[300] = -(v[13] * v[721]) - v[14] * v[771] + v[16] * v[246] + v[15] * v[769];
+    v[302] = v[13] * v[771] - v[14] * v[721] + v[17] * v[246] + v[16] * v[769];
+    v[356] = v[13] * v[247] - v[14] * v[55];
+    v[358] = v[14] * v[247] + v[13] * v[55];
+    v[400] = v[13] * v[744] - v[14] * v[57] + v[16] * v[247] + v[15] * v[55];
+    v[687] = v[14] * v[744] + v[13] * v[57] + v[17] * v[247] + v[16] * v[55];
+    v[747] = v[13] * v[772] - v[14] * v[58];
+    v[749] = v[14] * v[772] + v[13] * v[58];
+    v[750] = v[13] * v[760] - v[14] * v[768] + v[16] * v[772] + v[15] * v[58];
+    v[751] = v[14] * v[760] + v[13] * v[768] + v[17] * v[772] + v[16] * v[58];
+    v[752] = v[13] * v[770] - v[14] * v[56];
+    v[753] = v[14] * v[770] + v[13] * v[56];
+    v[754] = v[13] * v[758] - v[14] * v[766] + v[16] * v[770] + v[15] * v[56];
+    v[755] = v[14] * v[758] + v[13] * v[766] + v[17] * v[770] + v[16] * v[56];
+    v[777] = v[329] / v[187];
+    v[779] = v[253] / v[187];
+    v[781] = v[251] / v[187];
+    v[783] = v[332] / v[187];
+    v[784] = v[250] / v[187];
+    v[785] = v[249] / v[187];
+    v[786] = v[682] + v[185] * v[777] + v[189] * v[779] + v[188] * v[781] + v[187] * v[783] + v[186] * v[784] + v[184] * v[785];
+    y[209] = v[786];
+    v[787] = v[13] * v[780] - v[14] * v[761] + v[70] * v[329];
+    v[788] = v[14] * v[780] + v[13] * v[761] - v[71] * v[329];
+    v[789] = v[13] * v[739] - v[14] * v[763] + v[16] * v[780] + v[15] * v[761] + v[72] * v[329];
+    v[790] = v[14] * v[739] + v[13] * v[763] + v[17] * v[780] + v[16] * v[761] - v[73] * v[329];
+    v[791] = v[14] * v[254] + v[13] * v[258] + v[17] * v[297] + v[16] * v[356] + v[70] * v[253];
+    v[792] = v[14] * v[255] + v[13] * v[259] + v[17] * v[298] + v[16] * v[358] - v[71] * v[253];
+    v[793] = v[14] * v[256] + v[13] * v[294] + v[17] * v[300] + v[16] * v[400] + v[72] * v[253];
+    v[794] = v[14] * v[257] + v[13] * v[296] + v[17] * v[302] + v[16] * v[687] - v[73] * v[253];
+    v[795] = v[13] * v[254] - v[14] * v[258] + v[16] * v[297] + v[15] * v[356] + v[70] * v[251];
+    v[796] = v[13] * v[255] - v[14] * v[259] + v[16] * v[298] + v[15] * v[358] - v[71] * v[251];
+    v[797] = v[13] * v[256] - v[14] * v[294] + v[16] * v[300] + v[15] * v[400] + v[72] * v[251];
+    v[798] = v[13] * v[257] - v[14] * v[296] + v[16] * v[302] + v[15] * v[687] - v[73] * v[251];
+    v[799] = v[13] * v[748] - v[14] * v[773] + v[70] * v[332];
+    v[800] = v[14] * v[748] + v[13] * v[773] - v[71] * v[332];
+    v[801] = v[13] * v[745] - v[14] * v[775] + v[16] * v[748] + v[15] * v[773] + v[72] * v[332];
+    v[802] = v[14] * v[745] + v[13] * v[775] + v[17] * v[748] + v[16] * v[773] - v[73] * v[332];
+    v[803] = v[14] * v[297] + v[13] * v[356] + v[70] * v[250];
+    v[804] = v[14] * v[298] + v[13] * v[358] - v[71] * v[250];
+    v[805] = v[14] * v[300] + v[13] * v[400] + v[72] * v[250];
+    v[806] = v[14] * v[302] + v[13] * v[687] - v[73] * v[250];
+    v[807] = v[683] + v[202] * v[329] + v[178] * v[253] + v[201] * v[251] + v[200] * v[332] + v[199] * v[250] + v[198] * v[249];
+    v[70] = v[13] * v[297] - v[14] * v[356] + v[70] * v[249];
+    v[808] = -v[684] - v[207] * v[329] - v[146] * v[253] - v[206] * v[251] - v[205] * v[332] - v[204] * v[250] - v[203] * v[249];
+    v[71] = v[13] * v[298] - v[14] * v[358] - v[71] * v[249];
+    v[809] = v[685] + v[217] * v[329] + v[216] * v[253] + v[215] * v[251] + v[214] * v[332] + v[213] * v[250] + v[212] * v[249];
+    v[72] = v[13] * v[300] - v[14] * v[400] + v[72] * v[249];
+    v[810] = -v[680] - v[183] * v[329] - v[132] * v[253] - v[182] * v[251] - v[181] * v[332] - v[180] * v[250] - v[179] * v[249];
+    v[73] = v[13] * v[302] - v[14] * v[687] - v[73] * v[249];
+    v[811] = (-(v[185] * v[764]) - v[189] * v[751] - v[188] * v[750] - v[187] * v[776] - v[186] * v[749] - v[184] * v[747]) / v[187];
+    v[812] = v[762] + (v[191] * v[777] - v[399] * v[682] - v[197] * v[764] - v[196] * v[790] - v[195] * v[789]) - v[194] * v[762] - v[193] * v[788] - v[192] * v[787] + v[811];
+    v[813] = (-(v[185] * v[790]) - v[189] * v[794] - v[188] * v[798] - v[187] * v[802] - v[186] * v[806] - v[184] * v[73]) / v[187];
+    v[405] = v[755] + (v[191] * v[779] - v[405] * v[682] - v[197] * v[751] - v[196] * v[794] - v[195] * v[793]) - v[194] * v[755] - v[193] * v[792] - v[192] * v[791] + v[813];
+    v[814] = (-(v[185] * v[789]) - v[189] * v[793] - v[188] * v[797] - v[187] * v[801] - v[186] * v[805] - v[184] * v[72]) / v[187];
+    v[815] = v[754] + (v[191] * v[781] - v[404] * v[682] - v[197] * v[750] - v[196] * v[798] - v[195] * v[797]) - v[194] * v[754] - v[193] * v[796] - v[192] * v[795] + v[814];
+    v[754] = (-(v[185] * v[762]) - v[189] * v[755] - v[188] * v[754] - v[187] * v[774] - v[186] * v[753] - v[184] * v[752]) / v[187];
+    v[755] = (-(v[185] * v[788]) - v[189] * v[792] - v[188] * v[796] - v[187] * v[800] - v[186] * v[804] - v[184] * v[71]) / v[187];
+    v[753] = v[753] + (v[191] * v[784] - v[403] * v[682] - v[197] * v[749] - v[196] * v[806] - v[195] * v[805]) - v[194] * v[753] - v[193] * v[804] - v[192] * v[803] + v[755];
+    v[184] = (-(v[185] * v[787]) - v[189] * v[791] - v[188] * v[795] - v[187] * v[799] - v[186] * v[803] - v[184] * v[70]) / v[187];
+    v[185] = v[752] + (v[191] * v[785] - v[402] * v[682] - v[197] * v[747] - v[196] * v[73] - v[195] * v[72]) - v[194] * v[752] - v[193] * v[71] - v[192] * v[70] + v[184];
+    v[184] = v[774] + (-(v[406] * v[682]) - v[397] * v[682] - v[229] * v[777] - v[228] * v[779] - v[226] * v[781] - v[225] * v[783] + v[191] * v[783] - v[224] * v[784] - v[222] * v[785] - v[197] * v[776] - v[196] * v[802] - v[195] * v[801]) - v[194] * v[774] - v[193] * v[800] - v[192] * v[799] - v[197] * v[811] - v[196] * v[813] - v[195] * v[814] + v[754] - v[194] * v[754] - v[193] * v[755] - v[192] * v[184];
+    v[186] = v[332] - v[786];
+    v[187] = v[18] * v[329] + v[19] * v[251] + v[20] * v[250];
+    v[188] = v[19] * v[329] - v[18] * v[251] + v[21] * v[250];
+    v[189] = v[18] * v[186] + v[19] * v[249];
+    v[191] = v[19] * v[186] - v[18] * v[249];
+    v[192] = 0.2155 * v[249] - v[253];
+    v[193] = v[18] * v[764] + v[19] * v[789] + v[20] * v[788];
+    v[194] = v[18] * v[750] + v[19] * v[797] + v[20] * v[796];
+    v[195] = v[18] * v[776] + v[19] * v[801] + v[20] * v[800];
+    v[196] = v[20] * v[804];
+    v[197] = v[18] * v[749] + v[19] * v[805] + v[196];
+    v[222] = v[18] * v[747] + v[19] * v[72] + v[20] * v[71];
+    v[224] = v[18] * v[812] + v[19] * v[787];
+    v[225] = 0.2155 * v[787] - v[790];
+    v[226] = v[18] * v[815] + v[19] * v[795];
+    v[228] = 0.2155 * v[795] - v[798];
+    v[229] = v[18] * v[184] + v[19] * v[799];
+    v[397] = 0.2155 * v[799] - v[802];
+    v[406] = v[18] * v[753] + v[19] * v[803];
+    v[682] = 0.2155 * v[803] - v[806];
+    v[752] = v[18] * v[185] + v[19] * v[70];
+    v[73] = 0.2155 * v[70] - v[73];
+    v[754] = v[18] * v[225] + v[19] * v[228] + v[20] * v[682];
+    v[755] = v[18] * v[397] + v[19] * v[73];
+    v[762] = v[794] + 0.2155 * (v[73] - v[791]);
+    v[196] = -(v[18] * v[788]) - v[19] * v[796] - v[196];
+    v[774] = -(v[18] * v[800]) - v[19] * v[71];
+    v[777] = v[792] - 0.2155 * v[71];
+    v[779] = v[192] / v[133];
+    v[781] = v[187] / v[133];
+    v[783] = v[250] / v[133];
+    v[784] = v[189] / v[133];
+    v[785] = v[677] + v[130] * v[779] + v[134] * v[781] - v[133] * v[783] + v[129] * v[784];
+    y[210] = v[785];
+    v[790] = -(v[18] * v[405]) - v[19] * v[791] + 0.2155 * v[752] + v[86] * v[192];
+    v[794] = -(v[18] * v[751]) - v[19] * v[793] - v[20] * v[792] + 0.2155 * v[222] + v[88] * v[192];
+    v[798] = v[18] * v[224] + v[19] * v[226] + v[20] * v[406] + v[86] * v[187];
+    v[802] = v[18] * v[193] + v[19] * v[194] + v[20] * v[197] + v[88] * v[187];
+    v[806] = -v[406] - v[86] * v[250];
+    v[811] = -v[197] - v[88] * v[250];
+    v[813] = -(0.00072 * v[187]) - 0.0036 * v[191];
+    v[143] = v[128] * v[192] - v[678] + -0.00072 * v[188] + v[127] * v[187] - v[143] * v[250] + v[142] * v[189];
+    v[86] = v[18] * v[229] + v[19] * v[752] + v[86] * v[189];
+    v[148] = v[150] * v[192] - v[679] + v[149] * v[187] - v[148] * v[250] + 0.00072 * v[191] + v[147] * v[189];
+    v[88] = v[18] * v[195] + v[19] * v[222] + v[88] * v[189];
+    v[814] = -(2.1 * v[188]) - -0.00072 * v[189];
+    v[816] = v[762] + v[802];
+    v[817] = (-(v[130] * v[762]) - v[134] * v[754] + v[133] * v[682] - v[129] * v[755]) / v[133];
+    v[408] = v[777] + (v[137] * v[779] - v[408] * v[677] - v[141] * v[762] - v[140] * v[794]) - v[139] * v[777] - v[138] * v[790] + v[817];
+    v[762] = (-(v[130] * v[794]) - v[134] * v[802] - v[133] * v[811] - v[129] * v[88]) / v[133];
+    v[410] = v[196] + (v[137] * v[781] - v[410] * v[677] - v[141] * v[754] - v[140] * v[802]) - v[139] * v[196] - v[138] * v[798] + v[762];
+    v[196] = (-(v[130] * v[777]) - v[134] * v[196] - v[133] * v[804] - v[129] * v[774]) / v[133];
+    v[129] = (-(v[130] * v[790]) - v[134] * v[798] - v[133] * v[806] - v[129] * v[86]) / v[133];
+    v[130] = v[774] + (v[137] * v[784] - v[409] * v[677] - v[141] * v[755] - v[140] * v[88]) - v[139] * v[774] - v[138] * v[86] + v[129];
+    v[129] = v[804] + (v[403] * v[677] - v[411] * v[677] - v[156] * v[779] - v[154] * v[781] + v[153] * v[783] - v[137] * v[783] - v[135] * v[784] + v[141] * v[682] - v[140] * v[811]) - v[139] * v[804] - v[138] * v[806] - v[141] * v[817] - v[140] * v[762] + v[196] - v[139] * v[196] - v[138] * v[129];
+    v[133] = -v[250] - v[785];
+    v[134] = v[22] * v[133] - v[23] * v[189];
+    v[135] = v[23] * v[133] + v[22] * v[189];
+    v[137] = v[22] * v[192] - v[23] * v[187] + v[25] * v[133] + v[24] * v[189];
+    v[138] = v[23] * v[192] + v[22] * v[187] + v[26] * v[133] + v[25] * v[189];
+    v[139] = v[794] - v[754];
+    v[140] = v[754] - v[794];
+    v[141] = v[790] - v[410];
+    v[153] = v[798] + v[408];
+    v[154] = v[22] * v[129] - v[23] * v[806];
+    v[156] = v[23] * v[129] + v[22] * v[806];
+    v[196] = -(v[22] * v[682]) - v[23] * v[811] + v[25] * v[129] + v[24] * v[806];
+    v[409] = v[22] * v[811] - v[23] * v[682] + v[26] * v[129] + v[25] * v[806];
+    v[411] = v[22] * v[130] - v[23] * v[86];
+    v[677] = v[23] * v[130] + v[22] * v[86];
+    v[754] = v[22] * v[755] - v[23] * v[88] + v[25] * v[130] + v[24] * v[86];
+    v[762] = v[23] * v[755] + v[22] * v[88] + v[26] * v[130] + v[25] * v[86];
+    v[774] = 0.001 * (v[191] / 0.001);
+    y[211] = v[774];
+    v[777] = -(0.006 * v[137]) - 0.001 * v[135];
+    v[779] = 0.3 * v[137] + 0.006 * v[135];
+    v[781] = -0.006 * v[138] + 0.001 * v[134];
+    v[783] = -(0.3 * v[138]) - -0.006 * v[134];
+    v[784] = v[191] - v[774];
+    v[794] = v[96] * v[784] - v[100] * v[134];
+    v[802] = v[100] * v[135] - v[97] * v[784];
+    v[817] = v[96] * v[188] - v[100] * v[137] - v[83] * v[134] + v[98] * v[784];
+    v[100] = v[100] * v[138] - v[97] * v[188] + v[83] * v[135] - v[99] * v[784];
+    v[818] = v[108] * v[138] - v[109] * v[137] - v[106] * v[134] + v[105] * v[135] + 0.001 * (v[97] * v[134] - v[96] * v[135]);
+    v[819] = v[109] * v[784] - v[110] * v[135] + 0.3 * v[100] + 0.006 * v[794] + x[13] * v[783];
+    v[820] = v[110] * v[134] - v[108] * v[784] + 0.3 * v[817] + -0.006 * v[802] + x[13] * v[779];
+    v[106] = v[109] * v[188] - v[110] * v[138] - v[107] * v[135] + v[106] * v[784] + -0.006 * v[817] + 0.001 * v[802] + x[13] * v[777];
+    v[100] = v[110] * v[137] - v[108] * v[188] + v[107] * v[134] - v[105] * v[784] + 0.006 * v[100] + 0.001 * v[794] + x[13] * v[781];
+    v[105] = v[81] * v[189] - v[80] * v[191];
+    v[107] = v[80] * v[133] - v[85] * v[189];
+    v[110] = v[85] * v[191] - v[81] * v[133];
+    v[784] = v[81] * v[187] - v[80] * v[188] + v[83] * v[189] - v[82] * v[191];
+    v[794] = v[80] * v[192] - v[85] * v[187] - v[84] * v[189] + v[82] * v[133];
+    v[802] = v[85] * v[188] - v[81] * v[192] + v[84] * v[191] - v[83] * v[133];
+    v[817] = v[26] * v[820] + v[25] * v[819] + v[23] * v[100] + v[22] * v[106] - v[94] * v[187] + v[93] * v[188] - v[91] * v[189] + v[90] * v[191] + -0.00108 * v[802] + 0.0047 * v[105];
+    v[821] = v[23] * v[820] + v[22] * v[819] - v[94] * v[189] + v[93] * v[191] + 1.8 * v[784] + 0.00108 * v[110];
+    v[105] = v[22] * v[820] - v[23] * v[819] - v[95] * v[191] + v[94] * v[133] + 1.8 * v[802] + -0.00108 * v[105] + 0.00072 * v[107] + x[12] * v[814];
+    v[108] = v[108] * v[135] - v[109] * v[134] + 0.3 * (v[97] * v[137] - v[96] * v[138] + v[99] * v[134] - v[98] * v[135]) + v[95] * v[189] - v[93] * v[133] + 1.8 * v[794] + -0.00072 * v[110] + x[12] * v[148];
+    v[91] = v[25] * v[820] + v[24] * v[819] + v[22] * v[100] - v[23] * v[106] - v[95] * v[188] + v[94] * v[192] - v[92] * v[191] + v[91] * v[133] + 0.00108 * v[784] + -0.00072 * v[794] + 0.0005 * v[110] + x[12] * v[813];
+    v[90] = v[818] + v[95] * v[187] - v[93] * v[192] + v[92] * v[189] - v[90] * v[133] + 0.00072 * v[802] + 0.0036 * v[107] + x[12] * v[143];
+    v[92] = v[66] * v[249] - v[65] * v[250];
+    v[93] = v[65] * v[186] - v[69] * v[249];
+    v[94] = v[69] * v[250] - v[66] * v[186];
+    v[95] = v[66] * v[251] - v[65] * v[253] + v[68] * v[249] - v[67] * v[250];
+    v[107] = v[65] * v[329] - v[69] * v[251] - v[52] * v[249] + v[67] * v[186];
+    v[109] = v[69] * v[253] - v[66] * v[329] + v[52] * v[250] - v[68] * v[186];
+    v[110] = v[19] * v[90] + v[18] * v[91] - v[78] * v[251] + v[77] * v[253] - v[75] * v[249] + v[74] * v[250] + 0.00017 * v[107] + -0.0357 * v[109] + 0.0058 * v[92] + -0.0027 * v[93];
+    v[134] = v[19] * v[105] - v[18] * v[108] - v[79] * v[250] + v[78] * v[186] + 1.7 * v[109] + -0.0357 * v[92] + 0.1292 * v[93] + x[11] * v[810];
+    v[135] = v[79] * v[249] - v[821] - v[77] * v[186] + 1.7 * v[107] + 0.00017 * v[92] + -0.1292 * v[94] + x[11] * v[809];
+    v[75] = 0.2155 * v[821] - v[18] * v[90] + v[19] * v[91] - v[79] * v[253] + v[78] * v[329] - v[76] * v[250] + v[75] * v[186] + 0.0357 * v[95] + -0.1292 * v[107] + 0.0306 * v[94] + x[11] * v[808];
+    v[20] = v[21] * v[108] - v[817] + v[20] * v[105] + v[79] * v[251] - v[77] * v[329] + v[76] * v[249] - v[74] * v[186] + -0.00017 * v[95] + 0.1292 * v[109] + -0.0027 * v[92] + 0.0279 * v[93] + x[11] * v[807];
+    v[74] = v[50] * v[331] - v[49] * v[332];
+    v[76] = v[49] * v[248] - v[54] * v[331];
+    v[79] = v[54] * v[332] - v[50] * v[248];
+    v[92] = v[50] * v[328] - v[49] * v[329] + v[52] * v[331] - v[51] * v[332];
+    v[107] = v[49] * v[333] - v[54] * v[328] - v[53] * v[331] + v[51] * v[248];
+    v[109] = v[54] * v[329] - v[50] * v[333] + v[53] * v[332] - v[52] * v[248];
+    v[17] = v[17] * v[135] + v[16] * v[134] + v[14] * v[20] + v[13] * v[75] - v[63] * v[328] + v[62] * v[329] - v[60] * v[331] + v[59] * v[332] + -0.1809 * v[109] + 0.0411 * v[74] + -0.0061 * v[76];
+    v[137] = v[14] * v[135] + v[13] * v[134] - v[63] * v[331] + v[62] * v[332] + 2.7 * v[92] + 0.1809 * v[79];
+    v[138] = v[13] * v[135] - v[14] * v[134] - v[64] * v[332] + v[63] * v[248] + 2.7 * v[109] + -0.1809 * v[74] + 0.0918 * v[76] + x[10] * v[285];
+    v[77] = v[19] * v[108] + v[18] * v[105] - v[78] * v[249] + v[77] * v[250] + 1.7 * v[95] + -0.00017 * v[93] + 0.0357 * v[94] + v[64] * v[331] - v[62] * v[248] + 2.7 * v[107] + -0.0918 * v[79] + x[10] * v[279];
+    v[15] = v[16] * v[135] + v[15] * v[134] + v[13] * v[20] - v[14] * v[75] - v[64] * v[329] + v[63] * v[333] - v[61] * v[332] + v[60] * v[248] + 0.1809 * v[92] + -0.0918 * v[107] + 0.0452 * v[79] + x[10] * v[268];
+    v[16] = v[110] + v[64] * v[328] - v[62] * v[333] + v[61] * v[331] - v[59] * v[248] + 0.0918 * v[109] + -0.0061 * v[74] + 0.0131 * v[76] + x[10] * v[262];
+    v[59] = v[35] * v[371] - v[34] * v[372];
+    v[60] = v[34] * v[327] - v[38] * v[371];
+    v[61] = v[38] * v[372] - v[35] * v[327];
+    v[62] = v[36] * v[327] - v[38] * v[373];
+    v[63] = v[38] * v[374] - v[37] * v[327];
+    v[64] = v[10] * v[16] + v[9] * v[15] - v[47] * v[373] + v[46] * v[374] - v[44] * v[371] + v[43] * v[372] + -0.09 * v[63] + 0.0127 * v[59] + -0.0117 * v[60];
+    v[47] = v[10] * v[138] - v[9] * v[77] - v[48] * v[372] + v[47] * v[327] + 3. * v[63] + -0.09 * v[59] + 0.39 * v[60] + x[9] * v[743];
+    v[46] = v[48] * v[371] - v[137] - v[46] * v[327] + 3. * v[62] + -0.39 * v[61] + x[9] * v[742];
+    v[44] = 0.2155 * v[137] - v[9] * v[16] + v[10] * v[15] - v[48] * v[374] - v[45] * v[372] + v[44] * v[327] + 0.09 * (v[35] * v[373] - v[34] * v[374] + v[37] * v[371] - v[36] * v[372]) + -0.39 * v[62] + 0.1334 * v[61] + x[9] * v[741];
+    v[11] = v[12] * v[77] - v[17] + v[11] * v[138] + v[48] * v[373] + v[45] * v[371] - v[43] * v[327] + 0.39 * v[63] + -0.0117 * v[59] + 0.1257 * v[60] + x[9] * v[740];
+    v[6] = v[7] * v[46] + v[6] * v[47] + v[4] * v[11] - v[5] * v[44] + v[33] * v[700] - v[32] * v[705] + 0.071 * (v[28] * v[705] - x[8] * v[700]) + x[8] * v[709];
+    v[12] = v[64] - v[33] * v[699] + v[31] * v[705] + 0.025 * (x[8] * v[699] - v[27] * v[705]) + x[8] * v[708];
+    y[196] = v[23] * (v[102] * v[192] + v[101] * v[187] + v[113] * v[133] + v[114] * v[189] - v[123] * v[682] + v[121] * v[755] + v[124] * v[139] + v[125] * v[816] + v[126] * v[811] + v[122] * v[88] + v[118] * v[408] + v[117] * v[410] + v[116] * v[129] + v[104] * v[130] + v[120] * v[790] - v[119] * v[798] + v[103] * v[806] + v[115] * v[86] + 0.3 * (v[23] * v[140] + v[22] * v[816] + v[26] * v[410] + v[24] * v[790] + v[25] * v[153]) + 0.006 * (v[23] * v[408] + v[22] * v[790] + v[754]) + -0.006 * (v[22] * v[410] - v[23] * v[798] + v[409]) + 0.001 * (v[154] + v[677]) + v[82] * v[820] + v[84] * v[819] + v[80] * v[100] + v[85] * v[106] + -0.081 * (v[101] * v[133] + v[124] * v[408] + v[125] * v[410] + v[126] * v[129] + v[122] * v[130] + 0.3 * v[409] + -0.006 * v[154] + v[85] * v[820]) + 0.081 * (v[102] * v[189] + v[125] * v[790] - v[124] * v[798] + v[123] * v[806] + v[121] * v[86] + 0.3 * v[754] + 0.006 * v[677] + v[80] * v[819])) - v[22] * (v[101] * v[192] - v[102] * v[187] + v[114] * v[133] - v[113] * v[189] - v[126] * v[682] + v[122] * v[755] + v[125] * v[140] + v[124] * v[816] - v[123] * v[811] - v[121] * v[88] + v[120] * v[408] - v[119] * v[410] + v[103] * v[129] + v[115] * v[130] - v[118] * v[790] - v[117] * v[798] - v[116] * v[806] - v[104] * v[86] + 0.3 * (v[22] * v[139] + v[23] * v[816] + v[26] * v[408] + v[25] * v[141] - v[24] * v[798]) + 0.006 * (-(v[23] * v[410]) - v[22] * v[798] + v[196]) + -0.006 * (v[22] * v[408] - v[23] * v[790] - v[762]) + 0.001 * (v[156] - v[411]) + v[84] * v[820] - v[82] * v[819] + v[85] * v[100] - v[80] * v[106] + 0.081 * (v[102] * v[133] + v[101] * v[189] + v[123] * v[129] + v[121] * v[130] + v[124] * v[141] + v[125] * v[153] + v[126] * v[806] + v[122] * v[86] + 0.3 * (v[196] + v[762]) + 0.006 * v[156] + -0.006 * v[411] + v[80] * v[820] + v[85] * v[819]));
+    y[195] = v[19] * (v[471] * v[560] + v[535] * v[567] + v[476] * v[572] + v[532] * v[576] + v[527] * v[577] + v[457] * v[550] + v[518] * v[547] + v[516] * v[542] + v[514] * v[545] + v[509] * v[539] + v[430] * v[551] + v[501] * v[548] + v[499] * v[543] + v[497] * v[544] + v[491] * v[540] + v[484] * v[578] + v[437] * v[573] - v[399] * v[679] - v[407] * v[678] + v[155] * v[329] - v[89] * v[251] + v[152] * v[186] - v[111] * v[249] + v[174] * v[764] - v[150] * v[751] + v[173] * v[750] + v[172] * v[776] + v[171] * v[749] + v[170] * v[747] - v[177] * v[789] + v[176] * v[797] - v[161] * v[801] - v[175] * v[805] - v[163] * v[72] + v[164] * v[812] - v[128] * v[405] + v[162] * v[815] + v[160] * v[184] + v[159] * v[753] + v[158] * v[185] - v[169] * v[787] - v[168] * v[795] - v[167] * v[799] - v[166] * v[803] + v[165] * v[70] + v[131] * v[225] + v[151] * v[397] + 2.1 * (v[18] * v[797] - v[19] * v[750] - v[21] * v[796]) + v[149] * v[193] + v[147] * v[195] - v[145] * v[788] - v[144] * v[800] + 0.00072 * (v[19] * v[812] - v[18] * v[787] - v[222]) + 0.0036 * (v[18] * v[70] - v[19] * v[185]) + v[127] * v[224] + -0.00072 * (v[19] * v[776] - v[18] * v[801] + v[21] * v[800] - v[226]) + v[142] * v[229] - v[67] * v[108] + v[52] * v[105] - v[65] * v[90] + v[69] * v[91] + -0.2155 * (v[89] * v[250] + v[177] * v[788] - v[176] * v[796] + v[161] * v[800] + v[175] * v[804] + v[163] * v[71] + 2.1 * (v[19] * v[749] - v[18] * v[805] + v[21] * v[804]) + -0.00072 * v[406] + v[66] * v[108])) - v[18] * (v[478] * v[560] + v[475] * v[572] - v[530] * v[576] + v[523] * v[577] + v[465] * v[550] + v[463] * v[542] + v[512] * v[545] + v[506] * v[539] + v[437] * v[551] + v[427] * v[543] + v[495] * v[544] + v[488] * v[540] + v[457] * v[578] + v[431] * v[573] - v[404] * v[679] - v[402] * v[678] + v[89] * v[329] + v[155] * v[251] + v[111] * v[186] + v[152] * v[249] + v[177] * v[764] - v[176] * v[750] + v[161] * v[776] + v[175] * v[749] + v[163] * v[747] + v[174] * v[789] - v[150] * v[793] + v[173] * v[797] + v[172] * v[801] + v[171] * v[805] + v[170] * v[72] + v[169] * v[812] + v[168] * v[815] + v[167] * v[184] + v[166] * v[753] - v[165] * v[185] + v[164] * v[787] - v[128] * v[791] + v[162] * v[795] + v[160] * v[799] + v[159] * v[803] + v[158] * v[70] + v[131] * v[228] + v[151] * v[73] + 2.1 * (v[19] * v[764] - v[18] * v[789] + v[21] * v[788]) + v[149] * v[194] + v[147] * v[222] - v[145] * v[796] - v[144] * v[71] + 0.00072 * (v[195] + (v[19] * v[815] - v[18] * v[795])) + 0.0036 * (v[19] * v[184] - v[18] * v[799]) + -0.00072 * (v[19] * v[747] - v[18] * v[72] + v[21] * v[71] + v[224]) + v[127] * v[226] + v[142] * v[752] + v[52] * v[108] + v[67] * v[105] + v[69] * v[90] + v[65] * v[91] + 0.2155 * (v[155] * v[250] - v[403] * v[679] + v[174] * v[788] - v[150] * v[792] + v[173] * v[796] + v[172] * v[800] + v[171] * v[804] + v[170] * v[71] + v[131] * v[682] + v[149] * v[197] - v[145] * v[804] + 0.00072 * (v[19] * v[753] - v[18] * v[803]) + v[127] * v[406] + v[66] * v[105]));
+    y[194] = v[14] * (v[475] * v[581] + v[470] * v[586] + v[524] * v[590] + v[463] * v[597] + v[455] * v[602] + v[507] * v[606] + v[427] * v[613] + v[428] * v[617] + v[489] * v[623] + v[459] * v[629] - v[442] * v[557] + v[474] * v[580] + v[461] * v[596] + v[435] * v[658] + v[416] * v[561] + v[398] * v[680] + v[395] * v[685] + v[396] * v[684] + v[401] * v[683] + v[227] * v[333] + v[157] * v[328] + v[223] * v[248] + v[136] * v[331] + v[241] * v[727] + v[217] * v[739] + v[240] * v[735] - v[239] * v[721] + v[214] * v[745] + v[238] * v[744] + v[245] * v[759] + v[183] * v[763] + v[244] * v[767] + v[243] * v[771] + v[181] * v[775] + v[242] * v[57] + v[233] * v[778] + v[202] * v[780] + v[232] * v[782] + v[231] * v[246] + v[200] * v[748] + v[230] * v[247] + v[237] * v[757] + v[207] * v[761] + v[236] * v[765] + v[235] * v[769] + v[205] * v[773] + v[234] * v[55] + v[220] * v[760] + v[221] * v[768] + v[218] * v[772] + v[219] * v[58] + v[182] * v[257] + v[132] * v[296] + v[179] * v[302] + v[180] * v[687] + v[215] * v[256] + v[216] * v[294] + v[212] * v[300] + v[213] * v[400] + v[210] * v[758] + v[211] * v[766] + v[208] * v[770] + v[209] * v[56] + v[206] * v[255] + v[146] * v[259] + v[203] * v[298] + v[204] * v[358] + v[201] * v[254] + v[178] * v[258] + v[198] * v[297] + v[199] * v[356] + v[51] * v[135] + v[53] * v[134] + v[49] * v[20] + v[54] * v[75] + -0.1845 * (v[401] * v[680] + v[157] * v[248] + v[245] * v[778] + v[183] * v[780] + v[244] * v[782] + v[243] * v[246] + v[181] * v[748] + v[242] * v[247] + v[221] * v[772] + v[132] * v[302] + v[216] * v[300] + v[211] * v[770] + v[146] * v[298] + v[178] * v[297] + v[54] * v[135]) + 0.1845 * (v[396] * v[685] + v[227] * v[331] + v[241] * v[757] + v[217] * v[761] + v[240] * v[765] + v[239] * v[769] + v[214] * v[773] + v[238] * v[55] + v[220] * v[58] + v[182] * v[687] + v[215] * v[400] + v[210] * v[56] + v[206] * v[358] + v[201] * v[356] + v[49] * v[134])) - v[13] * (v[474] * v[581] + v[473] * v[582] + v[531] * v[586] + v[526] * v[590] + v[461] * v[597] + v[458] * v[598] + v[513] * v[602] + v[508] * v[606] + v[494] * v[613] + v[431] * v[615] + v[496] * v[617] + v[490] * v[623] + v[483] * v[629] + v[414] * v[561] + v[477] * v[580] + v[464] * v[596] - v[445] * v[557] + v[436] * v[658] + v[395] * v[680] - v[398] * v[685] + v[401] * v[684] - v[396] * v[683] + v[157] * v[333] - v[227] * v[328] + v[136] * v[248] - v[223] * v[331] + v[245] * v[727] + v[183] * v[739] + v[244] * v[735] - v[243] * v[721] + v[181] * v[745] + v[242] * v[744] - v[241] * v[759] - v[217] * v[763] - v[240] * v[767] - v[239] * v[771] - v[214] * v[775] - v[238] * v[57] + v[237] * v[778] + v[207] * v[780] + v[236] * v[782] + v[235] * v[246] + v[205] * v[748] + v[234] * v[247] - v[233] * v[757] - v[202] * v[761] - v[232] * v[765] - v[231] * v[769] - v[200] * v[773] - v[230] * v[55] + v[221] * v[760] - v[220] * v[768] + v[219] * v[772] - v[218] * v[58] + v[132] * v[257] - v[182] * v[296] + v[180] * v[302] - v[179] * v[687] + v[216] * v[256] - v[215] * v[294] + v[213] * v[300] - v[212] * v[400] + v[211] * v[758] - v[210] * v[766] + v[209] * v[770] - v[208] * v[56] + v[146] * v[255] - v[206] * v[259] + v[204] * v[298] - v[203] * v[358] + v[178] * v[254] - v[201] * v[258] + v[199] * v[297] - v[198] * v[356] + v[53] * v[135] - v[51] * v[134] + v[54] * v[20] - v[49] * v[75] + 0.1845 * (v[396] * v[680] + v[401] * v[685] + v[227] * v[248] + v[157] * v[331] + v[241] * v[778] + v[217] * v[780] + v[240] * v[782] + v[239] * v[246] + v[214] * v[748] + v[238] * v[247] + v[245] * v[757] + v[183] * v[761] + v[244] * v[765] + v[243] * v[769] + v[181] * v[773] + v[242] * v[55] + v[220] * v[772] + v[221] * v[58] + v[182] * v[302] + v[132] * v[687] + v[215] * v[300] + v[216] * v[400] + v[210] * v[770] + v[211] * v[56] + v[206] * v[298] + v[146] * v[358] + v[201] * v[297] + v[178] * v[356] + v[49] * v[135] + v[54] * v[134]));
+    y[193] = v[10] * (-(v[466] * v[572]) - v[474] * v[588] - v[529] * v[576] + v[525] * v[591] + v[522] * v[593] + v[521] * v[577] - v[448] * v[542] + v[459] * v[604] + v[511] * v[545] + v[453] * v[607] + v[505] * v[609] + v[504] * v[539] + v[425] * v[612] - v[419] * v[543] + v[432] * v[619] + v[493] * v[544] + v[424] * v[624] + v[487] * v[626] + v[486] * v[540] + v[454] * v[634] + v[449] * v[578] + v[472] * v[639] + v[470] * v[640] + v[456] * v[643] + v[455] * v[599] + v[446] * v[562] + v[439] * v[637] + v[429] * v[660] + v[428] * v[664] + v[422] * v[573] + v[415] * v[568] - v[87] * v[672] - v[391] * v[690] - v[389] * v[681] + v[394] * v[688] - v[301] * v[373] + v[295] * v[327] - v[190] * v[371] + v[288] * v[726] - v[319] * v[730] - v[318] * v[734] - v[317] * v[738] - v[316] * v[41] - v[265] * v[392] + v[307] * v[746] + v[306] * v[325] + v[305] * v[715] + v[304] * v[326] + v[271] * v[724] - v[311] * v[728] - v[310] * v[732] - v[309] * v[736] - v[308] * v[39] - v[292] * v[714] + v[289] * v[718] - v[290] * v[42] - v[287] * v[335] + v[283] * v[354] - v[284] * v[393] - v[281] * v[334] + v[277] * v[336] - v[278] * v[387] + v[275] * v[729] - v[272] * v[733] + v[273] * v[40] - v[270] * v[707] + v[266] * v[717] - v[267] * v[731] - v[264] * v[693] + v[260] * v[716] - v[261] * v[722] - v[36] * v[77] - v[34] * v[16] + v[38] * v[15] + -0.2155 * (v[390] * v[690] + v[301] * v[372] - v[288] * v[725] + v[319] * v[729] + v[318] * v[733] + v[317] * v[737] + v[316] * v[40] + v[292] * v[721] + v[287] * v[360] + v[281] * v[357] - v[275] * v[737] + v[270] * v[720] + v[264] * v[719] + v[35] * v[77])) - v[9] * (v[537] * v[579] + v[468] * v[572] + v[474] * v[587] - v[522] * v[591] - v[469] * v[593] - v[467] * v[577] + v[455] * v[600] + v[452] * v[542] + v[461] * v[603] - v[505] * v[607] + v[453] * v[609] + v[481] * v[539] + v[428] * v[616] + v[422] * v[543] + v[435] * v[618] - v[487] * v[624] + v[424] * v[626] + v[420] * v[540] + v[462] * v[630] + v[470] * v[584] + v[472] * v[583] + v[454] * v[642] + v[456] * v[646] - v[448] * v[578] - v[440] * v[637] + v[439] * v[562] + v[425] * v[659] + v[429] * v[665] + v[419] * v[573] + v[415] * v[672] + v[87] * v[568] + v[391] * v[689] + v[394] * v[681] + v[389] * v[688] + v[299] * v[373] + v[190] * v[327] + v[295] * v[371] - v[282] * v[726] + v[315] * v[730] + v[314] * v[734] + v[313] * v[738] + v[312] * v[41] - v[271] * v[392] + v[311] * v[746] + v[310] * v[325] + v[309] * v[715] + v[308] * v[326] - v[265] * v[724] + v[307] * v[728] + v[306] * v[732] + v[305] * v[736] + v[304] * v[39] + v[291] * v[714] + v[290] * v[718] + v[289] * v[42] + v[286] * v[335] + v[284] * v[354] + v[283] * v[393] + v[280] * v[334] + v[278] * v[336] + v[277] * v[387] - v[274] * v[729] - v[273] * v[733] - v[272] * v[40] + v[269] * v[707] + v[267] * v[717] + v[266] * v[731] + v[263] * v[693] + v[261] * v[716] + v[260] * v[722] + v[36] * v[138] + v[38] * v[16] + v[34] * v[15] + 0.2155 * (v[390] * v[689] + v[299] * v[372] - v[282] * v[725] + v[315] * v[729] + v[314] * v[733] + v[313] * v[737] + v[312] * v[40] + v[291] * v[721] + v[286] * v[360] + v[280] * v[357] - v[274] * v[737] + v[269] * v[720] + v[263] * v[719] + v[35] * v[138]));
+    y[192] = v[5] * (v[472] * v[592] - v[467] * v[589] + v[481] * v[605] + v[456] * v[608] + v[424] * v[621] + v[420] * v[622] + v[429] * v[625] + v[469] * v[638] + v[423] * v[645] + v[453] * v[633] + v[433] * v[649] + v[418] * v[651] + v[441] * v[569] + v[1] * v[655] + v[434] * v[662] + v[426] * v[668] + v[421] * v[669] + v[112] * v[674] + v[0] * v[673] + v[386] * v[686] + v[388] * v[694] - v[355] * v[705] - v[252] * v[699] + v[362] * v[369] + v[339] * v[711] + v[361] * v[370] + v[343] * v[706] + v[363] * v[29] + v[321] * v[703] + v[322] * v[713] + v[349] * v[696] + v[350] * v[712] + v[346] * v[30] + v[341] * v[381] + v[342] * v[710] + v[337] * v[379] + v[338] * v[704] + v[27] * v[11] + x[8] * v[44] + -0.2045 * (v[388] * v[691] - v[303] * v[705] + v[368] * v[369] + v[323] * v[711] + v[367] * v[370] + v[293] * v[703] + v[353] * v[696] + v[276] * v[381] + v[320] * v[379] + x[8] * v[46]) + 0.2045 * (v[386] * v[695] - v[359] * v[699] + v[351] * v[706] + v[365] * v[29] + v[324] * v[713] + v[352] * v[712] + v[347] * v[30] + v[344] * v[710] + v[340] * v[704] + v[27] * v[47])) - v[4] * (v[472] * v[594] + v[466] * v[595] - v[418] * v[605] + v[456] * v[610] + v[448] * v[611] + v[460] * v[614] + v[421] * v[622] + v[429] * v[627] + v[419] * v[628] + v[482] * v[631] + v[481] * v[635] + v[469] * v[641] + v[467] * v[585] + v[423] * v[647] + v[453] * v[644] + v[451] * v[601] + v[1] * v[656] + v[441] * v[655] + v[426] * v[620] + v[424] * v[661] - v[420] * v[669] + v[0] * v[674] - v[112] * v[673] + v[388] * v[686] - v[386] * v[694] - v[252] * v[705] + v[355] * v[699] + v[364] * v[369] + v[343] * v[711] + v[363] * v[370] - v[339] * v[706] - v[361] * v[29] + v[322] * v[703] - v[321] * v[713] + v[350] * v[696] - v[349] * v[712] - v[345] * v[30] + v[342] * v[381] - v[341] * v[710] + v[338] * v[379] - v[337] * v[704] + x[8] * v[11] - v[27] * v[44] + 0.2045 * (v[386] * v[691] + v[388] * v[695] - v[359] * v[705] - v[303] * v[699] + v[366] * v[369] + v[351] * v[711] + v[365] * v[370] + v[323] * v[706] + v[367] * v[29] + v[324] * v[703] + v[293] * v[713] + v[352] * v[696] + v[353] * v[712] + v[348] * v[30] + v[344] * v[381] + v[276] * v[710] + v[340] * v[379] + v[320] * v[704] + v[27] * v[46] + x[8] * v[47]));
+    y[191] = v[3] * (-0.241 * (v[9] * v[591]) - 0.42 * v[577] + 0.241 * (v[4] * v[638] - v[10] * v[593] + v[5] * v[641]) + 0.4 * (-(v[4] * v[589]) - v[10] * v[577] + v[5] * v[585]) + v[426] * v[648] + v[421] * v[653] - v[444] * v[578] + v[0] * v[657] + v[423] * v[666] + v[418] * v[671] + v[413] * v[573] + v[1] * v[676] + v[385] * v[697] - v[380] * v[384] - v[382] * v[698] - v[377] * v[702] - v[375] * v[701] + x[7] * v[6]) - v[2] * (-0.241 * (v[10] * v[579]) + v[444] * v[539] + v[413] * v[540] + v[460] * v[632] + v[421] * v[636] + 0.241 * (v[4] * v[592] + v[5] * v[594] + v[9] * v[639] + v[10] * v[583]) + 0.4 * (v[5] * v[595] - v[9] * v[572]) + v[426] * v[650] + v[450] * v[652] + v[0] * v[654] + v[433] * v[663] + v[423] * v[667] + v[418] * v[670] + v[1] * v[675] + v[385] * v[692] - v[330] * v[384] - v[383] * v[698] - v[378] * v[702] - v[376] * v[701] + x[7] * v[12]);
+    y[190] = v[1] * (x[8] * v[574] + -0.241 * (v[5] * v[614] + v[3] * v[632]) + -0.4 * (v[3] * v[652]) + 0.42 * (v[3] * v[539] - v[2] * v[578]) + v[3] * v[654] + v[2] * v[657] + 0.241 * (v[2] * v[648] + v[3] * v[650] + v[5] * v[620] + v[4] * v[668]) + 0.4 * (v[5] * v[622] + v[3] * v[636] + v[2] * v[653] + v[4] * v[669]) + v[5] * v[674] + v[4] * v[673]) - v[0] * (x[8] * v[575] + v[5] * v[656] + v[4] * v[655] + -0.241 * (v[4] * v[649] + v[3] * v[663]) + 0.241 * (v[4] * v[645] + v[5] * v[647] + v[2] * v[666] + v[3] * v[667]) + 0.4 * (v[4] * v[651] - v[5] * v[605] + v[3] * v[670] + v[2] * v[671]) + 0.42 * (v[3] * v[540] + v[2] * v[573]) + v[3] * v[675] + v[2] * v[676]);
+    y[203] = v[818] + (v[98] * v[783] + v[99] * v[779] + v[96] * v[777] + v[97] * v[781]) + -0.2 * v[774];
+    y[202] = v[817] + (v[555] * 10. + v[538] * v[556] + v[520] * v[554] + v[503] * v[553] - v[480] * v[559] + v[479] * v[558] + v[82] * v[814] + v[83] * v[148] + v[80] * v[813] + v[81] * v[143]) + -0.5 * v[785];
+    y[201] = v[110] + (v[552] * 10. + v[536] * v[556] + v[519] * v[554] + v[502] * v[553] + v[447] * v[566] + v[417] * v[564] + v[67] * v[810] + v[68] * v[809] + v[65] * v[808] + v[66] * v[807]) - v[786];
+    y[200] = v[17] + (v[549] * 10. + v[534] * v[556] + v[517] * v[554] + v[500] * v[553] + v[443] * v[565] + v[412] * v[563] + v[51] * v[285] + v[52] * v[279] + v[49] * v[268] + v[50] * v[262]) + -0.3 * v[756];
+    y[199] = v[64] + (v[546] * 10. + v[533] * v[556] + v[515] * v[554] + v[498] * v[553] + v[439] * v[571] + v[87] * v[570] + v[36] * v[743] + v[37] * v[742] + v[34] * v[741] + v[35] * v[740]) + -0.5 * v[723];
+    y[198] = v[541] * 10. + v[528] * v[556] + v[510] * v[554] + v[492] * v[553] + v[1] * v[575] + v[0] * v[574] + v[8] * v[46] + v[7] * v[47] + v[5] * v[11] + v[4] * v[44] + v[32] * v[699] - v[31] * v[700] + 0.0579 * (v[27] * v[700] - v[28] * v[699]) + v[27] * v[709] + v[28] * v[708] + -0.5 * v[705];
+    y[197] = v[438] * v[554] + v[485] * v[553] + v[3] * v[12] + v[2] * v[6] + -0.5 * v[384];
+    y[0] = x[7];
+    y[1] = x[8];
+    y[2] = x[9];
+    y[3] = x[10];
+    y[4] = x[11];
+    y[5] = x[12];
+    y[6] = x[13];
+    y[17] = 1.;
+    y[18] = 1.;
+    y[19] = 1.;
+    y[20] = 1.;
+    y[21] = 1.;
+    y[22] = 1.;
+    y[23] = 1.;
+
+    f = Eigen::Map<const state_vector_t>(y);
+    values = Eigen::Map<const values_t>(y + STATE_DIM);
+}
+
+void KUKASoftContactSystemLinearizedFusedReverse::linearize(const state_vector_t& state, const control_vector_t& control, state_vector_t& f, state_matrix_t& A, state_control_matrix_t& B)
+{
+    linearizeSparse(state, control, f, values_);
+
+    A.setZero();
+    B.setZero();
+    for (int n = 0; n < NNZ; n++)
+    {
+        if (COLS[n] < (int)STATE_DIM) A(ROWS[n], COLS[n]) = values_[n];
+        else B(ROWS[n], COLS[n] - STATE_DIM) = values_[n];
+    }
+}
+
+}  // namespace KUKA
+}  // namespace models
+}  // namespace ct
+
+// clang-format on
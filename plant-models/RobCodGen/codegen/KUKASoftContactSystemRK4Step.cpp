@@ -0,0 +1,2118 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaSoftContactRK4Step in
+// plant-models/KUKASoftContactSystemCodGenLinearizer.cpp, in the output format of the KUKASoftContactLinearizationCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against RobotDynamics by test_models (src/main_test_models.cpp).
+
+// clang-format off
+
+#include "KUKASoftContactSystemRK4Step.h"
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+
+const KUKASoftContactSystemRK4Step::OUT_TYPE& KUKASoftContactSystemRK4Step::forwardZero(const Eigen::VectorXd& x_in)
+{
+    double* forwardZero = forwardZero_.data();
+
+    v_[0] = sin(x_in[0]);
+    v_[1] = cos(x_in[0]);
+    v_[2] = sin(x_in[1]);
+    v_[3] = cos(x_in[1]);
+    v_[4] = sin(x_in[2]);
+    v_[5] = cos(x_in[2]);
+    v_[6] = 0.2045 * v_[4];
+    v_[7] = 0.2045 * v_[5];
+    v_[8] = -0.2045 * v_[4];
+    v_[9] = sin(x_in[3]);
+    v_[10] = cos(x_in[3]);
+    v_[11] = 0.2155 * v_[10];
+    v_[12] = v_[9] * -0.2155;
+    v_[13] = sin(x_in[4]);
+    v_[14] = cos(x_in[4]);
+    v_[15] = 0.1845 * v_[13];
+    v_[16] = 0.1845 * v_[14];
+    v_[17] = -0.1845 * v_[13];
+    v_[18] = sin(x_in[5]);
+    v_[19] = cos(x_in[5]);
+    v_[20] = 0.2155 * v_[19];
+    v_[21] = -0.2155 * v_[18];
+    v_[22] = sin(x_in[6]);
+    v_[23] = cos(x_in[6]);
+    v_[24] = 0.081 * v_[22];
+    v_[25] = 0.081 * v_[23];
+    v_[26] = -0.081 * v_[22];
+    v_[27] = x_in[7] * v_[2];
+    v_[28] = x_in[7] * v_[3];
+    v_[29] = x_in[8] * v_[28];
+    v_[30] = x_in[8] * v_[27];
+    v_[31] = 0.071 * v_[27];
+    v_[32] = 0.025 * v_[28];
+    v_[33] = x_in[8] * 0.0579;
+    v_[34] = x_in[8] * v_[4] - v_[5] * v_[27];
+    v_[35] = x_in[8] * v_[5] + v_[4] * v_[27];
+    v_[36] = x_in[8] * v_[7] + v_[6] * v_[27];
+    v_[37] = x_in[8] * v_[8] + v_[7] * v_[27];
+    v_[38] = x_in[9] + v_[28];
+    v_[39] = x_in[9] * v_[35];
+    v_[40] = x_in[9] * v_[34];
+    v_[41] = x_in[9] * v_[37];
+    v_[42] = x_in[9] * v_[36];
+    v_[43] = -0.39 * v_[37] + 0.1334 * v_[34];
+    v_[44] = 0.39 * v_[36] + (-0.0117 * v_[38] + 0.1257 * v_[35]);
+    v_[45] = -0.09 * v_[36] + (0.0127 * v_[38] + -0.0117 * v_[35]);
+    v_[46] = 3. * v_[36] + (-0.09 * v_[38] + 0.39 * v_[35]);
+    v_[47] = 3. * v_[37] + -0.39 * v_[34];
+    v_[48] = 0.09 * v_[34];
+    v_[49] = v_[9] * v_[38] + v_[10] * v_[34];
+    v_[50] = v_[10] * v_[38] - v_[9] * v_[34];
+    v_[51] = v_[10] * v_[36] + v_[11] * v_[35];
+    v_[52] = v_[12] * v_[35] - v_[9] * v_[36];
+    v_[53] = 0.2155 * v_[34] - v_[37];
+    v_[54] = x_in[10] - v_[35];
+    v_[55] = x_in[10] * v_[50];
+    v_[56] = x_in[10] * v_[49];
+    v_[57] = x_in[10] * v_[52];
+    v_[58] = x_in[10] * v_[51];
+    v_[59] = 0.1809 * v_[53] + -0.0918 * v_[52] + 0.0452 * v_[49];
+    v_[60] = 0.0918 * v_[51] + (-0.0061 * v_[54] + 0.0131 * v_[50]);
+    v_[61] = -0.1809 * v_[51] + (0.0411 * v_[54] + -0.0061 * v_[50]);
+    v_[62] = 2.7 * v_[51] + (-0.1809 * v_[54] + 0.0918 * v_[50]);
+    v_[63] = 2.7 * v_[52] + -0.0918 * v_[49];
+    v_[64] = 2.7 * v_[53] + 0.1809 * v_[49];
+    v_[65] = v_[13] * v_[54] - v_[14] * v_[49];
+    v_[66] = v_[14] * v_[54] + v_[13] * v_[49];
+    v_[67] = v_[13] * v_[53] - v_[14] * v_[51] + (v_[16] * v_[54] + v_[15] * v_[49]);
+    v_[68] = v_[14] * v_[53] + v_[13] * v_[51] + (v_[17] * v_[54] + v_[16] * v_[49]);
+    v_[69] = x_in[11] + v_[50];
+    v_[70] = x_in[11] * v_[66];
+    v_[71] = x_in[11] * v_[65];
+    v_[72] = x_in[11] * v_[68];
+    v_[73] = x_in[11] * v_[67];
+    v_[74] = 0.0357 * v_[52] + -0.1292 * v_[68] + 0.0306 * v_[65];
+    v_[75] = -0.00017 * v_[52] + 0.1292 * v_[67] + (-0.0027 * v_[69] + 0.0279 * v_[66]);
+    v_[76] = 0.00017 * v_[68] + -0.0357 * v_[67] + (0.0058 * v_[69] + -0.0027 * v_[66]);
+    v_[77] = 1.7 * v_[67] + (-0.0357 * v_[69] + 0.1292 * v_[66]);
+    v_[78] = 1.7 * v_[68] + (0.00017 * v_[69] + -0.1292 * v_[65]);
+    v_[79] = 1.7 * v_[52] + (-0.00017 * v_[66] + 0.0357 * v_[65]);
+    v_[80] = v_[18] * v_[69] + v_[19] * v_[65];
+    v_[81] = v_[19] * v_[69] - v_[18] * v_[65];
+    v_[82] = v_[18] * v_[52] + v_[19] * v_[67] + v_[20] * v_[66];
+    v_[83] = v_[19] * v_[52] - v_[18] * v_[67] + v_[21] * v_[66];
+    v_[84] = 0.2155 * v_[65] - v_[68];
+    v_[85] = x_in[12] - v_[66];
+    v_[86] = x_in[12] * v_[81];
+    v_[87] = x_in[12] * v_[80];
+    v_[88] = x_in[12] * v_[83];
+    v_[89] = x_in[12] * v_[82];
+    v_[90] = 0.00108 * v_[84] + -0.00072 * v_[83] + 0.0005 * v_[80];
+    v_[91] = 0.00072 * v_[82] + 0.0036 * v_[81];
+    v_[92] = -0.00108 * v_[82] + 0.0047 * v_[85];
+    v_[93] = 1.8 * v_[82] + (-0.00108 * v_[85] + 0.00072 * v_[81]);
+    v_[94] = 1.8 * v_[83] + -0.00072 * v_[80];
+    v_[95] = 1.8 * v_[84] + 0.00108 * v_[80];
+    v_[96] = v_[22] * v_[85] - v_[23] * v_[80];
+    v_[97] = v_[23] * v_[85] + v_[22] * v_[80];
+    v_[98] = v_[22] * v_[84] - v_[23] * v_[82] + (v_[25] * v_[85] + v_[24] * v_[80]);
+    v_[99] = v_[23] * v_[84] + v_[22] * v_[82] + (v_[26] * v_[85] + v_[25] * v_[80]);
+    v_[100] = x_in[13] + v_[81];
+    v_[101] = x_in[13] * v_[97];
+    v_[102] = x_in[13] * v_[96];
+    v_[103] = x_in[13] * v_[99];
+    v_[104] = x_in[13] * v_[98];
+    v_[105] = -0.006 * v_[99] + 0.001 * v_[96];
+    v_[106] = 0.006 * v_[98] + 0.001 * v_[97];
+    v_[107] = 0.001 * v_[100];
+    v_[108] = 0.3 * v_[98] + 0.006 * v_[97];
+    v_[109] = 0.3 * v_[99] + -0.006 * v_[96];
+    v_[110] = 0.3 * v_[83];
+    v_[111] = v_[98] * v_[109] - v_[99] * v_[108] + (v_[96] * v_[106] - v_[97] * v_[105]);
+    v_[112] = x_in[23] + x_in[13] * -0.2 - v_[111];
+    v_[99] = v_[99] * v_[110] - v_[83] * v_[109] + (v_[97] * v_[107] - v_[100] * v_[106]) + (0.001 * v_[101] - -0.006 * v_[104]);
+    v_[98] = v_[83] * v_[108] - v_[98] * v_[110] + (v_[100] * v_[105] - v_[96] * v_[107]) + (0.006 * v_[103] - 0.001 * v_[102]);
+    v_[102] = v_[97] * v_[110] - v_[100] * v_[109] + (0.3 * v_[103] - 0.006 * v_[102]);
+    v_[100] = v_[100] * v_[108] - v_[96] * v_[110] + (-0.006 * v_[101] - 0.3 * v_[104]);
+    v_[101] = 0.001 * v_[23];
+    v_[103] = -0.006 * v_[25] - v_[101];
+    v_[104] = 0.001 * v_[22];
+    v_[105] = -0.006 * v_[26] + v_[104];
+    v_[106] = -0.006 * v_[22];
+    v_[107] = -0.006 * v_[23];
+    v_[104] = v_[104] + 0.006 * v_[24];
+    v_[101] = v_[101] + 0.006 * v_[25];
+    v_[110] = 0.006 * v_[23];
+    v_[113] = 0.006 * v_[22];
+    v_[114] = v_[113] + 0.3 * v_[24];
+    v_[115] = 0.3 * v_[25];
+    v_[116] = v_[110] + v_[115];
+    v_[117] = 0.3 * v_[23];
+    v_[118] = 0.3 * v_[22];
+    v_[115] = v_[115] - v_[107];
+    v_[119] = v_[106] + 0.3 * v_[26];
+    v_[120] = v_[25] * v_[118];
+    v_[121] = v_[25] * v_[117];
+    v_[122] = v_[26] * v_[115] + v_[25] * v_[114] + (v_[23] * v_[104] + v_[22] * v_[103]);
+    v_[123] = v_[120] + v_[26] * v_[117] + (v_[23] * v_[113] + v_[22] * v_[107]);
+    v_[124] = v_[22] * v_[117];
+    v_[125] = v_[23] * v_[118];
+    v_[126] = 0.0047 + (v_[26] * v_[119] + v_[25] * v_[116] + (v_[23] * v_[101] + v_[22] * v_[105]));
+    v_[127] = -0.00108 + (v_[26] * v_[118] - v_[121] + (v_[22] * v_[106] - v_[23] * v_[110]));
+    v_[128] = 1.8 + (v_[22] * v_[118] + v_[23] * v_[117]);
+    v_[26] = v_[82] * v_[94] - v_[83] * v_[93] + (v_[80] * v_[91] - v_[81] * v_[90]) + (v_[26] * v_[100] + v_[25] * v_[102] + (v_[23] * v_[98] + v_[22] * v_[99]));
+    v_[129] = x_in[22] + x_in[12] * -0.5 - v_[26];
+    v_[130] = v_[122] / v_[126];
+    v_[131] = v_[126] / v_[126];
+    v_[132] = v_[127] / v_[126];
+    v_[133] = v_[123] / v_[126];
+    v_[103] = 0.0005 + (v_[25] * v_[115] + v_[24] * v_[114] + (v_[22] * v_[104] - v_[23] * v_[103])) - v_[122] * v_[130];
+    v_[101] = v_[25] * v_[119] + v_[24] * v_[116] + (v_[22] * v_[101] - v_[23] * v_[105]) - v_[126] * v_[130];
+    v_[104] = v_[120] - v_[24] * v_[117] + (-(v_[23] * v_[106]) - v_[22] * v_[110]) - v_[127] * v_[130];
+    v_[105] = 0.00108 + (v_[121] + v_[24] * v_[118] + (v_[22] * v_[113] - v_[23] * v_[107])) - v_[123] * v_[130];
+    v_[106] = v_[122] - v_[122] * v_[131];
+    v_[107] = v_[127] - v_[127] * v_[131];
+    v_[110] = v_[123] - v_[123] * v_[131];
+    v_[113] = v_[22] * v_[115] - v_[23] * v_[114] - v_[122] * v_[132];
+    v_[117] = -0.00108 + (v_[22] * v_[119] - v_[23] * v_[116]) - v_[126] * v_[132];
+    v_[118] = v_[128] - v_[127] * v_[132];
+    v_[120] = v_[124] - v_[125] - v_[123] * v_[132];
+    v_[114] = 0.00108 + (v_[23] * v_[115] + v_[22] * v_[114]) - v_[122] * v_[133];
+    v_[115] = v_[125] - v_[124] - v_[127] * v_[133];
+    v_[121] = v_[128] - v_[123] * v_[133];
+    v_[24] = v_[122] * v_[129] / v_[126] + (v_[83] * v_[95] - v_[84] * v_[94] + (v_[81] * v_[92] - v_[85] * v_[91]) + (v_[25] * v_[100] + v_[24] * v_[102] + (v_[22] * v_[98] - v_[23] * v_[99])) + (v_[88] * v_[113] - -0.00072 * v_[89] + v_[86] * v_[103]));
+    v_[25] = v_[84] * v_[93] - v_[82] * v_[95] + (v_[85] * v_[90] - v_[80] * v_[92]) + (v_[111] + 0.001 * v_[112] / 0.001) + (0.00072 * v_[88] - 0.0036 * v_[87]);
+    v_[82] = v_[127] * v_[129] / v_[126] + (v_[81] * v_[95] - v_[85] * v_[94] + (v_[22] * v_[100] - v_[23] * v_[102]) + (v_[88] * v_[118] + (v_[86] * v_[104] - 0.00072 * v_[87])));
+    v_[83] = v_[85] * v_[93] - v_[80] * v_[95] + (v_[96] * v_[109] - v_[97] * v_[108]) + (-0.00072 * v_[86] - v_[89] * 2.1);
+    v_[80] = v_[123] * v_[129] / v_[126] + (v_[80] * v_[94] - v_[81] * v_[93] + (v_[23] * v_[100] + v_[22] * v_[102]) + (v_[88] * v_[120] + v_[86] * v_[105]));
+    v_[81] = 0.2155 * v_[105] + v_[19] * v_[103];
+    v_[84] = -0.00072 * v_[21] + v_[20] * v_[104] - v_[101];
+    v_[85] = v_[18] * v_[103];
+    v_[89] = -0.00072 * v_[18];
+    v_[90] = v_[19] * v_[104] - v_[89];
+    v_[91] = -0.00072 * v_[19];
+    v_[92] = v_[91] + v_[18] * v_[104];
+    v_[93] = 0.0036 * v_[18];
+    v_[94] = 0.00072 * v_[20];
+    v_[95] = 0.0036 * v_[19];
+    v_[96] = 0.00072 * v_[19];
+    v_[97] = 0.00072 * v_[18];
+    v_[98] = 0.2155 * v_[120] + (v_[19] * v_[113] - v_[97]);
+    v_[99] = v_[20] * v_[118] - v_[117];
+    v_[100] = v_[96] + v_[18] * v_[113];
+    v_[102] = v_[19] * v_[118];
+    v_[103] = v_[18] * v_[118];
+    v_[104] = v_[21] * 2.1;
+    v_[108] = v_[18] * 2.1;
+    v_[109] = v_[19] * 2.1;
+    v_[111] = 0.2155 * v_[121];
+    v_[113] = v_[111] + v_[19] * v_[114];
+    v_[22] = v_[20] * v_[115] - (v_[23] * v_[119] + v_[22] * v_[116] - v_[126] * v_[133]);
+    v_[23] = v_[18] * v_[114];
+    v_[114] = v_[19] * v_[115];
+    v_[115] = v_[18] * v_[115];
+    v_[116] = v_[18] * v_[81] - v_[19] * v_[93];
+    v_[118] = v_[19] * v_[97] + v_[18] * v_[92];
+    v_[119] = -0.0027 + (v_[19] * v_[94] + v_[18] * v_[84]);
+    v_[124] = 0.0058 + (v_[19] * v_[95] + v_[18] * v_[85]);
+    v_[125] = -0.0357 + (v_[19] * v_[96] + v_[18] * v_[90]);
+    v_[128] = 0.00017 - v_[18] * v_[105];
+    v_[130] = v_[67] * v_[78] - v_[68] * v_[77] + (v_[65] * v_[75] - v_[66] * v_[74]) + (v_[19] * v_[25] + v_[18] * v_[24]);
+    v_[132] = x_in[21] - x_in[11] - v_[130];
+    v_[133] = v_[116] / v_[124];
+    v_[134] = v_[119] / v_[124];
+    v_[135] = v_[124] / v_[124];
+    v_[136] = v_[125] / v_[124];
+    v_[137] = v_[128] / v_[124];
+    v_[138] = v_[118] / v_[124];
+    v_[81] = 0.0306 + (0.2155 * v_[113] + (v_[18] * v_[93] + v_[19] * v_[81])) - v_[116] * v_[133];
+    v_[84] = 0.2155 * v_[22] + (v_[19] * v_[84] - v_[18] * v_[94]) - v_[119] * v_[133];
+    v_[85] = 0.2155 * v_[23] + (v_[19] * v_[85] - v_[18] * v_[95]) - v_[124] * v_[133];
+    v_[90] = 0.2155 * v_[114] + (v_[19] * v_[90] - v_[18] * v_[96]) - v_[125] * v_[133];
+    v_[93] = -0.1292 + (-(v_[19] * v_[105]) - v_[111]) - v_[128] * v_[133];
+    v_[92] = 0.0357 + (0.2155 * v_[115] + (v_[19] * v_[92] - v_[18] * v_[97])) - v_[118] * v_[133];
+    v_[94] = v_[21] * v_[91] + v_[20] * v_[98] - (0.2155 * v_[110] + v_[19] * v_[106]) - v_[116] * v_[134];
+    v_[95] = 0.0279 + (v_[21] * v_[104] + v_[20] * v_[99] - (v_[20] * v_[107] - (v_[126] - v_[126] * v_[131]))) - v_[119] * v_[134];
+    v_[96] = -0.0027 + (v_[21] * v_[89] + v_[20] * v_[100] - v_[18] * v_[106]) - v_[124] * v_[134];
+    v_[97] = 0.1292 + (v_[20] * v_[102] - v_[21] * v_[108] - v_[19] * v_[107]) - v_[125] * v_[134];
+    v_[105] = v_[110] - v_[20] * v_[120] - v_[128] * v_[134];
+    v_[106] = -0.00017 + (v_[21] * v_[109] + v_[20] * v_[103] - v_[18] * v_[107]) - v_[118] * v_[134];
+    v_[107] = v_[116] - v_[116] * v_[135];
+    v_[110] = v_[119] - v_[119] * v_[135];
+    v_[111] = v_[125] - v_[125] * v_[135];
+    v_[131] = v_[128] - v_[128] * v_[135];
+    v_[133] = v_[19] * v_[98] - v_[18] * v_[91] - v_[116] * v_[136];
+    v_[134] = 0.1292 + (v_[19] * v_[99] - v_[18] * v_[104]) - v_[119] * v_[136];
+    v_[139] = -0.0357 + (v_[19] * v_[100] - v_[18] * v_[89]) - v_[124] * v_[136];
+    v_[140] = 1.7 + (v_[18] * v_[108] + v_[19] * v_[102]) - v_[125] * v_[136];
+    v_[141] = -(v_[19] * v_[120]) - v_[128] * v_[136];
+    v_[136] = v_[19] * v_[103] - v_[18] * v_[109] - v_[118] * v_[136];
+    v_[113] = -0.1292 - v_[113] - v_[116] * v_[137];
+    v_[22] = -v_[22] - v_[119] * v_[137];
+    v_[23] = 0.00017 - v_[23] - v_[124] * v_[137];
+    v_[114] = -v_[114] - v_[125] * v_[137];
+    v_[121] = 1.7 + v_[121] - v_[128] * v_[137];
+    v_[115] = -v_[115] - v_[118] * v_[137];
+    v_[91] = 0.0357 + (v_[19] * v_[91] + v_[18] * v_[98]) - v_[116] * v_[138];
+    v_[98] = -0.00017 + (v_[19] * v_[104] + v_[18] * v_[99]) - v_[119] * v_[138];
+    v_[99] = v_[18] * v_[102] - v_[19] * v_[108] - v_[125] * v_[138];
+    v_[102] = -(v_[18] * v_[120]) - v_[128] * v_[138];
+    v_[24] = v_[116] * v_[132] / v_[124] + (v_[68] * v_[79] - v_[52] * v_[78] + (v_[66] * v_[76] - v_[69] * v_[75]) + (0.2155 * v_[80] + (v_[19] * v_[24] - v_[18] * v_[25])) + (v_[72] * v_[133] - v_[73] * v_[113] + (v_[70] * v_[81] - v_[71] * v_[94])));
+    v_[21] = v_[119] * v_[132] / v_[124] + (v_[52] * v_[77] - v_[67] * v_[79] + (v_[69] * v_[74] - v_[65] * v_[76]) + (v_[21] * v_[83] + v_[20] * v_[82] - (v_[126] * v_[129] / v_[126] + (v_[26] + (v_[88] * v_[117] + v_[86] * v_[101])))) + (v_[72] * v_[134] - v_[73] * v_[22] + (v_[70] * v_[84] - v_[71] * v_[95])));
+    v_[25] = v_[125] * v_[132] / v_[124] + (v_[66] * v_[79] - v_[69] * v_[78] + (v_[19] * v_[82] - v_[18] * v_[83]) + (v_[72] * v_[140] - v_[73] * v_[114] + (v_[70] * v_[90] - v_[71] * v_[97])));
+    v_[26] = v_[128] * v_[132] / v_[124] + (v_[69] * v_[77] - v_[65] * v_[79] - v_[80] + (v_[72] * v_[141] - v_[73] * v_[121] + (v_[70] * v_[93] - v_[71] * v_[105])));
+    v_[67] = v_[16] * v_[93] + v_[15] * v_[90] + (v_[13] * v_[84] - v_[14] * v_[81]);
+    v_[68] = v_[17] * v_[93] + v_[16] * v_[90] + (v_[14] * v_[84] + v_[13] * v_[81]);
+    v_[69] = v_[13] * v_[93] - v_[14] * v_[90];
+    v_[74] = v_[14] * v_[93] + v_[13] * v_[90];
+    v_[75] = v_[16] * v_[105] + v_[15] * v_[97] + (v_[13] * v_[95] - v_[14] * v_[94]);
+    v_[76] = v_[17] * v_[105] + v_[16] * v_[97] + (v_[14] * v_[95] + v_[13] * v_[94]);
+    v_[79] = v_[13] * v_[105] - v_[14] * v_[97];
+    v_[80] = v_[14] * v_[105] + v_[13] * v_[97];
+    v_[81] = v_[16] * v_[141] + v_[15] * v_[140] + (v_[13] * v_[134] - v_[14] * v_[133]);
+    v_[84] = v_[17] * v_[141] + v_[16] * v_[140] + (v_[14] * v_[134] + v_[13] * v_[133]);
+    v_[90] = v_[13] * v_[141] - v_[14] * v_[140];
+    v_[93] = v_[14] * v_[141] + v_[13] * v_[140];
+    v_[94] = v_[16] * v_[121] + v_[15] * v_[114] + (v_[13] * v_[22] - v_[14] * v_[113]);
+    v_[22] = v_[17] * v_[121] + v_[16] * v_[114] + (v_[14] * v_[22] + v_[13] * v_[113]);
+    v_[95] = v_[13] * v_[121] - v_[14] * v_[114];
+    v_[97] = v_[14] * v_[121] + v_[13] * v_[114];
+    v_[101] = v_[17] * v_[94] + v_[16] * v_[81] + (v_[14] * v_[75] + v_[13] * v_[67]);
+    v_[104] = v_[17] * v_[115] + v_[16] * v_[136] + (v_[14] * v_[106] + v_[13] * v_[92]);
+    v_[105] = v_[17] * v_[97] + v_[16] * v_[93] + (v_[14] * v_[80] + v_[13] * v_[74]);
+    v_[108] = -0.0061 + (v_[17] * v_[23] + v_[16] * v_[139] + (v_[14] * v_[96] + v_[13] * v_[85]));
+    v_[113] = 0.0411 + (v_[17] * v_[22] + v_[16] * v_[84] + (v_[14] * v_[76] + v_[13] * v_[68]));
+    v_[114] = -0.1809 + (v_[17] * v_[95] + v_[16] * v_[90] + (v_[14] * v_[79] + v_[13] * v_[69]));
+    v_[117] = v_[51] * v_[63] - v_[52] * v_[62] + (v_[49] * v_[60] - v_[50] * v_[59]) + (v_[17] * v_[26] + v_[16] * v_[25] + (v_[14] * v_[21] + v_[13] * v_[24]));
+    v_[120] = x_in[20] + x_in[10] * -0.3 - v_[117];
+    v_[121] = v_[101] / v_[113];
+    v_[133] = v_[108] / v_[113];
+    v_[134] = v_[113] / v_[113];
+    v_[137] = v_[114] / v_[113];
+    v_[140] = v_[104] / v_[113];
+    v_[141] = v_[105] / v_[113];
+    v_[67] = 0.0452 + (v_[16] * v_[94] + v_[15] * v_[81] + (v_[13] * v_[75] - v_[14] * v_[67])) - v_[101] * v_[121];
+    v_[75] = v_[16] * v_[23] + v_[15] * v_[139] + (v_[13] * v_[96] - v_[14] * v_[85]) - v_[108] * v_[121];
+    v_[68] = v_[16] * v_[22] + v_[15] * v_[84] + (v_[13] * v_[76] - v_[14] * v_[68]) - v_[113] * v_[121];
+    v_[69] = v_[16] * v_[95] + v_[15] * v_[90] + (v_[13] * v_[79] - v_[14] * v_[69]) - v_[114] * v_[121];
+    v_[76] = -0.0918 + (v_[16] * v_[115] + v_[15] * v_[136] + (v_[13] * v_[106] - v_[14] * v_[92])) - v_[104] * v_[121];
+    v_[74] = 0.1809 + (v_[16] * v_[97] + v_[15] * v_[93] + (v_[13] * v_[80] - v_[14] * v_[74])) - v_[105] * v_[121];
+    v_[79] = v_[16] * v_[131] + v_[15] * v_[111] + (v_[13] * v_[110] - v_[14] * v_[107]) - v_[101] * v_[133];
+    v_[80] = 0.0131 + (v_[124] - v_[124] * v_[135]) - v_[108] * v_[133];
+    v_[107] = -0.0061 + (v_[17] * v_[131] + v_[16] * v_[111] + (v_[14] * v_[110] + v_[13] * v_[107])) - v_[113] * v_[133];
+    v_[110] = 0.0918 + (v_[13] * v_[131] - v_[14] * v_[111]) - v_[114] * v_[133];
+    v_[121] = v_[118] - v_[118] * v_[135] - v_[104] * v_[133];
+    v_[111] = v_[14] * v_[131] + v_[13] * v_[111] - v_[105] * v_[133];
+    v_[131] = v_[101] - v_[101] * v_[134];
+    v_[133] = v_[108] - v_[108] * v_[134];
+    v_[135] = v_[114] - v_[114] * v_[134];
+    v_[142] = v_[104] - v_[104] * v_[134];
+    v_[143] = v_[105] - v_[105] * v_[134];
+    v_[144] = v_[13] * v_[94] - v_[14] * v_[81] - v_[101] * v_[137];
+    v_[145] = 0.0918 + (v_[13] * v_[23] - v_[14] * v_[139]) - v_[108] * v_[137];
+    v_[146] = -0.1809 + (v_[13] * v_[22] - v_[14] * v_[84]) - v_[113] * v_[137];
+    v_[147] = 2.7 + (v_[13] * v_[95] - v_[14] * v_[90]) - v_[114] * v_[137];
+    v_[148] = v_[13] * v_[115] - v_[14] * v_[136] - v_[104] * v_[137];
+    v_[137] = v_[13] * v_[97] - v_[14] * v_[93] - v_[105] * v_[137];
+    v_[149] = -0.0918 + (v_[16] * v_[102] + v_[15] * v_[99] + (v_[13] * v_[98] - v_[14] * v_[91])) - v_[101] * v_[140];
+    v_[89] = v_[19] * v_[89] + v_[18] * v_[100] - v_[124] * v_[138] - v_[108] * v_[140];
+    v_[91] = v_[17] * v_[102] + v_[16] * v_[99] + (v_[14] * v_[98] + v_[13] * v_[91]) - v_[113] * v_[140];
+    v_[98] = v_[13] * v_[102] - v_[14] * v_[99] - v_[114] * v_[140];
+    v_[100] = 2.7 + (1.7 + (v_[19] * v_[109] + v_[18] * v_[103]) - v_[118] * v_[138]) - v_[104] * v_[140];
+    v_[99] = v_[14] * v_[102] + v_[13] * v_[99] - v_[105] * v_[140];
+    v_[81] = 0.1809 + (v_[14] * v_[94] + v_[13] * v_[81]) - v_[101] * v_[141];
+    v_[94] = v_[14] * v_[23] + v_[13] * v_[139] - v_[108] * v_[141];
+    v_[90] = v_[14] * v_[95] + v_[13] * v_[90] - v_[114] * v_[141];
+    v_[95] = v_[14] * v_[115] + v_[13] * v_[136] - v_[104] * v_[141];
+    v_[93] = 2.7 + (v_[14] * v_[97] + v_[13] * v_[93]) - v_[105] * v_[141];
+    v_[21] = v_[101] * v_[120] / v_[113] + (v_[52] * v_[64] - v_[53] * v_[63] + (v_[50] * v_[61] - v_[54] * v_[60]) + (v_[16] * v_[26] + v_[15] * v_[25] + (v_[13] * v_[21] - v_[14] * v_[24])) + (v_[57] * v_[144] - v_[58] * v_[149] + (v_[55] * v_[67] - v_[56] * v_[79])));
+    v_[23] = v_[108] * v_[120] / v_[113] + (v_[53] * v_[62] - v_[51] * v_[64] + (v_[54] * v_[59] - v_[49] * v_[61]) + (v_[124] * v_[132] / v_[124] + (v_[130] + (v_[72] * v_[139] - v_[73] * v_[23] + (v_[70] * v_[85] - v_[71] * v_[96])))) + (v_[57] * v_[145] - v_[58] * v_[89] + (v_[55] * v_[75] - v_[56] * v_[80])));
+    v_[24] = v_[114] * v_[120] / v_[113] + (v_[50] * v_[64] - v_[54] * v_[63] + (v_[13] * v_[26] - v_[14] * v_[25]) + (v_[57] * v_[147] - v_[58] * v_[98] + (v_[55] * v_[69] - v_[56] * v_[110])));
+    v_[51] = v_[104] * v_[120] / v_[113] + (v_[54] * v_[62] - v_[49] * v_[64] + (v_[118] * v_[132] / v_[124] + (v_[65] * v_[78] - v_[66] * v_[77] + (v_[19] * v_[83] + v_[18] * v_[82]) + (v_[72] * v_[136] - v_[73] * v_[115] + (v_[70] * v_[92] - v_[71] * v_[106])))) + (v_[57] * v_[148] - v_[58] * v_[100] + (v_[55] * v_[76] - v_[56] * v_[121])));
+    v_[25] = v_[105] * v_[120] / v_[113] + (v_[49] * v_[63] - v_[50] * v_[62] + (v_[14] * v_[26] + v_[13] * v_[25]) + (v_[57] * v_[137] - v_[58] * v_[99] + (v_[55] * v_[74] - v_[56] * v_[111])));
+    v_[26] = 0.2155 * v_[74] + (v_[10] * v_[67] - v_[9] * v_[75]);
+    v_[49] = v_[12] * v_[76] + v_[11] * v_[69] - v_[68];
+    v_[50] = v_[10] * v_[75] + v_[9] * v_[67];
+    v_[52] = v_[10] * v_[69] - v_[9] * v_[76];
+    v_[53] = 0.2155 * v_[111] + (v_[10] * v_[79] - v_[9] * v_[80]);
+    v_[54] = v_[12] * v_[121] + v_[11] * v_[110] - v_[107];
+    v_[59] = v_[10] * v_[80] + v_[9] * v_[79];
+    v_[60] = v_[10] * v_[110] - v_[9] * v_[121];
+    v_[61] = 0.2155 * v_[137] + (v_[10] * v_[144] - v_[9] * v_[145]);
+    v_[62] = v_[12] * v_[148] + v_[11] * v_[147] - v_[146];
+    v_[63] = v_[10] * v_[145] + v_[9] * v_[144];
+    v_[64] = v_[10] * v_[147] - v_[9] * v_[148];
+    v_[65] = 0.2155 * v_[99] + (v_[10] * v_[149] - v_[9] * v_[89]);
+    v_[66] = v_[12] * v_[100] + v_[11] * v_[98] - v_[91];
+    v_[67] = v_[10] * v_[89] + v_[9] * v_[149];
+    v_[69] = v_[10] * v_[98] - v_[9] * v_[100];
+    v_[75] = 0.2155 * v_[93];
+    v_[76] = v_[75] + (v_[10] * v_[81] - v_[9] * v_[94]);
+    v_[22] = v_[12] * v_[95] + v_[11] * v_[90] - (v_[14] * v_[22] + v_[13] * v_[84] - v_[113] * v_[141]);
+    v_[77] = v_[10] * v_[94] + v_[9] * v_[81];
+    v_[78] = v_[10] * v_[90] - v_[9] * v_[95];
+    v_[79] = v_[10] * v_[53] + v_[9] * v_[26];
+    v_[80] = -(v_[9] * v_[74]) - v_[10] * v_[111];
+    v_[81] = -0.0117 + (v_[10] * v_[54] + v_[9] * v_[49]);
+    v_[82] = 0.0127 + (v_[10] * v_[59] + v_[9] * v_[50]);
+    v_[83] = -0.09 + (v_[10] * v_[60] + v_[9] * v_[52]);
+    v_[84] = v_[36] * v_[47] - v_[37] * v_[46] + (v_[34] * v_[44] - v_[35] * v_[43]) + (v_[10] * v_[23] + v_[9] * v_[21]);
+    v_[85] = x_in[19] + x_in[9] * -0.5 - v_[84];
+    v_[89] = v_[79] / v_[82];
+    v_[90] = v_[81] / v_[82];
+    v_[92] = v_[82] / v_[82];
+    v_[94] = v_[83] / v_[82];
+    v_[95] = v_[80] / v_[82];
+    v_[26] = 0.1334 + (0.2155 * v_[76] + (v_[10] * v_[26] - v_[9] * v_[53])) - v_[79] * v_[89];
+    v_[49] = 0.2155 * v_[22] + (v_[10] * v_[49] - v_[9] * v_[54]) - v_[81] * v_[89];
+    v_[50] = 0.2155 * v_[77] + (v_[10] * v_[50] - v_[9] * v_[59]) - v_[82] * v_[89];
+    v_[52] = 0.2155 * v_[78] + (v_[10] * v_[52] - v_[9] * v_[60]) - v_[83] * v_[89];
+    v_[53] = -0.39 + (v_[9] * v_[111] - v_[10] * v_[74] - v_[75]) - v_[80] * v_[89];
+    v_[54] = v_[12] * v_[65] + v_[11] * v_[61] - (0.2155 * v_[143] + (v_[10] * v_[131] - v_[9] * v_[133])) - v_[79] * v_[90];
+    v_[59] = 0.1257 + (v_[12] * v_[66] + v_[11] * v_[62] - (v_[12] * v_[142] + v_[11] * v_[135] - (v_[113] - v_[113] * v_[134]))) - v_[81] * v_[90];
+    v_[60] = -0.0117 + (v_[12] * v_[67] + v_[11] * v_[63] - (v_[10] * v_[133] + v_[9] * v_[131])) - v_[82] * v_[90];
+    v_[74] = 0.39 + (v_[12] * v_[69] + v_[11] * v_[64] - (v_[10] * v_[135] - v_[9] * v_[142])) - v_[83] * v_[90];
+    v_[75] = v_[143] + (-(v_[11] * v_[137]) - v_[12] * v_[99]) - v_[80] * v_[90];
+    v_[61] = v_[10] * v_[61] - v_[9] * v_[65] - v_[79] * v_[94];
+    v_[62] = 0.39 + (v_[10] * v_[62] - v_[9] * v_[66]) - v_[81] * v_[94];
+    v_[63] = -0.09 + (v_[10] * v_[63] - v_[9] * v_[67]) - v_[82] * v_[94];
+    v_[64] = 3. + (v_[10] * v_[64] - v_[9] * v_[69]) - v_[83] * v_[94];
+    v_[65] = v_[9] * v_[99] - v_[10] * v_[137] - v_[80] * v_[94];
+    v_[66] = -0.39 - v_[76] - v_[79] * v_[95];
+    v_[22] = -v_[22] - v_[81] * v_[95];
+    v_[67] = -v_[77] - v_[82] * v_[95];
+    v_[69] = -v_[78] - v_[83] * v_[95];
+    v_[76] = 3. + v_[93] - v_[80] * v_[95];
+    v_[21] = v_[79] * v_[85] / v_[82] + (v_[37] * v_[48] + (v_[35] * v_[45] - v_[38] * v_[44]) + (0.2155 * v_[25] + (v_[10] * v_[21] - v_[9] * v_[23])) + (v_[41] * v_[61] - v_[42] * v_[66] + (v_[39] * v_[26] - v_[40] * v_[54])));
+    v_[23] = v_[81] * v_[85] / v_[82] + (v_[38] * v_[43] - v_[34] * v_[45] - v_[36] * v_[48] + (v_[12] * v_[51] + v_[11] * v_[24] - (v_[113] * v_[120] / v_[113] + (v_[117] + (v_[57] * v_[146] - v_[58] * v_[91] + (v_[55] * v_[68] - v_[56] * v_[107]))))) + (v_[41] * v_[62] - v_[42] * v_[22] + (v_[39] * v_[49] - v_[40] * v_[59])));
+    v_[24] = v_[83] * v_[85] / v_[82] + (v_[35] * v_[48] - v_[38] * v_[47] + (v_[10] * v_[24] - v_[9] * v_[51]) + (v_[41] * v_[64] - v_[42] * v_[69] + (v_[39] * v_[52] - v_[40] * v_[74])));
+    v_[25] = v_[80] * v_[85] / v_[82] + (v_[38] * v_[46] - v_[34] * v_[48] - v_[25] + (v_[41] * v_[65] - v_[42] * v_[76] + (v_[39] * v_[53] - v_[40] * v_[75])));
+    v_[34] = v_[7] * v_[53] + v_[6] * v_[52] + (v_[4] * v_[49] - v_[5] * v_[26]);
+    v_[35] = v_[7] * v_[75] + v_[6] * v_[74] + (v_[4] * v_[59] - v_[5] * v_[54]);
+    v_[36] = v_[7] * v_[65] + v_[6] * v_[64] + (v_[4] * v_[62] - v_[5] * v_[61]);
+    v_[37] = v_[7] * v_[76] + v_[6] * v_[69] + (v_[4] * v_[22] - v_[5] * v_[66]);
+    v_[38] = v_[8] * v_[37] + v_[7] * v_[36] + (v_[5] * v_[35] + v_[4] * v_[34]);
+    v_[43] = v_[8] * v_[67] + v_[7] * v_[63] + (v_[5] * v_[60] + v_[4] * v_[50]);
+    v_[22] = 0.0579 + (v_[8] * (v_[8] * v_[76] + v_[7] * v_[69] + (v_[5] * v_[22] + v_[4] * v_[66])) + v_[7] * (v_[8] * v_[65] + v_[7] * v_[64] + (v_[5] * v_[62] + v_[4] * v_[61])) + (v_[5] * (v_[8] * v_[75] + v_[7] * v_[74] + (v_[5] * v_[59] + v_[4] * v_[54])) + v_[4] * (v_[8] * v_[53] + v_[7] * v_[52] + (v_[5] * v_[49] + v_[4] * v_[26]))));
+    v_[26] = x_in[18] + x_in[8] * -0.5 - (v_[27] * v_[32] - v_[28] * v_[31] + (v_[8] * v_[25] + v_[7] * v_[24] + (v_[5] * v_[23] + v_[4] * v_[21])));
+    v_[44] = v_[38] / v_[22];
+    v_[45] = v_[43] / v_[22];
+    v_[34] = 0.071 + (v_[7] * v_[37] + v_[6] * v_[36] + (v_[4] * v_[35] - v_[5] * v_[34])) - v_[38] * v_[44];
+    v_[35] = v_[7] * v_[67] + v_[6] * v_[63] + (v_[4] * v_[60] - v_[5] * v_[50]) - v_[43] * v_[44];
+    v_[36] = v_[7] * (v_[80] - v_[80] * v_[92]) + v_[6] * (v_[83] - v_[83] * v_[92]) + (v_[4] * (v_[81] - v_[81] * v_[92]) - v_[5] * (v_[79] - v_[79] * v_[92])) - v_[38] * v_[45];
+    v_[37] = 0.025 + (v_[82] - v_[82] * v_[92]) - v_[43] * v_[45];
+    v_[21] = (x_in[17] + x_in[7] * -0.5 - (v_[3] * (v_[43] * v_[26] / v_[22] + (x_in[8] * v_[31] - v_[27] * v_[33] + (v_[82] * v_[85] / v_[82] + (v_[84] + (v_[41] * v_[63] - v_[42] * v_[67] + (v_[39] * v_[50] - v_[40] * v_[60])))) + (v_[29] * v_[35] - v_[30] * v_[37]))) + v_[2] * (v_[38] * v_[26] / v_[22] + (v_[28] * v_[33] - x_in[8] * v_[32] + (v_[7] * v_[25] + v_[6] * v_[24] + (v_[4] * v_[23] - v_[5] * v_[21])) + (v_[29] * v_[34] - v_[30] * v_[36]))))) / (0.0236 + (v_[3] * (v_[3] * v_[37] + v_[2] * v_[36]) + v_[2] * (v_[3] * v_[35] + v_[2] * v_[34])));
+    v_[23] = v_[29] + v_[2] * v_[21];
+    v_[24] = v_[3] * v_[21] - v_[30];
+    v_[22] = (v_[26] - (v_[43] * v_[24] + v_[38] * v_[23])) / v_[22];
+    v_[25] = v_[39] + (v_[4] * v_[22] - v_[5] * v_[23]);
+    v_[26] = v_[5] * v_[22] + v_[4] * v_[23] - v_[40];
+    v_[6] = v_[41] + (v_[7] * v_[22] + v_[6] * v_[23]);
+    v_[7] = v_[8] * v_[22] + v_[7] * v_[23] - v_[42];
+    v_[8] = (v_[85] - (v_[80] * v_[7] + v_[83] * v_[6] + (v_[82] * v_[24] + v_[81] * v_[26] + v_[79] * v_[25]))) / v_[82];
+    v_[23] = v_[24] + v_[8];
+    v_[7] = 0.2155 * v_[25] - v_[7];
+    v_[24] = v_[55] + (v_[9] * v_[23] + v_[10] * v_[25]);
+    v_[23] = v_[10] * v_[23] - v_[9] * v_[25] - v_[56];
+    v_[11] = v_[57] + (v_[10] * v_[6] + v_[11] * v_[26]);
+    v_[6] = v_[12] * v_[26] - v_[9] * v_[6] - v_[58];
+    v_[12] = (v_[120] - (v_[105] * v_[7] + v_[104] * v_[6] + v_[114] * v_[11] + (v_[108] * v_[23] - v_[113] * v_[26] + v_[101] * v_[24]))) / v_[113];
+    v_[25] = v_[12] - v_[26];
+    v_[26] = v_[70] + (v_[13] * v_[25] - v_[14] * v_[24]);
+    v_[27] = v_[14] * v_[25] + v_[13] * v_[24] - v_[71];
+    v_[15] = v_[72] + (v_[13] * v_[7] - v_[14] * v_[11] + (v_[16] * v_[25] + v_[15] * v_[24]));
+    v_[7] = v_[14] * v_[7] + v_[13] * v_[11] + (v_[17] * v_[25] + v_[16] * v_[24]) - v_[73];
+    v_[11] = (v_[132] - (v_[118] * v_[6] + v_[128] * v_[7] + v_[125] * v_[15] + (v_[124] * v_[23] + v_[119] * v_[27] + v_[116] * v_[26]))) / v_[124];
+    v_[16] = v_[23] + v_[11];
+    v_[6] = (v_[129] - (v_[123] * (0.2155 * v_[26] - v_[7]) + v_[127] * (v_[88] + (v_[18] * v_[6] + v_[19] * v_[15] + v_[20] * v_[27])) + (v_[122] * (v_[86] + (v_[18] * v_[16] + v_[19] * v_[26])) - v_[126] * v_[27]))) / v_[126];
+    v_[7] = (v_[112] - 0.001 * (v_[19] * v_[16] - v_[18] * v_[26] - v_[87])) / 0.001;
+    v_[15] = v_[1] * v_[2];
+    v_[16] = v_[1] * v_[3];
+    v_[17] = v_[4] * v_[16];
+    v_[20] = v_[0] * v_[5];
+    v_[16] = v_[0] * v_[4] - v_[5] * v_[16];
+    v_[23] = v_[1] * 0.42;
+    v_[24] = v_[1] * 0.4;
+    v_[25] = v_[2] * v_[24];
+    v_[26] = v_[3] * v_[24];
+    v_[27] = v_[0] * 0.4;
+    v_[28] = v_[4] * v_[27] - v_[5] * v_[26];
+    v_[29] = v_[1] * 0.241;
+    v_[30] = v_[3] * v_[29];
+    v_[31] = v_[5] * v_[30];
+    v_[32] = v_[0] * 0.241;
+    v_[33] = v_[4] * v_[32];
+    v_[34] = v_[33] - v_[31];
+    v_[35] = v_[2] * v_[29];
+    v_[36] = v_[10] * v_[35];
+    v_[37] = v_[9] * v_[34] + v_[36];
+    v_[38] = v_[5] * v_[32];
+    v_[39] = v_[1] * -0.241;
+    v_[40] = v_[4] * (v_[3] * v_[39]) - v_[38];
+    v_[31] = v_[31] - v_[33];
+    v_[33] = v_[9] * v_[35];
+    v_[41] = v_[13] * v_[40] + v_[14] * (v_[10] * v_[31] + v_[33]);
+    v_[42] = v_[0] * v_[2];
+    v_[43] = v_[1] * v_[4];
+    v_[44] = v_[0] * v_[3];
+    v_[45] = v_[5] * v_[44];
+    v_[44] = v_[4] * v_[44];
+    v_[46] = v_[1] * v_[5];
+    v_[47] = v_[0] * 0.42;
+    v_[48] = v_[2] * v_[27];
+    v_[49] = v_[4] * v_[24];
+    v_[50] = v_[3] * v_[32];
+    v_[51] = v_[5] * v_[50];
+    v_[39] = v_[4] * v_[39] - v_[51];
+    v_[32] = v_[2] * v_[32];
+    v_[52] = v_[10] * v_[32];
+    v_[53] = v_[4] * v_[50];
+    v_[54] = v_[5] * v_[29];
+    v_[55] = v_[54] - v_[53];
+    v_[29] = v_[4] * v_[29];
+    v_[51] = v_[51] + v_[29];
+    v_[56] = v_[9] * v_[32];
+    v_[57] = v_[3] * 0.4;
+    v_[58] = v_[2] * 0.4;
+    v_[59] = v_[2] * 0.241;
+    v_[60] = v_[5] * v_[59];
+    v_[61] = v_[9] * v_[60];
+    v_[62] = v_[3] * 0.241;
+    v_[63] = v_[4] * v_[59];
+    v_[64] = v_[10] * v_[60];
+    v_[65] = v_[9] * v_[62];
+    v_[66] = v_[3] * v_[27];
+    v_[67] = v_[9] * v_[51] - v_[52];
+    v_[53] = v_[53] - v_[54];
+    v_[54] = v_[0] * -0.241;
+    v_[68] = v_[5] * v_[35];
+    v_[35] = v_[3] * v_[23] + (v_[10] * v_[26] + (v_[9] * (v_[5] * v_[25]) + (v_[19] * (v_[9] * v_[68] + v_[10] * v_[30]) + v_[18] * (v_[13] * (v_[4] * v_[35]) + v_[14] * (v_[9] * v_[30] - v_[10] * v_[68])))));
+    v_[30] = v_[4] * v_[30];
+    v_[26] = v_[9] * (v_[4] * v_[26] + v_[5] * v_[27]) + (v_[19] * (v_[9] * (v_[38] + v_[30])) + v_[18] * (v_[13] * v_[34] + v_[14] * (v_[10] * v_[40])));
+    v_[27] = v_[10] * v_[34] - v_[33];
+    v_[33] = v_[10] * v_[28] + (v_[19] * v_[27] + v_[18] * (v_[14] * v_[37]) - v_[9] * v_[25]);
+    v_[27] = v_[18] * (v_[14] * (v_[5] * v_[54] - v_[30]) + v_[13] * v_[27]);
+    v_[30] = v_[19] * v_[41] + v_[18] * (v_[9] * v_[31] - v_[36]);
+    v_[31] = v_[5] * v_[32];
+    v_[31] = v_[3] * v_[47] + (v_[10] * v_[66] + (v_[9] * (v_[5] * v_[48]) + (v_[19] * (v_[9] * v_[31] + v_[10] * v_[50]) + v_[18] * (v_[13] * (v_[4] * v_[32]) + v_[14] * (v_[9] * v_[50] - v_[10] * v_[31])))));
+    v_[24] = v_[9] * (v_[4] * v_[66] - v_[5] * v_[24]) + (v_[19] * (v_[9] * v_[53]) + v_[18] * (v_[13] * v_[39] + v_[14] * (v_[10] * v_[55])));
+    v_[32] = v_[10] * v_[39] - v_[56];
+    v_[34] = v_[10] * (v_[5] * (v_[3] * (v_[0] * -0.4)) - v_[49]) + (v_[19] * v_[32] + v_[18] * (v_[14] * (v_[9] * v_[39] + v_[52])) - v_[9] * v_[48]);
+    v_[32] = v_[18] * (v_[14] * v_[55] + v_[13] * v_[32]);
+    v_[36] = v_[19] * (v_[13] * v_[55] + v_[14] * (v_[10] * v_[51] + v_[56])) + v_[18] * v_[67];
+    v_[38] = v_[5] * v_[62];
+    v_[38] = v_[9] * (v_[5] * v_[57]) + (v_[19] * (v_[9] * v_[38] - v_[10] * v_[59]) + v_[18] * (v_[13] * (v_[4] * v_[62]) + v_[14] * (v_[9] * (v_[2] * -0.241) - v_[10] * v_[38]))) - v_[10] * v_[58] - v_[2] * 0.42;
+    v_[4] = v_[18] * (v_[13] * v_[60] + v_[14] * (v_[10] * v_[63])) - v_[19] * (v_[9] * v_[63]) - v_[9] * (v_[4] * v_[58]);
+    v_[39] = v_[64] - v_[65];
+    v_[40] = v_[10] * (v_[5] * v_[58]) + (v_[19] * v_[39] + v_[18] * (v_[14] * (v_[61] + v_[10] * v_[62])) - v_[9] * v_[57]);
+    v_[39] = v_[18] * (v_[14] * v_[63] + v_[13] * v_[39]);
+    v_[50] = v_[19] * (v_[13] * v_[63] + v_[14] * (v_[65] - v_[64])) + v_[18] * (v_[10] * (v_[3] * -0.241) - v_[61]);
+    v_[0] = x_in[8] * v_[0];
+    v_[1] = x_in[8] * v_[1];
+    v_[51] = x_in[9] * v_[15] - v_[0];
+    v_[52] = v_[1] + x_in[9] * v_[42];
+    v_[55] = v_[51] + x_in[10] * (v_[17] + v_[20]);
+    v_[57] = v_[52] + x_in[10] * (v_[44] - v_[46]);
+    v_[58] = v_[55] + x_in[11] * (v_[10] * v_[15] + v_[9] * v_[16]);
+    v_[59] = v_[57] + x_in[11] * (v_[10] * v_[42] + v_[9] * (-v_[45] - v_[43]));
+    v_[3] = x_in[7] * (v_[9] * (v_[49] + v_[5] * v_[66]) + (v_[19] * v_[67] + v_[18] * (v_[13] * v_[53] + v_[14] * (v_[10] * (v_[5] * (v_[3] * v_[54]) - v_[29]) - v_[56]))) - v_[10] * v_[48] - v_[2] * v_[47]) + x_in[8] * v_[35] + x_in[9] * v_[26] + x_in[10] * v_[33] + x_in[11] * v_[27] + x_in[12] * v_[30];
+    v_[2] = x_in[7] * (v_[2] * v_[23] + (v_[10] * v_[25] + (v_[9] * v_[28] + (v_[19] * v_[37] + v_[18] * v_[41])))) + x_in[8] * v_[31] + x_in[9] * v_[24] + x_in[10] * v_[34] + x_in[11] * v_[32] + x_in[12] * v_[36];
+    v_[5] = x_in[8] * v_[38] + x_in[9] * v_[4] + x_in[10] * v_[40] + x_in[11] * v_[39] + x_in[12] * v_[50] + 1e-10;
+    v_[18] = sqrt(v_[5] * v_[5] + v_[2] * v_[2] + v_[3] * v_[3]);
+    v_[19] = sqrt(x_in[16] * x_in[16]);
+    v_[23] = x_in[27] * 10.;
+    v_[25] = (x_in[26] * 2. - 1.) * (x_in[25] * 3.);
+    v_[28] = x_in[25] * 601.;
+    v_[29] = v_[5] * v_[28];
+    v_[0] = (x_in[8] * (-(v_[31] * v_[0]) - v_[35] * v_[1]) + x_in[9] * (v_[24] * (v_[51] - v_[0]) - v_[26] * (v_[1] + v_[52])) + x_in[10] * (v_[34] * (v_[51] + v_[55]) - v_[33] * (v_[52] + v_[57])) + x_in[11] * (v_[32] * (v_[55] + v_[58]) - v_[27] * (v_[57] + v_[59])) + x_in[12] * (v_[36] * (v_[58] + (v_[58] + x_in[12] * (v_[13] * (v_[10] * v_[16] - v_[9] * v_[15]) + v_[14] * (-v_[20] - v_[17])))) - v_[30] * (v_[59] + (v_[59] + x_in[12] * (v_[14] * (v_[46] - v_[44]) + v_[13] * (v_[10] * (-v_[43] - v_[45]) - v_[9] * v_[42]))))) + (v_[6] * v_[50] + (v_[11] * v_[39] + v_[12] * v_[40]) + (v_[8] * v_[4] + v_[22] * v_[38]))) * 10. + v_[5] * 601. + (v_[25] * (v_[5] * v_[19]) / v_[23] + v_[5] / v_[18] * v_[29]);
+    v_[1] = x_in[30] * 0.5;
+    v_[4] = x_in[0] + x_in[7] * v_[1];
+    v_[5] = x_in[1] + x_in[8] * v_[1];
+    v_[9] = x_in[2] + x_in[9] * v_[1];
+    v_[10] = x_in[3] + x_in[10] * v_[1];
+    v_[13] = x_in[4] + x_in[11] * v_[1];
+    v_[14] = x_in[5] + x_in[12] * v_[1];
+    v_[15] = x_in[6] + x_in[13] * v_[1];
+    v_[16] = x_in[7] + v_[21] * v_[1];
+    v_[17] = x_in[8] + v_[22] * v_[1];
+    v_[20] = x_in[9] + v_[8] * v_[1];
+    v_[24] = x_in[10] + v_[12] * v_[1];
+    v_[26] = x_in[11] + v_[11] * v_[1];
+    v_[27] = x_in[12] + v_[6] * v_[1];
+    v_[30] = x_in[13] + v_[7] * v_[1];
+    v_[31] = x_in[16] + v_[0] * v_[1];
+    v_[32] = sin(v_[4]);
+    v_[4] = cos(v_[4]);
+    v_[33] = sin(v_[5]);
+    v_[5] = cos(v_[5]);
+    v_[34] = sin(v_[9]);
+    v_[9] = cos(v_[9]);
+    v_[35] = 0.2045 * v_[34];
+    v_[36] = 0.2045 * v_[9];
+    v_[37] = -0.2045 * v_[34];
+    v_[38] = sin(v_[10]);
+    v_[10] = cos(v_[10]);
+    v_[39] = 0.2155 * v_[10];
+    v_[40] = -0.2155 * v_[38];
+    v_[41] = sin(v_[13]);
+    v_[13] = cos(v_[13]);
+    v_[42] = 0.1845 * v_[41];
+    v_[43] = 0.1845 * v_[13];
+    v_[44] = -0.1845 * v_[41];
+    v_[45] = sin(v_[14]);
+    v_[14] = cos(v_[14]);
+    v_[46] = 0.2155 * v_[14];
+    v_[47] = -0.2155 * v_[45];
+    v_[48] = sin(v_[15]);
+    v_[15] = cos(v_[15]);
+    v_[49] = 0.081 * v_[48];
+    v_[50] = 0.081 * v_[15];
+    v_[51] = -0.081 * v_[48];
+    v_[52] = v_[16] * v_[33];
+    v_[53] = v_[16] * v_[5];
+    v_[54] = v_[17] * v_[53];
+    v_[55] = v_[17] * v_[52];
+    v_[56] = 0.071 * v_[52];
+    v_[57] = 0.025 * v_[53];
+    v_[58] = 0.0579 * v_[17];
+    v_[59] = v_[17] * v_[34] - v_[9] * v_[52];
+    v_[60] = v_[17] * v_[9] + v_[34] * v_[52];
+    v_[61] = v_[17] * v_[36] + v_[35] * v_[52];
+    v_[62] = v_[17] * v_[37] + v_[36] * v_[52];
+    v_[63] = v_[20] + v_[53];
+    v_[64] = v_[20] * v_[60];
+    v_[65] = v_[20] * v_[59];
+    v_[66] = v_[20] * v_[62];
+    v_[67] = v_[20] * v_[61];
+    v_[68] = -0.39 * v_[62] + 0.1334 * v_[59];
+    v_[69] = 0.39 * v_[61] + (-0.0117 * v_[63] + 0.1257 * v_[60]);
+    v_[70] = -0.09 * v_[61] + (0.0127 * v_[63] + -0.0117 * v_[60]);
+    v_[71] = 3. * v_[61] + (-0.09 * v_[63] + 0.39 * v_[60]);
+    v_[72] = 3. * v_[62] + -0.39 * v_[59];
+    v_[73] = 0.09 * v_[59];
+    v_[74] = v_[38] * v_[63] + v_[10] * v_[59];
+    v_[75] = v_[10] * v_[63] - v_[38] * v_[59];
+    v_[76] = v_[10] * v_[61] + v_[39] * v_[60];
+    v_[77] = v_[40] * v_[60] - v_[38] * v_[61];
+    v_[78] = 0.2155 * v_[59] - v_[62];
+    v_[79] = v_[24] - v_[60];
+    v_[80] = v_[24] * v_[75];
+    v_[81] = v_[24] * v_[74];
+    v_[82] = v_[24] * v_[77];
+    v_[83] = v_[24] * v_[76];
+    v_[84] = 0.1809 * v_[78] + -0.0918 * v_[77] + 0.0452 * v_[74];
+    v_[85] = 0.0918 * v_[76] + (-0.0061 * v_[79] + 0.0131 * v_[75]);
+    v_[86] = -0.1809 * v_[76] + (0.0411 * v_[79] + -0.0061 * v_[75]);
+    v_[87] = 2.7 * v_[76] + (-0.1809 * v_[79] + 0.0918 * v_[75]);
+    v_[88] = 2.7 * v_[77] + -0.0918 * v_[74];
+    v_[89] = 2.7 * v_[78] + 0.1809 * v_[74];
+    v_[90] = v_[41] * v_[79] - v_[13] * v_[74];
+    v_[91] = v_[13] * v_[79] + v_[41] * v_[74];
+    v_[92] = v_[41] * v_[78] - v_[13] * v_[76] + (v_[43] * v_[79] + v_[42] * v_[74]);
+    v_[93] = v_[13] * v_[78] + v_[41] * v_[76] + (v_[44] * v_[79] + v_[43] * v_[74]);
+    v_[94] = v_[26] + v_[75];
+    v_[95] = v_[26] * v_[91];
+    v_[96] = v_[26] * v_[90];
+    v_[97] = v_[26] * v_[93];
+    v_[98] = v_[26] * v_[92];
+    v_[99] = 0.0357 * v_[77] + -0.1292 * v_[93] + 0.0306 * v_[90];
+    v_[100] = -0.00017 * v_[77] + 0.1292 * v_[92] + (-0.0027 * v_[94] + 0.0279 * v_[91]);
+    v_[101] = 0.00017 * v_[93] + -0.0357 * v_[92] + (0.0058 * v_[94] + -0.0027 * v_[91]);
+    v_[102] = 1.7 * v_[92] + (-0.0357 * v_[94] + 0.1292 * v_[91]);
+    v_[103] = 1.7 * v_[93] + (0.00017 * v_[94] + -0.1292 * v_[90]);
+    v_[104] = 1.7 * v_[77] + (-0.00017 * v_[91] + 0.0357 * v_[90]);
+    v_[105] = v_[45] * v_[94] + v_[14] * v_[90];
+    v_[106] = v_[14] * v_[94] - v_[45] * v_[90];
+    v_[107] = v_[45] * v_[77] + v_[14] * v_[92] + v_[46] * v_[91];
+    v_[108] = v_[14] * v_[77] - v_[45] * v_[92] + v_[47] * v_[91];
+    v_[109] = 0.2155 * v_[90] - v_[93];
+    v_[110] = v_[27] - v_[91];
+    v_[111] = v_[27] * v_[106];
+    v_[112] = v_[27] * v_[105];
+    v_[113] = v_[27] * v_[108];
+    v_[114] = v_[27] * v_[107];
+    v_[115] = 0.00108 * v_[109] + -0.00072 * v_[108] + 0.0005 * v_[105];
+    v_[116] = 0.00072 * v_[107] + 0.0036 * v_[106];
+    v_[117] = -0.00108 * v_[107] + 0.0047 * v_[110];
+    v_[118] = 1.8 * v_[107] + (-0.00108 * v_[110] + 0.00072 * v_[106]);
+    v_[119] = 1.8 * v_[108] + -0.00072 * v_[105];
+    v_[120] = 1.8 * v_[109] + 0.00108 * v_[105];
+    v_[121] = v_[48] * v_[110] - v_[15] * v_[105];
+    v_[122] = v_[15] * v_[110] + v_[48] * v_[105];
+    v_[123] = v_[48] * v_[109] - v_[15] * v_[107] + (v_[50] * v_[110] + v_[49] * v_[105]);
+    v_[124] = v_[15] * v_[109] + v_[48] * v_[107] + (v_[51] * v_[110] + v_[50] * v_[105]);
+    v_[125] = v_[30] + v_[106];
+    v_[126] = v_[30] * v_[122];
+    v_[127] = v_[30] * v_[121];
+    v_[128] = v_[30] * v_[124];
+    v_[129] = v_[30] * v_[123];
+    v_[130] = -0.006 * v_[124] + 0.001 * v_[121];
+    v_[131] = 0.006 * v_[123] + 0.001 * v_[122];
+    v_[132] = 0.001 * v_[125];
+    v_[133] = 0.3 * v_[123] + 0.006 * v_[122];
+    v_[134] = 0.3 * v_[124] + -0.006 * v_[121];
+    v_[135] = 0.3 * v_[108];
+    v_[136] = v_[123] * v_[134] - v_[124] * v_[133] + (v_[121] * v_[131] - v_[122] * v_[130]);
+    v_[137] = x_in[23] + -0.2 * v_[30] - v_[136];
+    v_[124] = v_[124] * v_[135] - v_[108] * v_[134] + (v_[122] * v_[132] - v_[125] * v_[131]) + (0.001 * v_[126] - -0.006 * v_[129]);
+    v_[123] = v_[108] * v_[133] - v_[123] * v_[135] + (v_[125] * v_[130] - v_[121] * v_[132]) + (0.006 * v_[128] - 0.001 * v_[127]);
+    v_[127] = v_[122] * v_[135] - v_[125] * v_[134] + (0.3 * v_[128] - 0.006 * v_[127]);
+    v_[125] = v_[125] * v_[133] - v_[121] * v_[135] + (-0.006 * v_[126] - 0.3 * v_[129]);
+    v_[126] = 0.001 * v_[15];
+    v_[128] = -0.006 * v_[50] - v_[126];
+    v_[129] = 0.001 * v_[48];
+    v_[130] = -0.006 * v_[51] + v_[129];
+    v_[131] = -0.006 * v_[48];
+    v_[132] = -0.006 * v_[15];
+    v_[129] = v_[129] + 0.006 * v_[49];
+    v_[126] = v_[126] + 0.006 * v_[50];
+    v_[135] = 0.006 * v_[15];
+    v_[138] = 0.006 * v_[48];
+    v_[139] = v_[138] + 0.3 * v_[49];
+    v_[140] = 0.3 * v_[50];
+    v_[141] = v_[135] + v_[140];
+    v_[142] = 0.3 * v_[15];
+    v_[143] = 0.3 * v_[48];
+    v_[140] = v_[140] - v_[132];
+    v_[144] = v_[131] + 0.3 * v_[51];
+    v_[145] = v_[50] * v_[143];
+    v_[146] = v_[50] * v_[142];
+    v_[147] = v_[51] * v_[140] + v_[50] * v_[139] + (v_[15] * v_[129] + v_[48] * v_[128]);
+    v_[148] = v_[145] + v_[51] * v_[142] + (v_[15] * v_[138] + v_[48] * v_[132]);
+    v_[149] = v_[48] * v_[142];
+    v_[150] = v_[15] * v_[143];
+    v_[151] = 0.0047 + (v_[51] * v_[144] + v_[50] * v_[141] + (v_[15] * v_[126] + v_[48] * v_[130]));
+    v_[152] = -0.00108 + (v_[51] * v_[143] - v_[146] + (v_[48] * v_[131] - v_[15] * v_[135]));
+    v_[153] = 1.8 + (v_[48] * v_[143] + v_[15] * v_[142]);
+    v_[51] = v_[107] * v_[119] - v_[108] * v_[118] + (v_[105] * v_[116] - v_[106] * v_[115]) + (v_[51] * v_[125] + v_[50] * v_[127] + (v_[15] * v_[123] + v_[48] * v_[124]));
+    v_[154] = x_in[22] + -0.5 * v_[27] - v_[51];
+    v_[155] = v_[147] / v_[151];
+    v_[156] = v_[151] / v_[151];
+    v_[157] = v_[152] / v_[151];
+    v_[158] = v_[148] / v_[151];
+    v_[128] = 0.0005 + (v_[50] * v_[140] + v_[49] * v_[139] + (v_[48] * v_[129] - v_[15] * v_[128])) - v_[147] * v_[155];
+    v_[126] = v_[50] * v_[144] + v_[49] * v_[141] + (v_[48] * v_[126] - v_[15] * v_[130]) - v_[151] * v_[155];
+    v_[129] = v_[145] - v_[49] * v_[142] + (-(v_[15] * v_[131]) - v_[48] * v_[135]) - v_[152] * v_[155];
+    v_[130] = 0.00108 + (v_[146] + v_[49] * v_[143] + (v_[48] * v_[138] - v_[15] * v_[132])) - v_[148] * v_[155];
+    v_[131] = v_[147] - v_[147] * v_[156];
+    v_[132] = v_[152] - v_[152] * v_[156];
+    v_[135] = v_[148] - v_[148] * v_[156];
+    v_[138] = v_[48] * v_[140] - v_[15] * v_[139] - v_[147] * v_[157];
+    v_[142] = -0.00108 + (v_[48] * v_[144] - v_[15] * v_[141]) - v_[151] * v_[157];
+    v_[143] = v_[153] - v_[152] * v_[157];
+    v_[145] = v_[149] - v_[150] - v_[148] * v_[157];
+    v_[139] = 0.00108 + (v_[15] * v_[140] + v_[48] * v_[139]) - v_[147] * v_[158];
+    v_[140] = v_[150] - v_[149] - v_[152] * v_[158];
+    v_[146] = v_[153] - v_[148] * v_[158];
+    v_[49] = v_[147] * v_[154] / v_[151] + (v_[108] * v_[120] - v_[109] * v_[119] + (v_[106] * v_[117] - v_[110] * v_[116]) + (v_[50] * v_[125] + v_[49] * v_[127] + (v_[48] * v_[123] - v_[15] * v_[124])) + (v_[113] * v_[138] - -0.00072 * v_[114] + v_[111] * v_[128]));
+    v_[50] = v_[109] * v_[118] - v_[107] * v_[120] + (v_[110] * v_[115] - v_[105] * v_[117]) + (v_[136] + 0.001 * v_[137] / 0.001) + (0.00072 * v_[113] - 0.0036 * v_[112]);
+    v_[107] = v_[152] * v_[154] / v_[151] + (v_[106] * v_[120] - v_[110] * v_[119] + (v_[48] * v_[125] - v_[15] * v_[127]) + (v_[113] * v_[143] + (v_[111] * v_[129] - 0.00072 * v_[112])));
+    v_[108] = v_[110] * v_[118] - v_[105] * v_[120] + (v_[121] * v_[134] - v_[122] * v_[133]) + (-0.00072 * v_[111] - 2.1 * v_[114]);
+    v_[105] = v_[148] * v_[154] / v_[151] + (v_[105] * v_[119] - v_[106] * v_[118] + (v_[15] * v_[125] + v_[48] * v_[127]) + (v_[113] * v_[145] + v_[111] * v_[130]));
+    v_[106] = 0.2155 * v_[130] + v_[14] * v_[128];
+    v_[109] = -0.00072 * v_[47] + v_[46] * v_[129] - v_[126];
+    v_[110] = v_[45] * v_[128];
+    v_[114] = -0.00072 * v_[45];
+    v_[115] = v_[14] * v_[129] - v_[114];
+    v_[116] = -0.00072 * v_[14];
+    v_[117] = v_[116] + v_[45] * v_[129];
+    v_[118] = 0.0036 * v_[45];
+    v_[119] = 0.00072 * v_[46];
+    v_[120] = 0.0036 * v_[14];
+    v_[121] = 0.00072 * v_[14];
+    v_[122] = 0.00072 * v_[45];
+    v_[123] = 0.2155 * v_[145] + (v_[14] * v_[138] - v_[122]);
+    v_[124] = v_[46] * v_[143] - v_[142];
+    v_[125] = v_[121] + v_[45] * v_[138];
+    v_[127] = v_[14] * v_[143];
+    v_[128] = v_[45] * v_[143];
+    v_[129] = 2.1 * v_[47];
+    v_[133] = 2.1 * v_[45];
+    v_[134] = 2.1 * v_[14];
+    v_[136] = 0.2155 * v_[146];
+    v_[138] = v_[136] + v_[14] * v_[139];
+    v_[15] = v_[46] * v_[140] - (v_[15] * v_[144] + v_[48] * v_[141] - v_[151] * v_[158]);
+    v_[48] = v_[45] * v_[139];
+    v_[139] = v_[14] * v_[140];
+    v_[140] = v_[45] * v_[140];
+    v_[141] = v_[45] * v_[106] - v_[14] * v_[118];
+    v_[143] = v_[14] * v_[122] + v_[45] * v_[117];
+    v_[144] = -0.0027 + (v_[14] * v_[119] + v_[45] * v_[109]);
+    v_[149] = 0.0058 + (v_[14] * v_[120] + v_[45] * v_[110]);
+    v_[150] = -0.0357 + (v_[14] * v_[121] + v_[45] * v_[115]);
+    v_[153] = 0.00017 - v_[45] * v_[130];
+    v_[155] = v_[92] * v_[103] - v_[93] * v_[102] + (v_[90] * v_[100] - v_[91] * v_[99]) + (v_[14] * v_[50] + v_[45] * v_[49]);
+    v_[157] = x_in[21] - v_[26] - v_[155];
+    v_[158] = v_[141] / v_[149];
+    v_[159] = v_[144] / v_[149];
+    v_[160] = v_[149] / v_[149];
+    v_[161] = v_[150] / v_[149];
+    v_[162] = v_[153] / v_[149];
+    v_[163] = v_[143] / v_[149];
+    v_[106] = 0.0306 + (0.2155 * v_[138] + (v_[45] * v_[118] + v_[14] * v_[106])) - v_[141] * v_[158];
+    v_[109] = 0.2155 * v_[15] + (v_[14] * v_[109] - v_[45] * v_[119]) - v_[144] * v_[158];
+    v_[110] = 0.2155 * v_[48] + (v_[14] * v_[110] - v_[45] * v_[120]) - v_[149] * v_[158];
+    v_[115] = 0.2155 * v_[139] + (v_[14] * v_[115] - v_[45] * v_[121]) - v_[150] * v_[158];
+    v_[118] = -0.1292 + (-(v_[14] * v_[130]) - v_[136]) - v_[153] * v_[158];
+    v_[117] = 0.0357 + (0.2155 * v_[140] + (v_[14] * v_[117] - v_[45] * v_[122])) - v_[143] * v_[158];
+    v_[119] = v_[47] * v_[116] + v_[46] * v_[123] - (0.2155 * v_[135] + v_[14] * v_[131]) - v_[141] * v_[159];
+    v_[120] = 0.0279 + (v_[47] * v_[129] + v_[46] * v_[124] - (v_[46] * v_[132] - (v_[151] - v_[151] * v_[156]))) - v_[144] * v_[159];
+    v_[121] = -0.0027 + (v_[47] * v_[114] + v_[46] * v_[125] - v_[45] * v_[131]) - v_[149] * v_[159];
+    v_[122] = 0.1292 + (v_[46] * v_[127] - v_[47] * v_[133] - v_[14] * v_[132]) - v_[150] * v_[159];
+    v_[130] = v_[135] - v_[46] * v_[145] - v_[153] * v_[159];
+    v_[131] = -0.00017 + (v_[47] * v_[134] + v_[46] * v_[128] - v_[45] * v_[132]) - v_[143] * v_[159];
+    v_[132] = v_[141] - v_[141] * v_[160];
+    v_[135] = v_[144] - v_[144] * v_[160];
+    v_[136] = v_[150] - v_[150] * v_[160];
+    v_[156] = v_[153] - v_[153] * v_[160];
+    v_[158] = v_[14] * v_[123] - v_[45] * v_[116] - v_[141] * v_[161];
+    v_[159] = 0.1292 + (v_[14] * v_[124] - v_[45] * v_[129]) - v_[144] * v_[161];
+    v_[164] = -0.0357 + (v_[14] * v_[125] - v_[45] * v_[114]) - v_[149] * v_[161];
+    v_[165] = 1.7 + (v_[45] * v_[133] + v_[14] * v_[127]) - v_[150] * v_[161];
+    v_[166] = -(v_[14] * v_[145]) - v_[153] * v_[161];
+    v_[161] = v_[14] * v_[128] - v_[45] * v_[134] - v_[143] * v_[161];
+    v_[138] = -0.1292 - v_[138] - v_[141] * v_[162];
+    v_[15] = -v_[15] - v_[144] * v_[162];
+    v_[48] = 0.00017 - v_[48] - v_[149] * v_[162];
+    v_[139] = -v_[139] - v_[150] * v_[162];
+    v_[146] = 1.7 + v_[146] - v_[153] * v_[162];
+    v_[140] = -v_[140] - v_[143] * v_[162];
+    v_[116] = 0.0357 + (v_[14] * v_[116] + v_[45] * v_[123]) - v_[141] * v_[163];
+    v_[123] = -0.00017 + (v_[14] * v_[129] + v_[45] * v_[124]) - v_[144] * v_[163];
+    v_[124] = v_[45] * v_[127] - v_[14] * v_[133] - v_[150] * v_[163];
+    v_[127] = -(v_[45] * v_[145]) - v_[153] * v_[163];
+    v_[49] = v_[141] * v_[157] / v_[149] + (v_[93] * v_[104] - v_[77] * v_[103] + (v_[91] * v_[101] - v_[94] * v_[100]) + (0.2155 * v_[105] + (v_[14] * v_[49] - v_[45] * v_[50])) + (v_[97] * v_[158] - v_[98] * v_[138] + (v_[95] * v_[106] - v_[96] * v_[119])));
+    v_[47] = v_[144] * v_[157] / v_[149] + (v_[77] * v_[102] - v_[92] * v_[104] + (v_[94] * v_[99] - v_[90] * v_[101]) + (v_[47] * v_[108] + v_[46] * v_[107] - (v_[151] * v_[154] / v_[151] + (v_[51] + (v_[113] * v_[142] + v_[111] * v_[126])))) + (v_[97] * v_[159] - v_[98] * v_[15] + (v_[95] * v_[109] - v_[96] * v_[120])));
+    v_[50] = v_[150] * v_[157] / v_[149] + (v_[91] * v_[104] - v_[94] * v_[103] + (v_[14] * v_[107] - v_[45] * v_[108]) + (v_[97] * v_[165] - v_[98] * v_[139] + (v_[95] * v_[115] - v_[96] * v_[122])));
+    v_[51] = v_[153] * v_[157] / v_[149] + (v_[94] * v_[102] - v_[90] * v_[104] - v_[105] + (v_[97] * v_[166] - v_[98] * v_[146] + (v_[95] * v_[118] - v_[96] * v_[130])));
+    v_[92] = v_[43] * v_[118] + v_[42] * v_[115] + (v_[41] * v_[109] - v_[13] * v_[106]);
+    v_[93] = v_[44] * v_[118] + v_[43] * v_[115] + (v_[13] * v_[109] + v_[41] * v_[106]);
+    v_[94] = v_[41] * v_[118] - v_[13] * v_[115];
+    v_[99] = v_[13] * v_[118] + v_[41] * v_[115];
+    v_[100] = v_[43] * v_[130] + v_[42] * v_[122] + (v_[41] * v_[120] - v_[13] * v_[119]);
+    v_[101] = v_[44] * v_[130] + v_[43] * v_[122] + (v_[13] * v_[120] + v_[41] * v_[119]);
+    v_[104] = v_[41] * v_[130] - v_[13] * v_[122];
+    v_[105] = v_[13] * v_[130] + v_[41] * v_[122];
+    v_[106] = v_[43] * v_[166] + v_[42] * v_[165] + (v_[41] * v_[159] - v_[13] * v_[158]);
+    v_[109] = v_[44] * v_[166] + v_[43] * v_[165] + (v_[13] * v_[159] + v_[41] * v_[158]);
+    v_[115] = v_[41] * v_[166] - v_[13] * v_[165];
+    v_[118] = v_[13] * v_[166] + v_[41] * v_[165];
+    v_[119] = v_[43] * v_[146] + v_[42] * v_[139] + (v_[41] * v_[15] - v_[13] * v_[138]);
+    v_[15] = v_[44] * v_[146] + v_[43] * v_[139] + (v_[13] * v_[15] + v_[41] * v_[138]);
+    v_[120] = v_[41] * v_[146] - v_[13] * v_[139];
+    v_[122] = v_[13] * v_[146] + v_[41] * v_[139];
+    v_[126] = v_[44] * v_[119] + v_[43] * v_[106] + (v_[13] * v_[100] + v_[41] * v_[92]);
+    v_[129] = v_[44] * v_[140] + v_[43] * v_[161] + (v_[13] * v_[131] + v_[41] * v_[117]);
+    v_[130] = v_[44] * v_[122] + v_[43] * v_[118] + (v_[13] * v_[105] + v_[41] * v_[99]);
+    v_[133] = -0.0061 + (v_[44] * v_[48] + v_[43] * v_[164] + (v_[13] * v_[121] + v_[41] * v_[110]));
+    v_[138] = 0.0411 + (v_[44] * v_[15] + v_[43] * v_[109] + (v_[13] * v_[101] + v_[41] * v_[93]));
+    v_[139] = -0.1809 + (v_[44] * v_[120] + v_[43] * v_[115] + (v_[13] * v_[104] + v_[41] * v_[94]));
+    v_[142] = v_[76] * v_[88] - v_[77] * v_[87] + (v_[74] * v_[85] - v_[75] * v_[84]) + (v_[44] * v_[51] + v_[43] * v_[50] + (v_[13] * v_[47] + v_[41] * v_[49]));
+    v_[145] = x_in[20] + -0.3 * v_[24] - v_[142];
+    v_[146] = v_[126] / v_[138];
+    v_[158] = v_[133] / v_[138];
+    v_[159] = v_[138] / v_[138];
+    v_[162] = v_[139] / v_[138];
+    v_[165] = v_[129] / v_[138];
+    v_[166] = v_[130] / v_[138];
+    v_[92] = 0.0452 + (v_[43] * v_[119] + v_[42] * v_[106] + (v_[41] * v_[100] - v_[13] * v_[92])) - v_[126] * v_[146];
+    v_[100] = v_[43] * v_[48] + v_[42] * v_[164] + (v_[41] * v_[121] - v_[13] * v_[110]) - v_[133] * v_[146];
+    v_[93] = v_[43] * v_[15] + v_[42] * v_[109] + (v_[41] * v_[101] - v_[13] * v_[93]) - v_[138] * v_[146];
+    v_[94] = v_[43] * v_[120] + v_[42] * v_[115] + (v_[41] * v_[104] - v_[13] * v_[94]) - v_[139] * v_[146];
+    v_[101] = -0.0918 + (v_[43] * v_[140] + v_[42] * v_[161] + (v_[41] * v_[131] - v_[13] * v_[117])) - v_[129] * v_[146];
+    v_[99] = 0.1809 + (v_[43] * v_[122] + v_[42] * v_[118] + (v_[41] * v_[105] - v_[13] * v_[99])) - v_[130] * v_[146];
+    v_[104] = v_[43] * v_[156] + v_[42] * v_[136] + (v_[41] * v_[135] - v_[13] * v_[132]) - v_[126] * v_[158];
+    v_[105] = 0.0131 + (v_[149] - v_[149] * v_[160]) - v_[133] * v_[158];
+    v_[132] = -0.0061 + (v_[44] * v_[156] + v_[43] * v_[136] + (v_[13] * v_[135] + v_[41] * v_[132])) - v_[138] * v_[158];
+    v_[135] = 0.0918 + (v_[41] * v_[156] - v_[13] * v_[136]) - v_[139] * v_[158];
+    v_[146] = v_[143] - v_[143] * v_[160] - v_[129] * v_[158];
+    v_[136] = v_[13] * v_[156] + v_[41] * v_[136] - v_[130] * v_[158];
+    v_[156] = v_[126] - v_[126] * v_[159];
+    v_[158] = v_[133] - v_[133] * v_[159];
+    v_[160] = v_[139] - v_[139] * v_[159];
+    v_[167] = v_[129] - v_[129] * v_[159];
+    v_[168] = v_[130] - v_[130] * v_[159];
+    v_[169] = v_[41] * v_[119] - v_[13] * v_[106] - v_[126] * v_[162];
+    v_[170] = 0.0918 + (v_[41] * v_[48] - v_[13] * v_[164]) - v_[133] * v_[162];
+    v_[171] = -0.1809 + (v_[41] * v_[15] - v_[13] * v_[109]) - v_[138] * v_[162];
+    v_[172] = 2.7 + (v_[41] * v_[120] - v_[13] * v_[115]) - v_[139] * v_[162];
+    v_[173] = v_[41] * v_[140] - v_[13] * v_[161] - v_[129] * v_[162];
+    v_[162] = v_[41] * v_[122] - v_[13] * v_[118] - v_[130] * v_[162];
+    v_[174] = -0.0918 + (v_[43] * v_[127] + v_[42] * v_[124] + (v_[41] * v_[123] - v_[13] * v_[116])) - v_[126] * v_[165];
+    v_[114] = v_[14] * v_[114] + v_[45] * v_[125] - v_[149] * v_[163] - v_[133] * v_[165];
+    v_[116] = v_[44] * v_[127] + v_[43] * v_[124] + (v_[13] * v_[123] + v_[41] * v_[116]) - v_[138] * v_[165];
+    v_[123] = v_[41] * v_[127] - v_[13] * v_[124] - v_[139] * v_[165];
+    v_[125] = 2.7 + (1.7 + (v_[14] * v_[134] + v_[45] * v_[128]) - v_[143] * v_[163]) - v_[129] * v_[165];
+    v_[124] = v_[13] * v_[127] + v_[41] * v_[124] - v_[130] * v_[165];
+    v_[106] = 0.1809 + (v_[13] * v_[119] + v_[41] * v_[106]) - v_[126] * v_[166];
+    v_[119] = v_[13] * v_[48] + v_[41] * v_[164] - v_[133] * v_[166];
+    v_[115] = v_[13] * v_[120] + v_[41] * v_[115] - v_[139] * v_[166];
+    v_[120] = v_[13] * v_[140] + v_[41] * v_[161] - v_[129] * v_[166];
+    v_[118] = 2.7 + (v_[13] * v_[122] + v_[41] * v_[118]) - v_[130] * v_[166];
+    v_[47] = v_[126] * v_[145] / v_[138] + (v_[77] * v_[89] - v_[78] * v_[88] + (v_[75] * v_[86] - v_[79] * v_[85]) + (v_[43] * v_[51] + v_[42] * v_[50] + (v_[41] * v_[47] - v_[13] * v_[49])) + (v_[82] * v_[169] - v_[83] * v_[174] + (v_[80] * v_[92] - v_[81] * v_[104])));
+    v_[48] = v_[133] * v_[145] / v_[138] + (v_[78] * v_[87] - v_[76] * v_[89] + (v_[79] * v_[84] - v_[74] * v_[86]) + (v_[149] * v_[157] / v_[149] + (v_[155] + (v_[97] * v_[164] - v_[98] * v_[48] + (v_[95] * v_[110] - v_[96] * v_[121])))) + (v_[82] * v_[170] - v_[83] * v_[114] + (v_[80] * v_[100] - v_[81] * v_[105])));
+    v_[49] = v_[139] * v_[145] / v_[138] + (v_[75] * v_[89] - v_[79] * v_[88] + (v_[41] * v_[51] - v_[13] * v_[50]) + (v_[82] * v_[172] - v_[83] * v_[123] + (v_[80] * v_[94] - v_[81] * v_[135])));
+    v_[76] = v_[129] * v_[145] / v_[138] + (v_[79] * v_[87] - v_[74] * v_[89] + (v_[143] * v_[157] / v_[149] + (v_[90] * v_[103] - v_[91] * v_[102] + (v_[14] * v_[108] + v_[45] * v_[107]) + (v_[97] * v_[161] - v_[98] * v_[140] + (v_[95] * v_[117] - v_[96] * v_[131])))) + (v_[82] * v_[173] - v_[83] * v_[125] + (v_[80] * v_[101] - v_[81] * v_[146])));
+    v_[50] = v_[130] * v_[145] / v_[138] + (v_[74] * v_[88] - v_[75] * v_[87] + (v_[13] * v_[51] + v_[41] * v_[50]) + (v_[82] * v_[162] - v_[83] * v_[124] + (v_[80] * v_[99] - v_[81] * v_[136])));
+    v_[51] = 0.2155 * v_[99] + (v_[10] * v_[92] - v_[38] * v_[100]);
+    v_[74] = v_[40] * v_[101] + v_[39] * v_[94] - v_[93];
+    v_[75] = v_[10] * v_[100] + v_[38] * v_[92];
+    v_[77] = v_[10] * v_[94] - v_[38] * v_[101];
+    v_[78] = 0.2155 * v_[136] + (v_[10] * v_[104] - v_[38] * v_[105]);
+    v_[79] = v_[40] * v_[146] + v_[39] * v_[135] - v_[132];
+    v_[84] = v_[10] * v_[105] + v_[38] * v_[104];
+    v_[85] = v_[10] * v_[135] - v_[38] * v_[146];
+    v_[86] = 0.2155 * v_[162] + (v_[10] * v_[169] - v_[38] * v_[170]);
+    v_[87] = v_[40] * v_[173] + v_[39] * v_[172] - v_[171];
+    v_[88] = v_[10] * v_[170] + v_[38] * v_[169];
+    v_[89] = v_[10] * v_[172] - v_[38] * v_[173];
+    v_[90] = 0.2155 * v_[124] + (v_[10] * v_[174] - v_[38] * v_[114]);
+    v_[91] = v_[40] * v_[125] + v_[39] * v_[123] - v_[116];
+    v_[92] = v_[10] * v_[114] + v_[38] * v_[174];
+    v_[94] = v_[10] * v_[123] - v_[38] * v_[125];
+    v_[100] = 0.2155 * v_[118];
+    v_[101] = v_[100] + (v_[10] * v_[106] - v_[38] * v_[119]);
+    v_[15] = v_[40] * v_[120] + v_[39] * v_[115] - (v_[13] * v_[15] + v_[41] * v_[109] - v_[138] * v_[166]);
+    v_[102] = v_[10] * v_[119] + v_[38] * v_[106];
+    v_[103] = v_[10] * v_[115] - v_[38] * v_[120];
+    v_[104] = v_[10] * v_[78] + v_[38] * v_[51];
+    v_[105] = -(v_[38] * v_[99]) - v_[10] * v_[136];
+    v_[106] = -0.0117 + (v_[10] * v_[79] + v_[38] * v_[74]);
+    v_[107] = 0.0127 + (v_[10] * v_[84] + v_[38] * v_[75]);
+    v_[108] = -0.09 + (v_[10] * v_[85] + v_[38] * v_[77]);
+    v_[109] = v_[61] * v_[72] - v_[62] * v_[71] + (v_[59] * v_[69] - v_[60] * v_[68]) + (v_[10] * v_[48] + v_[38] * v_[47]);
+    v_[110] = x_in[19] + -0.5 * v_[20] - v_[109];
+    v_[114] = v_[104] / v_[107];
+    v_[115] = v_[106] / v_[107];
+    v_[117] = v_[107] / v_[107];
+    v_[119] = v_[108] / v_[107];
+    v_[120] = v_[105] / v_[107];
+    v_[51] = 0.1334 + (0.2155 * v_[101] + (v_[10] * v_[51] - v_[38] * v_[78])) - v_[104] * v_[114];
+    v_[74] = 0.2155 * v_[15] + (v_[10] * v_[74] - v_[38] * v_[79]) - v_[106] * v_[114];
+    v_[75] = 0.2155 * v_[102] + (v_[10] * v_[75] - v_[38] * v_[84]) - v_[107] * v_[114];
+    v_[77] = 0.2155 * v_[103] + (v_[10] * v_[77] - v_[38] * v_[85]) - v_[108] * v_[114];
+    v_[78] = -0.39 + (v_[38] * v_[136] - v_[10] * v_[99] - v_[100]) - v_[105] * v_[114];
+    v_[79] = v_[40] * v_[90] + v_[39] * v_[86] - (0.2155 * v_[168] + (v_[10] * v_[156] - v_[38] * v_[158])) - v_[104] * v_[115];
+    v_[84] = 0.1257 + (v_[40] * v_[91] + v_[39] * v_[87] - (v_[40] * v_[167] + v_[39] * v_[160] - (v_[138] - v_[138] * v_[159]))) - v_[106] * v_[115];
+    v_[85] = -0.0117 + (v_[40] * v_[92] + v_[39] * v_[88] - (v_[10] * v_[158] + v_[38] * v_[156])) - v_[107] * v_[115];
+    v_[99] = 0.39 + (v_[40] * v_[94] + v_[39] * v_[89] - (v_[10] * v_[160] - v_[38] * v_[167])) - v_[108] * v_[115];
+    v_[100] = v_[168] + (-(v_[39] * v_[162]) - v_[40] * v_[124]) - v_[105] * v_[115];
+    v_[86] = v_[10] * v_[86] - v_[38] * v_[90] - v_[104] * v_[119];
+    v_[87] = 0.39 + (v_[10] * v_[87] - v_[38] * v_[91]) - v_[106] * v_[119];
+    v_[88] = -0.09 + (v_[10] * v_[88] - v_[38] * v_[92]) - v_[107] * v_[119];
+    v_[89] = 3. + (v_[10] * v_[89] - v_[38] * v_[94]) - v_[108] * v_[119];
+    v_[90] = v_[38] * v_[124] - v_[10] * v_[162] - v_[105] * v_[119];
+    v_[91] = -0.39 - v_[101] - v_[104] * v_[120];
+    v_[15] = -v_[15] - v_[106] * v_[120];
+    v_[92] = -v_[102] - v_[107] * v_[120];
+    v_[94] = -v_[103] - v_[108] * v_[120];
+    v_[101] = 3. + v_[118] - v_[105] * v_[120];
+    v_[47] = v_[104] * v_[110] / v_[107] + (v_[62] * v_[73] + (v_[60] * v_[70] - v_[63] * v_[69]) + (0.2155 * v_[50] + (v_[10] * v_[47] - v_[38] * v_[48])) + (v_[66] * v_[86] - v_[67] * v_[91] + (v_[64] * v_[51] - v_[65] * v_[79])));
+    v_[48] = v_[106] * v_[110] / v_[107] + (v_[63] * v_[68] - v_[59] * v_[70] - v_[61] * v_[73] + (v_[40] * v_[76] + v_[39] * v_[49] - (v_[138] * v_[145] / v_[138] + (v_[142] + (v_[82] * v_[171] - v_[83] * v_[116] + (v_[80] * v_[93] - v_[81] * v_[132]))))) + (v_[66] * v_[87] - v_[67] * v_[15] + (v_[64] * v_[74] - v_[65] * v_[84])));
+    v_[49] = v_[108] * v_[110] / v_[107] + (v_[60] * v_[73] - v_[63] * v_[72] + (v_[10] * v_[49] - v_[38] * v_[76]) + (v_[66] * v_[89] - v_[67] * v_[94] + (v_[64] * v_[77] - v_[65] * v_[99])));
+    v_[50] = v_[105] * v_[110] / v_[107] + (v_[63] * v_[71] - v_[59] * v_[73] - v_[50] + (v_[66] * v_[90] - v_[67] * v_[101] + (v_[64] * v_[78] - v_[65] * v_[100])));
+    v_[59] = v_[36] * v_[78] + v_[35] * v_[77] + (v_[34] * v_[74] - v_[9] * v_[51]);
+    v_[60] = v_[36] * v_[100] + v_[35] * v_[99] + (v_[34] * v_[84] - v_[9] * v_[79]);
+    v_[61] = v_[36] * v_[90] + v_[35] * v_[89] + (v_[34] * v_[87] - v_[9] * v_[86]);
+    v_[62] = v_[36] * v_[101] + v_[35] * v_[94] + (v_[34] * v_[15] - v_[9] * v_[91]);
+    v_[63] = v_[37] * v_[62] + v_[36] * v_[61] + (v_[9] * v_[60] + v_[34] * v_[59]);
+    v_[68] = v_[37] * v_[92] + v_[36] * v_[88] + (v_[9] * v_[85] + v_[34] * v_[75]);
+    v_[15] = 0.0579 + (v_[37] * (v_[37] * v_[101] + v_[36] * v_[94] + (v_[9] * v_[15] + v_[34] * v_[91])) + v_[36] * (v_[37] * v_[90] + v_[36] * v_[89] + (v_[9] * v_[87] + v_[34] * v_[86])) + (v_[9] * (v_[37] * v_[100] + v_[36] * v_[99] + (v_[9] * v_[84] + v_[34] * v_[79])) + v_[34] * (v_[37] * v_[78] + v_[36] * v_[77] + (v_[9] * v_[74] + v_[34] * v_[51]))));
+    v_[51] = x_in[18] + -0.5 * v_[17] - (v_[52] * v_[57] - v_[53] * v_[56] + (v_[37] * v_[50] + v_[36] * v_[49] + (v_[9] * v_[48] + v_[34] * v_[47])));
+    v_[69] = v_[63] / v_[15];
+    v_[70] = v_[68] / v_[15];
+    v_[59] = 0.071 + (v_[36] * v_[62] + v_[35] * v_[61] + (v_[34] * v_[60] - v_[9] * v_[59])) - v_[63] * v_[69];
+    v_[60] = v_[36] * v_[92] + v_[35] * v_[88] + (v_[34] * v_[85] - v_[9] * v_[75]) - v_[68] * v_[69];
+    v_[61] = v_[36] * (v_[105] - v_[105] * v_[117]) + v_[35] * (v_[108] - v_[108] * v_[117]) + (v_[34] * (v_[106] - v_[106] * v_[117]) - v_[9] * (v_[104] - v_[104] * v_[117])) - v_[63] * v_[70];
+    v_[62] = 0.025 + (v_[107] - v_[107] * v_[117]) - v_[68] * v_[70];
+    v_[47] = (x_in[17] + -0.5 * v_[16] - (v_[5] * (v_[68] * v_[51] / v_[15] + (v_[17] * v_[56] - v_[52] * v_[58] + (v_[107] * v_[110] / v_[107] + (v_[109] + (v_[66] * v_[88] - v_[67] * v_[92] + (v_[64] * v_[75] - v_[65] * v_[85])))) + (v_[54] * v_[60] - v_[55] * v_[62]))) + v_[33] * (v_[63] * v_[51] / v_[15] + (v_[53] * v_[58] - v_[17] * v_[57] + (v_[36] * v_[50] + v_[35] * v_[49] + (v_[34] * v_[48] - v_[9] * v_[47])) + (v_[54] * v_[59] - v_[55] * v_[61]))))) / (0.0236 + (v_[5] * (v_[5] * v_[62] + v_[33] * v_[61]) + v_[33] * (v_[5] * v_[60] + v_[33] * v_[59])));
+    v_[48] = v_[54] + v_[33] * v_[47];
+    v_[49] = v_[5] * v_[47] - v_[55];
+    v_[15] = (v_[51] - (v_[68] * v_[49] + v_[63] * v_[48])) / v_[15];
+    v_[50] = v_[64] + (v_[34] * v_[15] - v_[9] * v_[48]);
+    v_[51] = v_[9] * v_[15] + v_[34] * v_[48] - v_[65];
+    v_[35] = v_[66] + (v_[36] * v_[15] + v_[35] * v_[48]);
+    v_[36] = v_[37] * v_[15] + v_[36] * v_[48] - v_[67];
+    v_[37] = (v_[110] - (v_[105] * v_[36] + v_[108] * v_[35] + (v_[107] * v_[49] + v_[106] * v_[51] + v_[104] * v_[50]))) / v_[107];
+    v_[48] = v_[49] + v_[37];
+    v_[36] = 0.2155 * v_[50] - v_[36];
+    v_[49] = v_[80] + (v_[38] * v_[48] + v_[10] * v_[50]);
+    v_[48] = v_[10] * v_[48] - v_[38] * v_[50] - v_[81];
+    v_[39] = v_[82] + (v_[10] * v_[35] + v_[39] * v_[51]);
+    v_[35] = v_[40] * v_[51] - v_[38] * v_[35] - v_[83];
+    v_[40] = (v_[145] - (v_[130] * v_[36] + v_[129] * v_[35] + v_[139] * v_[39] + (v_[133] * v_[48] - v_[138] * v_[51] + v_[126] * v_[49]))) / v_[138];
+    v_[50] = v_[40] - v_[51];
+    v_[51] = v_[95] + (v_[41] * v_[50] - v_[13] * v_[49]);
+    v_[52] = v_[13] * v_[50] + v_[41] * v_[49] - v_[96];
+    v_[42] = v_[97] + (v_[41] * v_[36] - v_[13] * v_[39] + (v_[43] * v_[50] + v_[42] * v_[49]));
+    v_[36] = v_[13] * v_[36] + v_[41] * v_[39] + (v_[44] * v_[50] + v_[43] * v_[49]) - v_[98];
+    v_[39] = (v_[157] - (v_[143] * v_[35] + v_[153] * v_[36] + v_[150] * v_[42] + (v_[149] * v_[48] + v_[144] * v_[52] + v_[141] * v_[51]))) / v_[149];
+    v_[43] = v_[48] + v_[39];
+    v_[35] = (v_[154] - (v_[148] * (0.2155 * v_[51] - v_[36]) + v_[152] * (v_[113] + (v_[45] * v_[35] + v_[14] * v_[42] + v_[46] * v_[52])) + (v_[147] * (v_[111] + (v_[45] * v_[43] + v_[14] * v_[51])) - v_[151] * v_[52]))) / v_[151];
+    v_[36] = (v_[137] - 0.001 * (v_[14] * v_[43] - v_[45] * v_[51] - v_[112])) / 0.001;
+    v_[42] = v_[4] * v_[33];
+    v_[43] = v_[4] * v_[5];
+    v_[44] = v_[34] * v_[43];
+    v_[46] = v_[32] * v_[9];
+    v_[43] = v_[32] * v_[34] - v_[9] * v_[43];
+    v_[48] = 0.42 * v_[4];
+    v_[49] = 0.4 * v_[4];
+    v_[50] = v_[33] * v_[49];
+    v_[51] = v_[5] * v_[49];
+    v_[52] = 0.4 * v_[32];
+    v_[53] = v_[34] * v_[52] - v_[9] * v_[51];
+    v_[54] = 0.241 * v_[4];
+    v_[55] = v_[5] * v_[54];
+    v_[56] = v_[9] * v_[55];
+    v_[57] = 0.241 * v_[32];
+    v_[58] = v_[34] * v_[57];
+    v_[59] = v_[58] - v_[56];
+    v_[60] = v_[33] * v_[54];
+    v_[61] = v_[10] * v_[60];
+    v_[62] = v_[38] * v_[59] + v_[61];
+    v_[63] = v_[9] * v_[57];
+    v_[64] = -0.241 * v_[4];
+    v_[65] = v_[34] * (v_[5] * v_[64]) - v_[63];
+    v_[56] = v_[56] - v_[58];
+    v_[58] = v_[38] * v_[60];
+    v_[66] = v_[41] * v_[65] + v_[13] * (v_[10] * v_[56] + v_[58]);
+    v_[67] = v_[32] * v_[33];
+    v_[68] = v_[4] * v_[34];
+    v_[69] = v_[32] * v_[5];
+    v_[70] = v_[9] * v_[69];
+    v_[69] = v_[34] * v_[69];
+    v_[71] = v_[4] * v_[9];
+    v_[72] = 0.42 * v_[32];
+    v_[73] = v_[33] * v_[52];
+    v_[74] = v_[34] * v_[49];
+    v_[75] = v_[5] * v_[57];
+    v_[76] = v_[9] * v_[75];
+    v_[64] = v_[34] * v_[64] - v_[76];
+    v_[57] = v_[33] * v_[57];
+    v_[77] = v_[10] * v_[57];
+    v_[78] = v_[34] * v_[75];
+    v_[79] = v_[9] * v_[54];
+    v_[80] = v_[79] - v_[78];
+    v_[54] = v_[34] * v_[54];
+    v_[76] = v_[76] + v_[54];
+    v_[81] = v_[38] * v_[57];
+    v_[82] = 0.4 * v_[5];
+    v_[83] = 0.4 * v_[33];
+    v_[84] = 0.241 * v_[33];
+    v_[85] = v_[9] * v_[84];
+    v_[86] = v_[38] * v_[85];
+    v_[87] = 0.241 * v_[5];
+    v_[88] = v_[34] * v_[84];
+    v_[89] = v_[10] * v_[85];
+    v_[90] = v_[38] * v_[87];
+    v_[91] = v_[5] * v_[52];
+    v_[92] = v_[38] * v_[76] - v_[77];
+    v_[78] = v_[78] - v_[79];
+    v_[79] = -0.241 * v_[32];
+    v_[93] = v_[9] * v_[60];
+    v_[60] = v_[5] * v_[48] + (v_[10] * v_[51] + (v_[38] * (v_[9] * v_[50]) + (v_[14] * (v_[38] * v_[93] + v_[10] * v_[55]) + v_[45] * (v_[41] * (v_[34] * v_[60]) + v_[13] * (v_[38] * v_[55] - v_[10] * v_[93])))));
+    v_[55] = v_[34] * v_[55];
+    v_[51] = v_[38] * (v_[34] * v_[51] + v_[9] * v_[52]) + (v_[14] * (v_[38] * (v_[63] + v_[55])) + v_[45] * (v_[41] * v_[59] + v_[13] * (v_[10] * v_[65])));
+    v_[52] = v_[10] * v_[59] - v_[58];
+    v_[58] = v_[10] * v_[53] + (v_[14] * v_[52] + v_[45] * (v_[13] * v_[62]) - v_[38] * v_[50]);
+    v_[52] = v_[45] * (v_[13] * (v_[9] * v_[79] - v_[55]) + v_[41] * v_[52]);
+    v_[55] = v_[14] * v_[66] + v_[45] * (v_[38] * v_[56] - v_[61]);
+    v_[56] = v_[9] * v_[57];
+    v_[56] = v_[5] * v_[72] + (v_[10] * v_[91] + (v_[38] * (v_[9] * v_[73]) + (v_[14] * (v_[38] * v_[56] + v_[10] * v_[75]) + v_[45] * (v_[41] * (v_[34] * v_[57]) + v_[13] * (v_[38] * v_[75] - v_[10] * v_[56])))));
+    v_[49] = v_[38] * (v_[34] * v_[91] - v_[9] * v_[49]) + (v_[14] * (v_[38] * v_[78]) + v_[45] * (v_[41] * v_[64] + v_[13] * (v_[10] * v_[80])));
+    v_[57] = v_[10] * v_[64] - v_[81];
+    v_[59] = v_[10] * (v_[9] * (v_[5] * (-0.4 * v_[32])) - v_[74]) + (v_[14] * v_[57] + v_[45] * (v_[13] * (v_[38] * v_[64] + v_[77])) - v_[38] * v_[73]);
+    v_[57] = v_[45] * (v_[13] * v_[80] + v_[41] * v_[57]);
+    v_[61] = v_[14] * (v_[41] * v_[80] + v_[13] * (v_[10] * v_[76] + v_[81])) + v_[45] * v_[92];
+    v_[63] = v_[9] * v_[87];
+    v_[63] = v_[38] * (v_[9] * v_[82]) + (v_[14] * (v_[38] * v_[63] - v_[10] * v_[84]) + v_[45] * (v_[41] * (v_[34] * v_[87]) + v_[13] * (v_[38] * (-0.241 * v_[33]) - v_[10] * v_[63]))) - v_[10] * v_[83] - 0.42 * v_[33];
+    v_[34] = v_[45] * (v_[41] * v_[85] + v_[13] * (v_[10] * v_[88])) - v_[14] * (v_[38] * v_[88]) - v_[38] * (v_[34] * v_[83]);
+    v_[64] = v_[89] - v_[90];
+    v_[65] = v_[10] * (v_[9] * v_[83]) + (v_[14] * v_[64] + v_[45] * (v_[13] * (v_[86] + v_[10] * v_[87])) - v_[38] * v_[82]);
+    v_[64] = v_[45] * (v_[13] * v_[88] + v_[41] * v_[64]);
+    v_[75] = v_[14] * (v_[41] * v_[88] + v_[13] * (v_[90] - v_[89])) + v_[45] * (v_[10] * (-0.241 * v_[5]) - v_[86]);
+    v_[32] = v_[17] * v_[32];
+    v_[4] = v_[17] * v_[4];
+    v_[76] = v_[20] * v_[42] - v_[32];
+    v_[77] = v_[4] + v_[20] * v_[67];
+    v_[80] = v_[76] + v_[24] * (v_[44] + v_[46]);
+    v_[82] = v_[77] + v_[24] * (v_[69] - v_[71]);
+    v_[83] = v_[80] + v_[26] * (v_[10] * v_[42] + v_[38] * v_[43]);
+    v_[84] = v_[82] + v_[26] * (v_[10] * v_[67] + v_[38] * (-v_[70] - v_[68]));
+    v_[5] = v_[16] * (v_[38] * (v_[74] + v_[9] * v_[91]) + (v_[14] * v_[92] + v_[45] * (v_[41] * v_[78] + v_[13] * (v_[10] * (v_[9] * (v_[5] * v_[79]) - v_[54]) - v_[81]))) - v_[10] * v_[73] - v_[33] * v_[72]) + v_[17] * v_[60] + v_[20] * v_[51] + v_[24] * v_[58] + v_[26] * v_[52] + v_[27] * v_[55];
+    v_[9] = v_[16] * (v_[33] * v_[48] + (v_[10] * v_[50] + (v_[38] * v_[53] + (v_[14] * v_[62] + v_[45] * v_[66])))) + v_[17] * v_[56] + v_[20] * v_[49] + v_[24] * v_[59] + v_[26] * v_[57] + v_[27] * v_[61];
+    v_[14] = 1e-10 + (v_[17] * v_[63] + v_[20] * v_[34] + v_[24] * v_[65] + v_[26] * v_[64] + v_[27] * v_[75]);
+    v_[33] = sqrt(v_[14] * v_[14] + v_[9] * v_[9] + v_[5] * v_[5]);
+    v_[31] = sqrt(v_[31] * v_[31]);
+    v_[45] = v_[28] * v_[14];
+    v_[4] = 10. * (v_[17] * (-(v_[56] * v_[32]) - v_[60] * v_[4]) + v_[20] * (v_[49] * (v_[76] - v_[32]) - v_[51] * (v_[4] + v_[77])) + v_[24] * (v_[59] * (v_[76] + v_[80]) - v_[58] * (v_[77] + v_[82])) + v_[26] * (v_[57] * (v_[80] + v_[83]) - v_[52] * (v_[82] + v_[84])) + v_[27] * (v_[61] * (v_[83] + (v_[83] + v_[27] * (v_[41] * (v_[10] * v_[43] - v_[38] * v_[42]) + v_[13] * (-v_[46] - v_[44])))) - v_[55] * (v_[84] + (v_[84] + v_[27] * (v_[13] * (v_[71] - v_[69]) + v_[41] * (v_[10] * (-v_[68] - v_[70]) - v_[38] * v_[67]))))) + (v_[35] * v_[75] + (v_[39] * v_[64] + v_[40] * v_[65]) + (v_[37] * v_[34] + v_[15] * v_[63]))) + 601. * v_[14] + (v_[25] * (v_[14] * v_[31]) / v_[23] + v_[14] / v_[33] * v_[45]);
+    v_[10] = x_in[0] + v_[1] * v_[16];
+    v_[13] = x_in[1] + v_[1] * v_[17];
+    v_[14] = x_in[2] + v_[1] * v_[20];
+    v_[32] = x_in[3] + v_[1] * v_[24];
+    v_[34] = x_in[4] + v_[1] * v_[26];
+    v_[38] = x_in[5] + v_[1] * v_[27];
+    v_[41] = x_in[6] + v_[1] * v_[30];
+    v_[42] = x_in[7] + v_[1] * v_[47];
+    v_[43] = x_in[8] + v_[1] * v_[15];
+    v_[44] = x_in[9] + v_[1] * v_[37];
+    v_[46] = x_in[10] + v_[1] * v_[40];
+    v_[48] = x_in[11] + v_[1] * v_[39];
+    v_[49] = x_in[12] + v_[1] * v_[35];
+    v_[50] = x_in[13] + v_[1] * v_[36];
+    v_[1] = x_in[16] + v_[1] * v_[4];
+    v_[51] = sin(v_[10]);
+    v_[10] = cos(v_[10]);
+    v_[52] = sin(v_[13]);
+    v_[13] = cos(v_[13]);
+    v_[53] = sin(v_[14]);
+    v_[14] = cos(v_[14]);
+    v_[54] = 0.2045 * v_[53];
+    v_[55] = 0.2045 * v_[14];
+    v_[56] = -0.2045 * v_[53];
+    v_[57] = sin(v_[32]);
+    v_[32] = cos(v_[32]);
+    v_[58] = 0.2155 * v_[32];
+    v_[59] = -0.2155 * v_[57];
+    v_[60] = sin(v_[34]);
+    v_[34] = cos(v_[34]);
+    v_[61] = 0.1845 * v_[60];
+    v_[62] = 0.1845 * v_[34];
+    v_[63] = -0.1845 * v_[60];
+    v_[64] = sin(v_[38]);
+    v_[38] = cos(v_[38]);
+    v_[65] = 0.2155 * v_[38];
+    v_[66] = -0.2155 * v_[64];
+    v_[67] = sin(v_[41]);
+    v_[41] = cos(v_[41]);
+    v_[68] = 0.081 * v_[67];
+    v_[69] = 0.081 * v_[41];
+    v_[70] = -0.081 * v_[67];
+    v_[71] = v_[42] * v_[52];
+    v_[72] = v_[42] * v_[13];
+    v_[73] = v_[43] * v_[72];
+    v_[74] = v_[43] * v_[71];
+    v_[75] = 0.071 * v_[71];
+    v_[76] = 0.025 * v_[72];
+    v_[77] = 0.0579 * v_[43];
+    v_[78] = v_[43] * v_[53] - v_[14] * v_[71];
+    v_[79] = v_[43] * v_[14] + v_[53] * v_[71];
+    v_[80] = v_[43] * v_[55] + v_[54] * v_[71];
+    v_[81] = v_[43] * v_[56] + v_[55] * v_[71];
+    v_[82] = v_[44] + v_[72];
+    v_[83] = v_[44] * v_[79];
+    v_[84] = v_[44] * v_[78];
+    v_[85] = v_[44] * v_[81];
+    v_[86] = v_[44] * v_[80];
+    v_[87] = -0.39 * v_[81] + 0.1334 * v_[78];
+    v_[88] = 0.39 * v_[80] + (-0.0117 * v_[82] + 0.1257 * v_[79]);
+    v_[89] = -0.09 * v_[80] + (0.0127 * v_[82] + -0.0117 * v_[79]);
+    v_[90] = 3. * v_[80] + (-0.09 * v_[82] + 0.39 * v_[79]);
+    v_[91] = 3. * v_[81] + -0.39 * v_[78];
+    v_[92] = 0.09 * v_[78];
+    v_[93] = v_[57] * v_[82] + v_[32] * v_[78];
+    v_[94] = v_[32] * v_[82] - v_[57] * v_[78];
+    v_[95] = v_[32] * v_[80] + v_[58] * v_[79];
+    v_[96] = v_[59] * v_[79] - v_[57] * v_[80];
+    v_[97] = 0.2155 * v_[78] - v_[81];
+    v_[98] = v_[46] - v_[79];
+    v_[99] = v_[46] * v_[94];
+    v_[100] = v_[46] * v_[93];
+    v_[101] = v_[46] * v_[96];
+    v_[102] = v_[46] * v_[95];
+    v_[103] = 0.1809 * v_[97] + -0.0918 * v_[96] + 0.0452 * v_[93];
+    v_[104] = 0.0918 * v_[95] + (-0.0061 * v_[98] + 0.0131 * v_[94]);
+    v_[105] = -0.1809 * v_[95] + (0.0411 * v_[98] + -0.0061 * v_[94]);
+    v_[106] = 2.7 * v_[95] + (-0.1809 * v_[98] + 0.0918 * v_[94]);
+    v_[107] = 2.7 * v_[96] + -0.0918 * v_[93];
+    v_[108] = 2.7 * v_[97] + 0.1809 * v_[93];
+    v_[109] = v_[60] * v_[98] - v_[34] * v_[93];
+    v_[110] = v_[34] * v_[98] + v_[60] * v_[93];
+    v_[111] = v_[60] * v_[97] - v_[34] * v_[95] + (v_[62] * v_[98] + v_[61] * v_[93]);
+    v_[112] = v_[34] * v_[97] + v_[60] * v_[95] + (v_[63] * v_[98] + v_[62] * v_[93]);
+    v_[113] = v_[48] + v_[94];
+    v_[114] = v_[48] * v_[110];
+    v_[115] = v_[48] * v_[109];
+    v_[116] = v_[48] * v_[112];
+    v_[117] = v_[48] * v_[111];
+    v_[118] = 0.0357 * v_[96] + -0.1292 * v_[112] + 0.0306 * v_[109];
+    v_[119] = -0.00017 * v_[96] + 0.1292 * v_[111] + (-0.0027 * v_[113] + 0.0279 * v_[110]);
+    v_[120] = 0.00017 * v_[112] + -0.0357 * v_[111] + (0.0058 * v_[113] + -0.0027 * v_[110]);
+    v_[121] = 1.7 * v_[111] + (-0.0357 * v_[113] + 0.1292 * v_[110]);
+    v_[122] = 1.7 * v_[112] + (0.00017 * v_[113] + -0.1292 * v_[109]);
+    v_[123] = 1.7 * v_[96] + (-0.00017 * v_[110] + 0.0357 * v_[109]);
+    v_[124] = v_[64] * v_[113] + v_[38] * v_[109];
+    v_[125] = v_[38] * v_[113] - v_[64] * v_[109];
+    v_[126] = v_[64] * v_[96] + v_[38] * v_[111] + v_[65] * v_[110];
+    v_[127] = v_[38] * v_[96] - v_[64] * v_[111] + v_[66] * v_[110];
+    v_[128] = 0.2155 * v_[109] - v_[112];
+    v_[129] = v_[49] - v_[110];
+    v_[130] = v_[49] * v_[125];
+    v_[131] = v_[49] * v_[124];
+    v_[132] = v_[49] * v_[127];
+    v_[133] = v_[49] * v_[126];
+    v_[134] = 0.00108 * v_[128] + -0.00072 * v_[127] + 0.0005 * v_[124];
+    v_[135] = 0.00072 * v_[126] + 0.0036 * v_[125];
+    v_[136] = -0.00108 * v_[126] + 0.0047 * v_[129];
+    v_[137] = 1.8 * v_[126] + (-0.00108 * v_[129] + 0.00072 * v_[125]);
+    v_[138] = 1.8 * v_[127] + -0.00072 * v_[124];
+    v_[139] = 1.8 * v_[128] + 0.00108 * v_[124];
+    v_[140] = v_[67] * v_[129] - v_[41] * v_[124];
+    v_[141] = v_[41] * v_[129] + v_[67] * v_[124];
+    v_[142] = v_[67] * v_[128] - v_[41] * v_[126] + (v_[69] * v_[129] + v_[68] * v_[124]);
+    v_[143] = v_[41] * v_[128] + v_[67] * v_[126] + (v_[70] * v_[129] + v_[69] * v_[124]);
+    v_[144] = v_[50] + v_[125];
+    v_[145] = v_[50] * v_[141];
+    v_[146] = v_[50] * v_[140];
+    v_[147] = v_[50] * v_[143];
+    v_[148] = v_[50] * v_[142];
+    v_[149] = -0.006 * v_[143] + 0.001 * v_[140];
+    v_[150] = 0.006 * v_[142] + 0.001 * v_[141];
+    v_[151] = 0.001 * v_[144];
+    v_[152] = 0.3 * v_[142] + 0.006 * v_[141];
+    v_[153] = 0.3 * v_[143] + -0.006 * v_[140];
+    v_[154] = 0.3 * v_[127];
+    v_[155] = v_[142] * v_[153] - v_[143] * v_[152] + (v_[140] * v_[150] - v_[141] * v_[149]);
+    v_[156] = x_in[23] + -0.2 * v_[50] - v_[155];
+    v_[143] = v_[143] * v_[154] - v_[127] * v_[153] + (v_[141] * v_[151] - v_[144] * v_[150]) + (0.001 * v_[145] - -0.006 * v_[148]);
+    v_[142] = v_[127] * v_[152] - v_[142] * v_[154] + (v_[144] * v_[149] - v_[140] * v_[151]) + (0.006 * v_[147] - 0.001 * v_[146]);
+    v_[146] = v_[141] * v_[154] - v_[144] * v_[153] + (0.3 * v_[147] - 0.006 * v_[146]);
+    v_[144] = v_[144] * v_[152] - v_[140] * v_[154] + (-0.006 * v_[145] - 0.3 * v_[148]);
+    v_[145] = 0.001 * v_[41];
+    v_[147] = -0.006 * v_[69] - v_[145];
+    v_[148] = 0.001 * v_[67];
+    v_[149] = -0.006 * v_[70] + v_[148];
+    v_[150] = -0.006 * v_[67];
+    v_[151] = -0.006 * v_[41];
+    v_[148] = v_[148] + 0.006 * v_[68];
+    v_[145] = v_[145] + 0.006 * v_[69];
+    v_[154] = 0.006 * v_[41];
+    v_[157] = 0.006 * v_[67];
+    v_[158] = v_[157] + 0.3 * v_[68];
+    v_[159] = 0.3 * v_[69];
+    v_[160] = v_[154] + v_[159];
+    v_[161] = 0.3 * v_[41];
+    v_[162] = 0.3 * v_[67];
+    v_[159] = v_[159] - v_[151];
+    v_[163] = v_[150] + 0.3 * v_[70];
+    v_[164] = v_[69] * v_[162];
+    v_[165] = v_[69] * v_[161];
+    v_[166] = v_[70] * v_[159] + v_[69] * v_[158] + (v_[41] * v_[148] + v_[67] * v_[147]);
+    v_[167] = v_[164] + v_[70] * v_[161] + (v_[41] * v_[157] + v_[67] * v_[151]);
+    v_[168] = v_[67] * v_[161];
+    v_[169] = v_[41] * v_[162];
+    v_[170] = 0.0047 + (v_[70] * v_[163] + v_[69] * v_[160] + (v_[41] * v_[145] + v_[67] * v_[149]));
+    v_[171] = -0.00108 + (v_[70] * v_[162] - v_[165] + (v_[67] * v_[150] - v_[41] * v_[154]));
+    v_[172] = 1.8 + (v_[67] * v_[162] + v_[41] * v_[161]);
+    v_[70] = v_[126] * v_[138] - v_[127] * v_[137] + (v_[124] * v_[135] - v_[125] * v_[134]) + (v_[70] * v_[144] + v_[69] * v_[146] + (v_[41] * v_[142] + v_[67] * v_[143]));
+    v_[173] = x_in[22] + -0.5 * v_[49] - v_[70];
+    v_[174] = v_[166] / v_[170];
+    v_[175] = v_[170] / v_[170];
+    v_[176] = v_[171] / v_[170];
+    v_[177] = v_[167] / v_[170];
+    v_[147] = 0.0005 + (v_[69] * v_[159] + v_[68] * v_[158] + (v_[67] * v_[148] - v_[41] * v_[147])) - v_[166] * v_[174];
+    v_[145] = v_[69] * v_[163] + v_[68] * v_[160] + (v_[67] * v_[145] - v_[41] * v_[149]) - v_[170] * v_[174];
+    v_[148] = v_[164] - v_[68] * v_[161] + (-(v_[41] * v_[150]) - v_[67] * v_[154]) - v_[171] * v_[174];
+    v_[149] = 0.00108 + (v_[165] + v_[68] * v_[162] + (v_[67] * v_[157] - v_[41] * v_[151])) - v_[167] * v_[174];
+    v_[150] = v_[166] - v_[166] * v_[175];
+    v_[151] = v_[171] - v_[171] * v_[175];
+    v_[154] = v_[167] - v_[167] * v_[175];
+    v_[157] = v_[67] * v_[159] - v_[41] * v_[158] - v_[166] * v_[176];
+    v_[161] = -0.00108 + (v_[67] * v_[163] - v_[41] * v_[160]) - v_[170] * v_[176];
+    v_[162] = v_[172] - v_[171] * v_[176];
+    v_[164] = v_[168] - v_[169] - v_[167] * v_[176];
+    v_[158] = 0.00108 + (v_[41] * v_[159] + v_[67] * v_[158]) - v_[166] * v_[177];
+    v_[159] = v_[169] - v_[168] - v_[171] * v_[177];
+    v_[165] = v_[172] - v_[167] * v_[177];
+    v_[68] = v_[166] * v_[173] / v_[170] + (v_[127] * v_[139] - v_[128] * v_[138] + (v_[125] * v_[136] - v_[129] * v_[135]) + (v_[69] * v_[144] + v_[68] * v_[146] + (v_[67] * v_[142] - v_[41] * v_[143])) + (v_[132] * v_[157] - -0.00072 * v_[133] + v_[130] * v_[147]));
+    v_[69] = v_[128] * v_[137] - v_[126] * v_[139] + (v_[129] * v_[134] - v_[124] * v_[136]) + (v_[155] + 0.001 * v_[156] / 0.001) + (0.00072 * v_[132] - 0.0036 * v_[131]);
+    v_[126] = v_[171] * v_[173] / v_[170] + (v_[125] * v_[139] - v_[129] * v_[138] + (v_[67] * v_[144] - v_[41] * v_[146]) + (v_[132] * v_[162] + (v_[130] * v_[148] - 0.00072 * v_[131])));
+    v_[127] = v_[129] * v_[137] - v_[124] * v_[139] + (v_[140] * v_[153] - v_[141] * v_[152]) + (-0.00072 * v_[130] - 2.1 * v_[133]);
+    v_[124] = v_[167] * v_[173] / v_[170] + (v_[124] * v_[138] - v_[125] * v_[137] + (v_[41] * v_[144] + v_[67] * v_[146]) + (v_[132] * v_[164] + v_[130] * v_[149]));
+    v_[125] = 0.2155 * v_[149] + v_[38] * v_[147];
+    v_[128] = -0.00072 * v_[66] + v_[65] * v_[148] - v_[145];
+    v_[129] = v_[64] * v_[147];
+    v_[133] = -0.00072 * v_[64];
+    v_[134] = v_[38] * v_[148] - v_[133];
+    v_[135] = -0.00072 * v_[38];
+    v_[136] = v_[135] + v_[64] * v_[148];
+    v_[137] = 0.0036 * v_[64];
+    v_[138] = 0.00072 * v_[65];
+    v_[139] = 0.0036 * v_[38];
+    v_[140] = 0.00072 * v_[38];
+    v_[141] = 0.00072 * v_[64];
+    v_[142] = 0.2155 * v_[164] + (v_[38] * v_[157] - v_[141]);
+    v_[143] = v_[65] * v_[162] - v_[161];
+    v_[144] = v_[140] + v_[64] * v_[157];
+    v_[146] = v_[38] * v_[162];
+    v_[147] = v_[64] * v_[162];
+    v_[148] = 2.1 * v_[66];
+    v_[152] = 2.1 * v_[64];
+    v_[153] = 2.1 * v_[38];
+    v_[155] = 0.2155 * v_[165];
+    v_[157] = v_[155] + v_[38] * v_[158];
+    v_[41] = v_[65] * v_[159] - (v_[41] * v_[163] + v_[67] * v_[160] - v_[170] * v_[177]);
+    v_[67] = v_[64] * v_[158];
+    v_[158] = v_[38] * v_[159];
+    v_[159] = v_[64] * v_[159];
+    v_[160] = v_[64] * v_[125] - v_[38] * v_[137];
+    v_[162] = v_[38] * v_[141] + v_[64] * v_[136];
+    v_[163] = -0.0027 + (v_[38] * v_[138] + v_[64] * v_[128]);
+    v_[168] = 0.0058 + (v_[38] * v_[139] + v_[64] * v_[129]);
+    v_[169] = -0.0357 + (v_[38] * v_[140] + v_[64] * v_[134]);
+    v_[172] = 0.00017 - v_[64] * v_[149];
+    v_[174] = v_[111] * v_[122] - v_[112] * v_[121] + (v_[109] * v_[119] - v_[110] * v_[118]) + (v_[38] * v_[69] + v_[64] * v_[68]);
+    v_[176] = x_in[21] - v_[48] - v_[174];
+    v_[177] = v_[160] / v_[168];
+    v_[178] = v_[163] / v_[168];
+    v_[179] = v_[168] / v_[168];
+    v_[180] = v_[169] / v_[168];
+    v_[181] = v_[172] / v_[168];
+    v_[182] = v_[162] / v_[168];
+    v_[125] = 0.0306 + (0.2155 * v_[157] + (v_[64] * v_[137] + v_[38] * v_[125])) - v_[160] * v_[177];
+    v_[128] = 0.2155 * v_[41] + (v_[38] * v_[128] - v_[64] * v_[138]) - v_[163] * v_[177];
+    v_[129] = 0.2155 * v_[67] + (v_[38] * v_[129] - v_[64] * v_[139]) - v_[168] * v_[177];
+    v_[134] = 0.2155 * v_[158] + (v_[38] * v_[134] - v_[64] * v_[140]) - v_[169] * v_[177];
+    v_[137] = -0.1292 + (-(v_[38] * v_[149]) - v_[155]) - v_[172] * v_[177];
+    v_[136] = 0.0357 + (0.2155 * v_[159] + (v_[38] * v_[136] - v_[64] * v_[141])) - v_[162] * v_[177];
+    v_[138] = v_[66] * v_[135] + v_[65] * v_[142] - (0.2155 * v_[154] + v_[38] * v_[150]) - v_[160] * v_[178];
+    v_[139] = 0.0279 + (v_[66] * v_[148] + v_[65] * v_[143] - (v_[65] * v_[151] - (v_[170] - v_[170] * v_[175]))) - v_[163] * v_[178];
+    v_[140] = -0.0027 + (v_[66] * v_[133] + v_[65] * v_[144] - v_[64] * v_[150]) - v_[168] * v_[178];
+    v_[141] = 0.1292 + (v_[65] * v_[146] - v_[66] * v_[152] - v_[38] * v_[151]) - v_[169] * v_[178];
+    v_[149] = v_[154] - v_[65] * v_[164] - v_[172] * v_[178];
+    v_[150] = -0.00017 + (v_[66] * v_[153] + v_[65] * v_[147] - v_[64] * v_[151]) - v_[162] * v_[178];
+    v_[151] = v_[160] - v_[160] * v_[179];
+    v_[154] = v_[163] - v_[163] * v_[179];
+    v_[155] = v_[169] - v_[169] * v_[179];
+    v_[175] = v_[172] - v_[172] * v_[179];
+    v_[177] = v_[38] * v_[142] - v_[64] * v_[135] - v_[160] * v_[180];
+    v_[178] = 0.1292 + (v_[38] * v_[143] - v_[64] * v_[148]) - v_[163] * v_[180];
+    v_[183] = -0.0357 + (v_[38] * v_[144] - v_[64] * v_[133]) - v_[168] * v_[180];
+    v_[184] = 1.7 + (v_[64] * v_[152] + v_[38] * v_[146]) - v_[169] * v_[180];
+    v_[185] = -(v_[38] * v_[164]) - v_[172] * v_[180];
+    v_[180] = v_[38] * v_[147] - v_[64] * v_[153] - v_[162] * v_[180];
+    v_[157] = -0.1292 - v_[157] - v_[160] * v_[181];
+    v_[41] = -v_[41] - v_[163] * v_[181];
+    v_[67] = 0.00017 - v_[67] - v_[168] * v_[181];
+    v_[158] = -v_[158] - v_[169] * v_[181];
+    v_[165] = 1.7 + v_[165] - v_[172] * v_[181];
+    v_[159] = -v_[159] - v_[162] * v_[181];
+    v_[135] = 0.0357 + (v_[38] * v_[135] + v_[64] * v_[142]) - v_[160] * v_[182];
+    v_[142] = -0.00017 + (v_[38] * v_[148] + v_[64] * v_[143]) - v_[163] * v_[182];
+    v_[143] = v_[64] * v_[146] - v_[38] * v_[152] - v_[169] * v_[182];
+    v_[146] = -(v_[64] * v_[164]) - v_[172] * v_[182];
+    v_[68] = v_[160] * v_[176] / v_[168] + (v_[112] * v_[123] - v_[96] * v_[122] + (v_[110] * v_[120] - v_[113] * v_[119]) + (0.2155 * v_[124] + (v_[38] * v_[68] - v_[64] * v_[69])) + (v_[116] * v_[177] - v_[117] * v_[157] + (v_[114] * v_[125] - v_[115] * v_[138])));
+    v_[66] = v_[163] * v_[176] / v_[168] + (v_[96] * v_[121] - v_[111] * v_[123] + (v_[113] * v_[118] - v_[109] * v_[120]) + (v_[66] * v_[127] + v_[65] * v_[126] - (v_[170] * v_[173] / v_[170] + (v_[70] + (v_[132] * v_[161] + v_[130] * v_[145])))) + (v_[116] * v_[178] - v_[117] * v_[41] + (v_[114] * v_[128] - v_[115] * v_[139])));
+    v_[69] = v_[169] * v_[176] / v_[168] + (v_[110] * v_[123] - v_[113] * v_[122] + (v_[38] * v_[126] - v_[64] * v_[127]) + (v_[116] * v_[184] - v_[117] * v_[158] + (v_[114] * v_[134] - v_[115] * v_[141])));
+    v_[70] = v_[172] * v_[176] / v_[168] + (v_[113] * v_[121] - v_[109] * v_[123] - v_[124] + (v_[116] * v_[185] - v_[117] * v_[165] + (v_[114] * v_[137] - v_[115] * v_[149])));
+    v_[111] = v_[62] * v_[137] + v_[61] * v_[134] + (v_[60] * v_[128] - v_[34] * v_[125]);
+    v_[112] = v_[63] * v_[137] + v_[62] * v_[134] + (v_[34] * v_[128] + v_[60] * v_[125]);
+    v_[113] = v_[60] * v_[137] - v_[34] * v_[134];
+    v_[118] = v_[34] * v_[137] + v_[60] * v_[134];
+    v_[119] = v_[62] * v_[149] + v_[61] * v_[141] + (v_[60] * v_[139] - v_[34] * v_[138]);
+    v_[120] = v_[63] * v_[149] + v_[62] * v_[141] + (v_[34] * v_[139] + v_[60] * v_[138]);
+    v_[123] = v_[60] * v_[149] - v_[34] * v_[141];
+    v_[124] = v_[34] * v_[149] + v_[60] * v_[141];
+    v_[125] = v_[62] * v_[185] + v_[61] * v_[184] + (v_[60] * v_[178] - v_[34] * v_[177]);
+    v_[128] = v_[63] * v_[185] + v_[62] * v_[184] + (v_[34] * v_[178] + v_[60] * v_[177]);
+    v_[134] = v_[60] * v_[185] - v_[34] * v_[184];
+    v_[137] = v_[34] * v_[185] + v_[60] * v_[184];
+    v_[138] = v_[62] * v_[165] + v_[61] * v_[158] + (v_[60] * v_[41] - v_[34] * v_[157]);
+    v_[41] = v_[63] * v_[165] + v_[62] * v_[158] + (v_[34] * v_[41] + v_[60] * v_[157]);
+    v_[139] = v_[60] * v_[165] - v_[34] * v_[158];
+    v_[141] = v_[34] * v_[165] + v_[60] * v_[158];
+    v_[145] = v_[63] * v_[138] + v_[62] * v_[125] + (v_[34] * v_[119] + v_[60] * v_[111]);
+    v_[148] = v_[63] * v_[159] + v_[62] * v_[180] + (v_[34] * v_[150] + v_[60] * v_[136]);
+    v_[149] = v_[63] * v_[141] + v_[62] * v_[137] + (v_[34] * v_[124] + v_[60] * v_[118]);
+    v_[152] = -0.0061 + (v_[63] * v_[67] + v_[62] * v_[183] + (v_[34] * v_[140] + v_[60] * v_[129]));
+    v_[157] = 0.0411 + (v_[63] * v_[41] + v_[62] * v_[128] + (v_[34] * v_[120] + v_[60] * v_[112]));
+    v_[158] = -0.1809 + (v_[63] * v_[139] + v_[62] * v_[134] + (v_[34] * v_[123] + v_[60] * v_[113]));
+    v_[161] = v_[95] * v_[107] - v_[96] * v_[106] + (v_[93] * v_[104] - v_[94] * v_[103]) + (v_[63] * v_[70] + v_[62] * v_[69] + (v_[34] * v_[66] + v_[60] * v_[68]));
+    v_[164] = x_in[20] + -0.3 * v_[46] - v_[161];
+    v_[165] = v_[145] / v_[157];
+    v_[177] = v_[152] / v_[157];
+    v_[178] = v_[157] / v_[157];
+    v_[181] = v_[158] / v_[157];
+    v_[184] = v_[148] / v_[157];
+    v_[185] = v_[149] / v_[157];
+    v_[111] = 0.0452 + (v_[62] * v_[138] + v_[61] * v_[125] + (v_[60] * v_[119] - v_[34] * v_[111])) - v_[145] * v_[165];
+    v_[119] = v_[62] * v_[67] + v_[61] * v_[183] + (v_[60] * v_[140] - v_[34] * v_[129]) - v_[152] * v_[165];
+    v_[112] = v_[62] * v_[41] + v_[61] * v_[128] + (v_[60] * v_[120] - v_[34] * v_[112]) - v_[157] * v_[165];
+    v_[113] = v_[62] * v_[139] + v_[61] * v_[134] + (v_[60] * v_[123] - v_[34] * v_[113]) - v_[158] * v_[165];
+    v_[120] = -0.0918 + (v_[62] * v_[159] + v_[61] * v_[180] + (v_[60] * v_[150] - v_[34] * v_[136])) - v_[148] * v_[165];
+    v_[118] = 0.1809 + (v_[62] * v_[141] + v_[61] * v_[137] + (v_[60] * v_[124] - v_[34] * v_[118])) - v_[149] * v_[165];
+    v_[123] = v_[62] * v_[175] + v_[61] * v_[155] + (v_[60] * v_[154] - v_[34] * v_[151]) - v_[145] * v_[177];
+    v_[124] = 0.0131 + (v_[168] - v_[168] * v_[179]) - v_[152] * v_[177];
+    v_[151] = -0.0061 + (v_[63] * v_[175] + v_[62] * v_[155] + (v_[34] * v_[154] + v_[60] * v_[151])) - v_[157] * v_[177];
+    v_[154] = 0.0918 + (v_[60] * v_[175] - v_[34] * v_[155]) - v_[158] * v_[177];
+    v_[165] = v_[162] - v_[162] * v_[179] - v_[148] * v_[177];
+    v_[155] = v_[34] * v_[175] + v_[60] * v_[155] - v_[149] * v_[177];
+    v_[175] = v_[145] - v_[145] * v_[178];
+    v_[177] = v_[152] - v_[152] * v_[178];
+    v_[179] = v_[158] - v_[158] * v_[178];
+    v_[186] = v_[148] - v_[148] * v_[178];
+    v_[187] = v_[149] - v_[149] * v_[178];
+    v_[188] = v_[60] * v_[138] - v_[34] * v_[125] - v_[145] * v_[181];
+    v_[189] = 0.0918 + (v_[60] * v_[67] - v_[34] * v_[183]) - v_[152] * v_[181];
+    v_[190] = -0.1809 + (v_[60] * v_[41] - v_[34] * v_[128]) - v_[157] * v_[181];
+    v_[191] = 2.7 + (v_[60] * v_[139] - v_[34] * v_[134]) - v_[158] * v_[181];
+    v_[192] = v_[60] * v_[159] - v_[34] * v_[180] - v_[148] * v_[181];
+    v_[181] = v_[60] * v_[141] - v_[34] * v_[137] - v_[149] * v_[181];
+    v_[193] = -0.0918 + (v_[62] * v_[146] + v_[61] * v_[143] + (v_[60] * v_[142] - v_[34] * v_[135])) - v_[145] * v_[184];
+    v_[133] = v_[38] * v_[133] + v_[64] * v_[144] - v_[168] * v_[182] - v_[152] * v_[184];
+    v_[135] = v_[63] * v_[146] + v_[62] * v_[143] + (v_[34] * v_[142] + v_[60] * v_[135]) - v_[157] * v_[184];
+    v_[142] = v_[60] * v_[146] - v_[34] * v_[143] - v_[158] * v_[184];
+    v_[144] = 2.7 + (1.7 + (v_[38] * v_[153] + v_[64] * v_[147]) - v_[162] * v_[182]) - v_[148] * v_[184];
+    v_[143] = v_[34] * v_[146] + v_[60] * v_[143] - v_[149] * v_[184];
+    v_[125] = 0.1809 + (v_[34] * v_[138] + v_[60] * v_[125]) - v_[145] * v_[185];
+    v_[138] = v_[34] * v_[67] + v_[60] * v_[183] - v_[152] * v_[185];
+    v_[134] = v_[34] * v_[139] + v_[60] * v_[134] - v_[158] * v_[185];
+    v_[139] = v_[34] * v_[159] + v_[60] * v_[180] - v_[148] * v_[185];
+    v_[137] = 2.7 + (v_[34] * v_[141] + v_[60] * v_[137]) - v_[149] * v_[185];
+    v_[66] = v_[145] * v_[164] / v_[157] + (v_[96] * v_[108] - v_[97] * v_[107] + (v_[94] * v_[105] - v_[98] * v_[104]) + (v_[62] * v_[70] + v_[61] * v_[69] + (v_[60] * v_[66] - v_[34] * v_[68])) + (v_[101] * v_[188] - v_[102] * v_[193] + (v_[99] * v_[111] - v_[100] * v_[123])));
+    v_[67] = v_[152] * v_[164] / v_[157] + (v_[97] * v_[106] - v_[95] * v_[108] + (v_[98] * v_[103] - v_[93] * v_[105]) + (v_[168] * v_[176] / v_[168] + (v_[174] + (v_[116] * v_[183] - v_[117] * v_[67] + (v_[114] * v_[129] - v_[115] * v_[140])))) + (v_[101] * v_[189] - v_[102] * v_[133] + (v_[99] * v_[119] - v_[100] * v_[124])));
+    v_[68] = v_[158] * v_[164] / v_[157] + (v_[94] * v_[108] - v_[98] * v_[107] + (v_[60] * v_[70] - v_[34] * v_[69]) + (v_[101] * v_[191] - v_[102] * v_[142] + (v_[99] * v_[113] - v_[100] * v_[154])));
+    v_[95] = v_[148] * v_[164] / v_[157] + (v_[98] * v_[106] - v_[93] * v_[108] + (v_[162] * v_[176] / v_[168] + (v_[109] * v_[122] - v_[110] * v_[121] + (v_[38] * v_[127] + v_[64] * v_[126]) + (v_[116] * v_[180] - v_[117] * v_[159] + (v_[114] * v_[136] - v_[115] * v_[150])))) + (v_[101] * v_[192] - v_[102] * v_[144] + (v_[99] * v_[120] - v_[100] * v_[165])));
+    v_[69] = v_[149] * v_[164] / v_[157] + (v_[93] * v_[107] - v_[94] * v_[106] + (v_[34] * v_[70] + v_[60] * v_[69]) + (v_[101] * v_[181] - v_[102] * v_[143] + (v_[99] * v_[118] - v_[100] * v_[155])));
+    v_[70] = 0.2155 * v_[118] + (v_[32] * v_[111] - v_[57] * v_[119]);
+    v_[93] = v_[59] * v_[120] + v_[58] * v_[113] - v_[112];
+    v_[94] = v_[32] * v_[119] + v_[57] * v_[111];
+    v_[96] = v_[32] * v_[113] - v_[57] * v_[120];
+    v_[97] = 0.2155 * v_[155] + (v_[32] * v_[123] - v_[57] * v_[124]);
+    v_[98] = v_[59] * v_[165] + v_[58] * v_[154] - v_[151];
+    v_[103] = v_[32] * v_[124] + v_[57] * v_[123];
+    v_[104] = v_[32] * v_[154] - v_[57] * v_[165];
+    v_[105] = 0.2155 * v_[181] + (v_[32] * v_[188] - v_[57] * v_[189]);
+    v_[106] = v_[59] * v_[192] + v_[58] * v_[191] - v_[190];
+    v_[107] = v_[32] * v_[189] + v_[57] * v_[188];
+    v_[108] = v_[32] * v_[191] - v_[57] * v_[192];
+    v_[109] = 0.2155 * v_[143] + (v_[32] * v_[193] - v_[57] * v_[133]);
+    v_[110] = v_[59] * v_[144] + v_[58] * v_[142] - v_[135];
+    v_[111] = v_[32] * v_[133] + v_[57] * v_[193];
+    v_[113] = v_[32] * v_[142] - v_[57] * v_[144];
+    v_[119] = 0.2155 * v_[137];
+    v_[120] = v_[119] + (v_[32] * v_[125] - v_[57] * v_[138]);
+    v_[41] = v_[59] * v_[139] + v_[58] * v_[134] - (v_[34] * v_[41] + v_[60] * v_[128] - v_[157] * v_[185]);
+    v_[121] = v_[32] * v_[138] + v_[57] * v_[125];
+    v_[122] = v_[32] * v_[134] - v_[57] * v_[139];
+    v_[123] = v_[32] * v_[97] + v_[57] * v_[70];
+    v_[124] = -(v_[57] * v_[118]) - v_[32] * v_[155];
+    v_[125] = -0.0117 + (v_[32] * v_[98] + v_[57] * v_[93]);
+    v_[126] = 0.0127 + (v_[32] * v_[103] + v_[57] * v_[94]);
+    v_[127] = -0.09 + (v_[32] * v_[104] + v_[57] * v_[96]);
+    v_[128] = v_[80] * v_[91] - v_[81] * v_[90] + (v_[78] * v_[88] - v_[79] * v_[87]) + (v_[32] * v_[67] + v_[57] * v_[66]);
+    v_[129] = x_in[19] + -0.5 * v_[44] - v_[128];
+    v_[133] = v_[123] / v_[126];
+    v_[134] = v_[125] / v_[126];
+    v_[136] = v_[126] / v_[126];
+    v_[138] = v_[127] / v_[126];
+    v_[139] = v_[124] / v_[126];
+    v_[70] = 0.1334 + (0.2155 * v_[120] + (v_[32] * v_[70] - v_[57] * v_[97])) - v_[123] * v_[133];
+    v_[93] = 0.2155 * v_[41] + (v_[32] * v_[93] - v_[57] * v_[98]) - v_[125] * v_[133];
+    v_[94] = 0.2155 * v_[121] + (v_[32] * v_[94] - v_[57] * v_[103]) - v_[126] * v_[133];
+    v_[96] = 0.2155 * v_[122] + (v_[32] * v_[96] - v_[57] * v_[104]) - v_[127] * v_[133];
+    v_[97] = -0.39 + (v_[57] * v_[155] - v_[32] * v_[118] - v_[119]) - v_[124] * v_[133];
+    v_[98] = v_[59] * v_[109] + v_[58] * v_[105] - (0.2155 * v_[187] + (v_[32] * v_[175] - v_[57] * v_[177])) - v_[123] * v_[134];
+    v_[103] = 0.1257 + (v_[59] * v_[110] + v_[58] * v_[106] - (v_[59] * v_[186] + v_[58] * v_[179] - (v_[157] - v_[157] * v_[178]))) - v_[125] * v_[134];
+    v_[104] = -0.0117 + (v_[59] * v_[111] + v_[58] * v_[107] - (v_[32] * v_[177] + v_[57] * v_[175])) - v_[126] * v_[134];
+    v_[118] = 0.39 + (v_[59] * v_[113] + v_[58] * v_[108] - (v_[32] * v_[179] - v_[57] * v_[186])) - v_[127] * v_[134];
+    v_[119] = v_[187] + (-(v_[58] * v_[181]) - v_[59] * v_[143]) - v_[124] * v_[134];
+    v_[105] = v_[32] * v_[105] - v_[57] * v_[109] - v_[123] * v_[138];
+    v_[106] = 0.39 + (v_[32] * v_[106] - v_[57] * v_[110]) - v_[125] * v_[138];
+    v_[107] = -0.09 + (v_[32] * v_[107] - v_[57] * v_[111]) - v_[126] * v_[138];
+    v_[108] = 3. + (v_[32] * v_[108] - v_[57] * v_[113]) - v_[127] * v_[138];
+    v_[109] = v_[57] * v_[143] - v_[32] * v_[181] - v_[124] * v_[138];
+    v_[110] = -0.39 - v_[120] - v_[123] * v_[139];
+    v_[41] = -v_[41] - v_[125] * v_[139];
+    v_[111] = -v_[121] - v_[126] * v_[139];
+    v_[113] = -v_[122] - v_[127] * v_[139];
+    v_[120] = 3. + v_[137] - v_[124] * v_[139];
+    v_[66] = v_[123] * v_[129] / v_[126] + (v_[81] * v_[92] + (v_[79] * v_[89] - v_[82] * v_[88]) + (0.2155 * v_[69] + (v_[32] * v_[66] - v_[57] * v_[67])) + (v_[85] * v_[105] - v_[86] * v_[110] + (v_[83] * v_[70] - v_[84] * v_[98])));
+    v_[67] = v_[125] * v_[129] / v_[126] + (v_[82] * v_[87] - v_[78] * v_[89] - v_[80] * v_[92] + (v_[59] * v_[95] + v_[58] * v_[68] - (v_[157] * v_[164] / v_[157] + (v_[161] + (v_[101] * v_[190] - v_[102] * v_[135] + (v_[99] * v_[112] - v_[100] * v_[151]))))) + (v_[85] * v_[106] - v_[86] * v_[41] + (v_[83] * v_[93] - v_[84] * v_[103])));
+    v_[68] = v_[127] * v_[129] / v_[126] + (v_[79] * v_[92] - v_[82] * v_[91] + (v_[32] * v_[68] - v_[57] * v_[95]) + (v_[85] * v_[108] - v_[86] * v_[113] + (v_[83] * v_[96] - v_[84] * v_[118])));
+    v_[69] = v_[124] * v_[129] / v_[126] + (v_[82] * v_[90] - v_[78] * v_[92] - v_[69] + (v_[85] * v_[109] - v_[86] * v_[120] + (v_[83] * v_[97] - v_[84] * v_[119])));
+    v_[78] = v_[55] * v_[97] + v_[54] * v_[96] + (v_[53] * v_[93] - v_[14] * v_[70]);
+    v_[79] = v_[55] * v_[119] + v_[54] * v_[118] + (v_[53] * v_[103] - v_[14] * v_[98]);
+    v_[80] = v_[55] * v_[109] + v_[54] * v_[108] + (v_[53] * v_[106] - v_[14] * v_[105]);
+    v_[81] = v_[55] * v_[120] + v_[54] * v_[113] + (v_[53] * v_[41] - v_[14] * v_[110]);
+    v_[82] = v_[56] * v_[81] + v_[55] * v_[80] + (v_[14] * v_[79] + v_[53] * v_[78]);
+    v_[87] = v_[56] * v_[111] + v_[55] * v_[107] + (v_[14] * v_[104] + v_[53] * v_[94]);
+    v_[41] = 0.0579 + (v_[56] * (v_[56] * v_[120] + v_[55] * v_[113] + (v_[14] * v_[41] + v_[53] * v_[110])) + v_[55] * (v_[56] * v_[109] + v_[55] * v_[108] + (v_[14] * v_[106] + v_[53] * v_[105])) + (v_[14] * (v_[56] * v_[119] + v_[55] * v_[118] + (v_[14] * v_[103] + v_[53] * v_[98])) + v_[53] * (v_[56] * v_[97] + v_[55] * v_[96] + (v_[14] * v_[93] + v_[53] * v_[70]))));
+    v_[70] = x_in[18] + -0.5 * v_[43] - (v_[71] * v_[76] - v_[72] * v_[75] + (v_[56] * v_[69] + v_[55] * v_[68] + (v_[14] * v_[67] + v_[53] * v_[66])));
+    v_[88] = v_[82] / v_[41];
+    v_[89] = v_[87] / v_[41];
+    v_[78] = 0.071 + (v_[55] * v_[81] + v_[54] * v_[80] + (v_[53] * v_[79] - v_[14] * v_[78])) - v_[82] * v_[88];
+    v_[79] = v_[55] * v_[111] + v_[54] * v_[107] + (v_[53] * v_[104] - v_[14] * v_[94]) - v_[87] * v_[88];
+    v_[80] = v_[55] * (v_[124] - v_[124] * v_[136]) + v_[54] * (v_[127] - v_[127] * v_[136]) + (v_[53] * (v_[125] - v_[125] * v_[136]) - v_[14] * (v_[123] - v_[123] * v_[136])) - v_[82] * v_[89];
+    v_[81] = 0.025 + (v_[126] - v_[126] * v_[136]) - v_[87] * v_[89];
+    v_[66] = (x_in[17] + -0.5 * v_[42] - (v_[13] * (v_[87] * v_[70] / v_[41] + (v_[43] * v_[75] - v_[71] * v_[77] + (v_[126] * v_[129] / v_[126] + (v_[128] + (v_[85] * v_[107] - v_[86] * v_[111] + (v_[83] * v_[94] - v_[84] * v_[104])))) + (v_[73] * v_[79] - v_[74] * v_[81]))) + v_[52] * (v_[82] * v_[70] / v_[41] + (v_[72] * v_[77] - v_[43] * v_[76] + (v_[55] * v_[69] + v_[54] * v_[68] + (v_[53] * v_[67] - v_[14] * v_[66])) + (v_[73] * v_[78] - v_[74] * v_[80]))))) / (0.0236 + (v_[13] * (v_[13] * v_[81] + v_[52] * v_[80]) + v_[52] * (v_[13] * v_[79] + v_[52] * v_[78])));
+    v_[67] = v_[73] + v_[52] * v_[66];
+    v_[68] = v_[13] * v_[66] - v_[74];
+    v_[41] = (v_[70] - (v_[87] * v_[68] + v_[82] * v_[67])) / v_[41];
+    v_[69] = v_[83] + (v_[53] * v_[41] - v_[14] * v_[67]);
+    v_[70] = v_[14] * v_[41] + v_[53] * v_[67] - v_[84];
+    v_[54] = v_[85] + (v_[55] * v_[41] + v_[54] * v_[67]);
+    v_[55] = v_[56] * v_[41] + v_[55] * v_[67] - v_[86];
+    v_[56] = (v_[129] - (v_[124] * v_[55] + v_[127] * v_[54] + (v_[126] * v_[68] + v_[125] * v_[70] + v_[123] * v_[69]))) / v_[126];
+    v_[67] = v_[68] + v_[56];
+    v_[55] = 0.2155 * v_[69] - v_[55];
+    v_[68] = v_[99] + (v_[57] * v_[67] + v_[32] * v_[69]);
+    v_[67] = v_[32] * v_[67] - v_[57] * v_[69] - v_[100];
+    v_[58] = v_[101] + (v_[32] * v_[54] + v_[58] * v_[70]);
+    v_[54] = v_[59] * v_[70] - v_[57] * v_[54] - v_[102];
+    v_[59] = (v_[164] - (v_[149] * v_[55] + v_[148] * v_[54] + v_[158] * v_[58] + (v_[152] * v_[67] - v_[157] * v_[70] + v_[145] * v_[68]))) / v_[157];
+    v_[69] = v_[59] - v_[70];
+    v_[70] = v_[114] + (v_[60] * v_[69] - v_[34] * v_[68]);
+    v_[71] = v_[34] * v_[69] + v_[60] * v_[68] - v_[115];
+    v_[61] = v_[116] + (v_[60] * v_[55] - v_[34] * v_[58] + (v_[62] * v_[69] + v_[61] * v_[68]));
+    v_[55] = v_[34] * v_[55] + v_[60] * v_[58] + (v_[63] * v_[69] + v_[62] * v_[68]) - v_[117];
+    v_[58] = (v_[176] - (v_[162] * v_[54] + v_[172] * v_[55] + v_[169] * v_[61] + (v_[168] * v_[67] + v_[163] * v_[71] + v_[160] * v_[70]))) / v_[168];
+    v_[62] = v_[67] + v_[58];
+    v_[54] = (v_[173] - (v_[167] * (0.2155 * v_[70] - v_[55]) + v_[171] * (v_[132] + (v_[64] * v_[54] + v_[38] * v_[61] + v_[65] * v_[71])) + (v_[166] * (v_[130] + (v_[64] * v_[62] + v_[38] * v_[70])) - v_[170] * v_[71]))) / v_[170];
+    v_[55] = (v_[156] - 0.001 * (v_[38] * v_[62] - v_[64] * v_[70] - v_[131])) / 0.001;
+    v_[61] = v_[10] * v_[52];
+    v_[62] = v_[10] * v_[13];
+    v_[63] = v_[53] * v_[62];
+    v_[65] = v_[51] * v_[14];
+    v_[62] = v_[51] * v_[53] - v_[14] * v_[62];
+    v_[67] = 0.42 * v_[10];
+    v_[68] = 0.4 * v_[10];
+    v_[69] = v_[52] * v_[68];
+    v_[70] = v_[13] * v_[68];
+    v_[71] = 0.4 * v_[51];
+    v_[72] = v_[53] * v_[71] - v_[14] * v_[70];
+    v_[73] = 0.241 * v_[10];
+    v_[74] = v_[13] * v_[73];
+    v_[75] = v_[14] * v_[74];
+    v_[76] = 0.241 * v_[51];
+    v_[77] = v_[53] * v_[76];
+    v_[78] = v_[77] - v_[75];
+    v_[79] = v_[52] * v_[73];
+    v_[80] = v_[32] * v_[79];
+    v_[81] = v_[57] * v_[78] + v_[80];
+    v_[82] = v_[14] * v_[76];
+    v_[83] = -0.241 * v_[10];
+    v_[84] = v_[53] * (v_[13] * v_[83]) - v_[82];
+    v_[75] = v_[75] - v_[77];
+    v_[77] = v_[57] * v_[79];
+    v_[85] = v_[60] * v_[84] + v_[34] * (v_[32] * v_[75] + v_[77]);
+    v_[86] = v_[51] * v_[52];
+    v_[87] = v_[10] * v_[53];
+    v_[88] = v_[51] * v_[13];
+    v_[89] = v_[14] * v_[88];
+    v_[88] = v_[53] * v_[88];
+    v_[90] = v_[10] * v_[14];
+    v_[91] = 0.42 * v_[51];
+    v_[92] = v_[52] * v_[71];
+    v_[93] = v_[53] * v_[68];
+    v_[94] = v_[13] * v_[76];
+    v_[95] = v_[14] * v_[94];
+    v_[83] = v_[53] * v_[83] - v_[95];
+    v_[76] = v_[52] * v_[76];
+    v_[96] = v_[32] * v_[76];
+    v_[97] = v_[53] * v_[94];
+    v_[98] = v_[14] * v_[73];
+    v_[99] = v_[98] - v_[97];
+    v_[73] = v_[53] * v_[73];
+    v_[95] = v_[95] + v_[73];
+    v_[100] = v_[57] * v_[76];
+    v_[101] = 0.4 * v_[13];
+    v_[102] = 0.4 * v_[52];
+    v_[103] = 0.241 * v_[52];
+    v_[104] = v_[14] * v_[103];
+    v_[105] = v_[57] * v_[104];
+    v_[106] = 0.241 * v_[13];
+    v_[107] = v_[53] * v_[103];
+    v_[108] = v_[32] * v_[104];
+    v_[109] = v_[57] * v_[106];
+    v_[110] = v_[13] * v_[71];
+    v_[111] = v_[57] * v_[95] - v_[96];
+    v_[97] = v_[97] - v_[98];
+    v_[98] = -0.241 * v_[51];
+    v_[112] = v_[14] * v_[79];
+    v_[79] = v_[13] * v_[67] + (v_[32] * v_[70] + (v_[57] * (v_[14] * v_[69]) + (v_[38] * (v_[57] * v_[112] + v_[32] * v_[74]) + v_[64] * (v_[60] * (v_[53] * v_[79]) + v_[34] * (v_[57] * v_[74] - v_[32] * v_[112])))));
+    v_[74] = v_[53] * v_[74];
+    v_[70] = v_[57] * (v_[53] * v_[70] + v_[14] * v_[71]) + (v_[38] * (v_[57] * (v_[82] + v_[74])) + v_[64] * (v_[60] * v_[78] + v_[34] * (v_[32] * v_[84])));
+    v_[71] = v_[32] * v_[78] - v_[77];
+    v_[77] = v_[32] * v_[72] + (v_[38] * v_[71] + v_[64] * (v_[34] * v_[81]) - v_[57] * v_[69]);
+    v_[71] = v_[64] * (v_[34] * (v_[14] * v_[98] - v_[74]) + v_[60] * v_[71]);
+    v_[74] = v_[38] * v_[85] + v_[64] * (v_[57] * v_[75] - v_[80]);
+    v_[75] = v_[14] * v_[76];
+    v_[75] = v_[13] * v_[91] + (v_[32] * v_[110] + (v_[57] * (v_[14] * v_[92]) + (v_[38] * (v_[57] * v_[75] + v_[32] * v_[94]) + v_[64] * (v_[60] * (v_[53] * v_[76]) + v_[34] * (v_[57] * v_[94] - v_[32] * v_[75])))));
+    v_[68] = v_[57] * (v_[53] * v_[110] - v_[14] * v_[68]) + (v_[38] * (v_[57] * v_[97]) + v_[64] * (v_[60] * v_[83] + v_[34] * (v_[32] * v_[99])));
+    v_[76] = v_[32] * v_[83] - v_[100];
+    v_[78] = v_[32] * (v_[14] * (v_[13] * (-0.4 * v_[51])) - v_[93]) + (v_[38] * v_[76] + v_[64] * (v_[34] * (v_[57] * v_[83] + v_[96])) - v_[57] * v_[92]);
+    v_[76] = v_[64] * (v_[34] * v_[99] + v_[60] * v_[76]);
+    v_[80] = v_[38] * (v_[60] * v_[99] + v_[34] * (v_[32] * v_[95] + v_[100])) + v_[64] * v_[111];
+    v_[82] = v_[14] * v_[106];
+    v_[82] = v_[57] * (v_[14] * v_[101]) + (v_[38] * (v_[57] * v_[82] - v_[32] * v_[103]) + v_[64] * (v_[60] * (v_[53] * v_[106]) + v_[34] * (v_[57] * (-0.241 * v_[52]) - v_[32] * v_[82]))) - v_[32] * v_[102] - 0.42 * v_[52];
+    v_[53] = v_[64] * (v_[60] * v_[104] + v_[34] * (v_[32] * v_[107])) - v_[38] * (v_[57] * v_[107]) - v_[57] * (v_[53] * v_[102]);
+    v_[83] = v_[108] - v_[109];
+    v_[84] = v_[32] * (v_[14] * v_[102]) + (v_[38] * v_[83] + v_[64] * (v_[34] * (v_[105] + v_[32] * v_[106])) - v_[57] * v_[101]);
+    v_[83] = v_[64] * (v_[34] * v_[107] + v_[60] * v_[83]);
+    v_[94] = v_[38] * (v_[60] * v_[107] + v_[34] * (v_[109] - v_[108])) + v_[64] * (v_[32] * (-0.241 * v_[13]) - v_[105]);
+    v_[51] = v_[43] * v_[51];
+    v_[10] = v_[43] * v_[10];
+    v_[95] = v_[44] * v_[61] - v_[51];
+    v_[96] = v_[10] + v_[44] * v_[86];
+    v_[99] = v_[95] + v_[46] * (v_[63] + v_[65]);
+    v_[101] = v_[96] + v_[46] * (v_[88] - v_[90]);
+    v_[102] = v_[99] + v_[48] * (v_[32] * v_[61] + v_[57] * v_[62]);
+    v_[103] = v_[101] + v_[48] * (v_[32] * v_[86] + v_[57] * (-v_[89] - v_[87]));
+    v_[13] = v_[42] * (v_[57] * (v_[93] + v_[14] * v_[110]) + (v_[38] * v_[111] + v_[64] * (v_[60] * v_[97] + v_[34] * (v_[32] * (v_[14] * (v_[13] * v_[98]) - v_[73]) - v_[100]))) - v_[32] * v_[92] - v_[52] * v_[91]) + v_[43] * v_[79] + v_[44] * v_[70] + v_[46] * v_[77] + v_[48] * v_[71] + v_[49] * v_[74];
+    v_[14] = v_[42] * (v_[52] * v_[67] + (v_[32] * v_[69] + (v_[57] * v_[72] + (v_[38] * v_[81] + v_[64] * v_[85])))) + v_[43] * v_[75] + v_[44] * v_[68] + v_[46] * v_[78] + v_[48] * v_[76] + v_[49] * v_[80];
+    v_[38] = 1e-10 + (v_[43] * v_[82] + v_[44] * v_[53] + v_[46] * v_[84] + v_[48] * v_[83] + v_[49] * v_[94]);
+    v_[52] = sqrt(v_[38] * v_[38] + v_[14] * v_[14] + v_[13] * v_[13]);
+    v_[1] = sqrt(v_[1] * v_[1]);
+    v_[64] = v_[28] * v_[38];
+    v_[10] = 10. * (v_[43] * (-(v_[75] * v_[51]) - v_[79] * v_[10]) + v_[44] * (v_[68] * (v_[95] - v_[51]) - v_[70] * (v_[10] + v_[96])) + v_[46] * (v_[78] * (v_[95] + v_[99]) - v_[77] * (v_[96] + v_[101])) + v_[48] * (v_[76] * (v_[99] + v_[102]) - v_[71] * (v_[101] + v_[103])) + v_[49] * (v_[80] * (v_[102] + (v_[102] + v_[49] * (v_[60] * (v_[32] * v_[62] - v_[57] * v_[61]) + v_[34] * (-v_[65] - v_[63])))) - v_[74] * (v_[103] + (v_[103] + v_[49] * (v_[34] * (v_[90] - v_[88]) + v_[60] * (v_[32] * (-v_[87] - v_[89]) - v_[57] * v_[86]))))) + (v_[54] * v_[94] + (v_[58] * v_[83] + v_[59] * v_[84]) + (v_[56] * v_[53] + v_[41] * v_[82]))) + 601. * v_[38] + (v_[25] * (v_[38] * v_[1]) / v_[23] + v_[38] / v_[52] * v_[64]);
+    v_[32] = x_in[0] + x_in[30] * v_[42];
+    v_[34] = x_in[1] + x_in[30] * v_[43];
+    v_[38] = x_in[2] + x_in[30] * v_[44];
+    v_[51] = x_in[3] + x_in[30] * v_[46];
+    v_[53] = x_in[4] + x_in[30] * v_[48];
+    v_[57] = x_in[5] + x_in[30] * v_[49];
+    v_[60] = x_in[6] + x_in[30] * v_[50];
+    v_[61] = x_in[7] + x_in[30] * v_[66];
+    v_[62] = x_in[8] + x_in[30] * v_[41];
+    v_[63] = x_in[9] + x_in[30] * v_[56];
+    v_[65] = x_in[10] + x_in[30] * v_[59];
+    v_[67] = x_in[11] + x_in[30] * v_[58];
+    v_[68] = x_in[12] + x_in[30] * v_[54];
+    v_[69] = x_in[13] + x_in[30] * v_[55];
+    v_[70] = x_in[16] + x_in[30] * v_[10];
+    v_[71] = sin(v_[32]);
+    v_[32] = cos(v_[32]);
+    v_[72] = sin(v_[34]);
+    v_[34] = cos(v_[34]);
+    v_[73] = sin(v_[38]);
+    v_[38] = cos(v_[38]);
+    v_[74] = 0.2045 * v_[73];
+    v_[75] = 0.2045 * v_[38];
+    v_[76] = -0.2045 * v_[73];
+    v_[77] = sin(v_[51]);
+    v_[51] = cos(v_[51]);
+    v_[78] = 0.2155 * v_[51];
+    v_[79] = -0.2155 * v_[77];
+    v_[80] = sin(v_[53]);
+    v_[53] = cos(v_[53]);
+    v_[81] = 0.1845 * v_[80];
+    v_[82] = 0.1845 * v_[53];
+    v_[83] = -0.1845 * v_[80];
+    v_[84] = sin(v_[57]);
+    v_[57] = cos(v_[57]);
+    v_[85] = 0.2155 * v_[57];
+    v_[86] = -0.2155 * v_[84];
+    v_[87] = sin(v_[60]);
+    v_[60] = cos(v_[60]);
+    v_[88] = 0.081 * v_[87];
+    v_[89] = 0.081 * v_[60];
+    v_[90] = -0.081 * v_[87];
+    v_[91] = v_[61] * v_[72];
+    v_[92] = v_[61] * v_[34];
+    v_[93] = v_[62] * v_[92];
+    v_[94] = v_[62] * v_[91];
+    v_[95] = 0.071 * v_[91];
+    v_[96] = 0.025 * v_[92];
+    v_[97] = 0.0579 * v_[62];
+    v_[98] = v_[62] * v_[73] - v_[38] * v_[91];
+    v_[99] = v_[62] * v_[38] + v_[73] * v_[91];
+    v_[100] = v_[62] * v_[75] + v_[74] * v_[91];
+    v_[101] = v_[62] * v_[76] + v_[75] * v_[91];
+    v_[102] = v_[63] + v_[92];
+    v_[103] = v_[63] * v_[99];
+    v_[104] = v_[63] * v_[98];
+    v_[105] = v_[63] * v_[101];
+    v_[106] = v_[63] * v_[100];
+    v_[107] = -0.39 * v_[101] + 0.1334 * v_[98];
+    v_[108] = 0.39 * v_[100] + (-0.0117 * v_[102] + 0.1257 * v_[99]);
+    v_[109] = -0.09 * v_[100] + (0.0127 * v_[102] + -0.0117 * v_[99]);
+    v_[110] = 3. * v_[100] + (-0.09 * v_[102] + 0.39 * v_[99]);
+    v_[111] = 3. * v_[101] + -0.39 * v_[98];
+    v_[112] = 0.09 * v_[98];
+    v_[113] = v_[77] * v_[102] + v_[51] * v_[98];
+    v_[114] = v_[51] * v_[102] - v_[77] * v_[98];
+    v_[115] = v_[51] * v_[100] + v_[78] * v_[99];
+    v_[116] = v_[79] * v_[99] - v_[77] * v_[100];
+    v_[117] = 0.2155 * v_[98] - v_[101];
+    v_[118] = v_[65] - v_[99];
+    v_[119] = v_[65] * v_[114];
+    v_[120] = v_[65] * v_[113];
+    v_[121] = v_[65] * v_[116];
+    v_[122] = v_[65] * v_[115];
+    v_[123] = 0.1809 * v_[117] + -0.0918 * v_[116] + 0.0452 * v_[113];
+    v_[124] = 0.0918 * v_[115] + (-0.0061 * v_[118] + 0.0131 * v_[114]);
+    v_[125] = -0.1809 * v_[115] + (0.0411 * v_[118] + -0.0061 * v_[114]);
+    v_[126] = 2.7 * v_[115] + (-0.1809 * v_[118] + 0.0918 * v_[114]);
+    v_[127] = 2.7 * v_[116] + -0.0918 * v_[113];
+    v_[128] = 2.7 * v_[117] + 0.1809 * v_[113];
+    v_[129] = v_[80] * v_[118] - v_[53] * v_[113];
+    v_[130] = v_[53] * v_[118] + v_[80] * v_[113];
+    v_[131] = v_[80] * v_[117] - v_[53] * v_[115] + (v_[82] * v_[118] + v_[81] * v_[113]);
+    v_[132] = v_[53] * v_[117] + v_[80] * v_[115] + (v_[83] * v_[118] + v_[82] * v_[113]);
+    v_[133] = v_[67] + v_[114];
+    v_[134] = v_[67] * v_[130];
+    v_[135] = v_[67] * v_[129];
+    v_[136] = v_[67] * v_[132];
+    v_[137] = v_[67] * v_[131];
+    v_[138] = 0.0357 * v_[116] + -0.1292 * v_[132] + 0.0306 * v_[129];
+    v_[139] = -0.00017 * v_[116] + 0.1292 * v_[131] + (-0.0027 * v_[133] + 0.0279 * v_[130]);
+    v_[140] = 0.00017 * v_[132] + -0.0357 * v_[131] + (0.0058 * v_[133] + -0.0027 * v_[130]);
+    v_[141] = 1.7 * v_[131] + (-0.0357 * v_[133] + 0.1292 * v_[130]);
+    v_[142] = 1.7 * v_[132] + (0.00017 * v_[133] + -0.1292 * v_[129]);
+    v_[143] = 1.7 * v_[116] + (-0.00017 * v_[130] + 0.0357 * v_[129]);
+    v_[144] = v_[84] * v_[133] + v_[57] * v_[129];
+    v_[145] = v_[57] * v_[133] - v_[84] * v_[129];
+    v_[146] = v_[84] * v_[116] + v_[57] * v_[131] + v_[85] * v_[130];
+    v_[147] = v_[57] * v_[116] - v_[84] * v_[131] + v_[86] * v_[130];
+    v_[148] = 0.2155 * v_[129] - v_[132];
+    v_[149] = v_[68] - v_[130];
+    v_[150] = v_[68] * v_[145];
+    v_[151] = v_[68] * v_[144];
+    v_[152] = v_[68] * v_[147];
+    v_[153] = v_[68] * v_[146];
+    v_[154] = 0.00108 * v_[148] + -0.00072 * v_[147] + 0.0005 * v_[144];
+    v_[155] = 0.00072 * v_[146] + 0.0036 * v_[145];
+    v_[156] = -0.00108 * v_[146] + 0.0047 * v_[149];
+    v_[157] = 1.8 * v_[146] + (-0.00108 * v_[149] + 0.00072 * v_[145]);
+    v_[158] = 1.8 * v_[147] + -0.00072 * v_[144];
+    v_[159] = 1.8 * v_[148] + 0.00108 * v_[144];
+    v_[160] = v_[87] * v_[149] - v_[60] * v_[144];
+    v_[161] = v_[60] * v_[149] + v_[87] * v_[144];
+    v_[162] = v_[87] * v_[148] - v_[60] * v_[146] + (v_[89] * v_[149] + v_[88] * v_[144]);
+    v_[163] = v_[60] * v_[148] + v_[87] * v_[146] + (v_[90] * v_[149] + v_[89] * v_[144]);
+    v_[164] = v_[69] + v_[145];
+    v_[165] = v_[69] * v_[161];
+    v_[166] = v_[69] * v_[160];
+    v_[167] = v_[69] * v_[163];
+    v_[168] = v_[69] * v_[162];
+    v_[169] = -0.006 * v_[163] + 0.001 * v_[160];
+    v_[170] = 0.006 * v_[162] + 0.001 * v_[161];
+    v_[171] = 0.001 * v_[164];
+    v_[172] = 0.3 * v_[162] + 0.006 * v_[161];
+    v_[173] = 0.3 * v_[163] + -0.006 * v_[160];
+    v_[174] = 0.3 * v_[147];
+    v_[175] = v_[162] * v_[173] - v_[163] * v_[172] + (v_[160] * v_[170] - v_[161] * v_[169]);
+    v_[176] = x_in[23] + -0.2 * v_[69] - v_[175];
+    v_[163] = v_[163] * v_[174] - v_[147] * v_[173] + (v_[161] * v_[171] - v_[164] * v_[170]) + (0.001 * v_[165] - -0.006 * v_[168]);
+    v_[162] = v_[147] * v_[172] - v_[162] * v_[174] + (v_[164] * v_[169] - v_[160] * v_[171]) + (0.006 * v_[167] - 0.001 * v_[166]);
+    v_[166] = v_[161] * v_[174] - v_[164] * v_[173] + (0.3 * v_[167] - 0.006 * v_[166]);
+    v_[164] = v_[164] * v_[172] - v_[160] * v_[174] + (-0.006 * v_[165] - 0.3 * v_[168]);
+    v_[165] = 0.001 * v_[60];
+    v_[167] = -0.006 * v_[89] - v_[165];
+    v_[168] = 0.001 * v_[87];
+    v_[169] = -0.006 * v_[90] + v_[168];
+    v_[170] = -0.006 * v_[87];
+    v_[171] = -0.006 * v_[60];
+    v_[168] = v_[168] + 0.006 * v_[88];
+    v_[165] = v_[165] + 0.006 * v_[89];
+    v_[174] = 0.006 * v_[60];
+    v_[177] = 0.006 * v_[87];
+    v_[178] = v_[177] + 0.3 * v_[88];
+    v_[179] = 0.3 * v_[89];
+    v_[180] = v_[174] + v_[179];
+    v_[181] = 0.3 * v_[60];
+    v_[182] = 0.3 * v_[87];
+    v_[179] = v_[179] - v_[171];
+    v_[183] = v_[170] + 0.3 * v_[90];
+    v_[184] = v_[89] * v_[182];
+    v_[185] = v_[89] * v_[181];
+    v_[186] = v_[90] * v_[179] + v_[89] * v_[178] + (v_[60] * v_[168] + v_[87] * v_[167]);
+    v_[187] = v_[184] + v_[90] * v_[181] + (v_[60] * v_[177] + v_[87] * v_[171]);
+    v_[188] = v_[87] * v_[181];
+    v_[189] = v_[60] * v_[182];
+    v_[190] = 0.0047 + (v_[90] * v_[183] + v_[89] * v_[180] + (v_[60] * v_[165] + v_[87] * v_[169]));
+    v_[191] = -0.00108 + (v_[90] * v_[182] - v_[185] + (v_[87] * v_[170] - v_[60] * v_[174]));
+    v_[192] = 1.8 + (v_[87] * v_[182] + v_[60] * v_[181]);
+    v_[90] = v_[146] * v_[158] - v_[147] * v_[157] + (v_[144] * v_[155] - v_[145] * v_[154]) + (v_[90] * v_[164] + v_[89] * v_[166] + (v_[60] * v_[162] + v_[87] * v_[163]));
+    v_[193] = x_in[22] + -0.5 * v_[68] - v_[90];
+    v_[194] = v_[186] / v_[190];
+    v_[195] = v_[190] / v_[190];
+    v_[196] = v_[191] / v_[190];
+    v_[197] = v_[187] / v_[190];
+    v_[167] = 0.0005 + (v_[89] * v_[179] + v_[88] * v_[178] + (v_[87] * v_[168] - v_[60] * v_[167])) - v_[186] * v_[194];
+    v_[165] = v_[89] * v_[183] + v_[88] * v_[180] + (v_[87] * v_[165] - v_[60] * v_[169]) - v_[190] * v_[194];
+    v_[168] = v_[184] - v_[88] * v_[181] + (-(v_[60] * v_[170]) - v_[87] * v_[174]) - v_[191] * v_[194];
+    v_[169] = 0.00108 + (v_[185] + v_[88] * v_[182] + (v_[87] * v_[177] - v_[60] * v_[171])) - v_[187] * v_[194];
+    v_[170] = v_[186] - v_[186] * v_[195];
+    v_[171] = v_[191] - v_[191] * v_[195];
+    v_[174] = v_[187] - v_[187] * v_[195];
+    v_[177] = v_[87] * v_[179] - v_[60] * v_[178] - v_[186] * v_[196];
+    v_[181] = -0.00108 + (v_[87] * v_[183] - v_[60] * v_[180]) - v_[190] * v_[196];
+    v_[182] = v_[192] - v_[191] * v_[196];
+    v_[184] = v_[188] - v_[189] - v_[187] * v_[196];
+    v_[178] = 0.00108 + (v_[60] * v_[179] + v_[87] * v_[178]) - v_[186] * v_[197];
+    v_[179] = v_[189] - v_[188] - v_[191] * v_[197];
+    v_[185] = v_[192] - v_[187] * v_[197];
+    v_[88] = v_[186] * v_[193] / v_[190] + (v_[147] * v_[159] - v_[148] * v_[158] + (v_[145] * v_[156] - v_[149] * v_[155]) + (v_[89] * v_[164] + v_[88] * v_[166] + (v_[87] * v_[162] - v_[60] * v_[163])) + (v_[152] * v_[177] - -0.00072 * v_[153] + v_[150] * v_[167]));
+    v_[89] = v_[148] * v_[157] - v_[146] * v_[159] + (v_[149] * v_[154] - v_[144] * v_[156]) + (v_[175] + 0.001 * v_[176] / 0.001) + (0.00072 * v_[152] - 0.0036 * v_[151]);
+    v_[146] = v_[191] * v_[193] / v_[190] + (v_[145] * v_[159] - v_[149] * v_[158] + (v_[87] * v_[164] - v_[60] * v_[166]) + (v_[152] * v_[182] + (v_[150] * v_[168] - 0.00072 * v_[151])));
+    v_[147] = v_[149] * v_[157] - v_[144] * v_[159] + (v_[160] * v_[173] - v_[161] * v_[172]) + (-0.00072 * v_[150] - 2.1 * v_[153]);
+    v_[144] = v_[187] * v_[193] / v_[190] + (v_[144] * v_[158] - v_[145] * v_[157] + (v_[60] * v_[164] + v_[87] * v_[166]) + (v_[152] * v_[184] + v_[150] * v_[169]));
+    v_[145] = 0.2155 * v_[169] + v_[57] * v_[167];
+    v_[148] = -0.00072 * v_[86] + v_[85] * v_[168] - v_[165];
+    v_[149] = v_[84] * v_[167];
+    v_[153] = -0.00072 * v_[84];
+    v_[154] = v_[57] * v_[168] - v_[153];
+    v_[155] = -0.00072 * v_[57];
+    v_[156] = v_[155] + v_[84] * v_[168];
+    v_[157] = 0.0036 * v_[84];
+    v_[158] = 0.00072 * v_[85];
+    v_[159] = 0.0036 * v_[57];
+    v_[160] = 0.00072 * v_[57];
+    v_[161] = 0.00072 * v_[84];
+    v_[162] = 0.2155 * v_[184] + (v_[57] * v_[177] - v_[161]);
+    v_[163] = v_[85] * v_[182] - v_[181];
+    v_[164] = v_[160] + v_[84] * v_[177];
+    v_[166] = v_[57] * v_[182];
+    v_[167] = v_[84] * v_[182];
+    v_[168] = 2.1 * v_[86];
+    v_[172] = 2.1 * v_[84];
+    v_[173] = 2.1 * v_[57];
+    v_[175] = 0.2155 * v_[185];
+    v_[177] = v_[175] + v_[57] * v_[178];
+    v_[60] = v_[85] * v_[179] - (v_[60] * v_[183] + v_[87] * v_[180] - v_[190] * v_[197]);
+    v_[87] = v_[84] * v_[178];
+    v_[178] = v_[57] * v_[179];
+    v_[179] = v_[84] * v_[179];
+    v_[180] = v_[84] * v_[145] - v_[57] * v_[157];
+    v_[182] = v_[57] * v_[161] + v_[84] * v_[156];
+    v_[183] = -0.0027 + (v_[57] * v_[158] + v_[84] * v_[148]);
+    v_[188] = 0.0058 + (v_[57] * v_[159] + v_[84] * v_[149]);
+    v_[189] = -0.0357 + (v_[57] * v_[160] + v_[84] * v_[154]);
+    v_[192] = 0.00017 - v_[84] * v_[169];
+    v_[194] = v_[131] * v_[142] - v_[132] * v_[141] + (v_[129] * v_[139] - v_[130] * v_[138]) + (v_[57] * v_[89] + v_[84] * v_[88]);
+    v_[196] = x_in[21] - v_[67] - v_[194];
+    v_[197] = v_[180] / v_[188];
+    v_[198] = v_[183] / v_[188];
+    v_[199] = v_[188] / v_[188];
+    v_[200] = v_[189] / v_[188];
+    v_[201] = v_[192] / v_[188];
+    v_[202] = v_[182] / v_[188];
+    v_[145] = 0.0306 + (0.2155 * v_[177] + (v_[84] * v_[157] + v_[57] * v_[145])) - v_[180] * v_[197];
+    v_[148] = 0.2155 * v_[60] + (v_[57] * v_[148] - v_[84] * v_[158]) - v_[183] * v_[197];
+    v_[149] = 0.2155 * v_[87] + (v_[57] * v_[149] - v_[84] * v_[159]) - v_[188] * v_[197];
+    v_[154] = 0.2155 * v_[178] + (v_[57] * v_[154] - v_[84] * v_[160]) - v_[189] * v_[197];
+    v_[157] = -0.1292 + (-(v_[57] * v_[169]) - v_[175]) - v_[192] * v_[197];
+    v_[156] = 0.0357 + (0.2155 * v_[179] + (v_[57] * v_[156] - v_[84] * v_[161])) - v_[182] * v_[197];
+    v_[158] = v_[86] * v_[155] + v_[85] * v_[162] - (0.2155 * v_[174] + v_[57] * v_[170]) - v_[180] * v_[198];
+    v_[159] = 0.0279 + (v_[86] * v_[168] + v_[85] * v_[163] - (v_[85] * v_[171] - (v_[190] - v_[190] * v_[195]))) - v_[183] * v_[198];
+    v_[160] = -0.0027 + (v_[86] * v_[153] + v_[85] * v_[164] - v_[84] * v_[170]) - v_[188] * v_[198];
+    v_[161] = 0.1292 + (v_[85] * v_[166] - v_[86] * v_[172] - v_[57] * v_[171]) - v_[189] * v_[198];
+    v_[169] = v_[174] - v_[85] * v_[184] - v_[192] * v_[198];
+    v_[170] = -0.00017 + (v_[86] * v_[173] + v_[85] * v_[167] - v_[84] * v_[171]) - v_[182] * v_[198];
+    v_[171] = v_[180] - v_[180] * v_[199];
+    v_[174] = v_[183] - v_[183] * v_[199];
+    v_[175] = v_[189] - v_[189] * v_[199];
+    v_[195] = v_[192] - v_[192] * v_[199];
+    v_[197] = v_[57] * v_[162] - v_[84] * v_[155] - v_[180] * v_[200];
+    v_[198] = 0.1292 + (v_[57] * v_[163] - v_[84] * v_[168]) - v_[183] * v_[200];
+    v_[203] = -0.0357 + (v_[57] * v_[164] - v_[84] * v_[153]) - v_[188] * v_[200];
+    v_[204] = 1.7 + (v_[84] * v_[172] + v_[57] * v_[166]) - v_[189] * v_[200];
+    v_[205] = -(v_[57] * v_[184]) - v_[192] * v_[200];
+    v_[200] = v_[57] * v_[167] - v_[84] * v_[173] - v_[182] * v_[200];
+    v_[177] = -0.1292 - v_[177] - v_[180] * v_[201];
+    v_[60] = -v_[60] - v_[183] * v_[201];
+    v_[87] = 0.00017 - v_[87] - v_[188] * v_[201];
+    v_[178] = -v_[178] - v_[189] * v_[201];
+    v_[185] = 1.7 + v_[185] - v_[192] * v_[201];
+    v_[179] = -v_[179] - v_[182] * v_[201];
+    v_[155] = 0.0357 + (v_[57] * v_[155] + v_[84] * v_[162]) - v_[180] * v_[202];
+    v_[162] = -0.00017 + (v_[57] * v_[168] + v_[84] * v_[163]) - v_[183] * v_[202];
+    v_[163] = v_[84] * v_[166] - v_[57] * v_[172] - v_[189] * v_[202];
+    v_[166] = -(v_[84] * v_[184]) - v_[192] * v_[202];
+    v_[88] = v_[180] * v_[196] / v_[188] + (v_[132] * v_[143] - v_[116] * v_[142] + (v_[130] * v_[140] - v_[133] * v_[139]) + (0.2155 * v_[144] + (v_[57] * v_[88] - v_[84] * v_[89])) + (v_[136] * v_[197] - v_[137] * v_[177] + (v_[134] * v_[145] - v_[135] * v_[158])));
+    v_[86] = v_[183] * v_[196] / v_[188] + (v_[116] * v_[141] - v_[131] * v_[143] + (v_[133] * v_[138] - v_[129] * v_[140]) + (v_[86] * v_[147] + v_[85] * v_[146] - (v_[190] * v_[193] / v_[190] + (v_[90] + (v_[152] * v_[181] + v_[150] * v_[165])))) + (v_[136] * v_[198] - v_[137] * v_[60] + (v_[134] * v_[148] - v_[135] * v_[159])));
+    v_[89] = v_[189] * v_[196] / v_[188] + (v_[130] * v_[143] - v_[133] * v_[142] + (v_[57] * v_[146] - v_[84] * v_[147]) + (v_[136] * v_[204] - v_[137] * v_[178] + (v_[134] * v_[154] - v_[135] * v_[161])));
+    v_[90] = v_[192] * v_[196] / v_[188] + (v_[133] * v_[141] - v_[129] * v_[143] - v_[144] + (v_[136] * v_[205] - v_[137] * v_[185] + (v_[134] * v_[157] - v_[135] * v_[169])));
+    v_[131] = v_[82] * v_[157] + v_[81] * v_[154] + (v_[80] * v_[148] - v_[53] * v_[145]);
+    v_[132] = v_[83] * v_[157] + v_[82] * v_[154] + (v_[53] * v_[148] + v_[80] * v_[145]);
+    v_[133] = v_[80] * v_[157] - v_[53] * v_[154];
+    v_[138] = v_[53] * v_[157] + v_[80] * v_[154];
+    v_[139] = v_[82] * v_[169] + v_[81] * v_[161] + (v_[80] * v_[159] - v_[53] * v_[158]);
+    v_[140] = v_[83] * v_[169] + v_[82] * v_[161] + (v_[53] * v_[159] + v_[80] * v_[158]);
+    v_[143] = v_[80] * v_[169] - v_[53] * v_[161];
+    v_[144] = v_[53] * v_[169] + v_[80] * v_[161];
+    v_[145] = v_[82] * v_[205] + v_[81] * v_[204] + (v_[80] * v_[198] - v_[53] * v_[197]);
+    v_[148] = v_[83] * v_[205] + v_[82] * v_[204] + (v_[53] * v_[198] + v_[80] * v_[197]);
+    v_[154] = v_[80] * v_[205] - v_[53] * v_[204];
+    v_[157] = v_[53] * v_[205] + v_[80] * v_[204];
+    v_[158] = v_[82] * v_[185] + v_[81] * v_[178] + (v_[80] * v_[60] - v_[53] * v_[177]);
+    v_[60] = v_[83] * v_[185] + v_[82] * v_[178] + (v_[53] * v_[60] + v_[80] * v_[177]);
+    v_[159] = v_[80] * v_[185] - v_[53] * v_[178];
+    v_[161] = v_[53] * v_[185] + v_[80] * v_[178];
+    v_[165] = v_[83] * v_[158] + v_[82] * v_[145] + (v_[53] * v_[139] + v_[80] * v_[131]);
+    v_[168] = v_[83] * v_[179] + v_[82] * v_[200] + (v_[53] * v_[170] + v_[80] * v_[156]);
+    v_[169] = v_[83] * v_[161] + v_[82] * v_[157] + (v_[53] * v_[144] + v_[80] * v_[138]);
+    v_[172] = -0.0061 + (v_[83] * v_[87] + v_[82] * v_[203] + (v_[53] * v_[160] + v_[80] * v_[149]));
+    v_[177] = 0.0411 + (v_[83] * v_[60] + v_[82] * v_[148] + (v_[53] * v_[140] + v_[80] * v_[132]));
+    v_[178] = -0.1809 + (v_[83] * v_[159] + v_[82] * v_[154] + (v_[53] * v_[143] + v_[80] * v_[133]));
+    v_[181] = v_[115] * v_[127] - v_[116] * v_[126] + (v_[113] * v_[124] - v_[114] * v_[123]) + (v_[83] * v_[90] + v_[82] * v_[89] + (v_[53] * v_[86] + v_[80] * v_[88]));
+    v_[184] = x_in[20] + -0.3 * v_[65] - v_[181];
+    v_[185] = v_[165] / v_[177];
+    v_[197] = v_[172] / v_[177];
+    v_[198] = v_[177] / v_[177];
+    v_[201] = v_[178] / v_[177];
+    v_[204] = v_[168] / v_[177];
+    v_[205] = v_[169] / v_[177];
+    v_[131] = 0.0452 + (v_[82] * v_[158] + v_[81] * v_[145] + (v_[80] * v_[139] - v_[53] * v_[131])) - v_[165] * v_[185];
+    v_[139] = v_[82] * v_[87] + v_[81] * v_[203] + (v_[80] * v_[160] - v_[53] * v_[149]) - v_[172] * v_[185];
+    v_[132] = v_[82] * v_[60] + v_[81] * v_[148] + (v_[80] * v_[140] - v_[53] * v_[132]) - v_[177] * v_[185];
+    v_[133] = v_[82] * v_[159] + v_[81] * v_[154] + (v_[80] * v_[143] - v_[53] * v_[133]) - v_[178] * v_[185];
+    v_[140] = -0.0918 + (v_[82] * v_[179] + v_[81] * v_[200] + (v_[80] * v_[170] - v_[53] * v_[156])) - v_[168] * v_[185];
+    v_[138] = 0.1809 + (v_[82] * v_[161] + v_[81] * v_[157] + (v_[80] * v_[144] - v_[53] * v_[138])) - v_[169] * v_[185];
+    v_[143] = v_[82] * v_[195] + v_[81] * v_[175] + (v_[80] * v_[174] - v_[53] * v_[171]) - v_[165] * v_[197];
+    v_[144] = 0.0131 + (v_[188] - v_[188] * v_[199]) - v_[172] * v_[197];
+    v_[171] = -0.0061 + (v_[83] * v_[195] + v_[82] * v_[175] + (v_[53] * v_[174] + v_[80] * v_[171])) - v_[177] * v_[197];
+    v_[174] = 0.0918 + (v_[80] * v_[195] - v_[53] * v_[175]) - v_[178] * v_[197];
+    v_[185] = v_[182] - v_[182] * v_[199] - v_[168] * v_[197];
+    v_[175] = v_[53] * v_[195] + v_[80] * v_[175] - v_[169] * v_[197];
+    v_[195] = v_[165] - v_[165] * v_[198];
+    v_[197] = v_[172] - v_[172] * v_[198];
+    v_[199] = v_[178] - v_[178] * v_[198];
+    v_[206] = v_[168] - v_[168] * v_[198];
+    v_[207] = v_[169] - v_[169] * v_[198];
+    v_[208] = v_[80] * v_[158] - v_[53] * v_[145] - v_[165] * v_[201];
+    v_[209] = 0.0918 + (v_[80] * v_[87] - v_[53] * v_[203]) - v_[172] * v_[201];
+    v_[210] = -0.1809 + (v_[80] * v_[60] - v_[53] * v_[148]) - v_[177] * v_[201];
+    v_[211] = 2.7 + (v_[80] * v_[159] - v_[53] * v_[154]) - v_[178] * v_[201];
+    v_[212] = v_[80] * v_[179] - v_[53] * v_[200] - v_[168] * v_[201];
+    v_[201] = v_[80] * v_[161] - v_[53] * v_[157] - v_[169] * v_[201];
+    v_[213] = -0.0918 + (v_[82] * v_[166] + v_[81] * v_[163] + (v_[80] * v_[162] - v_[53] * v_[155])) - v_[165] * v_[204];
+    v_[153] = v_[57] * v_[153] + v_[84] * v_[164] - v_[188] * v_[202] - v_[172] * v_[204];
+    v_[155] = v_[83] * v_[166] + v_[82] * v_[163] + (v_[53] * v_[162] + v_[80] * v_[155]) - v_[177] * v_[204];
+    v_[162] = v_[80] * v_[166] - v_[53] * v_[163] - v_[178] * v_[204];
+    v_[164] = 2.7 + (1.7 + (v_[57] * v_[173] + v_[84] * v_[167]) - v_[182] * v_[202]) - v_[168] * v_[204];
+    v_[163] = v_[53] * v_[166] + v_[80] * v_[163] - v_[169] * v_[204];
+    v_[145] = 0.1809 + (v_[53] * v_[158] + v_[80] * v_[145]) - v_[165] * v_[205];
+    v_[158] = v_[53] * v_[87] + v_[80] * v_[203] - v_[172] * v_[205];
+    v_[154] = v_[53] * v_[159] + v_[80] * v_[154] - v_[178] * v_[205];
+    v_[159] = v_[53] * v_[179] + v_[80] * v_[200] - v_[168] * v_[205];
+    v_[157] = 2.7 + (v_[53] * v_[161] + v_[80] * v_[157]) - v_[169] * v_[205];
+    v_[86] = v_[165] * v_[184] / v_[177] + (v_[116] * v_[128] - v_[117] * v_[127] + (v_[114] * v_[125] - v_[118] * v_[124]) + (v_[82] * v_[90] + v_[81] * v_[89] + (v_[80] * v_[86] - v_[53] * v_[88])) + (v_[121] * v_[208] - v_[122] * v_[213] + (v_[119] * v_[131] - v_[120] * v_[143])));
+    v_[87] = v_[172] * v_[184] / v_[177] + (v_[117] * v_[126] - v_[115] * v_[128] + (v_[118] * v_[123] - v_[113] * v_[125]) + (v_[188] * v_[196] / v_[188] + (v_[194] + (v_[136] * v_[203] - v_[137] * v_[87] + (v_[134] * v_[149] - v_[135] * v_[160])))) + (v_[121] * v_[209] - v_[122] * v_[153] + (v_[119] * v_[139] - v_[120] * v_[144])));
+    v_[88] = v_[178] * v_[184] / v_[177] + (v_[114] * v_[128] - v_[118] * v_[127] + (v_[80] * v_[90] - v_[53] * v_[89]) + (v_[121] * v_[211] - v_[122] * v_[162] + (v_[119] * v_[133] - v_[120] * v_[174])));
+    v_[115] = v_[168] * v_[184] / v_[177] + (v_[118] * v_[126] - v_[113] * v_[128] + (v_[182] * v_[196] / v_[188] + (v_[129] * v_[142] - v_[130] * v_[141] + (v_[57] * v_[147] + v_[84] * v_[146]) + (v_[136] * v_[200] - v_[137] * v_[179] + (v_[134] * v_[156] - v_[135] * v_[170])))) + (v_[121] * v_[212] - v_[122] * v_[164] + (v_[119] * v_[140] - v_[120] * v_[185])));
+    v_[89] = v_[169] * v_[184] / v_[177] + (v_[113] * v_[127] - v_[114] * v_[126] + (v_[53] * v_[90] + v_[80] * v_[89]) + (v_[121] * v_[201] - v_[122] * v_[163] + (v_[119] * v_[138] - v_[120] * v_[175])));
+    v_[90] = 0.2155 * v_[138] + (v_[51] * v_[131] - v_[77] * v_[139]);
+    v_[113] = v_[79] * v_[140] + v_[78] * v_[133] - v_[132];
+    v_[114] = v_[51] * v_[139] + v_[77] * v_[131];
+    v_[116] = v_[51] * v_[133] - v_[77] * v_[140];
+    v_[117] = 0.2155 * v_[175] + (v_[51] * v_[143] - v_[77] * v_[144]);
+    v_[118] = v_[79] * v_[185] + v_[78] * v_[174] - v_[171];
+    v_[123] = v_[51] * v_[144] + v_[77] * v_[143];
+    v_[124] = v_[51] * v_[174] - v_[77] * v_[185];
+    v_[125] = 0.2155 * v_[201] + (v_[51] * v_[208] - v_[77] * v_[209]);
+    v_[126] = v_[79] * v_[212] + v_[78] * v_[211] - v_[210];
+    v_[127] = v_[51] * v_[209] + v_[77] * v_[208];
+    v_[128] = v_[51] * v_[211] - v_[77] * v_[212];
+    v_[129] = 0.2155 * v_[163] + (v_[51] * v_[213] - v_[77] * v_[153]);
+    v_[130] = v_[79] * v_[164] + v_[78] * v_[162] - v_[155];
+    v_[131] = v_[51] * v_[153] + v_[77] * v_[213];
+    v_[133] = v_[51] * v_[162] - v_[77] * v_[164];
+    v_[139] = 0.2155 * v_[157];
+    v_[140] = v_[139] + (v_[51] * v_[145] - v_[77] * v_[158]);
+    v_[60] = v_[79] * v_[159] + v_[78] * v_[154] - (v_[53] * v_[60] + v_[80] * v_[148] - v_[177] * v_[205]);
+    v_[141] = v_[51] * v_[158] + v_[77] * v_[145];
+    v_[142] = v_[51] * v_[154] - v_[77] * v_[159];
+    v_[143] = v_[51] * v_[117] + v_[77] * v_[90];
+    v_[144] = -(v_[77] * v_[138]) - v_[51] * v_[175];
+    v_[145] = -0.0117 + (v_[51] * v_[118] + v_[77] * v_[113]);
+    v_[146] = 0.0127 + (v_[51] * v_[123] + v_[77] * v_[114]);
+    v_[147] = -0.09 + (v_[51] * v_[124] + v_[77] * v_[116]);
+    v_[148] = v_[100] * v_[111] - v_[101] * v_[110] + (v_[98] * v_[108] - v_[99] * v_[107]) + (v_[51] * v_[87] + v_[77] * v_[86]);
+    v_[149] = x_in[19] + -0.5 * v_[63] - v_[148];
+    v_[153] = v_[143] / v_[146];
+    v_[154] = v_[145] / v_[146];
+    v_[156] = v_[146] / v_[146];
+    v_[158] = v_[147] / v_[146];
+    v_[159] = v_[144] / v_[146];
+    v_[90] = 0.1334 + (0.2155 * v_[140] + (v_[51] * v_[90] - v_[77] * v_[117])) - v_[143] * v_[153];
+    v_[113] = 0.2155 * v_[60] + (v_[51] * v_[113] - v_[77] * v_[118]) - v_[145] * v_[153];
+    v_[114] = 0.2155 * v_[141] + (v_[51] * v_[114] - v_[77] * v_[123]) - v_[146] * v_[153];
+    v_[116] = 0.2155 * v_[142] + (v_[51] * v_[116] - v_[77] * v_[124]) - v_[147] * v_[153];
+    v_[117] = -0.39 + (v_[77] * v_[175] - v_[51] * v_[138] - v_[139]) - v_[144] * v_[153];
+    v_[118] = v_[79] * v_[129] + v_[78] * v_[125] - (0.2155 * v_[207] + (v_[51] * v_[195] - v_[77] * v_[197])) - v_[143] * v_[154];
+    v_[123] = 0.1257 + (v_[79] * v_[130] + v_[78] * v_[126] - (v_[79] * v_[206] + v_[78] * v_[199] - (v_[177] - v_[177] * v_[198]))) - v_[145] * v_[154];
+    v_[124] = -0.0117 + (v_[79] * v_[131] + v_[78] * v_[127] - (v_[51] * v_[197] + v_[77] * v_[195])) - v_[146] * v_[154];
+    v_[138] = 0.39 + (v_[79] * v_[133] + v_[78] * v_[128] - (v_[51] * v_[199] - v_[77] * v_[206])) - v_[147] * v_[154];
+    v_[139] = v_[207] + (-(v_[78] * v_[201]) - v_[79] * v_[163]) - v_[144] * v_[154];
+    v_[125] = v_[51] * v_[125] - v_[77] * v_[129] - v_[143] * v_[158];
+    v_[126] = 0.39 + (v_[51] * v_[126] - v_[77] * v_[130]) - v_[145] * v_[158];
+    v_[127] = -0.09 + (v_[51] * v_[127] - v_[77] * v_[131]) - v_[146] * v_[158];
+    v_[128] = 3. + (v_[51] * v_[128] - v_[77] * v_[133]) - v_[147] * v_[158];
+    v_[129] = v_[77] * v_[163] - v_[51] * v_[201] - v_[144] * v_[158];
+    v_[130] = -0.39 - v_[140] - v_[143] * v_[159];
+    v_[60] = -v_[60] - v_[145] * v_[159];
+    v_[131] = -v_[141] - v_[146] * v_[159];
+    v_[133] = -v_[142] - v_[147] * v_[159];
+    v_[140] = 3. + v_[157] - v_[144] * v_[159];
+    v_[86] = v_[143] * v_[149] / v_[146] + (v_[101] * v_[112] + (v_[99] * v_[109] - v_[102] * v_[108]) + (0.2155 * v_[89] + (v_[51] * v_[86] - v_[77] * v_[87])) + (v_[105] * v_[125] - v_[106] * v_[130] + (v_[103] * v_[90] - v_[104] * v_[118])));
+    v_[87] = v_[145] * v_[149] / v_[146] + (v_[102] * v_[107] - v_[98] * v_[109] - v_[100] * v_[112] + (v_[79] * v_[115] + v_[78] * v_[88] - (v_[177] * v_[184] / v_[177] + (v_[181] + (v_[121] * v_[210] - v_[122] * v_[155] + (v_[119] * v_[132] - v_[120] * v_[171]))))) + (v_[105] * v_[126] - v_[106] * v_[60] + (v_[103] * v_[113] - v_[104] * v_[123])));
+    v_[88] = v_[147] * v_[149] / v_[146] + (v_[99] * v_[112] - v_[102] * v_[111] + (v_[51] * v_[88] - v_[77] * v_[115]) + (v_[105] * v_[128] - v_[106] * v_[133] + (v_[103] * v_[116] - v_[104] * v_[138])));
+    v_[89] = v_[144] * v_[149] / v_[146] + (v_[102] * v_[110] - v_[98] * v_[112] - v_[89] + (v_[105] * v_[129] - v_[106] * v_[140] + (v_[103] * v_[117] - v_[104] * v_[139])));
+    v_[98] = v_[75] * v_[117] + v_[74] * v_[116] + (v_[73] * v_[113] - v_[38] * v_[90]);
+    v_[99] = v_[75] * v_[139] + v_[74] * v_[138] + (v_[73] * v_[123] - v_[38] * v_[118]);
+    v_[100] = v_[75] * v_[129] + v_[74] * v_[128] + (v_[73] * v_[126] - v_[38] * v_[125]);
+    v_[101] = v_[75] * v_[140] + v_[74] * v_[133] + (v_[73] * v_[60] - v_[38] * v_[130]);
+    v_[102] = v_[76] * v_[101] + v_[75] * v_[100] + (v_[38] * v_[99] + v_[73] * v_[98]);
+    v_[107] = v_[76] * v_[131] + v_[75] * v_[127] + (v_[38] * v_[124] + v_[73] * v_[114]);
+    v_[60] = 0.0579 + (v_[76] * (v_[76] * v_[140] + v_[75] * v_[133] + (v_[38] * v_[60] + v_[73] * v_[130])) + v_[75] * (v_[76] * v_[129] + v_[75] * v_[128] + (v_[38] * v_[126] + v_[73] * v_[125])) + (v_[38] * (v_[76] * v_[139] + v_[75] * v_[138] + (v_[38] * v_[123] + v_[73] * v_[118])) + v_[73] * (v_[76] * v_[117] + v_[75] * v_[116] + (v_[38] * v_[113] + v_[73] * v_[90]))));
+    v_[90] = x_in[18] + -0.5 * v_[62] - (v_[91] * v_[96] - v_[92] * v_[95] + (v_[76] * v_[89] + v_[75] * v_[88] + (v_[38] * v_[87] + v_[73] * v_[86])));
+    v_[108] = v_[102] / v_[60];
+    v_[109] = v_[107] / v_[60];
+    v_[98] = 0.071 + (v_[75] * v_[101] + v_[74] * v_[100] + (v_[73] * v_[99] - v_[38] * v_[98])) - v_[102] * v_[108];
+    v_[99] = v_[75] * v_[131] + v_[74] * v_[127] + (v_[73] * v_[124] - v_[38] * v_[114]) - v_[107] * v_[108];
+    v_[100] = v_[75] * (v_[144] - v_[144] * v_[156]) + v_[74] * (v_[147] - v_[147] * v_[156]) + (v_[73] * (v_[145] - v_[145] * v_[156]) - v_[38] * (v_[143] - v_[143] * v_[156])) - v_[102] * v_[109];
+    v_[101] = 0.025 + (v_[146] - v_[146] * v_[156]) - v_[107] * v_[109];
+    v_[86] = (x_in[17] + -0.5 * v_[61] - (v_[34] * (v_[107] * v_[90] / v_[60] + (v_[62] * v_[95] - v_[91] * v_[97] + (v_[146] * v_[149] / v_[146] + (v_[148] + (v_[105] * v_[127] - v_[106] * v_[131] + (v_[103] * v_[114] - v_[104] * v_[124])))) + (v_[93] * v_[99] - v_[94] * v_[101]))) + v_[72] * (v_[102] * v_[90] / v_[60] + (v_[92] * v_[97] - v_[62] * v_[96] + (v_[75] * v_[89] + v_[74] * v_[88] + (v_[73] * v_[87] - v_[38] * v_[86])) + (v_[93] * v_[98] - v_[94] * v_[100]))))) / (0.0236 + (v_[34] * (v_[34] * v_[101] + v_[72] * v_[100]) + v_[72] * (v_[34] * v_[99] + v_[72] * v_[98])));
+    v_[87] = v_[93] + v_[72] * v_[86];
+    v_[88] = v_[34] * v_[86] - v_[94];
+    v_[60] = (v_[90] - (v_[107] * v_[88] + v_[102] * v_[87])) / v_[60];
+    v_[89] = v_[103] + (v_[73] * v_[60] - v_[38] * v_[87]);
+    v_[90] = v_[38] * v_[60] + v_[73] * v_[87] - v_[104];
+    v_[74] = v_[105] + (v_[75] * v_[60] + v_[74] * v_[87]);
+    v_[75] = v_[76] * v_[60] + v_[75] * v_[87] - v_[106];
+    v_[76] = (v_[149] - (v_[144] * v_[75] + v_[147] * v_[74] + (v_[146] * v_[88] + v_[145] * v_[90] + v_[143] * v_[89]))) / v_[146];
+    v_[87] = v_[88] + v_[76];
+    v_[75] = 0.2155 * v_[89] - v_[75];
+    v_[88] = v_[119] + (v_[77] * v_[87] + v_[51] * v_[89]);
+    v_[87] = v_[51] * v_[87] - v_[77] * v_[89] - v_[120];
+    v_[78] = v_[121] + (v_[51] * v_[74] + v_[78] * v_[90]);
+    v_[74] = v_[79] * v_[90] - v_[77] * v_[74] - v_[122];
+    v_[79] = (v_[184] - (v_[169] * v_[75] + v_[168] * v_[74] + v_[178] * v_[78] + (v_[172] * v_[87] - v_[177] * v_[90] + v_[165] * v_[88]))) / v_[177];
+    v_[89] = v_[79] - v_[90];
+    v_[90] = v_[134] + (v_[80] * v_[89] - v_[53] * v_[88]);
+    v_[91] = v_[53] * v_[89] + v_[80] * v_[88] - v_[135];
+    v_[81] = v_[136] + (v_[80] * v_[75] - v_[53] * v_[78] + (v_[82] * v_[89] + v_[81] * v_[88]));
+    v_[75] = v_[53] * v_[75] + v_[80] * v_[78] + (v_[83] * v_[89] + v_[82] * v_[88]) - v_[137];
+    v_[78] = (v_[196] - (v_[182] * v_[74] + v_[192] * v_[75] + v_[189] * v_[81] + (v_[188] * v_[87] + v_[183] * v_[91] + v_[180] * v_[90]))) / v_[188];
+    v_[82] = v_[87] + v_[78];
+    v_[74] = (v_[193] - (v_[187] * (0.2155 * v_[90] - v_[75]) + v_[191] * (v_[152] + (v_[84] * v_[74] + v_[57] * v_[81] + v_[85] * v_[91])) + (v_[186] * (v_[150] + (v_[84] * v_[82] + v_[57] * v_[90])) - v_[190] * v_[91]))) / v_[190];
+    v_[75] = v_[32] * v_[72];
+    v_[81] = v_[32] * v_[34];
+    v_[83] = v_[73] * v_[81];
+    v_[85] = v_[71] * v_[38];
+    v_[81] = v_[71] * v_[73] - v_[38] * v_[81];
+    v_[87] = 0.42 * v_[32];
+    v_[88] = 0.4 * v_[32];
+    v_[89] = v_[72] * v_[88];
+    v_[91] = v_[34] * v_[88];
+    v_[92] = 0.4 * v_[71];
+    v_[93] = v_[73] * v_[92] - v_[38] * v_[91];
+    v_[94] = 0.241 * v_[32];
+    v_[95] = v_[34] * v_[94];
+    v_[96] = v_[38] * v_[95];
+    v_[97] = 0.241 * v_[71];
+    v_[98] = v_[73] * v_[97];
+    v_[99] = v_[98] - v_[96];
+    v_[100] = v_[72] * v_[94];
+    v_[101] = v_[51] * v_[100];
+    v_[102] = v_[77] * v_[99] + v_[101];
+    v_[103] = v_[38] * v_[97];
+    v_[104] = -0.241 * v_[32];
+    v_[105] = v_[73] * (v_[34] * v_[104]) - v_[103];
+    v_[96] = v_[96] - v_[98];
+    v_[98] = v_[77] * v_[100];
+    v_[106] = v_[80] * v_[105] + v_[53] * (v_[51] * v_[96] + v_[98]);
+    v_[107] = v_[71] * v_[72];
+    v_[108] = v_[32] * v_[73];
+    v_[109] = v_[71] * v_[34];
+    v_[110] = v_[38] * v_[109];
+    v_[109] = v_[73] * v_[109];
+    v_[111] = v_[32] * v_[38];
+    v_[112] = 0.42 * v_[71];
+    v_[113] = v_[72] * v_[92];
+    v_[114] = v_[73] * v_[88];
+    v_[115] = v_[34] * v_[97];
+    v_[116] = v_[38] * v_[115];
+    v_[104] = v_[73] * v_[104] - v_[116];
+    v_[97] = v_[72] * v_[97];
+    v_[117] = v_[51] * v_[97];
+    v_[118] = v_[73] * v_[115];
+    v_[119] = v_[38] * v_[94];
+    v_[120] = v_[119] - v_[118];
+    v_[94] = v_[73] * v_[94];
+    v_[116] = v_[116] + v_[94];
+    v_[121] = v_[77] * v_[97];
+    v_[122] = 0.4 * v_[34];
+    v_[123] = 0.4 * v_[72];
+    v_[124] = 0.241 * v_[72];
+    v_[125] = v_[38] * v_[124];
+    v_[126] = v_[77] * v_[125];
+    v_[127] = 0.241 * v_[34];
+    v_[128] = v_[73] * v_[124];
+    v_[129] = v_[51] * v_[125];
+    v_[130] = v_[77] * v_[127];
+    v_[131] = v_[34] * v_[92];
+    v_[132] = v_[77] * v_[116] - v_[117];
+    v_[118] = v_[118] - v_[119];
+    v_[119] = -0.241 * v_[71];
+    v_[133] = v_[38] * v_[100];
+    v_[100] = v_[34] * v_[87] + (v_[51] * v_[91] + (v_[77] * (v_[38] * v_[89]) + (v_[57] * (v_[77] * v_[133] + v_[51] * v_[95]) + v_[84] * (v_[80] * (v_[73] * v_[100]) + v_[53] * (v_[77] * v_[95] - v_[51] * v_[133])))));
+    v_[95] = v_[73] * v_[95];
+    v_[91] = v_[77] * (v_[73] * v_[91] + v_[38] * v_[92]) + (v_[57] * (v_[77] * (v_[103] + v_[95])) + v_[84] * (v_[80] * v_[99] + v_[53] * (v_[51] * v_[105])));
+    v_[92] = v_[51] * v_[99] - v_[98];
+    v_[98] = v_[51] * v_[93] + (v_[57] * v_[92] + v_[84] * (v_[53] * v_[102]) - v_[77] * v_[89]);
+    v_[92] = v_[84] * (v_[53] * (v_[38] * v_[119] - v_[95]) + v_[80] * v_[92]);
+    v_[95] = v_[57] * v_[106] + v_[84] * (v_[77] * v_[96] - v_[101]);
+    v_[96] = v_[38] * v_[97];
+    v_[96] = v_[34] * v_[112] + (v_[51] * v_[131] + (v_[77] * (v_[38] * v_[113]) + (v_[57] * (v_[77] * v_[96] + v_[51] * v_[115]) + v_[84] * (v_[80] * (v_[73] * v_[97]) + v_[53] * (v_[77] * v_[115] - v_[51] * v_[96])))));
+    v_[88] = v_[77] * (v_[73] * v_[131] - v_[38] * v_[88]) + (v_[57] * (v_[77] * v_[118]) + v_[84] * (v_[80] * v_[104] + v_[53] * (v_[51] * v_[120])));
+    v_[97] = v_[51] * v_[104] - v_[121];
+    v_[99] = v_[51] * (v_[38] * (v_[34] * (-0.4 * v_[71])) - v_[114]) + (v_[57] * v_[97] + v_[84] * (v_[53] * (v_[77] * v_[104] + v_[117])) - v_[77] * v_[113]);
+    v_[97] = v_[84] * (v_[53] * v_[120] + v_[80] * v_[97]);
+    v_[101] = v_[57] * (v_[80] * v_[120] + v_[53] * (v_[51] * v_[116] + v_[121])) + v_[84] * v_[132];
+    v_[103] = v_[38] * v_[127];
+    v_[103] = v_[77] * (v_[38] * v_[122]) + (v_[57] * (v_[77] * v_[103] - v_[51] * v_[124]) + v_[84] * (v_[80] * (v_[73] * v_[127]) + v_[53] * (v_[77] * (-0.241 * v_[72]) - v_[51] * v_[103]))) - v_[51] * v_[123] - 0.42 * v_[72];
+    v_[73] = v_[84] * (v_[80] * v_[125] + v_[53] * (v_[51] * v_[128])) - v_[57] * (v_[77] * v_[128]) - v_[77] * (v_[73] * v_[123]);
+    v_[104] = v_[129] - v_[130];
+    v_[105] = v_[51] * (v_[38] * v_[123]) + (v_[57] * v_[104] + v_[84] * (v_[53] * (v_[126] + v_[51] * v_[127])) - v_[77] * v_[122]);
+    v_[104] = v_[84] * (v_[53] * v_[128] + v_[80] * v_[104]);
+    v_[115] = v_[57] * (v_[80] * v_[128] + v_[53] * (v_[130] - v_[129])) + v_[84] * (v_[51] * (-0.241 * v_[34]) - v_[126]);
+    v_[71] = v_[62] * v_[71];
+    v_[32] = v_[62] * v_[32];
+    v_[116] = v_[63] * v_[75] - v_[71];
+    v_[117] = v_[32] + v_[63] * v_[107];
+    v_[120] = v_[116] + v_[65] * (v_[83] + v_[85]);
+    v_[122] = v_[117] + v_[65] * (v_[109] - v_[111]);
+    v_[123] = v_[120] + v_[67] * (v_[51] * v_[75] + v_[77] * v_[81]);
+    v_[124] = v_[122] + v_[67] * (v_[51] * v_[107] + v_[77] * (-v_[110] - v_[108]));
+    v_[34] = v_[61] * (v_[77] * (v_[114] + v_[38] * v_[131]) + (v_[57] * v_[132] + v_[84] * (v_[80] * v_[118] + v_[53] * (v_[51] * (v_[38] * (v_[34] * v_[119]) - v_[94]) - v_[121]))) - v_[51] * v_[113] - v_[72] * v_[112]) + v_[62] * v_[100] + v_[63] * v_[91] + v_[65] * v_[98] + v_[67] * v_[92] + v_[68] * v_[95];
+    v_[38] = v_[61] * (v_[72] * v_[87] + (v_[51] * v_[89] + (v_[77] * v_[93] + (v_[57] * v_[102] + v_[84] * v_[106])))) + v_[62] * v_[96] + v_[63] * v_[88] + v_[65] * v_[99] + v_[67] * v_[97] + v_[68] * v_[101];
+    v_[72] = 1e-10 + (v_[62] * v_[103] + v_[63] * v_[73] + v_[65] * v_[105] + v_[67] * v_[104] + v_[68] * v_[115]);
+    v_[87] = sqrt(v_[72] * v_[72] + v_[38] * v_[38] + v_[34] * v_[34]);
+    v_[70] = sqrt(v_[70] * v_[70]);
+    v_[28] = v_[28] * v_[72];
+    v_[89] = x_in[30] / 6.;
+    forwardZero[0] = x_in[0] + v_[89] * (v_[61] + (2. * v_[42] + (x_in[7] + 2. * v_[16])));
+    forwardZero[1] = x_in[1] + v_[89] * (v_[62] + (2. * v_[43] + (x_in[8] + 2. * v_[17])));
+    forwardZero[2] = x_in[2] + v_[89] * (v_[63] + (2. * v_[44] + (x_in[9] + 2. * v_[20])));
+    forwardZero[3] = x_in[3] + v_[89] * (v_[65] + (2. * v_[46] + (x_in[10] + 2. * v_[24])));
+    forwardZero[4] = x_in[4] + v_[89] * (v_[67] + (2. * v_[48] + (x_in[11] + 2. * v_[26])));
+    forwardZero[5] = x_in[5] + v_[89] * (v_[68] + (2. * v_[49] + (x_in[12] + 2. * v_[27])));
+    forwardZero[6] = x_in[6] + v_[89] * (v_[69] + (2. * v_[50] + (x_in[13] + 2. * v_[30])));
+    forwardZero[7] = x_in[7] + v_[89] * (v_[86] + (2. * v_[66] + (v_[21] + 2. * v_[47])));
+    forwardZero[8] = x_in[8] + v_[89] * (v_[60] + (2. * v_[41] + (v_[22] + 2. * v_[15])));
+    forwardZero[9] = x_in[9] + v_[89] * (v_[76] + (2. * v_[56] + (v_[8] + 2. * v_[37])));
+    forwardZero[10] = x_in[10] + v_[89] * (v_[79] + (2. * v_[59] + (v_[12] + 2. * v_[40])));
+    forwardZero[11] = x_in[11] + v_[89] * (v_[78] + (2. * v_[58] + (v_[11] + 2. * v_[39])));
+    forwardZero[12] = x_in[12] + v_[89] * (v_[74] + (2. * v_[54] + (v_[6] + 2. * v_[35])));
+    forwardZero[13] = x_in[13] + v_[89] * ((v_[176] - 0.001 * (v_[57] * v_[82] - v_[84] * v_[90] - v_[151])) / 0.001 + (2. * v_[55] + (v_[7] + 2. * v_[36])));
+    forwardZero[14] = x_in[14] + v_[89] * (v_[25] * (v_[34] * v_[70]) / v_[23] + v_[34] / v_[87] * v_[28] + (2. * (v_[25] * (v_[13] * v_[1]) / v_[23] + v_[13] / v_[52] * v_[64]) + (v_[25] * (v_[3] * v_[19]) / v_[23] + v_[3] / v_[18] * v_[29] + 2. * (v_[25] * (v_[5] * v_[31]) / v_[23] + v_[5] / v_[33] * v_[45]))));
+    forwardZero[15] = x_in[15] + v_[89] * (v_[25] * (v_[38] * v_[70]) / v_[23] + v_[38] / v_[87] * v_[28] + (2. * (v_[25] * (v_[14] * v_[1]) / v_[23] + v_[14] / v_[52] * v_[64]) + (v_[25] * (v_[2] * v_[19]) / v_[23] + v_[2] / v_[18] * v_[29] + 2. * (v_[25] * (v_[9] * v_[31]) / v_[23] + v_[9] / v_[33] * v_[45]))));
+    forwardZero[16] = x_in[16] + v_[89] * (10. * (v_[62] * (-(v_[96] * v_[71]) - v_[100] * v_[32]) + v_[63] * (v_[88] * (v_[116] - v_[71]) - v_[91] * (v_[32] + v_[117])) + v_[65] * (v_[99] * (v_[116] + v_[120]) - v_[98] * (v_[117] + v_[122])) + v_[67] * (v_[97] * (v_[120] + v_[123]) - v_[92] * (v_[122] + v_[124])) + v_[68] * (v_[101] * (v_[123] + (v_[123] + v_[68] * (v_[80] * (v_[51] * v_[81] - v_[77] * v_[75]) + v_[53] * (-v_[85] - v_[83])))) - v_[95] * (v_[124] + (v_[124] + v_[68] * (v_[53] * (v_[111] - v_[109]) + v_[80] * (v_[51] * (-v_[108] - v_[110]) - v_[77] * v_[107]))))) + (v_[74] * v_[115] + (v_[78] * v_[104] + v_[79] * v_[105]) + (v_[76] * v_[73] + v_[60] * v_[103]))) + 601. * v_[72] + (v_[25] * (v_[72] * v_[70]) / v_[23] + v_[72] / v_[87] * v_[28]) + (2. * v_[10] + (v_[0] + 2. * v_[4])));
+
+
+    return forwardZero_;
+}
+
+} // namespace KUKA
+} // namespace models
+} // namespace ct
+
+// clang-format on
@@ -0,0 +1,46 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+// generated code, do not edit. Written by a standalone symbolic tracer of kukaSoftContactRK4Step in
+// plant-models/KUKASoftContactSystemCodGenLinearizer.cpp, in the output format of the KUKASoftContactLinearizationCodegen target.
+// That target needs ct and CppADCodeGen and was not run for this file, rebuilding it overwrites the file.
+// Checked against RobotDynamics by test_models (src/main_test_models.cpp).
+
+#pragma once
+
+#include <ct/core/core.h>
+
+namespace ct {
+namespace models {
+namespace KUKA {
+
+class KUKASoftContactSystemRK4Step
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const size_t IN_DIM = 31;
+    static const size_t OUT_DIM = 17;
+
+    typedef Eigen::Matrix<double, OUT_DIM, 1> OUT_TYPE;
+
+    KUKASoftContactSystemRK4Step() { initialize(); }
+
+    const OUT_TYPE& forwardZero(const Eigen::VectorXd& x_in);
+
+private:
+    void initialize()
+    {
+        forwardZero_.setZero();
+        v_.fill(0.0);
+    }
+
+    OUT_TYPE forwardZero_;
+    std::array<double, 214> v_;
+};
+
+}  // namespace KUKA
+}  // namespace models
+}  // namespace ct
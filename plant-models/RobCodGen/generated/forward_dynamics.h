@@ -75,11 +75,27 @@ public:
         JointState& qdd, // output parameter
         const JointState& qd, const JointState& tau, const ExtForces& fext = zeroExtForces);
     ///@}
+    /** \name Forward dynamics with gravity compensation
+     * The accelerations fd() computes for the joint forces \c tau + g(q), g(q)
+     * the gravity terms of InverseDynamics::G_terms(). The compensation cancels
+     * gravity at the source: the Articulated-Body-Algorithm runs with a zero
+     * base acceleration, without an inverse dynamics pass for g(q).
+     */ ///@{
+    void fd_gravity_compensated(
+        JointState& qdd, // output parameter
+        const JointState& q, const JointState& qd, const JointState& tau, const ExtForces& fext = zeroExtForces);
+    void fd_gravity_compensated(
+        JointState& qdd, // output parameter
+        const JointState& qd, const JointState& tau, const ExtForces& fext = zeroExtForces);
+    ///@}
 
     /** Updates all the kinematics transforms used by this instance. */
     void setJointStatus(const JointState& q) const;
 
 private:
+    /** the three passes of the Articulated-Body-Algorithm, \c gravity along the z axis of the base */
+    void fd_passes(JointState& qdd, const JointState& qd, const JointState& tau, const ExtForces& fext, const Scalar& gravity);
+
     InertiaProperties<TRAIT>* inertiaProps;
     MTransforms* motionTransforms;
 
@@ -183,6 +199,38 @@ inline void ForwardDynamics<TRAIT>::fd(
     fd(qdd, qd, tau, fext);
 }
 
+template <typename TRAIT>
+inline void ForwardDynamics<TRAIT>::fd(
+    JointState& qdd,
+    const JointState& qd,
+    const JointState& tau,
+    const ExtForces& fext/* = zeroExtForces */)
+{
+    fd_passes(qdd, qd, tau, fext, Scalar(iit::rbd::g));
+}
+
+template <typename TRAIT>
+inline void ForwardDynamics<TRAIT>::fd_gravity_compensated(
+    JointState& qdd,
+    const JointState& q,
+    const JointState& qd,
+    const JointState& tau,
+    const ExtForces& fext/* = zeroExtForces */)
+{
+    setJointStatus(q);
+    fd_gravity_compensated(qdd, qd, tau, fext);
+}
+
+template <typename TRAIT>
+inline void ForwardDynamics<TRAIT>::fd_gravity_compensated(
+    JointState& qdd,
+    const JointState& qd,
+    const JointState& tau,
+    const ExtForces& fext/* = zeroExtForces */)
+{
+    fd_passes(qdd, qd, tau, fext, Scalar(0.0));
+}
+
 }
 
 typedef tpl::ForwardDynamics<iit::rbd::DoubleTrait> ForwardDynamics;
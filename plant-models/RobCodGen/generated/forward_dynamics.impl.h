@@ -30,11 +30,12 @@ iit::Kuka::dyn::tpl::ForwardDynamics<TRAIT>::ForwardDynamics(iit::Kuka::dyn::tpl
 }
 
 template <typename TRAIT>
-void iit::Kuka::dyn::tpl::ForwardDynamics<TRAIT>::fd(
+void iit::Kuka::dyn::tpl::ForwardDynamics<TRAIT>::fd_passes(
     JointState& qdd,
     const JointState& qd,
     const JointState& tau,
-    const ExtForces& fext/* = zeroExtForces */)
+    const ExtForces& fext,
+    const Scalar& gravity)
 {
     
     link1_AI = inertiaProps->getTensor_link1();
@@ -215,7 +216,7 @@ void iit::Kuka::dyn::tpl::ForwardDynamics<TRAIT>::fd(
     
     
     // ---------------------- THIRD PASS ---------------------- //
-    link1_a = (motionTransforms-> fr_link1_X_fr_base0).col(iit::rbd::LZ) * Scalar(iit::rbd::g);
+    link1_a = (motionTransforms-> fr_link1_X_fr_base0).col(iit::rbd::LZ) * gravity;
     qdd(JA) = (link1_u - link1_U.dot(link1_a)) / link1_D;
     link1_a(iit::rbd::AZ) += qdd(JA);
     
@@ -70,6 +70,7 @@ int main(int argc, char *argv[]) {
   solverOptions.tolFun   = ADMM_OPTS.tolFun;
   solverOptions.tolGrad  = ADMM_OPTS.tolGrad;
   solverOptions.max_iter = iterMax;
+  solverOptions.warmStart = true; // consecutive ADMM iterations share the nominal trajectory
 
   // parameters for ADMM, penelty terms. initial
   Eigen::VectorXd rho_init(5);
@@ -1,4 +1,5 @@
 #include <memory>
+#include <string>
 #include <Eigen/Dense>
 
 
@@ -60,6 +61,7 @@ int main(int argc, char *argv[]) {
   solverOptions.tolFun   = ADMM_OPTS.tolFun;
   solverOptions.tolGrad  = ADMM_OPTS.tolGrad;
   solverOptions.max_iter = iterMax;
+  solverOptions.warmStart = true; // consecutive ADMM iterations share the nominal trajectory
 
   // parameters for ADMM, penelty terms. initial
   Eigen::VectorXd rho_init(5);
@@ -108,7 +110,10 @@ int main(int argc, char *argv[]) {
   // admm optimizer
   ADMMTrajOptimizer admm_full = ADMMTrajOptimizer(N, TimeStep);
 
-  admm_full.run(kukaRobot, xinit, solverOptions, ADMM_OPTS, IK_OPT, LIMITS, cp_, cartesianPoses);
+  // --multiple-shooting solves the trajectory block with GaussNewtonMultipleShootingADMM instead of iLQR
+  bool multipleShooting = (argc > 1 && std::string(argv[1]) == "--multiple-shooting");
+
+  admm_full.run(kukaRobot, xinit, solverOptions, ADMM_OPTS, IK_OPT, LIMITS, cp_, cartesianPoses, multipleShooting);
 
 
   // get the final trajectory
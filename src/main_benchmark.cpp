@@ -0,0 +1,477 @@
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <Eigen/Dense>
+
+#include "config.h"
+#include "RobCodGenModel.h"
+#include "robot_dynamics.hpp"
+#include "cost_function_admm.hpp"
+#include "riccati_kernels.hpp"
+#include "kuka_model.h"
+#include "models.h"
+#include "robot_dynamics_autodiff.hpp"
+#include "RobCodGen/codegen/KUKALinearizedForward.h"
+#include "RobCodGen/codegen/KUKALinearizedReverse.h"
+#if CODEGEN_DYNAMICS
+#include "robot_dynamics_codegen.hpp"
+#endif
+
+
+// Benchmark scripts
+using Clock = std::chrono::high_resolution_clock;
+
+/* average wall time of fn over repeats, in ms */
+template<class Function>
+double timeIt(int repeats, Function&& fn)
+{
+  auto start = Clock::now();
+  for (int r = 0; r < repeats; r++) { fn(); }
+  std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+  return elapsed.count() / repeats;
+}
+
+/* the soft contact model with the finite-difference linearize of admm::Dynamics instead of the generated one */
+class FiniteDifferenceDynamics : public admm::Dynamics<RobotAbstract, stateSize, commandSize>
+{
+  using Base = admm::Dynamics<RobotAbstract, stateSize, commandSize>;
+
+public:
+  FiniteDifferenceDynamics(RobotDynamics& model, unsigned int Nsteps) : Base(model.getTimeStep(), Nsteps, model.m_kukaRobot), model_(model) {}
+
+  std::unique_ptr<Workspace> createWorkspace() override {return model_.createWorkspace();}
+  const State& f(const stateVec_t& x, const commandVec_t& u) override {return model_.f(x, u);}
+  const State& f(const stateVec_t& x, const commandVec_t& u, Workspace& ws) override {return model_.f(x, u, ws);}
+
+private:
+  RobotDynamics& model_;
+};
+
+
+/*
+ * The benchmarks, one per feature. They share the robot models and the random trajectory, each one builds its own dynamics
+ * and cost function, so it measures the same when run alone as after the others.
+ */
+class Benchmarks
+{
+public:
+  Benchmarks(unsigned int maxThreads) : maxThreads(maxThreads)
+  {
+    kukaRobot = std::shared_ptr<RobotAbstract>(new RobCodGenModel());
+    kukaRobot->initRobot();
+
+    ContactModel::ContactParams<double> cp_;
+    cp_.E = 1000;
+    cp_.mu = 0.5;
+    cp_.nu = 0.4;
+    cp_.R  = 0.005;
+    cp_.R_path = 1000;
+    cp_.Kd = 10;
+    contactModel.setParams(cp_);
+
+    // random trajectory around a nominal configuration
+    xList = 0.1 * stateVecTab_t::Random(stateSize, N + 1);
+    uList = commandVecTab_t::Random(commandSize, N + 1);
+    xList.row(16).setConstant(1.0);
+
+    KUKAModelKDLInternalData robotParams;
+    robotParams.numJoints = NDOF;
+    robotParams.Kv = Eigen::MatrixXd::Identity(NDOF, NDOF);
+    robotParams.Kp = Eigen::MatrixXd::Identity(NDOF, NDOF);
+    kdlModel = std::make_shared<KUKAModelKDL>(KDL::KukaDHKdl()(), robotParams);
+    kdlRobot = kdlModel;
+    kdlRobot->initRobot();
+  }
+
+  // per-knot linearization (fx) against the number of threads
+  void linearization()
+  {
+    RobotDynamics kukaDynamics(TimeStep, N, kukaRobot, contactModel);
+
+    std::cout << "linearization over " << N << " knots" << std::endl;
+    std::cout << "threads,\t time [ms], \t speedup" << std::endl;
+
+    double serial = 0.0;
+    for (unsigned int threads = 1; threads <= maxThreads; threads++)
+    {
+      kukaDynamics.setNumThreads(threads);
+      kukaDynamics.fx(xList, uList); // warm up the workers
+
+      double ms = timeIt(repeats, [&] { kukaDynamics.fx(xList, uList); });
+      if (threads == 1) { serial = ms; }
+
+      printf("%-14d%-15.3f%-15.2f\n", threads, ms, serial / ms);
+    }
+  }
+
+  // forward against reverse mode on the rigid model, the only one generated in both modes by ADCodegenLinearizer
+  void rigidLinearization()
+  {
+    ct::models::KUKA::KUKALinearizedForward rigidForward;
+    ct::models::KUKA::KUKALinearizedReverse rigidReverse;
+    ct::core::StateVector<14> x;
+    ct::core::ControlVector<7> u;
+    Eigen::Matrix<double, 14, 14> A[2];
+    Eigen::Matrix<double, 14, 7> B[2];
+
+    auto sweep = [&](auto& linearizer, int r) {
+      for (unsigned int k = 0; k < N; k++)
+      {
+        x = xList.col(k).head<14>(); u = uList.col(k);
+        A[r] = linearizer.getDerivativeState(x, u, 0.0);
+        B[r] = linearizer.getDerivativeControl(x, u, 0.0);
+      }
+    };
+
+    double forward = timeIt(repeats, [&] { sweep(rigidForward, 0); });
+    double reverse = timeIt(repeats, [&] { sweep(rigidReverse, 1); });
+    double difference = std::max((A[0] - A[1]).cwiseAbs().maxCoeff(), (B[0] - B[1]).cwiseAbs().maxCoeff());
+
+    std::cout << "rigid model linearization over " << N << " knots" << std::endl;
+    printf("forward mode: %.3f ms, reverse mode: %.3f ms, max difference %.3e\n", forward, reverse, difference);
+  }
+
+#if FUSED_LINEARIZATION
+  // the soft contact model in fx, separate state and control Jacobians against the fused sweep selected in config.h
+  void fusedLinearization()
+  {
+    ct::models::KUKA::KUKASoftContactSystemLinearizedForward separate;
+    RobotDynamics::Linearizer fused;
+    ct::core::StateVector<stateSize> x;
+    ct::core::ControlVector<commandSize> u;
+    stateVec_t xdot;
+    stateMat_t A[2];
+    stateR_commandC_t B[2];
+
+    double pair = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k < N; k++)
+      {
+        x = xList.col(k); u = uList.col(k);
+        A[0] = separate.getDerivativeState(x, u, 0.0);
+        B[0] = separate.getDerivativeControl(x, u, 0.0);
+      }
+    });
+    double oneSweep = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k < N; k++)
+      {
+        x = xList.col(k); u = uList.col(k);
+        fused.linearize(x, u, xdot, A[1], B[1]);
+      }
+    });
+    double difference = std::max((A[0] - A[1]).cwiseAbs().maxCoeff(), (B[0] - B[1]).cwiseAbs().maxCoeff());
+
+    std::cout << "soft contact linearization over " << N << " knots" << std::endl;
+    printf("separate: %.3f ms, fused (mode %d): %.3f ms, speedup %.2f, max difference %.3e\n", pair, FUSED_LINEARIZATION, oneSweep, pair / oneSweep, difference);
+  }
+#endif
+
+  // one Dual<24> evaluation per knot against the 25 evaluations of admm::Dynamics::fx, and the generated code
+  void dualLinearization()
+  {
+    AutoDiffRobotDynamics kdlDynamics(TimeStep, N, kdlRobot, contactModel);
+    RobotDynamics kukaDynamics(TimeStep, N, kukaRobot, contactModel);
+
+    kdlDynamics.setNumThreads(1);
+
+    double dual = timeIt(repeats, [&] { kdlDynamics.fx(xList, uList); });
+    const stateMatTab_t fxDual = kdlDynamics.getfxList();
+    const stateR_commandC_tab_t fuDual = kdlDynamics.getfuList();
+
+    double numerical = timeIt(repeats, [&] { kdlDynamics.admm::Dynamics<RobotAbstract, stateSize, commandSize>::fx(xList, uList); });
+
+    double difference = 0.0;
+    for (unsigned int k = 0; k < N; k++)
+    {
+      difference = std::max(difference, (fxDual[k] - kdlDynamics.getfxList()[k]).cwiseAbs().maxCoeff());
+      difference = std::max(difference, (fuDual[k] - kdlDynamics.getfuList()[k]).cwiseAbs().maxCoeff());
+    }
+
+    kukaDynamics.setNumThreads(1);
+    double generated = timeIt(repeats, [&] { kukaDynamics.fx(xList, uList); });
+
+    std::cout << "KDL model linearization over " << N << " knots, one thread" << std::endl;
+    printf("numerical: %.3f ms, dual: %.3f ms, generated: %.3f ms, max difference dual/numerical %.3e\n", numerical, dual, generated, difference);
+  }
+
+  // f over every (x, u) of the horizon: the KDL model one state per call, the chain on admm::SimdLanes states per call
+  void batchedDynamics()
+  {
+    AutoDiffRobotDynamics kdlDynamics(TimeStep, N, kdlRobot, contactModel);
+
+    auto ws = kdlDynamics.createWorkspace();
+    stateVecTab_t xdotList[2] = {stateVecTab_t(stateSize, N + 1), stateVecTab_t(stateSize, N + 1)};
+
+    double model = timeIt(repeats, [&] { kdlDynamics.admm::Dynamics<RobotAbstract, stateSize, commandSize>::f_batch(xList, uList, xdotList[0], *ws); });
+    double lanes = timeIt(repeats, [&] { kdlDynamics.f_batch(xList, uList, xdotList[1], *ws); });
+
+    std::cout << "f over " << N + 1 << " states, " << admm::SimdLanes << " lanes" << std::endl;
+    printf("model: %.3g states/s, lanes: %.3g states/s, max difference %.3e\n", (N + 1) / (1e-3 * model), (N + 1) / (1e-3 * lanes),
+           (xdotList[0] - xdotList[1]).cwiseAbs().maxCoeff());
+  }
+
+  // qdd of every state of the horizon, the inertia matrix and LLT of ChainDynParam against the articulated body algorithm
+  void forwardDynamicsAlgorithms()
+  {
+    auto ws = kdlRobot->createWorkspace();
+    Eigen::VectorXd tau(NDOF);
+    Eigen::MatrixXd qddList[2] = {Eigen::MatrixXd(NDOF, N + 1), Eigen::MatrixXd(NDOF, N + 1)};
+    const KUKAModelKDL::ForwardDynamicsAlgorithm algorithms[2] = {KUKAModelKDL::ForwardDynamicsAlgorithm::CompositeRigidBody,
+                                                                  KUKAModelKDL::ForwardDynamicsAlgorithm::ArticulatedBody};
+    double ms[2];
+    for (int i = 0; i < 2; i++)
+    {
+      kdlModel->setForwardDynamicsAlgorithm(algorithms[i]);
+      ms[i] = timeIt(repeats, [&] {
+        for (unsigned int k = 0; k <= N; k++)
+        {
+          const stateVec_t x = xList.col(k);
+          tau = uList.col(k);
+          kdlRobot->getForwardDynamics(*ws, x.data(), x.data() + NDOF, tau, qddList[i].col(k));
+        }
+      });
+    }
+    kdlModel->setForwardDynamicsAlgorithm(KUKAModelKDL::ForwardDynamicsAlgorithm::CompositeRigidBody);
+
+    std::cout << "KDL forward dynamics over " << N + 1 << " states" << std::endl;
+    printf("inertia matrix + LLT: %.3f ms, articulated body: %.3f ms, max difference %.3e\n", ms[0], ms[1], (qddList[0] - qddList[1]).cwiseAbs().maxCoeff());
+  }
+
+  // pose, velocity, J and Jdot of every knot: the KDL solvers one query at a time against the single sweep of getKinematics
+  void kinematics()
+  {
+    auto ws = kdlRobot->createWorkspace();
+    Eigen::Matrix3d poseM;
+    Eigen::Vector3d poseP, vel, accel;
+    const double qdd_zero[NDOF] = {0.0};
+    std::vector<Eigen::Matrix<double, 6, NDOF>, Eigen::aligned_allocator<Eigen::Matrix<double, 6, NDOF>>> J[2], Jdot[2];
+    for (int i = 0; i < 2; i++) { J[i].resize(N + 1); Jdot[i].resize(N + 1); }
+
+    double separate = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k <= N; k++)
+      {
+        const stateVec_t x = xList.col(k);
+        kdlRobot->getForwardKinematics(*ws, x.data(), x.data() + NDOF, qdd_zero, poseM, poseP, vel, accel, false);
+        kdlRobot->getSpatialJacobian(*ws, x.data(), J[0][k]);
+        kdlRobot->getSpatialJacobianDot(*ws, x.data(), x.data() + NDOF, Jdot[0][k]);
+      }
+    });
+    double fused = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k <= N; k++)
+      {
+        const stateVec_t x = xList.col(k);
+        kdlRobot->getKinematics(*ws, x.data(), x.data() + NDOF, poseM, poseP, vel, J[1][k], Jdot[1][k], true);
+      }
+    });
+
+    double difference = 0;
+    for (unsigned int k = 0; k <= N; k++)
+    {
+      difference = std::max(difference, (J[0][k] - J[1][k]).cwiseAbs().maxCoeff());
+      difference = std::max(difference, (Jdot[0][k] - Jdot[1][k]).cwiseAbs().maxCoeff());
+    }
+
+    std::cout << "KDL kinematics over " << N + 1 << " states" << std::endl;
+    printf("separate: %.3f ms, fused: %.3f ms, max difference %.3e\n", separate, fused, difference);
+  }
+
+  // the exact sensitivities of the RK4 step linearize four stages per knot, the Rosenbrock step two points
+  void discreteLinearization()
+  {
+    RobotDynamics kukaDynamics(TimeStep, N, kukaRobot, contactModel);
+
+    kukaDynamics.setNumThreads(maxThreads);
+
+    double euler = timeIt(repeats, [&] { kukaDynamics.fx(xList, uList); });
+    kukaDynamics.setLinearization(admm::Linearization::RK4);
+    double rk4 = timeIt(repeats, [&] { kukaDynamics.fx(xList, uList); });
+    kukaDynamics.setLinearization(admm::Linearization::Euler);
+    kukaDynamics.setIntegrator(admm::Integrator::Rosenbrock);
+    double rosenbrock = timeIt(repeats, [&] { kukaDynamics.fx(xList, uList); });
+    kukaDynamics.setIntegrator(admm::Integrator::RK4);
+
+    std::cout << "discrete linearization over " << N << " knots (" << maxThreads << " threads)" << std::endl;
+    printf("RK4 Euler: %.3f ms, RK4 exact: %.3f ms, Rosenbrock: %.3f ms\n", euler, rk4, rosenbrock);
+  }
+
+  // fx, fu on the finite-difference linearize against central differences of the step they linearize, true if they agree
+  bool rosenbrockLinearization()
+  {
+    RobotDynamics kukaDynamics(TimeStep, N, kukaRobot, contactModel);
+
+    const unsigned int knots = 10;
+    FiniteDifferenceDynamics fdDynamics(kukaDynamics, knots);
+    fdDynamics.setIntegrator(admm::Integrator::Rosenbrock);
+    fdDynamics.fx(xList, uList);
+
+    auto ws = fdDynamics.createWorkspace();
+    double difference = 0;
+    for (unsigned int k = 0; k < knots; k++)
+    {
+      stateMat_t fx;
+      stateR_commandC_t fu;
+      for (int j = 0; j < stateSize + commandSize; j++)
+      {
+        stateVec_t xh = xList.col(k), xl = xList.col(k);
+        commandVec_t uh = uList.col(k), ul = uList.col(k);
+        double& vh = j < stateSize ? xh(j) : uh(j - stateSize);
+        double& vl = j < stateSize ? xl(j) : ul(j - stateSize);
+        // the step solves with the finite-difference A, its own rounding noise calls for the larger step
+        const double h = std::sqrt(std::sqrt(Eigen::NumTraits<double>::epsilon())) * std::max(1.0, std::abs(vh));
+        vh += h;
+        vl -= h;
+
+        const stateVec_t column = (fdDynamics.step(xh, uh, *ws) - fdDynamics.step(xl, ul, *ws)) / (2 * h);
+        if (j < stateSize) { fx.col(j) = column; }
+        else { fu.col(j - stateSize) = column; }
+      }
+
+      difference = std::max(difference, (fx - fdDynamics.getfxList()[k]).cwiseAbs().maxCoeff() / fx.cwiseAbs().maxCoeff());
+      difference = std::max(difference, (fu - fdDynamics.getfuList()[k]).cwiseAbs().maxCoeff() / fu.cwiseAbs().maxCoeff());
+    }
+
+    std::cout << "Rosenbrock fx, fu of the finite-difference linearization over " << knots << " knots" << std::endl;
+    printf("max relative difference to central differences of step %.3e\n", difference);
+    return difference <= 1e-2;
+  }
+
+  // Q expansion and value update over the horizon, on the forward Euler linearization the structured kernel holds for
+  void riccatiKernels()
+  {
+    RobotDynamics kukaDynamics(TimeStep, N, kukaRobot, contactModel);
+    kukaDynamics.setNumThreads(maxThreads);
+    kukaDynamics.fx(xList, uList);
+
+    stateMat_t Vxx = stateMat_t::Random();
+    Vxx = (Vxx * Vxx.transpose()).eval();
+    stateMat_t cxx = stateMat_t::Identity();
+    commandMat_t cuu = commandMat_t::Identity();
+    commandR_stateC_t cux = commandR_stateC_t::Zero();
+    stateVec_t cx = stateVec_t::Random();
+    commandVec_t cu = commandVec_t::Random();
+    commandVec_t k = commandVec_t::Random();
+    commandR_stateC_t K = commandR_stateC_t::Random();
+
+    stateVecTab_t Vx = stateVecTab_t::Random(stateSize, 2);
+    stateVec_t Qx[2];
+    commandVec_t Qu[2];
+    stateMat_t Qxx[2], Vxx_new[2];
+    commandMat_t Quu[2];
+    commandR_stateC_t Qux[2];
+
+    auto sweep = [&](auto kernel, int r) {
+      for (unsigned int i = 0; i < N; i++)
+      {
+        kernel.expand(TimeStep, cx, cu, cxx, cuu, cux, kukaDynamics.getfxList()[i], kukaDynamics.getfuList()[i], Vx.col(0), Vxx, Qx[r], Qu[r], Qxx[r], Quu[r], Qux[r]);
+        kernel.value(Qx[r], Qu[r], Qxx[r], Quu[r], Qux[r], k, K, Vx.col(1), Vxx_new[r]);
+      }
+    };
+
+    double generic    = timeIt(repeats, [&] { sweep(admm::GenericRiccati(), 0); });
+    double structured = timeIt(repeats, [&] { sweep(admm::SoftContactRiccati(), 1); });
+    double difference = std::max((Qxx[0] - Qxx[1]).cwiseAbs().maxCoeff(), (Vxx_new[0] - Vxx_new[1]).cwiseAbs().maxCoeff());
+
+    std::cout << "Riccati kernels over " << N << " knots" << std::endl;
+    printf("generic: %.3f ms, structured: %.3f ms, speedup %.2f, max difference %.3e\n", generic, structured, generic / structured, difference);
+  }
+
+#if CODEGEN_DYNAMICS
+  // RK4 rollout over the horizon through the model against the generated step
+  void generatedRollout()
+  {
+    RobotDynamics kukaDynamics(TimeStep, N, kukaRobot, contactModel);
+
+    GeneratedRobotDynamics generatedDynamics(TimeStep, N, kukaRobot, contactModel);
+    auto modelWs = kukaDynamics.createWorkspace();
+    auto generatedWs = generatedDynamics.createWorkspace();
+    stateVecTab_t rollout[2] = {xList, xList};
+
+    double model = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k < N; k++) { rollout[0].col(k + 1) = kukaDynamics.step(rollout[0].col(k), uList.col(k), *modelWs); }
+    });
+    double generated = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k < N; k++) { rollout[1].col(k + 1) = generatedDynamics.step(rollout[1].col(k), uList.col(k), *generatedWs); }
+    });
+
+    std::cout << "RK4 rollout over " << N << " knots" << std::endl;
+    printf("model: %.3f ms, generated: %.3f ms, speedup %.2f, max state difference %.3e\n", model, generated, model / generated, (rollout[0] - rollout[1]).cwiseAbs().maxCoeff());
+  }
+#endif
+
+  // knot-by-knot calls against one call over the horizon, on a trajectory whose kinematics are not cached yet
+  void cost()
+  {
+    std::shared_ptr<CostFunctionADMM> costFunction = std::make_shared<CostFunctionADMM>(N, kukaRobot);
+    costFunction->setNumThreads(maxThreads);
+
+    stateVecTab_t x_bar = stateVecTab_t::Zero(stateSize, N + 1);
+    commandVecTab_t u_bar = commandVecTab_t::Zero(commandSize, N + 1);
+    Eigen::MatrixXd c_bar = Eigen::MatrixXd::Zero(2, N + 1);
+    Eigen::MatrixXd theta_bar = Eigen::MatrixXd::Zero(NDOF, N + 1);
+    Eigen::VectorXd rho(5);
+    rho << 1, 1e-3, 1, 0, 1;
+    Eigen::VectorXd R_c = Eigen::VectorXd::Constant(N + 1, 1000);
+    costVecTab_t costs(N + 1);
+
+    auto ws = costFunction->createWorkspace();
+    double perKnot = timeIt(repeats, [&] {
+      for (unsigned int k = 0; k <= N; k++)
+      {
+        costs[k] = costFunction->cost_func_expre_admm(*ws, k, xList.col(k), uList.col(k), xList.col(k), c_bar.col(k), x_bar.col(k), u_bar.col(k), theta_bar.col(k), rho, R_c);
+      }
+    });
+    double batch = timeIt(repeats, [&] {
+      costFunction->getKinematicsCache()->invalidate();
+      costFunction->cost_func_expre_admm(xList, uList, xList, c_bar, x_bar, u_bar, theta_bar, rho, R_c, costs);
+    });
+
+    std::cout << "cost over " << N << " knots" << std::endl;
+    printf("per knot: %.3f ms, whole trajectory (%d threads): %.3f ms\n", perKnot, maxThreads, batch);
+  }
+
+private:
+  unsigned int N = NumberofKnotPt;
+  int repeats = 10;
+  unsigned int maxThreads;
+
+  std::shared_ptr<RobotAbstract> kukaRobot;
+  ContactModel::SoftContactModel<double> contactModel;
+
+  // the KDL model, described by a rigid body chain for the dual number and lane parallel backends
+  std::shared_ptr<KUKAModelKDL> kdlModel;
+  std::shared_ptr<RobotAbstract> kdlRobot;
+
+  stateVecTab_t xList;
+  commandVecTab_t uList;
+};
+
+
+int main(int argc, char *argv[]) {
+
+  unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (argc > 1) { maxThreads = std::stoi(argv[1]); }
+
+  Benchmarks benchmarks(maxThreads);
+
+  // every benchmark runs, the checks among them decide the exit status
+  bool passed = true;
+
+  benchmarks.linearization();
+  benchmarks.rigidLinearization();
+#if FUSED_LINEARIZATION
+  benchmarks.fusedLinearization();
+#endif
+  benchmarks.dualLinearization();
+  benchmarks.batchedDynamics();
+  benchmarks.forwardDynamicsAlgorithms();
+  benchmarks.kinematics();
+  benchmarks.discreteLinearization();
+  passed = benchmarks.rosenbrockLinearization() && passed;
+  benchmarks.riccatiKernels();
+#if CODEGEN_DYNAMICS
+  benchmarks.generatedRollout();
+#endif
+  benchmarks.cost();
+
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,128 @@
+#include <memory>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <iostream>
+#include <Eigen/Dense>
+
+#include "config.h"
+#include "RobCodGenModel.h"
+#include "robot_dynamics.hpp"
+#include "cost_function_admm.hpp"
+#include "IterativeLinearQuadraticRegulatorADMM.hpp"
+
+// Test scripts: no heap allocation in a warm iLQR iteration, on one thread
+
+/*
+ * Heap allocation counter. On glibc malloc itself is hooked, which sees operator new as well as Eigen's aligned_malloc.
+ * Elsewhere only operator new is counted.
+ */
+static std::atomic<long> allocations{0};
+
+#if defined(__GLIBC__)
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* malloc(std::size_t size)
+{
+	allocations++;
+	return __libc_malloc(size);
+}
+#else
+void* operator new(std::size_t size)
+{
+	allocations++;
+	if (void* p = std::malloc(size ? size : 1)) return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+#endif
+
+/* heap allocations of one call of fn */
+template<class Function>
+long countAllocations(Function&& fn)
+{
+	const long before = allocations;
+	fn();
+	return allocations - before;
+}
+
+/* prints one check, true if nothing was allocated */
+bool report(const char* name, long allocated)
+{
+	const bool ok = allocated == 0;
+	std::cout << (ok ? "[ ok ] " : "[FAIL] ") << name << ": " << allocated << " heap allocations" << std::endl;
+	return ok;
+}
+
+
+int main() {
+
+	std::shared_ptr<RobotAbstract> kukaRobot = std::shared_ptr<RobotAbstract>(new RobCodGenModel());
+	kukaRobot->initRobot();
+
+	ContactModel::ContactParams<double> cp_;
+	cp_.E = 1000;
+	cp_.mu = 0.5;
+	cp_.nu = 0.4;
+	cp_.R  = 0.005;
+	cp_.R_path = 1000;
+	cp_.Kd = 10;
+	ContactModel::SoftContactModel<double> contactModel(cp_);
+
+	const unsigned int N = NumberofKnotPt;
+
+	// one thread, the worker pools are not part of the check
+	std::shared_ptr<RobotDynamics> dynamics = std::make_shared<RobotDynamics>(TimeStep, N, kukaRobot, contactModel);
+	dynamics->setNumThreads(1);
+	std::shared_ptr<CostFunctionADMM> costFunction = std::make_shared<CostFunctionADMM>(N, kukaRobot);
+	costFunction->setNumThreads(1);
+
+	// random trajectory around a nominal configuration
+	stateVecTab_t xList = 0.1 * stateVecTab_t::Random(stateSize, N + 1);
+	commandVecTab_t uList = commandVecTab_t::Random(commandSize, N + 1);
+	xList.row(16).setConstant(1.0);
+
+	stateVecTab_t xTrack = stateVecTab_t::Zero(stateSize, N + 1);
+	Eigen::MatrixXd cList_bar = Eigen::MatrixXd::Zero(2, N + 1);
+	Eigen::MatrixXd thetaList_bar = Eigen::MatrixXd::Zero(NDOF, N + 1);
+	stateVecTab_t xList_bar = stateVecTab_t::Zero(stateSize, N + 1);
+	commandVecTab_t uList_bar = commandVecTab_t::Zero(commandSize, N + 1);
+	Eigen::VectorXd rho(5);
+	rho << 1, 1e-3, 1, 0, 1;
+	Eigen::VectorXd R_c = Eigen::VectorXd::Constant(N + 1, 1000);
+
+	bool passed = true;
+
+	// the parts of an iteration that can be called on their own, each warmed up once
+	dynamics->fx(xList, uList);
+	passed = report("fx", countAllocations([&] { dynamics->fx(xList, uList); })) && passed;
+
+	auto derivatives = [&] {
+		costFunction->getKinematicsCache()->invalidate();
+		costFunction->computeDerivatives(xList, uList, xTrack, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c);
+	};
+	derivatives();
+	passed = report("cost derivatives", countAllocations(derivatives)) && passed;
+
+	// one iteration of the solver: rollout, fx, cost derivatives, backward pass and forward pass, after a warm-up solve
+	optimizer::IterativeLinearQuadraticRegulatorADMM::OptSet solverOptions;
+	solverOptions.n_hor       = N;
+	solverOptions.max_iter    = 1;
+	solverOptions.debug_level = 0;
+
+	stateVec_t x0 = xList.col(0);
+	commandVecTab_t u0 = commandVecTab_t::Zero(commandSize, N);
+
+	optimizer::IterativeLinearQuadraticRegulatorADMM solver(dynamics, costFunction, solverOptions, N, TimeStep, ENABLE_FULLDDP, DISABLE_QPBOX);
+	auto iteration = [&] { solver.solve(x0, u0, xTrack, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c); };
+	iteration();
+	passed = report("iLQR iteration", countAllocations(iteration)) && passed;
+
+	// the same with the box QP on the control limits of the drivers
+	optimizer::IterativeLinearQuadraticRegulatorADMM boxSolver(dynamics, costFunction, solverOptions, N, TimeStep, ENABLE_FULLDDP, ENABLE_QPBOX);
+	boxSolver.setControlLimits(commandVec_t::Constant(-20), commandVec_t::Constant(20));
+	auto boxIteration = [&] { boxSolver.solve(x0, u0, xTrack, cList_bar, xList_bar, uList_bar, thetaList_bar, rho, R_c); };
+	boxIteration();
+	passed = report("iLQR iteration with the box QP", countAllocations(boxIteration)) && passed;
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
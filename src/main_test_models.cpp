@@ -4,10 +4,159 @@
 #include "cost_function_admm.hpp"
 #include "models.h"
 #include "config.h"
+#include "RobCodGenModel.h"
+#if CODEGEN_DYNAMICS
+#include "robot_dynamics_codegen.hpp"
+#endif
+
+#include <cstdlib>
+#include <random>
 
 // Test scripts
 Eigen::IOFormat CleanFmt(4, 0, ", ", "\n", "[", "]");
 
+/* prints one check, true if the error is within tol */
+bool report(const char* name, double error, double tol)
+{
+	const bool ok = error <= tol;
+	std::cout << (ok ? "[ ok ] " : "[FAIL] ") << name << ": " << error << " (tolerance " << tol << ")" << std::endl;
+	return ok;
+}
+
+#if CODEGEN_CONTACT_COST
+/* generated dv/d(q, qd) of RobCodGenModel against central differences of the velocity of getForwardKinematics */
+bool testVelocityJacobian()
+{
+	RobCodGenModel model;
+	model.initRobot();
+	std::unique_ptr<RobotAbstractWorkspace> ws = model.createWorkspace();
+
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<double> uniform(-2, 2);
+	const double qdd[NDOF] = {0.0};
+	Eigen::Matrix3d poseM;
+	Eigen::Vector3d poseP, vel_p, vel_m, accel;
+
+	double error = 0;
+	bool exact = true;
+	for (int trial = 0; trial < 20; trial++)
+	{
+		Eigen::Matrix<double, 2 * NDOF, 1> x;
+		for (int i = 0; i < 2 * NDOF; i++) { x(i) = uniform(rng); }
+
+		Eigen::Matrix<double, 3, 2 * NDOF> dvdx, numeric;
+		exact = model.getEEVelocityJacobian(*ws, x.data(), x.data() + NDOF, dvdx) && exact;
+
+		for (int j = 0; j < 2 * NDOF; j++)
+		{
+			const double h = 1e-6;
+			Eigen::Matrix<double, 2 * NDOF, 1> xp = x, xm = x;
+			xp(j) += h; xm(j) -= h;
+			model.getForwardKinematics(*ws, xp.data(), xp.data() + NDOF, qdd, poseM, poseP, vel_p, accel, false);
+			model.getForwardKinematics(*ws, xm.data(), xm.data() + NDOF, qdd, poseM, poseP, vel_m, accel, false);
+			numeric.col(j) = (vel_p - vel_m) / (2 * h);
+		}
+		error = std::max(error, (dvdx - numeric).cwiseAbs().maxCoeff());
+	}
+
+	return report("generated velocity Jacobian exact", exact ? 0.0 : 1.0, 0.0)
+	     & report("generated velocity Jacobian vs central differences", error, 1e-6);
+}
+#endif
+
+#if FUSED_LINEARIZATION
+/* fused linearization of RobotDynamics against KUKASoftContactFDSystem: f directly, dF/dx and dF/du against central differences of f */
+bool testFusedLinearization(const ContactModel::ContactParams<double>& cp, const char* name)
+{
+	typedef ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::Dynamics> System;
+	typedef RobotDynamics::Linearizer Linearizer;
+
+	System system(cp);
+	Linearizer linearizer;
+	linearizer.setParameters(cp.toVector());
+
+	std::mt19937 rng(2);
+	std::uniform_real_distribution<double> uniform(-1, 1);
+
+	double errorF = 0, errorAB = 0;
+	for (int trial = 0; trial < 20; trial++)
+	{
+		System::state_vector_t x, f_ref, f_p, f_m;
+		System::control_vector_t u;
+		for (int i = 0; i < 2 * NDOF; i++) { x(i) = 2 * uniform(rng); }
+		for (int i = 2 * NDOF; i < stateSize; i++) { x(i) = 20 * uniform(rng); }
+		for (int i = 0; i < commandSize; i++) { u(i) = 10 * uniform(rng); }
+
+		Linearizer::state_vector_t f;
+		Linearizer::state_matrix_t A;
+		Linearizer::state_control_matrix_t B;
+		linearizer.linearize(x, u, f, A, B);
+		system.computeControlledDynamics(x, 0.0, u, f_ref);
+		errorF = std::max(errorF, (f - f_ref).cwiseAbs().maxCoeff() / std::max(1.0, f_ref.cwiseAbs().maxCoeff()));
+
+		Eigen::Matrix<double, stateSize, stateSize + commandSize> AB, numeric;
+		AB << A, B;
+		for (int j = 0; j < stateSize + commandSize; j++)
+		{
+			System::state_vector_t xp = x, xm = x;
+			System::control_vector_t up = u, um = u;
+			double& vp = j < stateSize ? xp(j) : up(j - stateSize);
+			double& vm = j < stateSize ? xm(j) : um(j - stateSize);
+			const double h = 1e-6 * std::max(1.0, std::abs(vp));
+			vp += h; vm -= h;
+			system.computeControlledDynamics(xp, 0.0, up, f_p);
+			system.computeControlledDynamics(xm, 0.0, um, f_m);
+			numeric.col(j) = (f_p - f_m) / (2 * h);
+		}
+		errorAB = std::max(errorAB, (AB - numeric).cwiseAbs().maxCoeff() / std::max(1.0, numeric.cwiseAbs().maxCoeff()));
+	}
+
+	std::cout << "fused linearization, " << name << " contact parameters" << std::endl;
+	return report("  f vs KUKASoftContactFDSystem", errorF, 1e-12)
+	     & report("  dF/dx, dF/du vs central differences", errorAB, 1e-5);
+}
+#endif
+
+#if CODEGEN_DYNAMICS
+/* f and the RK4 step of GeneratedRobotDynamics against RobotDynamics on the same RobCodGenModel and contact model */
+bool testGeneratedDynamics(const ContactModel::SoftContactModel<double>& contactModel)
+{
+	std::shared_ptr<RobotAbstract> robot = std::make_shared<RobCodGenModel>();
+	robot->initRobot();
+
+	RobotDynamics model(TimeStep, 10, robot, contactModel);
+	GeneratedRobotDynamics generated(TimeStep, 10, robot, contactModel);
+	model.setIntegrator(admm::Integrator::RK4);
+	generated.setIntegrator(admm::Integrator::RK4);
+	auto modelWs = model.createWorkspace();
+	auto generatedWs = generated.createWorkspace();
+
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<double> uniform(-1, 1);
+
+	double errorF = 0, errorStep = 0;
+	for (int trial = 0; trial < 20; trial++)
+	{
+		stateVec_t x;
+		commandVec_t u;
+		for (int i = 0; i < 2 * NDOF; i++) { x(i) = 2 * uniform(rng); }
+		for (int i = 2 * NDOF; i < stateSize; i++) { x(i) = 20 * uniform(rng); }
+		for (int i = 0; i < commandSize; i++) { u(i) = 10 * uniform(rng); }
+
+		const stateVec_t f_ref = model.f(x, u, *modelWs);
+		const stateVec_t f = generated.f(x, u, *generatedWs);
+		errorF = std::max(errorF, (f - f_ref).cwiseAbs().maxCoeff() / std::max(1.0, f_ref.cwiseAbs().maxCoeff()));
+
+		const stateVec_t step_ref = model.step(x, u, *modelWs);
+		const stateVec_t step = generated.step(x, u, *generatedWs);
+		errorStep = std::max(errorStep, (step - step_ref).cwiseAbs().maxCoeff() / std::max(1.0, step_ref.cwiseAbs().maxCoeff()));
+	}
+
+	return report("generated f vs RobotDynamics::f", errorF, 1e-10)
+	     & report("generated RK4 step vs RobotDynamics::step", errorStep, 1e-10);
+}
+#endif
+
 
 int main() {
 
@@ -107,9 +256,23 @@ int main() {
 
 	// // ----------------------------------------------------------------------------------------------------------
 
-
-
-
+	// ----------------------------------------------------------------------------------------------------------
+	// checks of the generated code, each one runs regardless of the others
+	bool passed = true;
+#if CODEGEN_CONTACT_COST
+	passed = testVelocityJacobian() && passed;
+#endif
+#if FUSED_LINEARIZATION
+	passed = report("fused linearization non-zeros", std::abs(RobotDynamics::Linearizer::NNZ - 195), 0) && passed;
+	passed = report("fused linearization parameters", std::abs(int(RobotDynamics::Linearizer::PARAM_DIM) - 6), 0) && passed;
+	passed = testFusedLinearization(ct::rbd::KUKASoftContactFDSystem<ct::rbd::KUKA::Dynamics>::defaultContactParams(), "default") && passed;
+	passed = testFusedLinearization(cp_, "test") && passed;
+#endif
+#if CODEGEN_DYNAMICS
+	passed = testGeneratedDynamics(contactModel) && passed;
+#endif
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 